@@ -0,0 +1,272 @@
+/**
+ * @file IOLoaders.benchmark.cpp
+ * @brief Benchmarks for loading analog and event data through LoaderRegistry
+ *
+ * This benchmark suite tests the performance of:
+ * 1. CSV: two-column analog trace and single-column event times
+ * 2. Binary: multi-channel int16 recording, first channel and all channels
+ * 3. HDF5: time/value double arrays (only when built with ENABLE_HDF5)
+ *
+ * Input files are written once into a temporary directory from the
+ * GaussianNoise and PoissonEvents generators and removed at exit. The timings
+ * include file parsing but the files will usually be in the page cache.
+ *
+ * Profiling Usage:
+ * ----------------
+ * perf record -g ./benchmark_IOLoaders --benchmark_filter=CSV
+ * perf report
+ */
+
+#include "fixtures/SyntheticFixtures.hpp"
+
+#include "DataTypeEnum/DM_DataType.hpp"
+#include "IO/core/LoaderRegistration.hpp"
+#include "IO/core/LoaderRegistry.hpp"
+
+#ifdef ENABLE_HDF5
+#include <H5Cpp.h>
+#endif
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace WhiskerToolbox::Benchmark;
+
+namespace {
+
+constexpr std::size_t kNumChannels = 16;
+
+/**
+ * @brief Input files shared by all IOLoaders benchmarks
+ *
+ * Created on first use, deleted when the executable exits.
+ */
+class LoaderInputFiles {
+public:
+    LoaderInputFiles() {
+        dir = std::filesystem::temp_directory_path() / "whiskertoolbox_benchmark_io";
+        std::filesystem::create_directories(dir);
+
+        num_samples = Synthetic::scaled(200'000);
+        auto const trace = Synthetic::analogNoise(num_samples)->getAnalogTimeSeries();
+
+        analog_csv = dir / "analog.csv";
+        {
+            std::ofstream out(analog_csv);
+            out << "time,value\n";
+            for (std::size_t i = 0; i < trace.size(); ++i) {
+                out << i << ',' << trace[i] << '\n';
+            }
+        }
+
+        auto const events = Synthetic::poissonEvents(num_samples * 10);
+        num_events = events->size();
+        events_csv = dir / "events.csv";
+        {
+            std::ofstream out(events_csv);
+            out << "time\n";
+            for (std::size_t i = 0; i < events->size(); ++i) {
+                out << events->getStoredEvent(i).getValue() << '\n';
+            }
+        }
+
+        // Interleaved int16 samples, channel-major within each time step
+        binary_int16 = dir / "recording.bin";
+        {
+            std::vector<int16_t> samples;
+            samples.reserve(num_samples * kNumChannels);
+            for (std::size_t i = 0; i < num_samples; ++i) {
+                for (std::size_t c = 0; c < kNumChannels; ++c) {
+                    samples.push_back(static_cast<int16_t>(trace[i] * 1000.0f) + static_cast<int16_t>(c));
+                }
+            }
+            std::ofstream out(binary_int16, std::ios::binary);
+            out.write(reinterpret_cast<char const *>(samples.data()),
+                      static_cast<std::streamsize>(samples.size() * sizeof(int16_t)));
+        }
+
+#ifdef ENABLE_HDF5
+        analog_h5 = dir / "analog.h5";
+        {
+            std::vector<double> times(num_samples);
+            std::vector<double> values(num_samples);
+            for (std::size_t i = 0; i < num_samples; ++i) {
+                times[i] = static_cast<double>(i);
+                values[i] = static_cast<double>(trace[i]);
+            }
+            H5::H5File file(analog_h5.string(), H5F_ACC_TRUNC);
+            hsize_t const dims[1] = {num_samples};
+            H5::DataSpace const space(1, dims);
+            file.createDataSet("time", H5::PredType::NATIVE_DOUBLE, space)
+                    .write(times.data(), H5::PredType::NATIVE_DOUBLE);
+            file.createDataSet("value", H5::PredType::NATIVE_DOUBLE, space)
+                    .write(values.data(), H5::PredType::NATIVE_DOUBLE);
+        }
+#endif
+    }
+
+    ~LoaderInputFiles() {
+        std::error_code ec;
+        std::filesystem::remove_all(dir, ec);
+    }
+
+    LoaderInputFiles(LoaderInputFiles const &) = delete;
+    LoaderInputFiles & operator=(LoaderInputFiles const &) = delete;
+
+    std::filesystem::path dir;
+    std::size_t num_samples = 0;
+    std::size_t num_events = 0;
+    std::filesystem::path analog_csv;
+    std::filesystem::path events_csv;
+    std::filesystem::path binary_int16;
+    std::filesystem::path analog_h5;
+};
+
+LoaderInputFiles const & inputFiles() {
+    static LoaderInputFiles const files;
+    return files;
+}
+
+}// namespace
+
+// ============================================================================
+// Benchmark Fixture
+// ============================================================================
+
+class IOLoadersBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State const & /*state*/) override {
+        static bool const loaders_registered = [] {
+            registerAllLoaders();
+            return true;
+        }();
+        benchmark::DoNotOptimize(loaders_registered);
+        files_ = &inputFiles();
+    }
+
+protected:
+    /// Skip the benchmark if a load failed instead of timing the error path
+    static bool checkLoaded(benchmark::State & state, bool success, std::string const & error) {
+        if (!success) {
+            state.SkipWithError(error.c_str());
+        }
+        return success;
+    }
+
+    void reportStats(benchmark::State & state, std::size_t items_per_iteration) const {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                                static_cast<int64_t>(items_per_iteration));
+    }
+
+    LoaderInputFiles const * files_ = nullptr;
+};
+
+// ============================================================================
+// CSV
+// ============================================================================
+
+BENCHMARK_DEFINE_F(IOLoadersBenchmark, CSV_Analog)(benchmark::State & state) {
+    nlohmann::json const config{
+            {"filepath", files_->analog_csv.string()},
+            {"delimiter", ","},
+            {"has_header", true},
+            {"single_column_format", false},
+            {"time_column", 0},
+            {"data_column", 1}};
+    auto & registry = LoaderRegistry::getInstance();
+    for (auto _: state) {
+        auto result = registry.tryLoad("csv", DM_DataType::Analog, files_->analog_csv.string(), config);
+        if (!checkLoaded(state, result.success, result.error_message)) {
+            break;
+        }
+        benchmark::DoNotOptimize(result.data);
+    }
+    reportStats(state, files_->num_samples);
+}
+BENCHMARK_REGISTER_F(IOLoadersBenchmark, CSV_Analog)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(IOLoadersBenchmark, CSV_DigitalEvent)(benchmark::State & state) {
+    nlohmann::json const config{
+            {"delimiter", ","},
+            {"has_header", true},
+            {"event_column", 0}};
+    auto & registry = LoaderRegistry::getInstance();
+    for (auto _: state) {
+        auto result = registry.tryLoad("csv", DM_DataType::DigitalEvent, files_->events_csv.string(), config);
+        if (!checkLoaded(state, result.success, result.error_message)) {
+            break;
+        }
+        benchmark::DoNotOptimize(result.data);
+    }
+    reportStats(state, files_->num_events);
+}
+BENCHMARK_REGISTER_F(IOLoadersBenchmark, CSV_DigitalEvent)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Binary
+// ============================================================================
+
+BENCHMARK_DEFINE_F(IOLoadersBenchmark, Binary_Analog_FirstChannel)(benchmark::State & state) {
+    nlohmann::json const config{
+            {"header_size", 0},
+            {"num_channels", kNumChannels},
+            {"binary_data_type", "int16"}};
+    auto & registry = LoaderRegistry::getInstance();
+    for (auto _: state) {
+        auto result = registry.tryLoad("binary", DM_DataType::Analog, files_->binary_int16.string(), config);
+        if (!checkLoaded(state, result.success, result.error_message)) {
+            break;
+        }
+        benchmark::DoNotOptimize(result.data);
+    }
+    reportStats(state, files_->num_samples * kNumChannels);
+}
+BENCHMARK_REGISTER_F(IOLoadersBenchmark, Binary_Analog_FirstChannel)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(IOLoadersBenchmark, Binary_Analog_AllChannels)(benchmark::State & state) {
+    nlohmann::json const config{
+            {"header_size", 0},
+            {"num_channels", kNumChannels},
+            {"binary_data_type", "int16"}};
+    auto & registry = LoaderRegistry::getInstance();
+    for (auto _: state) {
+        auto result = registry.tryLoadBatch("binary", DM_DataType::Analog, files_->binary_int16.string(), config);
+        if (!checkLoaded(state, result.success, result.error_message)) {
+            break;
+        }
+        benchmark::DoNotOptimize(result.results);
+    }
+    state.counters["channels"] = static_cast<double>(kNumChannels);
+    reportStats(state, files_->num_samples * kNumChannels);
+}
+BENCHMARK_REGISTER_F(IOLoadersBenchmark, Binary_Analog_AllChannels)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// HDF5
+// ============================================================================
+
+#ifdef ENABLE_HDF5
+BENCHMARK_DEFINE_F(IOLoadersBenchmark, HDF5_Analog)(benchmark::State & state) {
+    nlohmann::json const config{
+            {"time_key", "time"},
+            {"value_key", "value"}};
+    auto & registry = LoaderRegistry::getInstance();
+    for (auto _: state) {
+        auto result = registry.tryLoad("hdf5", DM_DataType::Analog, files_->analog_h5.string(), config);
+        if (!checkLoaded(state, result.success, result.error_message)) {
+            break;
+        }
+        benchmark::DoNotOptimize(result.data);
+    }
+    reportStats(state, files_->num_samples);
+}
+BENCHMARK_REGISTER_F(IOLoadersBenchmark, HDF5_Analog)->Unit(benchmark::kMillisecond);
+#endif
@@ -0,0 +1,150 @@
+/**
+ * @file LineBatch.benchmark.cpp
+ * @brief Benchmarks for CorePlotting line batches and polyline decimation
+ *
+ * This benchmark suite tests the performance of:
+ * 1. buildLineBatchFromLineData: LineData → LineBatchData segments
+ * 2. CpuLineBatchIntersector: line selection queries against the batch
+ * 3. decimatePolyLineBatchMinMax: min–max decimation of dense analog traces
+ *
+ * Lines come from the MovingLine generator in a 640x480 image; traces from
+ * the GaussianNoise generator, one strip per channel.
+ *
+ * Profiling Usage:
+ * ----------------
+ * perf record -g ./benchmark_LineBatch --benchmark_filter=Intersect
+ * perf report
+ */
+
+#include "fixtures/SyntheticFixtures.hpp"
+
+#include "CorePlotting/LineBatch/CpuLineBatchIntersector.hpp"
+#include "CorePlotting/LineBatch/LineBatchBuilder.hpp"
+#include "CorePlotting/LineBatch/LineBatchData.hpp"
+#include "CorePlotting/LineDecimation/MinMaxPolylineDecimation.hpp"
+#include "CorePlotting/SceneGraph/RenderablePrimitives.hpp"
+
+#include <benchmark/benchmark.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace WhiskerToolbox::Benchmark;
+
+namespace {
+
+constexpr float kWidth = 640.0f;
+constexpr float kHeight = 480.0f;
+constexpr std::size_t kNumQueries = 100;
+constexpr std::size_t kNumChannels = 32;
+
+}// namespace
+
+// ============================================================================
+// Benchmark Fixture
+// ============================================================================
+
+class LineBatchBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State const & /*state*/) override {
+        if (lines_) {
+            return;
+        }
+        lines_ = Synthetic::movingLines(Synthetic::scaled(5'000), 100);
+        batch_ = CorePlotting::buildLineBatchFromLineData(*lines_, kWidth, kHeight);
+
+        // World [0, 640] x [0, 480] → NDC [-1, 1]
+        mvp_ = glm::mat4(1.0f);
+        mvp_[0][0] = 2.0f / kWidth;
+        mvp_[1][1] = 2.0f / kHeight;
+        mvp_[3][0] = -1.0f;
+        mvp_[3][1] = -1.0f;
+
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> ndc_dist(-1.0f, 1.0f);
+        queries_.reserve(kNumQueries);
+        for (std::size_t i = 0; i < kNumQueries; ++i) {
+            queries_.push_back(CorePlotting::LineIntersectionQuery{
+                    .start_ndc = {ndc_dist(rng), ndc_dist(rng)},
+                    .end_ndc = {ndc_dist(rng), ndc_dist(rng)},
+                    .tolerance = 0.01f,
+                    .mvp = mvp_});
+        }
+
+        samples_per_channel_ = Synthetic::scaled(100'000);
+        for (std::size_t c = 0; c < kNumChannels; ++c) {
+            auto const trace = Synthetic::analogNoise(samples_per_channel_, 100 + c);
+            auto const values = trace->getAnalogTimeSeries();
+            traces_.line_start_indices.push_back(static_cast<int32_t>(traces_.vertices.size() / 2));
+            traces_.line_vertex_counts.push_back(static_cast<int32_t>(values.size()));
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                traces_.vertices.push_back(static_cast<float>(i));
+                traces_.vertices.push_back(values[i] + static_cast<float>(c) * 10.0f);
+            }
+        }
+    }
+
+protected:
+    std::shared_ptr<LineData> lines_;
+    CorePlotting::LineBatchData batch_;
+    glm::mat4 mvp_{1.0f};
+    std::vector<CorePlotting::LineIntersectionQuery> queries_;
+    std::size_t samples_per_channel_ = 0;
+    CorePlotting::RenderablePolyLineBatch traces_;
+};
+
+// ============================================================================
+// Line batches
+// ============================================================================
+
+BENCHMARK_DEFINE_F(LineBatchBenchmark, Build_FromLineData)(benchmark::State & state) {
+    for (auto _: state) {
+        auto batch = CorePlotting::buildLineBatchFromLineData(*lines_, kWidth, kHeight);
+        benchmark::DoNotOptimize(batch);
+    }
+    state.counters["segments"] = static_cast<double>(batch_.numSegments());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(batch_.numLines()));
+}
+BENCHMARK_REGISTER_F(LineBatchBenchmark, Build_FromLineData)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(LineBatchBenchmark, Intersect_Cpu)(benchmark::State & state) {
+    CorePlotting::CpuLineBatchIntersector const intersector;
+    for (auto _: state) {
+        std::size_t hits = 0;
+        for (auto const & query: queries_) {
+            hits += intersector.intersect(batch_, query).intersected_line_indices.size();
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+    state.counters["segments"] = static_cast<double>(batch_.numSegments());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(queries_.size()));
+}
+BENCHMARK_REGISTER_F(LineBatchBenchmark, Intersect_Cpu)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Decimation
+// ============================================================================
+
+BENCHMARK_DEFINE_F(LineBatchBenchmark, Decimate_MinMax)(benchmark::State & state) {
+    CorePlotting::MinMaxDecimationParams const params{.bucket_count = static_cast<int>(state.range(0))};
+    std::size_t output_vertices = 0;
+    for (auto _: state) {
+        auto decimated = CorePlotting::decimatePolyLineBatchMinMax(traces_, params);
+        output_vertices = decimated.vertices.size() / 2;
+        benchmark::DoNotOptimize(decimated);
+    }
+    state.counters["channels"] = static_cast<double>(kNumChannels);
+    state.counters["output_vertices"] = static_cast<double>(output_vertices);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(traces_.vertices.size() / 2));
+}
+BENCHMARK_REGISTER_F(LineBatchBenchmark, Decimate_MinMax)
+        ->Arg(1'000)
+        ->Arg(4'000)
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,116 @@
+/**
+ * @file MLCoreConversion.benchmark.cpp
+ * @brief Benchmarks for MLCore TensorData → arma::mat feature conversion
+ *
+ * This benchmark suite tests the performance of:
+ * 1. TensorData::createOrdinal2D from a row-major feature buffer
+ * 2. convertTensorToArma with and without z-score normalization
+ * 3. convertTensorToArmaRowMajor
+ *
+ * Each feature column is a GaussianNoise trace with its own seed, so the
+ * matrix has the shape of a per-frame feature table.
+ *
+ * Profiling Usage:
+ * ----------------
+ * perf record -g ./benchmark_MLCoreConversion --benchmark_filter=ToArma
+ * perf report
+ */
+
+#include "fixtures/SyntheticFixtures.hpp"
+
+#include "Tensors/TensorData.hpp"
+#include "features/FeatureConverter.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace WhiskerToolbox::Benchmark;
+
+namespace {
+
+constexpr std::size_t kNumFeatures = 32;
+
+}// namespace
+
+// ============================================================================
+// Benchmark Fixture
+// ============================================================================
+
+class MLCoreConversionBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State const & /*state*/) override {
+        if (!row_major_.empty()) {
+            return;
+        }
+        num_rows_ = Synthetic::scaled(100'000);
+        row_major_.resize(num_rows_ * kNumFeatures);
+        for (std::size_t c = 0; c < kNumFeatures; ++c) {
+            auto const column = Synthetic::analogNoise(num_rows_, 1'000 + c)->getAnalogTimeSeries();
+            for (std::size_t r = 0; r < num_rows_; ++r) {
+                row_major_[r * kNumFeatures + c] = column[r];
+            }
+            names_.push_back("feature_" + std::to_string(c));
+        }
+        tensor_ = TensorData::createOrdinal2D(row_major_, num_rows_, kNumFeatures, names_);
+    }
+
+protected:
+    void reportStats(benchmark::State & state) const {
+        state.counters["rows"] = static_cast<double>(num_rows_);
+        state.counters["features"] = static_cast<double>(kNumFeatures);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                                static_cast<int64_t>(num_rows_ * kNumFeatures));
+    }
+
+    std::size_t num_rows_ = 0;
+    std::vector<float> row_major_;
+    std::vector<std::string> names_;
+    TensorData tensor_;
+};
+
+// ============================================================================
+// Conversion
+// ============================================================================
+
+BENCHMARK_DEFINE_F(MLCoreConversionBenchmark, CreateOrdinal2D)(benchmark::State & state) {
+    for (auto _: state) {
+        auto tensor = TensorData::createOrdinal2D(row_major_, num_rows_, kNumFeatures, names_);
+        benchmark::DoNotOptimize(tensor);
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(MLCoreConversionBenchmark, CreateOrdinal2D)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(MLCoreConversionBenchmark, ToArma)(benchmark::State & state) {
+    MLCore::ConversionConfig const config{.drop_nan = true, .zscore_normalize = false};
+    for (auto _: state) {
+        auto converted = MLCore::convertTensorToArma(tensor_, config);
+        benchmark::DoNotOptimize(converted.matrix.memptr());
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(MLCoreConversionBenchmark, ToArma)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(MLCoreConversionBenchmark, ToArma_ZScore)(benchmark::State & state) {
+    MLCore::ConversionConfig const config{.drop_nan = true, .zscore_normalize = true};
+    for (auto _: state) {
+        auto converted = MLCore::convertTensorToArma(tensor_, config);
+        benchmark::DoNotOptimize(converted.matrix.memptr());
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(MLCoreConversionBenchmark, ToArma_ZScore)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(MLCoreConversionBenchmark, ToArmaRowMajor)(benchmark::State & state) {
+    MLCore::ConversionConfig const config{.drop_nan = true, .zscore_normalize = false};
+    for (auto _: state) {
+        auto converted = MLCore::convertTensorToArmaRowMajor(tensor_, config);
+        benchmark::DoNotOptimize(converted.matrix.memptr());
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(MLCoreConversionBenchmark, ToArmaRowMajor)->Unit(benchmark::kMillisecond);
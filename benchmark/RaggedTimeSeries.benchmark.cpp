@@ -0,0 +1,176 @@
+/**
+ * @file RaggedTimeSeries.benchmark.cpp
+ * @brief Benchmarks for iterating LineData, MaskData and PointData
+ *
+ * Compares the access paths RaggedTimeSeries offers for the same data:
+ * 1. elements() - flattened (time, DataEntry) pairs
+ * 2. elementsView() - flattened RaggedElement objects
+ * 3. getStorageCache() - raw pointers into contiguous storage
+ * 4. getTimesWithData() + getAtTime() - per-frame access
+ * 5. getElementsInRange() - filtered view over a time window
+ *
+ * Inputs come from the MovingLine, MovingMask and RandomPoints generators.
+ *
+ * Profiling Usage:
+ * ----------------
+ * perf record -g ./benchmark_RaggedTimeSeries --benchmark_filter=Lines
+ * perf report
+ */
+
+#include "fixtures/SyntheticFixtures.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace WhiskerToolbox::Benchmark;
+
+// ============================================================================
+// Benchmark Fixture
+// ============================================================================
+
+class RaggedTimeSeriesBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State const & /*state*/) override {
+        if (lines_) {
+            return;
+        }
+        num_frames_ = Synthetic::scaled(20'000);
+        lines_ = Synthetic::movingLines(num_frames_, 100);
+        masks_ = Synthetic::movingMasks(Synthetic::scaled(2'000));
+        points_ = Synthetic::randomPoints(20, num_frames_);
+
+        // Ten windows of 1% of the session each
+        auto const width = static_cast<int64_t>(num_frames_ / 100);
+        for (int64_t w = 0; w < 10; ++w) {
+            auto const start = w * static_cast<int64_t>(num_frames_) / 10;
+            windows_.emplace_back(TimeFrameIndex(start), TimeFrameIndex(start + width));
+        }
+    }
+
+protected:
+    void reportStats(benchmark::State & state, std::size_t entries) const {
+        state.counters["num_frames"] = static_cast<double>(num_frames_);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entries));
+    }
+
+    std::size_t num_frames_ = 0;
+    std::shared_ptr<LineData> lines_;
+    std::shared_ptr<MaskData> masks_;
+    std::shared_ptr<PointData> points_;
+    std::vector<TimeFrameInterval> windows_;
+};
+
+// ============================================================================
+// LineData
+// ============================================================================
+
+BENCHMARK_DEFINE_F(RaggedTimeSeriesBenchmark, Lines_Elements)(benchmark::State & state) {
+    for (auto _: state) {
+        double sum = 0.0;
+        for (auto const & [time, entry]: lines_->elements()) {
+            for (auto const & p: entry.data) {
+                sum += p.x;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, lines_->getTotalEntryCount());
+}
+BENCHMARK_REGISTER_F(RaggedTimeSeriesBenchmark, Lines_Elements)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RaggedTimeSeriesBenchmark, Lines_ElementsView)(benchmark::State & state) {
+    for (auto _: state) {
+        double sum = 0.0;
+        for (auto const elem: lines_->elementsView()) {
+            for (auto const & p: elem.data()) {
+                sum += p.x;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, lines_->getTotalEntryCount());
+}
+BENCHMARK_REGISTER_F(RaggedTimeSeriesBenchmark, Lines_ElementsView)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RaggedTimeSeriesBenchmark, Lines_StorageCache)(benchmark::State & state) {
+    auto const & cache = lines_->getStorageCache();
+    if (!cache.isValid()) {
+        state.SkipWithError("LineData storage is not contiguous");
+        return;
+    }
+    for (auto _: state) {
+        double sum = 0.0;
+        for (std::size_t i = 0; i < cache.cache_size; ++i) {
+            for (auto const & p: cache.data_ptr[i]) {
+                sum += p.x;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, cache.cache_size);
+}
+BENCHMARK_REGISTER_F(RaggedTimeSeriesBenchmark, Lines_StorageCache)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RaggedTimeSeriesBenchmark, Lines_GetAtTime)(benchmark::State & state) {
+    for (auto _: state) {
+        double sum = 0.0;
+        for (auto const time: lines_->getTimesWithData()) {
+            for (auto const & line: lines_->getAtTime(time)) {
+                sum += static_cast<double>(line.size());
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, lines_->getTimeCount());
+}
+BENCHMARK_REGISTER_F(RaggedTimeSeriesBenchmark, Lines_GetAtTime)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RaggedTimeSeriesBenchmark, Lines_ElementsInRange)(benchmark::State & state) {
+    for (auto _: state) {
+        std::size_t count = 0;
+        for (auto const & window: windows_) {
+            for (auto const & element: lines_->getElementsInRange(window)) {
+                benchmark::DoNotOptimize(element);
+                ++count;
+            }
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.counters["windows"] = static_cast<double>(windows_.size());
+    reportStats(state, windows_.size());
+}
+BENCHMARK_REGISTER_F(RaggedTimeSeriesBenchmark, Lines_ElementsInRange)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// MaskData and PointData
+// ============================================================================
+
+BENCHMARK_DEFINE_F(RaggedTimeSeriesBenchmark, Masks_ElementsView)(benchmark::State & state) {
+    for (auto _: state) {
+        uint64_t sum = 0;
+        for (auto const elem: masks_->elementsView()) {
+            for (auto const & p: elem.data()) {
+                sum += p.x;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, masks_->getTotalEntryCount());
+}
+BENCHMARK_REGISTER_F(RaggedTimeSeriesBenchmark, Masks_ElementsView)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RaggedTimeSeriesBenchmark, Points_ElementsView)(benchmark::State & state) {
+    for (auto _: state) {
+        double sum = 0.0;
+        for (auto const elem: points_->elementsView()) {
+            sum += elem.data().x;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, points_->getTotalEntryCount());
+}
+BENCHMARK_REGISTER_F(RaggedTimeSeriesBenchmark, Points_ElementsView)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,217 @@
+/**
+ * @file SpatialIndex.benchmark.cpp
+ * @brief Benchmarks for QuadTree, RTree and KdTree build and query
+ *
+ * Points come from the RandomPoints generator (640x480 image), flattened over
+ * all frames. Queries are a fixed, seeded set of small boxes and probe points,
+ * the same access pattern as hit testing in the plot widgets.
+ *
+ * Profiling Usage:
+ * ----------------
+ * perf record -g ./benchmark_SpatialIndex --benchmark_filter=QuadTree
+ * perf report
+ *
+ * # Larger inputs
+ * WHISKERTOOLBOX_BENCHMARK_SCALE=4 ./benchmark_SpatialIndex
+ */
+
+#include "fixtures/SyntheticFixtures.hpp"
+
+#include "SpatialIndex/KdTree.hpp"
+#include "SpatialIndex/QuadTree.hpp"
+#include "SpatialIndex/RTree.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace WhiskerToolbox::Benchmark;
+
+namespace {
+
+constexpr float kWidth = 640.0f;
+constexpr float kHeight = 480.0f;
+constexpr float kQueryHalfSize = 10.0f;
+constexpr float kNearestRadius = 15.0f;
+constexpr std::size_t kNumQueries = 1000;
+
+}// namespace
+
+// ============================================================================
+// Benchmark Fixture
+// ============================================================================
+
+class SpatialIndexBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State const & /*state*/) override {
+        if (!points_.empty()) {
+            return;
+        }
+
+        auto const point_data = Synthetic::randomPoints(Synthetic::scaled(2000), 50);
+        for (auto const elem: point_data->elementsView()) {
+            points_.push_back(elem.data());
+        }
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> x_dist(0.0f, kWidth);
+        std::uniform_real_distribution<float> y_dist(0.0f, kHeight);
+        probes_.resize(kNumQueries);
+        for (auto & probe: probes_) {
+            probe = Point2D<float>{x_dist(rng), y_dist(rng)};
+        }
+
+        quad_tree_ = buildQuadTree();
+        r_tree_ = buildRTree();
+        kd_nodes_.reserve(points_.size());
+        for (std::size_t i = 0; i < points_.size(); ++i) {
+            kd_nodes_.emplace_back(points_[i], nullptr, static_cast<int>(i));
+        }
+    }
+
+protected:
+    [[nodiscard]] std::unique_ptr<QuadTree<std::size_t>> buildQuadTree() const {
+        auto tree = std::make_unique<QuadTree<std::size_t>>(BoundingBox(0.0f, 0.0f, kWidth, kHeight));
+        for (std::size_t i = 0; i < points_.size(); ++i) {
+            tree->insert(points_[i].x, points_[i].y, i);
+        }
+        return tree;
+    }
+
+    [[nodiscard]] std::unique_ptr<RTree<std::size_t>> buildRTree() const {
+        auto tree = std::make_unique<RTree<std::size_t>>();
+        for (std::size_t i = 0; i < points_.size(); ++i) {
+            tree->insert(points_[i].x, points_[i].y, points_[i].x, points_[i].y, i);
+        }
+        return tree;
+    }
+
+    [[nodiscard]] static BoundingBox queryBox(Point2D<float> const & center) {
+        return {center.x - kQueryHalfSize, center.y - kQueryHalfSize,
+                center.x + kQueryHalfSize, center.y + kQueryHalfSize};
+    }
+
+    void reportStats(benchmark::State & state, std::size_t items_per_iteration) const {
+        state.counters["num_points"] = static_cast<double>(points_.size());
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                                static_cast<int64_t>(items_per_iteration));
+    }
+
+    std::vector<Point2D<float>> points_;
+    std::vector<Point2D<float>> probes_;
+    std::unique_ptr<QuadTree<std::size_t>> quad_tree_;
+    std::unique_ptr<RTree<std::size_t>> r_tree_;
+    Kdtree::KdNodeVector<float> kd_nodes_;
+};
+
+// ============================================================================
+// QuadTree
+// ============================================================================
+
+BENCHMARK_DEFINE_F(SpatialIndexBenchmark, QuadTree_Build)(benchmark::State & state) {
+    for (auto _: state) {
+        auto tree = buildQuadTree();
+        benchmark::DoNotOptimize(tree);
+    }
+    reportStats(state, points_.size());
+}
+BENCHMARK_REGISTER_F(SpatialIndexBenchmark, QuadTree_Build)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(SpatialIndexBenchmark, QuadTree_RangeQuery)(benchmark::State & state) {
+    std::vector<QuadTreePoint<std::size_t>> results;
+    for (auto _: state) {
+        std::size_t found = 0;
+        for (auto const & probe: probes_) {
+            results.clear();
+            quad_tree_->query(queryBox(probe), results);
+            found += results.size();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    reportStats(state, probes_.size());
+}
+BENCHMARK_REGISTER_F(SpatialIndexBenchmark, QuadTree_RangeQuery)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(SpatialIndexBenchmark, QuadTree_FindNearest)(benchmark::State & state) {
+    for (auto _: state) {
+        std::size_t found = 0;
+        for (auto const & probe: probes_) {
+            found += quad_tree_->findNearest(probe.x, probe.y, kNearestRadius) != nullptr;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    reportStats(state, probes_.size());
+}
+BENCHMARK_REGISTER_F(SpatialIndexBenchmark, QuadTree_FindNearest)->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// RTree
+// ============================================================================
+
+BENCHMARK_DEFINE_F(SpatialIndexBenchmark, RTree_Build)(benchmark::State & state) {
+    for (auto _: state) {
+        auto tree = buildRTree();
+        benchmark::DoNotOptimize(tree);
+    }
+    reportStats(state, points_.size());
+}
+BENCHMARK_REGISTER_F(SpatialIndexBenchmark, RTree_Build)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(SpatialIndexBenchmark, RTree_RangeQuery)(benchmark::State & state) {
+    std::vector<RTreeEntry<std::size_t>> results;
+    for (auto _: state) {
+        std::size_t found = 0;
+        for (auto const & probe: probes_) {
+            results.clear();
+            r_tree_->query(queryBox(probe), results);
+            found += results.size();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    reportStats(state, probes_.size());
+}
+BENCHMARK_REGISTER_F(SpatialIndexBenchmark, RTree_RangeQuery)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(SpatialIndexBenchmark, RTree_FindNearest)(benchmark::State & state) {
+    for (auto _: state) {
+        std::size_t found = 0;
+        for (auto const & probe: probes_) {
+            found += r_tree_->findNearest(probe.x, probe.y, kNearestRadius) != nullptr;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    reportStats(state, probes_.size());
+}
+BENCHMARK_REGISTER_F(SpatialIndexBenchmark, RTree_FindNearest)->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// KdTree
+// ============================================================================
+
+BENCHMARK_DEFINE_F(SpatialIndexBenchmark, KdTree_Build)(benchmark::State & state) {
+    for (auto _: state) {
+        Kdtree::KdTree<float> tree(&kd_nodes_);
+        benchmark::DoNotOptimize(&tree);
+    }
+    reportStats(state, kd_nodes_.size());
+}
+BENCHMARK_REGISTER_F(SpatialIndexBenchmark, KdTree_Build)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(SpatialIndexBenchmark, KdTree_KNearest)(benchmark::State & state) {
+    Kdtree::KdTree<float> tree(&kd_nodes_);
+    Kdtree::KdNodeVector<float> neighbors;
+    for (auto _: state) {
+        std::size_t found = 0;
+        for (auto const & probe: probes_) {
+            neighbors.clear();
+            tree.k_nearest_neighbors(probe, 8, &neighbors);
+            found += neighbors.size();
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    reportStats(state, probes_.size());
+}
+BENCHMARK_REGISTER_F(SpatialIndexBenchmark, KdTree_KNearest)->Unit(benchmark::kMicrosecond);
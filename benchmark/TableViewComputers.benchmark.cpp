@@ -0,0 +1,141 @@
+/**
+ * @file TableViewComputers.benchmark.cpp
+ * @brief Benchmarks for TableView interval column computers
+ *
+ * This benchmark suite tests the performance of:
+ * 1. EventInIntervalComputer: Presence, Count and Gather of Poisson spikes
+ * 2. IntervalReductionComputer: Mean, Max and StdDev of a noise trace
+ *
+ * Both run over the same RandomIntervals execution plan, the shape of a
+ * trial table built from behavioral epochs.
+ *
+ * Profiling Usage:
+ * ----------------
+ * perf record -g ./benchmark_TableViewComputers --benchmark_filter=EventInInterval
+ * perf report
+ */
+
+#include "fixtures/SyntheticFixtures.hpp"
+
+#include "utils/TableView/adapters/AnalogDataAdapter.h"
+#include "utils/TableView/computers/EventInIntervalComputer.h"
+#include "utils/TableView/computers/IntervalReductionComputer.h"
+#include "utils/TableView/core/ExecutionPlan.h"
+#include "utils/TableView/interfaces/IAnalogSource.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace WhiskerToolbox::Benchmark;
+
+// ============================================================================
+// Benchmark Fixture
+// ============================================================================
+
+class TableViewComputersBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State const & /*state*/) override {
+        if (events_) {
+            return;
+        }
+        num_samples_ = Synthetic::scaled(1'000'000);
+        time_frame_ = Synthetic::identityTimeFrame(num_samples_);
+
+        events_ = Synthetic::poissonEvents(num_samples_);
+        events_->setTimeFrame(time_frame_);
+        auto analog = Synthetic::analogNoise(num_samples_);
+        analog->setTimeFrame(time_frame_);
+        analog_source_ = std::make_shared<AnalogDataAdapter>(analog, time_frame_, "noise");
+
+        auto intervals = Synthetic::intervalsOf(*Synthetic::randomIntervals(num_samples_));
+        num_rows_ = intervals.size();
+        plan_ = ExecutionPlan(std::move(intervals), time_frame_);
+    }
+
+protected:
+    void reportStats(benchmark::State & state) const {
+        state.counters["rows"] = static_cast<double>(num_rows_);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                                static_cast<int64_t>(num_rows_));
+    }
+
+    std::size_t num_samples_ = 0;
+    std::size_t num_rows_ = 0;
+    std::shared_ptr<TimeFrame> time_frame_;
+    std::shared_ptr<DigitalEventSeries> events_;
+    std::shared_ptr<IAnalogSource> analog_source_;
+    ExecutionPlan plan_;
+};
+
+// ============================================================================
+// EventInIntervalComputer
+// ============================================================================
+
+BENCHMARK_DEFINE_F(TableViewComputersBenchmark, EventInInterval_Presence)(benchmark::State & state) {
+    EventInIntervalComputer<bool> const computer(events_, EventOperation::Presence, "spikes");
+    for (auto _: state) {
+        auto result = computer.compute(plan_);
+        benchmark::DoNotOptimize(result);
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(TableViewComputersBenchmark, EventInInterval_Presence)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TableViewComputersBenchmark, EventInInterval_Count)(benchmark::State & state) {
+    EventInIntervalComputer<int> const computer(events_, EventOperation::Count, "spikes");
+    for (auto _: state) {
+        auto result = computer.compute(plan_);
+        benchmark::DoNotOptimize(result);
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(TableViewComputersBenchmark, EventInInterval_Count)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TableViewComputersBenchmark, EventInInterval_Gather)(benchmark::State & state) {
+    EventInIntervalComputer<std::vector<float>> const computer(events_, EventOperation::Gather, "spikes");
+    for (auto _: state) {
+        auto result = computer.compute(plan_);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["events"] = static_cast<double>(events_->size());
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(TableViewComputersBenchmark, EventInInterval_Gather)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// IntervalReductionComputer
+// ============================================================================
+
+BENCHMARK_DEFINE_F(TableViewComputersBenchmark, IntervalReduction_Mean)(benchmark::State & state) {
+    IntervalReductionComputer const computer(analog_source_, ReductionType::Mean, "noise");
+    for (auto _: state) {
+        auto result = computer.compute(plan_);
+        benchmark::DoNotOptimize(result);
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(TableViewComputersBenchmark, IntervalReduction_Mean)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TableViewComputersBenchmark, IntervalReduction_Max)(benchmark::State & state) {
+    IntervalReductionComputer const computer(analog_source_, ReductionType::Max, "noise");
+    for (auto _: state) {
+        auto result = computer.compute(plan_);
+        benchmark::DoNotOptimize(result);
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(TableViewComputersBenchmark, IntervalReduction_Max)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TableViewComputersBenchmark, IntervalReduction_StdDev)(benchmark::State & state) {
+    IntervalReductionComputer const computer(analog_source_, ReductionType::StdDev, "noise");
+    for (auto _: state) {
+        auto result = computer.compute(plan_);
+        benchmark::DoNotOptimize(result);
+    }
+    reportStats(state);
+}
+BENCHMARK_REGISTER_F(TableViewComputersBenchmark, IntervalReduction_StdDev)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,159 @@
+/**
+ * @file TimeFrameConversion.benchmark.cpp
+ * @brief Benchmarks for TimeFrame lookups and cross-clock conversion
+ *
+ * Models the common two-clock session: a 30 kHz acquisition clock and a 500 Hz
+ * camera clock whose frames land every 60 ticks. Spike times come from the
+ * PoissonEvents generator on the acquisition clock.
+ *
+ * Profiling Usage:
+ * ----------------
+ * perf record -g ./benchmark_TimeFrameConversion --benchmark_filter=Convert
+ * perf report
+ */
+
+#include "fixtures/SyntheticFixtures.hpp"
+
+#include "TimeFrame/TimeFrame.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace WhiskerToolbox::Benchmark;
+
+namespace {
+
+constexpr int kTicksPerFrame = 60;
+constexpr std::size_t kNumProbes = 10'000;
+
+}// namespace
+
+// ============================================================================
+// Benchmark Fixture
+// ============================================================================
+
+class TimeFrameConversionBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State const & /*state*/) override {
+        if (camera_) {
+            return;
+        }
+
+        num_frames_ = Synthetic::scaled(100'000);
+        auto const num_ticks = num_frames_ * kTicksPerFrame;
+
+        camera_times_.resize(num_frames_);
+        for (std::size_t i = 0; i < num_frames_; ++i) {
+            camera_times_[i] = static_cast<int>(i) * kTicksPerFrame;
+        }
+        camera_ = std::make_shared<TimeFrame>(camera_times_);
+        acquisition_ = Synthetic::identityTimeFrame(num_ticks);
+
+        auto const spikes = Synthetic::poissonEvents(num_ticks, 0.002);
+        spike_indices_.reserve(spikes->size());
+        for (std::size_t i = 0; i < spikes->size(); ++i) {
+            spike_indices_.push_back(spikes->getStoredEvent(i));
+        }
+
+        std::mt19937 rng(11);
+        std::uniform_int_distribution<int64_t> tick_dist(0, static_cast<int64_t>(num_ticks) - 1);
+        std::uniform_int_distribution<int64_t> frame_dist(0, static_cast<int64_t>(num_frames_) - 1);
+        std::uniform_int_distribution<int64_t> length_dist(1, 500);
+        tick_probes_.reserve(kNumProbes);
+        frame_ranges_.reserve(kNumProbes);
+        for (std::size_t i = 0; i < kNumProbes; ++i) {
+            tick_probes_.emplace_back(tick_dist(rng));
+            auto const start = frame_dist(rng);
+            auto const stop = std::min<int64_t>(start + length_dist(rng), static_cast<int64_t>(num_frames_) - 1);
+            frame_ranges_.emplace_back(TimeFrameIndex(start), TimeFrameIndex(stop));
+        }
+    }
+
+protected:
+    void reportStats(benchmark::State & state, std::size_t items_per_iteration) const {
+        state.counters["camera_frames"] = static_cast<double>(num_frames_);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                                static_cast<int64_t>(items_per_iteration));
+    }
+
+    std::size_t num_frames_ = 0;
+    std::vector<int> camera_times_;
+    std::shared_ptr<TimeFrame> camera_;
+    std::shared_ptr<TimeFrame> acquisition_;
+    std::vector<TimeFrameIndex> spike_indices_;
+    std::vector<ClockTicks> tick_probes_;
+    std::vector<std::pair<TimeFrameIndex, TimeFrameIndex>> frame_ranges_;
+};
+
+// ============================================================================
+// Single-clock lookups
+// ============================================================================
+
+BENCHMARK_DEFINE_F(TimeFrameConversionBenchmark, Construct)(benchmark::State & state) {
+    for (auto _: state) {
+        TimeFrame frame(camera_times_);
+        benchmark::DoNotOptimize(frame);
+    }
+    reportStats(state, camera_times_.size());
+}
+BENCHMARK_REGISTER_F(TimeFrameConversionBenchmark, Construct)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(TimeFrameConversionBenchmark, GetTimeAtIndex)(benchmark::State & state) {
+    for (auto _: state) {
+        int64_t sum = 0;
+        for (std::size_t i = 0; i < num_frames_; ++i) {
+            sum += camera_->getTimeAtIndex(TimeFrameIndex(static_cast<int64_t>(i))).getValue();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, num_frames_);
+}
+BENCHMARK_REGISTER_F(TimeFrameConversionBenchmark, GetTimeAtIndex)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(TimeFrameConversionBenchmark, GetIndexAtTime)(benchmark::State & state) {
+    for (auto _: state) {
+        int64_t sum = 0;
+        for (auto const probe: tick_probes_) {
+            sum += camera_->getIndexAtTime(probe).getValue();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, tick_probes_.size());
+}
+BENCHMARK_REGISTER_F(TimeFrameConversionBenchmark, GetIndexAtTime)->Unit(benchmark::kMicrosecond);
+
+// ============================================================================
+// Cross-clock conversion
+// ============================================================================
+
+BENCHMARK_DEFINE_F(TimeFrameConversionBenchmark, ConvertEvents_AcquisitionToCamera)(benchmark::State & state) {
+    for (auto _: state) {
+        int64_t sum = 0;
+        for (auto const spike: spike_indices_) {
+            sum += convert_time_index(spike, acquisition_.get(), camera_.get()).getValue();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.counters["spikes"] = static_cast<double>(spike_indices_.size());
+    reportStats(state, spike_indices_.size());
+}
+BENCHMARK_REGISTER_F(TimeFrameConversionBenchmark, ConvertEvents_AcquisitionToCamera)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(TimeFrameConversionBenchmark, ConvertRanges_CameraToAcquisition)(benchmark::State & state) {
+    for (auto _: state) {
+        int64_t sum = 0;
+        for (auto const & [start, stop]: frame_ranges_) {
+            auto const converted = convertTimeFrameRange(start, stop, *camera_, *acquisition_);
+            sum += converted.second.getValue() - converted.first.getValue();
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    reportStats(state, frame_ranges_.size());
+}
+BENCHMARK_REGISTER_F(TimeFrameConversionBenchmark, ConvertRanges_CameraToAcquisition)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,182 @@
+/**
+ * @file TransformsV2Pipelines.benchmark.cpp
+ * @brief Benchmarks for TransformsV2 pipelines, container transforms and range reductions
+ *
+ * This benchmark suite tests the performance of:
+ * 1. Pipeline: LineData → CalculateLineLength → SumReduction, through
+ *    execute() and executeOptimized()
+ * 2. Container transform: AnalogEventThreshold on a Gaussian noise trace
+ * 3. Range reductions: one fused pass vs one pass per statistic over
+ *    RandomIntervals windows of the same trace
+ *
+ * Profiling Usage:
+ * ----------------
+ * perf record -g ./benchmark_TransformsV2Pipelines --benchmark_filter=Reductions
+ * perf report
+ */
+
+#include "fixtures/SyntheticFixtures.hpp"
+
+#include "TransformsV2/algorithms/AnalogEventThreshold/AnalogEventThreshold.hpp"
+#include "TransformsV2/algorithms/LineLength/LineLength.hpp"
+#include "TransformsV2/algorithms/RangeReductions/FusedValueReductions.hpp"
+#include "TransformsV2/algorithms/RangeReductions/ValueRangeReductions.hpp"
+#include "TransformsV2/algorithms/SumReduction/SumReduction.hpp"
+#include "TransformsV2/core/ComputeContext.hpp"
+#include "TransformsV2/core/ElementRegistry.hpp"
+#include "TransformsV2/core/TransformPipeline.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+using namespace Neuralyzer::Transforms::V2;
+using namespace Neuralyzer::Transforms::V2::Examples;
+using namespace WhiskerToolbox::Benchmark;
+
+namespace {
+
+using RangeReductions::ValueStatistic;
+
+constexpr std::array kStatistics{
+        ValueStatistic::Max,
+        ValueStatistic::Min,
+        ValueStatistic::Mean,
+        ValueStatistic::Std,
+        ValueStatistic::Sum};
+
+}// namespace
+
+// ============================================================================
+// Benchmark Fixture
+// ============================================================================
+
+class TransformsV2PipelinesBenchmark : public benchmark::Fixture {
+public:
+    void SetUp(benchmark::State const & /*state*/) override {
+        if (lines_) {
+            return;
+        }
+        num_frames_ = Synthetic::scaled(20'000);
+        num_samples_ = Synthetic::scaled(1'000'000);
+        lines_ = Synthetic::movingLines(num_frames_, 100);
+        analog_ = Synthetic::analogNoise(num_samples_);
+        windows_ = Synthetic::intervalsOf(*Synthetic::randomIntervals(num_samples_));
+
+        pipeline_.addStep("CalculateLineLength", LineLengthParams{});
+        pipeline_.addStep("SumReduction", SumReductionParams{});
+
+        threshold_params_.threshold_value = 2.5f;
+        threshold_params_.lockout_time = 10.0f;
+    }
+
+protected:
+    /// Samples of @p window from the dense noise trace
+    [[nodiscard]] std::span<float const> windowValues(TimeFrameInterval const & window) const {
+        auto const values = analog_->getAnalogTimeSeries();
+        auto const start = static_cast<std::size_t>(window.start.getValue());
+        auto const stop = std::min(static_cast<std::size_t>(window.end.getValue()) + 1, values.size());
+        return values.subspan(start, stop - start);
+    }
+
+    void reportStats(benchmark::State & state, std::size_t items_per_iteration) const {
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                                static_cast<int64_t>(items_per_iteration));
+    }
+
+    std::size_t num_frames_ = 0;
+    std::size_t num_samples_ = 0;
+    std::shared_ptr<LineData> lines_;
+    std::shared_ptr<AnalogTimeSeries> analog_;
+    std::vector<TimeFrameInterval> windows_;
+    TransformPipeline pipeline_;
+    AnalogEventThresholdParams threshold_params_;
+};
+
+// ============================================================================
+// Pipelines
+// ============================================================================
+
+BENCHMARK_DEFINE_F(TransformsV2PipelinesBenchmark, Pipeline_LineLengthSum)(benchmark::State & state) {
+    for (auto _: state) {
+        auto result = pipeline_.execute<LineData>(*lines_);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["num_frames"] = static_cast<double>(num_frames_);
+    reportStats(state, lines_->getTotalEntryCount());
+}
+BENCHMARK_REGISTER_F(TransformsV2PipelinesBenchmark, Pipeline_LineLengthSum)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TransformsV2PipelinesBenchmark, Pipeline_LineLengthSum_Optimized)(benchmark::State & state) {
+    for (auto _: state) {
+        auto result = pipeline_.executeOptimized<LineData, AnalogTimeSeries>(*lines_);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["num_frames"] = static_cast<double>(num_frames_);
+    reportStats(state, lines_->getTotalEntryCount());
+}
+BENCHMARK_REGISTER_F(TransformsV2PipelinesBenchmark, Pipeline_LineLengthSum_Optimized)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Container transforms
+// ============================================================================
+
+BENCHMARK_DEFINE_F(TransformsV2PipelinesBenchmark, Container_AnalogEventThreshold)(benchmark::State & state) {
+    auto & registry = ElementRegistry::instance();
+    ComputeContext const ctx{};
+    std::size_t num_events = 0;
+    for (auto _: state) {
+        auto events = registry.executeContainerTransform<AnalogTimeSeries, DigitalEventSeries, AnalogEventThresholdParams>(
+                "AnalogEventThreshold", *analog_, threshold_params_, ctx);
+        num_events = events->size();
+        benchmark::DoNotOptimize(events);
+    }
+    state.counters["num_events"] = static_cast<double>(num_events);
+    reportStats(state, num_samples_);
+}
+BENCHMARK_REGISTER_F(TransformsV2PipelinesBenchmark, Container_AnalogEventThreshold)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Range reductions
+// ============================================================================
+
+BENCHMARK_DEFINE_F(TransformsV2PipelinesBenchmark, Reductions_PerStatistic)(benchmark::State & state) {
+    for (auto _: state) {
+        float acc = 0.0f;
+        for (auto const & window: windows_) {
+            auto const values = windowValues(window);
+            acc += RangeReductions::maxValueRaw(values);
+            acc += RangeReductions::minValueRaw(values);
+            acc += RangeReductions::meanValueRaw(values);
+            acc += RangeReductions::stdValueRaw(values);
+            for (auto const v: values) {
+                acc += v;
+            }
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.counters["windows"] = static_cast<double>(windows_.size());
+    reportStats(state, windows_.size() * kStatistics.size());
+}
+BENCHMARK_REGISTER_F(TransformsV2PipelinesBenchmark, Reductions_PerStatistic)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(TransformsV2PipelinesBenchmark, Reductions_Fused)(benchmark::State & state) {
+    for (auto _: state) {
+        float acc = 0.0f;
+        for (auto const & window: windows_) {
+            for (auto const v: RangeReductions::fusedValueReductions(windowValues(window), kStatistics)) {
+                acc += v;
+            }
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.counters["windows"] = static_cast<double>(windows_.size());
+    reportStats(state, windows_.size() * kStatistics.size());
+}
+BENCHMARK_REGISTER_F(TransformsV2PipelinesBenchmark, Reductions_Fused)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,238 @@
+/**
+ * @file SyntheticFixtures.hpp
+ * @brief Scaled synthetic data for the cross-subsystem benchmarks
+ *
+ * All data is produced by the DataSynthesizer generators with fixed seeds, so
+ * every benchmark binary sees the same inputs on every run and machine.
+ *
+ * Sizes are given at scale 1 and multiplied by the scale factor read from the
+ * `WHISKERTOOLBOX_BENCHMARK_SCALE` environment variable (default 1.0):
+ *
+ * ```bash
+ * WHISKERTOOLBOX_BENCHMARK_SCALE=4 ./benchmark_SpatialIndex
+ * ```
+ *
+ * The scale is written into the benchmark JSON context as
+ * `whiskertoolbox_scale`, and compare_benchmarks.py refuses to compare runs
+ * recorded at different scales.
+ *
+ * Executables using these fixtures must link DataSynthesizer as a whole archive
+ * (see benchmark/CMakeLists.txt), otherwise no generator is registered.
+ */
+
+#ifndef WHISKERTOOLBOX_BENCHMARK_SYNTHETIC_FIXTURES_HPP
+#define WHISKERTOOLBOX_BENCHMARK_SYNTHETIC_FIXTURES_HPP
+
+#include "DataSynthesizer/GeneratorRegistry.hpp"
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "DigitalTimeSeries/Digital_Interval_Series.hpp"
+#include "Lines/Line_Data.hpp"
+#include "Masks/Mask_Data.hpp"
+#include "Points/Point_Data.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+
+#include <benchmark/benchmark.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace WhiskerToolbox::Benchmark::Synthetic {
+
+// ============================================================================
+// Scale
+// ============================================================================
+
+/**
+ * @brief Size multiplier from WHISKERTOOLBOX_BENCHMARK_SCALE
+ *
+ * Unset, unparsable or non-positive values fall back to 1.0.
+ */
+inline double scale() {
+    static double const value = [] {
+        char const * env = std::getenv("WHISKERTOOLBOX_BENCHMARK_SCALE");
+        if (env == nullptr) {
+            return 1.0;
+        }
+        char * end = nullptr;
+        double const parsed = std::strtod(env, &end);
+        return (end != env && std::isfinite(parsed) && parsed > 0.0) ? parsed : 1.0;
+    }();
+    return value;
+}
+
+/**
+ * @brief Scale a base size, never returning less than 1
+ */
+inline std::size_t scaled(std::size_t base) {
+    auto const n = std::llround(static_cast<double>(base) * scale());
+    return static_cast<std::size_t>(std::max<long long>(1, n));
+}
+
+/// Record the scale in the JSON context once per executable
+inline bool const scale_context_registered = [] {
+    benchmark::AddCustomContext("whiskertoolbox_scale", std::to_string(scale()));
+    return true;
+}();
+
+// ============================================================================
+// Generator access
+// ============================================================================
+
+/**
+ * @brief Run a registered generator and unwrap its output type
+ *
+ * @throws std::runtime_error if the generator is missing, fails, or returns another type
+ */
+template<typename T>
+std::shared_ptr<T> generate(std::string const & generator, nlohmann::json const & params) {
+    auto result = Neuralyzer::DataSynthesizer::GeneratorRegistry::instance().generate(
+            generator, params.dump());
+    if (!result.has_value()) {
+        throw std::runtime_error("Synthetic fixture: generator '" + generator + "' failed");
+    }
+    auto * data = std::get_if<std::shared_ptr<T>>(&*result);
+    if (data == nullptr || *data == nullptr) {
+        throw std::runtime_error("Synthetic fixture: generator '" + generator + "' returned an unexpected type");
+    }
+    return *data;
+}
+
+/**
+ * @brief TimeFrame whose index i maps to time i
+ */
+inline std::shared_ptr<TimeFrame> identityTimeFrame(std::size_t num_samples) {
+    std::vector<int> times(num_samples);
+    std::iota(times.begin(), times.end(), 0);
+    return std::make_shared<TimeFrame>(times);
+}
+
+// ============================================================================
+// Data objects
+// ============================================================================
+
+/**
+ * @brief Gaussian noise trace of @p num_samples dense samples on an identity clock
+ */
+inline std::shared_ptr<AnalogTimeSeries> analogNoise(std::size_t num_samples, uint64_t seed = 42) {
+    auto series = generate<AnalogTimeSeries>(
+            "GaussianNoise",
+            {{"num_samples", num_samples}, {"stddev", 1.0}, {"mean", 0.0}, {"seed", seed}});
+    series->setTimeFrame(identityTimeFrame(num_samples));
+    return series;
+}
+
+/**
+ * @brief Poisson spike train over @p num_samples ticks, about lambda events per tick
+ */
+inline std::shared_ptr<DigitalEventSeries> poissonEvents(std::size_t num_samples,
+                                                         double lambda = 0.01,
+                                                         uint64_t seed = 42) {
+    auto series = generate<DigitalEventSeries>(
+            "PoissonEvents",
+            {{"num_samples", num_samples}, {"lambda", lambda}, {"seed", seed}});
+    series->setTimeFrame(identityTimeFrame(num_samples));
+    return series;
+}
+
+/**
+ * @brief Non-overlapping random intervals over @p num_samples ticks
+ */
+inline std::shared_ptr<DigitalIntervalSeries> randomIntervals(std::size_t num_samples,
+                                                              double mean_duration = 200.0,
+                                                              double mean_gap = 300.0,
+                                                              uint64_t seed = 42) {
+    auto series = generate<DigitalIntervalSeries>(
+            "RandomIntervals",
+            {{"num_samples", num_samples},
+             {"mean_duration", mean_duration},
+             {"mean_gap", mean_gap},
+             {"seed", seed}});
+    series->setTimeFrame(identityTimeFrame(num_samples));
+    return series;
+}
+
+/**
+ * @brief Stored intervals of @p series as TimeFrameInterval values
+ */
+inline std::vector<TimeFrameInterval> intervalsOf(DigitalIntervalSeries const & series) {
+    std::vector<TimeFrameInterval> intervals;
+    intervals.reserve(series.size());
+    for (std::size_t i = 0; i < series.size(); ++i) {
+        intervals.push_back(series.getStoredInterval(i));
+    }
+    return intervals;
+}
+
+/**
+ * @brief One straight line per frame, translating across a 640x480 image
+ */
+inline std::shared_ptr<LineData> movingLines(std::size_t num_frames, std::size_t points_per_line = 50) {
+    auto lines = generate<LineData>(
+            "MovingLine",
+            {{"start_x", -60.0},
+             {"start_y", -40.0},
+             {"end_x", 60.0},
+             {"end_y", 40.0},
+             {"num_points_per_line", points_per_line},
+             {"num_frames", num_frames},
+             {"trajectory_start_x", 80.0},
+             {"trajectory_start_y", 240.0},
+             {"motion", {{"model", "LinearMotionParams"}, {"velocity_x", 0.5}, {"velocity_y", 0.0}}},
+             {"boundary_mode", "bounce"}});
+    lines->setTimeFrame(identityTimeFrame(num_frames));
+    return lines;
+}
+
+/**
+ * @brief @p points_per_frame uniform random points per frame in a 640x480 image
+ */
+inline std::shared_ptr<PointData> randomPoints(std::size_t points_per_frame,
+                                               std::size_t num_frames,
+                                               uint64_t seed = 42) {
+    auto points = generate<PointData>(
+            "RandomPoints",
+            {{"num_points", points_per_frame},
+             {"num_frames", num_frames},
+             {"min_x", 0.0},
+             {"max_x", 640.0},
+             {"min_y", 0.0},
+             {"max_y", 480.0},
+             {"seed", seed}});
+    points->setTimeFrame(identityTimeFrame(num_frames));
+    return points;
+}
+
+/**
+ * @brief One circular mask per frame, translating across a 640x480 image
+ */
+inline std::shared_ptr<MaskData> movingMasks(std::size_t num_frames, double radius = 40.0) {
+    auto masks = generate<MaskData>(
+            "MovingMask",
+            {{"shape", "circle"},
+             {"radius", radius},
+             {"image_width", 640},
+             {"image_height", 480},
+             {"start_x", 100.0},
+             {"start_y", 240.0},
+             {"num_frames", num_frames},
+             {"motion", {{"model", "LinearMotionParams"}, {"velocity_x", 1.0}, {"velocity_y", 0.0}}},
+             {"boundary_mode", "bounce"}});
+    masks->setTimeFrame(identityTimeFrame(num_frames));
+    return masks;
+}
+
+}// namespace WhiskerToolbox::Benchmark::Synthetic
+
+#endif// WHISKERTOOLBOX_BENCHMARK_SYNTHETIC_FIXTURES_HPP
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Compare a Google Benchmark JSON run against a stored baseline.
+
+Baselines live in benchmark/baselines/<Name>.json. They hold one time per
+benchmark plus the context needed to judge whether two runs are comparable
+(scale factor, build type, CPU count).
+
+Usage:
+    # Record or refresh a baseline from a run
+    compare_benchmarks.py results/SpatialIndex.json baselines/SpatialIndex.json --update
+
+    # Compare; exits 1 if any benchmark is slower than the baseline by more than 10%
+    compare_benchmarks.py results/SpatialIndex.json baselines/SpatialIndex.json --threshold 0.10
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+
+BASELINE_SCHEMA = 1
+
+# Google Benchmark time units, in nanoseconds
+TIME_UNITS_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+# Context keys that must match for a comparison to be meaningful
+REQUIRED_CONTEXT = ("whiskertoolbox_scale",)
+
+# Context keys that are reported but only warn on mismatch
+ADVISORY_CONTEXT = ("library_build_type", "num_cpus", "host_name")
+
+
+def load_run(path):
+    """Return (context, {name: {metric: ns}}) from a Google Benchmark JSON file.
+
+    With --benchmark_repetitions the median aggregate is used; otherwise the
+    single iteration entry. Error runs are skipped.
+    """
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+
+    iterations = {}
+    medians = {}
+    for entry in data.get("benchmarks", []):
+        if entry.get("error_occurred"):
+            continue
+        scale = TIME_UNITS_NS.get(entry.get("time_unit", "ns"), 1.0)
+        times = {
+            "real_time": float(entry["real_time"]) * scale,
+            "cpu_time": float(entry["cpu_time"]) * scale,
+        }
+        if entry.get("run_type") == "aggregate":
+            if entry.get("aggregate_name") == "median":
+                medians[entry.get("run_name", entry["name"])] = times
+        else:
+            iterations.setdefault(entry.get("run_name", entry["name"]), times)
+
+    return data.get("context", {}), {**iterations, **medians}
+
+
+def load_baseline(path):
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    if data.get("schema") != BASELINE_SCHEMA:
+        raise ValueError(f"{path}: unsupported baseline schema {data.get('schema')!r}")
+    return data.get("context", {}), data.get("benchmarks", {})
+
+
+def write_baseline(path, context, results):
+    kept = {key: context[key] for key in REQUIRED_CONTEXT + ADVISORY_CONTEXT if key in context}
+    payload = {
+        "schema": BASELINE_SCHEMA,
+        "context": kept,
+        "benchmarks": {
+            name: {metric: round(value, 1) for metric, value in results[name].items()}
+            for name in sorted(results)
+        },
+    }
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump(payload, f, indent=2, sort_keys=False)
+        f.write("\n")
+
+
+def format_ns(value):
+    for unit, factor in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if value >= factor:
+            return f"{value / factor:.3f} {unit}"
+    return f"{value:.1f} ns"
+
+
+def check_context(baseline_context, run_context):
+    """Return an error message if the runs are not comparable, warn on soft mismatches."""
+    for key in REQUIRED_CONTEXT:
+        expected = baseline_context.get(key)
+        actual = run_context.get(key)
+        if expected is not None and actual is not None and float(expected) != float(actual):
+            return f"baseline was recorded with {key}={expected}, this run used {actual}"
+    for key in ADVISORY_CONTEXT:
+        expected = baseline_context.get(key)
+        actual = run_context.get(key)
+        if expected is not None and actual is not None and str(expected) != str(actual):
+            print(f"warning: {key} differs (baseline {expected}, run {actual})", file=sys.stderr)
+    return None
+
+
+def compare(baseline, results, metric, threshold, min_time_ns):
+    """Print a comparison table and return the names of regressed benchmarks."""
+    rows = []
+    regressions = []
+    for name in sorted(set(baseline) | set(results)):
+        if name not in results:
+            rows.append((name, format_ns(baseline[name][metric]), "-", "-", "MISSING"))
+            continue
+        if name not in baseline:
+            rows.append((name, "-", format_ns(results[name][metric]), "-", "NEW"))
+            continue
+
+        before = baseline[name][metric]
+        after = results[name][metric]
+        change = (after - before) / before if before > 0 else 0.0
+        if change > threshold and after - before >= min_time_ns:
+            status = "REGRESSION"
+            regressions.append(name)
+        elif change < -threshold:
+            status = "improved"
+        else:
+            status = "ok"
+        rows.append((name, format_ns(before), format_ns(after), f"{change * 100:+.1f}%", status))
+
+    headers = ("benchmark", "baseline", "current", "change", "status")
+    widths = [max(len(str(row[i])) for row in rows + [headers]) for i in range(len(headers))]
+    line = "  ".join(h.ljust(w) for h, w in zip(headers, widths))
+    print(line)
+    print("-" * len(line))
+    for row in rows:
+        print("  ".join(str(cell).ljust(w) for cell, w in zip(row, widths)))
+    return regressions
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("results", type=Path, help="Google Benchmark JSON output (--benchmark_out)")
+    parser.add_argument("baseline", type=Path, help="Baseline file to compare against or update")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="Relative slowdown that counts as a regression (default: 0.10)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="cpu_time",
+                        help="Time to compare (default: cpu_time)")
+    parser.add_argument("--min-time-ns", type=float, default=0.0,
+                        help="Ignore slowdowns smaller than this absolute amount")
+    parser.add_argument("--update", action="store_true", help="Write the results as the new baseline")
+    args = parser.parse_args(argv)
+
+    run_context, results = load_run(args.results)
+    if not results:
+        print(f"error: no benchmark results in {args.results}", file=sys.stderr)
+        return 2
+
+    if args.update:
+        write_baseline(args.baseline, run_context, results)
+        print(f"Baseline written: {args.baseline} ({len(results)} benchmarks)")
+        return 0
+
+    if not args.baseline.exists():
+        print(f"No baseline at {args.baseline}; record one with --update.")
+        return 0
+
+    baseline_context, baseline = load_baseline(args.baseline)
+    mismatch = check_context(baseline_context, run_context)
+    if mismatch:
+        print(f"error: {mismatch}", file=sys.stderr)
+        return 2
+
+    regressions = compare(baseline, results, args.metric, args.threshold, args.min_time_ns)
+    if regressions:
+        print(f"\n{len(regressions)} regression(s) beyond {args.threshold * 100:.0f}% ({args.metric})")
+        return 1
+    print(f"\nNo regressions beyond {args.threshold * 100:.0f}% ({args.metric})")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
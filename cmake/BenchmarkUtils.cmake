@@ -36,10 +36,26 @@ Performance Analysis Integration:
     
     # View assembly
     objdump -d -C -S ./benchmark_MaskArea | less
+
+Regression Baselines:
+    # Compare every benchmark with a baseline against its stored result
+    cmake --build . --target benchmark_compare
+
+    # Record new baselines on this machine
+    cmake --build . --target benchmark_update_baselines
 ]]
 
 include_guard(GLOBAL)
 
+# Baseline settings. Named without the BENCHMARK_ prefix so that
+# print_benchmark_summary does not count them as benchmarks.
+set(WHISKERTOOLBOX_BENCHMARK_BASELINE_DIR "${CMAKE_SOURCE_DIR}/benchmark/baselines"
+    CACHE PATH "Directory holding benchmark baseline JSON files")
+set(WHISKERTOOLBOX_BENCHMARK_THRESHOLD "0.10"
+    CACHE STRING "Relative slowdown reported as a benchmark regression")
+
+find_package(Python3 COMPONENTS Interpreter QUIET)
+
 #[[
 add_selective_benchmark
 -----------------------
@@ -231,6 +247,114 @@ function(configure_benchmark_for_profiling)
     endif()
 endfunction()
 
+#[[
+add_benchmark_baseline_targets
+------------------------------
+
+Adds targets that run a benchmark with JSON output and compare it against,
+or record it as, the stored baseline. Does nothing if the benchmark is
+disabled or no Python 3 interpreter was found.
+
+Parameters:
+  NAME              - Benchmark name as given to add_selective_benchmark
+
+Generated Artifacts:
+  - Target: benchmark_<Name>_compare
+      Runs benchmark_<Name> and compares against
+      ${WHISKERTOOLBOX_BENCHMARK_BASELINE_DIR}/<Name>.json. Fails on a
+      slowdown beyond WHISKERTOOLBOX_BENCHMARK_THRESHOLD.
+  - Target: benchmark_<Name>_update_baseline
+      Runs benchmark_<Name> and overwrites the baseline with the result.
+
+Results are written to ${CMAKE_BINARY_DIR}/benchmark/results/<Name>.json.
+The targets are USES_TERMINAL, so Ninja runs them one at a time; with
+Makefile generators build them without -j so runs do not overlap.
+
+Example:
+  add_benchmark_baseline_targets(NAME SpatialIndex)
+]]
+function(add_benchmark_baseline_targets)
+    cmake_parse_arguments(
+        BASE
+        ""
+        "NAME"
+        ""
+        ${ARGN}
+    )
+
+    if(NOT BASE_NAME)
+        message(FATAL_ERROR "add_benchmark_baseline_targets: NAME is required")
+    endif()
+
+    set(target_name "benchmark_${BASE_NAME}")
+    if(NOT TARGET ${target_name} OR NOT Python3_Interpreter_FOUND)
+        return()
+    endif()
+
+    set(results_dir "${CMAKE_BINARY_DIR}/benchmark/results")
+    set(results_file "${results_dir}/${BASE_NAME}.json")
+    set(baseline_file "${WHISKERTOOLBOX_BENCHMARK_BASELINE_DIR}/${BASE_NAME}.json")
+    set(compare_script "${CMAKE_SOURCE_DIR}/benchmark/scripts/compare_benchmarks.py")
+
+    set(run_benchmark
+        ${CMAKE_COMMAND} -E make_directory ${results_dir}
+        COMMAND $<TARGET_FILE:${target_name}>
+                --benchmark_out=${results_file}
+                --benchmark_out_format=json
+    )
+
+    add_custom_target(${target_name}_compare
+        COMMAND ${run_benchmark}
+        COMMAND ${Python3_EXECUTABLE} ${compare_script}
+                ${results_file} ${baseline_file}
+                --threshold ${WHISKERTOOLBOX_BENCHMARK_THRESHOLD}
+        DEPENDS ${target_name}
+        USES_TERMINAL
+        COMMENT "Comparing ${BASE_NAME} against its baseline"
+    )
+
+    add_custom_target(${target_name}_update_baseline
+        COMMAND ${run_benchmark}
+        COMMAND ${Python3_EXECUTABLE} ${compare_script}
+                ${results_file} ${baseline_file}
+                --update
+        DEPENDS ${target_name}
+        USES_TERMINAL
+        COMMENT "Recording ${BASE_NAME} baseline"
+    )
+
+    set_property(GLOBAL APPEND PROPERTY WHISKERTOOLBOX_BENCHMARK_BASELINE_NAMES ${BASE_NAME})
+endfunction()
+
+#[[
+add_benchmark_baseline_aggregate_targets
+----------------------------------------
+
+Adds benchmark_compare and benchmark_update_baselines, which run the
+per-benchmark targets created by add_benchmark_baseline_targets.
+Call this once, after all add_benchmark_baseline_targets calls.
+
+Example:
+  add_benchmark_baseline_aggregate_targets()
+]]
+function(add_benchmark_baseline_aggregate_targets)
+    get_property(names GLOBAL PROPERTY WHISKERTOOLBOX_BENCHMARK_BASELINE_NAMES)
+    if(NOT names)
+        return()
+    endif()
+
+    add_custom_target(benchmark_compare)
+    add_custom_target(benchmark_update_baselines)
+    foreach(name ${names})
+        add_dependencies(benchmark_compare benchmark_${name}_compare)
+        add_dependencies(benchmark_update_baselines benchmark_${name}_update_baseline)
+    endforeach()
+
+    message(STATUS "Benchmark baselines: ${WHISKERTOOLBOX_BENCHMARK_BASELINE_DIR}")
+    message(STATUS "  compare: cmake --build . --target benchmark_compare")
+    message(STATUS "  update:  cmake --build . --target benchmark_update_baselines")
+endfunction()
+
 #[[
 print_benchmark_summary
 -----------------------
@@ -0,0 +1,124 @@
+#include "analytic_signal.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace {
+
+std::size_t resolveFftSize(AnalyticSignalOptions const & options) {
+    std::size_t const m = std::max<std::size_t>(options.kernel_half_width, 1);
+    if (options.fft_size == 0) {
+        return nextPowerOfTwo(8 * m);
+    }
+    std::size_t const requested = nextPowerOfTwo(options.fft_size);
+    return requested > 2 * m ? requested : nextPowerOfTwo(4 * m);
+}
+
+/**
+ * @brief Mirror an out-of-range index back into [0, n) (whole-sample symmetric extension)
+ */
+std::size_t mirrorIndex(std::ptrdiff_t index, std::size_t n) {
+    if (n == 1) {
+        return 0;
+    }
+    auto const period = static_cast<std::ptrdiff_t>(2 * (n - 1));
+    index %= period;
+    if (index < 0) {
+        index += period;
+    }
+    if (index >= static_cast<std::ptrdiff_t>(n)) {
+        index = period - index;
+    }
+    return static_cast<std::size_t>(index);
+}
+
+}// namespace
+
+OverlapSaveHilbert::OverlapSaveHilbert(AnalyticSignalOptions const & options)
+    : _half_width(std::max<std::size_t>(options.kernel_half_width, 1)),
+      _plan(resolveFftSize(options)) {
+
+    // Causal kernel g[k] = delta[k - M] + i * h[k - M], k in [0, 2M]
+    std::size_t const n_fft = _plan.size();
+    auto const m = static_cast<std::ptrdiff_t>(_half_width);
+    _kernel_spectrum.assign(n_fft, {0.0, 0.0});
+    _kernel_spectrum[_half_width] = {1.0, 0.0};
+    for (std::ptrdiff_t n = -m; n <= m; ++n) {
+        if (n % 2 == 0) {
+            continue;
+        }
+        // Blackman window over [-M, M]
+        double const x = std::numbers::pi * static_cast<double>(n) / static_cast<double>(m + 1);
+        double const window = 0.42 + 0.5 * std::cos(x) + 0.08 * std::cos(2.0 * x);
+        double const h = 2.0 / (std::numbers::pi * static_cast<double>(n)) * window;
+        _kernel_spectrum[static_cast<std::size_t>(n + m)] = {0.0, h};
+    }
+    _plan.forward(_kernel_spectrum);
+}
+
+template<typename Sink>
+void OverlapSaveHilbert::_processBlocks(std::span<float const> input, Sink && sink) const {
+    std::size_t const n = input.size();
+    if (n == 0) {
+        return;
+    }
+    std::size_t const n_fft = _plan.size();
+    std::size_t const block = blockSize();
+    std::size_t const num_blocks = (n + block - 1) / block;
+    auto const m = static_cast<std::ptrdiff_t>(_half_width);
+
+    CoreUtilities::parallelForChunks(0, num_blocks, 1, [&](std::size_t first_block, std::size_t last_block) {
+        std::vector<std::complex<double>> buffer(n_fft);
+        for (std::size_t b = first_block; b < last_block; ++b) {
+            // Window covers input [b * L - M, b * L + L + M); the first 2M
+            // outputs of the circular convolution are discarded.
+            auto const window_start = static_cast<std::ptrdiff_t>(b * block) - m;
+            for (std::size_t i = 0; i < n_fft; ++i) {
+                auto const index = window_start + static_cast<std::ptrdiff_t>(i);
+                bool const inside = index >= 0 && index < static_cast<std::ptrdiff_t>(n);
+                auto const source = inside ? static_cast<std::size_t>(index) : mirrorIndex(index, n);
+                buffer[i] = {static_cast<double>(input[source]), 0.0};
+            }
+
+            _plan.forward(buffer);
+            for (std::size_t i = 0; i < n_fft; ++i) {
+                buffer[i] *= _kernel_spectrum[i];
+            }
+            _plan.inverse(buffer);
+
+            std::size_t const out_begin = b * block;
+            std::size_t const out_end = std::min(out_begin + block, n);
+            for (std::size_t k = out_begin; k < out_end; ++k) {
+                sink(k, buffer[k - out_begin + 2 * _half_width]);
+            }
+        }
+    });
+}
+
+void OverlapSaveHilbert::analyticSignal(std::span<float const> input, std::span<std::complex<double>> output) const {
+    if (output.size() != input.size()) {
+        throw std::invalid_argument("OverlapSaveHilbert: output size must match input size");
+    }
+    _processBlocks(input, [output](std::size_t k, std::complex<double> z) {
+        output[k] = z;
+    });
+}
+
+void OverlapSaveHilbert::extract(std::span<float const> input, AnalyticSignalComponent component, std::span<float> output) const {
+    if (output.size() != input.size()) {
+        throw std::invalid_argument("OverlapSaveHilbert: output size must match input size");
+    }
+    if (component == AnalyticSignalComponent::Phase) {
+        _processBlocks(input, [output](std::size_t k, std::complex<double> z) {
+            output[k] = static_cast<float>(std::arg(z));
+        });
+    } else {
+        _processBlocks(input, [output](std::size_t k, std::complex<double> z) {
+            output[k] = static_cast<float>(std::abs(z));
+        });
+    }
+}
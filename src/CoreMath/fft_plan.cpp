@@ -0,0 +1,84 @@
+#include "fft_plan.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <utility>
+
+std::size_t nextPowerOfTwo(std::size_t n) {
+    std::size_t p = 2;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+FftPlan::FftPlan(std::size_t size)
+    : _size(size) {
+    if (size < 2 || (size & (size - 1)) != 0) {
+        throw std::invalid_argument("FftPlan: size must be a power of two >= 2");
+    }
+
+    std::size_t log2n = 0;
+    while ((std::size_t{1} << log2n) < size) {
+        ++log2n;
+    }
+
+    _bit_reverse.resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        std::size_t reversed = 0;
+        for (std::size_t b = 0; b < log2n; ++b) {
+            reversed |= ((i >> b) & 1U) << (log2n - 1 - b);
+        }
+        _bit_reverse[i] = reversed;
+    }
+
+    _twiddles.resize(size / 2);
+    for (std::size_t k = 0; k < size / 2; ++k) {
+        double const angle = -2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(size);
+        _twiddles[k] = {std::cos(angle), std::sin(angle)};
+    }
+}
+
+void FftPlan::forward(std::span<std::complex<double>> data) const {
+    _transform(data, false);
+}
+
+void FftPlan::inverse(std::span<std::complex<double>> data) const {
+    _transform(data, true);
+    double const scale = 1.0 / static_cast<double>(_size);
+    for (auto & value: data) {
+        value *= scale;
+    }
+}
+
+void FftPlan::_transform(std::span<std::complex<double>> data, bool inverse) const {
+    if (data.size() != _size) {
+        throw std::invalid_argument("FftPlan: buffer size does not match plan size");
+    }
+
+    for (std::size_t i = 0; i < _size; ++i) {
+        std::size_t const j = _bit_reverse[i];
+        if (i < j) {
+            std::swap(data[i], data[j]);
+        }
+    }
+
+    // Iterative Cooley-Tukey butterflies
+    for (std::size_t len = 2; len <= _size; len <<= 1) {
+        std::size_t const half = len / 2;
+        std::size_t const stride = _size / len;
+        for (std::size_t start = 0; start < _size; start += len) {
+            for (std::size_t k = 0; k < half; ++k) {
+                auto w = _twiddles[k * stride];
+                if (inverse) {
+                    w = std::conj(w);
+                }
+                auto const even = data[start + k];
+                auto const odd = data[start + k + half] * w;
+                data[start + k] = even + odd;
+                data[start + k + half] = even - odd;
+            }
+        }
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file fft_plan.hpp
+ * @brief Reusable radix-2 complex FFT plan for fixed power-of-two sizes
+ */
+#ifndef COREMATH_FFT_PLAN_HPP
+#define COREMATH_FFT_PLAN_HPP
+
+#include <complex>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Precomputed twiddle factors and bit-reversal table for one FFT size
+ *
+ * A plan is immutable after construction, so a single plan can be shared by
+ * any number of threads transforming their own buffers.
+ */
+class FftPlan {
+public:
+    /**
+     * @brief Build a plan for transforms of length @p size
+     *
+     * @pre size is a power of two and >= 2 (enforcement: runtime_check, throws std::invalid_argument)
+     */
+    explicit FftPlan(std::size_t size);
+
+    [[nodiscard]] std::size_t size() const { return _size; }
+
+    /**
+     * @brief In-place forward transform, X[k] = sum_n x[n] exp(-2 pi i k n / N)
+     *
+     * @pre data.size() == size() (enforcement: runtime_check, throws std::invalid_argument)
+     */
+    void forward(std::span<std::complex<double>> data) const;
+
+    /**
+     * @brief In-place inverse transform, including the 1/N scaling
+     *
+     * @pre data.size() == size() (enforcement: runtime_check, throws std::invalid_argument)
+     */
+    void inverse(std::span<std::complex<double>> data) const;
+
+private:
+    void _transform(std::span<std::complex<double>> data, bool inverse) const;
+
+    std::size_t _size;
+    std::vector<std::size_t> _bit_reverse;
+    std::vector<std::complex<double>> _twiddles;///< exp(-2 pi i k / N) for k in [0, N/2)
+};
+
+/**
+ * @brief Smallest power of two that is >= @p n (and >= 2)
+ */
+[[nodiscard]] std::size_t nextPowerOfTwo(std::size_t n);
+
+#endif// COREMATH_FFT_PLAN_HPP
@@ -11,8 +11,13 @@
 #include "Entity/EntityTypes.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <ranges>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace CorePlotting {
@@ -184,6 +189,66 @@ struct TrialConfig {
     return result;
 }
 
+/**
+ * @brief Map trial-aligned events stored in CSR layout within a window
+ *
+ * Trial t's events are relative_times[trial_offsets[t] .. trial_offsets[t + 1]),
+ * already relative to that trial's reference time and sorted within the trial
+ * (the layout of FlatEventGather). The window [-window_before, window_after]
+ * is located per trial by binary search, so events outside it are never
+ * touched. Trials whose layout is null are skipped.
+ *
+ * @param trial_offsets CSR row pointers (trial count + 1 entries)
+ * @param relative_times Event times relative to their trial's reference time
+ * @param entity_ids EntityId per event, parallel to relative_times
+ * @param row_layouts Layout (Y position) per trial
+ * @param window_before Time units before reference to include
+ * @param window_after Time units after reference to include
+ * @return Vector of MappedElement in trial order
+ *
+ * @pre row_layouts.size() + 1 == trial_offsets.size() (enforcement: none) [CRITICAL]
+ * @pre entity_ids.size() == relative_times.size() (enforcement: none) [CRITICAL]
+ */
+[[nodiscard]] inline std::vector<MappedElement> mapFlatTrialsInWindow(
+        std::span<std::size_t const> trial_offsets,
+        std::span<int64_t const> relative_times,
+        std::span<EntityId const> entity_ids,
+        std::span<SeriesLayout const * const> row_layouts,
+        int window_before,
+        int window_after) {
+    auto const lowest = static_cast<int64_t>(-window_before);
+    auto const highest = static_cast<int64_t>(window_after);
+
+    // Window bounds per trial, then one exact-size fill
+    std::vector<std::pair<std::size_t, std::size_t>> ranges(row_layouts.size());
+    std::size_t total = 0;
+    for (std::size_t t = 0; t < row_layouts.size(); ++t) {
+        if (!row_layouts[t]) {
+            continue;
+        }
+        auto const first = relative_times.begin() + static_cast<std::ptrdiff_t>(trial_offsets[t]);
+        auto const last = relative_times.begin() + static_cast<std::ptrdiff_t>(trial_offsets[t + 1]);
+        auto const lo = std::lower_bound(first, last, lowest);
+        auto const hi = std::upper_bound(lo, last, highest);
+        ranges[t] = {static_cast<std::size_t>(lo - relative_times.begin()),
+                     static_cast<std::size_t>(hi - relative_times.begin())};
+        total += ranges[t].second - ranges[t].first;
+    }
+
+    std::vector<MappedElement> result;
+    result.reserve(total);
+    for (std::size_t t = 0; t < row_layouts.size(); ++t) {
+        if (!row_layouts[t]) {
+            continue;
+        }
+        float const y_center = row_layouts[t]->y_transform.offset;
+        for (std::size_t k = ranges[t].first; k < ranges[t].second; ++k) {
+            result.push_back(MappedElement{static_cast<float>(relative_times[k]), y_center, entity_ids[k]});
+        }
+    }
+    return result;
+}
+
 // ============================================================================
 // Layout Helpers for Raster Plots
 // ============================================================================
@@ -0,0 +1,203 @@
+#ifndef COREUTILITIES_THREAD_POOL_HPP
+#define COREUTILITIES_THREAD_POOL_HPP
+
+/**
+ * @file thread_pool.hpp
+ * @brief Small fixed-size worker pool plus a chunked parallel-for helper.
+ *
+ * The pool is intentionally minimal: FIFO task queue, futures for results,
+ * no work stealing. `parallelForChunks()` lets the calling thread take part
+ * in the loop, so it is safe to call from inside a pool task (nested calls
+ * never block waiting for a worker that is itself waiting).
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CoreUtilities {
+
+/**
+ * @brief Number of worker threads used when none is specified.
+ *
+ * One less than the hardware concurrency (the caller usually participates),
+ * and never less than one.
+ */
+inline std::size_t defaultThreadCount() {
+    auto const hw = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    return hw > 1 ? hw - 1 : 1;
+}
+
+class ThreadPool {
+public:
+    /**
+     * @brief Start @p num_threads workers (0 selects defaultThreadCount()).
+     */
+    explicit ThreadPool(std::size_t num_threads = 0) {
+        if (num_threads == 0) {
+            num_threads = defaultThreadCount();
+        }
+        _workers.reserve(num_threads);
+        for (std::size_t i = 0; i < num_threads; ++i) {
+            _workers.emplace_back([this] { _workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> const lock(_mutex);
+            _stopping = true;
+        }
+        _cv.notify_all();
+        for (auto & worker: _workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool & operator=(ThreadPool const &) = delete;
+    ThreadPool(ThreadPool &&) = delete;
+    ThreadPool & operator=(ThreadPool &&) = delete;
+
+    /**
+     * @brief Queue a callable and return a future for its result.
+     *
+     * Exceptions thrown by the task are delivered through the future.
+     */
+    template<typename F>
+    [[nodiscard]] auto submit(F && task) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        auto future = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> const lock(_mutex);
+            _tasks.emplace([packaged] { (*packaged)(); });
+        }
+        _cv.notify_one();
+        return future;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return _workers.size(); }
+
+    /**
+     * @brief Process-wide pool shared by data loading, transforms and plotting.
+     *
+     * Created on first use with defaultThreadCount() workers.
+     */
+    static ThreadPool & shared() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+private:
+    void _workerLoop() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+                if (_stopping && _tasks.empty()) {
+                    return;
+                }
+                task = std::move(_tasks.front());
+                _tasks.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> _workers;
+    std::queue<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stopping{false};
+};
+
+/**
+ * @brief Run @p body over `[begin, end)` in chunks of at most @p grain items.
+ *
+ * `body(chunk_begin, chunk_end)` is invoked once per chunk. Chunks are claimed
+ * from a shared counter by the calling thread and by up to `pool.size()`
+ * helpers, so the call also makes progress when every worker is busy. Chunk
+ * boundaries depend only on @p begin, @p end and @p grain, which keeps
+ * per-chunk results deterministic. The first exception thrown by any chunk is
+ * rethrown after all started chunks have finished.
+ */
+template<typename Body>
+void parallelForChunks(std::size_t begin,
+                       std::size_t end,
+                       std::size_t grain,
+                       Body && body,
+                       ThreadPool & pool = ThreadPool::shared()) {
+    if (end <= begin) {
+        return;
+    }
+    grain = std::max<std::size_t>(grain, 1);
+    std::size_t const num_chunks = (end - begin + grain - 1) / grain;
+    if (num_chunks == 1 || pool.size() == 0) {
+        for (std::size_t lo = begin; lo < end; lo += grain) {
+            body(lo, std::min(lo + grain, end));
+        }
+        return;
+    }
+
+    struct SharedState {
+        std::atomic<std::size_t> next_chunk{0};
+        std::atomic<std::size_t> done_chunks{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<SharedState>();
+
+    auto run_chunks = [state, begin, end, grain, num_chunks, &body] {
+        for (;;) {
+            std::size_t const chunk = state->next_chunk.fetch_add(1);
+            if (chunk >= num_chunks) {
+                return;
+            }
+            std::size_t const lo = begin + chunk * grain;
+            try {
+                body(lo, std::min(lo + grain, end));
+            } catch (...) {
+                std::lock_guard<std::mutex> const lock(state->mutex);
+                if (!state->error) {
+                    state->error = std::current_exception();
+                }
+            }
+            if (state->done_chunks.fetch_add(1) + 1 == num_chunks) {
+                std::lock_guard<std::mutex> const lock(state->mutex);
+                state->cv.notify_all();
+            }
+        }
+    };
+
+    std::size_t const helpers = std::min(pool.size(), num_chunks - 1);
+    for (std::size_t i = 0; i < helpers; ++i) {
+        // Helpers only touch `body` while unclaimed chunks remain, and the
+        // caller does not return before every claimed chunk has completed.
+        (void) pool.submit(run_chunks);
+    }
+    run_chunks();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->done_chunks.load() == num_chunks; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+}// namespace CoreUtilities
+
+#endif// COREUTILITIES_THREAD_POOL_HPP
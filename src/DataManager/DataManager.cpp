@@ -20,6 +20,7 @@
 #include "IO/formats/CSV/points/Point_Data_CSV.hpp"// For load_multiple_PointData_from_dlc
 // Tensor numpy loading now handled through the IO registry (DataManagerNumpy library)
 #include "utils/JsonDataLoadExpansion.hpp"
+#include "utils/JsonLoadGraph.hpp"
 #include "utils/TableView/TableRegistry.hpp"
 
 #include "IO/formats/Binary/common/binary_loaders.hpp"              // For Time data type loading
@@ -31,6 +32,7 @@
 #include <rfl.hpp>
 
 #include "CoreUtilities/string_manip.hpp"
+#include "CoreUtilities/thread_pool.hpp"
 #include "transforms/TransformPipeline.hpp"
 #include "transforms/TransformRegistry.hpp"
 #include "utils/DerivedTimeFrame.hpp"
@@ -42,8 +44,10 @@
 #include "Lineage/LineageRecorder.hpp"
 
 #include <cassert>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <numeric>
 #include <optional>
@@ -144,280 +148,6 @@ void clearJsonPythonEnvironmentConfigurator() {
     jsonPythonEnvironmentConfigurator() = nullptr;
 }
 
-/**
- * @brief Try loading data using new registry system first, fallback to legacy if needed
- */
-bool tryRegistryThenLegacyLoad(
-        DataManager * dm,
-        std::string const & file_path,
-        DM_DataType data_type,
-        nlohmann::json const & item,
-        std::string const & name,
-        TimeKey const & registration_time_key,
-        std::vector<DataInfo> & data_info_list) {
-    // Extract format if available
-    if (item.contains("format")) {
-        std::string const format = item["format"];
-
-        // Try registry system first
-        LoaderRegistry & registry = LoaderRegistry::getInstance();
-        if (registry.isFormatSupported(format, data_type)) {
-            std::cout << "Using registry loader for " << name << " (format: " << format << ")" << std::endl;
-
-            LoadResult result = registry.tryLoad(format, data_type, file_path, item);
-            if (result.success) {
-                // Handle data setting and post-loading setup based on data type
-                switch (data_type) {
-                    case DM_DataType::Line: {
-                        // Set the LineData in DataManager
-                        if (std::holds_alternative<std::shared_ptr<LineData>>(result.data)) {
-                            auto line_data = std::get<std::shared_ptr<LineData>>(result.data);
-
-                            dm->setData<LineData>(name, line_data, registration_time_key);
-                            recordLoadedFileSource(dm, name, file_path, item);
-
-                            std::string const color = item.value("color", "0000FF");
-                            data_info_list.push_back({name, "LineData", color});
-                        }
-                        break;
-                    }
-                    case DM_DataType::Mask: {
-                        // Set the MaskData in DataManager
-                        if (std::holds_alternative<std::shared_ptr<MaskData>>(result.data)) {
-                            auto mask_data = std::get<std::shared_ptr<MaskData>>(result.data);
-
-                            dm->setData<MaskData>(name, mask_data, registration_time_key);
-                            recordLoadedFileSource(dm, name, file_path, item);
-
-                            std::string const color = item.value("color", "0000FF");
-                            data_info_list.push_back({name, "MaskData", color});
-                        }
-                        break;
-                    }
-                    case DM_DataType::Analog: {
-                        // Set the AnalogTimeSeries in DataManager
-                        // Note: Plugin returns single channel. For multi-channel binary files,
-                        // the legacy loader handles all channels. Plugin is useful for single-channel
-                        // CSV files or when only the first channel is needed.
-                        if (std::holds_alternative<std::shared_ptr<AnalogTimeSeries>>(result.data)) {
-                            auto analog_data = std::get<std::shared_ptr<AnalogTimeSeries>>(result.data);
-
-                            // For single channel, use the base name
-                            //std::string const channel_name = name + "_0";
-                            std::string const & channel_name = name;
-                            dm->setData<AnalogTimeSeries>(channel_name, analog_data, registration_time_key);
-                            recordLoadedFileSource(dm, channel_name, file_path, item);
-                        }
-                        break;
-                    }
-                    case DM_DataType::DigitalEvent: {
-                        // Set the DigitalEventSeries in DataManager
-                        // Note: Plugin returns single series. For multi-series CSV files,
-                        // the legacy loader handles all series.
-                        if (std::holds_alternative<std::shared_ptr<DigitalEventSeries>>(result.data)) {
-                            auto event_data = std::get<std::shared_ptr<DigitalEventSeries>>(result.data);
-
-                            //std::string const channel_name = name + "_0";
-                            std::string const & channel_name = name;
-                            dm->setData<DigitalEventSeries>(channel_name, event_data, registration_time_key);
-                            recordLoadedFileSource(dm, channel_name, file_path, item);
-                        }
-                        break;
-                    }
-                    case DM_DataType::DigitalInterval: {
-                        // Set the DigitalIntervalSeries in DataManager
-                        if (std::holds_alternative<std::shared_ptr<DigitalIntervalSeries>>(result.data)) {
-                            auto interval_data = std::get<std::shared_ptr<DigitalIntervalSeries>>(result.data);
-
-                            dm->setData<DigitalIntervalSeries>(name, interval_data, registration_time_key);
-                            recordLoadedFileSource(dm, name, file_path, item);
-                        }
-                        break;
-                    }
-                    case DM_DataType::Points: {
-                        // Set the PointData in DataManager
-                        // Note: Plugin returns single PointData. For DLC files with multiple bodyparts,
-                        // use the dedicated load_multiple_PointData_from_dlc() function.
-                        if (std::holds_alternative<std::shared_ptr<PointData>>(result.data)) {
-                            auto point_data = std::get<std::shared_ptr<PointData>>(result.data);
-
-                            dm->setData<PointData>(name, point_data, registration_time_key);
-                            recordLoadedFileSource(dm, name, file_path, item);
-
-                            std::string const color = item.value("color", "#0000FF");
-                            data_info_list.push_back({name, "PointData", color});
-                        }
-                        break;
-                    }
-                    case DM_DataType::Tensor: {
-                        // Set the TensorData in DataManager
-                        if (std::holds_alternative<std::shared_ptr<TensorData>>(result.data)) {
-                            auto tensor_data = std::get<std::shared_ptr<TensorData>>(result.data);
-
-                            dm->setData<TensorData>(name, tensor_data, registration_time_key);
-                            recordLoadedFileSource(dm, name, file_path, item);
-                        }
-                        break;
-                    }
-                    default:
-                        std::cerr << "Registry loaded unsupported data type: " << static_cast<int>(data_type) << std::endl;
-                        return false;
-                }
-
-                return true;
-            } else {
-                std::cout << "Registry loading failed for " << name << ": " << result.error_message
-                          << ", falling back to legacy loader" << std::endl;
-            }
-        }
-    }
-
-    return false;// Indicates we should use legacy loading
-}
-
-/**
- * @brief Try batch loading using the registry system (for multi-channel/multi-series files)
- * 
- * This function handles file formats that can contain multiple data objects, such as:
- * - Multi-channel binary files (Analog, DigitalEvent)
- * - Multi-series CSV files (DigitalEvent)
- * - DLC files with multiple bodyparts (Points)
- * 
- * @param dm Pointer to the DataManager
- * @param file_path Path to the file to load
- * @param data_type Type of data being loaded
- * @param item JSON configuration for loading
- * @param name Base name for the loaded data objects
- * @return true if batch loading succeeded, false to fall back to legacy loading
- */
-bool tryBatchLoadFromRegistry(
-        DataManager * dm,
-        std::string const & file_path,
-        DM_DataType data_type,
-        nlohmann::json const & item,
-        std::string const & name,
-        TimeKey const & registration_time_key) {
-
-    if (!item.contains("format")) {
-        return false;
-    }
-
-    std::string const format = item["format"];
-    LoaderRegistry & registry = LoaderRegistry::getInstance();
-    auto const io_data_type = data_type;
-
-    // Check if any loader supports batch loading for this format
-    if (!registry.isBatchLoadingSupported(format, io_data_type)) {
-        return false;
-    }
-
-    // For DigitalInterval with binary_state layout, only use batch loading when all_columns is true
-    // Otherwise, single-column loading should use the regular single-object path
-    if (data_type == DM_DataType::DigitalInterval) {
-        bool const all_columns = item.value("all_columns", false);
-        if (!all_columns) {
-            return false;// Fall back to single-object loading
-        }
-    }
-
-    // For DigitalEvent, only use batch loading when multi_file or identifier column is specified
-    if (data_type == DM_DataType::DigitalEvent) {
-        bool const multi_file = item.value("multi_file", false);
-        bool const has_identifier = item.contains("identifier_column") && item["identifier_column"].get<int>() >= 0;
-        bool const has_label = item.contains("label_column") && item["label_column"].get<int>() >= 0;
-        if (!multi_file && !has_identifier && !has_label) {
-            return false;// Fall back to single-object loading
-        }
-    }
-
-    std::cout << "Using batch loading for " << name << " (format: " << format << ")" << std::endl;
-
-    BatchLoadResult batch_result = registry.tryLoadBatch(format, io_data_type, file_path, item);
-
-    if (!batch_result.success) {
-        std::cout << "Batch loading failed for " << name << ": " << batch_result.error_message
-                  << ", falling back to legacy loader" << std::endl;
-        return false;
-    }
-
-    // Process each result in the batch
-    for (size_t i = 0; i < batch_result.results.size(); ++i) {
-        auto const & result = batch_result.results[i];
-        if (!result.success) {
-            std::cerr << "Batch item " << i << " failed: " << result.error_message << std::endl;
-            continue;
-        }
-
-        std::string channel_name;
-
-        if (item.value("multi_file", false)) {
-            if (item.value("append_filename", false) && !result.name.empty()) {
-                channel_name = name + "_" + result.name;
-            } else {
-                channel_name = name + "_" + std::to_string(i);
-            }
-        } else if (batch_result.results.size() == 1) {
-            // Single result without a name - use base name
-            channel_name = name;
-        } else {
-            // Generate channel name - use result.name if provided, otherwise index
-            if (!result.name.empty()) {
-                channel_name = name + "_" + result.name;
-            } else {
-                channel_name = name + "_" + std::to_string(i);
-            }
-        }
-
-        // Handle based on data type
-        switch (data_type) {
-            case DM_DataType::Analog: {
-                if (std::holds_alternative<std::shared_ptr<TensorData>>(result.data)) {
-                    // Tensor-backed batch: register the TensorData under base name
-                    auto tensor_data = std::get<std::shared_ptr<TensorData>>(result.data);
-                    dm->setData<TensorData>(name, tensor_data, registration_time_key);
-                    recordLoadedFileSource(dm, name, file_path, item);
-                } else if (std::holds_alternative<std::shared_ptr<AnalogTimeSeries>>(result.data)) {
-                    auto analog_data = std::get<std::shared_ptr<AnalogTimeSeries>>(result.data);
-                    dm->setData<AnalogTimeSeries>(channel_name, analog_data, registration_time_key);
-                    recordLoadedFileSource(dm, channel_name, file_path, item);
-                }
-                break;
-            }
-            case DM_DataType::DigitalEvent: {
-                if (std::holds_alternative<std::shared_ptr<DigitalEventSeries>>(result.data)) {
-                    auto event_data = std::get<std::shared_ptr<DigitalEventSeries>>(result.data);
-                    dm->setData<DigitalEventSeries>(channel_name, event_data, registration_time_key);
-                    recordLoadedFileSource(dm, channel_name, file_path, item);
-                }
-                break;
-            }
-            case DM_DataType::Points: {
-                if (std::holds_alternative<std::shared_ptr<PointData>>(result.data)) {
-                    auto point_data = std::get<std::shared_ptr<PointData>>(result.data);
-                    dm->setData<PointData>(channel_name, point_data, registration_time_key);
-                    recordLoadedFileSource(dm, channel_name, file_path, item);
-                }
-                break;
-            }
-            case DM_DataType::DigitalInterval: {
-                if (std::holds_alternative<std::shared_ptr<DigitalIntervalSeries>>(result.data)) {
-                    auto interval_data = std::get<std::shared_ptr<DigitalIntervalSeries>>(result.data);
-                    dm->setData<DigitalIntervalSeries>(channel_name, interval_data, registration_time_key);
-                    recordLoadedFileSource(dm, channel_name, file_path, item);
-                }
-                break;
-            }
-            default:
-                std::cerr << "Batch loading not supported for data type: "
-                          << static_cast<int>(data_type) << std::endl;
-                break;
-        }
-    }
-
-    std::cout << "Batch loaded " << batch_result.results.size() << " objects for " << name << std::endl;
-    return true;
-}
-
 DataManager::DataManager() {
 
     _times[TimeKey("time")] = std::make_shared<TimeFrame>();
@@ -1179,631 +909,842 @@ bool validateDeclaredClocks(DataManager & dm, std::vector<std::string> const & c
     return true;
 }
 
-std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const & j, std::string const & base_path, JsonLoadProgressCallback const & progress_callback) {
-    std::vector<DataInfo> data_info_list;
+namespace {
 
-    std::map<std::string, std::string> clock_mappings;
-    std::vector<std::string> declared_clocks;
-    std::unordered_set<std::string> declared_clock_names;
-    bool saw_video_in_config = false;
+/// One data object produced by a JSON entry, ready to be registered.
+struct StagedDataObject {
+    std::string key;
+    DataTypeVariant data;
+    std::optional<DataInfo> info;
+};
 
-    // Support the extended format where the root is an object rather than a plain array:
-    //
-    //   {
-    //     "variables": { "local": "/data/raw", "shared": "/mnt/shared" },
-    //     "data": [ { "filepath": "${local}/video.mp4", ... }, ... ]
-    //   }
-    //
-    // A plain JSON array is accepted unchanged (backward-compatible).
-    json resolved;// owns the array when variable substitution is applied
-    json const * working_ptr = &j;
+/// One TimeFrame produced by a file-backed `data_type: "time"` entry.
+struct StagedTimeFrame {
+    std::string key;
+    std::shared_ptr<TimeFrame> time_frame;
+};
 
-    if (j.is_object() && j.contains("data") && j["data"].is_array()) {
-        if (j.contains("python")) {
-            auto & configurator = jsonPythonEnvironmentConfigurator();
-            if (!configurator) {
-                std::cerr << "Error: JSON contains a top-level 'python' block, but no Python environment configurator is registered." << std::endl;
-                return data_info_list;
-            }
+/**
+ * @brief Result of the I/O half of loading one file-backed JSON entry.
+ *
+ * Staging reads and parses files without touching the DataManager, so
+ * independent entries can be staged concurrently. Committing registers the
+ * staged objects and always runs on the loading thread.
+ */
+struct StagedJsonEntry {
+    std::string file_path;
+    std::vector<StagedDataObject> objects;
+    std::vector<StagedTimeFrame> time_frames;
+    bool saw_video{false};
+    bool counted{false};///< false when the entry was skipped (missing fields, unknown type, missing file)
+};
 
-            std::string error_message;
-            if (!configurator(j["python"], error_message)) {
-                std::cerr << "Error: Failed to configure Python environment for JSON loading: "
-                          << error_message << std::endl;
-                return data_info_list;
-            }
-        }
+/**
+ * @brief Stage a shared_ptr alternative of a loader result if it holds @p T.
+ * @return true if @p data held a @p T.
+ */
+template<typename T>
+bool stageIfHolds(LoadedDataVariant const & data,
+                  std::string const & key,
+                  std::optional<DataInfo> info,
+                  StagedJsonEntry & staged) {
+    if (!std::holds_alternative<std::shared_ptr<T>>(data)) {
+        return false;
+    }
+    staged.objects.push_back({key, DataTypeVariant{std::get<std::shared_ptr<T>>(data)}, std::move(info)});
+    return true;
+}
 
-        std::map<std::string, std::string> variables;
-        if (j.contains("variables") && j["variables"].is_object()) {
-            for (auto const & [k, v]: j["variables"].items()) {
-                if (v.is_string()) {
-                    variables[k] = v.get<std::string>();
-                }
-            }
-        }
-        json data_array = j["data"];
-        if (j.contains("loops")) {
-            data_array = expandDataArrayLoops(data_array, j["loops"]);
-        }
-        // Always run substitution: inline variables take priority, env vars are the fallback
-        auto data_str = data_array.dump();
-        data_str = substituteVariablesInJsonString(data_str, variables);
-        resolved = json::parse(data_str);
-        working_ptr = &resolved;
+/**
+ * @brief Try loading one object through the format registry.
+ * @return false if the format is unsupported or the loader failed (caller reports the error).
+ */
+bool stageRegistryLoad(
+        std::string const & file_path,
+        DM_DataType data_type,
+        nlohmann::json const & item,
+        std::string const & name,
+        StagedJsonEntry & staged) {
+    if (!item.contains("format")) {
+        return false;
     }
 
-    if (j.is_object() && j.contains("clocks")) {
-        if (!parseDeclaredClockNames(j["clocks"], declared_clocks)) {
-            return data_info_list;
-        }
-        if (!registerDeclaredClocks(dm, declared_clocks)) {
-            return data_info_list;
-        }
-        declared_clock_names.insert(declared_clocks.begin(), declared_clocks.end());
+    std::string const format = item["format"];
+
+    LoaderRegistry & registry = LoaderRegistry::getInstance();
+    if (!registry.isFormatSupported(format, data_type)) {
+        return false;
     }
+    std::cout << "Using registry loader for " << name << " (format: " << format << ")" << std::endl;
 
-    json const & working = *working_ptr;
+    LoadResult result = registry.tryLoad(format, data_type, file_path, item);
+    if (!result.success) {
+        std::cout << "Registry loading failed for " << name << ": " << result.error_message
+                  << ", falling back to legacy loader" << std::endl;
+        return false;
+    }
 
-    // Count total items to load (excluding transformations which are processed separately)
-    int total_items = 0;
-    for (auto const & item: working) {
-        if (!item.contains("transformations")) {
-            total_items++;
-        }
+    switch (data_type) {
+        case DM_DataType::Line:
+            stageIfHolds<LineData>(result.data, name, DataInfo{name, "LineData", item.value("color", "0000FF")}, staged);
+            break;
+        case DM_DataType::Mask:
+            stageIfHolds<MaskData>(result.data, name, DataInfo{name, "MaskData", item.value("color", "0000FF")}, staged);
+            break;
+        case DM_DataType::Analog:
+            // Plugin returns a single channel. Multi-channel binary files go through batch loading.
+            stageIfHolds<AnalogTimeSeries>(result.data, name, std::nullopt, staged);
+            break;
+        case DM_DataType::DigitalEvent:
+            stageIfHolds<DigitalEventSeries>(result.data, name, std::nullopt, staged);
+            break;
+        case DM_DataType::DigitalInterval:
+            stageIfHolds<DigitalIntervalSeries>(result.data, name, std::nullopt, staged);
+            break;
+        case DM_DataType::Points:
+            // DLC files with multiple bodyparts use load_multiple_PointData_from_dlc() instead.
+            stageIfHolds<PointData>(result.data, name, DataInfo{name, "PointData", item.value("color", "#0000FF")}, staged);
+            break;
+        case DM_DataType::Tensor:
+            stageIfHolds<TensorData>(result.data, name, std::nullopt, staged);
+            break;
+        default:
+            std::cerr << "Registry loaded unsupported data type: " << static_cast<int>(data_type) << std::endl;
+            return false;
     }
+    return true;
+}
 
-    // Report initial progress to show the dialog immediately
-    if (progress_callback) {
-        bool const should_continue = progress_callback(0, total_items, "Preparing to load data...");
-        if (!should_continue) {
-            std::cout << "Loading cancelled by user" << std::endl;
-            return data_info_list;
-        }
+/**
+ * @brief Try batch loading through the registry (multi-channel / multi-series files)
+ *
+ * Handles file formats that can contain multiple data objects, such as:
+ * - Multi-channel binary files (Analog, DigitalEvent)
+ * - Multi-series CSV files (DigitalEvent)
+ * - DLC files with multiple bodyparts (Points)
+ *
+ * @return true if batch loading succeeded, false to fall back to single-object loading
+ */
+bool stageBatchLoadFromRegistry(
+        std::string const & file_path,
+        DM_DataType data_type,
+        nlohmann::json const & item,
+        std::string const & name,
+        StagedJsonEntry & staged) {
+
+    if (!item.contains("format")) {
+        return false;
     }
 
-    int current_item = 0;
+    std::string const format = item["format"];
+    LoaderRegistry & registry = LoaderRegistry::getInstance();
 
-    std::cout << "getting ready to iterate through " << total_items << " items" << std::endl;
+    // Check if any loader supports batch loading for this format
+    if (!registry.isBatchLoadingSupported(format, data_type)) {
+        return false;
+    }
 
-    // Iterate through JSON array
-    for (auto const & item: working) {
+    // For DigitalInterval with binary_state layout, only use batch loading when all_columns is true
+    // Otherwise, single-column loading should use the regular single-object path
+    if (data_type == DM_DataType::DigitalInterval) {
+        bool const all_columns = item.value("all_columns", false);
+        if (!all_columns) {
+            return false;
+        }
+    }
 
-        // Skip transformation objects - they will be processed separately
-        if (item.contains("transformations")) {
-            continue;
+    // For DigitalEvent, only use batch loading when multi_file or identifier column is specified
+    if (data_type == DM_DataType::DigitalEvent) {
+        bool const multi_file = item.value("multi_file", false);
+        bool const has_identifier = item.contains("identifier_column") && item["identifier_column"].get<int>() >= 0;
+        bool const has_label = item.contains("label_column") && item["label_column"].get<int>() >= 0;
+        if (!multi_file && !has_identifier && !has_label) {
+            return false;
         }
+    }
 
-        // Check for "derived" format which doesn't require a filepath
-        if (item.contains("format") && item["format"] == "derived") {
-            if (!checkRequiredFields(item, {"data_type", "name"})) {
-                continue;
-            }
+    std::cout << "Using batch loading for " << name << " (format: " << format << ")" << std::endl;
 
-            std::string const data_type_str = item["data_type"];
-            if (data_type_str != "time") {
-                std::cerr << "Error: 'derived' format is only supported for 'time' data type" << std::endl;
-                continue;
-            }
+    BatchLoadResult batch_result = registry.tryLoadBatch(format, data_type, file_path, item);
 
-            std::string const name = item["name"];
+    if (!batch_result.success) {
+        std::cout << "Batch loading failed for " << name << ": " << batch_result.error_message
+                  << ", falling back to legacy loader" << std::endl;
+        return false;
+    }
 
-            // Get required source_timeframe parameter
-            if (!item.contains("source_timeframe")) {
-                std::cerr << "Error: 'derived' format requires 'source_timeframe' parameter" << std::endl;
-                continue;
-            }
-            std::string const source_timeframe_name = item["source_timeframe"];
-            auto source_timeframe = dm->getTime(TimeKey(source_timeframe_name));
-            if (!source_timeframe) {
-                std::cerr << "Error: Source timeframe '" << source_timeframe_name << "' not found. "
-                          << "Make sure it is loaded before the derived TimeFrame." << std::endl;
-                continue;
-            }
+    for (size_t i = 0; i < batch_result.results.size(); ++i) {
+        auto const & result = batch_result.results[i];
+        if (!result.success) {
+            std::cerr << "Batch item " << i << " failed: " << result.error_message << std::endl;
+            continue;
+        }
 
-            std::shared_ptr<TimeFrame> derived_timeframe = nullptr;
-
-            // Determine the source series name and type
-            // Support two formats:
-            // 1. source_series + source_type (preferred)
-            // 2. interval_series or event_series as key names (legacy)
-            std::string series_name;
-            std::string series_type;
-
-            if (item.contains("source_series") && item.contains("source_type")) {
-                series_name = item["source_series"];
-                series_type = item["source_type"];
-            } else if (item.contains("interval_series")) {
-                series_name = item["interval_series"];
-                series_type = "interval";
-            } else if (item.contains("event_series")) {
-                series_name = item["event_series"];
-                series_type = "event";
+        std::string channel_name;
+
+        if (item.value("multi_file", false)) {
+            if (item.value("append_filename", false) && !result.name.empty()) {
+                channel_name = name + "_" + result.name;
             } else {
-                std::cerr << "Error: 'derived' format requires either 'source_series'+'source_type' or "
-                          << "'interval_series'/'event_series' parameter" << std::endl;
-                continue;
+                channel_name = name + "_" + std::to_string(i);
             }
+        } else if (batch_result.results.size() == 1) {
+            // Single result without a name - use base name
+            channel_name = name;
+        } else if (!result.name.empty()) {
+            channel_name = name + "_" + result.name;
+        } else {
+            channel_name = name + "_" + std::to_string(i);
+        }
 
-            // Normalize series_type to handle variants like "interval_series" -> "interval"
-            if (series_type == "interval_series" || series_type == "interval") {
-                auto interval_series = dm->getData<DigitalIntervalSeries>(series_name);
-                if (!interval_series) {
-                    std::cerr << "Error: Interval series '" << series_name << "' not found. "
-                              << "Make sure it is loaded before the derived TimeFrame." << std::endl;
-                    continue;
+        switch (data_type) {
+            case DM_DataType::Analog:
+                // Tensor-backed batch: register the TensorData under the base name
+                if (!stageIfHolds<TensorData>(result.data, name, std::nullopt, staged)) {
+                    stageIfHolds<AnalogTimeSeries>(result.data, channel_name, std::nullopt, staged);
                 }
+                break;
+            case DM_DataType::DigitalEvent:
+                stageIfHolds<DigitalEventSeries>(result.data, channel_name, std::nullopt, staged);
+                break;
+            case DM_DataType::Points:
+                stageIfHolds<PointData>(result.data, channel_name, std::nullopt, staged);
+                break;
+            case DM_DataType::DigitalInterval:
+                stageIfHolds<DigitalIntervalSeries>(result.data, channel_name, std::nullopt, staged);
+                break;
+            default:
+                std::cerr << "Batch loading not supported for data type: "
+                          << static_cast<int>(data_type) << std::endl;
+                break;
+        }
+    }
 
-                DerivedTimeFrameFromIntervalsOptions opts;
-                opts.source_timeframe = source_timeframe;
-                opts.interval_series = interval_series;
+    std::cout << "Batch loaded " << batch_result.results.size() << " objects for " << name << std::endl;
+    return true;
+}
 
-                // Get optional edge parameter (default: start)
-                std::string const edge_str = item.value("edge", "start");
-                if (edge_str == "end") {
-                    opts.edge = IntervalEdge::END;
-                } else {
-                    opts.edge = IntervalEdge::START;
-                }
+/**
+ * @brief Build the TimeFrame described by a file-backed `data_type: "time"` entry.
+ * @return nullptr if the format is unknown or loading failed.
+ */
+std::shared_ptr<TimeFrame> loadTimeFrameEntry(json const & item, std::string const & file_path, std::string const & name) {
+    if (item["format"] == "uint16") {
 
-                derived_timeframe = createDerivedTimeFrame(opts);
-            } else if (series_type == "event_series" || series_type == "event") {
-                auto event_series = dm->getData<DigitalEventSeries>(series_name);
-                if (!event_series) {
-                    std::cerr << "Error: Event series '" << series_name << "' not found. "
-                              << "Make sure it is loaded before the derived TimeFrame." << std::endl;
-                    continue;
-                }
+        int const channel = item["channel"];
+        std::string const transition = item["transition"];
 
-                DerivedTimeFrameFromEventsOptions opts;
-                opts.source_timeframe = source_timeframe;
-                opts.event_series = event_series;
+        int const header_size = item.value("header_size", 0);
 
-                derived_timeframe = createDerivedTimeFrame(opts);
-            } else {
-                std::cerr << "Error: Unknown source_type '" << series_type << "'. "
-                          << "Use 'interval', 'interval_series', 'event', or 'event_series'." << std::endl;
-                continue;
-            }
+        auto opts = Loader::BinaryAnalogOptions{.file_path = file_path,
+                                                .header_size_bytes = static_cast<size_t>(header_size)};
+        auto data = Loader::readBinaryFile<uint16_t>(opts);
 
-            if (derived_timeframe) {
-                dm->setTime(TimeKey(name), derived_timeframe, true);
-                std::cout << "Created derived TimeFrame '" << name << "'" << std::endl;
-            } else {
-                std::cerr << "Error: Failed to create derived TimeFrame for " << name << std::endl;
-            }
+        auto digital_data = Loader::extractDigitalData(data, channel);
+        auto events = Loader::extractEvents(digital_data, transition);
 
-            // Increment progress counter
-            current_item++;
-            if (progress_callback) {
-                std::string const message = "Created derived TimeFrame: " + name;
-                bool const should_continue = progress_callback(current_item, total_items, message);
-                if (!should_continue) {
-                    std::cout << "Loading cancelled by user" << std::endl;
-                    return data_info_list;
-                }
-            }
-            continue;
+        // convert to int with std::transform
+        std::vector<int> events_int;
+        events_int.reserve(events.size());
+        for (auto e: events) {
+            events_int.push_back(static_cast<int>(e.getValue()));
         }
+        std::cout << "Loaded " << events_int.size() << " events for " << name << std::endl;
 
-        // Check for "max_value" format which doesn't require a filepath
-        if (item.contains("format") && item["format"] == "max_value") {
-            if (!checkRequiredFields(item, {"data_type", "name"})) {
-                continue;
-            }
+        return std::make_shared<TimeFrame>(events_int);
+    }
 
-            std::string const data_type_str = item["data_type"];
-            if (data_type_str != "time") {
-                std::cerr << "Error: 'max_value' format is only supported for 'time' data type" << std::endl;
-                continue;
-            }
+    if (item["format"] == "uint16_length") {
 
-            std::string const name = item["name"];
+        int const header_size = item.value("header_size", 0);
 
-            // Get required source_data parameter
-            if (!item.contains("source_data")) {
-                std::cerr << "Error: 'max_value' format requires 'source_data' parameter" << std::endl;
-                continue;
-            }
+        auto opts = Loader::BinaryAnalogOptions{.file_path = file_path,
+                                                .header_size_bytes = static_cast<size_t>(header_size)};
+        auto data = Loader::readBinaryFile<uint16_t>(opts);
 
-            std::string const source_data_name = item["source_data"];
+        std::vector<int> t(data.size());
+        std::iota(std::begin(t), std::end(t), 0);
 
-            // Determine start value (default: 0, but can be 1 if specified)
-            int const start_value = item.value("start_value", 0);
+        std::cout << "Total of " << t.size() << " timestamps for " << name << std::endl;
 
-            int64_t max_index = -1;
+        return std::make_shared<TimeFrame>(t);
+    }
 
-            // Try to get max index from DigitalEventSeries
-            auto digital_event = dm->getData<DigitalEventSeries>(source_data_name);
-            if (digital_event) {
-                if (digital_event->size() > 0) {
-                    // Get the last (maximum) TimeFrameIndex
-                    auto last_event = *(digital_event->view().end() - 1);
-                    max_index = last_event.time().getValue();
-                    std::cout << "Found max TimeFrameIndex " << max_index
-                              << " in DigitalEventSeries '" << source_data_name << "'" << std::endl;
-                } else {
-                    std::cerr << "Error: DigitalEventSeries '" << source_data_name
-                              << "' is empty, cannot determine max value" << std::endl;
-                    continue;
-                }
-            }
+    if (item["format"] == "filename") {
 
-            // Try to get max index from AnalogTimeSeries if not found yet
-            if (max_index < 0) {
-                auto analog_series = dm->getData<AnalogTimeSeries>(source_data_name);
-                if (analog_series) {
-                    auto const & time_indices = analog_series->getTimeSeries();
-                    if (!time_indices.empty()) {
-                        max_index = time_indices.back().getValue();
-                        std::cout << "Found max TimeFrameIndex " << max_index
-                                  << " in AnalogTimeSeries '" << source_data_name << "'" << std::endl;
-                    } else {
-                        std::cerr << "Error: AnalogTimeSeries '" << source_data_name
-                                  << "' is empty, cannot determine max value" << std::endl;
-                        continue;
-                    }
-                }
-            }
+        // Get required parameters
+        std::string const & folder_path = file_path;// file path is required argument
+        std::string const regex_pattern = item["regex_pattern"];
 
-            // If still not found, report error
-            if (max_index < 0) {
-                std::cerr << "Error: Source data '" << source_data_name
-                          << "' not found or is not a DigitalEventSeries or AnalogTimeSeries" << std::endl;
-                std::cerr << "Make sure the source data is loaded before creating the TimeFrame" << std::endl;
-                continue;
-            }
+        // Get optional parameters with defaults
+        std::string const file_extension = item.value("file_extension", "");
+        std::string const mode_str = item.value("mode", "found_values");
+        bool const sort_ascending = item.value("sort_ascending", true);
 
-            // Create TimeFrame with values from start_value to max_index
-            std::vector<int> time_values;
-            int const num_values = static_cast<int>(max_index) - start_value + 1;
-            time_values.reserve(num_values);
-            for (int i = start_value; i <= static_cast<int>(max_index); ++i) {
-                time_values.push_back(i);
-            }
+        // Convert mode string to enum
+        FilenameTimeFrameMode mode = FilenameTimeFrameMode::FOUND_VALUES;
+        if (mode_str == "zero_to_max") {
+            mode = FilenameTimeFrameMode::ZERO_TO_MAX;
+        } else if (mode_str == "min_to_max") {
+            mode = FilenameTimeFrameMode::MIN_TO_MAX;
+        }
 
-            auto timeframe = std::make_shared<TimeFrame>(time_values);
-            dm->setTime(TimeKey(name), timeframe, true);
-            std::cout << "Created TimeFrame '" << name << "' with " << time_values.size()
-                      << " values [" << start_value << " to " << max_index << "]" << std::endl;
-
-            // Increment progress counter
-            current_item++;
-            if (progress_callback) {
-                std::string const message = "Created max_value TimeFrame: " + name;
-                bool const should_continue = progress_callback(current_item, total_items, message);
-                if (!should_continue) {
-                    std::cout << "Loading cancelled by user" << std::endl;
-                    return data_info_list;
-                }
-            }
-            continue;
+        FilenameTimeFrameOptions options;
+        options.folder_path = folder_path;
+        options.file_extension = file_extension;
+        options.regex_pattern = regex_pattern;
+        options.mode = mode;
+        options.sort_ascending = sort_ascending;
+
+        auto timeframe = createTimeFrameFromFilenames(options);
+        if (timeframe) {
+            std::cout << "Created TimeFrame '" << name << "' from filenames in "
+                      << folder_path << std::endl;
+        } else {
+            std::cerr << "Error: Failed to create TimeFrame from filenames for "
+                      << name << std::endl;
         }
+        return timeframe;
+    }
+
+    if (item["format"] == "multi_column_binary") {
+        // Load TimeFrame from multi-column binary CSV file
+        MultiColumnBinaryCSVTimeFrameOptions opts;
+        opts.filepath = file_path;
 
-        if (!checkRequiredFields(item, {"data_type", "name", "filepath"})) {
-            continue;// Exit if any required field is missing
+        // Parse optional fields from JSON
+        if (item.contains("header_lines_to_skip")) {
+            opts.header_lines_to_skip = rfl::Validator<int, rfl::Minimum<0>>(
+                    item["header_lines_to_skip"].get<int>());
+        }
+        if (item.contains("time_column")) {
+            opts.time_column = rfl::Validator<int, rfl::Minimum<0>>(
+                    item["time_column"].get<int>());
+        }
+        if (item.contains("delimiter")) {
+            opts.delimiter = item["delimiter"].get<std::string>();
+        }
+        if (item.contains("sampling_rate")) {
+            opts.sampling_rate = rfl::Validator<double, rfl::Minimum<0.0>>(
+                    item["sampling_rate"].get<double>());
         }
 
-        std::string const data_type_str = item["data_type"];
-        auto const data_type = stringToDataType(data_type_str);
-        if (data_type == DM_DataType::Unknown) {
-            std::cout << "Unknown data type: " << data_type_str << std::endl;
-            continue;
+        auto timeframe = load(opts);
+        if (timeframe) {
+            std::cout << "Created TimeFrame '" << name << "' from multi-column binary CSV "
+                      << "(sampling rate: " << opts.getSamplingRate() << " Hz)" << std::endl;
+        } else {
+            std::cerr << "Error: Failed to create TimeFrame from multi-column binary CSV for "
+                      << name << std::endl;
         }
+        return timeframe;
+    }
 
-        std::string const name = item["name"];
-        TimeKey const registration_time_key = resolveRegistrationTimeKey(dm, item, declared_clock_names);
+    return nullptr;
+}
 
-        auto file_exists = processFilePath(item["filepath"], base_path);
-        if (!file_exists) {
-            std::cout << "File does not exist: " << item["filepath"] << std::endl;
-            continue;
-        }
+/**
+ * @brief Read and parse the file(s) referenced by one JSON entry.
+ *
+ * Does not touch the DataManager, so it may run on a worker thread.
+ *
+ * @pre @p item is not a `transformations`, `derived` or `max_value` entry.
+ */
+StagedJsonEntry stageJsonFileEntry(json const & item, std::string const & base_path) {
+    StagedJsonEntry staged;
 
-        std::string const file_path = file_exists.value();
+    if (!checkRequiredFields(item, {"data_type", "name", "filepath"})) {
+        return staged;
+    }
 
-        switch (data_type) {
-            case DM_DataType::Video: {
-                saw_video_in_config = true;
-                auto media_data = MediaDataFactory::loadMediaData(data_type, file_path, item);
-                if (media_data) {
-                    auto item_key = item.value("name", "media");
-                    dm->setData<MediaData>(item_key, media_data, registration_time_key);
-                    recordLoadedFileSource(dm, item_key, file_path, item);
-                    data_info_list.push_back({name, "VideoData", ""});
-                } else {
-                    std::cerr << "Failed to load video data: " << file_path << std::endl;
-                }
-                break;
+    std::string const data_type_str = item["data_type"];
+    auto const data_type = stringToDataType(data_type_str);
+    if (data_type == DM_DataType::Unknown) {
+        std::cout << "Unknown data type: " << data_type_str << std::endl;
+        return staged;
+    }
+
+    std::string const name = item["name"];
+
+    auto file_exists = processFilePath(item["filepath"], base_path);
+    if (!file_exists) {
+        std::cout << "File does not exist: " << item["filepath"] << std::endl;
+        return staged;
+    }
+
+    staged.file_path = file_exists.value();
+    std::string const & file_path = staged.file_path;
+    staged.counted = true;
+
+    switch (data_type) {
+        case DM_DataType::Video: {
+            staged.saw_video = true;
+            auto media_data = MediaDataFactory::loadMediaData(data_type, file_path, item);
+            if (media_data) {
+                auto item_key = item.value("name", "media");
+                staged.objects.push_back({item_key, DataTypeVariant{media_data}, DataInfo{name, "VideoData", ""}});
+            } else {
+                std::cerr << "Failed to load video data: " << file_path << std::endl;
             }
+            break;
+        }
 #ifdef ENABLE_OPENCV
-            case DM_DataType::Images: {
-                auto media_data = MediaDataFactory::loadMediaData(data_type, file_path, item);
-                if (media_data) {
-                    auto item_key = item.value("name", "media");
-                    dm->setData<MediaData>(item_key, media_data, registration_time_key);
-                    recordLoadedFileSource(dm, item_key, file_path, item);
-                    data_info_list.push_back({name, "ImageData", ""});
-                } else {
-                    std::cerr << "Failed to load image data: " << file_path << std::endl;
-                }
-                break;
+        case DM_DataType::Images: {
+            auto media_data = MediaDataFactory::loadMediaData(data_type, file_path, item);
+            if (media_data) {
+                auto item_key = item.value("name", "media");
+                staged.objects.push_back({item_key, DataTypeVariant{media_data}, DataInfo{name, "ImageData", ""}});
+            } else {
+                std::cerr << "Failed to load image data: " << file_path << std::endl;
             }
+            break;
+        }
 #endif
-            case DM_DataType::Points: {
-
-                // Check if this is a DLC CSV format that needs special handling for multiple bodyparts
-                if (item.contains("format") && item["format"] == "dlc_csv") {
-                    auto multi_point_data = load_multiple_PointData_from_dlc(file_path, item);
-
-                    // For DLC data, let Media_Window assign colors automatically via getColorForIndex
-                    // Don't use a single color for all bodyparts
+        case DM_DataType::Points: {
 
-                    for (auto const & [bodypart, point_data]: multi_point_data) {
-                        std::string const bodypart_name = name + "_" + bodypart;
+            // Check if this is a DLC CSV format that needs special handling for multiple bodyparts
+            if (item.contains("format") && item["format"] == "dlc_csv") {
+                auto multi_point_data = load_multiple_PointData_from_dlc(file_path, item);
 
-                        dm->setData<PointData>(bodypart_name, point_data, registration_time_key);
-                        recordLoadedFileSource(dm, bodypart_name, file_path, item);
-                        // Use empty color string to let Media_Window auto-assign colors
-                        data_info_list.push_back({bodypart_name, "PointData", ""});
-                    }
-                    break;
-                }
-
-                // Use registry system for regular CSV point data
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, registration_time_key, data_info_list)) {
-                    break;// Successfully loaded with plugin
+                // For DLC data, let Media_Window assign colors automatically via getColorForIndex
+                for (auto const & [bodypart, point_data]: multi_point_data) {
+                    std::string const bodypart_name = name + "_" + bodypart;
+                    // Use empty color string to let Media_Window auto-assign colors
+                    staged.objects.push_back({bodypart_name, DataTypeVariant{point_data}, DataInfo{bodypart_name, "PointData", ""}});
                 }
+                break;
+            }
 
-                // If plugin loading failed, report the error
-                std::cerr << "Error: Failed to load PointData from " << file_path
-                          << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            // Use registry system for regular CSV point data
+            if (stageRegistryLoad(file_path, data_type, item, name, staged)) {
                 break;
             }
-            case DM_DataType::Mask: {
 
-                // Use registry system for all mask formats (hdf5, image)
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, registration_time_key, data_info_list)) {
-                    break;// Successfully loaded with plugin
-                }
+            std::cerr << "Error: Failed to load PointData from " << file_path
+                      << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            break;
+        }
+        case DM_DataType::Mask: {
 
-                // If plugin loading failed, report the error
-                std::cerr << "Error: Failed to load MaskData from " << file_path
-                          << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            // Use registry system for all mask formats (hdf5, image)
+            if (stageRegistryLoad(file_path, data_type, item, name, staged)) {
                 break;
             }
-            case DM_DataType::Line: {
 
-                // Use registry system for all line formats (csv, capnp, hdf5)
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, registration_time_key, data_info_list)) {
-                    break;// Successfully loaded with plugin
-                }
+            std::cerr << "Error: Failed to load MaskData from " << file_path
+                      << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            break;
+        }
+        case DM_DataType::Line: {
 
-                // If plugin loading failed, report the error
-                std::cerr << "Error: Failed to load LineData from " << file_path
-                          << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            // Use registry system for all line formats (csv, capnp, hdf5)
+            if (stageRegistryLoad(file_path, data_type, item, name, staged)) {
                 break;
             }
-            case DM_DataType::Analog: {
 
-                // Use batch loading for multi-channel binary files
-                // Format-centric loaders (BinaryFormatLoader, CSVLoader) handle all formats
-                if (tryBatchLoadFromRegistry(dm, file_path, data_type, item, name, registration_time_key)) {
-                    break;// Successfully loaded all channels with batch loader
-                }
+            std::cerr << "Error: Failed to load LineData from " << file_path
+                      << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            break;
+        }
+        case DM_DataType::Analog: {
 
-                // Try single-item registry loading for simple cases
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, registration_time_key, data_info_list)) {
-                    break;// Successfully loaded with plugin
-                }
+            // Use batch loading for multi-channel binary files
+            if (stageBatchLoadFromRegistry(file_path, data_type, item, name, staged)) {
+                break;
+            }
 
-                // If all loading methods failed, report the error
-                std::cerr << "Error: Failed to load AnalogTimeSeries from " << file_path
-                          << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            // Try single-item registry loading for simple cases
+            if (stageRegistryLoad(file_path, data_type, item, name, staged)) {
                 break;
             }
-            case DM_DataType::DigitalEvent: {
 
-                // Use batch loading for multi-series CSV files
-                // Format-centric loaders (BinaryFormatLoader, CSVLoader) handle all formats
-                if (tryBatchLoadFromRegistry(dm, file_path, data_type, item, name, registration_time_key)) {
-                    break;// Successfully loaded all series with batch loader
-                }
+            std::cerr << "Error: Failed to load AnalogTimeSeries from " << file_path
+                      << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            break;
+        }
+        case DM_DataType::DigitalEvent: {
 
-                // Try single-item registry loading for simple cases
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, registration_time_key, data_info_list)) {
-                    break;// Successfully loaded with plugin
-                }
+            // Use batch loading for multi-series CSV files
+            if (stageBatchLoadFromRegistry(file_path, data_type, item, name, staged)) {
+                break;
+            }
 
-                // If all loading methods failed, report the error
-                std::cerr << "Error: Failed to load DigitalEventSeries from " << file_path
-                          << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            if (stageRegistryLoad(file_path, data_type, item, name, staged)) {
                 break;
             }
-            case DM_DataType::DigitalInterval: {
 
-                // Try batch loading first for multi-column binary_state CSV files
-                if (tryBatchLoadFromRegistry(dm, file_path, data_type, item, name, registration_time_key)) {
-                    break;// Successfully loaded all series with batch loader
-                }
+            std::cerr << "Error: Failed to load DigitalEventSeries from " << file_path
+                      << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            break;
+        }
+        case DM_DataType::DigitalInterval: {
 
-                // Use registry system for all digital interval formats (uint16, csv, binary_state)
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, registration_time_key, data_info_list)) {
-                    break;// Successfully loaded with plugin
-                }
+            // Try batch loading first for multi-column binary_state CSV files
+            if (stageBatchLoadFromRegistry(file_path, data_type, item, name, staged)) {
+                break;
+            }
 
-                // If plugin loading failed, report the error
-                std::cerr << "Error: Failed to load DigitalIntervalSeries from " << file_path
-                          << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            // Use registry system for all digital interval formats (uint16, csv, binary_state)
+            if (stageRegistryLoad(file_path, data_type, item, name, staged)) {
                 break;
             }
-            case DM_DataType::Tensor: {
 
-                // Try loading through the IO registry (handles numpy via DataManagerNumpy)
-                if (tryRegistryThenLegacyLoad(dm, file_path, data_type, item, name, registration_time_key, data_info_list)) {
-                    break;
-                }
+            std::cerr << "Error: Failed to load DigitalIntervalSeries from " << file_path
+                      << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            break;
+        }
+        case DM_DataType::Tensor: {
 
-                std::cerr << "Error: Failed to load TensorData from " << file_path
-                          << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            // Try loading through the IO registry (handles numpy via DataManagerNumpy)
+            if (stageRegistryLoad(file_path, data_type, item, name, staged)) {
                 break;
             }
-            case DM_DataType::Time: {
 
-                if (item["format"] == "uint16") {
+            std::cerr << "Error: Failed to load TensorData from " << file_path
+                      << " - no suitable loader found for format: " << item.value("format", "unknown") << std::endl;
+            break;
+        }
+        case DM_DataType::Time: {
+            if (auto timeframe = loadTimeFrameEntry(item, file_path, name)) {
+                staged.time_frames.push_back({name, std::move(timeframe)});
+            }
+            break;
+        }
+        default:
+            std::cout << "Unsupported data type: " << data_type_str << std::endl;
+            staged.counted = false;
+            break;
+    }
 
-                    int const channel = item["channel"];
-                    std::string const transition = item["transition"];
+    return staged;
+}
 
-                    int const header_size = item.value("header_size", 0);
+/**
+ * @brief Register everything produced by stageJsonFileEntry() in @p dm.
+ *
+ * Also records a deferred clock binding when the entry's `clock` could not be
+ * used at registration time.
+ */
+void commitStagedJsonEntry(
+        DataManager * dm,
+        json const & item,
+        StagedJsonEntry const & staged,
+        std::unordered_set<std::string> const & declared_clock_names,
+        std::vector<DataInfo> & data_info_list,
+        std::map<std::string, std::string> & clock_mappings) {
+    if (!staged.counted) {
+        return;
+    }
 
-                    auto opts = Loader::BinaryAnalogOptions{.file_path = file_path,
-                                                            .header_size_bytes = static_cast<size_t>(header_size)};
-                    auto data = Loader::readBinaryFile<uint16_t>(opts);
+    std::string const name = item["name"];
+    TimeKey const registration_time_key = resolveRegistrationTimeKey(dm, item, declared_clock_names);
 
-                    auto digital_data = Loader::extractDigitalData(data, channel);
-                    auto events = Loader::extractEvents(digital_data, transition);
+    for (auto const & [key, time_frame]: staged.time_frames) {
+        dm->setTime(TimeKey(key), time_frame, true);
+    }
 
-                    // convert to int with std::transform
-                    std::vector<int> events_int;
-                    events_int.reserve(events.size());
-                    for (auto e: events) {
-                        events_int.push_back(static_cast<int>(e.getValue()));
-                    }
-                    std::cout << "Loaded " << events_int.size() << " events for " << name << std::endl;
+    for (auto const & object: staged.objects) {
+        dm->setData(object.key, object.data, registration_time_key);
+        recordLoadedFileSource(dm, object.key, staged.file_path, item);
+        if (object.info) {
+            data_info_list.push_back(*object.info);
+        }
+    }
 
-                    auto timeframe = std::make_shared<TimeFrame>(events_int);
-                    dm->setTime(TimeKey(name), timeframe, true);
-                }
+    if (item.contains("clock") && item["clock"].is_string()) {
+        std::string const clock_str = item["clock"].get<std::string>();
+        bool const skip_base_key = item.contains("format") && item["format"] == "dlc_csv";
+        if (!skip_base_key && dm->getTimeKey(name) != TimeKey(clock_str)) {
+            std::cout << "Deferring clock binding for " << name << " to " << clock_str << std::endl;
+            clock_mappings[name] = clock_str;
+        }
+    }
+}
 
-                if (item["format"] == "uint16_length") {
+/**
+ * @brief Create a TimeFrame from an already-loaded interval or event series (`format: "derived"`).
+ * @return true if the entry counts towards load progress.
+ */
+bool applyDerivedTimeFrameEntry(DataManager * dm, json const & item) {
+    if (!checkRequiredFields(item, {"data_type", "name"})) {
+        return false;
+    }
 
-                    int const header_size = item.value("header_size", 0);
+    std::string const data_type_str = item["data_type"];
+    if (data_type_str != "time") {
+        std::cerr << "Error: 'derived' format is only supported for 'time' data type" << std::endl;
+        return false;
+    }
 
-                    auto opts = Loader::BinaryAnalogOptions{.file_path = file_path,
-                                                            .header_size_bytes = static_cast<size_t>(header_size)};
-                    auto data = Loader::readBinaryFile<uint16_t>(opts);
+    std::string const name = item["name"];
 
-                    std::vector<int> t(data.size());
-                    std::iota(std::begin(t), std::end(t), 0);
+    // Get required source_timeframe parameter
+    if (!item.contains("source_timeframe")) {
+        std::cerr << "Error: 'derived' format requires 'source_timeframe' parameter" << std::endl;
+        return false;
+    }
+    std::string const source_timeframe_name = item["source_timeframe"];
+    auto source_timeframe = dm->getTime(TimeKey(source_timeframe_name));
+    if (!source_timeframe) {
+        std::cerr << "Error: Source timeframe '" << source_timeframe_name << "' not found. "
+                  << "Make sure it is loaded before the derived TimeFrame." << std::endl;
+        return false;
+    }
 
-                    std::cout << "Total of " << t.size() << " timestamps for " << name << std::endl;
+    std::shared_ptr<TimeFrame> derived_timeframe = nullptr;
+
+    // Determine the source series name and type
+    // Support two formats:
+    // 1. source_series + source_type (preferred)
+    // 2. interval_series or event_series as key names (legacy)
+    std::string series_name;
+    std::string series_type;
+
+    if (item.contains("source_series") && item.contains("source_type")) {
+        series_name = item["source_series"];
+        series_type = item["source_type"];
+    } else if (item.contains("interval_series")) {
+        series_name = item["interval_series"];
+        series_type = "interval";
+    } else if (item.contains("event_series")) {
+        series_name = item["event_series"];
+        series_type = "event";
+    } else {
+        std::cerr << "Error: 'derived' format requires either 'source_series'+'source_type' or "
+                  << "'interval_series'/'event_series' parameter" << std::endl;
+        return false;
+    }
 
-                    auto timeframe = std::make_shared<TimeFrame>(t);
-                    dm->setTime(TimeKey(name), timeframe, true);
-                }
+    // Normalize series_type to handle variants like "interval_series" -> "interval"
+    if (series_type == "interval_series" || series_type == "interval") {
+        auto interval_series = dm->getData<DigitalIntervalSeries>(series_name);
+        if (!interval_series) {
+            std::cerr << "Error: Interval series '" << series_name << "' not found. "
+                      << "Make sure it is loaded before the derived TimeFrame." << std::endl;
+            return false;
+        }
 
-                if (item["format"] == "filename") {
-
-                    // Get required parameters
-                    std::string const & folder_path = file_path;// file path is required argument
-                    std::string const regex_pattern = item["regex_pattern"];
-
-                    // Get optional parameters with defaults
-                    std::string const file_extension = item.value("file_extension", "");
-                    std::string const mode_str = item.value("mode", "found_values");
-                    bool const sort_ascending = item.value("sort_ascending", true);
-
-                    // Convert mode string to enum
-                    FilenameTimeFrameMode mode = FilenameTimeFrameMode::FOUND_VALUES;
-                    if (mode_str == "zero_to_max") {
-                        mode = FilenameTimeFrameMode::ZERO_TO_MAX;
-                    } else if (mode_str == "min_to_max") {
-                        mode = FilenameTimeFrameMode::MIN_TO_MAX;
-                    }
-
-                    // Create options
-                    FilenameTimeFrameOptions options;
-                    options.folder_path = folder_path;
-                    options.file_extension = file_extension;
-                    options.regex_pattern = regex_pattern;
-                    options.mode = mode;
-                    options.sort_ascending = sort_ascending;
-
-                    // Create TimeFrame from filenames
-                    auto timeframe = createTimeFrameFromFilenames(options);
-                    if (timeframe) {
-                        dm->setTime(TimeKey(name), timeframe, true);
-                        std::cout << "Created TimeFrame '" << name << "' from filenames in "
-                                  << folder_path << std::endl;
-                    } else {
-                        std::cerr << "Error: Failed to create TimeFrame from filenames for "
-                                  << name << std::endl;
-                    }
-                }
+        DerivedTimeFrameFromIntervalsOptions opts;
+        opts.source_timeframe = source_timeframe;
+        opts.interval_series = interval_series;
 
-                if (item["format"] == "multi_column_binary") {
-                    // Load TimeFrame from multi-column binary CSV file
-                    MultiColumnBinaryCSVTimeFrameOptions opts;
-                    opts.filepath = file_path;
-
-                    // Parse optional fields from JSON
-                    if (item.contains("header_lines_to_skip")) {
-                        opts.header_lines_to_skip = rfl::Validator<int, rfl::Minimum<0>>(
-                                item["header_lines_to_skip"].get<int>());
-                    }
-                    if (item.contains("time_column")) {
-                        opts.time_column = rfl::Validator<int, rfl::Minimum<0>>(
-                                item["time_column"].get<int>());
-                    }
-                    if (item.contains("delimiter")) {
-                        opts.delimiter = item["delimiter"].get<std::string>();
-                    }
-                    if (item.contains("sampling_rate")) {
-                        opts.sampling_rate = rfl::Validator<double, rfl::Minimum<0.0>>(
-                                item["sampling_rate"].get<double>());
-                    }
-
-                    auto timeframe = load(opts);
-                    if (timeframe) {
-                        dm->setTime(TimeKey(name), timeframe, true);
-                        std::cout << "Created TimeFrame '" << name << "' from multi-column binary CSV "
-                                  << "(sampling rate: " << opts.getSamplingRate() << " Hz)" << std::endl;
-                    } else {
-                        std::cerr << "Error: Failed to create TimeFrame from multi-column binary CSV for "
-                                  << name << std::endl;
-                    }
-                }
-                break;
-            }
-            default:
-                std::cout << "Unsupported data type: " << data_type_str << std::endl;
-                continue;
-        }
-        if (item.contains("clock") && item["clock"].is_string()) {
-            std::string const clock_str = item["clock"].get<std::string>();
-            bool const skip_base_key = item.contains("format") && item["format"] == "dlc_csv";
-            if (!skip_base_key && dm->getTimeKey(name) != TimeKey(clock_str)) {
-                std::cout << "Deferring clock binding for " << name << " to " << clock_str << std::endl;
-                clock_mappings[name] = clock_str;
+        // Get optional edge parameter (default: start)
+        std::string const edge_str = item.value("edge", "start");
+        if (edge_str == "end") {
+            opts.edge = IntervalEdge::END;
+        } else {
+            opts.edge = IntervalEdge::START;
+        }
+
+        derived_timeframe = createDerivedTimeFrame(opts);
+    } else if (series_type == "event_series" || series_type == "event") {
+        auto event_series = dm->getData<DigitalEventSeries>(series_name);
+        if (!event_series) {
+            std::cerr << "Error: Event series '" << series_name << "' not found. "
+                      << "Make sure it is loaded before the derived TimeFrame." << std::endl;
+            return false;
+        }
+
+        DerivedTimeFrameFromEventsOptions opts;
+        opts.source_timeframe = source_timeframe;
+        opts.event_series = event_series;
+
+        derived_timeframe = createDerivedTimeFrame(opts);
+    } else {
+        std::cerr << "Error: Unknown source_type '" << series_type << "'. "
+                  << "Use 'interval', 'interval_series', 'event', or 'event_series'." << std::endl;
+        return false;
+    }
+
+    if (derived_timeframe) {
+        dm->setTime(TimeKey(name), derived_timeframe, true);
+        std::cout << "Created derived TimeFrame '" << name << "'" << std::endl;
+    } else {
+        std::cerr << "Error: Failed to create derived TimeFrame for " << name << std::endl;
+    }
+    return true;
+}
+
+/**
+ * @brief Create a TimeFrame spanning `[start_value, max index]` of an already-loaded series (`format: "max_value"`).
+ * @return true if the entry counts towards load progress.
+ */
+bool applyMaxValueTimeFrameEntry(DataManager * dm, json const & item) {
+    if (!checkRequiredFields(item, {"data_type", "name"})) {
+        return false;
+    }
+
+    std::string const data_type_str = item["data_type"];
+    if (data_type_str != "time") {
+        std::cerr << "Error: 'max_value' format is only supported for 'time' data type" << std::endl;
+        return false;
+    }
+
+    std::string const name = item["name"];
+
+    // Get required source_data parameter
+    if (!item.contains("source_data")) {
+        std::cerr << "Error: 'max_value' format requires 'source_data' parameter" << std::endl;
+        return false;
+    }
+
+    std::string const source_data_name = item["source_data"];
+
+    // Determine start value (default: 0, but can be 1 if specified)
+    int const start_value = item.value("start_value", 0);
+
+    int64_t max_index = -1;
+
+    // Try to get max index from DigitalEventSeries
+    auto digital_event = dm->getData<DigitalEventSeries>(source_data_name);
+    if (digital_event) {
+        if (digital_event->size() > 0) {
+            // Get the last (maximum) TimeFrameIndex
+            auto last_event = *(digital_event->view().end() - 1);
+            max_index = last_event.time().getValue();
+            std::cout << "Found max TimeFrameIndex " << max_index
+                      << " in DigitalEventSeries '" << source_data_name << "'" << std::endl;
+        } else {
+            std::cerr << "Error: DigitalEventSeries '" << source_data_name
+                      << "' is empty, cannot determine max value" << std::endl;
+            return false;
+        }
+    }
+
+    // Try to get max index from AnalogTimeSeries if not found yet
+    if (max_index < 0) {
+        auto analog_series = dm->getData<AnalogTimeSeries>(source_data_name);
+        if (analog_series) {
+            auto const & time_indices = analog_series->getTimeSeries();
+            if (!time_indices.empty()) {
+                max_index = time_indices.back().getValue();
+                std::cout << "Found max TimeFrameIndex " << max_index
+                          << " in AnalogTimeSeries '" << source_data_name << "'" << std::endl;
+            } else {
+                std::cerr << "Error: AnalogTimeSeries '" << source_data_name
+                          << "' is empty, cannot determine max value" << std::endl;
+                return false;
             }
         }
+    }
 
-        // Increment progress counter
-        current_item++;
+    // If still not found, report error
+    if (max_index < 0) {
+        std::cerr << "Error: Source data '" << source_data_name
+                  << "' not found or is not a DigitalEventSeries or AnalogTimeSeries" << std::endl;
+        std::cerr << "Make sure the source data is loaded before creating the TimeFrame" << std::endl;
+        return false;
+    }
 
-        // Report progress after loading this item
-        if (progress_callback) {
-            std::string const message = "Loaded " + data_type_str + ": " + name;
-            bool const should_continue = progress_callback(current_item, total_items, message);
-            if (!should_continue) {
-                std::cout << "Loading cancelled by user" << std::endl;
-                return data_info_list;
+    // Create TimeFrame with values from start_value to max_index
+    std::vector<int> time_values;
+    int const num_values = static_cast<int>(max_index) - start_value + 1;
+    time_values.reserve(num_values);
+    for (int i = start_value; i <= static_cast<int>(max_index); ++i) {
+        time_values.push_back(i);
+    }
+
+    auto timeframe = std::make_shared<TimeFrame>(time_values);
+    dm->setTime(TimeKey(name), timeframe, true);
+    std::cout << "Created TimeFrame '" << name << "' with " << time_values.size()
+              << " values [" << start_value << " to " << max_index << "]" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Top-level JSON state shared by the sequential and parallel loaders.
+ */
+struct PreparedJsonLoad {
+    json resolved;///< owns the array when variable substitution is applied
+    bool use_resolved{false};
+    std::vector<std::string> declared_clocks;
+    std::unordered_set<std::string> declared_clock_names;
+
+    [[nodiscard]] json const & working(json const & original) const {
+        return use_resolved ? resolved : original;
+    }
+};
+
+/**
+ * @brief Apply the `python`, `variables`, `loops` and `clocks` top-level blocks.
+ * @return false if loading must stop (errors are already reported).
+ */
+bool prepareJsonLoad(DataManager * dm, json const & j, PreparedJsonLoad & prepared) {
+    // Support the extended format where the root is an object rather than a plain array:
+    //
+    //   {
+    //     "variables": { "local": "/data/raw", "shared": "/mnt/shared" },
+    //     "data": [ { "filepath": "${local}/video.mp4", ... }, ... ]
+    //   }
+    //
+    // A plain JSON array is accepted unchanged (backward-compatible).
+    if (j.is_object() && j.contains("data") && j["data"].is_array()) {
+        if (j.contains("python")) {
+            auto & configurator = jsonPythonEnvironmentConfigurator();
+            if (!configurator) {
+                std::cerr << "Error: JSON contains a top-level 'python' block, but no Python environment configurator is registered." << std::endl;
+                return false;
+            }
+
+            std::string error_message;
+            if (!configurator(j["python"], error_message)) {
+                std::cerr << "Error: Failed to configure Python environment for JSON loading: "
+                          << error_message << std::endl;
+                return false;
+            }
+        }
+
+        std::map<std::string, std::string> variables;
+        if (j.contains("variables") && j["variables"].is_object()) {
+            for (auto const & [k, v]: j["variables"].items()) {
+                if (v.is_string()) {
+                    variables[k] = v.get<std::string>();
+                }
             }
         }
+        json data_array = j["data"];
+        if (j.contains("loops")) {
+            data_array = expandDataArrayLoops(data_array, j["loops"]);
+        }
+        // Always run substitution: inline variables take priority, env vars are the fallback
+        auto data_str = data_array.dump();
+        data_str = substituteVariablesInJsonString(data_str, variables);
+        prepared.resolved = json::parse(data_str);
+        prepared.use_resolved = true;
+    }
+
+    if (j.is_object() && j.contains("clocks")) {
+        if (!parseDeclaredClockNames(j["clocks"], prepared.declared_clocks)) {
+            return false;
+        }
+        if (!registerDeclaredClocks(dm, prepared.declared_clocks)) {
+            return false;
+        }
+        prepared.declared_clock_names.insert(prepared.declared_clocks.begin(), prepared.declared_clocks.end());
     }
+    return true;
+}
 
+/**
+ * @brief Bind deferred clocks, validate declared clocks, run `transformations` blocks.
+ */
+void finishJsonLoad(
+        DataManager * dm,
+        json const & working,
+        PreparedJsonLoad const & prepared,
+        std::map<std::string, std::string> const & clock_mappings,
+        bool saw_video_in_config) {
     for (auto const & [data_name, clock_name]: clock_mappings) {
         std::cout << "Data item '" << data_name << "' is mapped to clock '" << clock_name << "'" << std::endl;
         if (!dm->setTimeKey(data_name, TimeKey(clock_name))) {
             std::cerr << "Error: Failed to bind data item '" << data_name << "' to clock '" << clock_name << "'"
                       << std::endl;
-            return data_info_list;
+            return;
         }
     }
 
-    if (!declared_clocks.empty() && !validateDeclaredClocks(*dm, declared_clocks)) {
-        return data_info_list;
+    if (!prepared.declared_clocks.empty() && !validateDeclaredClocks(*dm, prepared.declared_clocks)) {
+        return;
     }
 
     // Process all transformation objects found in the JSON array
@@ -1848,10 +1789,275 @@ std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const &
                 "JSON config included video entries but no media with frames was loaded; "
                 "default 'time' TimeFrame remains empty. Check file paths, ENABLE_FFMPEG, and decoder output.");
     }
+}
+
+/**
+ * @brief Run an entry that derives a TimeFrame from loaded data, or report false if @p item is not one.
+ * @param[out] counted Whether the entry counts towards load progress.
+ */
+bool tryApplyInMemoryTimeFrameEntry(DataManager * dm, json const & item, bool & counted) {
+    if (item.contains("format") && item["format"] == "derived") {
+        counted = applyDerivedTimeFrameEntry(dm, item);
+        return true;
+    }
+    if (item.contains("format") && item["format"] == "max_value") {
+        counted = applyMaxValueTimeFrameEntry(dm, item);
+        return true;
+    }
+    return false;
+}
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}// namespace
+
+std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const & j, std::string const & base_path, JsonLoadProgressCallback const & progress_callback) {
+    std::vector<DataInfo> data_info_list;
+
+    std::map<std::string, std::string> clock_mappings;
+    bool saw_video_in_config = false;
+
+    PreparedJsonLoad prepared;
+    if (!prepareJsonLoad(dm, j, prepared)) {
+        return data_info_list;
+    }
+
+    json const & working = prepared.working(j);
+
+    // Count total items to load (excluding transformations which are processed separately)
+    int total_items = 0;
+    for (auto const & item: working) {
+        if (!item.contains("transformations")) {
+            total_items++;
+        }
+    }
+
+    // Report initial progress to show the dialog immediately
+    if (progress_callback) {
+        bool const should_continue = progress_callback(0, total_items, "Preparing to load data...");
+        if (!should_continue) {
+            std::cout << "Loading cancelled by user" << std::endl;
+            return data_info_list;
+        }
+    }
+
+    int current_item = 0;
+
+    std::cout << "getting ready to iterate through " << total_items << " items" << std::endl;
+
+    for (auto const & item: working) {
+
+        // Skip transformation objects - they will be processed separately
+        if (item.contains("transformations")) {
+            continue;
+        }
+
+        std::string message;
+        bool counted = false;
+        if (tryApplyInMemoryTimeFrameEntry(dm, item, counted)) {
+            message = "Created " + item["format"].get<std::string>() + " TimeFrame: " + item.value("name", std::string{});
+        } else {
+            auto const staged = stageJsonFileEntry(item, base_path);
+            saw_video_in_config = saw_video_in_config || staged.saw_video;
+            commitStagedJsonEntry(dm, item, staged, prepared.declared_clock_names, data_info_list, clock_mappings);
+            counted = staged.counted;
+            if (counted) {
+                message = "Loaded " + item["data_type"].get<std::string>() + ": " + item["name"].get<std::string>();
+            }
+        }
+
+        if (!counted) {
+            continue;
+        }
+
+        current_item++;
+        if (progress_callback) {
+            bool const should_continue = progress_callback(current_item, total_items, message);
+            if (!should_continue) {
+                std::cout << "Loading cancelled by user" << std::endl;
+                return data_info_list;
+            }
+        }
+    }
+
+    finishJsonLoad(dm, working, prepared, clock_mappings, saw_video_in_config);
 
     return data_info_list;
 }
 
+JsonLoadReport load_data_from_json_config_parallel(DataManager * dm, json const & j, std::string const & base_path, JsonParallelLoadOptions const & options) {
+    auto const load_start = std::chrono::steady_clock::now();
+    JsonLoadReport report;
+
+    std::map<std::string, std::string> clock_mappings;
+    bool saw_video_in_config = false;
+
+    PreparedJsonLoad prepared;
+    if (!prepareJsonLoad(dm, j, prepared)) {
+        return report;
+    }
+
+    json const & working = prepared.working(j);
+    JsonLoadGraph const graph = buildJsonLoadGraph(working);
+    if (graph.has_cycle) {
+        std::cerr << "Warning: JSON load entries have circular dependencies; "
+                  << "entries in the cycle are committed in config order" << std::endl;
+    }
+
+    int const total_items = static_cast<int>(graph.commit_order.size());
+    if (options.progress_callback && !options.progress_callback(0, total_items, "Preparing to load data...")) {
+        std::cout << "Loading cancelled by user" << std::endl;
+        return report;
+    }
+
+    // Stage every independent file-backed entry up front. In-memory TimeFrame
+    // entries and formats pinned to the calling thread run during the commit pass.
+    std::unique_ptr<CoreUtilities::ThreadPool> own_pool;
+    if (options.max_threads > 0) {
+        own_pool = std::make_unique<CoreUtilities::ThreadPool>(options.max_threads);
+    }
+    CoreUtilities::ThreadPool & pool = own_pool ? *own_pool : CoreUtilities::ThreadPool::shared();
+
+    struct TimedStage {
+        StagedJsonEntry staged;
+        double load_ms{0.0};
+    };
+    std::vector<std::optional<std::future<TimedStage>>> pending(working.size());
+
+    // Workers reference `working` and `base_path`: wait for every submitted
+    // read on all exit paths, including a throwing commit or progress callback.
+    struct PendingStagesGuard {
+        std::vector<std::optional<std::future<TimedStage>>> & stages;
+        ~PendingStagesGuard() {
+            for (auto & stage: stages) {
+                if (stage && stage->valid()) {
+                    stage->wait();
+                }
+            }
+        }
+    } const pending_guard{pending};
+
+    for (auto const index: graph.commit_order) {
+        auto const & node = graph.nodes[index];
+        auto const & item = working[index];
+        bool const pinned = item.contains("format") && item["format"].is_string() &&
+                            options.main_thread_formats.contains(item["format"].get<std::string>());
+        if (node.kind == JsonLoadEntryKind::DerivedTimeFrame || pinned) {
+            continue;
+        }
+        pending[index] = pool.submit([&item, &base_path] {
+            auto const start = std::chrono::steady_clock::now();
+            TimedStage result{stageJsonFileEntry(item, base_path)};
+            result.load_ms = elapsedMs(start);
+            return result;
+        });
+    }
+
+    // Commit in dependency order (ties broken by config position) so the
+    // resulting DataManager state does not depend on thread scheduling.
+    int current_item = 0;
+    bool cancelled = false;
+    for (auto const index: graph.commit_order) {
+        auto const & node = graph.nodes[index];
+        auto const & item = working[index];
+
+        JsonLoadEntryTiming timing;
+        timing.index = index;
+        timing.name = node.name;
+        timing.data_type = item.value("data_type", std::string{});
+
+        TimedStage stage;
+        bool in_memory_counted = false;
+        bool in_memory = false;
+        if (pending[index]) {
+            // Every submitted future is collected here, even after cancellation or a
+            // failed entry, so no worker outlives the JSON it references.
+            try {
+                stage = pending[index]->get();
+            } catch (std::exception const & e) {
+                std::cerr << "Error: Failed to load '" << node.name << "': " << e.what() << std::endl;
+            }
+        } else if (!cancelled) {
+            auto const start = std::chrono::steady_clock::now();
+            try {
+                in_memory = tryApplyInMemoryTimeFrameEntry(dm, item, in_memory_counted);
+                if (!in_memory) {
+                    stage.staged = stageJsonFileEntry(item, base_path);
+                }
+            } catch (std::exception const & e) {
+                std::cerr << "Error: Failed to load '" << node.name << "': " << e.what() << std::endl;
+                in_memory = false;
+                stage.staged = StagedJsonEntry{};
+            }
+            stage.load_ms = elapsedMs(start);
+        }
+        if (cancelled) {
+            // Drain outstanding work; staged results are discarded.
+            continue;
+        }
+
+        auto const commit_start = std::chrono::steady_clock::now();
+        bool commit_failed = false;
+        if (!in_memory) {
+            saw_video_in_config = saw_video_in_config || stage.staged.saw_video;
+            try {
+                commitStagedJsonEntry(dm, item, stage.staged, prepared.declared_clock_names, report.data_info, clock_mappings);
+            } catch (std::exception const & e) {
+                std::cerr << "Error: Failed to register '" << node.name << "': " << e.what() << std::endl;
+                commit_failed = true;
+            }
+        }
+        timing.load_ms = stage.load_ms;
+        timing.commit_ms = elapsedMs(commit_start);
+        timing.success = in_memory ? in_memory_counted
+                                   : (!commit_failed && stage.staged.counted &&
+                                      (!stage.staged.objects.empty() || !stage.staged.time_frames.empty()));
+        report.timings.push_back(timing);
+
+        bool const counted = in_memory ? in_memory_counted : stage.staged.counted;
+        if (!counted) {
+            continue;
+        }
+        current_item++;
+        if (options.progress_callback) {
+            std::string const message = "Loaded " + timing.data_type + ": " + timing.name;
+            if (!options.progress_callback(current_item, total_items, message)) {
+                std::cout << "Loading cancelled by user" << std::endl;
+                cancelled = true;
+            }
+        }
+    }
+
+    if (!cancelled) {
+        finishJsonLoad(dm, working, prepared, clock_mappings, saw_video_in_config);
+    }
+
+    report.total_ms = elapsedMs(load_start);
+    for (auto const & timing: report.timings) {
+        spdlog::debug("JSON load '{}' ({}): load {:.1f} ms, commit {:.1f} ms{}",
+                      timing.name, timing.data_type, timing.load_ms, timing.commit_ms,
+                      timing.success ? "" : " [failed]");
+    }
+    spdlog::info("Loaded {} JSON entries in {:.1f} ms", report.timings.size(), report.total_ms);
+    return report;
+}
+
+JsonLoadReport load_data_from_json_config_parallel(DataManager * dm, std::string const & json_filepath, JsonParallelLoadOptions const & options) {
+    std::ifstream ifs(json_filepath);
+    if (!ifs.is_open()) {
+        std::cerr << "Failed to open JSON file: " << json_filepath << std::endl;
+        return {};
+    }
+
+    json j;
+    ifs >> j;
+
+    std::string const base_path = std::filesystem::path(json_filepath).parent_path().string();
+    return load_data_from_json_config_parallel(dm, j, base_path, options);
+}
+
 std::vector<DataInfo> load_data_from_json_config(DataManager * dm, json const & j, std::string const & base_path) {
     // Call the version with progress callback, passing nullptr
     return load_data_from_json_config(dm, j, base_path, nullptr);
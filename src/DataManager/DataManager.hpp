@@ -12,6 +12,7 @@
 #include <functional>   // std::function
 #include <memory>       // std::shared_ptr
 #include <optional>     // std::optional
+#include <set>          // std::set
 #include <string>       // std::string
 #include <unordered_map>// std::unordered_map
 #include <variant>      // std::variant
@@ -465,6 +466,56 @@ std::vector<DataInfo> load_data_from_json_config(DataManager *, std::string cons
 std::vector<DataInfo> load_data_from_json_config(DataManager * dm, nlohmann::json const & j, std::string const & base_path);
 std::vector<DataInfo> load_data_from_json_config(DataManager * dm, nlohmann::json const & j, std::string const & base_path, JsonLoadProgressCallback const & progress_callback);
 
+/**
+ * @brief Wall-clock timing of one entry loaded by load_data_from_json_config_parallel().
+ */
+struct JsonLoadEntryTiming {
+    std::size_t index{0};  ///< Position in the (loop-expanded) data array
+    std::string name;
+    std::string data_type;
+    double load_ms{0.0};   ///< File reading and parsing (worker thread)
+    double commit_ms{0.0}; ///< Registration in the DataManager (calling thread)
+    bool success{false};   ///< At least one object or TimeFrame was produced
+};
+
+/**
+ * @brief Options for load_data_from_json_config_parallel().
+ */
+struct JsonParallelLoadOptions {
+    /// Worker threads; 0 uses the process-wide CoreUtilities::ThreadPool::shared().
+    std::size_t max_threads{0};
+    /// Formats whose loaders must run on the calling thread: loaders that take the
+    /// Python GIL (spike2) and HDF5, whose library is not built thread-safe.
+    std::set<std::string> main_thread_formats{"spike2", "hdf5"};
+    JsonLoadProgressCallback progress_callback;
+};
+
+/**
+ * @brief Result of load_data_from_json_config_parallel().
+ */
+struct JsonLoadReport {
+    std::vector<DataInfo> data_info;
+    std::vector<JsonLoadEntryTiming> timings;///< In commit order
+    double total_ms{0.0};
+};
+
+/**
+ * @brief Load a JSON data config, reading independent files concurrently.
+ *
+ * Accepts the same configs as load_data_from_json_config(). File-backed entries
+ * are read and parsed on a thread pool; entries are then registered on the
+ * calling thread in dependency order (`clock`, `source_timeframe`,
+ * `source_series`, `source_data` ...), breaking ties by config position, so the
+ * resulting DataManager state does not depend on thread scheduling. Derived
+ * TimeFrames and @ref JsonParallelLoadOptions::main_thread_formats are
+ * processed on the calling thread when their turn comes.
+ *
+ * Cancelling through the progress callback stops registration; in-flight reads
+ * are awaited and discarded before returning.
+ */
+JsonLoadReport load_data_from_json_config_parallel(DataManager * dm, nlohmann::json const & j, std::string const & base_path, JsonParallelLoadOptions const & options = {});
+JsonLoadReport load_data_from_json_config_parallel(DataManager * dm, std::string const & json_filepath, JsonParallelLoadOptions const & options = {});
+
 std::string convert_data_type_to_string(DM_DataType type);
 
 
@@ -1,6 +1,7 @@
 #include "analog_hilbert_phase.hpp"
 
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "CoreMath/analytic_signal.hpp"
 #include "transforms/utils/variant_type_check.hpp"
 #include "utils/armadillo_wrap/analog_armadillo.hpp"
 #include "utils/filter/FilterFactory.hpp"
@@ -12,6 +13,7 @@
 #include <iostream>
 #include <numbers>
 #include <numeric>//std::iota
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -310,9 +312,12 @@ std::vector<float> applyHilbertTransform(
      * @brief Processes a single continuous chunk using Hilbert transform
      * @param chunk The data chunk to process
      * @param phaseParams Parameters for the calculation
+     * @param streaming Overlap-save engine shared by all chunks (Method::OverlapSave only)
      * @return Vector of phase or amplitude values for this chunk depending on outputType
      */
-std::vector<float> processChunk(DataChunk const & chunk, HilbertPhaseParams const & phaseParams) {
+std::vector<float> processChunk(DataChunk const & chunk,
+                                HilbertPhaseParams const & phaseParams,
+                                OverlapSaveHilbert const * streaming) {
     if (chunk.values.empty()) {
         return {};
     }
@@ -345,7 +350,20 @@ std::vector<float> processChunk(DataChunk const & chunk, HilbertPhaseParams cons
     
     std::vector<float> result_values;
     
-    if (useWindowedProcessing) {
+    if (streaming != nullptr) {
+        // Block-streaming FIR Hilbert: blocks are independent, so no windowing or edge discard is needed
+        if (filter) {
+            std::cout << "  Applying " << filter->getName() << " bandpass filter" << std::endl;
+            filter->reset();
+            filter->process(std::span<float>(clean_values.data(), clean_values.size()));
+        }
+        auto const component = phaseParams.outputType == HilbertPhaseParams::OutputType::Phase
+                                       ? AnalyticSignalComponent::Phase
+                                       : AnalyticSignalComponent::Amplitude;
+        result_values.resize(clean_values.size());
+        streaming->extract(clean_values, component, result_values);
+
+    } else if (useWindowedProcessing) {
         // Split into overlapping sub-chunks
         std::cout << "  Using windowed processing with " << phaseParams.maxChunkSize 
                   << " samples per window, " << (phaseParams.overlapFraction * 100.0) << "% overlap" << std::endl;
@@ -496,13 +514,20 @@ std::shared_ptr<AnalogTimeSeries> hilbert_phase(
         output_times.push_back(TimeFrameIndex(static_cast<int64_t>(i)));
     }
 
+    // The overlap-save engine (FFT plan and kernel spectrum) is built once and reused for every chunk
+    std::optional<OverlapSaveHilbert> streaming;
+    if (phaseParams.method == HilbertPhaseParams::Method::OverlapSave) {
+        streaming.emplace(AnalyticSignalOptions{.kernel_half_width = phaseParams.hilbertKernelHalfWidth,
+                                                .fft_size = phaseParams.fftBlockSize});
+    }
+
     // Process each chunk
     size_t total_chunks = chunks.size();
     for (size_t i = 0; i < chunks.size(); ++i) {
         auto const & chunk = chunks[i];
 
         // Process chunk
-        auto chunk_phase = processChunk(chunk, phaseParams);
+        auto chunk_phase = processChunk(chunk, phaseParams, streaming ? &*streaming : nullptr);
 
         // Copy chunk results to output
         if (!chunk_phase.empty()) {
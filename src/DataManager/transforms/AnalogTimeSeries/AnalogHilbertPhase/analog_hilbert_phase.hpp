@@ -17,6 +17,15 @@ struct HilbertPhaseParams : public TransformParametersBase {
 
     size_t discontinuityThreshold = 1000;// Gap size (in samples) above which to split processing into chunks
     OutputType outputType = OutputType::Phase; // What to extract from the Hilbert transform
+
+    enum class Method {
+        FFT,        // Whole-chunk FFT (split into windowed sub-chunks above maxChunkSize)
+        OverlapSave // Streaming FIR Hilbert with fixed-size FFT blocks processed in parallel
+    };
+
+    Method method = Method::FFT;
+    size_t hilbertKernelHalfWidth = 1024;// FIR Hilbert taps on each side (OverlapSave only)
+    size_t fftBlockSize = 8192;          // FFT length per block, power of two (OverlapSave only)
     
     // Windowed processing parameters for long signals
     size_t maxChunkSize = 100000;        // Maximum samples per chunk (0 = no limit, process entire signal)
@@ -6,10 +6,84 @@
 #include "CoreGeometry/line_geometry.hpp"
 #include "transforms/utils/variant_type_check.hpp"
 
+#include "CoreUtilities/thread_pool.hpp"
+#include "SpatialIndex/RTree.hpp"
+
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <map>
+#include <optional>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
+
+namespace {
+
+/// Ungrouped lines matched per parallel chunk
+constexpr std::size_t kGroupingChunkSize = 1024;
+
+/**
+ * @brief Spatial summary of existing groups: one R-tree entry per member sample point
+ *
+ * Candidates are pruned to the square of half-width max_distance around the
+ * query before exact distances are compared. Ties go to the group listed first
+ * by EntityGroupManager::getAllGroupIds(), as in findClosestGroup().
+ */
+class LineGroupIndex {
+public:
+    LineGroupIndex(std::vector<std::pair<Point2D<float>, GroupId>> const & member_points,
+                   std::vector<GroupId> const & group_ids) {
+        std::unordered_map<GroupId, std::size_t> group_order;
+        for (std::size_t i = 0; i < group_ids.size(); ++i) {
+            group_order.emplace(group_ids[i], i);
+        }
+        _group_ids = group_ids;
+        for (auto const & [point, group_id] : member_points) {
+            auto it = group_order.find(group_id);
+            if (it != group_order.end()) {
+                _tree.insert(point.x, point.y, point.x, point.y, it->second);
+            }
+        }
+    }
+
+    /**
+     * @return {GroupId, distance} of the nearest member within max_distance,
+     *         or {0, max float} if there is none
+     */
+    [[nodiscard]] std::pair<GroupId, float> findClosestGroup(Point2D<float> point, float max_distance) const {
+        std::pair<GroupId, float> best{0, std::numeric_limits<float>::max()};
+        if (!(max_distance >= 0.0f)) {
+            return best;
+        }
+
+        std::vector<RTreeEntry<std::size_t> const *> candidates;
+        _tree.queryPointers(BoundingBox(point.x - max_distance, point.y - max_distance,
+                                        point.x + max_distance, point.y + max_distance),
+                            candidates);
+
+        std::size_t best_order = std::numeric_limits<std::size_t>::max();
+        for (auto const * entry : candidates) {
+            float const dx = point.x - entry->min_x;
+            float const dy = point.y - entry->min_y;
+            float const distance = std::sqrt(dx * dx + dy * dy);
+            if (distance > max_distance) {
+                continue;
+            }
+            if (distance < best.second || (distance == best.second && entry->data < best_order)) {
+                best = {_group_ids[entry->data], distance};
+                best_order = entry->data;
+            }
+        }
+        return best;
+    }
+
+private:
+    RTree<std::size_t> _tree;
+    std::vector<GroupId> _group_ids;
+};
+
+}// namespace
 
 float calculateLineDistance(Line2D const& line1, Line2D const& line2, float position) {
     // Get points at the specified position along each line
@@ -73,16 +147,28 @@ std::shared_ptr<LineData> lineProximityGrouping(std::shared_ptr<LineData> line_d
     }
     
     auto group_manager = params->getGroupManager();
+    float const position = params->position_along_line;
     
-    
-    // Find entities that are not in any group
-    std::unordered_set<EntityId> ungrouped_entities;
+    // Sample every line once; grouped lines feed the index, ungrouped ones are queried.
+    // flattened_data() is time ordered, so contiguous chunks below are time chunks.
+    std::vector<EntityId> ungrouped_entities;
+    std::vector<std::optional<Point2D<float>>> ungrouped_points;
+    std::vector<std::pair<Point2D<float>, GroupId>> member_points;
+    std::unordered_set<EntityId> seen;
     for (auto const & [time, entity_id, line_cref]: line_data->flattened_data()) {
         (void)time;
-        (void)line_cref;
+        if (!seen.insert(entity_id).second) {
+            continue;
+        }
         auto groups_containing_entity = group_manager->getGroupsContainingEntity(entity_id);
+        auto point = point_at_fractional_position(line_cref.get(), position, true);
         if (groups_containing_entity.empty()) {
-            ungrouped_entities.insert(entity_id);
+            ungrouped_entities.push_back(entity_id);
+            ungrouped_points.push_back(point);
+        } else if (point.has_value()) {
+            for (auto group_id : groups_containing_entity) {
+                member_points.emplace_back(point.value(), group_id);
+            }
         }
     }
     
@@ -92,39 +178,47 @@ std::shared_ptr<LineData> lineProximityGrouping(std::shared_ptr<LineData> line_d
         return line_data;  // Return the same shared_ptr
     }
     
-    // Process each ungrouped entity
-    std::vector<EntityId> outliers;
-    size_t processed = 0;
-    size_t total = ungrouped_entities.size();
+    progressCallback(10);
     
-    for (auto entity_id : ungrouped_entities) {
-        progressCallback(static_cast<int>((processed * 100) / total));
-        
-        auto line_opt = line_data->getDataByEntityId(entity_id);
-        if (!line_opt.has_value()) {
-            ++processed;
-            continue;
+    LineGroupIndex const index(member_points, group_manager->getAllGroupIds());
+    
+    progressCallback(20);
+    
+    // Match against the groups as they were on entry, so the result does not
+    // depend on chunk scheduling
+    std::vector<GroupId> assignments(ungrouped_entities.size(), 0);
+    CoreUtilities::parallelForChunks(0, ungrouped_entities.size(), kGroupingChunkSize,
+                                     [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+            if (ungrouped_points[i].has_value()) {
+                assignments[i] = index.findClosestGroup(ungrouped_points[i].value(),
+                                                        params->distance_threshold).first;
+            }
         }
-        
-        auto [closest_group_id, min_distance] = findClosestGroup(
-            line_opt.value(), line_data.get(), group_manager, params->position_along_line);
-        
-        if (closest_group_id != 0 && min_distance <= params->distance_threshold) {
-            // Add to the closest group
-            group_manager->addEntityToGroup(closest_group_id, entity_id);
+    });
+    
+    progressCallback(90);
+    
+    // Deterministic merge: batch additions per group in input order
+    std::map<GroupId, std::vector<EntityId>> additions;
+    std::vector<EntityId> outliers;
+    for (std::size_t i = 0; i < ungrouped_entities.size(); ++i) {
+        if (assignments[i] != 0) {
+            additions[assignments[i]].push_back(ungrouped_entities[i]);
         } else {
             // This entity doesn't fit any existing group
-            outliers.push_back(entity_id);
+            outliers.push_back(ungrouped_entities[i]);
         }
-        
-        ++processed;
+    }
+    for (auto const & [group_id, entity_ids] : additions) {
+        (void)group_manager->addEntitiesToGroup(group_id, entity_ids);
     }
     
     // Handle outliers if requested
     if (!outliers.empty() && params->create_new_group_for_outliers) {
         auto new_group_id = group_manager->createGroup(params->new_group_name, 
             "Automatically created group for lines that don't fit existing groups");
-        group_manager->addEntitiesToGroup(new_group_id, outliers);
+        (void)group_manager->addEntitiesToGroup(new_group_id, outliers);
     }
     
     progressCallback(100);
@@ -60,6 +60,13 @@ std::pair<GroupId, float> findClosestGroup(Line2D const& target_line,
  * group is found and create_new_group_for_outliers is true, a new group
  * will be created for outliers.
  * 
+ * Each line is sampled once at position_along_line. The sample points of the
+ * existing group members are kept in an R-tree, so only members inside the
+ * threshold square are compared exactly. Ungrouped lines are matched in
+ * parallel time chunks against the groups as they were on entry (lines added
+ * during the call do not attract other lines), and the group additions are
+ * merged in time order, so the result does not depend on thread count.
+ * 
  * @param line_data The LineData to process
  * @param params Parameters including distance threshold and grouping options
  * @return The same LineData shared_ptr (operation is performed in-place on groups)
@@ -7,6 +7,9 @@
 #include "Lines/Line_Data.hpp"
 #include "Entity/EntityGroupManager.hpp"
 
+#include <algorithm>
+#include <vector>
+
 TEST_CASE_METHOD(DataManagerTestFixture, "Data Transform: LineProximityGrouping - Basic functionality", "[LineProximityGrouping]") {
 
     auto& dm = getDataManager();
@@ -99,4 +102,64 @@ TEST_CASE("Data Transform: LineProximityGrouping - Distance calculation", "[Line
         float distance = calculateLineDistance(empty_line, valid_line, 0.5f);
         REQUIRE(distance == std::numeric_limits<float>::max());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE_METHOD(DataManagerTestFixture, "Data Transform: LineProximityGrouping - Existing groups", "[LineProximityGrouping]") {
+
+    auto& dm = getDataManager();
+    auto* group_manager = dm.getEntityGroupManager();
+
+    // Two seeded whiskers at y = 0 and y = 100, followed by many ungrouped
+    // frames that alternate between them plus one far-away line per frame
+    auto line_data = std::make_shared<LineData>();
+    line_data->addAtTime(TimeFrameIndex(0), std::vector<Point2D<float>>{{0.0f, 0.0f}, {20.0f, 0.0f}}, NotifyObservers::No);
+    line_data->addAtTime(TimeFrameIndex(0), std::vector<Point2D<float>>{{0.0f, 100.0f}, {20.0f, 100.0f}}, NotifyObservers::No);
+
+    int const num_frames = 1500;
+    for (int t = 1; t <= num_frames; ++t) {
+        float const jitter = static_cast<float>(t % 7);
+        line_data->addAtTime(TimeFrameIndex(t), std::vector<Point2D<float>>{{0.0f, jitter}, {20.0f, jitter}}, NotifyObservers::No);
+        line_data->addAtTime(TimeFrameIndex(t), std::vector<Point2D<float>>{{0.0f, 100.0f - jitter}, {20.0f, 100.0f - jitter}}, NotifyObservers::No);
+        line_data->addAtTime(TimeFrameIndex(t), std::vector<Point2D<float>>{{500.0f, 500.0f}, {520.0f, 500.0f}}, NotifyObservers::No);
+    }
+
+    line_data->setIdentityContext("test_lines", dm.getEntityRegistry());
+    line_data->rebuildAllEntityIds();
+
+    auto const seed_ids = line_data->getEntityIdsAtTime(TimeFrameIndex(0));
+    std::vector<EntityId> seeds(seed_ids.begin(), seed_ids.end());
+    REQUIRE(seeds.size() == 2);
+
+    auto const upper = group_manager->createGroup("Upper", "");
+    auto const lower = group_manager->createGroup("Lower", "");
+    REQUIRE(group_manager->addEntityToGroup(upper, seeds[0]));
+    REQUIRE(group_manager->addEntityToGroup(lower, seeds[1]));
+
+    LineProximityGroupingParameters params(group_manager);
+    params.distance_threshold = 6.0f;
+
+    std::vector<int> progress;
+    lineProximityGrouping(line_data, &params, [&progress](int p) { progress.push_back(p); });
+
+    REQUIRE(progress.back() == 100);
+    REQUIRE(group_manager->getGroupCount() == 3);
+
+    // Jitter of 6 is exactly on the threshold and still matches
+    REQUIRE(group_manager->getEntitiesInGroup(upper).size() == static_cast<size_t>(num_frames + 1));
+    REQUIRE(group_manager->getEntitiesInGroup(lower).size() == static_cast<size_t>(num_frames + 1));
+
+    for (int t : {1, 6, 700, num_frames}) {
+        auto const ids = line_data->getEntityIdsAtTime(TimeFrameIndex(t));
+        std::vector<EntityId> frame(ids.begin(), ids.end());
+        REQUIRE(frame.size() == 3);
+        REQUIRE(group_manager->isEntityInGroup(upper, frame[0]));
+        REQUIRE(group_manager->isEntityInGroup(lower, frame[1]));
+        REQUIRE_FALSE(group_manager->isEntityInGroup(upper, frame[2]));
+        REQUIRE_FALSE(group_manager->isEntityInGroup(lower, frame[2]));
+    }
+
+    auto const group_ids = group_manager->getAllGroupIds();
+    auto const outlier_group = *std::find_if(group_ids.begin(), group_ids.end(),
+                                             [&](GroupId id) { return id != upper && id != lower; });
+    REQUIRE(group_manager->getEntitiesInGroup(outlier_group).size() == static_cast<size_t>(num_frames));
+}
@@ -1,8 +1,8 @@
 #include "mask_connected_component.hpp"
 
 #include "Masks/Mask_Data.hpp"
-#include "Masks/utils/connected_component.hpp"
 #include "Masks/utils/mask_utils.hpp"
+#include "Masks/utils/run_length_mask.hpp"
 #include "transforms/utils/variant_type_check.hpp"
 
 #include <iostream>
@@ -33,13 +33,13 @@ std::shared_ptr<MaskData> remove_small_connected_components(
         }
     }
     
-    // Create binary processing function that uses the connected component algorithm
-    auto binary_processor = [threshold](Image const & input_image) -> Image {
-        return remove_small_clusters(input_image, threshold);
+    // Label runs directly instead of rasterizing each frame
+    auto run_processor = [threshold](RunLengthMask const & input_mask, ImageSize) -> RunLengthMask {
+        return remove_small_clusters(input_mask, threshold);
     };
     
     // Use the utility function to apply the algorithm
-    return apply_binary_image_algorithm(mask_data, binary_processor, progressCallback);
+    return apply_run_length_algorithm(mask_data, run_processor, progressCallback);
 }
 
 ///////////////////////////////////////////////////////////////////////////////// 
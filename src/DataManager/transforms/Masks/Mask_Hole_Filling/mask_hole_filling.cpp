@@ -1,8 +1,8 @@
 #include "mask_hole_filling.hpp"
 
 #include "Masks/Mask_Data.hpp"
-#include "Masks/utils/hole_filling.hpp"
 #include "Masks/utils/mask_utils.hpp"
+#include "Masks/utils/run_length_mask.hpp"
 #include "transforms/utils/variant_type_check.hpp"
 
 #include <iostream>
@@ -27,13 +27,13 @@ std::shared_ptr<MaskData> fill_mask_holes(
     static_cast<void>(params);
     
     // Use the utility function to apply hole filling to the mask data
-    auto binary_processor = [](Image const & binary_image) -> Image {
-        return fill_holes(binary_image);
+    auto run_processor = [](RunLengthMask const & input_mask, ImageSize) -> RunLengthMask {
+        return fill_holes(input_mask);
     };
     
-    return apply_binary_image_algorithm(
+    return apply_run_length_algorithm(
         mask_data,
-        binary_processor,
+        run_processor,
         progressCallback,
         true // preserve_empty_masks - keep frames even if they become empty
     );
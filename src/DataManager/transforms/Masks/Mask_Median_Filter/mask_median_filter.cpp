@@ -2,7 +2,7 @@
 
 #include "Masks/Mask_Data.hpp"
 #include "Masks/utils/mask_utils.hpp"
-#include "Masks/utils/median_filter.hpp"
+#include "Masks/utils/run_length_mask.hpp"
 #include "transforms/utils/variant_type_check.hpp"
 
 #include <iostream>
@@ -36,15 +36,17 @@ std::shared_ptr<MaskData> apply_median_filter(
         }
     }
     
-    // Create binary processing function that uses the median filter algorithm
-    auto binary_processor = [window_size](Image const & input_image) -> Image {
-        return median_filter(input_image, window_size);
+    // Only the mask's bounding box (plus half a window) is evaluated; the image
+    // size keeps the reflection padding identical to the full-frame filter
+    auto run_processor = [window_size](RunLengthMask const & input_mask,
+                                       ImageSize image_size) -> RunLengthMask {
+        return median_filter(input_mask, window_size, image_size);
     };
     
     // Use the utility function to apply the algorithm
-    return apply_binary_image_algorithm(
+    return apply_run_length_algorithm(
         mask_data,
-        binary_processor,
+        run_processor,
         progressCallback
         // Don't preserve empty masks - if median filtering removes all pixels, 
         // the mask should be removed from the result
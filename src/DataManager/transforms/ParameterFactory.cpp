@@ -142,6 +142,17 @@ void ParameterFactory::initializeDefaultSetters() {
     registerBasicParameter<HilbertPhaseParams, bool>(
             "Hilbert Phase", "use_windowing", &HilbertPhaseParams::useWindowing);
 
+    // Streaming overlap-save engine
+    std::unordered_map<std::string, HilbertPhaseParams::Method> hilbert_method_map = {
+            {"FFT", HilbertPhaseParams::Method::FFT},
+            {"OverlapSave", HilbertPhaseParams::Method::OverlapSave}};
+    registerEnumParameter<HilbertPhaseParams, HilbertPhaseParams::Method>(
+            "Hilbert Phase", "method", &HilbertPhaseParams::method, hilbert_method_map);
+    registerBasicParameter<HilbertPhaseParams, size_t>(
+            "Hilbert Phase", "hilbert_kernel_half_width", &HilbertPhaseParams::hilbertKernelHalfWidth);
+    registerBasicParameter<HilbertPhaseParams, size_t>(
+            "Hilbert Phase", "fft_block_size", &HilbertPhaseParams::fftBlockSize);
+
     // Bandpass filtering parameters
     registerBasicParameter<HilbertPhaseParams, bool>(
             "Hilbert Phase", "apply_bandpass_filter", &HilbertPhaseParams::applyBandpassFilter);
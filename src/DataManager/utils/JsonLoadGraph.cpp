@@ -0,0 +1,182 @@
+/// @file JsonLoadGraph.cpp
+/// @brief Implementation of the JSON data-load dependency graph.
+
+#include "JsonLoadGraph.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <optional>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// @brief Return the string value of @p key in @p item, or an empty string.
+[[nodiscard]] std::string stringField(nlohmann::json const & item, char const * key) {
+    if (item.is_object() && item.contains(key) && item[key].is_string()) {
+        return item[key].get<std::string>();
+    }
+    return {};
+}
+
+/// @brief Name -> producing entry indices (array order).
+using ProducerMap = std::map<std::string, std::vector<std::size_t>>;
+
+/// @brief Resolve @p source to the last producer before @p consumer (or the first after it).
+///
+/// Producers before the consumer win so that a reused name refers to the
+/// value visible at that point of the config.
+[[nodiscard]] std::optional<std::size_t> pickProducer(std::vector<std::size_t> const & producers,
+                                                      std::size_t consumer) {
+    std::optional<std::size_t> best;
+    for (auto const index: producers) {
+        if (index == consumer) {
+            continue;
+        }
+        if (index < consumer) {
+            best = index;
+        } else if (!best) {
+            return index;
+        }
+    }
+    return best;
+}
+
+/// @brief Find the entry that produces @p source (exact name or `<name>_<suffix>`).
+[[nodiscard]] std::optional<std::size_t> resolveSource(ProducerMap const & producers,
+                                                       std::string const & source,
+                                                       std::size_t consumer) {
+    if (source.empty()) {
+        return std::nullopt;
+    }
+    if (auto it = producers.find(source); it != producers.end()) {
+        if (auto index = pickProducer(it->second, consumer)) {
+            return index;
+        }
+    }
+    // Longest prefix first: "a_b" beats "a" for source "a_b_0"
+    for (auto pos = source.rfind('_'); pos != std::string::npos && pos > 0; pos = source.rfind('_', pos - 1)) {
+        if (auto it = producers.find(source.substr(0, pos)); it != producers.end()) {
+            if (auto index = pickProducer(it->second, consumer)) {
+                return index;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+}// namespace
+
+JsonLoadEntryKind classifyJsonLoadEntry(nlohmann::json const & item) {
+    if (item.is_object() && item.contains("transformations")) {
+        return JsonLoadEntryKind::Transformations;
+    }
+    auto const format = stringField(item, "format");
+    if (format == "derived" || format == "max_value") {
+        return JsonLoadEntryKind::DerivedTimeFrame;
+    }
+    if (stringField(item, "data_type") == "time") {
+        return JsonLoadEntryKind::TimeFrame;
+    }
+    return JsonLoadEntryKind::Data;
+}
+
+JsonLoadGraph buildJsonLoadGraph(nlohmann::json const & data) {
+    JsonLoadGraph graph;
+    if (!data.is_array()) {
+        return graph;
+    }
+
+    ProducerMap time_producers;
+    ProducerMap data_producers;
+    ProducerMap all_producers;
+
+    graph.nodes.reserve(data.size());
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        auto const & item = data[i];
+        JsonLoadNode node;
+        node.index = i;
+        node.kind = classifyJsonLoadEntry(item);
+        node.name = stringField(item, "name");
+        if (node.kind != JsonLoadEntryKind::Transformations && !node.name.empty()) {
+            auto & producers = (node.kind == JsonLoadEntryKind::Data) ? data_producers : time_producers;
+            producers[node.name].push_back(i);
+            all_producers[node.name].push_back(i);
+        }
+        graph.nodes.push_back(std::move(node));
+    }
+
+    for (auto & node: graph.nodes) {
+        if (node.kind == JsonLoadEntryKind::Transformations) {
+            continue;
+        }
+        auto const & item = data[node.index];
+        auto add_dependency = [&node](std::optional<std::size_t> index) {
+            if (index) {
+                node.dependencies.push_back(*index);
+            }
+        };
+
+        add_dependency(resolveSource(time_producers, stringField(item, "clock"), node.index));
+
+        if (node.kind == JsonLoadEntryKind::DerivedTimeFrame) {
+            add_dependency(resolveSource(time_producers, stringField(item, "source_timeframe"), node.index));
+            for (auto const * key: {"source_series", "interval_series", "event_series", "source_data"}) {
+                add_dependency(resolveSource(data_producers, stringField(item, key), node.index));
+            }
+        }
+
+        if (!node.name.empty()) {
+            for (auto const index: all_producers[node.name]) {
+                if (index < node.index) {
+                    node.dependencies.push_back(index);
+                }
+            }
+        }
+
+        std::ranges::sort(node.dependencies);
+        auto const duplicates = std::ranges::unique(node.dependencies);
+        node.dependencies.erase(duplicates.begin(), duplicates.end());
+    }
+
+    // Kahn's algorithm, lowest index first among ready entries
+    std::vector<std::size_t> pending_count(graph.nodes.size(), 0);
+    std::vector<std::vector<std::size_t>> dependents(graph.nodes.size());
+    for (auto const & node: graph.nodes) {
+        pending_count[node.index] = node.dependencies.size();
+        for (auto const dep: node.dependencies) {
+            dependents[dep].push_back(node.index);
+        }
+    }
+
+    std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<>> ready;
+    for (auto const & node: graph.nodes) {
+        if (node.kind != JsonLoadEntryKind::Transformations && pending_count[node.index] == 0) {
+            ready.push(node.index);
+        }
+    }
+
+    std::vector<bool> placed(graph.nodes.size(), false);
+    while (!ready.empty()) {
+        auto const index = ready.top();
+        ready.pop();
+        placed[index] = true;
+        graph.commit_order.push_back(index);
+        for (auto const dependent: dependents[index]) {
+            if (--pending_count[dependent] == 0) {
+                ready.push(dependent);
+            }
+        }
+    }
+
+    for (auto const & node: graph.nodes) {
+        if (node.kind != JsonLoadEntryKind::Transformations && !placed[node.index]) {
+            graph.has_cycle = true;
+            graph.commit_order.push_back(node.index);
+        }
+    }
+
+    return graph;
+}
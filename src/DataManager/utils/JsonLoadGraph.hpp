@@ -0,0 +1,61 @@
+/// @file JsonLoadGraph.hpp
+/// @brief Dependency graph between the entries of a JSON data-load array.
+
+#ifndef JSON_LOAD_GRAPH_HPP
+#define JSON_LOAD_GRAPH_HPP
+
+#include "nlohmann/json.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/// @brief How an entry of the `"data"` array is processed by the loader.
+enum class JsonLoadEntryKind {
+    Data,            ///< File-backed data object(s) (`filepath` required)
+    TimeFrame,       ///< File-backed TimeFrame (`data_type: "time"`)
+    DerivedTimeFrame,///< TimeFrame computed from loaded data (`format: "derived"` or `"max_value"`)
+    Transformations  ///< `transformations` block, run after all other entries
+};
+
+/// @brief One entry of the data-load array and the entries it must follow.
+struct JsonLoadNode {
+    std::size_t index{0};                  ///< Position in the data-load array
+    JsonLoadEntryKind kind{JsonLoadEntryKind::Data};
+    std::string name;                      ///< `name` field, empty if absent
+    std::vector<std::size_t> dependencies; ///< Indices that must be committed first (sorted, unique)
+};
+
+/// @brief Dependency graph and a deterministic commit order for a data-load array.
+struct JsonLoadGraph {
+    std::vector<JsonLoadNode> nodes;      ///< One node per array entry, indexed by position
+    std::vector<std::size_t> commit_order;///< All non-`transformations` entries in dependency order
+    bool has_cycle{false};                ///< True if some entries could not be ordered by dependency
+};
+
+/// @brief Classify one entry of a data-load array.
+[[nodiscard]] JsonLoadEntryKind classifyJsonLoadEntry(nlohmann::json const & item);
+
+/// @brief Build the dependency graph of a (variable-substituted, loop-expanded) data-load array.
+///
+/// An entry depends on:
+/// - the TimeFrame entry named by its `clock`;
+/// - for `derived` TimeFrames, the entries named by `source_timeframe` and
+///   `source_series` / `interval_series` / `event_series`;
+/// - for `max_value` TimeFrames, the entry named by `source_data`;
+/// - any earlier entry with the same `name` (later entries overwrite earlier ones).
+///
+/// Source names are matched exactly first; otherwise the longest entry name
+/// `N` for which the source is `N_<suffix>` is used, which covers per-channel
+/// keys created by batch loaders (e.g. `"spikes_3"` from entry `"spikes"`).
+///
+/// The commit order is a topological order that, among ready entries, always
+/// picks the lowest array index, so a config whose entries already appear in
+/// dependency order is committed exactly in array order. Entries on a cycle
+/// are appended in array order and @ref JsonLoadGraph::has_cycle is set.
+///
+/// @param data The `"data"` array from a load config (or a plain array config).
+/// @return Graph with one node per entry.
+[[nodiscard]] JsonLoadGraph buildJsonLoadGraph(nlohmann::json const & data);
+
+#endif// JSON_LOAD_GRAPH_HPP
@@ -34,3 +34,9 @@ std::vector<float> AnalogDataAdapter::getDataInRange(TimeFrameIndex start,
     auto data_span = m_analogData->getDataInTimeFrameIndexRange(start, end, target_timeFrame);
     return std::vector<float>(data_span.begin(), data_span.end());
 }
+
+std::optional<AnalogRangeSummary> AnalogDataAdapter::summarizeRange(TimeFrameIndex start,
+                                                                    TimeFrameIndex end,
+                                                                    TimeFrame const * target_timeFrame) {
+    return m_analogData->summarizeRange(start, end, target_timeFrame);
+}
@@ -67,6 +67,21 @@ public:
                                       TimeFrameIndex end,
                                       TimeFrame const * target_timeFrame) override;
 
+    /**
+     * @brief Gets summary statistics of the data within a specific time range.
+     *
+     * Answered by AnalogTimeSeries::summarizeRange(), which switches to the
+     * series' range index once enough intervals have been queried, so repeated
+     * reductions over many intervals do not rescan samples.
+     *
+     * @param start The start index of the time range.
+     * @param end The end index of the time range.
+     * @param target_timeFrame The target time frame (from the caller) for the data.
+     * @return The summary of the samples in [start, end].
+     */
+    std::optional<AnalogRangeSummary> summarizeRange(TimeFrameIndex start,
+                                                     TimeFrameIndex end,
+                                                     TimeFrame const * target_timeFrame) override;
 
 private:
 
@@ -8,6 +8,18 @@
 #include <numeric>
 #include <stdexcept>
 
+namespace {
+
+/// Sum and Count of no samples are 0; every other reduction is undefined
+float emptyReduction(ReductionType reduction) {
+    if (reduction == ReductionType::Sum || reduction == ReductionType::Count) {
+        return 0.0f;
+    }
+    return std::numeric_limits<float>::quiet_NaN();
+}
+
+}// namespace
+
 IntervalReductionComputer::IntervalReductionComputer(std::shared_ptr<IAnalogSource> source, 
                                                    ReductionType reduction)
     : IColumnComputer()
@@ -48,7 +60,14 @@ std::pair<std::vector<double>, ColumnEntityIds> IntervalReductionComputer::compu
     results.reserve(intervals.size());
 
     for (auto const & interval: intervals) {
-            
+
+        // Sources with a range index answer without copying the samples
+        if (auto summary = m_source->summarizeRange(
+                    interval.start, interval.end, destinationTimeFrame.get())) {
+            results.emplace_back(reduceSummary(*summary));
+            continue;
+        }
+
         auto sliceView = m_source->getDataInRange(
             interval.start, 
             interval.end, 
@@ -70,7 +89,7 @@ std::string IntervalReductionComputer::getSourceDependency() const {
 
 float IntervalReductionComputer::computeReduction(std::span<const float> data) const {
     if (data.empty()) {
-        return std::numeric_limits<float>::quiet_NaN();
+        return emptyReduction(m_reduction);
     }
 
     switch (m_reduction) {
@@ -91,6 +110,29 @@ float IntervalReductionComputer::computeReduction(std::span<const float> data) c
     }
 }
 
+float IntervalReductionComputer::reduceSummary(AnalogRangeSummary const & summary) const {
+    if (summary.empty()) {
+        return emptyReduction(m_reduction);
+    }
+
+    switch (m_reduction) {
+        case ReductionType::Mean:
+            return static_cast<float>(summary.mean);
+        case ReductionType::Max:
+            return summary.max;
+        case ReductionType::Min:
+            return summary.min;
+        case ReductionType::StdDev:
+            return static_cast<float>(std::sqrt(summary.sampleVariance())); // Sample standard deviation
+        case ReductionType::Sum:
+            return static_cast<float>(summary.sum);
+        case ReductionType::Count:
+            return static_cast<float>(summary.count);
+        default:
+            throw std::invalid_argument("Unknown reduction type");
+    }
+}
+
 float IntervalReductionComputer::computeMean(std::span<const float> data) const {
     if (data.empty()) {
         return std::numeric_limits<float>::quiet_NaN();
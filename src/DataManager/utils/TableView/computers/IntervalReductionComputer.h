@@ -9,6 +9,7 @@
 #include <string>
 
 class IAnalogSource;
+struct AnalogRangeSummary;
 
 /**
  * @brief Reduction operation types for interval computations.
@@ -65,10 +66,20 @@ private:
      * @brief Computes the reduction for a single interval.
      * 
      * @param data Span over the data for the interval.
-     * @return The computed reduction value.
+     * @return The computed reduction value; for an empty interval 0 for Sum
+     *         and Count, NaN otherwise.
      */
     [[nodiscard]] auto computeReduction(std::span<const float> data) const -> float;
 
+    /**
+     * @brief Picks the reduction out of a precomputed range summary.
+     * 
+     * @param summary Summary of the interval from IAnalogSource::summarizeRange().
+     * @return The computed reduction value; for an empty interval 0 for Sum
+     *         and Count, NaN otherwise.
+     */
+    [[nodiscard]] auto reduceSummary(AnalogRangeSummary const & summary) const -> float;
+
     /**
      * @brief Computes the mean of the data span.
      * 
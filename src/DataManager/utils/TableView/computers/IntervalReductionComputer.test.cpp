@@ -12,8 +12,10 @@
 
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
 #include "DigitalTimeSeries/Digital_Interval_Series.hpp"
+#include "AnalogTimeSeries/utils/AnalogRangeIndex.hpp"
 #include "utils/TableView/ComputerRegistry.hpp"
 #include "utils/TableView/TableRegistry.hpp"
+#include "utils/TableView/adapters/AnalogDataAdapter.h"
 #include "utils/TableView/adapters/DataManagerExtension.h"
 #include "utils/TableView/core/TableView.h"
 #include "utils/TableView/core/TableViewBuilder.h"
@@ -25,6 +27,7 @@
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <numeric>
+#include <optional>
 #include <span>
 #include <iostream>
 #include <vector>
@@ -445,6 +448,56 @@ TEST_CASE("DM - TV - IntervalReductionComputer Basic Functionality", "[IntervalR
     }
 }
 
+TEST_CASE("DM - TV - IntervalReductionComputer empty intervals", "[IntervalReductionComputer]") {
+
+    // Samples at 0, 1, 2, 8, 9: the interval [4, 6] holds none of them
+    std::vector<int> timeValues = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    auto timeFrame = std::make_shared<TimeFrame>(timeValues);
+
+    std::vector<TimeFrameIndex> sampleTimes = {
+            TimeFrameIndex(0), TimeFrameIndex(1), TimeFrameIndex(2), TimeFrameIndex(8), TimeFrameIndex(9)};
+    auto series = std::make_shared<AnalogTimeSeries>(std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f}, sampleTimes);
+    series->setTimeFrame(timeFrame);
+
+    std::vector<TimeFrameInterval> intervals = {
+            TimeFrameInterval(TimeFrameIndex(4), TimeFrameIndex(6)),
+            TimeFrameInterval(TimeFrameIndex(0), TimeFrameIndex(2))};
+    ExecutionPlan plan(intervals, timeFrame);
+
+    // Same adapter without summarizeRange(), to cover the span path
+    class ScanOnlyAnalogSource : public AnalogDataAdapter {
+    public:
+        using AnalogDataAdapter::AnalogDataAdapter;
+        std::optional<AnalogRangeSummary> summarizeRange(TimeFrameIndex, TimeFrameIndex, TimeFrame const *) override {
+            return std::nullopt;
+        }
+    };
+
+    std::vector<std::shared_ptr<IAnalogSource>> sources = {
+            std::make_shared<AnalogDataAdapter>(series, timeFrame, "Summarized"),
+            std::make_shared<ScanOnlyAnalogSource>(series, timeFrame, "Scanned")};
+
+    for (auto const & source: sources) {
+        INFO(source->getName());
+
+        auto [sums, sum_ids] = IntervalReductionComputer(source, ReductionType::Sum).compute(plan);
+        auto [counts, count_ids] = IntervalReductionComputer(source, ReductionType::Count).compute(plan);
+        auto [means, mean_ids] = IntervalReductionComputer(source, ReductionType::Mean).compute(plan);
+        auto [maxes, max_ids] = IntervalReductionComputer(source, ReductionType::Max).compute(plan);
+
+        REQUIRE(sums.size() == 2);
+        REQUIRE(sums[0] == 0.0);
+        REQUIRE(counts[0] == 0.0);
+        REQUIRE(std::isnan(means[0]));
+        REQUIRE(std::isnan(maxes[0]));
+
+        REQUIRE(sums[1] == Catch::Approx(6.0));
+        REQUIRE(counts[1] == 3.0);
+        REQUIRE(means[1] == Catch::Approx(2.0));
+        REQUIRE(maxes[1] == 3.0);
+    }
+}
+
 TEST_CASE("DM - TV - IntervalReductionComputer Error Handling", "[IntervalReductionComputer][Error]") {
 
     SECTION("Null source throws exception") {
@@ -1022,3 +1075,42 @@ TEST_CASE_METHOD(IntervalReductionTableRegistryTestFixture, "DM - TV - IntervalR
         }
     }
 }
+
+TEST_CASE_METHOD(IntervalReductionTableRegistryTestFixture, "DM - TV - TablePipeline materializes only on request", "[IntervalReductionComputer][JSON][Pipeline]") {
+    auto const config_with = [](bool materialize) {
+        nlohmann::json table = {
+                {"table_id", "materialize_test"},
+                {"name", "Materialize Test"},
+                {"row_selector", {{"type", "interval"}, {"source", "BehaviorPeriods"}}},
+                {"columns", nlohmann::json::array({{{"name", "LinearSignalMean"},
+                                                    {"data_source", "LinearSignal"},
+                                                    {"computer", "Interval Mean"}}})}};
+        if (materialize) {
+            table["materialize"] = true;
+        }
+        return nlohmann::json{{"tables", nlohmann::json::array({table})}};
+    };
+
+    auto & pipeline = getTablePipeline();
+
+    SECTION("lazy by default") {
+        REQUIRE(pipeline.loadFromJson(config_with(false)));
+        REQUIRE_FALSE(pipeline.getTableConfigurations()[0].materialize);
+        auto const result = pipeline.execute();
+        REQUIRE(result.success);
+        CHECK(result.table_results[0].column_timings.empty());
+    }
+
+    SECTION("eager when requested") {
+        REQUIRE(pipeline.loadFromJson(config_with(true)));
+        REQUIRE(pipeline.getTableConfigurations()[0].materialize);
+        auto const result = pipeline.execute();
+        REQUIRE(result.success);
+        REQUIRE(result.table_results[0].column_timings.size() == 1);
+        CHECK(result.table_results[0].column_timings[0].column_name == "LinearSignalMean");
+    }
+
+    auto built_table = getTableRegistry().getBuiltTable("materialize_test");
+    REQUIRE(built_table != nullptr);
+    CHECK(built_table->getColumnValues<double>("LinearSignalMean").size() == 4);
+}
@@ -8,8 +8,10 @@
 #include "Points/Point_Data.hpp"
 #include "utils/TableView/interfaces/IRowSelector.h"
 
+#include "CoreUtilities/thread_pool.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <optional>
 #include <set>
@@ -255,9 +257,12 @@ TableView & TableView::operator=(TableView && other) {
 
 size_t TableView::getRowCount() const {
     // Prefer expanded row count if any execution plan has entity-expanded rows cached
-    for (auto const & entry : m_planCache) {
-        if (!entry.second.getRows().empty()) {
-            return entry.second.getRows().size();
+    {
+        std::lock_guard<std::mutex> const lock(m_planCacheMutex);
+        for (auto const & entry : m_planCache) {
+            if (!entry.second.getRows().empty()) {
+                return entry.second.getRows().size();
+            }
         }
     }
     // If nothing cached yet, proactively attempt expansion using a line-source dependent column
@@ -340,14 +345,94 @@ ColumnDataVariant TableView::getColumnDataVariant(std::string const & name) {
 }
 
 
-void TableView::materializeAll() {
-    std::set<std::string> materializing;
+std::vector<ColumnMaterializationTiming> TableView::materializeAll() {
+    auto const stages = buildMaterializationStages();
 
-    for (auto const & column: m_columns) {
-        if (!column->isMaterialized()) {
-            materializeColumn(column->getName(), materializing);
+    // Generate every plan up front so concurrent columns only read the cache
+    for (auto const & stage: stages) {
+        for (size_t const index: stage) {
+            (void) getExecutionPlanFor(m_columns[index]->getSourceDependency());
         }
     }
+
+    std::vector<ColumnMaterializationTiming> timings;
+    for (size_t stage_index = 0; stage_index < stages.size(); ++stage_index) {
+        auto const & stage = stages[stage_index];
+        std::vector<double> elapsed_ms(stage.size(), 0.0);
+
+        // One column per chunk: column costs vary too much for larger grains
+        CoreUtilities::parallelForChunks(0, stage.size(), 1, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; ++i) {
+                auto const start = std::chrono::steady_clock::now();
+                m_columns[stage[i]]->materialize(this);
+                auto const end = std::chrono::steady_clock::now();
+                elapsed_ms[i] = std::chrono::duration<double, std::milli>(end - start).count();
+            }
+        });
+
+        for (size_t i = 0; i < stage.size(); ++i) {
+            timings.push_back({m_columns[stage[i]]->getName(), elapsed_ms[i], stage_index});
+        }
+    }
+    return timings;
+}
+
+std::vector<std::vector<size_t>> TableView::buildMaterializationStages() const {
+    // In-table dependencies of each pending column, and the reverse edges
+    std::vector<size_t> pending_deps(m_columns.size(), 0);
+    std::vector<std::vector<size_t>> dependents(m_columns.size());
+    std::vector<size_t> current;
+
+    size_t pending_count = 0;
+    for (size_t index = 0; index < m_columns.size(); ++index) {
+        auto const & column = m_columns[index];
+        if (column->isMaterialized()) {
+            continue;
+        }
+        ++pending_count;
+
+        std::set<size_t> dep_indices;
+        for (auto const & dependency: column->getDependencies()) {
+            auto it = m_colNameToIndex.find(dependency);
+            if (it != m_colNameToIndex.end() && !m_columns[it->second]->isMaterialized()) {
+                dep_indices.insert(it->second);
+            }
+        }
+        for (size_t const dep: dep_indices) {
+            dependents[dep].push_back(index);
+        }
+        pending_deps[index] = dep_indices.size();
+        if (dep_indices.empty()) {
+            current.push_back(index);
+        }
+    }
+
+    std::vector<std::vector<size_t>> stages;
+    size_t scheduled = 0;
+    while (!current.empty()) {
+        std::vector<size_t> next;
+        for (size_t const index: current) {
+            for (size_t const dependent: dependents[index]) {
+                if (--pending_deps[dependent] == 0) {
+                    next.push_back(dependent);
+                }
+            }
+        }
+        std::sort(next.begin(), next.end());
+        scheduled += current.size();
+        stages.push_back(std::move(current));
+        current = std::move(next);
+    }
+
+    if (scheduled != pending_count) {
+        for (size_t index = 0; index < m_columns.size(); ++index) {
+            if (pending_deps[index] > 0) {
+                throw std::runtime_error("Circular dependency detected involving column: " +
+                                         m_columns[index]->getName());
+            }
+        }
+    }
+    return stages;
 }
 
 void TableView::clearCache() {
@@ -357,10 +442,13 @@ void TableView::clearCache() {
     }
 
     // Clear execution plan cache
+    std::lock_guard<std::mutex> const lock(m_planCacheMutex);
     m_planCache.clear();
 }
 
 ExecutionPlan const & TableView::getExecutionPlanFor(std::string const & sourceName) {
+    std::lock_guard<std::mutex> const lock(m_planCacheMutex);
+
     // Check cache first
     auto it = m_planCache.find(sourceName);
     if (it != m_planCache.end()) {
@@ -397,42 +485,6 @@ void TableView::addColumn(std::shared_ptr<IColumn> column) {
     m_colNameToIndex[name] = index;
 }
 
-void TableView::materializeColumn(std::string const & columnName, std::set<std::string> & materializing) {
-    // Check for circular dependencies
-    if (materializing.find(columnName) != materializing.end()) {
-        throw std::runtime_error("Circular dependency detected involving column: " + columnName);
-    }
-
-    // Check if column exists
-    if (!hasColumn(columnName)) {
-        throw std::runtime_error("Column '" + columnName + "' not found");
-    }
-
-    auto & column = m_columns[m_colNameToIndex[columnName]];
-
-    // If already materialized, nothing to do
-    if (column->isMaterialized()) {
-        return;
-    }
-
-    // Mark as being materialized
-    materializing.insert(columnName);
-
-    // Materialize dependencies first
-    auto const dependencies = column->getDependencies();
-    for (auto const & dependency: dependencies) {
-        if (hasColumn(dependency)) {
-            materializeColumn(dependency, materializing);
-        }
-    }
-
-    // Materialize this column
-    column->materialize(this);// Use the IColumn interface method
-
-    // Remove from materializing set
-    materializing.erase(columnName);
-}
-
 ExecutionPlan TableView::generateExecutionPlan(std::string const & sourceName) {
     // Resolve to a concrete source adapter once, then dispatch with std::visit
     auto resolved = m_dataManager->resolveSource(sourceName);
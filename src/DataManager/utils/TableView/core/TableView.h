@@ -8,7 +8,9 @@
 #include "DataManager/utils/TableView/interfaces/IRowSelector.h"
 
 #include <map>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <span>
 #include <stdexcept>
@@ -19,6 +21,15 @@ class DataManagerExtension;
 class IColumn;
 class TableViewBuilder;
 
+/**
+ * @brief Wall-clock cost of materializing one column in TableView::materializeAll().
+ */
+struct ColumnMaterializationTiming {
+    std::string column_name;
+    double compute_time_ms = 0.0;
+    std::size_t stage = 0;///< Dependency depth; columns of one stage run concurrently
+};
+
 /**
  * @brief The main orchestrator for tabular data views with lazy evaluation.
  * 
@@ -120,9 +131,15 @@ public:
      * @brief Materializes all columns in the table.
      * 
      * This method computes all columns that haven't been materialized yet.
-     * It respects dependencies and computes columns in the correct order.
+     * Columns are grouped into stages by dependency depth: every column of a
+     * stage depends only on columns of earlier stages, so the columns of one
+     * stage are computed concurrently on the shared thread pool. The
+     * ExecutionPlans they need are generated beforehand, once per source.
+     * 
+     * @return Per-column timings of the columns computed by this call, in stage order.
+     * @throws std::runtime_error on circular column dependencies.
      */
-    void materializeAll();
+    std::vector<ColumnMaterializationTiming> materializeAll();
 
     /**
      * @brief Clears all cached data, forcing recomputation on next access.
@@ -245,6 +262,8 @@ private:
      * This method is critical for the caching system. It checks the plan cache
      * first, and if not found, uses the IRowSelector to generate the necessary
      * indices for the given data source, then stores the new plan in the cache.
+     * Safe to call from concurrently materializing columns: each plan is
+     * generated once, under the cache lock.
      * 
      * @param sourceName The name of the data source (e.g., "LFP", "Spikes.x").
      * @return Reference to the ExecutionPlan for the source.
@@ -259,15 +278,16 @@ private:
     void addColumn(std::shared_ptr<IColumn> column);
 
     /**
-     * @brief Materializes a column and its dependencies.
+     * @brief Groups the unmaterialized columns into dependency stages.
      * 
-     * This method ensures that all dependencies are materialized before
-     * materializing the target column. It handles circular dependency detection.
+     * Stage 0 holds columns without unmaterialized column dependencies; stage
+     * k holds columns whose deepest dependency is in stage k - 1. Columns keep
+     * their table order within a stage.
      * 
-     * @param columnName The name of the column to materialize.
-     * @param materializing Set of columns currently being materialized (for cycle detection).
+     * @return Column indices per stage.
+     * @throws std::runtime_error on circular column dependencies.
      */
-    void materializeColumn(std::string const & columnName, std::set<std::string> & materializing);
+    [[nodiscard]] auto buildMaterializationStages() const -> std::vector<std::vector<size_t>>;
 
     /**
      * @brief Generates an ExecutionPlan for a specific data source.
@@ -285,8 +305,10 @@ private:
     std::vector<std::shared_ptr<IColumn>> m_columns;
     std::map<std::string, size_t> m_colNameToIndex;
 
-    // Caches ExecutionPlans, keyed by data source name
+    // Caches ExecutionPlans, keyed by data source name. Map nodes are stable,
+    // so references handed out stay valid while other plans are inserted.
     std::map<std::string, ExecutionPlan> m_planCache;
+    mutable std::mutex m_planCacheMutex;
     
     // Direct EntityId storage for transformed tables
     std::vector<std::vector<EntityId>> m_direct_entity_ids;
@@ -1,10 +1,12 @@
 #ifndef IANALOG_SOURCE_H
 #define IANALOG_SOURCE_H
 
+#include "AnalogTimeSeries/utils/AnalogRangeIndex.hpp"
 #include "TimeFrame/TimeFrameIndex.hpp"
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -57,6 +59,27 @@ public:
     virtual std::vector<float> getDataInRange(TimeFrameIndex start,
                                               TimeFrameIndex end,
                                               TimeFrame const * target_timeFrame) = 0;
+
+    /**
+     * @brief Gets summary statistics of the data within a specific time range.
+     *
+     * Covers the same samples as getDataInRange() but without copying them.
+     * Sources without a cheaper path than copying return std::nullopt and
+     * callers fall back to getDataInRange().
+     *
+     * @param start The start index of the time range.
+     * @param end The end index of the time range.
+     * @param target_timeFrame The target time frame (from the caller) for the data.
+     * @return The summary, or std::nullopt if not supported by this source.
+     */
+    virtual std::optional<AnalogRangeSummary> summarizeRange(TimeFrameIndex start,
+                                                             TimeFrameIndex end,
+                                                             TimeFrame const * target_timeFrame) {
+        (void) start;
+        (void) end;
+        (void) target_timeFrame;
+        return std::nullopt;
+    }
 };
 
 #endif// IANALOG_SOURCE_H
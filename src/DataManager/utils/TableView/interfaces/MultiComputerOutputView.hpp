@@ -29,30 +29,19 @@ public:
           m_outputIndex(outputIndex) {}
 
     [[nodiscard]] std::pair<std::vector<T>, ColumnEntityIds> compute(ExecutionPlan const & plan) const override {
-        // Fast path: return cached batch slice if available
-        {
-            std::lock_guard<std::mutex> lock(m_sharedCache->mutex);
-            auto it = m_sharedCache->cache.find(&plan);
-            if (it != m_sharedCache->cache.end()) {
-                auto const & [batch, entity_ids] = it->second;
-                if (m_outputIndex < batch.size()) {
-                    return {batch[m_outputIndex], entity_ids};
-                }
-            }
+        // The batch is computed while holding the lock, so sibling outputs
+        // materialized concurrently wait for it instead of recomputing it
+        std::lock_guard<std::mutex> lock(m_sharedCache->mutex);
+        auto it = m_sharedCache->cache.find(&plan);
+        if (it == m_sharedCache->cache.end()) {
+            it = m_sharedCache->cache.emplace(&plan, m_multiComputer->computeBatch(plan)).first;
         }
 
-        // Compute batch and populate cache
-        auto [batch, entity_ids] = m_multiComputer->computeBatch(plan);
-        std::vector<T> result;
+        auto const & [batch, entity_ids] = it->second;
         if (m_outputIndex < batch.size()) {
-            result = batch[m_outputIndex];
+            return {batch[m_outputIndex], entity_ids};
         }
-        {
-            std::lock_guard<std::mutex> lock(m_sharedCache->mutex);
-            // Insert computed batch; move to avoid copies
-            m_sharedCache->cache[&plan] = std::move(std::make_pair(std::move(batch), entity_ids));
-        }
-        return {result, entity_ids};
+        return {std::vector<T>{}, entity_ids};
     }
 
     [[nodiscard]] auto getDependencies() const -> std::vector<std::string> override {
@@ -218,6 +218,15 @@ TableBuildResult TablePipeline::buildTable(TableConfiguration const & config,
         // Build the table
         TableView table_view = builder.build();
 
+        // On request, compute all columns now; independent columns run concurrently
+        if (config.materialize) {
+            auto const materialize_start = std::chrono::steady_clock::now();
+            result.column_timings = table_view.materializeAll();
+            auto const materialize_end = std::chrono::steady_clock::now();
+            result.materialize_time_ms =
+                    std::chrono::duration<double, std::milli>(materialize_end - materialize_start).count();
+        }
+
         // Store the built table in TableManager
         if (!table_registry_->storeBuiltTable(config.table_id, std::make_unique<TableView>(std::move(table_view)))) {
             result.error_message = "Failed to store built table in TableManager";
@@ -253,6 +262,7 @@ TableConfiguration TablePipeline::parseTableConfiguration(nlohmann::json const &
     config.table_id = table_json.value("table_id", "");
     config.name = table_json.value("name", "");
     config.description = table_json.value("description", "");
+    config.materialize = table_json.value("materialize", false);
 
     if (table_json.contains("row_selector")) {
         config.row_selector = table_json["row_selector"];
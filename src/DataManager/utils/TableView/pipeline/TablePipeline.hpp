@@ -3,6 +3,7 @@
 
 #include "utils/TableView/TableInfo.hpp"
 #include "utils/TableView/ComputerRegistryTypes.hpp"
+#include "utils/TableView/core/TableView.h"
 
 #include <nlohmann/json.hpp>
 
@@ -41,6 +42,8 @@ struct TableConfiguration {
     nlohmann::json row_selector;               // Row selector configuration
     std::vector<nlohmann::json> columns;       // Column configurations
     
+    bool materialize = false;                   // Compute all columns before storing ("materialize" in JSON)
+
     // Optional metadata
     std::vector<std::string> tags;              // Tags for organization
     struct TransformSpec {
@@ -63,6 +66,8 @@ struct TableBuildResult {
     double build_time_ms = 0.0;
     int columns_built = 0;
     int total_columns = 0;
+    double materialize_time_ms = 0.0;                       // Wall time of the column computation (materialize only)
+    std::vector<ColumnMaterializationTiming> column_timings;// Per-column compute time, in stage order (materialize only)
 };
 
 /**
@@ -119,6 +124,11 @@ public:
     /**
      * @brief Execute a single table configuration
      * 
+     * Columns stay lazy unless `config.materialize` is set. Then they are
+     * computed before the table is stored: independent columns run
+     * concurrently (see TableView::materializeAll()), and the per-column
+     * timings are reported in the result.
+     * 
      * @param config The table configuration to build
      * @param progress_callback Optional progress callback for column building
      * @return TableBuildResult containing build results
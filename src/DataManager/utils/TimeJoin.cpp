@@ -0,0 +1,246 @@
+#include "TimeJoin.hpp"
+
+#include "TimeFrame/TimeIndexStorage.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+/**
+ * @brief First position >= @p from whose key is not "before" @p target.
+ *
+ * Probes from, from+1, from+3, from+7, ... until the probe passes the
+ * target, then binary-searches the last gap. All keys before @p from must
+ * already be before the target.
+ *
+ * @tparam Inclusive false: lower bound (first key >= target);
+ *                   true: upper bound (first key > target)
+ */
+template<bool Inclusive>
+std::size_t gallop(std::span<int64_t const> keys, std::size_t from, int64_t target) {
+    auto const before = [target](int64_t key) {
+        if constexpr (Inclusive) {
+            return key <= target;
+        } else {
+            return key < target;
+        }
+    };
+
+    std::size_t lo = from;
+    std::size_t hi = from;
+    std::size_t step = 1;
+    while (hi < keys.size() && before(keys[hi])) {
+        lo = hi + 1;
+        hi += step;
+        step *= 2;
+    }
+    hi = std::min(hi, keys.size());
+
+    auto const first = keys.begin() + static_cast<std::ptrdiff_t>(lo);
+    auto const last = keys.begin() + static_cast<std::ptrdiff_t>(hi);
+    auto const it = Inclusive ? std::upper_bound(first, last, target)
+                              : std::lower_bound(first, last, target);
+    return static_cast<std::size_t>(it - keys.begin());
+}
+
+bool withinTolerance(int64_t left, int64_t right, std::optional<int64_t> tolerance) {
+    if (!tolerance.has_value()) {
+        return true;
+    }
+    auto const distance = left > right ? left - right : right - left;
+    return distance <= *tolerance;
+}
+
+TimeJoinResult innerJoin(std::span<int64_t const> left,
+                         std::span<int64_t const> right,
+                         bool last_duplicate) {
+    TimeJoinResult result;
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < left.size() && j < right.size()) {
+        if (left[i] < right[j]) {
+            i = gallop<false>(left, i, right[j]);
+        } else if (right[j] < left[i]) {
+            j = gallop<false>(right, j, left[i]);
+        } else {
+            // Keep j: later left duplicates pair with the same right sample
+            result.left_positions.push_back(i);
+            result.right_positions.push_back(last_duplicate ? gallop<true>(right, j, left[i]) - 1 : j);
+            ++i;
+        }
+    }
+    return result;
+}
+
+TimeJoinResult asOfJoin(std::span<int64_t const> left,
+                        std::span<int64_t const> right,
+                        TimeJoinOptions const & options) {
+    TimeJoinResult result;
+    if (right.empty()) {
+        return result;
+    }
+    result.left_positions.reserve(left.size());
+    result.right_positions.reserve(left.size());
+
+    // Cursor into right; left keys are non-decreasing so it only moves forward
+    std::size_t j = 0;
+    for (std::size_t i = 0; i < left.size(); ++i) {
+        auto const key = left[i];
+        std::optional<std::size_t> match;
+
+        switch (options.kind) {
+            case TimeJoinKind::Backward: {
+                j = gallop<true>(right, j, key);
+                if (j > 0) {
+                    match = j - 1;
+                }
+                break;
+            }
+            case TimeJoinKind::Forward: {
+                j = gallop<false>(right, j, key);
+                if (j < right.size()) {
+                    match = j;
+                }
+                break;
+            }
+            case TimeJoinKind::Nearest: {
+                j = gallop<false>(right, j, key);
+                if (j == right.size()) {
+                    match = j - 1;
+                } else if (j == 0) {
+                    match = j;
+                } else {
+                    // Ties go to the preceding sample
+                    match = (key - right[j - 1] <= right[j] - key) ? j - 1 : j;
+                }
+                break;
+            }
+            case TimeJoinKind::Inner:
+                break;
+        }
+
+        if (match.has_value() && withinTolerance(key, right[*match], options.tolerance)) {
+            result.left_positions.push_back(i);
+            result.right_positions.push_back(*match);
+        }
+    }
+    return result;
+}
+
+void shiftPositions(std::vector<std::size_t> & positions, std::size_t offset) {
+    if (offset == 0) {
+        return;
+    }
+    for (auto & p: positions) {
+        p += offset;
+    }
+}
+
+}// namespace
+
+TimeJoinResult joinSortedKeys(std::span<int64_t const> left,
+                              std::span<int64_t const> right,
+                              TimeJoinOptions const & options) {
+    if (options.kind == TimeJoinKind::Inner) {
+        return innerJoin(left, right, options.last_duplicate);
+    }
+    return asOfJoin(left, right, options);
+}
+
+TimeJoinResult joinKeys(std::span<int64_t const> left,
+                        std::span<int64_t const> right,
+                        TimeJoinOptions const & options) {
+    if (std::is_sorted(left.begin(), left.end())) {
+        return joinSortedKeys(left, right, options);
+    }
+
+    std::vector<std::size_t> order(left.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&left](std::size_t a, std::size_t b) {
+        return left[a] < left[b];
+    });
+
+    std::vector<int64_t> sorted_keys(left.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        sorted_keys[i] = left[order[i]];
+    }
+
+    auto const sorted = joinSortedKeys(sorted_keys, right, options);
+
+    // Map back to original left positions and restore left order
+    std::vector<std::size_t> pair_order(sorted.size());
+    std::iota(pair_order.begin(), pair_order.end(), std::size_t{0});
+    std::sort(pair_order.begin(), pair_order.end(), [&](std::size_t a, std::size_t b) {
+        return order[sorted.left_positions[a]] < order[sorted.left_positions[b]];
+    });
+
+    TimeJoinResult result;
+    result.left_positions.reserve(sorted.size());
+    result.right_positions.reserve(sorted.size());
+    for (auto const k: pair_order) {
+        result.left_positions.push_back(order[sorted.left_positions[k]]);
+        result.right_positions.push_back(sorted.right_positions[k]);
+    }
+    return result;
+}
+
+TimeJoinKeys makeTimeJoinKeys(TimeIndexStorage const & storage,
+                              int64_t shift,
+                              TimeFrame const * clock_frame) {
+    TimeJoinKeys result;
+    auto const count = storage.size();
+
+    if (clock_frame == nullptr) {
+        result.keys.resize(count);
+        if (auto const * dense = dynamic_cast<DenseTimeIndexStorage const *>(&storage)) {
+            std::iota(result.keys.begin(), result.keys.end(),
+                      dense->getStartIndex().getValue() + shift);
+        } else if (auto const * sparse = dynamic_cast<SparseTimeIndexStorage const *>(&storage)) {
+            auto const & indices = sparse->getTimeIndices();
+            for (std::size_t i = 0; i < count; ++i) {
+                result.keys[i] = indices[i].getValue() + shift;
+            }
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                result.keys[i] = storage.getTimeFrameIndexAt(i).getValue() + shift;
+            }
+        }
+        return result;
+    }
+
+    // Clock-tick keys exist only for indices inside the TimeFrame; since the
+    // storage is sorted, the valid samples form one contiguous run.
+    auto const frame_count = static_cast<int64_t>(clock_frame->getTotalFrameCount());
+    auto const first = storage.findArrayPositionGreaterOrEqual(TimeFrameIndex(-shift));
+    auto const last = storage.findArrayPositionLessOrEqual(TimeFrameIndex(frame_count - 1 - shift));
+    if (!first.has_value() || !last.has_value() || *last < *first) {
+        return result;
+    }
+
+    result.first_position = *first;
+    result.keys.reserve(*last - *first + 1);
+    for (std::size_t p = *first; p <= *last; ++p) {
+        auto const index = TimeFrameIndex(storage.getTimeFrameIndexAt(p).getValue() + shift);
+        result.keys.push_back(clock_frame->getTimeAtIndex(index).getValue());
+    }
+    return result;
+}
+
+TimeJoinResult joinTimeSeries(TimeJoinSide const & left,
+                              TimeJoinSide const & right,
+                              TimeJoinOptions const & options) {
+    bool const on_clock = left.time_frame != nullptr &&
+                          right.time_frame != nullptr &&
+                          left.time_frame != right.time_frame;
+
+    auto const left_keys = makeTimeJoinKeys(
+            *left.storage, left.shift, on_clock ? left.time_frame : nullptr);
+    auto const right_keys = makeTimeJoinKeys(
+            *right.storage, right.shift, on_clock ? right.time_frame : nullptr);
+
+    auto result = joinSortedKeys(left_keys.keys, right_keys.keys, options);
+    shiftPositions(result.left_positions, left_keys.first_position);
+    shiftPositions(result.right_positions, right_keys.first_position);
+    return result;
+}
@@ -0,0 +1,147 @@
+#ifndef TIME_JOIN_HPP
+#define TIME_JOIN_HPP
+
+/**
+ * @file TimeJoin.hpp
+ * @brief Sorted merge-join of time series on their time indices.
+ *
+ * Pairs the samples of two series by time without hashing: both sides are
+ * reduced to sorted int64 keys and merged in one linear pass. Cursors
+ * advance with a galloping (exponential, then binary) search, so joining a
+ * short series against a long one costs O(n_short * log(n_long / n_short))
+ * instead of O(n_long).
+ *
+ * Series on the same TimeFrame (or without one) are joined on their
+ * TimeFrameIndex values. Series on different TimeFrames are joined on the
+ * absolute ClockTicks of each sample, so tolerances are then in clock ticks.
+ *
+ * @see TimeIndexStorage for the sorted per-series index storage
+ */
+
+#include "TimeFrame/TimeFrame.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+class TimeIndexStorage;
+
+/**
+ * @brief How a left sample is matched to right samples.
+ */
+enum class TimeJoinKind {
+    Inner,   ///< Exact key match; unmatched left samples are dropped
+    Backward,///< As-of: last right sample at or before the left key
+    Forward, ///< As-of: first right sample at or after the left key
+    Nearest  ///< Closest right sample; ties go to the preceding one
+};
+
+/**
+ * @brief Join configuration.
+ */
+struct TimeJoinOptions {
+    TimeJoinKind kind = TimeJoinKind::Inner;
+    /// Maximum |left key - right key| for as-of joins; unset = unbounded.
+    /// Ignored for Inner joins.
+    std::optional<int64_t> tolerance;
+    /// Inner joins only: pair with the last right sample of a duplicated
+    /// key instead of the first.
+    bool last_duplicate = false;
+};
+
+/**
+ * @brief Matched sample pairs as array positions into the two inputs.
+ *
+ * Each left position appears at most once. Pairs are ordered by left
+ * position; right positions may repeat (several left samples can match the
+ * same right sample).
+ */
+struct TimeJoinResult {
+    std::vector<std::size_t> left_positions;
+    std::vector<std::size_t> right_positions;
+
+    [[nodiscard]] std::size_t size() const noexcept { return left_positions.size(); }
+    [[nodiscard]] bool empty() const noexcept { return left_positions.empty(); }
+};
+
+/**
+ * @brief Sorted join keys of one series.
+ *
+ * keys[i] belongs to the sample at array position first_position + i.
+ * Samples whose key cannot be formed (indices outside the TimeFrame when
+ * joining on clock ticks) form a prefix/suffix of the series and are left
+ * out.
+ */
+struct TimeJoinKeys {
+    std::vector<int64_t> keys;
+    std::size_t first_position = 0;
+};
+
+/**
+ * @brief One side of a time join.
+ *
+ * `shift` is added to every TimeFrameIndex before matching. A series whose
+ * value for time t should be read at t + k (a temporal offset of k) uses
+ * shift = -k.
+ */
+struct TimeJoinSide {
+    TimeIndexStorage const * storage = nullptr;
+    TimeFrame const * time_frame = nullptr;
+    int64_t shift = 0;
+};
+
+/**
+ * @brief Join two sorted key sequences.
+ *
+ * @pre left and right are sorted ascending (enforcement: none) [CRITICAL]
+ * @pre options.tolerance, if set, is >= 0 (enforcement: none) [LOW]
+ *
+ * For Inner joins with duplicate keys, every left duplicate is paired with
+ * the first right sample of that key (the last one if
+ * options.last_duplicate is set).
+ */
+[[nodiscard]] TimeJoinResult joinSortedKeys(std::span<int64_t const> left,
+                                            std::span<int64_t const> right,
+                                            TimeJoinOptions const & options = {});
+
+/**
+ * @brief Join a possibly unsorted left key sequence against sorted right keys.
+ *
+ * Sorted input is merged directly; otherwise the left side is argsorted
+ * once (O(n log n)) and the result is returned in left order.
+ *
+ * @pre right is sorted ascending (enforcement: none) [CRITICAL]
+ */
+[[nodiscard]] TimeJoinResult joinKeys(std::span<int64_t const> left,
+                                      std::span<int64_t const> right,
+                                      TimeJoinOptions const & options = {});
+
+/**
+ * @brief Sorted join keys for the samples in @p storage.
+ *
+ * @param storage Time indices of the series (always sorted)
+ * @param shift Added to each TimeFrameIndex before forming the key
+ * @param clock_frame If non-null, keys are the ClockTicks of the shifted
+ *        indices in this TimeFrame; indices outside it are dropped.
+ *        If null, keys are the shifted index values.
+ */
+[[nodiscard]] TimeJoinKeys makeTimeJoinKeys(TimeIndexStorage const & storage,
+                                            int64_t shift = 0,
+                                            TimeFrame const * clock_frame = nullptr);
+
+/**
+ * @brief Join two time series on their time indices.
+ *
+ * Joins on shifted TimeFrameIndex values when both sides share a TimeFrame
+ * (or either has none), and on absolute ClockTicks otherwise.
+ *
+ * @pre left.storage and right.storage are non-null (enforcement: none) [CRITICAL]
+ * @return Array positions into left.storage / right.storage.
+ */
+[[nodiscard]] TimeJoinResult joinTimeSeries(TimeJoinSide const & left,
+                                            TimeJoinSide const & right,
+                                            TimeJoinOptions const & options = {});
+
+#endif// TIME_JOIN_HPP
@@ -0,0 +1,250 @@
+/**
+ * @file TimeJoin.test.cpp
+ * @brief Unit tests for the sorted merge-join time alignment utilities.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "TimeFrame/TimeFrame.hpp"
+#include "TimeFrame/TimeIndexStorage.hpp"
+#include "utils/TimeJoin.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Pairs = std::vector<std::pair<std::size_t, std::size_t>>;
+
+Pairs toPairs(TimeJoinResult const & result) {
+    REQUIRE(result.left_positions.size() == result.right_positions.size());
+    Pairs pairs;
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        pairs.emplace_back(result.left_positions[i], result.right_positions[i]);
+    }
+    return pairs;
+}
+
+/// Linear-scan reference implementation of every join kind.
+Pairs bruteForceJoin(std::vector<int64_t> const & left,
+                     std::vector<int64_t> const & right,
+                     TimeJoinOptions const & options) {
+    Pairs pairs;
+    for (std::size_t i = 0; i < left.size(); ++i) {
+        auto const key = left[i];
+
+        // Last sample strictly before / at-or-before the key, first at-or-after it
+        std::optional<std::size_t> before;
+        std::optional<std::size_t> at_or_before;
+        std::optional<std::size_t> at_or_after;
+        for (std::size_t j = 0; j < right.size(); ++j) {
+            if (right[j] < key) before = j;
+            if (right[j] <= key) at_or_before = j;
+            if (right[j] >= key && !at_or_after) at_or_after = j;
+        }
+
+        std::optional<std::size_t> match;
+        switch (options.kind) {
+            case TimeJoinKind::Inner:
+                if (at_or_after && right[*at_or_after] == key) match = at_or_after;
+                break;
+            case TimeJoinKind::Backward:
+                match = at_or_before;
+                break;
+            case TimeJoinKind::Forward:
+                match = at_or_after;
+                break;
+            case TimeJoinKind::Nearest:
+                if (!before) {
+                    match = at_or_after;
+                } else if (!at_or_after) {
+                    match = before;
+                } else {
+                    match = (key - right[*before] <= right[*at_or_after] - key) ? before : at_or_after;
+                }
+                break;
+        }
+
+        if (match && options.kind != TimeJoinKind::Inner && options.tolerance &&
+            std::abs(right[*match] - key) > *options.tolerance) {
+            match.reset();
+        }
+        if (match) {
+            pairs.emplace_back(i, *match);
+        }
+    }
+    return pairs;
+}
+
+}// anonymous namespace
+
+TEST_CASE("joinSortedKeys - inner join", "[TimeJoin]") {
+    std::vector<int64_t> const left{1, 3, 3, 5, 7, 9};
+    std::vector<int64_t> const right{0, 3, 3, 4, 7, 10};
+
+    auto const pairs = toPairs(joinSortedKeys(left, right));
+
+    // Left duplicates both pair with the first right 3
+    Pairs const expected{{1, 1}, {2, 1}, {4, 4}};
+    REQUIRE(pairs == expected);
+}
+
+TEST_CASE("joinSortedKeys - inner join can take the last duplicate", "[TimeJoin]") {
+    std::vector<int64_t> const left{1, 3, 3, 7};
+    std::vector<int64_t> const right{0, 3, 3, 3, 7, 7};
+
+    TimeJoinOptions options;
+    options.last_duplicate = true;
+    auto const pairs = toPairs(joinSortedKeys(left, right, options));
+
+    Pairs const expected{{1, 3}, {2, 3}, {3, 5}};
+    REQUIRE(pairs == expected);
+}
+
+TEST_CASE("joinSortedKeys - empty inputs", "[TimeJoin]") {
+    std::vector<int64_t> const keys{1, 2, 3};
+    std::vector<int64_t> const none;
+
+    for (auto kind: {TimeJoinKind::Inner, TimeJoinKind::Backward,
+                     TimeJoinKind::Forward, TimeJoinKind::Nearest}) {
+        REQUIRE(joinSortedKeys(keys, none, {kind, std::nullopt}).empty());
+        REQUIRE(joinSortedKeys(none, keys, {kind, std::nullopt}).empty());
+    }
+}
+
+TEST_CASE("joinSortedKeys - as-of joins", "[TimeJoin]") {
+    std::vector<int64_t> const left{0, 5, 10, 14, 30};
+    std::vector<int64_t> const right{2, 10, 12, 20};
+
+    SECTION("Backward") {
+        auto const pairs = toPairs(joinSortedKeys(left, right, {TimeJoinKind::Backward, std::nullopt}));
+        Pairs const expected{{1, 0}, {2, 1}, {3, 2}, {4, 3}};
+        REQUIRE(pairs == expected);
+    }
+
+    SECTION("Forward") {
+        auto const pairs = toPairs(joinSortedKeys(left, right, {TimeJoinKind::Forward, std::nullopt}));
+        Pairs const expected{{0, 0}, {1, 1}, {2, 1}, {3, 3}};
+        REQUIRE(pairs == expected);
+    }
+
+    SECTION("Nearest breaks ties toward the preceding sample") {
+        // 16 is equidistant from 12 and 20
+        std::vector<int64_t> const probe{16};
+        auto const pairs = toPairs(joinSortedKeys(probe, right, {TimeJoinKind::Nearest, std::nullopt}));
+        Pairs const expected{{0, 2}};
+        REQUIRE(pairs == expected);
+    }
+
+    SECTION("Tolerance drops distant matches") {
+        auto const pairs = toPairs(joinSortedKeys(left, right, {TimeJoinKind::Nearest, 2}));
+        // 0->2 (d=2), 5 has no sample within 2, 10->10, 14->12 (d=2), 30 dropped
+        Pairs const expected{{0, 0}, {2, 1}, {3, 2}};
+        REQUIRE(pairs == expected);
+    }
+}
+
+TEST_CASE("joinSortedKeys - matches brute force on skewed inputs", "[TimeJoin]") {
+    std::mt19937 rng(1234);
+
+    auto const makeKeys = [&rng](std::size_t n, int64_t range) {
+        std::uniform_int_distribution<int64_t> dist(0, range);
+        std::vector<int64_t> keys(n);
+        for (auto & k: keys) {
+            k = dist(rng);
+        }
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    };
+
+    // Short left against long right and vice versa exercises both gallop directions
+    for (auto const [n_left, n_right]: {std::pair<std::size_t, std::size_t>{8, 5000},
+                                        {5000, 8},
+                                        {700, 900}}) {
+        auto const left = makeKeys(n_left, 10000);
+        auto const right = makeKeys(n_right, 10000);
+
+        for (auto kind: {TimeJoinKind::Inner, TimeJoinKind::Backward,
+                         TimeJoinKind::Forward, TimeJoinKind::Nearest}) {
+            for (std::optional<int64_t> tolerance: {std::optional<int64_t>{}, std::optional<int64_t>{3}}) {
+                TimeJoinOptions const options{kind, tolerance};
+                REQUIRE(toPairs(joinSortedKeys(left, right, options)) ==
+                        bruteForceJoin(left, right, options));
+            }
+        }
+    }
+}
+
+TEST_CASE("joinKeys - unsorted left keys keep their order", "[TimeJoin]") {
+    std::vector<int64_t> const left{9, 2, 7, 2, 4};
+    std::vector<int64_t> const right{2, 4, 9};
+
+    auto const pairs = toPairs(joinKeys(left, right));
+
+    Pairs const expected{{0, 2}, {1, 0}, {3, 0}, {4, 1}};
+    REQUIRE(pairs == expected);
+}
+
+TEST_CASE("makeTimeJoinKeys - index keys", "[TimeJoin]") {
+    SECTION("Dense storage") {
+        DenseTimeIndexStorage const storage(TimeFrameIndex(5), 4);
+        auto const keys = makeTimeJoinKeys(storage, -2);
+        REQUIRE(keys.keys == std::vector<int64_t>{3, 4, 5, 6});
+        REQUIRE(keys.first_position == 0);
+    }
+
+    SECTION("Sparse storage") {
+        SparseTimeIndexStorage const storage({TimeFrameIndex(1), TimeFrameIndex(4), TimeFrameIndex(9)});
+        auto const keys = makeTimeJoinKeys(storage, 1);
+        REQUIRE(keys.keys == std::vector<int64_t>{2, 5, 10});
+    }
+}
+
+TEST_CASE("makeTimeJoinKeys - clock keys drop indices outside the TimeFrame", "[TimeJoin]") {
+    TimeFrame const frame(std::vector<int>{0, 10, 20, 30});
+    DenseTimeIndexStorage const storage(TimeFrameIndex(0), 6);
+
+    auto const keys = makeTimeJoinKeys(storage, -1, &frame);
+
+    // Shifted indices are -1..4; only 0..3 exist in the frame
+    REQUIRE(keys.first_position == 1);
+    REQUIRE(keys.keys == std::vector<int64_t>{0, 10, 20, 30});
+}
+
+TEST_CASE("joinTimeSeries - series on different TimeFrames join on clock ticks", "[TimeJoin]") {
+    // Left sampled every 10 ticks, right every 5 ticks
+    TimeFrame const slow(std::vector<int>{0, 10, 20, 30, 40});
+    TimeFrame const fast(std::vector<int>{0, 5, 10, 15, 20, 25, 30, 35, 40});
+
+    DenseTimeIndexStorage const left_storage(TimeFrameIndex(0), 5);
+    SparseTimeIndexStorage const right_storage(
+            {TimeFrameIndex(1), TimeFrameIndex(2), TimeFrameIndex(6), TimeFrameIndex(7)});
+
+    TimeJoinSide const left{&left_storage, &slow, 0};
+    TimeJoinSide const right{&right_storage, &fast, 0};
+
+    SECTION("Inner matches equal clock ticks") {
+        // Right ticks: 5, 10, 30, 35 -> matches slow 10 and 30
+        auto const pairs = toPairs(joinTimeSeries(left, right));
+        Pairs const expected{{1, 1}, {3, 2}};
+        REQUIRE(pairs == expected);
+    }
+
+    SECTION("Backward with tolerance in ticks") {
+        auto const pairs = toPairs(joinTimeSeries(left, right, {TimeJoinKind::Backward, 5}));
+        // 10->10, 20: last <= 20 is 10 (d=10) dropped, 30->30, 40->35 (d=5)
+        Pairs const expected{{1, 1}, {3, 2}, {4, 3}};
+        REQUIRE(pairs == expected);
+    }
+
+    SECTION("Same TimeFrame joins on indices") {
+        TimeJoinSide const same{&right_storage, &slow, 0};
+        auto const pairs = toPairs(joinTimeSeries(left, same));
+        Pairs const expected{{1, 0}, {2, 1}};
+        REQUIRE(pairs == expected);
+    }
+}
@@ -171,6 +171,7 @@ void AnalogTimeSeries::setData(std::vector<float> analog_vector) {
     _data_storage = AnalogDataStorageWrapper(VectorAnalogDataStorage(std::move(analog_vector)));
     _time_storage = TimeIndexStorageFactory::createDenseFromZero(size);
     _cacheOptimizationPointers();
+    _range_index.invalidate();
 }
 
 void AnalogTimeSeries::setData(std::vector<float> analog_vector, std::vector<TimeFrameIndex> time_vector) {
@@ -182,6 +183,7 @@ void AnalogTimeSeries::setData(std::vector<float> analog_vector, std::vector<Tim
     _data_storage = AnalogDataStorageWrapper(VectorAnalogDataStorage(std::move(analog_vector)));
     _time_storage = TimeIndexStorageFactory::createFromTimeIndices(std::move(time_vector));
     _cacheOptimizationPointers();
+    _range_index.invalidate();
 }
 
 void AnalogTimeSeries::setData(std::map<int, float> const & analog_map) {
@@ -198,6 +200,7 @@ void AnalogTimeSeries::setData(std::map<int, float> const & analog_map) {
     _data_storage = AnalogDataStorageWrapper(VectorAnalogDataStorage(std::move(data_vec)));
     _time_storage = std::make_shared<SparseTimeIndexStorage>(std::move(time_vec));
     _cacheOptimizationPointers();
+    _range_index.invalidate();
 }
 
 // ========== Getting Data ==========
@@ -230,13 +233,18 @@ std::span<float const> AnalogTimeSeries::getDataInTimeFrameIndexRange(TimeFrameI
 [[nodiscard]] std::span<float const> AnalogTimeSeries::getDataInTimeFrameIndexRange(TimeFrameIndex start_time,
                                                                                     TimeFrameIndex end_time,
                                                                                     TimeFrame const * source_timeFrame) const {
-    if (source_timeFrame == _time_frame.get()) {
-        return getDataInTimeFrameIndexRange(start_time, end_time);
-    }
+    auto const [target_start_index, target_end_index] =
+            _convertRangeToOwnTimeFrame(start_time, end_time, source_timeFrame);
+    return getDataInTimeFrameIndexRange(target_start_index, target_end_index);
+}
 
-    // If either timeframe is null, fall back to original behavior
-    if (!source_timeFrame || !_time_frame) {
-        return getDataInTimeFrameIndexRange(start_time, end_time);
+std::pair<TimeFrameIndex, TimeFrameIndex> AnalogTimeSeries::_convertRangeToOwnTimeFrame(
+        TimeFrameIndex start_time,
+        TimeFrameIndex end_time,
+        TimeFrame const * source_timeFrame) const {
+    // Same timeframe, or either timeframe is null: use the indices as given
+    if (source_timeFrame == _time_frame.get() || !source_timeFrame || !_time_frame) {
+        return {start_time, end_time};
     }
 
     // Convert the time index from source timeframe to target timeframe
@@ -245,11 +253,54 @@ std::span<float const> AnalogTimeSeries::getDataInTimeFrameIndexRange(TimeFrameI
     auto end_time_value = source_timeFrame->getTimeAtIndex(end_time);
 
     // 2. Convert that time value to an index in the analog timeframe
-    auto target_start_index = _time_frame->getIndexAtTime(start_time_value, false);
-    auto target_end_index = _time_frame->getIndexAtTime(end_time_value);
+    return {_time_frame->getIndexAtTime(start_time_value, false),
+            _time_frame->getIndexAtTime(end_time_value)};
+}
 
-    // 3. Use the converted indices to get the data in the target timeframe
-    return getDataInTimeFrameIndexRange(target_start_index, target_end_index);
+// ========== Interval Reductions ==========
+
+AnalogRangeSummary AnalogTimeSeries::summarizeRange(TimeFrameIndex start_time,
+                                                    TimeFrameIndex end_time,
+                                                    TimeFrame const * source_timeFrame) const {
+    auto const [target_start, target_end] =
+            _convertRangeToOwnTimeFrame(start_time, end_time, source_timeFrame);
+
+    auto const start_index_opt = _findDataArrayIndexGreaterOrEqual(target_start);
+    auto const end_index_opt = _findDataArrayIndexLessOrEqual(target_end);
+    if (!start_index_opt.has_value() || !end_index_opt.has_value() ||
+        start_index_opt->getValue() > end_index_opt->getValue()) {
+        return {};
+    }
+
+    size_t const first = start_index_opt->getValue();
+    size_t const last = end_index_opt->getValue() + 1;
+
+    if (_data_storage.isContiguous()) {
+        auto const values = _data_storage.getSpan();
+        if (auto const index = _range_index.getIfAmortized(values, last - first)) {
+            return index->summarize(values, first, last);
+        }
+        return summarizeAnalogRange(values, first, last);
+    }
+
+    // Non-contiguous storage: copy just this range out and scan it
+    std::vector<float> values;
+    values.reserve(last - first);
+    for (size_t i = first; i < last; ++i) {
+        values.push_back(_data_storage.getValueAt(i));
+    }
+    auto summary = summarizeAnalogRange(values, 0, values.size());
+    summary.first = first;
+    summary.argmin += first;
+    summary.argmax += first;
+    return summary;
+}
+
+std::shared_ptr<AnalogRangeIndex const> AnalogTimeSeries::getRangeIndex() const {
+    if (!_data_storage.isContiguous() || _data_storage.size() == 0) {
+        return nullptr;
+    }
+    return _range_index.getOrBuild(_data_storage.getSpan());
 }
 
 
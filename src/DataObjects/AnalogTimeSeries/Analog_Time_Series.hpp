@@ -9,6 +9,7 @@
 #include "storage/AnalogDataStorage.hpp"
 #include "storage/LazyAnalogDataStorage.hpp"
 #include "storage/MmapAnalogConfig.hpp"
+#include "utils/AnalogRangeIndex.hpp"
 
 #include <cstdint>
 #include <functional>
@@ -18,6 +19,7 @@
 #include <ranges>
 #include <span>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 /**
@@ -365,6 +367,38 @@ public:
                                                                       TimeFrameIndex end_time,
                                                                       TimeFrame const * source_timeFrame) const;
 
+    // ========== Interval Reductions ==========
+
+    /**
+     * @brief Statistics of the samples within a TimeFrameIndex range, without copying them
+     *
+     * Uses the same boundary logic and timeframe conversion as
+     * getDataInTimeFrameIndexRange(). Contiguous storage is scanned in place
+     * until the queried ranges add up to a fraction of the series
+     * (LazyAnalogRangeIndex::kBuildQueryFraction); from then on the range index
+     * answers every statistic of an interval in O(1) plus at most two partial
+     * blocks. Other storage is copied range by range and scanned.
+     *
+     * @param start_time The start time (inclusive boundary)
+     * @param end_time The end time (inclusive boundary)
+     * @param source_timeFrame The timeframe of start/end, or nullptr for this series' own
+     * @return Summary over array positions; empty if no data points fall within the range
+     */
+    [[nodiscard]] AnalogRangeSummary summarizeRange(TimeFrameIndex start_time,
+                                                    TimeFrameIndex end_time,
+                                                    TimeFrame const * source_timeFrame = nullptr) const;
+
+    /**
+     * @brief Range index over all samples, built now if not cached yet
+     *
+     * Explicit opt-in for callers that know they will issue many queries;
+     * summarizeRange() otherwise builds it only once enough has been queried.
+     * Shared by every caller until this series notifies its observers.
+     *
+     * @return The index, or nullptr if the storage is not contiguous
+     */
+    [[nodiscard]] std::shared_ptr<AnalogRangeIndex const> getRangeIndex() const;
+
     // ========== Time-Value Range Access ==========
 
     /**
@@ -658,6 +692,9 @@ private:
     // Cached optimization pointer for fast path access
     float const * _contiguous_data_ptr{nullptr};
 
+    // Interval reduction index, dropped on setData() and on notifyObservers()
+    LazyAnalogRangeIndex _range_index{*this};
+
     // Private constructors for factory methods
     AnalogTimeSeries(AnalogDataStorageWrapper storage, std::vector<TimeFrameIndex> time_vector);
 
@@ -742,6 +779,16 @@ private:
      */
     [[nodiscard]] std::optional<DataArrayIndex> _findDataArrayIndexLessOrEqual(TimeFrameIndex target_time) const;
 
+    /**
+     * @brief Convert [start_time, end_time] from @p source_timeFrame into this series' timeframe
+     *
+     * Returns the inputs unchanged if either timeframe is missing or they are the same.
+     */
+    [[nodiscard]] std::pair<TimeFrameIndex, TimeFrameIndex> _convertRangeToOwnTimeFrame(
+            TimeFrameIndex start_time,
+            TimeFrameIndex end_time,
+            TimeFrame const * source_timeFrame) const;
+
 public:
     // ========== Iteration & Access ==========
 
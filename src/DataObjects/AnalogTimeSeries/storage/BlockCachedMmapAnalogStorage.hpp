@@ -8,7 +8,9 @@
  *
  * Within a single cached block, per-channel data is contiguous, enabling
  * span access via getSpanRangeImpl. Cross-block ranges return empty spans
- * and fall back to element-by-element access.
+ * and fall back to element-by-element access. The block behind a returned span
+ * is pinned until the same thread's next span request on this storage, so
+ * other threads loading blocks cannot overwrite it.
  */
 
 #ifndef BLOCK_CACHED_MMAP_ANALOG_STORAGE_HPP
@@ -20,7 +22,11 @@
 #include <cassert>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <span>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 
 /**
  * @brief Analog storage backend for one channel of a block-cached mmap file.
@@ -74,12 +80,14 @@ public:
             return {};
         }
         std::size_t const count = end - start;
-        auto span = _cache->getChannelBlockSpan(_channel, start, count);
+        auto pinned = _cache->getChannelBlockSpan(_channel, start, count);
         // Only return if the entire range fits in one block
-        if (span.size() == count) {
-            return span;
+        if (pinned.size() != count) {
+            return {};
         }
-        return {};
+        auto const span = pinned.span();
+        _pins.hold(std::move(pinned));
+        return span;
     }
 
     [[nodiscard]] bool isContiguousImpl() const {
@@ -107,8 +115,29 @@ public:
     }
 
 private:
+    /// @brief Block behind each thread's latest span; copies and moves start empty
+    class ThreadPins {
+    public:
+        ThreadPins() = default;
+        ThreadPins(ThreadPins const &) {}
+        ThreadPins(ThreadPins &&) noexcept {}
+        ThreadPins & operator=(ThreadPins const &) { return *this; }
+        ThreadPins & operator=(ThreadPins &&) noexcept { return *this; }
+        ~ThreadPins() = default;
+
+        void hold(PinnedBlockSpan pinned) const {
+            std::lock_guard<std::mutex> const lock(_mutex);
+            _pins[std::this_thread::get_id()] = std::move(pinned);
+        }
+
+    private:
+        mutable std::mutex _mutex;
+        mutable std::unordered_map<std::thread::id, PinnedBlockSpan> _pins;
+    };
+
     std::shared_ptr<SharedMmapBlockCache const> _cache;
     std::size_t _channel;
+    ThreadPins _pins;
 };
 
 #endif// BLOCK_CACHED_MMAP_ANALOG_STORAGE_HPP
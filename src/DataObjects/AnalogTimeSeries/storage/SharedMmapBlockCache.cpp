@@ -7,8 +7,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <unordered_set>
 
 #ifdef _WIN32
 #ifndef WIN32_LEAN_AND_MEAN
@@ -43,6 +48,115 @@ struct SharedMmapBlockCache::PlatformMmapState {
 };
 #endif
 
+// ============================================================================
+// Read-ahead worker and per-thread access tracking
+// ============================================================================
+
+namespace {
+
+constexpr std::size_t no_block = std::numeric_limits<std::size_t>::max();
+
+/**
+ * @brief Block most recently used by this thread, per cache
+ *
+ * Only the latest cache is remembered; a thread alternating between two
+ * caches simply loses sequential detection.
+ */
+struct AccessCursor {
+    void const * cache = nullptr;
+    std::size_t block = no_block;
+    std::size_t run = 0;///< Consecutive forward block steps
+};
+
+thread_local AccessCursor t_cursor;
+
+template<typename T>
+void decodeInterleaved(char const * src,
+                       std::size_t frames,
+                       std::size_t num_channels,
+                       std::size_t channel_stride,
+                       float scale_factor,
+                       float offset_value,
+                       float * dst) {
+    for (std::size_t t = 0; t < frames; ++t) {
+        char const * frame = src + t * num_channels * sizeof(T);
+        for (std::size_t ch = 0; ch < num_channels; ++ch) {
+            T value;
+            std::memcpy(&value, frame + ch * sizeof(T), sizeof(T));
+            dst[ch * channel_stride + t] = static_cast<float>(value) * scale_factor + offset_value;
+        }
+    }
+}
+
+}// anonymous namespace
+
+struct SharedMmapBlockCache::Prefetcher {
+    explicit Prefetcher(SharedMmapBlockCache const & owner)
+        : cache(owner) {}
+
+    ~Prefetcher() {
+        {
+            std::lock_guard<std::mutex> const lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    Prefetcher(Prefetcher const &) = delete;
+    Prefetcher & operator=(Prefetcher const &) = delete;
+    Prefetcher(Prefetcher &&) = delete;
+    Prefetcher & operator=(Prefetcher &&) = delete;
+
+    /// Queue @p block_index unless it is already queued or being decoded
+    void enqueue(std::size_t block_index) {
+        {
+            std::lock_guard<std::mutex> const lock(mutex);
+            if (stopping || !pending.insert(block_index).second) {
+                return;
+            }
+            queue.push_back(block_index);
+            if (!worker.joinable()) {
+                worker = std::thread([this] { run(); });
+            }
+        }
+        cv.notify_one();
+    }
+
+    void run() {
+        std::vector<float> scratch;
+        for (;;) {
+            std::size_t block_index = no_block;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (stopping) {
+                    return;
+                }
+                block_index = queue.front();
+                queue.pop_front();
+            }
+            try {
+                cache._prefetchBlock(block_index, scratch);
+            } catch (...) {
+                // Read-ahead is best effort; a failed decode is retried on demand
+            }
+            std::lock_guard<std::mutex> const lock(mutex);
+            pending.erase(block_index);
+        }
+    }
+
+    SharedMmapBlockCache const & cache;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::size_t> queue;
+    std::unordered_set<std::size_t> pending;///< Queued or being decoded
+    bool stopping = false;
+    std::thread worker;///< Started on the first request
+};
+
 // ============================================================================
 // Construction / Destruction
 // ============================================================================
@@ -72,18 +186,69 @@ SharedMmapBlockCache::SharedMmapBlockCache(SharedMmapBlockCacheConfig config)
     _total_blocks = (_num_samples_per_channel + _config.block_size_samples - 1) /
                     _config.block_size_samples;
 
-    // Initialize cache slots
-    auto const slots = std::min(_config.max_cached_blocks, _total_blocks);
-    _cache.resize(slots);
-    for (auto & block: _cache) {
-        block.data.resize(_config.block_size_samples * _config.num_channels, 0.0f);
+    // Initialize cache slots, striped over shards (block b -> shard b % n)
+    _total_slots = std::max<std::size_t>(std::min(_config.max_cached_blocks, _total_blocks), 1);
+    std::size_t num_shards = _config.num_shards != 0 ? _config.num_shards
+                                                     : std::max<std::size_t>(_total_slots / 4, 1);
+    num_shards = std::min(num_shards, _total_slots);
+
+    _shards = std::vector<Shard>(num_shards);
+    for (std::size_t i = 0; i < num_shards; ++i) {
+        std::size_t const slots = _total_slots / num_shards + (i < _total_slots % num_shards ? 1 : 0);
+        _shards[i].slots = std::vector<CachedBlock>(slots);
+    }
+
+    if (_config.readahead_blocks > 0 && _total_blocks > 1) {
+        _prefetcher = std::make_unique<Prefetcher>(*this);
     }
 }
 
 SharedMmapBlockCache::~SharedMmapBlockCache() {
+    // Stop read-ahead before the mapping it decodes from goes away
+    _prefetcher.reset();
     _closeAndUnmap();
 }
 
+// ============================================================================
+// Block Access
+// ============================================================================
+
+template<typename Read>
+auto SharedMmapBlockCache::_withBlock(std::size_t block_index, Read && read) const {
+    bool sequential = false;
+    std::uint64_t tick = _noteAccess(block_index, sequential);
+    auto & shard = _shardFor(block_index);
+
+    {
+        std::shared_lock<std::shared_mutex> const lock(shard.mutex);
+        if (auto * slot = _findSlot(shard, block_index)) {
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            _markUse(*slot, tick);
+            return read(*slot);
+        }
+    }
+
+    // Miss: decode outside the lock so readers of this shard are not blocked.
+    // Two threads missing on the same block may both decode it; the second
+    // install is dropped below.
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+    thread_local std::vector<float> scratch;
+    _decodeBlock(scratch, block_index);
+
+    std::unique_lock<std::shared_mutex> const lock(shard.mutex);
+    auto * slot = _findSlot(shard, block_index);
+    if (slot == nullptr) {
+        slot = _selectVictim(shard, sequential ? VictimPolicy::Scan : VictimPolicy::Demand);
+        _installBlock(*slot, block_index, scratch, false);
+    }
+    if (tick == 0) {
+        // Same block as this thread's previous access, but it was evicted in between
+        tick = _use_tick.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    _markUse(*slot, tick);
+    return read(*slot);
+}
+
 // ============================================================================
 // Public API
 // ============================================================================
@@ -95,12 +260,12 @@ float SharedMmapBlockCache::getValue(std::size_t time_sample, std::size_t channe
     std::size_t const block_index = time_sample / _config.block_size_samples;
     std::size_t const offset_in_block = time_sample % _config.block_size_samples;
 
-    std::lock_guard<std::mutex> const lock(_mutex);
-    auto const & block = _getOrLoadBlock(block_index);
-    return block.data[channel * _config.block_size_samples + offset_in_block];
+    return _withBlock(block_index, [&](CachedBlock const & block) {
+        return (*block.data)[channel * _config.block_size_samples + offset_in_block];
+    });
 }
 
-std::span<float const> SharedMmapBlockCache::getChannelBlockSpan(
+PinnedBlockSpan SharedMmapBlockCache::getChannelBlockSpan(
         std::size_t channel,
         std::size_t start_sample,
         std::size_t max_count) const {
@@ -110,68 +275,232 @@ std::span<float const> SharedMmapBlockCache::getChannelBlockSpan(
     std::size_t const block_index = start_sample / _config.block_size_samples;
     std::size_t const offset_in_block = start_sample % _config.block_size_samples;
 
-    std::lock_guard<std::mutex> const lock(_mutex);
-    auto const & block = _getOrLoadBlock(block_index);
-
     // How many samples are available in this block from offset_in_block?
     std::size_t const actual_size = _actualBlockSize(block_index);
     std::size_t const available = actual_size - offset_in_block;
     std::size_t const count = std::min(max_count, available);
 
-    float const * ptr = block.data.data() + channel * _config.block_size_samples + offset_in_block;
-    return {ptr, count};
+    return _withBlock(block_index, [&](CachedBlock const & block) {
+        float const * ptr = block.data->data() + channel * _config.block_size_samples + offset_in_block;
+        return PinnedBlockSpan{block.data, std::span<float const>{ptr, count}};
+    });
+}
+
+SharedMmapBlockCacheStats SharedMmapBlockCache::stats() const {
+    SharedMmapBlockCacheStats result;
+    for (auto const & shard: _shards) {
+        result.hits += shard.hits.load(std::memory_order_relaxed);
+        result.misses += shard.misses.load(std::memory_order_relaxed);
+    }
+    result.readahead_loads = _readahead_loads.load(std::memory_order_relaxed);
+    result.readahead_hits = _readahead_hits.load(std::memory_order_relaxed);
+    return result;
 }
 
 // ============================================================================
 // Cache Management
 // ============================================================================
 
-SharedMmapBlockCache::CachedBlock const &
-SharedMmapBlockCache::_getOrLoadBlock(std::size_t block_index) const {
-    // Linear scan for cache hit (OK for small max_cached_blocks, typically 8-16)
-    for (auto const & slot: _cache) {
+SharedMmapBlockCache::Shard & SharedMmapBlockCache::_shardFor(std::size_t block_index) const {
+    return _shards[block_index % _shards.size()];
+}
+
+SharedMmapBlockCache::CachedBlock *
+SharedMmapBlockCache::_findSlot(Shard & shard, std::size_t block_index) {
+    // Linear scan for cache hit (a shard holds only a few slots)
+    for (auto & slot: shard.slots) {
         if (slot.block_index == block_index) {
-            return slot;
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+SharedMmapBlockCache::CachedBlock *
+SharedMmapBlockCache::_selectVictim(Shard & shard, VictimPolicy policy) const {
+    auto & slots = shard.slots;
+    std::size_t const n = slots.size();
+
+    for (auto & slot: slots) {
+        if (slot.block_index == no_block) {
+            return &slot;
         }
     }
 
-    // Cache miss — evict and load
-    auto & victim = _cache[_next_evict];
-    _next_evict = (_next_evict + 1) % _cache.size();
-    _loadBlock(victim, block_index);
-    return victim;
+    if (policy != VictimPolicy::Demand) {
+        // One sweep that leaves reference bits alone. Read-ahead additionally
+        // spares blocks used within the last cache-full of block transitions,
+        // which covers the block the scanning thread is reading right now.
+        std::uint64_t const now = _use_tick.load(std::memory_order_relaxed);
+        for (std::size_t step = 0; step < n; ++step) {
+            std::size_t const i = (shard.hand + step) % n;
+            auto & slot = slots[i];
+            if (slot.referenced.load(std::memory_order_relaxed)) {
+                continue;
+            }
+            if (policy == VictimPolicy::Readahead) {
+                auto const last = slot.last_use.load(std::memory_order_relaxed);
+                if (last != 0 && last + _total_slots > now) {
+                    continue;
+                }
+            }
+            shard.hand = (i + 1) % n;
+            return &slot;
+        }
+        if (policy == VictimPolicy::Readahead) {
+            return nullptr;
+        }
+    }
+
+    // CLOCK: referenced slots get a second chance; two sweeps always find a victim
+    for (std::size_t step = 0; step < 2 * n; ++step) {
+        auto & slot = slots[shard.hand];
+        shard.hand = (shard.hand + 1) % n;
+        if (!slot.referenced.exchange(false, std::memory_order_relaxed)) {
+            return &slot;
+        }
+    }
+    auto & slot = slots[shard.hand];
+    shard.hand = (shard.hand + 1) % n;
+    return &slot;
 }
 
-void SharedMmapBlockCache::_loadBlock(CachedBlock & block, std::size_t block_index) const {
-    block.block_index = block_index;
+void SharedMmapBlockCache::_installBlock(CachedBlock & slot,
+                                         std::size_t block_index,
+                                         std::vector<float> & decoded,
+                                         bool prefetched) const {
+    // Replace rather than overwrite: callers may still pin the evicted block
+    slot.data = std::make_shared<std::vector<float> const>(std::move(decoded));
+    decoded.clear();
+    slot.block_index = block_index;
+    slot.last_use.store(0, std::memory_order_relaxed);
+    slot.referenced.store(false, std::memory_order_relaxed);
+    slot.prefetched.store(prefetched, std::memory_order_relaxed);
+}
 
-    std::size_t const block_start_sample = block_index * _config.block_size_samples;
-    std::size_t const actual_size = _actualBlockSize(block_index);
+void SharedMmapBlockCache::_markUse(CachedBlock & slot, std::uint64_t tick) const {
+    if (tick == 0) {
+        return;// Still inside the block this thread used last
+    }
+    if (slot.last_use.exchange(tick, std::memory_order_relaxed) != 0) {
+        slot.referenced.store(true, std::memory_order_relaxed);
+    } else if (slot.prefetched.exchange(false, std::memory_order_relaxed)) {
+        _readahead_hits.fetch_add(1, std::memory_order_relaxed);
+    }
+}
 
-    auto const * base_ptr = static_cast<char const *>(_platform->mapped_data);
+std::uint64_t SharedMmapBlockCache::_noteAccess(std::size_t block_index, bool & sequential) const {
+    auto & cursor = t_cursor;
+    if (cursor.cache == this && cursor.block == block_index) {
+        sequential = cursor.run > 0;
+        return 0;
+    }
 
-    // Decode interleaved data into column-major float buffer
-    for (std::size_t t = 0; t < actual_size; ++t) {
-        std::size_t const global_sample = block_start_sample + t;
-        for (std::size_t ch = 0; ch < _config.num_channels; ++ch) {
-            std::size_t const element_index = global_sample * _config.num_channels + ch;
-            std::size_t const byte_offset = _config.header_size + element_index * _element_size;
-            void const * data_ptr = base_ptr + byte_offset;
+    bool const forward_step = cursor.cache == this && cursor.block != no_block &&
+                              block_index == cursor.block + 1;
+    cursor.run = forward_step ? cursor.run + 1 : 0;
+    cursor.cache = this;
+    cursor.block = block_index;
 
-            float value = _convertToFloat(data_ptr);
-            value = value * _config.scale_factor + _config.offset_value;
+    sequential = cursor.run > 0;
+    if (sequential) {
+        _requestReadahead(block_index, cursor.run);
+    }
+    return _use_tick.fetch_add(1, std::memory_order_relaxed) + 1;
+}
 
-            block.data[ch * _config.block_size_samples + t] = value;
+void SharedMmapBlockCache::_requestReadahead(std::size_t block_index, std::size_t run_length) const {
+    if (!_prefetcher) {
+        return;
+    }
+    // Window doubles with the scan length, capped by the config and by half
+    // the cache so read-ahead cannot flush it.
+    std::size_t const ramp = std::size_t{1} << std::min<std::size_t>(run_length - 1, 16);
+    std::size_t const cap = std::max<std::size_t>(std::min(_config.readahead_blocks, _total_slots / 2), 1);
+    std::size_t const window = std::min(ramp, cap);
+
+    for (std::size_t k = 1; k <= window; ++k) {
+        std::size_t const next = block_index + k;
+        if (next >= _total_blocks) {
+            break;
+        }
+        if (!_isCached(next)) {
+            _prefetcher->enqueue(next);
         }
     }
+}
+
+void SharedMmapBlockCache::_prefetchBlock(std::size_t block_index, std::vector<float> & scratch) const {
+    if (_isCached(block_index)) {
+        return;
+    }
+    _decodeBlock(scratch, block_index);
+
+    auto & shard = _shardFor(block_index);
+    std::unique_lock<std::shared_mutex> const lock(shard.mutex);
+    if (_findSlot(shard, block_index) != nullptr) {
+        return;
+    }
+    if (auto * slot = _selectVictim(shard, VictimPolicy::Readahead)) {
+        _installBlock(*slot, block_index, scratch, true);
+        _readahead_loads.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool SharedMmapBlockCache::_isCached(std::size_t block_index) const {
+    auto & shard = _shardFor(block_index);
+    std::shared_lock<std::shared_mutex> const lock(shard.mutex);
+    return _findSlot(shard, block_index) != nullptr;
+}
+
+void SharedMmapBlockCache::_decodeBlock(std::vector<float> & out, std::size_t block_index) const {
+    std::size_t const block_start_sample = block_index * _config.block_size_samples;
+    std::size_t const actual_size = _actualBlockSize(block_index);
+    std::size_t const stride = _config.block_size_samples;
+    std::size_t const num_channels = _config.num_channels;
+
+    out.resize(stride * num_channels);
+
+    auto const * src = static_cast<char const *>(_platform->mapped_data) + _config.header_size +
+                       block_start_sample * num_channels * _element_size;
+    float const scale = _config.scale_factor;
+    float const offset = _config.offset_value;
+
+    // Decode interleaved data into column-major float buffer
+    switch (_config.data_type) {
+        case MmapDataType::Float32:
+            decodeInterleaved<float>(src, actual_size, num_channels, stride, scale, offset, out.data());
+            break;
+        case MmapDataType::Float64:
+            decodeInterleaved<double>(src, actual_size, num_channels, stride, scale, offset, out.data());
+            break;
+        case MmapDataType::Int8:
+            decodeInterleaved<int8_t>(src, actual_size, num_channels, stride, scale, offset, out.data());
+            break;
+        case MmapDataType::UInt8:
+            decodeInterleaved<uint8_t>(src, actual_size, num_channels, stride, scale, offset, out.data());
+            break;
+        case MmapDataType::Int16:
+            decodeInterleaved<int16_t>(src, actual_size, num_channels, stride, scale, offset, out.data());
+            break;
+        case MmapDataType::UInt16:
+            decodeInterleaved<uint16_t>(src, actual_size, num_channels, stride, scale, offset, out.data());
+            break;
+        case MmapDataType::Int32:
+            decodeInterleaved<int32_t>(src, actual_size, num_channels, stride, scale, offset, out.data());
+            break;
+        case MmapDataType::UInt32:
+            decodeInterleaved<uint32_t>(src, actual_size, num_channels, stride, scale, offset, out.data());
+            break;
+        default:
+            throw std::runtime_error("SharedMmapBlockCache: unknown data type");
+    }
 
     // Zero-fill remainder of last block (if partial)
-    if (actual_size < _config.block_size_samples) {
-        for (std::size_t ch = 0; ch < _config.num_channels; ++ch) {
-            std::size_t const start = ch * _config.block_size_samples + actual_size;
-            std::size_t const end = (ch + 1) * _config.block_size_samples;
-            std::fill(block.data.begin() + static_cast<long>(start),
-                      block.data.begin() + static_cast<long>(end),
+    if (actual_size < stride) {
+        for (std::size_t ch = 0; ch < num_channels; ++ch) {
+            std::fill(out.begin() + static_cast<long>(ch * stride + actual_size),
+                      out.begin() + static_cast<long>((ch + 1) * stride),
                       0.0f);
         }
     }
@@ -186,53 +515,6 @@ std::size_t SharedMmapBlockCache::_actualBlockSize(std::size_t block_index) cons
 // Type Conversion
 // ============================================================================
 
-float SharedMmapBlockCache::_convertToFloat(void const * ptr) const {
-    switch (_config.data_type) {
-        case MmapDataType::Float32: {
-            float value;
-            std::memcpy(&value, ptr, sizeof(float));
-            return value;
-        }
-        case MmapDataType::Float64: {
-            double value;
-            std::memcpy(&value, ptr, sizeof(double));
-            return static_cast<float>(value);
-        }
-        case MmapDataType::Int8: {
-            int8_t value;
-            std::memcpy(&value, ptr, sizeof(int8_t));
-            return static_cast<float>(value);
-        }
-        case MmapDataType::UInt8: {
-            uint8_t value;
-            std::memcpy(&value, ptr, sizeof(uint8_t));
-            return static_cast<float>(value);
-        }
-        case MmapDataType::Int16: {
-            int16_t value;
-            std::memcpy(&value, ptr, sizeof(int16_t));
-            return static_cast<float>(value);
-        }
-        case MmapDataType::UInt16: {
-            uint16_t value;
-            std::memcpy(&value, ptr, sizeof(uint16_t));
-            return static_cast<float>(value);
-        }
-        case MmapDataType::Int32: {
-            int32_t value;
-            std::memcpy(&value, ptr, sizeof(int32_t));
-            return static_cast<float>(value);
-        }
-        case MmapDataType::UInt32: {
-            uint32_t value;
-            std::memcpy(&value, ptr, sizeof(uint32_t));
-            return static_cast<float>(value);
-        }
-        default:
-            throw std::runtime_error("SharedMmapBlockCache: unknown data type");
-    }
-}
-
 std::size_t SharedMmapBlockCache::_getElementSize() const {
     switch (_config.data_type) {
         case MmapDataType::Float32:
@@ -10,6 +10,11 @@
  * Block layout in cache is column-major: all samples for channel 0, then all
  * samples for channel 1, etc. This enables contiguous per-channel span access
  * within a single block.
+ *
+ * Cached blocks are split across lock-striped shards (block `b` lives in shard
+ * `b % num_shards`); hits take a shared lock on one shard only. Eviction is
+ * CLOCK with scan resistance, and sequential block-to-block access triggers
+ * asynchronous read-ahead of the following blocks.
  */
 
 #ifndef SHARED_MMAP_BLOCK_CACHE_HPP
@@ -17,12 +22,15 @@
 
 #include "MmapAnalogConfig.hpp"
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <limits>
 #include <memory>
-#include <mutex>
+#include <shared_mutex>
 #include <span>
+#include <utility>
 #include <vector>
 
 /**
@@ -37,26 +45,81 @@ struct SharedMmapBlockCacheConfig {
     float offset_value = 0.0f;                   ///< Additive offset applied on decode
     std::size_t block_size_samples = 4096;       ///< Samples per channel per block
     std::size_t max_cached_blocks = 16;          ///< Maximum blocks held in cache
+    std::size_t readahead_blocks = 4;            ///< Most blocks read ahead of a sequential scan (0 disables)
+    std::size_t num_shards = 0;                  ///< Lock stripes over the cache (0 = one per 4 blocks)
+};
+
+/**
+ * @brief Access counters of a SharedMmapBlockCache.
+ *
+ * Counters are updated with relaxed atomics, so a snapshot taken while other
+ * threads read is approximate.
+ */
+struct SharedMmapBlockCacheStats {
+    std::uint64_t hits = 0;           ///< Accesses served from a cached block
+    std::uint64_t misses = 0;         ///< Accesses that decoded a block on the calling thread
+    std::uint64_t readahead_loads = 0;///< Blocks decoded by read-ahead
+    std::uint64_t readahead_hits = 0; ///< Read-ahead blocks that were later used
+};
+
+/**
+ * @brief Span into one cached block that keeps the block alive.
+ *
+ * Holds shared ownership of the decoded block, so the samples stay valid after
+ * the cache evicts or replaces the block. Copies share the same block.
+ */
+class PinnedBlockSpan {
+public:
+    PinnedBlockSpan() = default;
+    PinnedBlockSpan(std::shared_ptr<std::vector<float> const> block, std::span<float const> samples)
+        : _block(std::move(block)),
+          _samples(samples) {}
+
+    [[nodiscard]] std::span<float const> span() const noexcept { return _samples; }
+    [[nodiscard]] std::size_t size() const noexcept { return _samples.size(); }
+    [[nodiscard]] bool empty() const noexcept { return _samples.empty(); }
+    [[nodiscard]] float const * data() const noexcept { return _samples.data(); }
+    [[nodiscard]] float operator[](std::size_t i) const { return _samples[i]; }
+    [[nodiscard]] float front() const { return _samples.front(); }
+    [[nodiscard]] auto begin() const noexcept { return _samples.begin(); }
+    [[nodiscard]] auto end() const noexcept { return _samples.end(); }
+
+private:
+    std::shared_ptr<std::vector<float> const> _block;
+    std::span<float const> _samples;
 };
 
 /**
  * @brief Shared block-cached memory-mapped storage for interleaved multi-channel data.
  *
- * Opens a single mmap for the entire file. Maintains a FIFO circular buffer of
+ * Opens a single mmap for the entire file and caches up to `max_cached_blocks`
  * decoded float blocks. Each block covers `block_size_samples` time steps for
  * all channels. Data is decoded (type-converted, scaled, offset) at block load
- * time.
+ * time, outside any lock.
+ *
+ * Caching policy:
+ * - Each thread's accesses are tracked at block granularity. Moving to a block
+ *   counts as a use; the first use after a block is loaded leaves it eligible
+ *   for eviction, a second use sets its CLOCK reference bit. A one-pass scan
+ *   therefore never protects its blocks, while blocks a viewer revisits do.
+ * - A thread that moves to block `b + 1` after block `b` is scanning: its
+ *   misses recycle unreferenced slots without clearing reference bits, and up
+ *   to `readahead_blocks` following blocks (doubling with the scan length) are
+ *   decoded by a background thread. Read-ahead never evicts a referenced or
+ *   recently used block.
  *
  * Intended to be shared (via `std::shared_ptr`) between a `MmapTensorStorage`
  * and multiple `BlockCachedMmapAnalogStorage` instances.
  *
- * @note Spans returned by `getChannelBlockSpan()` are invalidated when the
- *       underlying block is evicted. Callers must not hold spans across
- *       operations that may trigger cache eviction.
+ * Blocks are immutable once installed; eviction drops the cache's reference
+ * instead of overwriting the buffer, so a `PinnedBlockSpan` returned by
+ * `getChannelBlockSpan()` stays valid while other threads load blocks.
  *
  * @pre config.num_channels >= 1
  * @pre config.block_size_samples >= 1
  * @pre config.max_cached_blocks >= 1
+ *
+ * @note All const member functions are safe to call concurrently.
  */
 class SharedMmapBlockCache {
 public:
@@ -85,18 +148,18 @@ public:
      * @brief Get a contiguous span of decoded floats for one channel within a block.
      *
      * Returns up to `max_count` samples starting at `start_sample`. The span
-     * is limited to the current block boundary. The returned span is valid
-     * until the block is evicted by subsequent cache operations.
+     * is limited to the current block boundary. The returned handle pins the
+     * block, so it stays valid after the block is evicted.
      *
      * @param channel Channel index.
      * @param start_sample Starting time sample index.
      * @param max_count Maximum number of samples to return.
-     * @return Span of decoded floats. May be shorter than max_count at block/file boundary.
+     * @return Pinned span of decoded floats. May be shorter than max_count at block/file boundary.
      *
      * @pre channel < numChannels()
      * @pre start_sample < numSamplesPerChannel()
      */
-    [[nodiscard]] std::span<float const> getChannelBlockSpan(
+    [[nodiscard]] PinnedBlockSpan getChannelBlockSpan(
             std::size_t channel,
             std::size_t start_sample,
             std::size_t max_count) const;
@@ -105,16 +168,52 @@ public:
     [[nodiscard]] std::size_t numChannels() const noexcept { return _config.num_channels; }
     [[nodiscard]] std::size_t blockSizeSamples() const noexcept { return _config.block_size_samples; }
     [[nodiscard]] SharedMmapBlockCacheConfig const & config() const noexcept { return _config; }
+    [[nodiscard]] std::size_t numShards() const noexcept { return _shards.size(); }
+
+    /**
+     * @brief Snapshot of the hit/miss/read-ahead counters.
+     */
+    [[nodiscard]] SharedMmapBlockCacheStats stats() const;
 
 private:
     struct CachedBlock {
-        std::size_t block_index = std::numeric_limits<std::size_t>::max();
-        std::vector<float> data;///< Column-major: [ch0 samples..., ch1 samples..., ...]
+        std::size_t block_index = std::numeric_limits<std::size_t>::max();///< Guarded by the shard mutex
+        std::shared_ptr<std::vector<float> const> data;///< Column-major: [ch0 samples..., ch1 samples..., ...]; never modified once installed
+        std::atomic<std::uint64_t> last_use{0};///< Use tick of the latest use (0 = unused since load)
+        std::atomic<bool> referenced{false};   ///< Used again since load (CLOCK second chance)
+        std::atomic<bool> prefetched{false};   ///< Loaded by read-ahead and not used yet
     };
 
-    [[nodiscard]] CachedBlock const & _getOrLoadBlock(std::size_t block_index) const;
-    void _loadBlock(CachedBlock & block, std::size_t block_index) const;
-    [[nodiscard]] float _convertToFloat(void const * ptr) const;
+    struct Shard {
+        std::shared_mutex mutex;
+        std::vector<CachedBlock> slots;
+        std::size_t hand = 0;///< CLOCK hand, guarded by the exclusive lock
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+    };
+
+    enum class VictimPolicy {
+        Demand,   ///< Plain CLOCK: clears reference bits while sweeping
+        Scan,     ///< Prefer unreferenced slots; fall back to Demand
+        Readahead,///< Unreferenced, not recently used slots only; may find none
+    };
+
+    /// @brief Defined in the .cpp; background read-ahead queue and thread
+    struct Prefetcher;
+
+    template<typename Read>
+    auto _withBlock(std::size_t block_index, Read && read) const;
+
+    [[nodiscard]] Shard & _shardFor(std::size_t block_index) const;
+    [[nodiscard]] static CachedBlock * _findSlot(Shard & shard, std::size_t block_index);
+    [[nodiscard]] CachedBlock * _selectVictim(Shard & shard, VictimPolicy policy) const;
+    void _installBlock(CachedBlock & slot, std::size_t block_index, std::vector<float> & decoded, bool prefetched) const;
+    void _markUse(CachedBlock & slot, std::uint64_t tick) const;
+    [[nodiscard]] std::uint64_t _noteAccess(std::size_t block_index, bool & sequential) const;
+    void _requestReadahead(std::size_t block_index, std::size_t run_length) const;
+    void _prefetchBlock(std::size_t block_index, std::vector<float> & scratch) const;
+    [[nodiscard]] bool _isCached(std::size_t block_index) const;
+    void _decodeBlock(std::vector<float> & out, std::size_t block_index) const;
     [[nodiscard]] std::size_t _getElementSize() const;
     [[nodiscard]] std::size_t _actualBlockSize(std::size_t block_index) const;
     void _openAndMapFile();
@@ -130,9 +229,12 @@ private:
     std::unique_ptr<PlatformMmapState> _platform;
 
     // Block cache (mutable for const access pattern)
-    mutable std::vector<CachedBlock> _cache;
-    mutable std::size_t _next_evict = 0;
-    mutable std::mutex _mutex;
+    mutable std::vector<Shard> _shards;
+    std::size_t _total_slots = 0;
+    mutable std::atomic<std::uint64_t> _use_tick{0};
+    mutable std::atomic<std::uint64_t> _readahead_loads{0};
+    mutable std::atomic<std::uint64_t> _readahead_hits{0};
+    std::unique_ptr<Prefetcher> _prefetcher;///< Null when readahead_blocks == 0
 };
 
 #endif// SHARED_MMAP_BLOCK_CACHE_HPP
@@ -0,0 +1,252 @@
+/**
+ * @file SharedMmapBlockCache.test.cpp
+ * @brief Unit tests for SharedMmapBlockCache (sharded block cache over an interleaved file)
+ *
+ * Tests cover:
+ * - Decoded values across block boundaries and shards
+ * - Hit/miss accounting
+ * - Scan resistance: a one-pass scan does not evict re-used blocks
+ * - Read-ahead on sequential block access
+ * - Concurrent readers
+ * - Pinned spans survive eviction by concurrent readers and read-ahead
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "AnalogTimeSeries/storage/SharedMmapBlockCache.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// Value stored for (sample, channel); fits in int16
+int16_t sampleValue(std::size_t t, std::size_t ch) {
+    return static_cast<int16_t>(static_cast<int>((t * 7 + ch * 101) % 20000) - 10000);
+}
+
+class BlockCacheTestFile {
+public:
+    BlockCacheTestFile(std::size_t num_channels, std::size_t num_samples) {
+        path = std::filesystem::temp_directory_path() /
+               ("whiskertoolbox_block_cache_test_" + std::to_string(std::time(nullptr)) + "_" +
+                std::to_string(num_channels) + "_" + std::to_string(num_samples) + ".bin");
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        for (std::size_t t = 0; t < num_samples; ++t) {
+            for (std::size_t ch = 0; ch < num_channels; ++ch) {
+                int16_t const v = sampleValue(t, ch);
+                out.write(reinterpret_cast<char const *>(&v), sizeof(v));
+            }
+        }
+    }
+
+    ~BlockCacheTestFile() {
+        std::filesystem::remove(path);
+    }
+
+    BlockCacheTestFile(BlockCacheTestFile const &) = delete;
+    BlockCacheTestFile & operator=(BlockCacheTestFile const &) = delete;
+
+    std::filesystem::path path;
+};
+
+SharedMmapBlockCacheConfig makeConfig(std::filesystem::path const & path, std::size_t num_channels) {
+    SharedMmapBlockCacheConfig config;
+    config.file_path = path;
+    config.num_channels = num_channels;
+    config.data_type = MmapDataType::Int16;
+    config.block_size_samples = 64;
+    return config;
+}
+
+}// namespace
+
+TEST_CASE("SharedMmapBlockCache - values across blocks and shards", "[SharedMmapBlockCache]") {
+    BlockCacheTestFile const file(3, 1000);
+
+    auto config = makeConfig(file.path, 3);
+    config.max_cached_blocks = 8;
+    config.num_shards = 4;
+    config.scale_factor = 0.5f;
+    config.offset_value = 1.0f;
+    SharedMmapBlockCache const cache(config);
+
+    REQUIRE(cache.numSamplesPerChannel() == 1000);
+    REQUIRE(cache.numShards() == 4);
+
+    for (std::size_t t = 0; t < 1000; t += 13) {
+        for (std::size_t ch = 0; ch < 3; ++ch) {
+            REQUIRE(cache.getValue(t, ch) == static_cast<float>(sampleValue(t, ch)) * 0.5f + 1.0f);
+        }
+    }
+
+    SECTION("Spans stop at the block boundary") {
+        auto span = cache.getChannelBlockSpan(2, 60, 100);
+        REQUIRE(span.size() == 4);
+        REQUIRE(span[3] == static_cast<float>(sampleValue(63, 2)) * 0.5f + 1.0f);
+
+        auto last = cache.getChannelBlockSpan(0, 990, 100);
+        REQUIRE(last.size() == 10);
+    }
+}
+
+TEST_CASE("SharedMmapBlockCache - hit and miss counters", "[SharedMmapBlockCache]") {
+    BlockCacheTestFile const file(2, 640);
+
+    auto config = makeConfig(file.path, 2);
+    config.max_cached_blocks = 4;
+    config.readahead_blocks = 0;
+    SharedMmapBlockCache const cache(config);
+
+    (void) cache.getValue(0, 0); // miss
+    (void) cache.getValue(1, 1); // hit
+    (void) cache.getValue(200, 0);// miss (block 3)
+    (void) cache.getValue(5, 0); // hit
+
+    auto const stats = cache.stats();
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.hits == 2);
+    REQUIRE(stats.readahead_loads == 0);
+}
+
+TEST_CASE("SharedMmapBlockCache - scan does not evict re-used blocks", "[SharedMmapBlockCache]") {
+    BlockCacheTestFile const file(2, 64 * 40);
+
+    auto config = makeConfig(file.path, 2);
+    config.max_cached_blocks = 4;
+    config.num_shards = 1;
+    config.readahead_blocks = 0;
+    SharedMmapBlockCache const cache(config);
+
+    // A viewer revisits blocks 0 and 1
+    for (int pass = 0; pass < 2; ++pass) {
+        (void) cache.getValue(10, 0);
+        (void) cache.getValue(70, 0);
+    }
+
+    // A transform scans every later block once
+    for (std::size_t t = 128; t < 64 * 40; ++t) {
+        (void) cache.getValue(t, 1);
+    }
+
+    auto const misses_before = cache.stats().misses;
+    REQUIRE(cache.getValue(10, 0) == static_cast<float>(sampleValue(10, 0)));
+    REQUIRE(cache.getValue(70, 1) == static_cast<float>(sampleValue(70, 1)));
+    REQUIRE(cache.stats().misses == misses_before);
+}
+
+TEST_CASE("SharedMmapBlockCache - sequential access reads ahead", "[SharedMmapBlockCache]") {
+    BlockCacheTestFile const file(4, 64 * 64);
+
+    auto config = makeConfig(file.path, 4);
+    config.max_cached_blocks = 16;
+    config.readahead_blocks = 4;
+    SharedMmapBlockCache const cache(config);
+
+    std::size_t pos = 0;
+    while (pos < cache.numSamplesPerChannel()) {
+        auto span = cache.getChannelBlockSpan(1, pos, cache.numSamplesPerChannel() - pos);
+        REQUIRE(span.front() == static_cast<float>(sampleValue(pos, 1)));
+        pos += span.size();
+        // Give the background decoder a chance to stay ahead of the scan
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Read-ahead is asynchronous; wait briefly for it to be observed
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (cache.stats().readahead_loads == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    auto const stats = cache.stats();
+    REQUIRE(stats.readahead_loads > 0);
+    REQUIRE(stats.readahead_hits <= stats.readahead_loads);
+    REQUIRE(stats.hits + stats.misses == 64);
+}
+
+TEST_CASE("SharedMmapBlockCache - concurrent readers", "[SharedMmapBlockCache]") {
+    BlockCacheTestFile const file(8, 64 * 50);
+
+    auto config = makeConfig(file.path, 8);
+    config.max_cached_blocks = 8;
+    SharedMmapBlockCache const cache(config);
+
+    std::size_t const num_threads = 4;
+    std::vector<std::size_t> mismatches(num_threads, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i] {
+            // Even threads scan forward, odd threads jump around
+            for (std::size_t k = 0; k < 20000; ++k) {
+                std::size_t const t = (i % 2 == 0) ? (k * 3 + i) % cache.numSamplesPerChannel()
+                                                   : (k * 7919 + i * 131) % cache.numSamplesPerChannel();
+                std::size_t const ch = (k + i) % 8;
+                if (cache.getValue(t, ch) != static_cast<float>(sampleValue(t, ch))) {
+                    ++mismatches[i];
+                }
+            }
+        });
+    }
+    for (auto & thread: threads) {
+        thread.join();
+    }
+
+    for (auto const m: mismatches) {
+        REQUIRE(m == 0);
+    }
+    auto const stats = cache.stats();
+    REQUIRE(stats.hits + stats.misses == num_threads * 20000);
+}
+
+TEST_CASE("SharedMmapBlockCache - pinned spans survive concurrent eviction", "[SharedMmapBlockCache]") {
+    BlockCacheTestFile const file(4, 64 * 40);
+
+    // Two slots with read-ahead on: every thread's scan evicts the others' blocks
+    auto config = makeConfig(file.path, 4);
+    config.max_cached_blocks = 2;
+    config.readahead_blocks = 2;
+    SharedMmapBlockCache const cache(config);
+
+    std::size_t const num_threads = 4;
+    std::vector<std::size_t> mismatches(num_threads, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back([&, i] {
+            std::size_t const ch = i % 4;
+            for (std::size_t pass = 0; pass < 20; ++pass) {
+                std::size_t pos = (i * 64 * 7) % cache.numSamplesPerChannel();
+                auto held = cache.getChannelBlockSpan(ch, pos, 64);
+                std::size_t const held_start = pos;
+                for (std::size_t step = 0; step < 10; ++step) {
+                    pos = (pos + 64) % cache.numSamplesPerChannel();
+                    auto span = cache.getChannelBlockSpan(ch, pos, 64);
+                    for (std::size_t k = 0; k < span.size(); ++k) {
+                        if (span[k] != static_cast<float>(sampleValue(pos + k, ch))) {
+                            ++mismatches[i];
+                        }
+                    }
+                }
+                // The first block was evicted several times over while held
+                for (std::size_t k = 0; k < held.size(); ++k) {
+                    if (held[k] != static_cast<float>(sampleValue(held_start + k, ch))) {
+                        ++mismatches[i];
+                    }
+                }
+            }
+        });
+    }
+    for (auto & thread: threads) {
+        thread.join();
+    }
+
+    for (auto const m: mismatches) {
+        REQUIRE(m == 0);
+    }
+}
@@ -0,0 +1,319 @@
+#include "AnalogRangeIndex.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace {
+
+/**
+ * @brief Position of the larger (IsMax) or smaller sample of @p a and @p b
+ *
+ * NaN loses to any number; ties go to the earlier position. The choice is
+ * associative and idempotent, so overlapping sparse-table queries are exact.
+ */
+template<bool IsMax>
+std::size_t pickExtreme(std::span<float const> values, std::size_t a, std::size_t b) {
+    float const va = values[a];
+    float const vb = values[b];
+    if (std::isnan(vb)) {
+        return a;
+    }
+    if (std::isnan(va)) {
+        return b;
+    }
+    bool const b_wins = IsMax ? vb > va : vb < va;
+    bool const a_wins = IsMax ? va > vb : va < vb;
+    if (b_wins) {
+        return b;
+    }
+    if (a_wins) {
+        return a;
+    }
+    return std::min(a, b);
+}
+
+/**
+ * @brief Neumaier-compensated running sum
+ */
+struct CompensatedSum {
+    double sum = 0.0;
+    double compensation = 0.0;
+
+    void add(double x) {
+        double const t = sum + x;
+        if (std::abs(sum) >= std::abs(x)) {
+            compensation += (sum - t) + x;
+        } else {
+            compensation += (x - t) + sum;
+        }
+        sum = t;
+    }
+
+    [[nodiscard]] double value() const { return sum + compensation; }
+};
+
+/**
+ * @brief Build one sparse table of block ids over per-block extreme positions
+ */
+template<bool IsMax>
+std::vector<std::vector<uint32_t>> buildSparseTable(std::span<float const> values,
+                                                    std::vector<std::size_t> const & block_positions) {
+    std::vector<std::vector<uint32_t>> table;
+    auto const n_blocks = block_positions.size();
+
+    auto const positionOf = [&](std::size_t level, std::size_t block) -> std::size_t {
+        return level == 0 ? block_positions[block]
+                          : block_positions[table[level - 1][block]];
+    };
+    auto const blockOf = [&](std::size_t level, std::size_t block) -> uint32_t {
+        return level == 0 ? static_cast<uint32_t>(block) : table[level - 1][block];
+    };
+
+    for (std::size_t level = 1; (std::size_t{1} << level) <= n_blocks; ++level) {
+        std::size_t const half = std::size_t{1} << (level - 1);
+        std::size_t const count = n_blocks - (std::size_t{1} << level) + 1;
+        std::vector<uint32_t> row(count);
+        for (std::size_t b = 0; b < count; ++b) {
+            auto const left = positionOf(level - 1, b);
+            auto const right = positionOf(level - 1, b + half);
+            row[b] = pickExtreme<IsMax>(values, left, right) == left ? blockOf(level - 1, b)
+                                                                      : blockOf(level - 1, b + half);
+        }
+        table.push_back(std::move(row));
+    }
+    return table;
+}
+
+}// namespace
+
+AnalogRangeSummary summarizeAnalogRange(std::span<float const> values,
+                                        std::size_t first,
+                                        std::size_t last) {
+    AnalogRangeSummary summary;
+    summary.first = first;
+    if (first >= last) {
+        return summary;
+    }
+
+    // Welford for mean / m2, plain double sum
+    double mean = 0.0;
+    double m2 = 0.0;
+    double sum = 0.0;
+    std::size_t n = 0;
+    std::size_t argmin = first;
+    std::size_t argmax = first;
+
+    for (std::size_t i = first; i < last; ++i) {
+        auto const v = static_cast<double>(values[i]);
+        ++n;
+        sum += v;
+        double const delta = v - mean;
+        mean += delta / static_cast<double>(n);
+        m2 += delta * (v - mean);
+        argmin = pickExtreme<false>(values, argmin, i);
+        argmax = pickExtreme<true>(values, argmax, i);
+    }
+
+    summary.count = n;
+    summary.sum = sum;
+    summary.mean = mean;
+    summary.m2 = m2;
+    summary.argmin = argmin;
+    summary.argmax = argmax;
+    summary.min = values[argmin];
+    summary.max = values[argmax];
+    return summary;
+}
+
+AnalogRangeIndex::AnalogRangeIndex(std::span<float const> values)
+    : _size(values.size()) {
+    auto const n_blocks = (_size + kBlockSize - 1) / kBlockSize;
+
+    // Shift by the mean of the finite samples
+    double shift_sum = 0.0;
+    std::size_t finite = 0;
+    for (float const v: values) {
+        if (std::isfinite(v)) {
+            shift_sum += static_cast<double>(v);
+            ++finite;
+        }
+    }
+    _shift = finite > 0 ? shift_sum / static_cast<double>(finite) : 0.0;
+
+    _sum_prefix.assign(n_blocks + 1, 0.0);
+    _sq_prefix.assign(n_blocks + 1, 0.0);
+    _nonfinite_prefix.assign(n_blocks + 1, 0);
+    _block_argmin.resize(n_blocks);
+    _block_argmax.resize(n_blocks);
+
+    CompensatedSum sum;
+    CompensatedSum sq;
+    std::size_t nonfinite = 0;
+    for (std::size_t b = 0; b < n_blocks; ++b) {
+        std::size_t const begin = b * kBlockSize;
+        std::size_t const end = std::min(begin + kBlockSize, _size);
+        std::size_t argmin = begin;
+        std::size_t argmax = begin;
+        for (std::size_t i = begin; i < end; ++i) {
+            float const v = values[i];
+            if (std::isfinite(v)) {
+                double const d = static_cast<double>(v) - _shift;
+                sum.add(d);
+                sq.add(d * d);
+            } else {
+                ++nonfinite;
+            }
+            argmin = pickExtreme<false>(values, argmin, i);
+            argmax = pickExtreme<true>(values, argmax, i);
+        }
+        _block_argmin[b] = argmin;
+        _block_argmax[b] = argmax;
+        _sum_prefix[b + 1] = sum.value();
+        _sq_prefix[b + 1] = sq.value();
+        _nonfinite_prefix[b + 1] = nonfinite;
+    }
+
+    _min_table = buildSparseTable<false>(values, _block_argmin);
+    _max_table = buildSparseTable<true>(values, _block_argmax);
+}
+
+template<bool IsMax>
+std::size_t AnalogRangeIndex::_queryBlocks(std::span<float const> values,
+                                           std::size_t first_block,
+                                           std::size_t last_block) const {
+    auto const & positions = IsMax ? _block_argmax : _block_argmin;
+    auto const & table = IsMax ? _max_table : _min_table;
+
+    auto const length = last_block - first_block;
+    auto const level = static_cast<std::size_t>(std::bit_width(length) - 1);
+    if (level == 0) {
+        return positions[first_block];
+    }
+    auto const & row = table[level - 1];
+    auto const left = positions[row[first_block]];
+    auto const right = positions[row[last_block - (std::size_t{1} << level)]];
+    return pickExtreme<IsMax>(values, left, right);
+}
+
+AnalogRangeSummary AnalogRangeIndex::summarize(std::span<float const> values,
+                                               std::size_t first,
+                                               std::size_t last) const {
+    std::size_t const first_full = (first + kBlockSize - 1) / kBlockSize;
+    std::size_t const last_full = last / kBlockSize;
+
+    if (first >= last || last_full < first_full + 2 ||
+        _nonfinite_prefix[last_full] != _nonfinite_prefix[first_full]) {
+        return summarizeAnalogRange(values, first, last);
+    }
+
+    std::size_t argmin = _queryBlocks<false>(values, first_full, last_full);
+    std::size_t argmax = _queryBlocks<true>(values, first_full, last_full);
+    double s1 = _sum_prefix[last_full] - _sum_prefix[first_full];
+    double s2 = _sq_prefix[last_full] - _sq_prefix[first_full];
+
+    // Partial blocks at both ends
+    auto const scanEdge = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            float const v = values[i];
+            if (!std::isfinite(v)) {
+                return false;
+            }
+            double const d = static_cast<double>(v) - _shift;
+            s1 += d;
+            s2 += d * d;
+            argmin = pickExtreme<false>(values, argmin, i);
+            argmax = pickExtreme<true>(values, argmax, i);
+        }
+        return true;
+    };
+    if (!scanEdge(first, first_full * kBlockSize) || !scanEdge(last_full * kBlockSize, last)) {
+        return summarizeAnalogRange(values, first, last);
+    }
+
+    auto const n = static_cast<double>(last - first);
+
+    AnalogRangeSummary summary;
+    summary.first = first;
+    summary.count = last - first;
+    summary.sum = s1 + _shift * n;
+    summary.mean = _shift + s1 / n;
+    summary.argmin = argmin;
+    summary.argmax = argmax;
+    summary.min = values[argmin];
+    summary.max = values[argmax];
+    // Constant ranges are exactly zero; otherwise clamp rounding below zero
+    summary.m2 = summary.min == summary.max ? 0.0 : std::max(0.0, s2 - s1 * s1 / n);
+    return summary;
+}
+
+// ========== LazyAnalogRangeIndex ==========
+
+LazyAnalogRangeIndex::LazyAnalogRangeIndex(ObserverData & owner) {
+    auto drop_index = [weak_state = std::weak_ptr<State>(_state)]() {
+        if (auto state = weak_state.lock()) {
+            std::lock_guard<std::mutex> const lock(state->mutex);
+            state->index.reset();
+            state->queried_samples = 0;
+        }
+    };
+    (void) owner.addObserver(std::move(drop_index), "AnalogRangeIndex");
+}
+
+LazyAnalogRangeIndex::LazyAnalogRangeIndex(LazyAnalogRangeIndex const &)
+    : LazyAnalogRangeIndex() {}
+
+LazyAnalogRangeIndex::LazyAnalogRangeIndex(LazyAnalogRangeIndex && other) noexcept
+    : _state(std::move(other._state)) {}
+
+LazyAnalogRangeIndex & LazyAnalogRangeIndex::operator=(LazyAnalogRangeIndex const & other) {
+    if (this != &other) {
+        invalidate();
+    }
+    return *this;
+}
+
+LazyAnalogRangeIndex & LazyAnalogRangeIndex::operator=(LazyAnalogRangeIndex && other) noexcept {
+    if (this != &other) {
+        _state = std::move(other._state);
+    }
+    return *this;
+}
+
+std::shared_ptr<AnalogRangeIndex const> LazyAnalogRangeIndex::getOrBuild(std::span<float const> values) const {
+    if (!_state) {
+        return std::make_shared<AnalogRangeIndex const>(values);
+    }
+    std::lock_guard<std::mutex> const lock(_state->mutex);
+    if (!_state->index || _state->index->size() != values.size()) {
+        _state->index = std::make_shared<AnalogRangeIndex const>(values);
+    }
+    return _state->index;
+}
+
+std::shared_ptr<AnalogRangeIndex const> LazyAnalogRangeIndex::getIfAmortized(std::span<float const> values,
+                                                                             std::size_t queried_samples) const {
+    if (!_state) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> const lock(_state->mutex);
+    if (_state->index && _state->index->size() == values.size()) {
+        return _state->index;
+    }
+    _state->queried_samples += queried_samples;
+    if (static_cast<double>(_state->queried_samples) <
+        kBuildQueryFraction * static_cast<double>(values.size())) {
+        return nullptr;
+    }
+    _state->index = std::make_shared<AnalogRangeIndex const>(values);
+    return _state->index;
+}
+
+void LazyAnalogRangeIndex::invalidate() const {
+    if (!_state) {
+        return;
+    }
+    std::lock_guard<std::mutex> const lock(_state->mutex);
+    _state->index.reset();
+    _state->queried_samples = 0;
+}
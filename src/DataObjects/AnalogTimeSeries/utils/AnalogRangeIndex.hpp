@@ -0,0 +1,184 @@
+#ifndef ANALOG_RANGE_INDEX_HPP
+#define ANALOG_RANGE_INDEX_HPP
+
+/**
+ * @file AnalogRangeIndex.hpp
+ * @brief Block index for fast interval reductions over analog samples
+ *
+ * Interval statistics (mean, std, min, max, argmax...) normally rescan every
+ * sample of every interval, once per statistic. AnalogRangeIndex summarizes
+ * the series in fixed blocks of `kBlockSize` samples:
+ * - compensated prefix sums of shifted values and their squares (mean / std)
+ * - sparse tables over per-block argmin / argmax (min / max and their position)
+ *
+ * A range query combines the whole blocks in O(1) and scans at most
+ * 2 * kBlockSize edge samples, so the cost no longer grows with interval length.
+ * Memory is roughly one byte per sample.
+ */
+
+#include "Observer/Observer_Data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+
+/**
+ * @brief All interval statistics of one half-open array range [first, first + count)
+ *
+ * Positions are array positions in the series, not TimeFrameIndex values.
+ * NaN samples are skipped by min/max; any non-finite sample makes sum, mean and m2 non-finite.
+ */
+struct AnalogRangeSummary {
+    std::size_t first = 0;
+    std::size_t count = 0;
+    double sum = 0.0;
+    double mean = std::numeric_limits<double>::quiet_NaN();
+    double m2 = 0.0;///< Sum of squared deviations from the mean
+    float min = std::numeric_limits<float>::quiet_NaN();
+    float max = std::numeric_limits<float>::quiet_NaN();
+    std::size_t argmin = 0;
+    std::size_t argmax = 0;
+
+    [[nodiscard]] bool empty() const noexcept { return count == 0; }
+
+    /// Population variance (divides by n), NaN if empty
+    [[nodiscard]] double populationVariance() const noexcept {
+        return count == 0 ? std::numeric_limits<double>::quiet_NaN() : m2 / static_cast<double>(count);
+    }
+
+    /// Sample variance (divides by n - 1), 0 for a single sample, NaN if empty
+    [[nodiscard]] double sampleVariance() const noexcept {
+        if (count == 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return count == 1 ? 0.0 : m2 / static_cast<double>(count - 1);
+    }
+};
+
+/**
+ * @brief Summarize [first, last) of @p values by scanning every sample
+ *
+ * Reference implementation for AnalogRangeIndex and the fallback for
+ * storage without an index.
+ *
+ * @pre first <= last <= values.size() (enforcement: none) [CRITICAL]
+ */
+[[nodiscard]] AnalogRangeSummary summarizeAnalogRange(std::span<float const> values,
+                                                      std::size_t first,
+                                                      std::size_t last);
+
+/**
+ * @brief Immutable block index over one contiguous sample array
+ *
+ * The index does not keep the samples; every query takes the same span the
+ * index was built from.
+ */
+class AnalogRangeIndex {
+public:
+    static constexpr std::size_t kBlockSize = 256;
+
+    /**
+     * @brief Build the index in two passes over @p values
+     *
+     * @pre values.size() / kBlockSize < 2^32 (enforcement: none) [LOW]
+     */
+    explicit AnalogRangeIndex(std::span<float const> values);
+
+    [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+    /**
+     * @brief Summary of [first, last); equal to summarizeAnalogRange up to rounding
+     *
+     * Ranges with non-finite samples or shorter than two blocks are scanned.
+     *
+     * @pre values is the span the index was built from (enforcement: none) [CRITICAL]
+     * @pre first <= last <= size() (enforcement: none) [CRITICAL]
+     */
+    [[nodiscard]] AnalogRangeSummary summarize(std::span<float const> values,
+                                               std::size_t first,
+                                               std::size_t last) const;
+
+private:
+    /// Position of the extreme sample over whole blocks [first_block, last_block)
+    template<bool IsMax>
+    [[nodiscard]] std::size_t _queryBlocks(std::span<float const> values,
+                                           std::size_t first_block,
+                                           std::size_t last_block) const;
+
+    std::size_t _size = 0;
+    double _shift = 0.0;///< Subtracted before summing so squares stay well conditioned
+
+    // Per block boundary (n_blocks + 1 entries)
+    std::vector<double> _sum_prefix;
+    std::vector<double> _sq_prefix;
+    std::vector<std::size_t> _nonfinite_prefix;
+
+    // Per block extreme positions, and sparse tables of block ids for levels >= 1
+    std::vector<std::size_t> _block_argmin;
+    std::vector<std::size_t> _block_argmax;
+    std::vector<std::vector<uint32_t>> _min_table;
+    std::vector<std::vector<uint32_t>> _max_table;
+};
+
+/**
+ * @brief Lazily built, observer-invalidated AnalogRangeIndex slot
+ *
+ * Holds the index of its owning series. When constructed with an owner, it
+ * registers an observer that drops the index on every notification; the
+ * observer only holds a weak reference, so it is safe after the slot dies.
+ *
+ * @note Copies start empty and are not attached to any owner. A moved-from
+ *       slot no longer caches; getOrBuild() then builds a fresh index per call
+ *       and getIfAmortized() never builds.
+ */
+class LazyAnalogRangeIndex {
+public:
+    LazyAnalogRangeIndex() = default;
+    explicit LazyAnalogRangeIndex(ObserverData & owner);
+
+    LazyAnalogRangeIndex(LazyAnalogRangeIndex const &);
+    LazyAnalogRangeIndex(LazyAnalogRangeIndex &&) noexcept;
+    LazyAnalogRangeIndex & operator=(LazyAnalogRangeIndex const &);
+    LazyAnalogRangeIndex & operator=(LazyAnalogRangeIndex &&) noexcept;
+    ~LazyAnalogRangeIndex() = default;
+
+    /**
+     * @brief Return the index of @p values, building it on first use
+     *
+     * Thread-safe; concurrent callers wait for a single build.
+     */
+    [[nodiscard]] std::shared_ptr<AnalogRangeIndex const> getOrBuild(std::span<float const> values) const;
+
+    /**
+     * @brief Return the index only once it pays for itself
+     *
+     * Adds @p queried_samples to a running total of scanned samples. The
+     * index is built when that total reaches kBuildQueryFraction of
+     * values.size(), so a few short queries on a long recording never
+     * trigger a full pass. Returns nullptr until then; the caller scans.
+     *
+     * Thread-safe. invalidate() also resets the running total.
+     */
+    [[nodiscard]] std::shared_ptr<AnalogRangeIndex const> getIfAmortized(std::span<float const> values,
+                                                                         std::size_t queried_samples) const;
+
+    /// Drop the cached index; the next getOrBuild() rebuilds it
+    void invalidate() const;
+
+    /// Fraction of the series that must have been scanned before getIfAmortized() builds
+    static constexpr double kBuildQueryFraction = 0.5;
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::shared_ptr<AnalogRangeIndex const> index;
+        std::size_t queried_samples = 0;
+    };
+    std::shared_ptr<State> _state = std::make_shared<State>();
+};
+
+#endif// ANALOG_RANGE_INDEX_HPP
@@ -0,0 +1,171 @@
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "AnalogTimeSeries/utils/AnalogRangeIndex.hpp"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+void requireSameSummary(AnalogRangeSummary const & actual, AnalogRangeSummary const & expected) {
+    REQUIRE(actual.first == expected.first);
+    REQUIRE(actual.count == expected.count);
+    REQUIRE(actual.argmin == expected.argmin);
+    REQUIRE(actual.argmax == expected.argmax);
+    REQUIRE(actual.min == expected.min);
+    REQUIRE(actual.max == expected.max);
+    REQUIRE(actual.mean == Catch::Approx(expected.mean).epsilon(1e-9).margin(1e-9));
+    REQUIRE(actual.sum == Catch::Approx(expected.sum).epsilon(1e-9).margin(1e-6));
+    REQUIRE(actual.m2 == Catch::Approx(expected.m2).epsilon(1e-7).margin(1e-6));
+}
+
+}// anonymous namespace
+
+TEST_CASE("AnalogRangeIndex - matches a full scan", "[analog][range_index]") {
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(0.0f, 2.0f);
+
+    // Large offset so naive sums of squares would lose the variance
+    std::vector<float> values(20'000);
+    for (auto & v: values) {
+        v = 1000.0f + noise(rng);
+    }
+    // Ties: the earliest position must win
+    values[3000] = 2000.0f;
+    values[9000] = 2000.0f;
+    values[500] = -5.0f;
+
+    AnalogRangeIndex const index(values);
+    REQUIRE(index.size() == values.size());
+
+    std::uniform_int_distribution<std::size_t> pos(0, values.size());
+    for (int trial = 0; trial < 500; ++trial) {
+        auto a = pos(rng);
+        auto b = pos(rng);
+        if (a > b) {
+            std::swap(a, b);
+        }
+        requireSameSummary(index.summarize(values, a, b), summarizeAnalogRange(values, a, b));
+    }
+
+    auto const whole = index.summarize(values, 0, values.size());
+    REQUIRE(whole.argmax == 3000);
+    REQUIRE(whole.argmin == 500);
+    REQUIRE(index.summarize(values, 10, 10).empty());
+}
+
+TEST_CASE("AnalogRangeIndex - non-finite samples", "[analog][range_index]") {
+    std::vector<float> values(2048, 1.0f);
+    values[1500] = std::numeric_limits<float>::quiet_NaN();
+    values[1600] = 7.0f;
+
+    AnalogRangeIndex const index(values);
+
+    SECTION("Ranges without NaN use the blocks") {
+        auto const summary = index.summarize(values, 0, 1024);
+        REQUIRE(summary.mean == 1.0);
+        REQUIRE(summary.m2 == 0.0);
+    }
+
+    SECTION("NaN propagates to the moments but not to min/max") {
+        auto const summary = index.summarize(values, 0, values.size());
+        REQUIRE(std::isnan(summary.mean));
+        REQUIRE(summary.max == 7.0f);
+        REQUIRE(summary.argmax == 1600);
+        REQUIRE(summary.min == 1.0f);
+        REQUIRE(summary.argmin == 0);
+    }
+}
+
+TEST_CASE("AnalogTimeSeries - summarizeRange", "[analog][timeseries][range_index]") {
+    std::vector<float> values(1000);
+    std::vector<TimeFrameIndex> times;
+    for (int i = 0; i < 1000; ++i) {
+        values[static_cast<std::size_t>(i)] = static_cast<float>(i % 100);
+        times.emplace_back(i * 2);
+    }
+    AnalogTimeSeries series(values, times);
+
+    SECTION("Inclusive TimeFrameIndex bounds snap to existing samples") {
+        // Times 11..21 cover samples at 12, 14, ..., 20 -> positions 6..10
+        auto const summary = series.summarizeRange(TimeFrameIndex(11), TimeFrameIndex(21));
+        REQUIRE(summary.first == 6);
+        REQUIRE(summary.count == 5);
+        REQUIRE(summary.mean == Catch::Approx(8.0));
+        REQUIRE(summary.sampleVariance() == Catch::Approx(2.5));
+        REQUIRE(summary.argmax == 10);
+    }
+
+    SECTION("Long range agrees with the span") {
+        auto const summary = series.summarizeRange(TimeFrameIndex(0), TimeFrameIndex(1998));
+        auto const span = series.getDataInTimeFrameIndexRange(TimeFrameIndex(0), TimeFrameIndex(1998));
+        requireSameSummary(summary, summarizeAnalogRange(span, 0, span.size()));
+        REQUIRE(summary.argmax == 99);
+    }
+
+    SECTION("Empty range") {
+        REQUIRE(series.summarizeRange(TimeFrameIndex(5000), TimeFrameIndex(6000)).empty());
+    }
+
+    SECTION("Index is built once and dropped on notification") {
+        auto const first = series.getRangeIndex();
+        REQUIRE(first != nullptr);
+        REQUIRE(series.getRangeIndex() == first);
+
+        series.notifyObservers();
+        auto const rebuilt = series.getRangeIndex();
+        REQUIRE(rebuilt != nullptr);
+        REQUIRE(rebuilt != first);
+    }
+}
+
+TEST_CASE("LazyAnalogRangeIndex - builds only once queries pay for it", "[analog][range_index]") {
+    std::vector<float> values(1000);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(i % 37);
+    }
+
+    LazyAnalogRangeIndex slot;
+    auto const threshold = static_cast<std::size_t>(LazyAnalogRangeIndex::kBuildQueryFraction *
+                                                    static_cast<double>(values.size()));
+
+    SECTION("Short queries scan until their total reaches the threshold") {
+        std::size_t queried = 0;
+        while (queried + 10 < threshold) {
+            REQUIRE(slot.getIfAmortized(values, 10) == nullptr);
+            queried += 10;
+        }
+        auto const index = slot.getIfAmortized(values, threshold - queried);
+        REQUIRE(index != nullptr);
+        REQUIRE(slot.getIfAmortized(values, 1) == index);
+        requireSameSummary(index->summarize(values, 100, 900), summarizeAnalogRange(values, 100, 900));
+    }
+
+    SECTION("invalidate() resets the running total") {
+        REQUIRE(slot.getIfAmortized(values, threshold - 1) == nullptr);
+        slot.invalidate();
+        REQUIRE(slot.getIfAmortized(values, 1) == nullptr);
+        REQUIRE(slot.getIfAmortized(values, threshold) != nullptr);
+    }
+}
+
+TEST_CASE("AnalogTimeSeries - summarizeRange agrees before and after the index is built",
+          "[analog][timeseries][range_index]") {
+    std::vector<float> values(4096);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::sin(static_cast<float>(i) * 0.01f) * 50.0f;
+    }
+    AnalogTimeSeries series(values, values.size());
+
+    // Many short intervals: the first ones are scanned, later ones use the index
+    for (int start = 0; start + 64 < 4096; start += 32) {
+        auto const summary = series.summarizeRange(TimeFrameIndex(start), TimeFrameIndex(start + 63));
+        requireSameSummary(summary, summarizeAnalogRange(values, static_cast<std::size_t>(start),
+                                                         static_cast<std::size_t>(start + 64)));
+    }
+}
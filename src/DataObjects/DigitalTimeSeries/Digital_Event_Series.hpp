@@ -233,6 +233,16 @@ public:
         return _storage.getEntityId(index);
     }
 
+    /**
+     * @brief Fast-path pointers into contiguous storage for bulk readers.
+     *
+     * @return Cache whose isValid() is true when event times and EntityIds are
+     *         contiguous arrays; otherwise use the per-index accessors.
+     */
+    [[nodiscard]] DigitalEventStorageCache const & storageCache() const noexcept {
+        return _cached_storage;
+    }
+
     /**
      * @brief Add a new event at the specified time
      * 
@@ -82,6 +82,68 @@ std::shared_ptr<MaskData> apply_binary_image_algorithm(
     return result_mask_data;
 }
 
+std::shared_ptr<MaskData> apply_run_length_algorithm(
+    MaskData const * mask_data,
+    std::function<RunLengthMask(RunLengthMask const &, ImageSize)> run_processor,
+    std::function<void(int)> progress_callback,
+    bool preserve_empty_masks) {
+
+    auto result_mask_data = std::make_shared<MaskData>();
+
+    if (!mask_data) {
+        progress_callback(100);
+        return result_mask_data;
+    }
+
+    result_mask_data->setImageSize(mask_data->getImageSize());
+
+    // Same default canvas as apply_binary_image_algorithm
+    auto image_size = mask_data->getImageSize();
+    if (image_size.width <= 0 || image_size.height <= 0) {
+        image_size.width = 256;
+        image_size.height = 256;
+        result_mask_data->setImageSize(image_size);
+    }
+
+    size_t const total_masks = mask_data->getTotalEntryCount();
+    if (total_masks == 0) {
+        progress_callback(100);
+        return result_mask_data;
+    }
+
+    progress_callback(0);
+
+    size_t processed_masks = 0;
+
+    for (auto const & [time, entity_id, mask] : mask_data->flattened_data()) {
+
+        if (mask.empty()) {
+            if (preserve_empty_masks) {
+                result_mask_data->emplaceAtTime(TimeFrameIndex(time.getValue()), Mask2D());
+            }
+            processed_masks++;
+            continue;
+        }
+
+        auto const runs = RunLengthMask::fromMask(mask).clipped(image_size);
+        Mask2D processed_mask = run_processor(runs, image_size).toMask();
+
+        if (!processed_mask.empty()) {
+            result_mask_data->addAtTime(time, processed_mask, NotifyObservers::No);
+        }
+
+        processed_masks++;
+
+        int progress = static_cast<int>(
+            std::round(static_cast<double>(processed_masks) / total_masks * 100.0)
+        );
+        progress_callback(progress);
+    }
+
+    progress_callback(100);
+    return result_mask_data;
+}
+
 Image mask_to_binary_image(Mask2D const & mask, ImageSize image_size) {
     std::vector<uint8_t> image_data(image_size.width * image_size.height, 0);
     
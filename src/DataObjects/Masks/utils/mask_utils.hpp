@@ -5,6 +5,7 @@
 #include "CoreGeometry/ImageSize.hpp"
 #include "CoreGeometry/masks.hpp"
 #include "CoreGeometry/points.hpp"
+#include "run_length_mask.hpp"
 
 #include <cstdint>
 #include <functional>
@@ -35,6 +36,26 @@ std::shared_ptr<MaskData> apply_binary_image_algorithm(
     std::function<void(int)> progress_callback = [](int){},
     bool preserve_empty_masks = false);
 
+/**
+ * @brief Applies a run-length mask algorithm to mask data
+ *
+ * Same contract as apply_binary_image_algorithm(), but each mask is encoded
+ * as runs (clipped to the image) instead of being rasterized into a full
+ * frame, so the cost follows the mask size rather than the image size.
+ *
+ * @param mask_data The input mask data to process
+ * @param run_processor Function receiving the encoded mask and the image size
+ * @param progress_callback Function for progress reporting (0-100)
+ * @param preserve_empty_masks If true, empty masks will be preserved in output (default: false)
+ *
+ * @return A new MaskData containing the processed masks
+ */
+std::shared_ptr<MaskData> apply_run_length_algorithm(
+    MaskData const * mask_data,
+    std::function<RunLengthMask(RunLengthMask const &, ImageSize)> run_processor,
+    std::function<void(int)> progress_callback = [](int){},
+    bool preserve_empty_masks = false);
+
 /**
  * @brief Converts a single mask to a binary image
  * 
@@ -0,0 +1,455 @@
+#include "run_length_mask.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief Minimal union-find with path halving and union by index
+ */
+class RunUnionFind {
+public:
+    explicit RunUnionFind(std::size_t n)
+        : _parent(n) {
+        std::iota(_parent.begin(), _parent.end(), std::size_t{0});
+    }
+
+    std::size_t find(std::size_t i) {
+        while (_parent[i] != i) {
+            _parent[i] = _parent[_parent[i]];
+            i = _parent[i];
+        }
+        return i;
+    }
+
+    void unite(std::size_t a, std::size_t b) {
+        a = find(a);
+        b = find(b);
+        if (a != b) {
+            // Smaller root wins so labels follow first appearance
+            if (b < a) {
+                std::swap(a, b);
+            }
+            _parent[b] = a;
+        }
+    }
+
+private:
+    std::vector<std::size_t> _parent;
+};
+
+/**
+ * @brief Index of the first run of every distinct row, plus runs.size() as sentinel
+ */
+std::vector<std::size_t> rowStarts(std::vector<MaskRun> const & runs) {
+    std::vector<std::size_t> starts;
+    for (std::size_t i = 0; i < runs.size(); ++i) {
+        if (i == 0 || runs[i].y != runs[i - 1].y) {
+            starts.push_back(i);
+        }
+    }
+    starts.push_back(runs.size());
+    return starts;
+}
+
+/**
+ * @brief Union runs on consecutive rows that touch under @p connectivity
+ *
+ * @pre runs sorted by (y, x_begin)
+ */
+void connectAdjacentRows(std::vector<MaskRun> const & runs,
+                         MaskConnectivity connectivity,
+                         RunUnionFind & uf) {
+    // Eight-connectivity lets runs touch diagonally: widen by one on each side
+    int const slack = (connectivity == MaskConnectivity::Eight) ? 1 : 0;
+    auto const starts = rowStarts(runs);
+
+    for (std::size_t r = 0; r + 2 < starts.size(); ++r) {
+        std::size_t const a_begin = starts[r];
+        std::size_t const a_end = starts[r + 1];
+        std::size_t const b_end = starts[r + 2];
+        if (runs[a_end].y != runs[a_begin].y + 1) {
+            continue;
+        }
+
+        // Two-pointer sweep over the two sorted rows
+        std::size_t i = a_begin;
+        std::size_t j = a_end;
+        while (i < a_end && j < b_end) {
+            auto const & a = runs[i];
+            auto const & b = runs[j];
+            if (a.x_begin < b.x_end + slack && b.x_begin < a.x_end + slack) {
+                uf.unite(i, j);
+            }
+            if (a.x_end < b.x_end) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Append the runs of one row of a binary scanline to @p out
+ */
+template<typename Pixel>
+void appendRowRuns(Pixel const * row, int width, int y, int x_offset, std::vector<MaskRun> & out) {
+    int x = 0;
+    while (x < width) {
+        while (x < width && !row[x]) {
+            ++x;
+        }
+        int const start = x;
+        while (x < width && row[x]) {
+            ++x;
+        }
+        if (x > start) {
+            out.push_back({y, start + x_offset, x + x_offset});
+        }
+    }
+}
+
+/**
+ * @brief Reflection padding identical to the full-image median filter
+ */
+int reflect(int v, int size) {
+    if (v < 0) v = -v - 1;
+    if (v >= size) v = 2 * size - v - 1;
+    return std::max(0, std::min(v, size - 1));
+}
+
+}// namespace
+
+// ============================================================================
+// RunLengthMask
+// ============================================================================
+
+RunLengthMask::RunLengthMask(std::vector<MaskRun> runs) {
+    std::erase_if(runs, [](MaskRun const & r) { return r.x_end <= r.x_begin; });
+    std::sort(runs.begin(), runs.end(), [](MaskRun const & a, MaskRun const & b) {
+        return a.y != b.y ? a.y < b.y : a.x_begin < b.x_begin;
+    });
+
+    _runs.reserve(runs.size());
+    for (auto const & run: runs) {
+        if (!_runs.empty() && _runs.back().y == run.y && run.x_begin <= _runs.back().x_end) {
+            _runs.back().x_end = std::max(_runs.back().x_end, run.x_end);
+        } else {
+            _runs.push_back(run);
+        }
+    }
+}
+
+RunLengthMask RunLengthMask::fromMask(Mask2D const & mask) {
+    // Row-major keys sort in (y, x) order; duplicates collapse in the merge
+    std::vector<uint64_t> keys;
+    keys.reserve(mask.size());
+    for (auto const & p: mask) {
+        keys.push_back((static_cast<uint64_t>(p.y) << 32) | p.x);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<MaskRun> runs;
+    for (auto const key: keys) {
+        auto const y = static_cast<int>(key >> 32);
+        auto const x = static_cast<int>(key & 0xFFFFFFFFu);
+        if (!runs.empty() && runs.back().y == y && x <= runs.back().x_end) {
+            runs.back().x_end = std::max(runs.back().x_end, x + 1);
+        } else {
+            runs.push_back({y, x, x + 1});
+        }
+    }
+
+    RunLengthMask result;
+    result._runs = std::move(runs);
+    return result;
+}
+
+RunLengthMask RunLengthMask::fromBinaryImage(Image const & binary_image) {
+    return fromBinaryImage(binary_image.data, binary_image.size);
+}
+
+RunLengthMask RunLengthMask::fromBinaryImage(std::vector<uint8_t> const & data, ImageSize image_size) {
+    auto const width = image_size.width;
+    auto const height = image_size.height;
+    RunLengthMask result;
+    if (width <= 0 || height <= 0 ||
+        data.size() != static_cast<size_t>(width) * static_cast<size_t>(height)) {
+        return result;
+    }
+    for (int y = 0; y < height; ++y) {
+        appendRowRuns(data.data() + static_cast<size_t>(y) * static_cast<size_t>(width),
+                      width, y, 0, result._runs);
+    }
+    return result;
+}
+
+Mask2D RunLengthMask::toMask() const {
+    std::vector<Point2D<uint32_t>> points;
+    points.reserve(area());
+    for (auto const & run: _runs) {
+        if (run.y < 0) {
+            continue;
+        }
+        for (int x = std::max(run.x_begin, 0); x < run.x_end; ++x) {
+            points.push_back({static_cast<uint32_t>(x), static_cast<uint32_t>(run.y)});
+        }
+    }
+    return Mask2D(std::move(points));
+}
+
+Image RunLengthMask::toBinaryImage(ImageSize image_size) const {
+    if (image_size.width <= 0 || image_size.height <= 0) {
+        return {};
+    }
+    std::vector<uint8_t> data(static_cast<size_t>(image_size.width) * static_cast<size_t>(image_size.height), 0);
+    for (auto const & run: _runs) {
+        if (run.y < 0 || run.y >= image_size.height) {
+            continue;
+        }
+        int const begin = std::max(run.x_begin, 0);
+        int const end = std::min(run.x_end, image_size.width);
+        if (begin < end) {
+            auto * row = data.data() + static_cast<size_t>(run.y) * static_cast<size_t>(image_size.width);
+            std::fill(row + begin, row + end, uint8_t{1});
+        }
+    }
+    return Image(std::move(data), image_size);
+}
+
+RunLengthMask RunLengthMask::clipped(ImageSize image_size) const {
+    RunLengthMask result;
+    result._runs.reserve(_runs.size());
+    for (auto const & run: _runs) {
+        if (run.y < 0 || run.y >= image_size.height) {
+            continue;
+        }
+        int const begin = std::max(run.x_begin, 0);
+        int const end = std::min(run.x_end, image_size.width);
+        if (begin < end) {
+            result._runs.push_back({run.y, begin, end});
+        }
+    }
+    return result;
+}
+
+std::size_t RunLengthMask::area() const {
+    std::size_t total = 0;
+    for (auto const & run: _runs) {
+        total += static_cast<std::size_t>(run.length());
+    }
+    return total;
+}
+
+Point2D<float> RunLengthMask::centroid() const {
+    double sum_x = 0.0;
+    double sum_y = 0.0;
+    double count = 0.0;
+    for (auto const & run: _runs) {
+        double const n = run.length();
+        // Sum of x over [x_begin, x_end) is n * (x_begin + x_end - 1) / 2
+        sum_x += n * (static_cast<double>(run.x_begin) + static_cast<double>(run.x_end) - 1.0) * 0.5;
+        sum_y += n * static_cast<double>(run.y);
+        count += n;
+    }
+    if (count == 0.0) {
+        return {0.0f, 0.0f};
+    }
+    return {static_cast<float>(sum_x / count), static_cast<float>(sum_y / count)};
+}
+
+MaskRunBounds RunLengthMask::boundingBox() const {
+    if (_runs.empty()) {
+        return {};
+    }
+    int min_x = _runs.front().x_begin;
+    int max_x = _runs.front().x_end - 1;
+    for (auto const & run: _runs) {
+        min_x = std::min(min_x, run.x_begin);
+        max_x = std::max(max_x, run.x_end - 1);
+    }
+    return {min_x, _runs.front().y, max_x, _runs.back().y};
+}
+
+// ============================================================================
+// Connected components
+// ============================================================================
+
+std::vector<std::size_t> label_connected_runs(RunLengthMask const & mask,
+                                              MaskConnectivity connectivity) {
+    auto const & runs = mask.runs();
+    RunUnionFind uf(runs.size());
+    connectAdjacentRows(runs, connectivity, uf);
+
+    std::vector<std::size_t> labels(runs.size());
+    std::vector<std::size_t> root_label(runs.size(), runs.size());
+    std::size_t next_label = 0;
+    for (std::size_t i = 0; i < runs.size(); ++i) {
+        auto const root = uf.find(i);
+        if (root_label[root] == runs.size()) {
+            root_label[root] = next_label++;
+        }
+        labels[i] = root_label[root];
+    }
+    return labels;
+}
+
+RunLengthMask remove_small_clusters(RunLengthMask const & mask, int threshold) {
+    auto const & runs = mask.runs();
+    auto const labels = label_connected_runs(mask, MaskConnectivity::Eight);
+
+    std::size_t const num_labels =
+            labels.empty() ? 0 : *std::max_element(labels.begin(), labels.end()) + 1;
+    std::vector<std::size_t> sizes(num_labels, 0);
+    for (std::size_t i = 0; i < runs.size(); ++i) {
+        sizes[labels[i]] += static_cast<std::size_t>(runs[i].length());
+    }
+
+    std::vector<MaskRun> kept;
+    kept.reserve(runs.size());
+    for (std::size_t i = 0; i < runs.size(); ++i) {
+        if (static_cast<long long>(sizes[labels[i]]) >= threshold) {
+            kept.push_back(runs[i]);
+        }
+    }
+    return RunLengthMask(std::move(kept));
+}
+
+// ============================================================================
+// Hole filling
+// ============================================================================
+
+RunLengthMask fill_holes(RunLengthMask const & mask) {
+    if (mask.empty()) {
+        return mask;
+    }
+    auto const & runs = mask.runs();
+    auto const bounds = mask.boundingBox();
+    int const x0 = bounds.min_x;
+    int const x1 = bounds.max_x + 1;
+    int const y0 = bounds.min_y;
+    int const y1 = bounds.max_y + 1;
+
+    // Background runs inside the bounding box, row by row
+    std::vector<MaskRun> background;
+    std::size_t i = 0;
+    for (int y = y0; y < y1; ++y) {
+        int cursor = x0;
+        for (; i < runs.size() && runs[i].y == y; ++i) {
+            if (runs[i].x_begin > cursor) {
+                background.push_back({y, cursor, runs[i].x_begin});
+            }
+            cursor = runs[i].x_end;
+        }
+        if (cursor < x1) {
+            background.push_back({y, cursor, x1});
+        }
+    }
+
+    RunUnionFind uf(background.size());
+    connectAdjacentRows(background, MaskConnectivity::Four, uf);
+
+    // Components touching the box border are connected to the outside
+    std::vector<bool> exterior(background.size(), false);
+    for (std::size_t b = 0; b < background.size(); ++b) {
+        auto const & run = background[b];
+        if (run.y == y0 || run.y == y1 - 1 || run.x_begin == x0 || run.x_end == x1) {
+            exterior[uf.find(b)] = true;
+        }
+    }
+
+    std::vector<MaskRun> filled(runs.begin(), runs.end());
+    for (std::size_t b = 0; b < background.size(); ++b) {
+        if (!exterior[uf.find(b)]) {
+            filled.push_back(background[b]);
+        }
+    }
+    return RunLengthMask(std::move(filled));
+}
+
+// ============================================================================
+// Median filter
+// ============================================================================
+
+RunLengthMask median_filter(RunLengthMask const & mask, int window_size, ImageSize image_size) {
+    if (mask.empty() || window_size <= 0 || window_size % 2 == 0) {
+        return mask;
+    }
+
+    int const half = window_size / 2;
+    bool const bounded = image_size.width > 0 && image_size.height > 0;
+    auto const bounds = mask.boundingBox();
+
+    // Cropped foreground raster of the bounding box
+    int const box_w = bounds.max_x - bounds.min_x + 1;
+    int const box_h = bounds.max_y - bounds.min_y + 1;
+    std::vector<uint8_t> box(static_cast<size_t>(box_w) * static_cast<size_t>(box_h), 0);
+    for (auto const & run: mask.runs()) {
+        auto * row = box.data() + static_cast<size_t>(run.y - bounds.min_y) * static_cast<size_t>(box_w);
+        std::fill(row + (run.x_begin - bounds.min_x), row + (run.x_end - bounds.min_x), uint8_t{1});
+    }
+    auto foreground = [&](int y, int x) -> int {
+        if (bounded) {
+            y = reflect(y, image_size.height);
+            x = reflect(x, image_size.width);
+        }
+        int const by = y - bounds.min_y;
+        int const bx = x - bounds.min_x;
+        if (by < 0 || by >= box_h || bx < 0 || bx >= box_w) {
+            return 0;
+        }
+        return box[static_cast<size_t>(by) * static_cast<size_t>(box_w) + static_cast<size_t>(bx)];
+    };
+
+    // Output can only be set within `half` of the mask (reflection included)
+    int out_x0 = bounds.min_x - half;
+    int out_x1 = bounds.max_x + half + 1;
+    int out_y0 = bounds.min_y - half;
+    int out_y1 = bounds.max_y + half + 1;
+    if (bounded) {
+        out_x0 = std::max(out_x0, 0);
+        out_y0 = std::max(out_y0, 0);
+        out_x1 = std::min(out_x1, image_size.width);
+        out_y1 = std::min(out_y1, image_size.height);
+    }
+    if (out_x0 >= out_x1 || out_y0 >= out_y1) {
+        return {};
+    }
+
+    // Summed-area table over the window support of the output region
+    int const sup_x0 = out_x0 - half;
+    int const sup_y0 = out_y0 - half;
+    int const sup_w = (out_x1 - out_x0) + 2 * half;
+    int const sup_h = (out_y1 - out_y0) + 2 * half;
+    auto const stride = static_cast<size_t>(sup_w) + 1;
+    std::vector<int> sat(stride * (static_cast<size_t>(sup_h) + 1), 0);
+    for (int sy = 0; sy < sup_h; ++sy) {
+        int row_sum = 0;
+        for (int sx = 0; sx < sup_w; ++sx) {
+            row_sum += foreground(sup_y0 + sy, sup_x0 + sx);
+            sat[(static_cast<size_t>(sy) + 1) * stride + static_cast<size_t>(sx) + 1] =
+                    sat[static_cast<size_t>(sy) * stride + static_cast<size_t>(sx) + 1] + row_sum;
+        }
+    }
+
+    // Median of a binary window is 1 exactly when ones are the majority
+    int const window_area = window_size * window_size;
+    std::vector<uint8_t> row_out(static_cast<size_t>(out_x1 - out_x0));
+    std::vector<MaskRun> runs;
+    for (int y = out_y0; y < out_y1; ++y) {
+        auto const top = static_cast<size_t>(y - out_y0);
+        auto const bottom = top + static_cast<size_t>(window_size);
+        for (int x = out_x0; x < out_x1; ++x) {
+            auto const left = static_cast<size_t>(x - out_x0);
+            auto const right = left + static_cast<size_t>(window_size);
+            int const ones = sat[bottom * stride + right] - sat[top * stride + right] -
+                             sat[bottom * stride + left] + sat[top * stride + left];
+            row_out[left] = (2 * ones > window_area) ? 1 : 0;
+        }
+        appendRowRuns(row_out.data(), out_x1 - out_x0, y, out_x0, runs);
+    }
+    return RunLengthMask(std::move(runs));
+}
@@ -0,0 +1,168 @@
+#ifndef NEURALYZER_RUN_LENGTH_MASK_HPP
+#define NEURALYZER_RUN_LENGTH_MASK_HPP
+
+#include "CoreGeometry/Image.hpp"
+#include "CoreGeometry/ImageSize.hpp"
+#include "CoreGeometry/masks.hpp"
+#include "CoreGeometry/points.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Horizontal run of foreground pixels: row @c y, columns [x_begin, x_end).
+ */
+struct MaskRun {
+    int y = 0;
+    int x_begin = 0;
+    int x_end = 0;
+
+    [[nodiscard]] int length() const { return x_end - x_begin; }
+
+    bool operator==(MaskRun const &) const = default;
+};
+
+/**
+ * @brief Inclusive pixel bounds of a run-length mask.
+ */
+struct MaskRunBounds {
+    int min_x = 0;
+    int min_y = 0;
+    int max_x = 0;
+    int max_y = 0;
+};
+
+/**
+ * @brief Pixel connectivity used when grouping runs into components.
+ */
+enum class MaskConnectivity {
+    Four, ///< Edge-sharing neighbours only
+    Eight ///< Edge- and corner-sharing neighbours
+};
+
+/**
+ * @brief Run-length encoded binary mask.
+ *
+ * Runs are kept sorted by (y, x_begin), never overlap and never touch on the
+ * same row, so every foreground pixel belongs to exactly one run. Memory and
+ * the cost of every operation below scale with the number of runs (or the
+ * mask's bounding box), not with the frame size.
+ */
+class RunLengthMask {
+public:
+    RunLengthMask() = default;
+
+    /**
+     * @brief Build from arbitrary runs (sorted and merged on construction)
+     *
+     * Empty runs are dropped; overlapping or touching runs on one row are merged.
+     */
+    explicit RunLengthMask(std::vector<MaskRun> runs);
+
+    /**
+     * @brief Encode mask points (duplicates allowed, any order)
+     */
+    [[nodiscard]] static RunLengthMask fromMask(Mask2D const & mask);
+
+    /**
+     * @brief Encode the non-zero pixels of a row-major binary image
+     */
+    [[nodiscard]] static RunLengthMask fromBinaryImage(Image const & binary_image);
+
+    /**
+     * @brief Encode the non-zero pixels of a row-major buffer of size @p image_size
+     *
+     * @pre data.size() == width * height (enforcement: runtime_check) — returns an
+     *      empty mask otherwise
+     */
+    [[nodiscard]] static RunLengthMask fromBinaryImage(std::vector<uint8_t> const & data,
+                                                       ImageSize image_size);
+
+    /**
+     * @brief Decode to mask points in row-major order (y, then x)
+     *
+     * Pixels with negative coordinates are skipped.
+     */
+    [[nodiscard]] Mask2D toMask() const;
+
+    /**
+     * @brief Rasterize into a full image (values 0 or 1); runs are clipped to the image
+     */
+    [[nodiscard]] Image toBinaryImage(ImageSize image_size) const;
+
+    /**
+     * @brief Drop the parts of runs outside [0, width) x [0, height)
+     */
+    [[nodiscard]] RunLengthMask clipped(ImageSize image_size) const;
+
+    [[nodiscard]] std::vector<MaskRun> const & runs() const { return _runs; }
+    [[nodiscard]] bool empty() const { return _runs.empty(); }
+
+    /**
+     * @brief Number of foreground pixels
+     */
+    [[nodiscard]] std::size_t area() const;
+
+    /**
+     * @brief Mean pixel position
+     *
+     * @pre !empty() (enforcement: none) — returns (0, 0) for an empty mask
+     */
+    [[nodiscard]] Point2D<float> centroid() const;
+
+    /**
+     * @brief Inclusive bounding box
+     *
+     * @pre !empty() (enforcement: none) — returns all-zero bounds for an empty mask
+     */
+    [[nodiscard]] MaskRunBounds boundingBox() const;
+
+private:
+    std::vector<MaskRun> _runs;
+};
+
+/**
+ * @brief Label connected components with union-find over overlapping runs
+ *
+ * Two runs on adjacent rows are connected when they overlap (Four) or overlap
+ * or touch diagonally (Eight).
+ *
+ * @return One label per run (same order as mask.runs()), numbered 0..k-1 in
+ *         order of first appearance
+ */
+[[nodiscard]] std::vector<std::size_t> label_connected_runs(
+        RunLengthMask const & mask,
+        MaskConnectivity connectivity = MaskConnectivity::Eight);
+
+/**
+ * @brief Remove 8-connected components smaller than @p threshold pixels
+ *
+ * Run-based equivalent of remove_small_clusters(Image const &, int).
+ */
+[[nodiscard]] RunLengthMask remove_small_clusters(RunLengthMask const & mask, int threshold);
+
+/**
+ * @brief Fill background regions not 4-connected to the outside of the mask
+ *
+ * Only the mask's bounding box is examined: background on its border is
+ * connected to the outside by construction. Equivalent to fill_holes(Image
+ * const &) for any frame that contains the mask.
+ */
+[[nodiscard]] RunLengthMask fill_holes(RunLengthMask const & mask);
+
+/**
+ * @brief Binary median (majority) filter over a square window
+ *
+ * Only the bounding box grown by window_size / 2 is evaluated. When
+ * @p image_size is valid, out-of-frame window pixels use the same reflection
+ * padding as median_filter(Image const &, int); otherwise everything outside
+ * the mask is background and the output may extend in every direction.
+ *
+ * An even or non-positive @p window_size returns the mask unchanged.
+ */
+[[nodiscard]] RunLengthMask median_filter(RunLengthMask const & mask,
+                                          int window_size,
+                                          ImageSize image_size = {});
+
+#endif// NEURALYZER_RUN_LENGTH_MASK_HPP
@@ -0,0 +1,167 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "run_length_mask.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<uint8_t> random_image(ImageSize size, double density, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::bernoulli_distribution fg(density);
+    std::vector<uint8_t> image(static_cast<size_t>(size.width * size.height));
+    for (auto & px: image) {
+        px = fg(rng) ? 1 : 0;
+    }
+    return image;
+}
+
+}// namespace
+
+TEST_CASE("RunLengthMask encoding", "[run_length_mask]") {
+
+    SECTION("runs are sorted and merged") {
+        RunLengthMask const mask({{1, 4, 6}, {0, 2, 3}, {1, 0, 2}, {1, 2, 4}, {0, 5, 5}});
+        std::vector<MaskRun> const expected = {{0, 2, 3}, {1, 0, 6}};
+        REQUIRE(mask.runs() == expected);
+        REQUIRE(mask.area() == 7);
+    }
+
+    SECTION("mask round trip is row-major and deduplicated") {
+        Mask2D const input({{3, 1}, {1, 1}, {2, 1}, {2, 1}, {0, 4}});
+        auto const mask = RunLengthMask::fromMask(input);
+
+        REQUIRE(mask.runs().size() == 2);
+        REQUIRE(mask.area() == 4);
+
+        Mask2D const output = mask.toMask();
+        REQUIRE(output.size() == 4);
+        REQUIRE(output[0].x == 1);
+        REQUIRE(output[0].y == 1);
+        REQUIRE(output[2].x == 3);
+        REQUIRE(output[2].y == 1);
+        REQUIRE(output[3].x == 0);
+        REQUIRE(output[3].y == 4);
+    }
+
+    SECTION("binary image round trip") {
+        ImageSize const size = {17, 11};
+        auto const image = random_image(size, 0.4, 7);
+        auto const mask = RunLengthMask::fromBinaryImage(image, size);
+        REQUIRE(mask.toBinaryImage(size).data == image);
+    }
+
+    SECTION("mismatched buffer yields an empty mask") {
+        REQUIRE(RunLengthMask::fromBinaryImage(std::vector<uint8_t>(5, 1), {3, 3}).empty());
+    }
+
+    SECTION("clipping drops out-of-frame pixels") {
+        RunLengthMask const mask({{-1, 0, 4}, {0, -2, 2}, {1, 3, 8}, {5, 0, 1}});
+        auto const clipped = mask.clipped({5, 5});
+        std::vector<MaskRun> const expected = {{0, 0, 2}, {1, 3, 5}};
+        REQUIRE(clipped.runs() == expected);
+    }
+}
+
+TEST_CASE("RunLengthMask geometry", "[run_length_mask]") {
+    // 3x2 block at (10..12, 20..21) plus a single pixel at (16, 21)
+    RunLengthMask const mask({{20, 10, 13}, {21, 10, 13}, {21, 16, 17}});
+
+    REQUIRE(mask.area() == 7);
+
+    auto const centroid = mask.centroid();
+    REQUIRE_THAT(centroid.x, Catch::Matchers::WithinAbs((2 * 33.0 + 16.0) / 7.0, 1e-5));
+    REQUIRE_THAT(centroid.y, Catch::Matchers::WithinAbs((3 * 20.0 + 4 * 21.0) / 7.0, 1e-5));
+
+    auto const bounds = mask.boundingBox();
+    REQUIRE(bounds.min_x == 10);
+    REQUIRE(bounds.min_y == 20);
+    REQUIRE(bounds.max_x == 16);
+    REQUIRE(bounds.max_y == 21);
+}
+
+TEST_CASE("label_connected_runs connectivity", "[run_length_mask]") {
+    // Two runs touching only at a corner
+    RunLengthMask const mask({{0, 0, 2}, {1, 2, 4}});
+
+    std::vector<std::size_t> const joined = {0, 0};
+    REQUIRE(label_connected_runs(mask, MaskConnectivity::Eight) == joined);
+
+    std::vector<std::size_t> const separate = {0, 1};
+    REQUIRE(label_connected_runs(mask, MaskConnectivity::Four) == separate);
+}
+
+TEST_CASE("remove_small_clusters on runs", "[run_length_mask][connected_component]") {
+
+    SECTION("more than 255 components are labelled independently") {
+        // 300 isolated 2-pixel dots and one 6-pixel bar
+        std::vector<MaskRun> runs;
+        for (int i = 0; i < 300; ++i) {
+            runs.push_back({2 * (i / 20), 3 * (i % 20), 3 * (i % 20) + 2});
+        }
+        runs.push_back({40, 0, 6});
+        RunLengthMask const mask(std::move(runs));
+
+        auto const kept = remove_small_clusters(mask, 3);
+        std::vector<MaskRun> const expected = {{40, 0, 6}};
+        REQUIRE(kept.runs() == expected);
+
+        REQUIRE(remove_small_clusters(mask, 2).area() == mask.area());
+    }
+}
+
+TEST_CASE("fill_holes on runs", "[run_length_mask][hole_filling]") {
+
+    SECTION("fills an enclosed hole far from the origin") {
+        // Hollow 5x5 square at (1000, 2000)
+        std::vector<MaskRun> runs = {{2000, 1000, 1005}, {2004, 1000, 1005}};
+        for (int y = 2001; y < 2004; ++y) {
+            runs.push_back({y, 1000, 1001});
+            runs.push_back({y, 1004, 1005});
+        }
+        auto const filled = fill_holes(RunLengthMask(std::move(runs)));
+        REQUIRE(filled.area() == 25);
+        REQUIRE(filled.runs().size() == 5);
+    }
+
+    SECTION("background is 4-connected") {
+        // Background at (1, 1) reaches the outside only through corners, so it is a hole
+        RunLengthMask const mask({{0, 1, 2}, {1, 0, 1}, {1, 2, 3}, {2, 1, 2}});
+        REQUIRE(fill_holes(mask).area() == 5);
+    }
+}
+
+TEST_CASE("median_filter on runs", "[run_length_mask][median_filter]") {
+
+    SECTION("isolated pixel is removed and solid block survives") {
+        std::vector<MaskRun> runs = {{50, 80, 81}};
+        for (int y = 10; y < 15; ++y) {
+            runs.push_back({y, 10, 15});
+        }
+        auto const filtered = median_filter(RunLengthMask(std::move(runs)), 3);
+
+        // Corners of the block lose the vote (4 of 9), everything else stays
+        REQUIRE(filtered.area() == 21);
+        auto const bounds = filtered.boundingBox();
+        REQUIRE(bounds.max_y == 14);
+        REQUIRE(bounds.max_x == 14);
+    }
+
+    SECTION("even window returns the input") {
+        RunLengthMask const mask({{0, 0, 1}});
+        REQUIRE(median_filter(mask, 4).runs() == mask.runs());
+    }
+
+    SECTION("frame edges use reflection padding") {
+        // 2x2 block in the image corner: reflection keeps all but the inner corner
+        RunLengthMask const mask({{0, 0, 2}, {1, 0, 2}});
+        std::vector<MaskRun> const expected = {{0, 0, 2}, {1, 0, 1}};
+        REQUIRE(median_filter(mask, 3, {8, 8}).runs() == expected);
+
+        // Without a frame the surroundings are background and the block erodes
+        REQUIRE(median_filter(mask, 3).empty());
+    }
+}
@@ -8,9 +8,11 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <stdexcept>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -493,6 +495,37 @@ private:
 // Lazy Storage (View-based Computation on Demand)
 // =============================================================================
 
+/**
+ * @brief One value slot per calling thread, for results returned by reference
+ *
+ * Lets LazyRaggedStorage hand out a reference to a computed value while
+ * several threads read the same storage: each thread overwrites only its own
+ * slot. Slots are node-based, so a thread's slot never moves. Copies and moves
+ * start empty, since the slots only back references from the original object.
+ *
+ * @tparam T Default-constructible value type
+ */
+template<typename T>
+class PerThreadSlot {
+public:
+    PerThreadSlot() = default;
+    PerThreadSlot(PerThreadSlot const &) {}
+    PerThreadSlot(PerThreadSlot &&) noexcept {}
+    PerThreadSlot & operator=(PerThreadSlot const &) { return *this; }
+    PerThreadSlot & operator=(PerThreadSlot &&) noexcept { return *this; }
+    ~PerThreadSlot() = default;
+
+    /// Slot of the calling thread, created on first use
+    [[nodiscard]] T & local() const {
+        std::lock_guard<std::mutex> const lock(_mutex);
+        return _slots[std::this_thread::get_id()];
+    }
+
+private:
+    mutable std::mutex _mutex;
+    mutable std::unordered_map<std::thread::id, T> _slots;
+};
+
 /**
  * @brief Lazy ragged storage that computes values on-demand from a view
  * 
@@ -504,6 +537,8 @@ private:
  * Performance characteristics:
  * - Zero memory overhead for intermediate results
  * - Each access computes the value (no caching)
+ * - getData() returns a reference valid until the same thread's next
+ *   getData() on this storage, so concurrent readers do not interfere
  * - Not contiguous in memory (cache always invalid)
  * - Ideal for sequential iteration (e.g., saving transformed results)
  * - Call materialize() before random access-heavy operations
@@ -556,15 +591,16 @@ public:
 
     [[nodiscard]] TData const & getDataImpl(size_t idx) const {
         auto element = _view[idx];
+        TData & slot = _cached_data.local();
         // Handle both std::cref<TData> and TData directly
         if constexpr (requires { element; std::get<2>(element).get(); }) {
             // std::reference_wrapper case
-            _cached_data = std::get<2>(element).get();
+            slot = std::get<2>(element).get();
         } else {
             // Direct TData case
-            _cached_data = std::get<2>(element);
+            slot = std::get<2>(element);
         }
-        return _cached_data;
+        return slot;
     }
 
     [[nodiscard]] EntityId getEntityIdImpl(size_t idx) const {
@@ -638,8 +674,8 @@ private:
     std::unordered_map<EntityId, size_t> _entity_to_index;
     std::map<TimeFrameIndex, std::pair<size_t, size_t>> _time_ranges;
 
-    // Mutable cache for getDataImpl (required for returning const ref)
-    mutable TData _cached_data;
+    // Per-thread cache for getDataImpl (required for returning const ref)
+    PerThreadSlot<TData> _cached_data;
 };
 
 // =============================================================================
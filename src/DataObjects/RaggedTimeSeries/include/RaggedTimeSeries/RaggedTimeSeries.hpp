@@ -21,8 +21,10 @@
 #include <ranges>
 #include <span>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 template<typename TData>
@@ -413,6 +415,9 @@ public:
      * - MaskData uses EntityKind::MaskEntity
      * - PointData uses EntityKind::PointEntity
      * 
+     * Lazy storage stays lazy: only the times are read to assign ids, and data
+     * is still produced on access (e.g. decoded from a memory-mapped file).
+     *
      * @pre Identity context should be set via setIdentityContext before calling
      */
     void rebuildAllEntityIds() {
@@ -424,6 +429,11 @@ public:
 
         EntityKind const kind = getEntityKind();
 
+        if (isLazy()) {
+            _rebuildLazyEntityIds(kind);
+            return;
+        }
+
         // Create a new owning storage and repopulate with correct EntityIds
         OwningRaggedStorage<TData> new_storage;
         new_storage.reserve(_storage.size());
@@ -1381,6 +1391,69 @@ protected:
         _updateStorageCache();
     }
 
+    /**
+     * @brief Element reference handed to LazyRaggedStorage by _rebuildLazyEntityIds
+     *
+     * Resolves the data only when LazyRaggedStorage asks for it via get().
+     */
+    struct LazySourceRef {
+        std::shared_ptr<RaggedStorageWrapper<TData> const> source;
+        size_t index;
+
+        [[nodiscard]] TData const & get() const { return source->getData(index); }
+    };
+
+    /**
+     * @brief Element generator of the re-key layer built by _rebuildLazyEntityIds
+     */
+    struct LazyRekey {
+        std::shared_ptr<RaggedStorageWrapper<TData> const> source;
+        std::shared_ptr<std::vector<EntityId> const> ids;
+
+        [[nodiscard]] auto operator()(size_t idx) const {
+            return std::make_tuple(source->getTime(idx), (*ids)[idx], LazySourceRef{source, idx});
+        }
+    };
+
+    using LazyRekeyView = decltype(std::views::iota(size_t{0}, size_t{0}) |
+                                   std::views::transform(std::declval<LazyRekey>()));
+
+    /**
+     * @brief Re-key lazy storage with registry EntityIds without materializing data
+     *
+     * The current storage becomes the source of a new lazy view that reports the
+     * new EntityIds and forwards data access to the old storage. If the storage
+     * is already such a re-key layer, its source is reused so repeated rebuilds
+     * replace the ids instead of stacking layers.
+     */
+    void _rebuildLazyEntityIds(EntityKind kind) {
+        auto ids = std::make_shared<std::vector<EntityId>>();
+        ids->reserve(_storage.size());
+
+        std::map<TimeFrameIndex, int> time_local_indices;
+        for (size_t i = 0; i < _storage.size(); ++i) {
+            TimeFrameIndex const time = _storage.getTime(i);
+            int const local_index = time_local_indices[time]++;
+            ids->push_back(_identity_registry
+                                   ? _identity_registry->ensureId(_identity_data_key, kind, time, local_index)
+                                   : EntityId(0));
+        }
+
+        std::shared_ptr<RaggedStorageWrapper<TData> const> source;
+        if (auto const * rekeyed = _storage.template tryGet<LazyRaggedStorage<TData, LazyRekeyView>>()) {
+            source = std::get<2>(rekeyed->getView()[0]).source;
+        } else {
+            source = std::make_shared<RaggedStorageWrapper<TData> const>(std::move(_storage));
+        }
+        auto view = std::views::iota(size_t{0}, source->size()) |
+                    std::views::transform(LazyRekey{source, std::move(ids)});
+        auto const num_elements = source->size();
+
+        _invalidateStorageCache();
+        _storage = RaggedStorageWrapper<TData>(LazyRaggedStorage<TData, decltype(view)>(std::move(view), num_elements));
+        _updateStorageCache();
+    }
+
     /**
      * @brief Append multiple entries preserving EntityIds with a single cache update
      *
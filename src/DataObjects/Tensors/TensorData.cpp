@@ -12,6 +12,7 @@
 #include "Tensors/RowDescriptor.hpp"
 #include "Tensors/storage/ArmadilloTensorStorage.hpp"
 #include "Tensors/storage/DenseTensorStorage.hpp"
+#include "Tensors/storage/LaggedTensorStorage.hpp"
 #include "Tensors/storage/LazyColumnTensorStorage.hpp"
 #include "Tensors/storage/TensorStorageWrapper.hpp"
 
@@ -28,6 +29,7 @@
 #include <cassert>
 #include <cstddef>
 #include <map>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -654,6 +656,12 @@ std::vector<float> TensorData::materializeFlat() const {
         return {span.begin(), span.end()};
     }
 
+    // Lagged views copy whole row blocks instead of one element at a time
+    if (auto const * lagged = _storage.getAsChecked<LaggedTensorStorage>(
+                TensorStorageType::Lagged)) {
+        return lagged->materializeFlat();
+    }
+
     // For Armadillo (column-major) or non-contiguous storage,
     // reconstruct row-major by element-wise access
     auto const total = _dimensions.totalElements();
@@ -768,6 +776,33 @@ TensorData TensorData::toArmadillo() const {
     }
 #endif
 
+    // Lagged views fill the column-major matrix directly, one column at a time,
+    // without the intermediate row-major vector.
+    if (auto const * lagged = _storage.getAsChecked<LaggedTensorStorage>(
+                TensorStorageType::Lagged)) {
+        arma::fmat mat(lagged->numRows(), lagged->numColumns());
+        for (std::size_t c = 0; c < lagged->numColumns(); ++c) {
+            lagged->copyColumn(c, std::span<float>(mat.colptr(static_cast<arma::uword>(c)), mat.n_rows));
+        }
+
+        auto s = _dimensions.shape();
+        std::vector<AxisDescriptor> axes;
+        axes.reserve(s.size());
+        for (std::size_t i = 0; i < s.size(); ++i) {
+            axes.push_back(_dimensions.axis(i));
+        }
+        DimensionDescriptor dims{axes};
+        if (_dimensions.hasColumnNames()) {
+            dims.setColumnNames(
+                    std::vector<std::string>(_dimensions.columnNames().begin(),
+                                             _dimensions.columnNames().end()));
+        }
+
+        return TensorData{std::move(dims), _rows,
+                          TensorStorageWrapper{ArmadilloTensorStorage{std::move(mat)}},
+                          _time_frame};
+    }
+
     // Generic path: materialize via flat vector (for Dense, Lazy, Mmap, etc.)
     return materialize();
 }
@@ -0,0 +1,249 @@
+/**
+ * @file LaggedTensorStorage.cpp
+ * @brief Implementation of the zero-copy lagged tensor view
+ */
+
+#include "LaggedTensorStorage.hpp"
+
+#include "ArmadilloTensorStorage.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+/// Rows copied per block by materializeRows (keeps the source window cache-resident)
+constexpr std::size_t kRowBlock = 256;
+
+}// namespace
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+LaggedTensorStorage::LaggedTensorStorage(TensorStorageWrapper source,
+                                         std::vector<int> offsets,
+                                         std::size_t row_begin,
+                                         std::size_t num_rows,
+                                         LaggedOutOfRange out_of_range,
+                                         float fill_value)
+    : _source(std::move(source)),
+      _offsets(std::move(offsets)),
+      _row_begin(row_begin),
+      _num_rows(num_rows),
+      _out_of_range(out_of_range),
+      _fill_value(fill_value) {
+    if (!_source.isValid()) {
+        throw std::invalid_argument("LaggedTensorStorage: source storage is empty");
+    }
+    auto const shape = _source.shape();
+    if (shape.size() != 2) {
+        throw std::invalid_argument(
+                "LaggedTensorStorage: source must be 2D, got " +
+                std::to_string(shape.size()) + "D");
+    }
+    if (_offsets.empty()) {
+        throw std::invalid_argument("LaggedTensorStorage: at least one offset is required");
+    }
+    _source_rows = shape[0];
+    _source_cols = shape[1];
+    if (_num_rows == 0 || _row_begin + _num_rows > _source_rows) {
+        throw std::invalid_argument(
+                "LaggedTensorStorage: row range [" + std::to_string(_row_begin) + ", " +
+                std::to_string(_row_begin + _num_rows) + ") exceeds source rows " +
+                std::to_string(_source_rows));
+    }
+
+    // Resolve a strided pointer into the source buffer
+    if (auto const * arma = _source.getAsChecked<ArmadilloTensorStorage>(
+                TensorStorageType::Armadillo)) {
+        _data = arma->matrix().memptr();
+        _row_stride = 1;
+        _col_stride = _source_rows;
+    } else if (_source.isContiguous()) {
+        _data = _source.flatData().data();
+        _row_stride = _source_cols;
+        _col_stride = 1;
+    } else {
+        // Lazy / memory-mapped sources: one column-major copy shared by all offsets
+        auto owned = std::make_shared<std::vector<float>>(_source_rows * _source_cols);
+        for (std::size_t c = 0; c < _source_cols; ++c) {
+            auto const column = _source.getColumn(c);
+            std::copy(column.begin(), column.end(),
+                      owned->begin() + static_cast<std::ptrdiff_t>(c * _source_rows));
+        }
+        _data = owned->data();
+        _row_stride = 1;
+        _col_stride = _source_rows;
+        _owned = std::move(owned);
+    }
+}
+
+// =============================================================================
+// Bulk Materialization
+// =============================================================================
+
+void LaggedTensorStorage::materializeRows(std::size_t row_begin,
+                                          std::size_t row_end,
+                                          std::span<float> out) const {
+    auto const num_cols = numColumns();
+    if (row_begin > row_end || row_end > _num_rows) {
+        throw std::out_of_range(
+                "LaggedTensorStorage::materializeRows: invalid row range [" +
+                std::to_string(row_begin) + ", " + std::to_string(row_end) + ")");
+    }
+    if (out.size() != (row_end - row_begin) * num_cols) {
+        throw std::invalid_argument(
+                "LaggedTensorStorage::materializeRows: output has " +
+                std::to_string(out.size()) + " elements, expected " +
+                std::to_string((row_end - row_begin) * num_cols));
+    }
+
+    for (std::size_t lo = row_begin; lo < row_end; lo += kRowBlock) {
+        std::size_t const hi = std::min(lo + kRowBlock, row_end);
+        for (std::size_t g = 0; g < _offsets.size(); ++g) {
+            std::size_t const group_col = g * _source_cols;
+            if (_col_stride == 1) {
+                // Row-major source: each (row, group) is one contiguous run
+                for (std::size_t r = lo; r < hi; ++r) {
+                    float * dst = out.data() + (r - row_begin) * num_cols + group_col;
+                    auto const s = sourceRow(r, g);
+                    if (s < 0) {
+                        std::fill_n(dst, _source_cols, _fill_value);
+                    } else {
+                        float const * src = _data + static_cast<std::size_t>(s) * _row_stride;
+                        std::copy_n(src, _source_cols, dst);
+                    }
+                }
+            } else {
+                // Column-major source: walk each source column down the block
+                for (std::size_t c = 0; c < _source_cols; ++c) {
+                    float const * src_col = _data + c * _col_stride;
+                    for (std::size_t r = lo; r < hi; ++r) {
+                        auto const s = sourceRow(r, g);
+                        out[(r - row_begin) * num_cols + group_col + c] =
+                                s < 0 ? _fill_value
+                                      : src_col[static_cast<std::size_t>(s) * _row_stride];
+                    }
+                }
+            }
+        }
+    }
+}
+
+void LaggedTensorStorage::copyColumn(std::size_t col, std::span<float> out) const {
+    validateColumn(col);
+    if (out.size() != _num_rows) {
+        throw std::invalid_argument(
+                "LaggedTensorStorage::copyColumn: output has " + std::to_string(out.size()) +
+                " elements, expected " + std::to_string(_num_rows));
+    }
+    std::size_t const g = col / _source_cols;
+    float const * src_col = _data + (col % _source_cols) * _col_stride;
+    for (std::size_t r = 0; r < _num_rows; ++r) {
+        auto const s = sourceRow(r, g);
+        out[r] = s < 0 ? _fill_value : src_col[static_cast<std::size_t>(s) * _row_stride];
+    }
+}
+
+std::vector<float> LaggedTensorStorage::materializeFlat() const {
+    std::vector<float> flat(_num_rows * numColumns());
+    materializeRows(0, _num_rows, flat);
+    return flat;
+}
+
+// =============================================================================
+// CRTP Implementation
+// =============================================================================
+
+float LaggedTensorStorage::getValueAtImpl(std::span<std::size_t const> indices) const {
+    if (indices.size() != 2) {
+        throw std::invalid_argument(
+                "LaggedTensorStorage::getValueAt: expected 2 indices, got " +
+                std::to_string(indices.size()));
+    }
+    auto const row = indices[0];
+    auto const col = indices[1];
+    if (row >= _num_rows) {
+        throw std::out_of_range(
+                "LaggedTensorStorage::getValueAt: row " + std::to_string(row) +
+                " >= num_rows " + std::to_string(_num_rows));
+    }
+    validateColumn(col);
+
+    auto const s = sourceRow(row, col / _source_cols);
+    if (s < 0) {
+        return _fill_value;
+    }
+    return _data[static_cast<std::size_t>(s) * _row_stride + (col % _source_cols) * _col_stride];
+}
+
+std::span<float const> LaggedTensorStorage::flatDataImpl() const {
+    throw std::runtime_error(
+            "LaggedTensorStorage::flatData: not available (non-contiguous). "
+            "Use materializeFlat() or getColumn() instead.");
+}
+
+std::vector<float> LaggedTensorStorage::sliceAlongAxisImpl(std::size_t axis,
+                                                           std::size_t index) const {
+    if (axis == 0) {
+        if (index >= _num_rows) {
+            throw std::out_of_range(
+                    "LaggedTensorStorage::sliceAlongAxis: row index " +
+                    std::to_string(index) + " >= num_rows " + std::to_string(_num_rows));
+        }
+        std::vector<float> result(numColumns());
+        materializeRows(index, index + 1, result);
+        return result;
+    }
+    if (axis == 1) {
+        return getColumnImpl(index);
+    }
+    throw std::out_of_range(
+            "LaggedTensorStorage::sliceAlongAxis: axis " + std::to_string(axis) + " >= ndim 2");
+}
+
+std::vector<float> LaggedTensorStorage::getColumnImpl(std::size_t col) const {
+    std::vector<float> result(_num_rows);
+    copyColumn(col, result);
+    return result;
+}
+
+std::vector<std::size_t> LaggedTensorStorage::shapeImpl() const {
+    return {_num_rows, numColumns()};
+}
+
+std::size_t LaggedTensorStorage::totalElementsImpl() const {
+    return _num_rows * numColumns();
+}
+
+TensorStorageCache LaggedTensorStorage::tryGetCacheImpl() const {
+    // Not contiguous — cache is always invalid
+    return TensorStorageCache{};
+}
+
+// =============================================================================
+// Private Helpers
+// =============================================================================
+
+std::ptrdiff_t LaggedTensorStorage::sourceRow(std::size_t row, std::size_t group) const noexcept {
+    auto const s = static_cast<std::ptrdiff_t>(_row_begin + row) + _offsets[group];
+    auto const last = static_cast<std::ptrdiff_t>(_source_rows) - 1;
+    if (s >= 0 && s <= last) {
+        return s;
+    }
+    if (_out_of_range == LaggedOutOfRange::Clamp) {
+        return std::clamp<std::ptrdiff_t>(s, 0, last);
+    }
+    return -1;
+}
+
+void LaggedTensorStorage::validateColumn(std::size_t col) const {
+    if (col >= numColumns()) {
+        throw std::out_of_range(
+                "LaggedTensorStorage: column index " + std::to_string(col) +
+                " >= num_columns " + std::to_string(numColumns()));
+    }
+}
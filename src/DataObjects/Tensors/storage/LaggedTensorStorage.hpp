@@ -0,0 +1,148 @@
+#ifndef LAGGED_TENSOR_STORAGE_HPP
+#define LAGGED_TENSOR_STORAGE_HPP
+
+/**
+ * @file LaggedTensorStorage.hpp
+ * @brief Zero-copy time-lagged ("Hankel") view over a 2D tensor storage
+ *
+ * Presents a 2D source tensor of shape [R, C] as a wider tensor whose columns
+ * are row-shifted copies of the source columns:
+ *
+ *     [ shift(offsets[0]) | shift(offsets[1]) | ... ]   each group has C columns
+ *
+ * Output element (r, g * C + c) reads source element
+ * (row_begin + r + offsets[g], c). Out-of-range rows are either filled with a
+ * constant or clamped to the first/last source row.
+ *
+ * No lagged copy is ever stored. Consumers that need contiguous data call
+ * `materializeRows()` (blocked, row-major) or `copyColumn()`.
+ *
+ * @see TensorTemporalNeighbors for the producing transform.
+ */
+
+#include "TensorStorageBase.hpp"
+#include "TensorStorageWrapper.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+/**
+ * @brief How source rows outside [0, R) are resolved
+ */
+enum class LaggedOutOfRange {
+    Fill, ///< Use the configured fill value (e.g. NaN or 0)
+    Clamp ///< Read the nearest valid source row
+};
+
+/**
+ * @brief Lazy strided storage exposing lag/lead column groups over a source
+ *
+ * ## Key properties
+ *
+ * - **Shape** is 2D: [num_rows, offsets.size() * source_cols]
+ * - **Zero-copy** for Armadillo and contiguous row-major sources: the view
+ *   reads the source buffer through (row, column) strides. Other backends
+ *   (lazy, memory-mapped) are copied once on construction, never per offset.
+ * - **Not contiguous**: `flatData()` throws. Use `materializeRows()`,
+ *   `copyColumn()`, or TensorData::materializeFlat()/toArmadillo().
+ * - **Immutable**: the source storage is shared, never modified.
+ */
+class LaggedTensorStorage : public TensorStorageBase<LaggedTensorStorage> {
+public:
+    // ========== Construction ==========
+
+    /**
+     * @brief Construct a lagged view over a 2D source storage
+     *
+     * @param source     2D source storage (shared, not copied when possible)
+     * @param offsets    Row offset of each column group (0 = unshifted copy)
+     * @param row_begin  First source row presented as output row 0
+     * @param num_rows   Number of output rows
+     * @param out_of_range Resolution policy for shifted rows outside the source
+     * @param fill_value Value used when @p out_of_range is Fill
+     *
+     * @pre source.isValid() && source.shape().size() == 2 (enforcement: exception)
+     * @pre !offsets.empty() (enforcement: exception)
+     * @pre num_rows > 0 && row_begin + num_rows <= source rows (enforcement: exception)
+     *
+     * @throws std::invalid_argument on any violated precondition
+     */
+    LaggedTensorStorage(TensorStorageWrapper source,
+                        std::vector<int> offsets,
+                        std::size_t row_begin,
+                        std::size_t num_rows,
+                        LaggedOutOfRange out_of_range,
+                        float fill_value);
+
+    // ========== Bulk Materialization ==========
+
+    /**
+     * @brief Write rows [row_begin, row_end) into @p out in row-major order
+     *
+     * Copies in blocks of rows so that the source window stays cache-resident
+     * across all offset groups.
+     *
+     * @pre row_begin <= row_end <= numRows() (enforcement: exception)
+     * @pre out.size() == (row_end - row_begin) * numColumns() (enforcement: exception)
+     */
+    void materializeRows(std::size_t row_begin, std::size_t row_end, std::span<float> out) const;
+
+    /**
+     * @brief Write column @p col (all rows) into @p out
+     *
+     * @pre col < numColumns() (enforcement: exception)
+     * @pre out.size() == numRows() (enforcement: exception)
+     */
+    void copyColumn(std::size_t col, std::span<float> out) const;
+
+    /**
+     * @brief Row-major copy of the whole view
+     */
+    [[nodiscard]] std::vector<float> materializeFlat() const;
+
+    [[nodiscard]] std::size_t numRows() const noexcept { return _num_rows; }
+    [[nodiscard]] std::size_t numColumns() const noexcept { return _offsets.size() * _source_cols; }
+    [[nodiscard]] std::size_t sourceColumns() const noexcept { return _source_cols; }
+    [[nodiscard]] std::vector<int> const & offsets() const noexcept { return _offsets; }
+
+    // ========== CRTP Implementation ==========
+
+    [[nodiscard]] float getValueAtImpl(std::span<std::size_t const> indices) const;
+    [[nodiscard]] std::span<float const> flatDataImpl() const;
+    [[nodiscard]] std::vector<float> sliceAlongAxisImpl(std::size_t axis, std::size_t index) const;
+    [[nodiscard]] std::vector<float> getColumnImpl(std::size_t col) const;
+    [[nodiscard]] std::vector<std::size_t> shapeImpl() const;
+    [[nodiscard]] std::size_t totalElementsImpl() const;
+    [[nodiscard]] bool isContiguousImpl() const noexcept { return false; }
+    [[nodiscard]] TensorStorageType getStorageTypeImpl() const noexcept {
+        return TensorStorageType::Lagged;
+    }
+    [[nodiscard]] TensorStorageCache tryGetCacheImpl() const;
+
+private:
+    TensorStorageWrapper _source;                   ///< Keeps the viewed buffer alive
+    std::shared_ptr<std::vector<float> const> _owned;///< Column-major copy for non-strided sources
+    float const * _data = nullptr;                  ///< Base pointer of the viewed buffer
+    std::size_t _row_stride = 0;                    ///< Elements between consecutive source rows
+    std::size_t _col_stride = 0;                    ///< Elements between consecutive source columns
+    std::size_t _source_rows = 0;
+    std::size_t _source_cols = 0;
+
+    std::vector<int> _offsets;
+    std::size_t _row_begin = 0;
+    std::size_t _num_rows = 0;
+    LaggedOutOfRange _out_of_range = LaggedOutOfRange::Fill;
+    float _fill_value = 0.0f;
+
+    /**
+     * @brief Source row for output row @p row in group @p group, or -1 if it
+     *        must be filled
+     */
+    [[nodiscard]] std::ptrdiff_t sourceRow(std::size_t row, std::size_t group) const noexcept;
+
+    void validateColumn(std::size_t col) const;
+};
+
+#endif// LAGGED_TENSOR_STORAGE_HPP
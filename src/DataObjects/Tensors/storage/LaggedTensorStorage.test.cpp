@@ -0,0 +1,279 @@
+/**
+ * @file LaggedTensorStorage.test.cpp
+ * @brief Unit tests for LaggedTensorStorage
+ *
+ * Tests cover:
+ * - Construction (valid, invalid inputs)
+ * - Element access for shifted groups (Fill and Clamp boundaries)
+ * - Row range offset (row_begin) used by Drop-style views
+ * - Column extraction and blocked row materialization
+ * - Armadillo (column-major), Dense (row-major) and Lazy sources agree
+ * - Metadata (shape, isContiguous, storage type, flatData throws)
+ * - TensorData integration (materializeFlat, toArmadillo)
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "Tensors/TensorData.hpp"
+#include "Tensors/storage/ArmadilloTensorStorage.hpp"
+#include "Tensors/storage/DenseTensorStorage.hpp"
+#include "Tensors/storage/LaggedTensorStorage.hpp"
+#include "Tensors/storage/LazyColumnTensorStorage.hpp"
+#include "Tensors/storage/TensorStorageWrapper.hpp"
+
+#include "TimeFrame/TimeIndexStorage.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+namespace {
+
+/// 600 rows x 3 cols; value(r, c) = 10 * r + c (spans several row blocks)
+constexpr std::size_t kRows = 600;
+constexpr std::size_t kCols = 3;
+
+float sourceValue(std::size_t r, std::size_t c) {
+    return static_cast<float>(10 * r + c);
+}
+
+std::vector<float> makeRowMajor() {
+    std::vector<float> data(kRows * kCols);
+    for (std::size_t r = 0; r < kRows; ++r) {
+        for (std::size_t c = 0; c < kCols; ++c) {
+            data[r * kCols + c] = sourceValue(r, c);
+        }
+    }
+    return data;
+}
+
+TensorStorageWrapper makeArmadilloSource() {
+    arma::fmat mat(kRows, kCols);
+    for (std::size_t r = 0; r < kRows; ++r) {
+        for (std::size_t c = 0; c < kCols; ++c) {
+            mat(r, c) = sourceValue(r, c);
+        }
+    }
+    return TensorStorageWrapper{ArmadilloTensorStorage{std::move(mat)}};
+}
+
+TensorStorageWrapper makeDenseSource() {
+    return TensorStorageWrapper{DenseTensorStorage{makeRowMajor(), {kRows, kCols}}};
+}
+
+TensorStorageWrapper makeLazySource() {
+    std::vector<ColumnSource> columns;
+    for (std::size_t c = 0; c < kCols; ++c) {
+        columns.push_back(ColumnSource{"c" + std::to_string(c), [c] {
+                                           std::vector<float> col(kRows);
+                                           for (std::size_t r = 0; r < kRows; ++r) {
+                                               col[r] = sourceValue(r, c);
+                                           }
+                                           return col;
+                                       },
+                                       {}});
+    }
+    return TensorStorageWrapper{LazyColumnTensorStorage{kRows, std::move(columns)}};
+}
+
+/// Reference value for output (r, g*kCols + c) with Fill boundary
+float expectedFill(std::size_t row_begin, std::size_t r, int offset, std::size_t c, float fill) {
+    auto const s = static_cast<std::ptrdiff_t>(row_begin + r) + offset;
+    if (s < 0 || s >= static_cast<std::ptrdiff_t>(kRows)) {
+        return fill;
+    }
+    return sourceValue(static_cast<std::size_t>(s), c);
+}
+
+}// namespace
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+TEST_CASE("LaggedTensorStorage construction", "[LaggedTensorStorage]") {
+    SECTION("shape is rows x (groups * source cols)") {
+        LaggedTensorStorage storage{makeDenseSource(), {0, -2, 3}, 0, kRows,
+                                    LaggedOutOfRange::Fill, 0.0f};
+        CHECK(storage.shape() == std::vector<std::size_t>{kRows, 9});
+        CHECK(storage.totalElements() == kRows * 9);
+        CHECK_FALSE(storage.isContiguous());
+        CHECK(storage.getStorageType() == TensorStorageType::Lagged);
+        CHECK_FALSE(storage.tryGetCache().isValid());
+        CHECK_THROWS_AS(storage.flatData(), std::runtime_error);
+    }
+
+    SECTION("rejects empty offsets") {
+        CHECK_THROWS_AS(LaggedTensorStorage(makeDenseSource(), {}, 0, kRows,
+                                            LaggedOutOfRange::Fill, 0.0f),
+                        std::invalid_argument);
+    }
+
+    SECTION("rejects row range past the source") {
+        CHECK_THROWS_AS(LaggedTensorStorage(makeDenseSource(), {0}, 10, kRows,
+                                            LaggedOutOfRange::Fill, 0.0f),
+                        std::invalid_argument);
+        CHECK_THROWS_AS(LaggedTensorStorage(makeDenseSource(), {0}, 0, 0,
+                                            LaggedOutOfRange::Fill, 0.0f),
+                        std::invalid_argument);
+    }
+
+    SECTION("rejects non-2D source") {
+        TensorStorageWrapper source{DenseTensorStorage{std::vector<float>(8, 1.0f), {2, 2, 2}}};
+        CHECK_THROWS_AS(LaggedTensorStorage(source, {0}, 0, 2, LaggedOutOfRange::Fill, 0.0f),
+                        std::invalid_argument);
+    }
+}
+
+// =============================================================================
+// Element access and boundaries
+// =============================================================================
+
+TEST_CASE("LaggedTensorStorage boundaries", "[LaggedTensorStorage]") {
+    std::vector<int> const offsets = {0, -2, 1};
+
+    SECTION("Fill boundary uses the fill value") {
+        LaggedTensorStorage storage{makeDenseSource(), offsets, 0, kRows,
+                                    LaggedOutOfRange::Fill, -1.0f};
+        std::vector<std::size_t> idx = {0, 3};// row 0, lag -2, col 0
+        CHECK(storage.getValueAt(idx) == -1.0f);
+        idx = {2, 3};
+        CHECK(storage.getValueAt(idx) == sourceValue(0, 0));
+        idx = {kRows - 1, 8};// last row, lead +1, col 2
+        CHECK(storage.getValueAt(idx) == -1.0f);
+        idx = {5, 1};
+        CHECK(storage.getValueAt(idx) == sourceValue(5, 1));
+    }
+
+    SECTION("NaN fill value propagates") {
+        LaggedTensorStorage storage{makeDenseSource(), offsets, 0, kRows,
+                                    LaggedOutOfRange::Fill, std::nanf("")};
+        auto const col = storage.getColumn(4);// lag -2, col 1
+        CHECK(std::isnan(col[0]));
+        CHECK(std::isnan(col[1]));
+        CHECK(col[2] == sourceValue(0, 1));
+    }
+
+    SECTION("Clamp boundary reads the nearest row") {
+        LaggedTensorStorage storage{makeDenseSource(), offsets, 0, kRows,
+                                    LaggedOutOfRange::Clamp, 0.0f};
+        std::vector<std::size_t> idx = {0, 3};
+        CHECK(storage.getValueAt(idx) == sourceValue(0, 0));
+        idx = {kRows - 1, 6};
+        CHECK(storage.getValueAt(idx) == sourceValue(kRows - 1, 0));
+    }
+
+    SECTION("row_begin skips leading source rows") {
+        LaggedTensorStorage storage{makeDenseSource(), offsets, 2, kRows - 3,
+                                    LaggedOutOfRange::Fill, -1.0f};
+        std::vector<std::size_t> idx = {0, 0};
+        CHECK(storage.getValueAt(idx) == sourceValue(2, 0));
+        idx = {0, 3};
+        CHECK(storage.getValueAt(idx) == sourceValue(0, 0));
+        idx = {kRows - 4, 6};
+        CHECK(storage.getValueAt(idx) == sourceValue(kRows - 1, 0));
+    }
+
+    SECTION("out-of-range access throws") {
+        LaggedTensorStorage storage{makeDenseSource(), offsets, 0, kRows,
+                                    LaggedOutOfRange::Fill, 0.0f};
+        std::vector<std::size_t> idx = {kRows, 0};
+        CHECK_THROWS_AS(storage.getValueAt(idx), std::out_of_range);
+        idx = {0, 9};
+        CHECK_THROWS_AS(storage.getValueAt(idx), std::out_of_range);
+        CHECK_THROWS_AS(storage.getColumn(9), std::out_of_range);
+    }
+}
+
+// =============================================================================
+// Bulk materialization
+// =============================================================================
+
+TEST_CASE("LaggedTensorStorage materialization matches reference for all sources",
+          "[LaggedTensorStorage]") {
+    std::vector<int> const offsets = {0, -3, -1, 2};
+    std::size_t const num_cols = offsets.size() * kCols;
+    float const fill = -7.0f;
+
+    std::vector<TensorStorageWrapper> const sources = {
+            makeArmadilloSource(), makeDenseSource(), makeLazySource()};
+
+    for (auto const & source: sources) {
+        LaggedTensorStorage storage{source, offsets, 1, kRows - 1,
+                                    LaggedOutOfRange::Fill, fill};
+
+        auto const flat = storage.materializeFlat();
+        REQUIRE(flat.size() == (kRows - 1) * num_cols);
+        for (std::size_t r = 0; r < kRows - 1; ++r) {
+            for (std::size_t g = 0; g < offsets.size(); ++g) {
+                for (std::size_t c = 0; c < kCols; ++c) {
+                    REQUIRE(flat[r * num_cols + g * kCols + c] ==
+                            expectedFill(1, r, offsets[g], c, fill));
+                }
+            }
+        }
+
+        for (std::size_t col = 0; col < num_cols; ++col) {
+            auto const column = storage.getColumn(col);
+            for (std::size_t r = 0; r < kRows - 1; ++r) {
+                REQUIRE(column[r] == flat[r * num_cols + col]);
+            }
+        }
+
+        auto const row = storage.sliceAlongAxis(0, 300);
+        for (std::size_t col = 0; col < num_cols; ++col) {
+            CHECK(row[col] == flat[300 * num_cols + col]);
+        }
+
+        std::vector<float> partial(10 * num_cols);
+        storage.materializeRows(250, 260, partial);
+        for (std::size_t i = 0; i < partial.size(); ++i) {
+            REQUIRE(partial[i] == flat[250 * num_cols + i]);
+        }
+    }
+}
+
+TEST_CASE("LaggedTensorStorage materializeRows validates arguments", "[LaggedTensorStorage]") {
+    LaggedTensorStorage storage{makeDenseSource(), {0, 1}, 0, kRows,
+                                LaggedOutOfRange::Fill, 0.0f};
+    std::vector<float> out(6);
+    CHECK_THROWS_AS(storage.materializeRows(0, 2, out), std::invalid_argument);
+    CHECK_THROWS_AS(storage.materializeRows(5, 4, out), std::out_of_range);
+    CHECK_THROWS_AS(storage.materializeRows(0, kRows + 1, out), std::out_of_range);
+}
+
+// =============================================================================
+// TensorData integration
+// =============================================================================
+
+TEST_CASE("LaggedTensorStorage TensorData integration", "[LaggedTensorStorage]") {
+    auto source = TensorData::createTimeSeries2D(
+            makeRowMajor(), kRows, kCols,
+            TimeIndexStorageFactory::createDenseFromZero(kRows), nullptr);
+
+    TensorStorageWrapper lagged{LaggedTensorStorage{source.storage(), {0, -1}, 0, kRows,
+                                                    LaggedOutOfRange::Clamp, 0.0f}};
+    auto tensor = TensorData::createTimeSeries2DFromStorage(
+            std::move(lagged), TimeIndexStorageFactory::createDenseFromZero(kRows), nullptr);
+
+    CHECK(tensor.numRows() == kRows);
+    CHECK(tensor.numColumns() == 2 * kCols);
+
+    auto const flat = tensor.materializeFlat();
+    CHECK(flat[0 * 6 + 3] == sourceValue(0, 0));
+    CHECK(flat[10 * 6 + 4] == sourceValue(9, 1));
+
+    auto const arma_tensor = tensor.toArmadillo();
+    auto const & mat = arma_tensor.asArmadilloMatrix();
+    for (std::size_t r = 0; r < kRows; ++r) {
+        for (std::size_t c = 0; c < 2 * kCols; ++c) {
+            REQUIRE(mat(r, c) == flat[r * 6 + c]);
+        }
+    }
+}
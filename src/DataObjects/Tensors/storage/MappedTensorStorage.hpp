@@ -0,0 +1,127 @@
+/**
+ * @file MappedTensorStorage.hpp
+ * @brief TensorData storage backend over a contiguous row-major float buffer
+ *        owned by someone else (typically a read-only file mapping).
+ *
+ * Unlike MmapTensorStorage, the data is one contiguous span, so flatData()
+ * and the fast-path cache are available without copying.
+ *
+ * This is a header-only file, compiled by the consumer that creates the
+ * storage (e.g., DataManagerIO's native format loader).
+ */
+
+#ifndef MAPPED_TENSOR_STORAGE_HPP
+#define MAPPED_TENSOR_STORAGE_HPP
+
+#include "TensorStorageBase.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Read-only 2D tensor storage viewing an externally owned float buffer.
+ *
+ * The storage keeps @p owner alive for as long as it (or any copy of the
+ * wrapping TensorStorageWrapper) exists, so the span stays valid.
+ *
+ * @pre data.size() == num_rows * num_cols (enforcement: exception)
+ * @pre owner keeps the memory behind data alive (enforcement: none) [CRITICAL]
+ */
+class MappedTensorStorage : public TensorStorageBase<MappedTensorStorage> {
+public:
+    MappedTensorStorage(std::shared_ptr<void const> owner,
+                        std::span<float const> data,
+                        std::size_t num_rows,
+                        std::size_t num_cols)
+        : _owner(std::move(owner)),
+          _data(data),
+          _num_rows(num_rows),
+          _num_cols(num_cols) {
+        if (_data.size() != _num_rows * _num_cols) {
+            throw std::invalid_argument("MappedTensorStorage: data size does not match shape");
+        }
+    }
+
+    ~MappedTensorStorage() = default;
+
+    // CRTP implementation methods
+
+    [[nodiscard]] float getValueAtImpl(std::span<std::size_t const> indices) const {
+        if (indices.size() != 2) {
+            throw std::invalid_argument("MappedTensorStorage: expected 2 indices (row, col)");
+        }
+        if (indices[0] >= _num_rows || indices[1] >= _num_cols) {
+            throw std::out_of_range("MappedTensorStorage: index out of range");
+        }
+        return _data[indices[0] * _num_cols + indices[1]];
+    }
+
+    [[nodiscard]] std::span<float const> flatDataImpl() const {
+        return _data;
+    }
+
+    [[nodiscard]] std::vector<float> sliceAlongAxisImpl(
+            std::size_t axis,
+            std::size_t index) const {
+        if (axis == 0) {
+            if (index >= _num_rows) {
+                throw std::out_of_range("MappedTensorStorage: row index out of range");
+            }
+            auto const row = _data.subspan(index * _num_cols, _num_cols);
+            return {row.begin(), row.end()};
+        }
+        if (axis == 1) {
+            return getColumnImpl(index);
+        }
+        throw std::out_of_range("MappedTensorStorage: axis must be 0 or 1 for 2D tensor");
+    }
+
+    [[nodiscard]] std::vector<float> getColumnImpl(std::size_t col) const {
+        if (col >= _num_cols) {
+            throw std::out_of_range("MappedTensorStorage: column index out of range");
+        }
+        std::vector<float> result(_num_rows);
+        for (std::size_t r = 0; r < _num_rows; ++r) {
+            result[r] = _data[r * _num_cols + col];
+        }
+        return result;
+    }
+
+    [[nodiscard]] std::vector<std::size_t> shapeImpl() const {
+        return {_num_rows, _num_cols};
+    }
+
+    [[nodiscard]] std::size_t totalElementsImpl() const {
+        return _data.size();
+    }
+
+    [[nodiscard]] bool isContiguousImpl() const {
+        return true;
+    }
+
+    [[nodiscard]] TensorStorageType getStorageTypeImpl() const {
+        return TensorStorageType::Mapped;
+    }
+
+    [[nodiscard]] TensorStorageCache tryGetCacheImpl() const {
+        TensorStorageCache cache;
+        cache.data_ptr = _data.data();
+        cache.total_elements = _data.size();
+        cache.shape = {_num_rows, _num_cols};
+        cache.strides = {_num_cols, 1};
+        cache.is_valid = true;
+        return cache;
+    }
+
+private:
+    std::shared_ptr<void const> _owner;
+    std::span<float const> _data;
+    std::size_t _num_rows;
+    std::size_t _num_cols;
+};
+
+#endif// MAPPED_TENSOR_STORAGE_HPP
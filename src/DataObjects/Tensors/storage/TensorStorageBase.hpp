@@ -34,7 +34,9 @@ enum class TensorStorageType {
     LibTorch,   ///< at::Tensor (optional, behind #ifdef)
     View,       ///< Zero-copy slice of another storage
     Lazy,       ///< Lazily computed columns (transforms v2 pipelines)
-    MemoryMapped///< Block-cached memory-mapped interleaved binary (Phase 2)
+    MemoryMapped,///< Block-cached memory-mapped interleaved binary (Phase 2)
+    Lagged,      ///< Zero-copy lag/lead column groups over another storage
+    Mapped       ///< Contiguous row-major view of an externally owned buffer (native format, embedding cache)
 };
 
 /**
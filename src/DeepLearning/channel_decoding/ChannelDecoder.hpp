@@ -30,6 +30,7 @@
 
 #include "CoreGeometry/ImageSize.hpp"
 
+#include <optional>
 #include <string>
 
 namespace dl {
@@ -47,11 +48,20 @@ struct DecoderContext {
     ImageSize target_image_size{};///< Scale output back to original coords
 };
 
+/**
+ * @brief How a mask channel is resampled to DecoderContext::target_image_size.
+ */
+enum class MaskResampling {
+    Nearest, ///< Threshold the nearest tensor pixel
+    Bilinear ///< Threshold the bilinearly interpolated activation
+};
+
 /**
  * @brief User-configurable params for TensorToMask2D.
  */
 struct MaskDecoderParams {
-    float threshold = 0.5f;///< Binary threshold for mask generation
+    float threshold = 0.5f;                  ///< Binary threshold for mask generation
+    std::optional<MaskResampling> resampling;///< Unset = Nearest
 };
 
 /**
@@ -12,7 +12,11 @@
 
 #include <ATen/core/Tensor.h>
 
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace dl {
 
@@ -48,6 +52,16 @@ template<typename DecoderParams>
     }
 }
 
+template<typename Geometry>
+std::vector<DecodedGeometryVariant> toVariants(std::vector<Geometry> decoded) {
+    std::vector<DecodedGeometryVariant> result;
+    result.reserve(decoded.size());
+    for (auto & geometry: decoded) {
+        result.emplace_back(std::move(geometry));
+    }
+    return result;
+}
+
 }// namespace
 
 bool isSpatialDecoder(DecoderVariant const & params) {
@@ -149,4 +163,68 @@ DecodedGeometryVariant decodeToGeometry(
     return result;
 }
 
+template<typename DecoderParams>
+std::vector<DecodedGeometryVariant> decodeBatchToGeometry(
+        at::Tensor const & tensor,
+        DecoderContext const & ctx,
+        DecoderParams const & params,
+        int batch_size) {
+    if (batch_size <= 0) {
+        return {};
+    }
+
+    if constexpr (std::is_same_v<DecoderParams, FeatureVectorDecoderParams>) {
+        std::vector<DecodedGeometryVariant> result;
+        result.reserve(static_cast<std::size_t>(batch_size));
+        auto element_ctx = ctx;
+        for (int b = 0; b < batch_size; ++b) {
+            element_ctx.batch_index = b;
+            result.emplace_back(TensorToFeatureVector::decode(tensor, element_ctx, params));
+        }
+        return result;
+    } else {
+        // Shape errors are reported by the decoder's own validation
+        auto batch = tensor;
+        if (tensor.defined() && tensor.dim() == 4) {
+            if (tensor.size(0) < batch_size) {
+                throw std::out_of_range(
+                        "decodeBatchToGeometry: tensor batch " + std::to_string(tensor.size(0)) +
+                        " is smaller than requested batch_size " + std::to_string(batch_size));
+            }
+            batch = tensor.narrow(0, 0, batch_size);
+        }
+
+        if constexpr (std::is_same_v<DecoderParams, MaskDecoderParams>) {
+            return toVariants(TensorToMask2D::decodeBatch(batch, ctx, params));
+        } else if constexpr (std::is_same_v<DecoderParams, PointDecoderParams>) {
+            return toVariants(TensorToPoint2D::decodeBatch(batch, ctx, params));
+        } else if constexpr (std::is_same_v<DecoderParams, LineDecoderParams>) {
+            return toVariants(TensorToLine2D::decodeBatch(batch, ctx, params));
+        } else {
+            static_assert(sizeof(DecoderParams) == 0, "Unsupported decoder params type");
+        }
+    }
+}
+
+template std::vector<DecodedGeometryVariant> decodeBatchToGeometry<MaskDecoderParams>(
+        at::Tensor const &, DecoderContext const &, MaskDecoderParams const &, int);
+template std::vector<DecodedGeometryVariant> decodeBatchToGeometry<PointDecoderParams>(
+        at::Tensor const &, DecoderContext const &, PointDecoderParams const &, int);
+template std::vector<DecodedGeometryVariant> decodeBatchToGeometry<LineDecoderParams>(
+        at::Tensor const &, DecoderContext const &, LineDecoderParams const &, int);
+template std::vector<DecodedGeometryVariant> decodeBatchToGeometry<FeatureVectorDecoderParams>(
+        at::Tensor const &, DecoderContext const &, FeatureVectorDecoderParams const &, int);
+
+std::vector<DecodedGeometryVariant> decodeBatchToGeometry(
+        at::Tensor const & tensor,
+        DecoderContext const & ctx,
+        DecoderVariant const & params,
+        int batch_size) {
+    std::vector<DecodedGeometryVariant> result;
+    params.visit([&](auto const & decoder_params) {
+        result = decodeBatchToGeometry(tensor, ctx, decoder_params, batch_size);
+    });
+    return result;
+}
+
 }// namespace dl
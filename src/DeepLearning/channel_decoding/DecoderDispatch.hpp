@@ -99,6 +99,35 @@ template<typename DecoderParams>
         DecoderContext const & ctx,
         DecoderVariant const & params);
 
+/**
+ * @brief Decode the first @p batch_size batch elements of a model output tensor.
+ *
+ * Spatial decoders copy the selected channel once for all elements and decode
+ * them in parallel (see TensorToMask2D::decodeBatchRuns()); feature vectors
+ * are decoded per element. ctx.batch_index is ignored.
+ *
+ * @pre batch_size >= 0 (enforcement: none) [IMPORTANT]
+ * @pre For spatial decoders, tensor.size(0) >= batch_size
+ *      (enforcement: exception) [CRITICAL]
+ * @throws std::out_of_range if the tensor holds fewer than @p batch_size elements
+ * @return One geometry per batch element, in batch order.
+ */
+template<typename DecoderParams>
+[[nodiscard]] std::vector<DecodedGeometryVariant> decodeBatchToGeometry(
+        at::Tensor const & tensor,
+        DecoderContext const & ctx,
+        DecoderParams const & params,
+        int batch_size);
+
+/**
+ * @brief decodeBatchToGeometry() for a decoder params variant.
+ */
+[[nodiscard]] std::vector<DecodedGeometryVariant> decodeBatchToGeometry(
+        at::Tensor const & tensor,
+        DecoderContext const & ctx,
+        DecoderVariant const & params,
+        int batch_size);
+
 }// namespace dl
 
 #endif// NEURALYZER_DECODER_DISPATCH_HPP
@@ -19,6 +19,11 @@ struct ParameterUIHints<dl::MaskDecoderParams> {
             f->max_value = 1.0;
             f->is_exclusive_min = true;
         }
+        if (auto * f = schema.field("resampling")) {
+            f->tooltip = "Resampling to the source image size (default Nearest)";
+            f->allowed_values = {"Nearest", "Bilinear"};
+            f->is_advanced = true;
+        }
     }
 };
 
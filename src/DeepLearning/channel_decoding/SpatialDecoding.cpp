@@ -0,0 +1,57 @@
+/**
+ * @file SpatialDecoding.cpp
+ * @brief Implementation of the shared spatial decoder kernels.
+ */
+
+#include "SpatialDecoding.hpp"
+
+#include <ATen/core/Tensor.h>// at::Tensor
+#include <torch/types.h>     // kCPU, kFloat32
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define NEURALYZER_DECODER_SSE2 1
+#endif
+
+namespace dl {
+
+at::Tensor extractChannelBatch(at::Tensor const & tensor, int channel) {
+    return tensor.select(1, channel)
+            .to(torch::kCPU)
+            .to(torch::kFloat32)
+            .contiguous();
+}
+
+ChannelPlane planeAt(at::Tensor const & planes, std::int64_t index) {
+    auto const height = static_cast<int>(planes.size(1));
+    auto const width = static_cast<int>(planes.size(2));
+    auto const * base = planes.data_ptr<float>();
+    return {base + index * static_cast<std::int64_t>(height) * width, height, width};
+}
+
+void thresholdRowBits(float const * row, int width, float threshold, std::span<uint64_t> bits) {
+    auto const words = bitWordsForWidth(width);
+    int x = 0;
+
+    for (std::size_t w = 0; w < words; ++w) {
+        uint64_t word = 0;
+        int const limit = std::min(width - x, 64);
+        int k = 0;
+
+#ifdef NEURALYZER_DECODER_SSE2
+        __m128 const t = _mm_set1_ps(threshold);
+        for (; k + 4 <= limit; k += 4) {
+            auto const mask = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(row + x + k), t));
+            word |= static_cast<uint64_t>(mask) << k;
+        }
+#endif
+        for (; k < limit; ++k) {
+            word |= static_cast<uint64_t>(row[x + k] > threshold) << k;
+        }
+
+        bits[w] = word;
+        x += 64;
+    }
+}
+
+}// namespace dl
@@ -0,0 +1,115 @@
+#ifndef NEURALYZER_SPATIAL_DECODING_HPP
+#define NEURALYZER_SPATIAL_DECODING_HPP
+
+/**
+ * @file SpatialDecoding.hpp
+ * @brief Shared kernels for the spatial channel decoders.
+ *
+ * The batched decoders copy one channel of a whole [B, C, H, W] output to a
+ * contiguous float32 CPU block once, then decode every batch element from
+ * raw row pointers. Thresholding packs each row into 64-bit words (one bit
+ * per pixel, four pixels per SSE compare) so foreground runs are found with
+ * bit scans and empty stretches are skipped a word at a time.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace at {
+class Tensor;
+}
+
+namespace dl {
+
+/**
+ * @brief Read-only view of one row-major [H, W] float32 plane.
+ */
+struct ChannelPlane {
+    float const * data = nullptr;
+    int height = 0;
+    int width = 0;
+
+    [[nodiscard]] float const * row(int y) const {
+        return data + static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
+    }
+    [[nodiscard]] float at(int y, int x) const { return row(y)[x]; }
+};
+
+/**
+ * @brief Copy @p channel of every batch element to a float32 CPU tensor [B, H, W].
+ *
+ * @pre tensor.dim() == 4 and 0 <= channel < tensor.size(1) (enforcement: none) [CRITICAL]
+ * @post Result is contiguous; views from planeAt() stay valid while it lives.
+ */
+[[nodiscard]] at::Tensor extractChannelBatch(at::Tensor const & tensor, int channel);
+
+/**
+ * @brief View of batch element @p index of a tensor from extractChannelBatch().
+ *
+ * @pre 0 <= index < planes.size(0) (enforcement: none) [CRITICAL]
+ */
+[[nodiscard]] ChannelPlane planeAt(at::Tensor const & planes, std::int64_t index);
+
+/**
+ * @brief Number of 64-bit words holding one bit per pixel of a @p width row.
+ */
+[[nodiscard]] constexpr std::size_t bitWordsForWidth(int width) {
+    return (static_cast<std::size_t>(width) + 63) / 64;
+}
+
+/**
+ * @brief Set bit x of @p bits iff row[x] > threshold (NaN counts as below).
+ *
+ * @pre bits.size() >= bitWordsForWidth(width) (enforcement: none) [CRITICAL]
+ * @post Bits at and beyond @p width are zero.
+ */
+void thresholdRowBits(float const * row, int width, float threshold, std::span<uint64_t> bits);
+
+/**
+ * @brief Call `emit(x_begin, x_end)` for every maximal run of set bits.
+ *
+ * @pre Bits at and beyond @p width are zero (enforcement: none) [CRITICAL]
+ */
+template<typename Emit>
+void forEachSetRun(std::span<uint64_t const> bits, int width, Emit && emit) {
+    auto const words = bitWordsForWidth(width);
+    std::size_t x = 0;
+    auto const end = static_cast<std::size_t>(width);
+
+    while (x < end) {
+        // Next set bit at or after x
+        std::size_t w = x / 64;
+        uint64_t word = bits[w] & (~uint64_t{0} << (x % 64));
+        while (word == 0) {
+            if (++w == words) {
+                return;
+            }
+            word = bits[w];
+        }
+        std::size_t const begin = w * 64 + static_cast<std::size_t>(std::countr_zero(word));
+
+        // Next clear bit after begin
+        x = begin;
+        for (;;) {
+            uint64_t const rest = bits[w] >> (x % 64);
+            auto const ones = static_cast<std::size_t>(std::countr_one(rest));
+            x += ones;
+            if (x % 64 != 0 || ones == 0) {
+                break;
+            }
+            if (++w == words) {
+                break;
+            }
+        }
+        x = std::min(x, end);
+        emit(static_cast<int>(begin), static_cast<int>(x));
+    }
+}
+
+}// namespace dl
+
+#endif// NEURALYZER_SPATIAL_DECODING_HPP
@@ -5,6 +5,10 @@
 
 #include "TensorToLine2D.hpp"
 
+#include "SpatialDecoding.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+
 #include <ATen/core/Tensor.h>// at::Tensor
 #include <spdlog/spdlog.h>
 #include <torch/types.h>// kCPU, kFloat32
@@ -263,6 +267,45 @@ Point2D<float> scale_to_target(float const x, float const y,
     return {x * sx, y * sy};
 }
 
+/**
+ * @brief Threshold, thin and trace one [H, W] plane into a polyline.
+ */
+Line2D decodeLinePlane(ChannelPlane const & plane,
+                       LineDecoderParams const & params,
+                       ImageSize const target) {
+    auto const h = plane.height;
+    auto const w = plane.width;
+
+    std::vector<uint8_t> grid(static_cast<size_t>(h) * static_cast<size_t>(w), 0);
+    std::vector<uint64_t> bits(bitWordsForWidth(w));
+    for (int y = 0; y < h; ++y) {
+        thresholdRowBits(plane.row(y), w, params.threshold, bits);
+        auto * grid_row = grid.data() + static_cast<size_t>(y) * static_cast<size_t>(w);
+        forEachSetRun(bits, w, [grid_row](int b, int e) {
+            std::fill(grid_row + b, grid_row + e, uint8_t{1});
+        });
+    }
+
+    zhang_suen_thinning(grid, w, h);
+
+    auto const start = find_endpoint(grid, w, h);
+    auto const path = trace_skeleton(grid, w, h, start);
+
+    if (path.empty()) {
+        return Line2D{};
+    }
+
+    std::vector<Point2D<float>> points;
+    points.reserve(path.size());
+    for (auto const & p: path) {
+        points.push_back(scale_to_target(
+                static_cast<float>(p.first), static_cast<float>(p.second),
+                h, w, target));
+    }
+
+    return Line2D{std::move(points)};
+}
+
 }// namespace
 
 std::string TensorToLine2D::name() const {
@@ -282,37 +325,32 @@ Line2D TensorToLine2D::decode(at::Tensor const & tensor,
                            .to(torch::kCPU)
                            .to(torch::kFloat32)
                            .contiguous();
-    auto const h = ctx.height;
-    auto const w = ctx.width;
-    auto accessor = channel.accessor<float, 2>();
+    ChannelPlane const plane{channel.data_ptr<float>(), ctx.height, ctx.width};
+    return decodeLinePlane(plane, params, ctx.target_image_size);
+}
 
-    std::vector<uint8_t> grid(static_cast<size_t>(h * w), 0);
-    for (int y = 0; y < h; ++y) {
-        for (int x = 0; x < w; ++x) {
-            if (accessor[y][x] > params.threshold) {
-                grid[y * w + x] = 1;
-            }
-        }
+std::vector<Line2D> TensorToLine2D::decodeBatch(at::Tensor const & tensor,
+                                                DecoderContext const & ctx,
+                                                LineDecoderParams const & params) {
+    if (tensor.defined() && tensor.dim() == 4 && tensor.size(0) == 0) {
+        return {};
     }
 
-    zhang_suen_thinning(grid, w, h);
+    auto first = ctx;
+    first.batch_index = 0;
+    validateTensorToLine2DInput(tensor, first);
 
-    auto const start = find_endpoint(grid, w, h);
-    auto const path = trace_skeleton(grid, w, h, start);
+    auto const planes = extractChannelBatch(tensor, ctx.source_channel);
+    auto const batch = static_cast<std::size_t>(planes.size(0));
 
-    if (path.empty()) {
-        return Line2D{};
-    }
-
-    std::vector<Point2D<float>> points;
-    points.reserve(path.size());
-    for (auto const & p: path) {
-        points.push_back(scale_to_target(
-                static_cast<float>(p.first), static_cast<float>(p.second),
-                h, w, ctx.target_image_size));
-    }
-
-    return Line2D{std::move(points)};
+    std::vector<Line2D> lines(batch);
+    CoreUtilities::parallelForChunks(0, batch, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            lines[b] = decodeLinePlane(planeAt(planes, static_cast<std::int64_t>(b)),
+                                       params, ctx.target_image_size);
+        }
+    });
+    return lines;
 }
 
 }// namespace dl
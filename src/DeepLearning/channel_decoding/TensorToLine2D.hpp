@@ -10,6 +10,8 @@
 
 #include "CoreGeometry/lines.hpp"
 
+#include <vector>
+
 namespace at {
 class Tensor;
 }
@@ -53,6 +55,19 @@ public:
     [[nodiscard]] static Line2D decode(at::Tensor const & tensor,
                                        DecoderContext const & ctx,
                                        LineDecoderParams const & params);
+
+    /**
+     * @brief decode() for every batch element, decoded in parallel.
+     *
+     * The channel is copied to the CPU once for the whole batch.
+     * ctx.batch_index is ignored.
+     *
+     * @pre Same as decode(), except for ctx.batch_index
+     * @post result.size() == tensor.size(0)
+     */
+    [[nodiscard]] static std::vector<Line2D> decodeBatch(at::Tensor const & tensor,
+                                                         DecoderContext const & ctx,
+                                                         LineDecoderParams const & params);
 };
 
 }// namespace dl
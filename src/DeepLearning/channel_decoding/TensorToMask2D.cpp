@@ -5,6 +5,10 @@
 
 #include "TensorToMask2D.hpp"
 
+#include "SpatialDecoding.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+
 #include <ATen/core/Tensor.h>// at::Tensor
 #include <spdlog/spdlog.h>
 #include <torch/types.h>// kCPU, kFloat32
@@ -14,6 +18,8 @@
 #include <cmath>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace dl {
 
@@ -73,6 +79,177 @@ void validateTensorToMask2DInput(at::Tensor const & tensor, DecoderContext const
     }
 }
 
+/**
+ * @brief Resampling tables from tensor space to target image space.
+ *
+ * Built once per decode call and shared read-only by all batch elements.
+ */
+struct MaskResampler {
+    int src_h = 0;
+    int src_w = 0;
+    int dest_h = 0;
+    int dest_w = 0;
+    bool scaled = false;
+    MaskResampling mode = MaskResampling::Nearest;
+
+    // Nearest: source row of each destination row, and the first destination
+    // column whose source column is >= s (size src_w + 1). Because the column
+    // map is monotonic, a source run [a, b) covers destination [col_start[a], col_start[b]).
+    std::vector<int> nearest_row;
+    std::vector<uint32_t> col_start;
+
+    // Bilinear (half-pixel centres): two taps and a weight per row / column
+    std::vector<int> row0, row1, col0, col1;
+    std::vector<float> row_weight, col_weight;
+};
+
+int nearestSource(int dest, float scale, int src_size) {
+    return std::clamp(
+            static_cast<int>((static_cast<float>(dest) + 0.5f) * scale),
+            0, src_size - 1);
+}
+
+void bilinearTaps(int dest_size, int src_size,
+                  std::vector<int> & tap0, std::vector<int> & tap1, std::vector<float> & weight) {
+    float const scale = static_cast<float>(src_size) / static_cast<float>(dest_size);
+    tap0.resize(static_cast<std::size_t>(dest_size));
+    tap1.resize(static_cast<std::size_t>(dest_size));
+    weight.resize(static_cast<std::size_t>(dest_size));
+    for (int d = 0; d < dest_size; ++d) {
+        float const src = std::max((static_cast<float>(d) + 0.5f) * scale - 0.5f, 0.0f);
+        int const i0 = std::min(static_cast<int>(src), src_size - 1);
+        tap0[d] = i0;
+        tap1[d] = std::min(i0 + 1, src_size - 1);
+        weight[d] = std::clamp(src - static_cast<float>(i0), 0.0f, 1.0f);
+    }
+}
+
+MaskResampler makeResampler(DecoderContext const & ctx, MaskDecoderParams const & params) {
+    MaskResampler r;
+    r.src_h = ctx.height;
+    r.src_w = ctx.width;
+    r.mode = params.resampling.value_or(MaskResampling::Nearest);
+
+    bool const has_target = ctx.target_image_size.width > 0 && ctx.target_image_size.height > 0;
+    r.dest_h = has_target ? ctx.target_image_size.height : r.src_h;
+    r.dest_w = has_target ? ctx.target_image_size.width : r.src_w;
+    r.scaled = r.dest_h != r.src_h || r.dest_w != r.src_w;
+    if (!r.scaled) {
+        return r;
+    }
+
+    if (r.mode == MaskResampling::Bilinear) {
+        bilinearTaps(r.dest_h, r.src_h, r.row0, r.row1, r.row_weight);
+        bilinearTaps(r.dest_w, r.src_w, r.col0, r.col1, r.col_weight);
+        return r;
+    }
+
+    float const y_scale = static_cast<float>(r.src_h) / static_cast<float>(r.dest_h);
+    float const x_scale = static_cast<float>(r.src_w) / static_cast<float>(r.dest_w);
+
+    r.nearest_row.resize(static_cast<std::size_t>(r.dest_h));
+    for (int d = 0; d < r.dest_h; ++d) {
+        r.nearest_row[d] = nearestSource(d, y_scale, r.src_h);
+    }
+
+    r.col_start.assign(static_cast<std::size_t>(r.src_w) + 1, static_cast<uint32_t>(r.dest_w));
+    int s = 0;
+    for (int d = 0; d < r.dest_w; ++d) {
+        int const src = nearestSource(d, x_scale, r.src_w);
+        while (s <= src) {
+            r.col_start[s++] = static_cast<uint32_t>(d);
+        }
+    }
+    return r;
+}
+
+/**
+ * @brief Appends runs to @p out, merging a run that touches the previous one.
+ */
+void appendRun(std::vector<MaskPixelRun> & out, uint32_t y, uint32_t x_begin, uint32_t x_end) {
+    if (x_begin >= x_end) {
+        return;
+    }
+    if (!out.empty() && out.back().y == y && out.back().x_end == x_begin) {
+        out.back().x_end = x_end;
+        return;
+    }
+    out.push_back({y, x_begin, x_end});
+}
+
+/**
+ * @brief Threshold and resample one [H, W] plane into row-major runs.
+ */
+void decodePlaneRuns(ChannelPlane const & plane,
+                     MaskResampler const & r,
+                     float threshold,
+                     std::vector<MaskPixelRun> & out) {
+    std::vector<uint64_t> bits(bitWordsForWidth(std::max(r.src_w, r.dest_w)));
+
+    if (!r.scaled) {
+        for (int y = 0; y < r.src_h; ++y) {
+            thresholdRowBits(plane.row(y), r.src_w, threshold, bits);
+            forEachSetRun(bits, r.src_w, [&](int b, int e) {
+                out.push_back({static_cast<uint32_t>(y), static_cast<uint32_t>(b), static_cast<uint32_t>(e)});
+            });
+        }
+        return;
+    }
+
+    if (r.mode == MaskResampling::Nearest) {
+        // Destination rows sharing a source row reuse its runs
+        std::vector<std::pair<int, int>> source_runs;
+        int cached_row = -1;
+        for (int dy = 0; dy < r.dest_h; ++dy) {
+            int const sy = r.nearest_row[dy];
+            if (sy != cached_row) {
+                source_runs.clear();
+                thresholdRowBits(plane.row(sy), r.src_w, threshold, bits);
+                forEachSetRun(bits, r.src_w, [&](int b, int e) { source_runs.emplace_back(b, e); });
+                cached_row = sy;
+            }
+            for (auto const & [b, e]: source_runs) {
+                appendRun(out, static_cast<uint32_t>(dy), r.col_start[b], r.col_start[e]);
+            }
+        }
+        return;
+    }
+
+    // Bilinear: an interpolated value never exceeds its taps, so destination
+    // rows whose two source rows have no pixel above threshold are skipped.
+    std::vector<uint8_t> row_active(static_cast<std::size_t>(r.src_h), 0);
+    for (int y = 0; y < r.src_h; ++y) {
+        thresholdRowBits(plane.row(y), r.src_w, threshold, bits);
+        row_active[y] = std::ranges::any_of(bits, [](uint64_t w) { return w != 0; }) ? 1 : 0;
+    }
+
+    std::vector<float> vertical(static_cast<std::size_t>(r.src_w));
+    std::vector<float> dest_row(static_cast<std::size_t>(r.dest_w));
+    for (int dy = 0; dy < r.dest_h; ++dy) {
+        int const y0 = r.row0[dy];
+        int const y1 = r.row1[dy];
+        if (!row_active[y0] && !row_active[y1]) {
+            continue;
+        }
+
+        float const wy = r.row_weight[dy];
+        float const * top = plane.row(y0);
+        float const * bottom = plane.row(y1);
+        for (int x = 0; x < r.src_w; ++x) {
+            vertical[x] = top[x] + wy * (bottom[x] - top[x]);
+        }
+        for (int dx = 0; dx < r.dest_w; ++dx) {
+            float const left = vertical[r.col0[dx]];
+            dest_row[dx] = left + r.col_weight[dx] * (vertical[r.col1[dx]] - left);
+        }
+
+        thresholdRowBits(dest_row.data(), r.dest_w, threshold, bits);
+        forEachSetRun(bits, r.dest_w, [&](int b, int e) {
+            out.push_back({static_cast<uint32_t>(dy), static_cast<uint32_t>(b), static_cast<uint32_t>(e)});
+        });
+    }
+}
+
 }// namespace
 
 std::string TensorToMask2D::name() const {
@@ -83,6 +260,30 @@ std::string TensorToMask2D::outputTypeName() const {
     return "Mask2D";
 }
 
+std::span<MaskPixelRun const> MaskRunBatch::runsFor(std::size_t index) const {
+    return std::span<MaskPixelRun const>(runs).subspan(
+            offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+std::size_t MaskRunBatch::pixelCount(std::size_t index) const {
+    std::size_t count = 0;
+    for (auto const & run: runsFor(index)) {
+        count += run.x_end - run.x_begin;
+    }
+    return count;
+}
+
+Mask2D MaskRunBatch::toMask2D(std::size_t index) const {
+    Mask2D mask;
+    mask.reserve(pixelCount(index));
+    for (auto const & run: runsFor(index)) {
+        for (uint32_t x = run.x_begin; x < run.x_end; ++x) {
+            mask.push_back(Point2D<uint32_t>{x, run.y});
+        }
+    }
+    return mask;
+}
+
 Mask2D TensorToMask2D::decode(at::Tensor const & tensor,
                               DecoderContext const & ctx,
                               MaskDecoderParams const & params) {
@@ -92,53 +293,61 @@ Mask2D TensorToMask2D::decode(at::Tensor const & tensor,
                            .to(torch::kCPU)
                            .to(torch::kFloat32)
                            .contiguous();
-    auto const h = ctx.height;
-    auto const w = ctx.width;
-    auto accessor = channel.accessor<float, 2>();
-
-    bool const needs_scaling =
-            ctx.target_image_size.width > 0 && ctx.target_image_size.height > 0;
-
-    if (!needs_scaling) {
-        Mask2D mask;
-        for (int y = 0; y < h; ++y) {
-            for (int x = 0; x < w; ++x) {
-                if (accessor[y][x] > params.threshold) {
-                    mask.push_back(Point2D<uint32_t>{
-                            static_cast<uint32_t>(x),
-                            static_cast<uint32_t>(y)});
-                }
-            }
-        }
-        return mask;
+    ChannelPlane const plane{channel.data_ptr<float>(), ctx.height, ctx.width};
+
+    MaskRunBatch runs;
+    decodePlaneRuns(plane, makeResampler(ctx, params), params.threshold, runs.runs);
+    runs.offsets.push_back(runs.runs.size());
+    return runs.toMask2D(0);
+}
+
+MaskRunBatch TensorToMask2D::decodeBatchRuns(at::Tensor const & tensor,
+                                             DecoderContext const & ctx,
+                                             MaskDecoderParams const & params) {
+    MaskRunBatch result;
+    if (tensor.defined() && tensor.dim() == 4 && tensor.size(0) == 0) {
+        return result;
     }
 
-    int const dest_w = ctx.target_image_size.width;
-    int const dest_h = ctx.target_image_size.height;
+    auto first = ctx;
+    first.batch_index = 0;
+    validateTensorToMask2DInput(tensor, first);
 
-    float const x_scale = static_cast<float>(w) / static_cast<float>(dest_w);
-    float const y_scale = static_cast<float>(h) / static_cast<float>(dest_h);
+    auto const planes = extractChannelBatch(tensor, ctx.source_channel);
+    auto const resampler = makeResampler(ctx, params);
+    auto const batch = static_cast<std::size_t>(planes.size(0));
 
-    Mask2D mask;
-    for (int dest_y = 0; dest_y < dest_h; ++dest_y) {
-        int const src_y = std::clamp(
-                static_cast<int>((static_cast<float>(dest_y) + 0.5f) * y_scale),
-                0, h - 1);
-
-        for (int dest_x = 0; dest_x < dest_w; ++dest_x) {
-            int const src_x = std::clamp(
-                    static_cast<int>((static_cast<float>(dest_x) + 0.5f) * x_scale),
-                    0, w - 1);
-
-            if (accessor[src_y][src_x] > params.threshold) {
-                mask.push_back(Point2D<uint32_t>{
-                        static_cast<uint32_t>(dest_x),
-                        static_cast<uint32_t>(dest_y)});
-            }
+    std::vector<std::vector<MaskPixelRun>> per_element(batch);
+    CoreUtilities::parallelForChunks(0, batch, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            decodePlaneRuns(planeAt(planes, static_cast<std::int64_t>(b)),
+                            resampler, params.threshold, per_element[b]);
         }
+    });
+
+    std::size_t total = 0;
+    for (auto const & runs: per_element) {
+        total += runs.size();
     }
+    result.runs.reserve(total);
+    result.offsets.reserve(batch + 1);
+    for (auto const & runs: per_element) {
+        result.runs.insert(result.runs.end(), runs.begin(), runs.end());
+        result.offsets.push_back(result.runs.size());
+    }
+    return result;
+}
 
-    return mask;
+std::vector<Mask2D> TensorToMask2D::decodeBatch(at::Tensor const & tensor,
+                                                DecoderContext const & ctx,
+                                                MaskDecoderParams const & params) {
+    auto const runs = decodeBatchRuns(tensor, ctx, params);
+    std::vector<Mask2D> masks;
+    masks.reserve(runs.batchSize());
+    for (std::size_t b = 0; b < runs.batchSize(); ++b) {
+        masks.push_back(runs.toMask2D(b));
+    }
+    return masks;
 }
 
 }// namespace dl
@@ -10,17 +10,53 @@
 
 #include "CoreGeometry/masks.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
 namespace at {
 class Tensor;
 }
 
 namespace dl {
 
+/**
+ * @brief Horizontal run of mask pixels: row @c y, columns [x_begin, x_end).
+ */
+struct MaskPixelRun {
+    uint32_t y = 0;
+    uint32_t x_begin = 0;
+    uint32_t x_end = 0;
+
+    bool operator==(MaskPixelRun const &) const = default;
+};
+
+/**
+ * @brief Run-length masks for every element of a batch in one buffer.
+ *
+ * Runs of element b are `runs[offsets[b] .. offsets[b + 1])`, sorted by
+ * (y, x_begin); runs on one row never overlap or touch.
+ */
+struct MaskRunBatch {
+    std::vector<MaskPixelRun> runs;
+    std::vector<std::size_t> offsets{0};
+
+    [[nodiscard]] std::size_t batchSize() const { return offsets.size() - 1; }
+    [[nodiscard]] std::span<MaskPixelRun const> runsFor(std::size_t index) const;
+    [[nodiscard]] std::size_t pixelCount(std::size_t index) const;
+
+    /// Expand element @p index to pixels in row-major order.
+    [[nodiscard]] Mask2D toMask2D(std::size_t index) const;
+};
+
 /**
  * @brief Decodes a tensor channel into a Mask2D by thresholding.
  *
  * All pixels with activation above @p params.threshold are collected as mask pixels.
- * Output pixel coordinates are scaled from tensor (H, W) back to target_image_size.
+ * Output pixel coordinates are scaled from tensor (H, W) back to target_image_size
+ * by nearest-neighbour or bilinear resampling (params.resampling), fused with the
+ * threshold so the resized channel is never materialized.
  * If target_image_size is {0, 0}, coordinates are returned in tensor space.
  *
  * Expects a 4D input tensor laid out as [B, C, H, W].
@@ -49,6 +85,26 @@ public:
     [[nodiscard]] static Mask2D decode(at::Tensor const & tensor,
                                        DecoderContext const & ctx,
                                        MaskDecoderParams const & params);
+
+    /**
+     * @brief Decode the channel of every batch element into run-length masks.
+     *
+     * The channel is copied to the CPU once for the whole batch and the
+     * elements are decoded in parallel. ctx.batch_index is ignored.
+     *
+     * @pre Same as decode(), except for ctx.batch_index
+     * @post result.batchSize() == tensor.size(0)
+     */
+    [[nodiscard]] static MaskRunBatch decodeBatchRuns(at::Tensor const & tensor,
+                                                      DecoderContext const & ctx,
+                                                      MaskDecoderParams const & params);
+
+    /**
+     * @brief decodeBatchRuns() expanded to one Mask2D per batch element.
+     */
+    [[nodiscard]] static std::vector<Mask2D> decodeBatch(at::Tensor const & tensor,
+                                                         DecoderContext const & ctx,
+                                                         MaskDecoderParams const & params);
 };
 
 }// namespace dl
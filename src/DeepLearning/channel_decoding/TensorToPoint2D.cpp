@@ -5,8 +5,11 @@
 
 #include "TensorToPoint2D.hpp"
 
-#include <ATen/core/Tensor.h>        // at::Tensor
-#include <ATen/core/TensorAccessor.h>// at::TensorAccessor
+#include "SpatialDecoding.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+
+#include <ATen/core/Tensor.h>// at::Tensor
 #include <spdlog/spdlog.h>
 #include <torch/types.h>// kCPU, kFloat32
 
@@ -96,16 +99,17 @@ Point2D<float> scale_to_target(Point2D<float> const point,
  *
  * Fits a 1D parabola along each axis through the peak and its two neighbors.
  */
-Point2D<float> refine_subpixel(at::TensorAccessor<float, 2> const & accessor,
-                               int const px, int const py,
-                               int const h, int const w) {
+Point2D<float> refine_subpixel(ChannelPlane const & plane,
+                               int const px, int const py) {
+    int const h = plane.height;
+    int const w = plane.width;
     auto refined_x = static_cast<float>(px);
     auto refined_y = static_cast<float>(py);
 
     if (px > 0 && px < w - 1) {
-        float const left = accessor[py][px - 1];
-        float const center = accessor[py][px];
-        float const right = accessor[py][px + 1];
+        float const left = plane.at(py, px - 1);
+        float const center = plane.at(py, px);
+        float const right = plane.at(py, px + 1);
         float const denom = 2.0f * (2.0f * center - left - right);
         if (std::abs(denom) > 1e-7f) {
             refined_x += (left - right) / denom;
@@ -113,9 +117,9 @@ Point2D<float> refine_subpixel(at::TensorAccessor<float, 2> const & accessor,
     }
 
     if (py > 0 && py < h - 1) {
-        float const top = accessor[py - 1][px];
-        float const center = accessor[py][px];
-        float const bottom = accessor[py + 1][px];
+        float const top = plane.at(py - 1, px);
+        float const center = plane.at(py, px);
+        float const bottom = plane.at(py + 1, px);
         float const denom = 2.0f * (2.0f * center - top - bottom);
         if (std::abs(denom) > 1e-7f) {
             refined_y += (top - bottom) / denom;
@@ -128,10 +132,11 @@ Point2D<float> refine_subpixel(at::TensorAccessor<float, 2> const & accessor,
 /**
  * @brief Check if pixel (px, py) is a local maximum (greater than all 8 neighbors).
  */
-bool is_local_maximum(at::TensorAccessor<float, 2> const & accessor,
-                      int const px, int const py,
-                      int const h, int const w) {
-    float const val = accessor[py][px];
+bool is_local_maximum(ChannelPlane const & plane,
+                      int const px, int const py) {
+    int const h = plane.height;
+    int const w = plane.width;
+    float const val = plane.at(py, px);
 
     for (int dy = -1; dy <= 1; ++dy) {
         for (int dx = -1; dx <= 1; ++dx) {
@@ -139,7 +144,7 @@ bool is_local_maximum(at::TensorAccessor<float, 2> const & accessor,
             int const nx = px + dx;
             int const ny = py + dy;
             if (nx >= 0 && nx < w && ny >= 0 && ny < h) {
-                if (accessor[ny][nx] >= val) {
+                if (plane.at(ny, nx) >= val) {
                     return false;
                 }
             }
@@ -155,6 +160,33 @@ at::Tensor extractChannel(at::Tensor const & tensor, DecoderContext const & ctx)
             .contiguous();
 }
 
+/**
+ * @brief Peak of one plane: argmax (first on ties), optionally refined.
+ *
+ * Returns {0, 0} if the plane is entirely non-positive.
+ */
+Point2D<float> decodePeak(ChannelPlane const & plane,
+                          PointDecoderParams const & params,
+                          ImageSize const target) {
+    auto const count = static_cast<std::size_t>(plane.height) * static_cast<std::size_t>(plane.width);
+    auto const * peak = std::max_element(plane.data, plane.data + count);
+    auto const flat_idx = static_cast<int>(peak - plane.data);
+    int const py = flat_idx / plane.width;
+    int const px = flat_idx % plane.width;
+
+    if (*peak <= 0.0f) {
+        return scale_to_target({0.0f, 0.0f}, plane.height, plane.width, target);
+    }
+
+    Point2D<float> result;
+    if (params.subpixel) {
+        result = refine_subpixel(plane, px, py);
+    } else {
+        result = {static_cast<float>(px), static_cast<float>(py)};
+    }
+    return scale_to_target(result, plane.height, plane.width, target);
+}
+
 }// namespace
 
 std::string TensorToPoint2D::name() const {
@@ -171,26 +203,32 @@ Point2D<float> TensorToPoint2D::decode(at::Tensor const & tensor,
     validateTensorToPoint2DInput(tensor, ctx);
 
     auto channel = extractChannel(tensor, ctx);
-    auto const h = ctx.height;
-    auto const w = ctx.width;
-
-    auto const flat_idx = channel.argmax().item<int64_t>();
-    int const py = static_cast<int>(flat_idx / w);
-    int const px = static_cast<int>(flat_idx % w);
+    ChannelPlane const plane{channel.data_ptr<float>(), ctx.height, ctx.width};
+    return decodePeak(plane, params, ctx.target_image_size);
+}
 
-    auto accessor = channel.accessor<float, 2>();
-    if (accessor[py][px] <= 0.0f) {
-        return scale_to_target({0.0f, 0.0f}, h, w, ctx.target_image_size);
+std::vector<Point2D<float>> TensorToPoint2D::decodeBatch(at::Tensor const & tensor,
+                                                         DecoderContext const & ctx,
+                                                         PointDecoderParams const & params) {
+    if (tensor.defined() && tensor.dim() == 4 && tensor.size(0) == 0) {
+        return {};
     }
 
-    Point2D<float> result;
-    if (params.subpixel) {
-        result = refine_subpixel(accessor, px, py, h, w);
-    } else {
-        result = {static_cast<float>(px), static_cast<float>(py)};
-    }
+    auto first = ctx;
+    first.batch_index = 0;
+    validateTensorToPoint2DInput(tensor, first);
 
-    return scale_to_target(result, h, w, ctx.target_image_size);
+    auto const planes = extractChannelBatch(tensor, ctx.source_channel);
+    auto const batch = static_cast<std::size_t>(planes.size(0));
+
+    std::vector<Point2D<float>> points(batch);
+    CoreUtilities::parallelForChunks(0, batch, 1, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t b = lo; b < hi; ++b) {
+            points[b] = decodePeak(planeAt(planes, static_cast<std::int64_t>(b)),
+                                   params, ctx.target_image_size);
+        }
+    });
+    return points;
 }
 
 std::vector<Point2D<float>> TensorToPoint2D::decodeMultiple(
@@ -202,16 +240,16 @@ std::vector<Point2D<float>> TensorToPoint2D::decodeMultiple(
     auto channel = extractChannel(tensor, ctx);
     auto const h = ctx.height;
     auto const w = ctx.width;
-    auto accessor = channel.accessor<float, 2>();
+    ChannelPlane const plane{channel.data_ptr<float>(), h, w};
 
     std::vector<Point2D<float>> points;
 
     for (int y = 0; y < h; ++y) {
         for (int x = 0; x < w; ++x) {
-            if (accessor[y][x] > params.threshold && is_local_maximum(accessor, x, y, h, w)) {
+            if (plane.at(y, x) > params.threshold && is_local_maximum(plane, x, y)) {
                 Point2D<float> pt;
                 if (params.subpixel) {
-                    pt = refine_subpixel(accessor, x, y, h, w);
+                    pt = refine_subpixel(plane, x, y);
                 } else {
                     pt = {static_cast<float>(x), static_cast<float>(y)};
                 }
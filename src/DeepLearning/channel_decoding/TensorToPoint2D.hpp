@@ -54,6 +54,19 @@ public:
                                                DecoderContext const & ctx,
                                                PointDecoderParams const & params);
 
+    /**
+     * @brief decode() for every batch element, decoded in parallel.
+     *
+     * The channel is copied to the CPU once for the whole batch.
+     * ctx.batch_index is ignored.
+     *
+     * @pre Same as decode(), except for ctx.batch_index
+     * @post result.size() == tensor.size(0)
+     */
+    [[nodiscard]] static std::vector<Point2D<float>> decodeBatch(at::Tensor const & tensor,
+                                                                 DecoderContext const & ctx,
+                                                                 PointDecoderParams const & params);
+
     /**
      * @brief Decode all local maxima above threshold into multiple points.
      *
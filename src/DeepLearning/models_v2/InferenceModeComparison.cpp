@@ -0,0 +1,173 @@
+/**
+ * @file InferenceModeComparison.cpp
+ * @brief Implementation of the inference mode comparison harness.
+ */
+
+#include "InferenceModeComparison.hpp"
+
+#include "ModelBase.hpp"
+
+#include <ATen/ATen.h>
+#include <c10/core/GradMode.h>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace dl {
+
+namespace {
+
+using Batch = std::unordered_map<std::string, at::Tensor>;
+
+/// Sum and maximum of absolute output differences over a set of elements.
+struct DeltaAccumulator {
+    double max = 0.0;
+    double sum = 0.0;
+    std::size_t count = 0;
+    bool mismatch = false;
+
+    void add(Batch const & reference, Batch const & outputs) {
+        for (auto const & [name, ref]: reference) {
+            auto const it = outputs.find(name);
+            if (it == outputs.end() || !it->second.defined() ||
+                it->second.sizes() != ref.sizes()) {
+                mismatch = true;
+                continue;
+            }
+            if (ref.numel() == 0) {
+                continue;
+            }
+            auto const diff = (it->second.to(at::kCPU, at::kDouble) -
+                               ref.to(at::kCPU, at::kDouble))
+                                      .abs();
+            max = std::max(max, diff.max().item<double>());
+            sum += diff.sum().item<double>();
+            count += static_cast<std::size_t>(diff.numel());
+        }
+    }
+};
+
+std::size_t framesIn(Batch const & batch) {
+    for (auto const & [name, tensor]: batch) {
+        if (tensor.defined() && tensor.dim() > 0) {
+            return static_cast<std::size_t>(tensor.size(0));
+        }
+    }
+    return 0;
+}
+
+}// anonymous namespace
+
+std::vector<InferenceModeResult> compareInferenceModes(
+        ModelBase & model,
+        std::vector<Batch> const & batches,
+        std::vector<InferenceOptions> const & modes,
+        int warmup_batches) {
+    if (!model.isReady()) {
+        throw std::invalid_argument(
+                "compareInferenceModes: model '" + model.modelId() + "' is not ready");
+    }
+
+    c10::NoGradGuard const no_grad;
+    auto const original_options = model.inferenceOptions();
+
+    std::vector<InferenceModeResult> results;
+    results.reserve(modes.size());
+    std::vector<Batch> reference_outputs;
+    bool have_reference = false;
+
+    try {
+        for (auto const & mode: modes) {
+            InferenceModeResult result;
+            result.requested = mode;
+            result.supported = model.setInferenceOptions(mode);
+            result.applied = model.inferenceOptions();
+            if (!result.supported) {
+                results.push_back(result);
+                continue;
+            }
+
+            auto const warmup = std::min<std::size_t>(
+                    static_cast<std::size_t>(std::max(warmup_batches, 0)),
+                    batches.size());
+            for (std::size_t i = 0; i < warmup; ++i) {
+                (void) model.forward(batches[i]);
+            }
+
+            std::vector<Batch> outputs;
+            outputs.reserve(batches.size());
+            auto const start = std::chrono::steady_clock::now();
+            for (auto const & batch: batches) {
+                outputs.push_back(model.forward(batch));
+            }
+            auto const elapsed = std::chrono::duration<double>(
+                                         std::chrono::steady_clock::now() - start)
+                                         .count();
+
+            for (auto const & batch: batches) {
+                result.frames += framesIn(batch);
+            }
+            result.batches = batches.size();
+            if (!batches.empty()) {
+                result.milliseconds_per_batch =
+                        elapsed * 1000.0 / static_cast<double>(batches.size());
+            }
+            if (elapsed > 0.0) {
+                result.frames_per_second = static_cast<double>(result.frames) / elapsed;
+            }
+
+            if (!have_reference) {
+                reference_outputs = std::move(outputs);
+                have_reference = true;
+                result.reference = true;
+            } else {
+                DeltaAccumulator delta;
+                for (std::size_t i = 0; i < outputs.size(); ++i) {
+                    delta.add(reference_outputs[i], outputs[i]);
+                }
+                if (delta.mismatch) {
+                    result.max_abs_delta = std::numeric_limits<double>::quiet_NaN();
+                    result.mean_abs_delta = std::numeric_limits<double>::quiet_NaN();
+                } else {
+                    result.max_abs_delta = delta.max;
+                    result.mean_abs_delta =
+                            delta.count > 0 ? delta.sum / static_cast<double>(delta.count) : 0.0;
+                }
+            }
+            results.push_back(result);
+        }
+    } catch (...) {
+        model.setInferenceOptions(original_options);
+        throw;
+    }
+
+    model.setInferenceOptions(original_options);
+    return results;
+}
+
+std::string formatInferenceModeReport(std::vector<InferenceModeResult> const & results) {
+    auto report = std::format("{:<28} {:>12} {:>12} {:>14} {:>14}\n",
+                              "mode", "ms/batch", "frames/s", "max |delta|", "mean |delta|");
+
+    for (auto const & r: results) {
+        auto const label = describe(r.requested);
+        if (!r.supported) {
+            report += std::format("{:<28} {:>12}\n", label, "unsupported");
+        } else if (r.reference) {
+            report += std::format("{:<28} {:>12.2f} {:>12.1f} {:>14} {:>14}\n",
+                                  label, r.milliseconds_per_batch, r.frames_per_second,
+                                  "reference", "reference");
+        } else {
+            report += std::format("{:<28} {:>12.2f} {:>12.1f} {:>14.3e} {:>14.3e}\n",
+                                  label, r.milliseconds_per_batch, r.frames_per_second,
+                                  r.max_abs_delta, r.mean_abs_delta);
+        }
+    }
+    return report;
+}
+
+}// namespace dl
@@ -0,0 +1,81 @@
+/**
+ * @file InferenceModeComparison.hpp
+ * @brief Accuracy-vs-throughput comparison of a model across inference modes.
+ */
+
+#ifndef NEURALYZER_INFERENCE_MODE_COMPARISON_HPP
+#define NEURALYZER_INFERENCE_MODE_COMPARISON_HPP
+
+#include "backends/InferenceOptions.hpp"
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace at {
+class Tensor;
+}
+
+namespace dl {
+
+class ModelBase;
+
+/**
+ * @brief Timing and output deviation of one inference mode.
+ *
+ * Deltas are element-wise absolute differences of every output slot
+ * against the reference mode (the first supported mode), pooled over all
+ * batches. They are NaN if an output slot is missing or changes shape.
+ */
+struct InferenceModeResult {
+    /// Options that were requested for this run
+    InferenceOptions requested;
+    /// Options the model actually applied (precision may fall back to native)
+    InferenceOptions applied;
+    /// False if the model rejected the requested precision; no run was made
+    bool supported = false;
+    /// True for the mode the others are compared against
+    bool reference = false;
+
+    std::size_t frames = 0;
+    std::size_t batches = 0;
+    double milliseconds_per_batch = 0.0;
+    double frames_per_second = 0.0;
+
+    double max_abs_delta = 0.0;
+    double mean_abs_delta = 0.0;
+};
+
+/**
+ * @brief Run @p model over the same input batches in each of @p modes.
+ *
+ * Each mode is applied with ModelBase::setInferenceOptions(), warmed up on
+ * the first @p warmup_batches batches (not timed), then timed over all
+ * batches. The model's original options are restored afterwards.
+ *
+ * @param model Loaded model (isReady())
+ * @param batches Input maps as passed to ModelBase::forward(); the leading
+ *        dimension of the first tensor in each map counts as its frame count
+ * @param modes Modes to compare; the first supported one is the reference
+ * @param warmup_batches Untimed passes per mode before timing
+ *
+ * @pre model.isReady() (enforcement: exception) [CRITICAL]
+ * @throws std::invalid_argument if the model is not ready
+ * @return One result per entry of @p modes, in order.
+ */
+[[nodiscard]] std::vector<InferenceModeResult> compareInferenceModes(
+        ModelBase & model,
+        std::vector<std::unordered_map<std::string, at::Tensor>> const & batches,
+        std::vector<InferenceOptions> const & modes,
+        int warmup_batches = 1);
+
+/**
+ * @brief Plain-text table of @p results (one row per mode).
+ */
+[[nodiscard]] std::string formatInferenceModeReport(
+        std::vector<InferenceModeResult> const & results);
+
+}// namespace dl
+
+#endif// NEURALYZER_INFERENCE_MODE_COMPARISON_HPP
@@ -7,6 +7,7 @@
 #define NEURALYZER_MODEL_BASE_HPP
 
 #include "TensorSlotDescriptor.hpp"
+#include "backends/InferenceOptions.hpp"
 
 #include <ATen/core/Tensor.h>// at::Tensor
 
@@ -114,6 +115,27 @@ public:
         return {};
     }
 
+    /**
+     * @brief Select numeric precision and CPU thread counts for forward().
+     *
+     * The default implementation only accepts native precision and ignores
+     * the thread counts. Models backed by ModelExecution forward the options
+     * to it.
+     *
+     * @return false if the requested precision is unsupported; the model
+     *         then keeps running natively.
+     */
+    virtual bool setInferenceOptions(InferenceOptions const & options) {
+        return options.precision == InferencePrecision::Native;
+    }
+
+    /**
+     * @brief Options currently applied to forward().
+     */
+    [[nodiscard]] virtual InferenceOptions inferenceOptions() const {
+        return {};
+    }
+
     /**
      * @brief Run inference.
      *
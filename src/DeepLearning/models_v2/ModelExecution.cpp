@@ -77,10 +77,16 @@ bool ModelExecution::load(std::filesystem::path const & path) {
 
     try {
         auto backend = createBackend(effective);
+        // Precision-specific rewrites happen inside the backend's load()
+        if (_requested_precision != InferencePrecision::Native) {
+            backend->setPrecision(_requested_precision);
+        }
         if (!backend->load(path)) {
             return false;
         }
         _backend = std::move(backend);
+        _applyPrecision();
+        applyIntraOpThreads(_options.intra_op_threads);
         return true;
 
     } catch (std::exception const & e) {
@@ -109,6 +115,67 @@ std::string ModelExecution::activeBackendName() const {
     return _backend ? _backend->name() : backendTypeToString(_requested_backend);
 }
 
+// ---------------------------------------------------------------------------
+// Inference options
+// ---------------------------------------------------------------------------
+namespace {
+
+/**
+ * @brief Convert reduced-precision floating outputs back to float32.
+ */
+std::vector<at::Tensor> toFloat32Outputs(std::vector<at::Tensor> outputs) {
+    for (auto & t: outputs) {
+        if (t.defined() &&
+            (t.scalar_type() == at::kBFloat16 || t.scalar_type() == at::kHalf)) {
+            t = t.to(at::kFloat);
+        }
+    }
+    return outputs;
+}
+
+}// anonymous namespace
+
+bool ModelExecution::setOptions(InferenceOptions const & options) {
+    _requested_precision = options.precision;
+    _options = options;
+    if (options.inter_op_threads > 0) {
+        applyInterOpThreads(options.inter_op_threads);
+    }
+
+    if (_backend) {
+        applyIntraOpThreads(options.intra_op_threads);
+        return _applyPrecision();
+    }
+
+    // Nothing loaded yet: report whether the requested backend supports it
+    if (_requested_backend == BackendType::Auto ||
+        options.precision == InferencePrecision::Native) {
+        return true;
+    }
+    try {
+        return createBackend(_requested_backend)->supportsPrecision(options.precision);
+    } catch (std::exception const &) {
+        return false;
+    }
+}
+
+InferenceOptions const & ModelExecution::options() const {
+    return _options;
+}
+
+bool ModelExecution::_applyPrecision() {
+    if (_backend->setPrecision(_requested_precision)) {
+        _options.precision = _requested_precision;
+        return true;
+    }
+    std::cerr << "[ModelExecution] " << _backend->name() << " does not support "
+              << precisionToString(_requested_precision)
+              << " inference; running natively\n";
+    _backend->setPrecision(InferencePrecision::Native);
+    _options.precision = InferencePrecision::Native;
+    return false;
+}
+
 // ---------------------------------------------------------------------------
 // execute (forward method, ordered inputs)
 // ---------------------------------------------------------------------------
@@ -117,7 +184,8 @@ ModelExecution::execute(std::vector<at::Tensor> const & inputs) {
     if (!isLoaded()) {
         throw std::runtime_error("[ModelExecution] No model loaded");
     }
-    return _backend->execute(inputs);
+    ScopedInferenceOptions const scope(_options);
+    return toFloat32Outputs(_backend->execute(inputs));
 }
 
 // ---------------------------------------------------------------------------
@@ -129,7 +197,8 @@ ModelExecution::execute(std::string const & method_name,
     if (!isLoaded()) {
         throw std::runtime_error("[ModelExecution] No model loaded");
     }
-    return _backend->execute(method_name, inputs);
+    ScopedInferenceOptions const scope(_options);
+    return toFloat32Outputs(_backend->execute(method_name, inputs));
 }
 
 // ---------------------------------------------------------------------------
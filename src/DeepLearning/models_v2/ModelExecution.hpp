@@ -7,6 +7,7 @@
 #define NEURALYZER_MODEL_EXECUTION_HPP
 
 #include "backends/BackendType.hpp"// BackendType
+#include "backends/InferenceOptions.hpp"// InferenceOptions
 
 #include <ATen/core/Tensor.h>// at::Tensor
 
@@ -136,6 +137,23 @@ public:
     executeNamed(std::unordered_map<std::string, at::Tensor> const & named_inputs,
                  std::vector<std::string> const & input_order);
 
+    /**
+     * @brief Set the precision and thread counts used by every execute() call.
+     *
+     * Options survive later load() calls. A precision the backend cannot run
+     * falls back to InferencePrecision::Native; thread counts always apply.
+     * Outputs of reduced-precision runs are converted back to float32.
+     *
+     * @return false if the requested precision is not supported by the
+     *         active backend (or, before load(), by the requested backend).
+     */
+    bool setOptions(InferenceOptions const & options);
+
+    /**
+     * @brief Options in effect, with the precision actually applied.
+     */
+    [[nodiscard]] InferenceOptions const & options() const;
+
 private:
     /**
      * @brief Create the appropriate backend for the given type.
@@ -145,8 +163,16 @@ private:
      */
     static std::unique_ptr<InferenceBackend> createBackend(BackendType type);
 
+    /**
+     * @brief Apply _options.precision to _backend, downgrading to Native
+     *        if the backend does not support it.
+     */
+    bool _applyPrecision();
+
     std::unique_ptr<InferenceBackend> _backend;
     BackendType _requested_backend;
+    InferenceOptions _options;
+    InferencePrecision _requested_precision = InferencePrecision::Native;
 };
 
 }// namespace dl
@@ -7,6 +7,7 @@
 #define NEURALYZER_INFERENCE_BACKEND_HPP
 
 #include "BackendType.hpp"// BackendType
+#include "InferenceOptions.hpp"// InferencePrecision
 
 #include <ATen/core/Tensor.h>// at::Tensor
 
@@ -113,6 +114,30 @@ public:
     execute(std::string const & method_name,
             std::vector<at::Tensor> const & inputs) = 0;
 
+    /**
+     * @brief Whether this backend can run the loaded model in @p precision.
+     *
+     * The default supports only InferencePrecision::Native; compiled
+     * backends (AOT Inductor, ExecuTorch) fix their numerics at export time.
+     */
+    [[nodiscard]] virtual bool supportsPrecision(InferencePrecision precision) const {
+        return precision == InferencePrecision::Native;
+    }
+
+    /**
+     * @brief Select the precision for subsequent loads and executions.
+     *
+     * Backends that rewrite the model for a precision (e.g. int8 weight
+     * quantization) do so here if a model is already loaded, and again on
+     * every load().
+     *
+     * @return false if the precision is not supported; the backend then
+     *         keeps running natively.
+     */
+    virtual bool setPrecision(InferencePrecision precision) {
+        return supportsPrecision(precision);
+    }
+
     // Non-copyable (subclasses own heavyweight resources)
     InferenceBackend(InferenceBackend const &) = delete;
     InferenceBackend & operator=(InferenceBackend const &) = delete;
@@ -0,0 +1,99 @@
+/**
+ * @file InferenceOptions.cpp
+ * @brief Implementation of inference option helpers and the scoped guard.
+ */
+
+#include "InferenceOptions.hpp"
+
+#include <ATen/Config.h>
+#include <ATen/Parallel.h>
+#include <ATen/autocast_mode.h>
+#include <c10/util/Exception.h>
+
+#include <iostream>
+
+namespace dl {
+
+std::string describe(InferenceOptions const & options) {
+    auto label = precisionToString(options.precision);
+    if (options.intra_op_threads > 0) {
+        label += ", " + std::to_string(options.intra_op_threads) + " threads";
+    }
+    if (options.inter_op_threads > 0) {
+        label += ", " + std::to_string(options.inter_op_threads) + " inter-op";
+    }
+    return label;
+}
+
+bool applyInterOpThreads(int num_threads) {
+    if (num_threads <= 0) {
+        return false;
+    }
+    if (at::get_num_interop_threads() == num_threads) {
+        return true;
+    }
+    try {
+        at::set_num_interop_threads(num_threads);
+        return true;
+    } catch (c10::Error const & e) {
+        std::cerr << "[InferenceOptions] Cannot resize inter-op pool to "
+                  << num_threads << " threads (already started): "
+                  << e.what_without_backtrace() << "\n";
+        return false;
+    }
+}
+
+bool applyIntraOpThreads(int num_threads) {
+    if (num_threads <= 0) {
+        return false;
+    }
+    if (at::get_num_threads() == num_threads) {
+        return true;
+    }
+    try {
+        at::set_num_threads(num_threads);
+    } catch (c10::Error const & e) {
+        std::cerr << "[InferenceOptions] Cannot set intra-op threads to "
+                  << num_threads << ": " << e.what_without_backtrace() << "\n";
+    }
+    return at::get_num_threads() == num_threads;
+}
+
+ScopedInferenceOptions::ScopedInferenceOptions(InferenceOptions const & options) {
+#if AT_PARALLEL_OPENMP
+    // OpenMP thread counts are per thread: a worker running the model has
+    // not seen the count applied at load
+    if (options.intra_op_threads > 0) {
+        _previous_threads = at::get_num_threads();
+        if (_previous_threads != options.intra_op_threads) {
+            at::set_num_threads(options.intra_op_threads);
+            _threads_changed = true;
+        }
+    }
+#endif
+
+    if (options.precision == InferencePrecision::BFloat16) {
+        _previous_autocast = at::autocast::is_autocast_enabled(at::kCPU);
+        _previous_autocast_dtype =
+                static_cast<int>(at::autocast::get_autocast_dtype(at::kCPU));
+        at::autocast::set_autocast_dtype(at::kCPU, at::kBFloat16);
+        at::autocast::set_autocast_enabled(at::kCPU, true);
+        _autocast_changed = true;
+    }
+}
+
+ScopedInferenceOptions::~ScopedInferenceOptions() {
+    if (_autocast_changed) {
+        at::autocast::set_autocast_enabled(at::kCPU, _previous_autocast);
+        at::autocast::set_autocast_dtype(
+                at::kCPU, static_cast<at::ScalarType>(_previous_autocast_dtype));
+        if (!_previous_autocast) {
+            at::autocast::clear_cache();
+        }
+    }
+    if (_threads_changed) {
+        at::set_num_threads(_previous_threads);
+    }
+}
+
+}// namespace dl
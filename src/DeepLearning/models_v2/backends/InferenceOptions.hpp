@@ -0,0 +1,138 @@
+/**
+ * @file InferenceOptions.hpp
+ * @brief Per-model numeric precision and CPU threading options for inference.
+ */
+
+#ifndef NEURALYZER_INFERENCE_OPTIONS_HPP
+#define NEURALYZER_INFERENCE_OPTIONS_HPP
+
+#include <cctype>
+#include <optional>
+#include <string>
+
+namespace dl {
+
+/**
+ * @brief Numeric precision a backend runs a model in.
+ *
+ * Reduced-precision modes trade accuracy for CPU throughput. Outputs are
+ * always returned as float32 regardless of the mode.
+ */
+enum class InferencePrecision {
+    /** Run the model exactly as exported */
+    Native,
+    /** CPU autocast: matmul/conv run in bfloat16, reductions stay float32 */
+    BFloat16,
+    /** Dynamic int8: linear weights quantized per channel, activations at run time */
+    DynamicInt8
+};
+
+/**
+ * @brief Convert an InferencePrecision to its serialized name.
+ */
+[[nodiscard]] inline std::string precisionToString(InferencePrecision precision) {
+    switch (precision) {
+        case InferencePrecision::Native:
+            return "native";
+        case InferencePrecision::BFloat16:
+            return "bf16";
+        case InferencePrecision::DynamicInt8:
+            return "int8_dynamic";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Parse an InferencePrecision (case-insensitive).
+ *
+ * @return std::nullopt if the string is not recognized.
+ */
+[[nodiscard]] inline std::optional<InferencePrecision>
+precisionFromString(std::string const & str) {
+    auto lower = str;
+    for (auto & c: lower) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+
+    if (lower == "native" || lower == "fp32" || lower == "float32") {
+        return InferencePrecision::Native;
+    }
+    if (lower == "bf16" || lower == "bfloat16") {
+        return InferencePrecision::BFloat16;
+    }
+    if (lower == "int8_dynamic" || lower == "int8" || lower == "dynamic_int8") {
+        return InferencePrecision::DynamicInt8;
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Runtime options applied to one model's forward passes.
+ *
+ * Thread counts of 0 leave the libtorch defaults in place. The intra-op
+ * count is applied once, when the model is loaded or its options change;
+ * the inter-op pool is process-wide and can only be sized before libtorch
+ * first uses it.
+ */
+struct InferenceOptions {
+    InferencePrecision precision = InferencePrecision::Native;
+    int intra_op_threads = 0;
+    int inter_op_threads = 0;
+
+    bool operator==(InferenceOptions const &) const = default;
+};
+
+/**
+ * @brief Human-readable label such as "bf16, 4 threads".
+ */
+[[nodiscard]] std::string describe(InferenceOptions const & options);
+
+/**
+ * @brief Size libtorch's process-wide inter-op thread pool.
+ *
+ * @return false if the pool has already been started (the request is
+ *         ignored) or @p num_threads is not positive.
+ */
+bool applyInterOpThreads(int num_threads);
+
+/**
+ * @brief Set libtorch's intra-op thread count.
+ *
+ * Meant for model load, not for every forward pass: with the native
+ * parallel backend the intra-op pool is process-wide and libtorch warns
+ * and ignores resizes once parallel work has started.
+ *
+ * @return true if the intra-op thread count now equals @p num_threads.
+ */
+bool applyIntraOpThreads(int num_threads);
+
+/**
+ * @brief RAII scope that applies InferenceOptions to the calling thread.
+ *
+ * For InferencePrecision::BFloat16, enables CPU autocast to bfloat16 and
+ * restores the previous autocast state on destruction, so scopes may nest
+ * and other models on the same thread are unaffected.
+ *
+ * The intra-op thread count is set by applyIntraOpThreads() at load. Only
+ * when libtorch uses OpenMP, where the count belongs to each calling
+ * thread, does the scope apply it to a differing thread and restore it.
+ */
+class ScopedInferenceOptions {
+public:
+    explicit ScopedInferenceOptions(InferenceOptions const & options);
+    ~ScopedInferenceOptions();
+
+    ScopedInferenceOptions(ScopedInferenceOptions const &) = delete;
+    ScopedInferenceOptions & operator=(ScopedInferenceOptions const &) = delete;
+
+private:
+    int _previous_threads = 0;
+    bool _threads_changed = false;
+    bool _previous_autocast = false;
+    int _previous_autocast_dtype = 0;
+    bool _autocast_changed = false;
+};
+
+}// namespace dl
+
+#endif// NEURALYZER_INFERENCE_OPTIONS_HPP
@@ -7,9 +7,14 @@
 
 #include "device/DeviceManager.hpp"
 
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/script.h>
 
 #include <iostream>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
@@ -48,6 +53,114 @@ std::vector<at::Tensor> iValueToTensors(torch::jit::IValue const & value) {
     return result;
 }
 
+/**
+ * @brief Collect `aten::linear` nodes in @p block and its nested blocks.
+ */
+void collectLinearNodes(torch::jit::Block * block,
+                        std::vector<torch::jit::Node *> & nodes) {
+    for (auto * node: block->nodes()) {
+        if (node->kind() == c10::aten::linear) {
+            nodes.push_back(node);
+        }
+        for (auto * sub_block: node->blocks()) {
+            collectLinearNodes(sub_block, nodes);
+        }
+    }
+}
+
+/**
+ * @brief Quantize a [out, in] float weight to symmetric per-channel int8
+ *        and prepack it (with its float bias) for `quantized::linear_dynamic`.
+ */
+c10::IValue prepackInt8Linear(at::Tensor const & weight,
+                              std::optional<at::Tensor> const & bias) {
+    auto const w = weight.to(at::kFloat).contiguous();
+    auto const scales = (w.abs().amax({1}) / 127.0).clamp_min(1e-8).to(at::kDouble);
+    auto const zero_points = at::zeros({w.size(0)}, at::kLong);
+    auto const qweight = at::quantize_per_channel(w, scales, zero_points, 0, at::kQInt8);
+
+    static auto const prepack = c10::Dispatcher::singleton().findSchemaOrThrow(
+            "quantized::linear_prepack", "");
+    torch::jit::Stack stack{
+            qweight,
+            bias ? c10::IValue(bias->to(at::kFloat).contiguous()) : c10::IValue()};
+    prepack.callBoxed(&stack);
+    return stack.at(0);
+}
+
+/**
+ * @brief Replace every `aten::linear` with constant weights in @p graph by
+ *        a dynamically quantized int8 kernel.
+ *
+ * @pre The graph belongs to a frozen module, so parameters are constants
+ *      (enforcement: none) [IMPORTANT]
+ * @return Number of layers replaced.
+ */
+int quantizeLinearNodes(std::shared_ptr<torch::jit::Graph> const & graph) {
+    std::vector<torch::jit::Node *> linear_nodes;
+    collectLinearNodes(graph->block(), linear_nodes);
+
+    auto const linear_dynamic = c10::Symbol::fromQualString("quantized::linear_dynamic");
+    int replaced = 0;
+    for (auto * node: linear_nodes) {
+        auto const weight = torch::jit::toIValue(node->input(1));
+        if (!weight || !weight->isTensor()) {
+            continue;
+        }
+        auto const & weight_tensor = weight->toTensor();
+        if (weight_tensor.dim() != 2 || !weight_tensor.is_floating_point()) {
+            continue;
+        }
+        std::optional<at::Tensor> bias;
+        if (node->inputs().size() > 2) {
+            auto const bias_value = torch::jit::toIValue(node->input(2));
+            if (!bias_value) {
+                continue;// Bias computed at run time
+            }
+            if (bias_value->isTensor()) {
+                bias = bias_value->toTensor();
+            }
+        }
+
+        auto packed = prepackInt8Linear(weight_tensor, bias);
+
+        torch::jit::WithInsertPoint const guard(node);
+        auto * packed_value = graph->insertConstant(packed);
+        auto * reduce_range = graph->insertConstant(true);
+        auto * qnode = graph->insertNode(graph->create(
+                linear_dynamic, {node->input(0), packed_value, reduce_range}));
+        qnode->output()->setType(node->output()->type());
+        node->output()->replaceAllUsesWith(qnode->output());
+        node->destroy();
+        ++replaced;
+    }
+
+    if (replaced > 0) {
+        torch::jit::EliminateDeadCode(graph);
+    }
+    return replaced;
+}
+
+/**
+ * @brief Freeze @p module and quantize the linear layers of every method.
+ *
+ * Convolutions stay in float32: dynamic quantization in PyTorch covers
+ * linear (and recurrent) layers only.
+ */
+std::pair<torch::jit::Module, int> quantizeDynamicInt8(torch::jit::Module const & module) {
+    std::vector<std::string> preserved;
+    for (auto const & method: module.get_methods()) {
+        preserved.push_back(method.name());
+    }
+
+    auto frozen = torch::jit::freeze(module, preserved);
+    int replaced = 0;
+    for (auto const & method: frozen.get_methods()) {
+        replaced += quantizeLinearNodes(method.graph());
+    }
+    return {std::move(frozen), replaced};
+}
+
 }// anonymous namespace
 
 // ---------------------------------------------------------------------------
@@ -57,6 +170,8 @@ struct TorchScriptBackend::Impl {
     torch::jit::Module module;
     std::filesystem::path loaded_path;
     bool is_loaded = false;
+    InferencePrecision precision = InferencePrecision::Native;
+    int quantized_layers = 0;
 };
 
 // ---------------------------------------------------------------------------
@@ -87,6 +202,25 @@ bool TorchScriptBackend::load(std::filesystem::path const & path) {
         module.to(dm.device());
         module.eval();
 
+        _impl->quantized_layers = 0;
+        if (_impl->precision == InferencePrecision::DynamicInt8) {
+            try {
+                auto [quantized, replaced] = quantizeDynamicInt8(module);
+                if (replaced > 0) {
+                    module = std::move(quantized);
+                    _impl->quantized_layers = replaced;
+                } else {
+                    std::cerr << "[TorchScriptBackend] " << path
+                              << " has no linear layers to quantize; running natively\n";
+                    _impl->precision = InferencePrecision::Native;
+                }
+            } catch (std::exception const & e) {
+                std::cerr << "[TorchScriptBackend] int8 quantization of " << path
+                          << " failed, running natively: " << e.what() << "\n";
+                _impl->precision = InferencePrecision::Native;
+            }
+        }
+
         _impl->module = std::move(module);
         _impl->loaded_path = path;
         _impl->is_loaded = true;
@@ -116,6 +250,41 @@ std::filesystem::path TorchScriptBackend::loadedPath() const {
     return _impl->loaded_path;
 }
 
+// ---------------------------------------------------------------------------
+// precision
+// ---------------------------------------------------------------------------
+bool TorchScriptBackend::supportsPrecision(InferencePrecision precision) const {
+    if (precision == InferencePrecision::Native) {
+        return true;
+    }
+    // Autocast to bfloat16 and the int8 kernels are CPU paths
+    return DeviceManager::instance().device().is_cpu();
+}
+
+bool TorchScriptBackend::setPrecision(InferencePrecision precision) {
+    if (!supportsPrecision(precision)) {
+        return false;
+    }
+    if (precision == _impl->precision) {
+        return true;
+    }
+
+    bool const rewrite = precision == InferencePrecision::DynamicInt8 ||
+                         _impl->precision == InferencePrecision::DynamicInt8;
+    _impl->precision = precision;
+    if (rewrite && _impl->is_loaded) {
+        // Quantization rewrites the module; start from the file again.
+        // load() falls back to Native when nothing could be quantized.
+        auto const path = _impl->loaded_path;
+        return load(path) && _impl->precision == precision;
+    }
+    return true;
+}
+
+int TorchScriptBackend::quantizedLayerCount() const {
+    return _impl->quantized_layers;
+}
+
 // ---------------------------------------------------------------------------
 // execute (default "forward" method)
 // ---------------------------------------------------------------------------
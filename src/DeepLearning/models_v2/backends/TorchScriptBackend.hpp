@@ -34,6 +34,9 @@ namespace dl {
  * - Supports multiple named methods (e.g. "forward", "encode", "decode")
  * - Supports arbitrary dynamic shapes natively
  * - Model runs on the device selected by DeviceManager (CPU or CUDA)
+ * - On CPU, supports bfloat16 autocast and dynamic int8 quantization of
+ *   `aten::linear` layers (the model is frozen and its linear weights are
+ *   replaced by prepacked per-channel int8 weights)
  */
 class TorchScriptBackend : public InferenceBackend {
 public:
@@ -59,6 +62,25 @@ public:
     execute(std::string const & method_name,
             std::vector<at::Tensor> const & inputs) override;
 
+    [[nodiscard]] bool supportsPrecision(InferencePrecision precision) const override;
+
+    /**
+     * @brief Select the precision, re-loading the model if int8 is toggled.
+     *
+     * If the loaded model has no quantizable linear layers or the int8
+     * rewrite throws, the precision falls back to Native and false is
+     * returned, so callers never label a native run as int8.
+     */
+    bool setPrecision(InferencePrecision precision) override;
+
+    /**
+     * @brief Number of linear layers replaced by int8 kernels in the loaded model.
+     *
+     * Zero unless the precision is InferencePrecision::DynamicInt8 and the
+     * rewrite succeeded.
+     */
+    [[nodiscard]] int quantizedLayerCount() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
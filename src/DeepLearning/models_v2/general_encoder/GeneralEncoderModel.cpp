@@ -112,6 +112,14 @@ bool GeneralEncoderModel::isReady() const {
     return _execution.isLoaded();
 }
 
+bool GeneralEncoderModel::setInferenceOptions(InferenceOptions const & options) {
+    return _execution.setOptions(options);
+}
+
+InferenceOptions GeneralEncoderModel::inferenceOptions() const {
+    return _execution.options();
+}
+
 // ---------------------------------------------------------------------------
 // Batch size
 // ---------------------------------------------------------------------------
@@ -105,6 +105,14 @@ bool NeuroSAMModel::isReady() const {
     return _execution.isLoaded();
 }
 
+bool NeuroSAMModel::setInferenceOptions(InferenceOptions const & options) {
+    return _execution.setOptions(options);
+}
+
+InferenceOptions NeuroSAMModel::inferenceOptions() const {
+    return _execution.options();
+}
+
 // ---------------------------------------------------------------------------
 // Batch size
 // ---------------------------------------------------------------------------
@@ -61,6 +61,9 @@ public:
     [[nodiscard]] int maxBatchSize() const override;
     [[nodiscard]] dl::BatchMode batchMode() const override;
 
+    bool setInferenceOptions(InferenceOptions const & options) override;
+    [[nodiscard]] InferenceOptions inferenceOptions() const override;
+
     std::unordered_map<std::string, at::Tensor>
     forward(std::unordered_map<std::string, at::Tensor> const & inputs) override;
 
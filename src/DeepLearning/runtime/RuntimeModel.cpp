@@ -25,6 +25,10 @@ RuntimeModel::RuntimeModel(RuntimeModelSpec spec)
         _output_order.push_back(slot.name);
     }
 
+    if (_spec.inference.has_value()) {
+        _execution->setOptions(_spec.inference->toOptions());
+    }
+
     // Auto-load weights if specified in the spec
     if (_spec.weights_path.has_value() && !_spec.weights_path->empty()) {
         _execution->load(_spec.weights_path.value());
@@ -65,6 +69,14 @@ bool RuntimeModel::isReady() const {
     return _execution->isLoaded();
 }
 
+bool RuntimeModel::setInferenceOptions(InferenceOptions const & options) {
+    return _execution->setOptions(options);
+}
+
+InferenceOptions RuntimeModel::inferenceOptions() const {
+    return _execution->options();
+}
+
 int RuntimeModel::preferredBatchSize() const {
     return _spec.preferred_batch_size.value_or(0);
 }
@@ -91,7 +103,9 @@ bool RuntimeModel::loadWeightsForBatchSize(int batch_size) {
             auto backend_type = variant.backend.has_value()
                                         ? backendTypeFromString(variant.backend.value())
                                         : BackendType::Auto;
+            auto const options = _execution->options();
             _execution = std::make_unique<ModelExecution>(backend_type);
+            _execution->setOptions(options);
             _execution->load(variant.path);
             return _execution->isLoaded();
         }
@@ -63,6 +63,9 @@ public:
     [[nodiscard]] int maxBatchSize() const override;
     [[nodiscard]] dl::BatchMode batchMode() const override;
 
+    bool setInferenceOptions(InferenceOptions const & options) override;
+    [[nodiscard]] InferenceOptions inferenceOptions() const override;
+
     /**
      * @brief Select and load the best weights variant for the given batch size.
      *
@@ -29,6 +29,17 @@ BatchMode BatchModeSpec::toBatchMode() const {
     return DynamicBatch{1, 0};
 }
 
+InferenceOptions InferenceSpec::toOptions() const {
+    InferenceOptions options;
+    if (precision.has_value()) {
+        options.precision = precisionFromString(precision.value())
+                                    .value_or(InferencePrecision::Native);
+    }
+    options.intra_op_threads = intra_op_threads.value_or(0);
+    options.inter_op_threads = inter_op_threads.value_or(0);
+    return options;
+}
+
 TensorSlotDescriptor SlotSpec::toDescriptor() const {
     TensorSlotDescriptor desc;
     desc.name = name;
@@ -209,6 +220,22 @@ std::vector<std::string> RuntimeModelSpec::validate() const {
         }
     }
 
+    // Validate inference options
+    if (inference.has_value()) {
+        if (inference->precision.has_value() &&
+            !precisionFromString(inference->precision.value()).has_value()) {
+            errors.push_back("inference.precision: unknown precision '" +
+                             inference->precision.value() +
+                             "' (expected native, bf16 or int8_dynamic)");
+        }
+        if (inference->intra_op_threads.value_or(0) < 0) {
+            errors.emplace_back("inference.intra_op_threads must be >= 0");
+        }
+        if (inference->inter_op_threads.value_or(0) < 0) {
+            errors.emplace_back("inference.inter_op_threads must be >= 0");
+        }
+    }
+
     return errors;
 }
 
@@ -7,6 +7,7 @@
 #define NEURALYZER_RUNTIME_MODEL_SPEC_HPP
 
 #include "models_v2/TensorSlotDescriptor.hpp"
+#include "models_v2/backends/InferenceOptions.hpp"
 
 #include <rfl.hpp>
 #include <rfl/json.hpp>
@@ -98,6 +99,28 @@ struct WeightsVariant {
     std::optional<std::string> backend;
 };
 
+/**
+ * @brief JSON-serializable inference precision and threading options.
+ *
+ * JSON example:
+ * @code{.json}
+ *   "inference": { "precision": "int8_dynamic", "intra_op_threads": 4 }
+ * @endcode
+ */
+struct InferenceSpec {
+    /** "native" | "bf16" | "int8_dynamic" */
+    std::optional<std::string> precision;
+    /** 0 = libtorch default */
+    std::optional<int> intra_op_threads;
+    /** 0 = libtorch default (process-wide) */
+    std::optional<int> inter_op_threads;
+
+    /**
+     * @brief Convert to InferenceOptions; unknown precisions map to native.
+     */
+    [[nodiscard]] InferenceOptions toOptions() const;
+};
+
 /**
  * @brief JSON-serializable specification for a single post-encoder module step.
  *
@@ -150,7 +173,8 @@ struct PostEncoderStepSpec {
  *   ],
  *   "post_encoder": [
  *     { "module": "global_avg_pool" }
- *   ]
+ *   ],
+ *   "inference": { "precision": "bf16", "intra_op_threads": 4 }
  * }
  * @endcode
  */
@@ -173,6 +197,8 @@ struct RuntimeModelSpec {
     std::optional<std::string> recommended_post_encoder;
     /** Optional post-encoder pipeline */
     std::optional<std::vector<PostEncoderStepSpec>> post_encoder;
+    /** Optional precision / thread count options */
+    std::optional<InferenceSpec> inference;
 
     /**
      * @brief Parse a RuntimeModelSpec from a JSON string.
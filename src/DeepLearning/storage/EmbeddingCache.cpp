@@ -0,0 +1,434 @@
+/**
+ * @file EmbeddingCache.cpp
+ * @brief Memory-mapped per-frame embedding store.
+ */
+
+#include "storage/EmbeddingCache.hpp"
+
+#include "Tensors/TensorData.hpp"
+#include "Tensors/storage/MappedTensorStorage.hpp"
+#include "TimeFrame/TimeIndexStorage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::endian::native == std::endian::little,
+              "Embedding cache files are little-endian and read in place");
+
+namespace dl {
+
+namespace {
+
+// FNV-1a 64-bit hash
+constexpr std::uint64_t fnv_offset_basis = 14695981039346656037ULL;
+constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+
+std::uint64_t fnvFeed(std::uint64_t hash, void const * data, std::size_t len) {
+    auto const * ptr = static_cast<std::uint8_t const *>(data);
+    for (std::size_t i = 0; i < len; ++i) {
+        hash ^= ptr[i];
+        hash *= fnv_prime;
+    }
+    return hash;
+}
+
+std::string toHex(std::uint64_t value) {
+    std::ostringstream ss;
+    ss << std::hex << std::setfill('0') << std::setw(16) << value;
+    return ss.str();
+}
+
+constexpr std::array<char, 8> file_magic = {'W', 'T', 'E', 'M', 'B', 'C', '0', '1'};
+constexpr std::uint32_t file_version = 1;
+constexpr std::size_t data_alignment = 4096;
+
+struct FileHeader {
+    std::array<char, 8> magic = file_magic;
+    std::uint32_t version = file_version;
+    std::uint32_t reserved = 0;
+    std::uint64_t key_digest = 0;
+    std::uint64_t num_frames = 0;
+    std::uint64_t feature_dim = 0;
+    std::uint64_t key_length = 0;
+    std::uint64_t presence_offset = 0;
+    std::uint64_t data_offset = 0;
+};
+static_assert(sizeof(FileHeader) == 64);
+
+std::size_t alignUp(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+FileHeader makeHeader(EmbeddingCacheKey const & key, std::string const & canonical,
+                      std::size_t num_frames, std::size_t feature_dim) {
+    FileHeader header;
+    header.key_digest = key.digest();
+    header.num_frames = num_frames;
+    header.feature_dim = feature_dim;
+    header.key_length = canonical.size();
+    header.presence_offset = alignUp(sizeof(FileHeader) + canonical.size(), 64);
+    header.data_offset = alignUp(header.presence_offset + num_frames, data_alignment);
+    return header;
+}
+
+std::size_t fileSizeFor(FileHeader const & header) {
+    return header.data_offset + header.num_frames * header.feature_dim * sizeof(float);
+}
+
+/// True if the file at @p path was written for exactly this key and shape.
+bool headerMatches(std::filesystem::path const & path, FileHeader const & expected,
+                   std::string const & canonical) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+    FileHeader header;
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!in || header.magic != file_magic || header.version != file_version ||
+        header.key_digest != expected.key_digest || header.num_frames != expected.num_frames ||
+        header.feature_dim != expected.feature_dim || header.key_length != expected.key_length ||
+        header.presence_offset != expected.presence_offset || header.data_offset != expected.data_offset) {
+        return false;
+    }
+    std::string stored(header.key_length, '\0');
+    in.read(stored.data(), static_cast<std::streamsize>(stored.size()));
+    if (!in || stored != canonical) {
+        return false;
+    }
+    std::error_code ec;
+    auto const size = std::filesystem::file_size(path, ec);
+    return !ec && size >= fileSizeFor(header);
+}
+
+/// Write an empty cache to a temporary file and move it over @p path.
+void createEmpty(std::filesystem::path const & path, FileHeader const & header,
+                 std::string const & canonical) {
+    std::random_device rd;
+    auto tmp = path;
+    tmp += ".tmp" + toHex((static_cast<std::uint64_t>(rd()) << 32) | rd());
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("EmbeddingCache: failed to create file: " + tmp.string());
+        }
+        out.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        out.write(canonical.data(), static_cast<std::streamsize>(canonical.size()));
+        if (!out) {
+            throw std::runtime_error("EmbeddingCache: failed to write header: " + tmp.string());
+        }
+    }
+    std::error_code ec;
+    // Presence bytes and rows start out as zeros; on most filesystems the
+    // extension is sparse, so large unfilled caches cost no disk space.
+    std::filesystem::resize_file(tmp, fileSizeFor(header), ec);
+    if (!ec) {
+        std::filesystem::rename(tmp, path, ec);
+    }
+    if (ec) {
+        std::filesystem::remove(tmp);
+        throw std::runtime_error("EmbeddingCache: failed to create " + path.string() + ": " + ec.message());
+    }
+}
+
+}// namespace
+
+// ============================================================================
+// Key
+// ============================================================================
+
+std::string EmbeddingCacheKey::canonical() const {
+    std::string out;
+    for (auto const * field: {&media_identity, &model_id, &weights_digest, &parameters, &output_slot}) {
+        out += std::to_string(field->size());
+        out += ':';
+        out += *field;
+        out += ';';
+    }
+    return out;
+}
+
+std::uint64_t EmbeddingCacheKey::digest() const {
+    auto const text = canonical();
+    return fnvFeed(fnv_offset_basis, text.data(), text.size());
+}
+
+std::string fileContentDigest(std::filesystem::path const & path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("fileContentDigest: failed to open " + path.string());
+    }
+    std::vector<char> buffer(1 << 20);
+    std::uint64_t hash = fnv_offset_basis;
+    while (in) {
+        in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        hash = fnvFeed(hash, buffer.data(), static_cast<std::size_t>(in.gcount()));
+    }
+    if (in.bad()) {
+        throw std::runtime_error("fileContentDigest: failed to read " + path.string());
+    }
+    return toHex(hash);
+}
+
+std::string mediaFileIdentity(std::filesystem::path const & path, std::size_t frame_count) {
+    std::error_code ec;
+    auto const canonical = std::filesystem::weakly_canonical(path, ec);
+    if (ec || !std::filesystem::is_regular_file(canonical, ec)) {
+        return {};
+    }
+    auto const size = std::filesystem::file_size(canonical, ec);
+    if (ec) {
+        return {};
+    }
+    auto const mtime = std::filesystem::last_write_time(canonical, ec);
+    if (ec) {
+        return {};
+    }
+    return canonical.generic_string() + '|' + std::to_string(size) + '|' +
+           std::to_string(mtime.time_since_epoch().count()) + '|' + std::to_string(frame_count);
+}
+
+// ============================================================================
+// Memory mapping (platform-specific)
+// ============================================================================
+
+#ifdef _WIN32
+struct EmbeddingCache::Mapping {
+    HANDLE file_handle = INVALID_HANDLE_VALUE;
+    HANDLE map_handle = NULL;
+    void * mapped_data = nullptr;
+    std::size_t mapped_size = 0;
+
+    explicit Mapping(std::filesystem::path const & path) {
+        file_handle = CreateFileW(path.wstring().c_str(), GENERIC_READ | GENERIC_WRITE,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file_handle == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("EmbeddingCache: failed to open file: " + path.string());
+        }
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file_handle, &size) || size.QuadPart <= 0) {
+            CloseHandle(file_handle);
+            throw std::runtime_error("EmbeddingCache: failed to stat file: " + path.string());
+        }
+        mapped_size = static_cast<std::size_t>(size.QuadPart);
+        map_handle = CreateFileMappingW(file_handle, NULL, PAGE_READWRITE, 0, 0, NULL);
+        if (map_handle == NULL) {
+            CloseHandle(file_handle);
+            throw std::runtime_error("EmbeddingCache: failed to create file mapping: " + path.string());
+        }
+        mapped_data = MapViewOfFile(map_handle, FILE_MAP_READ | FILE_MAP_WRITE, 0, 0, 0);
+        if (mapped_data == nullptr) {
+            CloseHandle(map_handle);
+            CloseHandle(file_handle);
+            throw std::runtime_error("EmbeddingCache: failed to map view: " + path.string());
+        }
+    }
+
+    void flush() const {
+        FlushViewOfFile(mapped_data, 0);
+        FlushFileBuffers(file_handle);
+    }
+
+    ~Mapping() {
+        UnmapViewOfFile(mapped_data);
+        CloseHandle(map_handle);
+        CloseHandle(file_handle);
+    }
+
+    Mapping(Mapping const &) = delete;
+    Mapping & operator=(Mapping const &) = delete;
+};
+#else
+struct EmbeddingCache::Mapping {
+    int file_descriptor = -1;
+    void * mapped_data = nullptr;
+    std::size_t mapped_size = 0;
+
+    explicit Mapping(std::filesystem::path const & path) {
+        file_descriptor = ::open(path.c_str(), O_RDWR);
+        if (file_descriptor == -1) {
+            throw std::runtime_error("EmbeddingCache: failed to open file: " + path.string());
+        }
+        struct stat sb {};
+        if (fstat(file_descriptor, &sb) == -1 || sb.st_size <= 0) {
+            close(file_descriptor);
+            throw std::runtime_error("EmbeddingCache: failed to stat file: " + path.string());
+        }
+        mapped_size = static_cast<std::size_t>(sb.st_size);
+        mapped_data = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+        if (mapped_data == MAP_FAILED) {
+            close(file_descriptor);
+            throw std::runtime_error("EmbeddingCache: failed to mmap file: " + path.string());
+        }
+    }
+
+    void flush() const {
+        msync(mapped_data, mapped_size, MS_SYNC);
+    }
+
+    ~Mapping() {
+        munmap(mapped_data, mapped_size);
+        close(file_descriptor);
+    }
+
+    Mapping(Mapping const &) = delete;
+    Mapping & operator=(Mapping const &) = delete;
+};
+#endif
+
+// ============================================================================
+// EmbeddingCache
+// ============================================================================
+
+std::filesystem::path EmbeddingCache::pathFor(std::filesystem::path const & directory,
+                                              EmbeddingCacheKey const & key) {
+    return directory / (toHex(key.digest()) + kFileExtension);
+}
+
+std::shared_ptr<EmbeddingCache> EmbeddingCache::open(std::filesystem::path const & directory,
+                                                     EmbeddingCacheKey const & key,
+                                                     std::size_t num_frames,
+                                                     std::size_t feature_dim) {
+    if (num_frames == 0 || feature_dim == 0) {
+        throw std::invalid_argument("EmbeddingCache::open: num_frames and feature_dim must be > 0");
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        throw std::runtime_error("EmbeddingCache::open: failed to create directory " +
+                                 directory.string() + ": " + ec.message());
+    }
+
+    auto const canonical = key.canonical();
+    auto const header = makeHeader(key, canonical, num_frames, feature_dim);
+    auto path = pathFor(directory, key);
+
+    if (!headerMatches(path, header, canonical)) {
+        createEmpty(path, header, canonical);
+    }
+
+    auto mapping = std::make_unique<Mapping>(path);
+    if (mapping->mapped_size < fileSizeFor(header)) {
+        throw std::runtime_error("EmbeddingCache::open: truncated cache file " + path.string());
+    }
+    return std::shared_ptr<EmbeddingCache>(new EmbeddingCache(
+            std::move(path), std::move(mapping), num_frames, feature_dim,
+            header.presence_offset, header.data_offset));
+}
+
+EmbeddingCache::EmbeddingCache(std::filesystem::path path,
+                               std::unique_ptr<Mapping> mapping,
+                               std::size_t num_frames,
+                               std::size_t feature_dim,
+                               std::size_t presence_offset,
+                               std::size_t data_offset)
+    : _path(std::move(path)),
+      _mapping(std::move(mapping)),
+      _num_frames(num_frames),
+      _feature_dim(feature_dim),
+      _presence_offset(presence_offset),
+      _data_offset(data_offset) {}
+
+EmbeddingCache::~EmbeddingCache() = default;
+
+std::uint8_t * EmbeddingCache::_presence() const noexcept {
+    return static_cast<std::uint8_t *>(_mapping->mapped_data) + _presence_offset;
+}
+
+float * EmbeddingCache::_rows() const noexcept {
+    return reinterpret_cast<float *>(static_cast<std::uint8_t *>(_mapping->mapped_data) + _data_offset);
+}
+
+bool EmbeddingCache::contains(std::size_t frame) const noexcept {
+    if (frame >= _num_frames) {
+        return false;
+    }
+    return std::atomic_ref<std::uint8_t>(_presence()[frame]).load(std::memory_order_acquire) != 0;
+}
+
+std::size_t EmbeddingCache::cachedCount() const noexcept {
+    std::size_t count = 0;
+    for (std::size_t f = 0; f < _num_frames; ++f) {
+        count += contains(f) ? 1 : 0;
+    }
+    return count;
+}
+
+std::vector<std::size_t> EmbeddingCache::missingFrames(std::size_t first, std::size_t last) const {
+    std::vector<std::size_t> missing;
+    last = std::min(last, _num_frames - 1);
+    for (std::size_t f = first; f <= last; ++f) {
+        if (!contains(f)) {
+            missing.push_back(f);
+        }
+    }
+    return missing;
+}
+
+std::span<float const> EmbeddingCache::row(std::size_t frame) const {
+    if (!contains(frame)) {
+        throw std::out_of_range("EmbeddingCache::row: frame " + std::to_string(frame) + " is not cached");
+    }
+    return {_rows() + frame * _feature_dim, _feature_dim};
+}
+
+void EmbeddingCache::store(std::size_t frame, std::span<float const> values) {
+    if (frame >= _num_frames) {
+        throw std::out_of_range("EmbeddingCache::store: frame " + std::to_string(frame) + " out of range");
+    }
+    if (values.size() != _feature_dim) {
+        throw std::invalid_argument("EmbeddingCache::store: expected " + std::to_string(_feature_dim) +
+                                    " values, got " + std::to_string(values.size()));
+    }
+    std::memcpy(_rows() + frame * _feature_dim, values.data(), values.size_bytes());
+    std::atomic_ref<std::uint8_t>(_presence()[frame]).store(1, std::memory_order_release);
+}
+
+void EmbeddingCache::flush() {
+    _mapping->flush();
+}
+
+std::shared_ptr<TensorData> EmbeddingCache::toTensorData(std::size_t first, std::size_t last) const {
+    if (first > last || last >= _num_frames) {
+        return nullptr;
+    }
+    for (std::size_t f = first; f <= last; ++f) {
+        if (!contains(f)) {
+            return nullptr;
+        }
+    }
+    auto const num_rows = last - first + 1;
+    std::span<float const> const values(_rows() + first * _feature_dim, num_rows * _feature_dim);
+    TensorStorageWrapper storage(MappedTensorStorage(shared_from_this(), values, num_rows, _feature_dim));
+    auto time_storage = TimeIndexStorageFactory::createDense(
+            TimeFrameIndex(static_cast<int64_t>(first)), num_rows);
+    return std::make_shared<TensorData>(TensorData::createTimeSeries2DFromStorage(
+            std::move(storage), std::move(time_storage), nullptr));
+}
+
+}// namespace dl
@@ -0,0 +1,186 @@
+#ifndef NEURALYZER_EMBEDDING_CACHE_HPP
+#define NEURALYZER_EMBEDDING_CACHE_HPP
+
+/**
+ * @file EmbeddingCache.hpp
+ * @brief Persistent, memory-mapped store of per-frame encoder outputs.
+ *
+ * Encoding a video with a large backbone is by far the most expensive step
+ * of feature extraction, and its result depends only on the media, the model
+ * weights and the encoder/post-encoder parameters. EmbeddingCache stores one
+ * fixed-size float row per frame in a file named after a digest of that
+ * identity, so a later run with the same inputs reads features back instead
+ * of re-encoding them.
+ *
+ * The cache fills incrementally: rows are written as inference produces them
+ * and a per-frame presence byte is set once the row is complete, so an
+ * interrupted run keeps everything it finished.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+class TensorData;
+
+namespace dl {
+
+/**
+ * @brief Everything that determines the content of a cached embedding row.
+ *
+ * Two runs that agree on every field produce identical features, so they may
+ * share a cache file. The fields are free-form strings; callers build them
+ * with mediaFileIdentity() / fileContentDigest() and a serialization of the
+ * encoder and post-encoder parameters.
+ */
+struct EmbeddingCacheKey {
+    std::string media_identity;///< Source media (path, size, mtime, frame count)
+    std::string model_id;      ///< Registry ID of the encoder model
+    std::string weights_digest;///< Digest of the weights file contents
+    std::string parameters;    ///< Input binding, model and post-encoder parameters
+    std::string output_slot;   ///< Model output slot the rows were taken from
+
+    /// Canonical single-string form stored in the cache file header.
+    [[nodiscard]] std::string canonical() const;
+
+    /// 64-bit FNV-1a digest of canonical(); names the cache file.
+    [[nodiscard]] std::uint64_t digest() const;
+};
+
+/**
+ * @brief Hex FNV-1a digest of a file's contents.
+ *
+ * @throws std::runtime_error if the file cannot be read.
+ */
+[[nodiscard]] std::string fileContentDigest(std::filesystem::path const & path);
+
+/**
+ * @brief Identity string for a media file.
+ *
+ * Combines the canonical path, size and modification time with the decoded
+ * frame count, so re-encoding or replacing the file invalidates the cache.
+ *
+ * @return Empty string if the file does not exist.
+ */
+[[nodiscard]] std::string mediaFileIdentity(std::filesystem::path const & path,
+                                            std::size_t frame_count);
+
+/**
+ * @brief Memory-mapped [num_frames x feature_dim] float store with a presence map.
+ *
+ * File layout (little-endian): a fixed header, the canonical key string, one
+ * presence byte per frame, and the row-major float rows starting at a
+ * page-aligned offset. Rows of frames that were never stored are zero.
+ *
+ * ## Thread Safety
+ *
+ * store() and the read accessors may be called concurrently from different
+ * threads as long as no two threads store the same frame at once. Presence is
+ * published with release/acquire ordering, so a row is only reported as
+ * cached after its values are visible.
+ */
+class EmbeddingCache : public std::enable_shared_from_this<EmbeddingCache> {
+public:
+    /// File extension of cache files inside the cache directory.
+    static constexpr char const * kFileExtension = ".wtemb";
+
+    /**
+     * @brief Open (or create) the cache file for @p key in @p directory.
+     *
+     * An existing file is reused if its header matches the key, frame count
+     * and feature dimension; otherwise it is replaced by an empty cache.
+     *
+     * @pre num_frames > 0 && feature_dim > 0 (enforcement: exception)
+     * @throws std::invalid_argument on empty shape
+     * @throws std::runtime_error if the file cannot be created or mapped
+     */
+    [[nodiscard]] static std::shared_ptr<EmbeddingCache> open(
+            std::filesystem::path const & directory,
+            EmbeddingCacheKey const & key,
+            std::size_t num_frames,
+            std::size_t feature_dim);
+
+    /// Path of the cache file for @p key inside @p directory.
+    [[nodiscard]] static std::filesystem::path pathFor(
+            std::filesystem::path const & directory,
+            EmbeddingCacheKey const & key);
+
+    ~EmbeddingCache();
+
+    EmbeddingCache(EmbeddingCache const &) = delete;
+    EmbeddingCache & operator=(EmbeddingCache const &) = delete;
+
+    [[nodiscard]] std::filesystem::path const & path() const noexcept { return _path; }
+    [[nodiscard]] std::size_t numFrames() const noexcept { return _num_frames; }
+    [[nodiscard]] std::size_t featureDim() const noexcept { return _feature_dim; }
+
+    /// Whether the row for @p frame has been stored. Out-of-range frames are not cached.
+    [[nodiscard]] bool contains(std::size_t frame) const noexcept;
+
+    /// Number of frames currently cached.
+    [[nodiscard]] std::size_t cachedCount() const noexcept;
+
+    /// Frames in [first, last] (clamped to the cache) that are not cached yet.
+    [[nodiscard]] std::vector<std::size_t> missingFrames(std::size_t first,
+                                                         std::size_t last) const;
+
+    /**
+     * @brief Zero-copy view of the stored row for @p frame.
+     *
+     * @pre contains(frame) (enforcement: exception)
+     * @throws std::out_of_range if the frame is not cached
+     */
+    [[nodiscard]] std::span<float const> row(std::size_t frame) const;
+
+    /**
+     * @brief Write the row for @p frame and mark it cached.
+     *
+     * @pre frame < numFrames() (enforcement: exception)
+     * @pre values.size() == featureDim() (enforcement: exception)
+     * @throws std::out_of_range / std::invalid_argument on violation
+     */
+    void store(std::size_t frame, std::span<float const> values);
+
+    /// Flush dirty pages of the mapping to disk.
+    void flush();
+
+    /**
+     * @brief Expose frames [first, last] as a zero-copy 2D TensorData.
+     *
+     * Rows are time-indexed from @p first; the returned tensor keeps this
+     * cache (and its mapping) alive.
+     *
+     * @return nullptr if any frame in the range is not cached or the range
+     *         is empty / out of bounds.
+     */
+    [[nodiscard]] std::shared_ptr<TensorData> toTensorData(std::size_t first,
+                                                           std::size_t last) const;
+
+private:
+    struct Mapping;
+
+    EmbeddingCache(std::filesystem::path path,
+                   std::unique_ptr<Mapping> mapping,
+                   std::size_t num_frames,
+                   std::size_t feature_dim,
+                   std::size_t presence_offset,
+                   std::size_t data_offset);
+
+    [[nodiscard]] std::uint8_t * _presence() const noexcept;
+    [[nodiscard]] float * _rows() const noexcept;
+
+    std::filesystem::path _path;
+    std::unique_ptr<Mapping> _mapping;
+    std::size_t _num_frames;
+    std::size_t _feature_dim;
+    std::size_t _presence_offset;
+    std::size_t _data_offset;
+};
+
+}// namespace dl
+
+#endif// NEURALYZER_EMBEDDING_CACHE_HPP
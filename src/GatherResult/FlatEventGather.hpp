@@ -0,0 +1,360 @@
+#ifndef FLAT_EVENT_GATHER_HPP
+#define FLAT_EVENT_GATHER_HPP
+
+/**
+ * @file FlatEventGather.hpp
+ * @brief Trial-aligned event data in one contiguous CSR (compressed sparse row) block
+ *
+ * GatherResult<DigitalEventSeries> creates one view series (and storage
+ * wrapper) per trial, and consumers walk every view element by element.
+ * FlatEventGather instead holds all trials in three flat arrays:
+ *
+ * - `relative_times[k]` — event time minus the trial's alignment time (ClockTicks)
+ * - `entity_ids[k]` — EntityId of the source event
+ * - `trial_offsets[t] .. trial_offsets[t + 1]` — the slice belonging to trial t
+ *
+ * It is built by one merge pass over the sorted source events and the
+ * alignment windows: the window bounds are located with cursors that only
+ * move forward while the windows are sorted (galloping search, so sparse
+ * windows over dense events stay cheap), the offsets are prefix-summed, and
+ * the slices are then filled independently — optionally in parallel, one
+ * partition per trial range.
+ *
+ * ## Example
+ *
+ * @code
+ * auto gathered = gather(spikes, windows, alignment_points);
+ * auto flat = gatherFlat(gathered, {.trials_per_chunk = 64});
+ *
+ * for (std::size_t t = 0; t < flat.trialCount(); ++t) {
+ *     for (int64_t rel: flat.trialTimes(t)) {
+ *         // rel is relative to trial t's alignment time
+ *     }
+ * }
+ * @endcode
+ *
+ * @see GatherResult for the per-trial view representation
+ */
+
+#include "GatherResult.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "Entity/EntityId.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+#include "TimeFrame/interval_data.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Options for building a FlatEventGather
+ */
+struct FlatGatherOptions {
+    /// Trials filled per parallel partition; 0 fills all trials on the calling thread
+    std::size_t trials_per_chunk = 0;
+};
+
+/**
+ * @brief Trial-aligned events of one DigitalEventSeries in CSR layout
+ *
+ * Within a trial, events keep the source order, so relative times are
+ * non-decreasing.
+ */
+struct FlatEventGather {
+    std::vector<std::size_t> trial_offsets{0};///< CSR row pointers, size trialCount() + 1
+    std::vector<int64_t> relative_times;      ///< Event ClockTicks minus trial alignment ClockTicks
+    std::vector<EntityId> entity_ids;         ///< Source EntityId per event
+    std::vector<int64_t> alignment_times;     ///< Absolute alignment ClockTicks per trial
+    std::vector<std::size_t> missing_trials;  ///< Ascending trials whose GatherResult row was null; kept as empty rows
+
+    [[nodiscard]] std::size_t trialCount() const noexcept { return trial_offsets.size() - 1; }
+    /// Trials that had a row in the source GatherResult
+    [[nodiscard]] std::size_t presentTrialCount() const noexcept { return trialCount() - missing_trials.size(); }
+    [[nodiscard]] bool isTrialMissing(std::size_t trial) const {
+        return std::binary_search(missing_trials.begin(), missing_trials.end(), trial);
+    }
+    [[nodiscard]] std::size_t eventCount() const noexcept { return relative_times.size(); }
+    [[nodiscard]] bool empty() const noexcept { return trialCount() == 0; }
+
+    [[nodiscard]] std::size_t trialSize(std::size_t trial) const {
+        return trial_offsets[trial + 1] - trial_offsets[trial];
+    }
+
+    /// Relative times of one trial
+    [[nodiscard]] std::span<int64_t const> trialTimes(std::size_t trial) const {
+        return std::span<int64_t const>(relative_times).subspan(trial_offsets[trial], trialSize(trial));
+    }
+
+    /// EntityIds of one trial, parallel to trialTimes()
+    [[nodiscard]] std::span<EntityId const> trialEntityIds(std::size_t trial) const {
+        return std::span<EntityId const>(entity_ids).subspan(trial_offsets[trial], trialSize(trial));
+    }
+
+    /**
+     * @brief Copy with trials in the order given by @p indices
+     *
+     * @pre indices is a permutation of [0, trialCount()) (enforcement: runtime_check) [IMPORTANT]
+     * @throws std::invalid_argument if indices has the wrong size
+     * @throws std::out_of_range if an index is >= trialCount()
+     */
+    [[nodiscard]] FlatEventGather reorder(std::vector<std::size_t> const & indices) const {
+        if (indices.size() != trialCount()) {
+            throw std::invalid_argument("FlatEventGather::reorder: indices size must match trial count");
+        }
+
+        FlatEventGather result;
+        result.trial_offsets.reserve(indices.size() + 1);
+        result.relative_times.reserve(eventCount());
+        result.entity_ids.reserve(eventCount());
+        result.alignment_times.reserve(indices.size());
+
+        for (auto const idx: indices) {
+            if (idx >= trialCount()) {
+                throw std::out_of_range("FlatEventGather::reorder: index out of range");
+            }
+            if (isTrialMissing(idx)) {
+                result.missing_trials.push_back(result.alignment_times.size());
+            }
+            auto const times = trialTimes(idx);
+            auto const ids = trialEntityIds(idx);
+            result.relative_times.insert(result.relative_times.end(), times.begin(), times.end());
+            result.entity_ids.insert(result.entity_ids.end(), ids.begin(), ids.end());
+            result.trial_offsets.push_back(result.relative_times.size());
+            result.alignment_times.push_back(alignment_times[idx]);
+        }
+        return result;
+    }
+};
+
+namespace Neuralyzer::Gather {
+
+/**
+ * @brief First position >= @p from in [from, end) whose event is not before @p target
+ *
+ * Exponential probe from @p from, then binary search of the last gap.
+ *
+ * @tparam Inclusive false: first event >= target; true: first event > target
+ */
+template<bool Inclusive>
+[[nodiscard]] std::size_t gallopEvents(std::span<TimeFrameIndex const> events,
+                                       std::size_t from,
+                                       TimeFrameIndex target) {
+    auto const before = [target](TimeFrameIndex e) {
+        if constexpr (Inclusive) {
+            return e <= target;
+        } else {
+            return e < target;
+        }
+    };
+
+    std::size_t lo = from;
+    std::size_t hi = from;
+    std::size_t step = 1;
+    while (hi < events.size() && before(events[hi])) {
+        lo = hi + 1;
+        hi += step;
+        step *= 2;
+    }
+    hi = std::min(hi, events.size());
+
+    auto const first = events.begin() + static_cast<std::ptrdiff_t>(lo);
+    auto const last = events.begin() + static_cast<std::ptrdiff_t>(hi);
+    auto const it = Inclusive ? std::upper_bound(first, last, target)
+                              : std::lower_bound(first, last, target);
+    return static_cast<std::size_t>(it - events.begin());
+}
+
+/**
+ * @brief Monotone cursor over sorted events
+ *
+ * Gallops forward from the previous answer while targets are non-decreasing
+ * and restarts from the front when a target goes backwards (unsorted or
+ * nested windows), so any window order gives correct bounds.
+ */
+template<bool Inclusive>
+class EventCursor {
+public:
+    explicit EventCursor(std::span<TimeFrameIndex const> events)
+        : _events(events) {}
+
+    [[nodiscard]] std::size_t seek(TimeFrameIndex target) {
+        if (_has_previous && target < _previous) {
+            _position = 0;
+        }
+        _position = gallopEvents<Inclusive>(_events, _position, target);
+        _previous = target;
+        _has_previous = true;
+        return _position;
+    }
+
+private:
+    std::span<TimeFrameIndex const> _events;
+    std::size_t _position = 0;
+    TimeFrameIndex _previous{0};
+    bool _has_previous = false;
+};
+
+}// namespace Neuralyzer::Gather
+
+/**
+ * @brief Gather events of @p source into CSR layout, one trial per query interval
+ *
+ * Trial t holds the events whose TimeFrameIndex lies in
+ * [query_intervals[t].start, query_intervals[t].end], with times relative to
+ * alignment_times[t]. This matches the rows of a GatherResult created from
+ * the same intervals.
+ *
+ * @param source Absolute-time event series with a TimeFrame
+ * @param query_intervals Trial windows in @p source TimeFrame indices
+ * @param alignment_times Absolute ClockTicks of each trial's t = 0
+ * @param options Parallel partitioning options
+ *
+ * @pre alignment_times.size() == query_intervals.size() (enforcement: runtime_check) [CRITICAL]
+ * @pre source has a TimeFrame and stores absolute times (enforcement: runtime_check) [CRITICAL]
+ * @post trial_offsets.size() == query_intervals.size() + 1
+ */
+[[nodiscard]] inline FlatEventGather gatherFlat(
+        DigitalEventSeries const & source,
+        std::span<TimeFrameInterval const> query_intervals,
+        std::span<int64_t const> alignment_times,
+        FlatGatherOptions const & options = {}) {
+    if (alignment_times.size() != query_intervals.size()) {
+        throw std::invalid_argument("gatherFlat: alignment time count must match interval count");
+    }
+    auto const time_frame = source.getTimeFrame();
+    if (!time_frame || source.storesRelativeTimes()) {
+        throw std::invalid_argument("gatherFlat: source must be an absolute-time series with a TimeFrame");
+    }
+
+    // Contiguous event columns; view/lazy storage is copied out once
+    std::vector<TimeFrameIndex> copied_events;
+    std::vector<EntityId> copied_ids;
+    std::span<TimeFrameIndex const> events;
+    std::span<EntityId const> ids;
+    auto const & cache = source.storageCache();
+    if (cache.isValid() && cache.time_domain == DigitalEventTimeDomain::TimeFrameIndex) {
+        events = {cache.events_ptr, cache.cache_size};
+        ids = {cache.entity_ids_ptr, cache.cache_size};
+    } else {
+        copied_events.reserve(source.size());
+        copied_ids.reserve(source.size());
+        for (std::size_t i = 0; i < source.size(); ++i) {
+            copied_events.push_back(source.getStoredEvent(i));
+            copied_ids.push_back(source.getStoredEntityId(i));
+        }
+        events = copied_events;
+        ids = copied_ids;
+    }
+
+    std::size_t const num_trials = query_intervals.size();
+    FlatEventGather result;
+    result.alignment_times.assign(alignment_times.begin(), alignment_times.end());
+    result.trial_offsets.resize(num_trials + 1);
+
+    // Merge pass: source range of each window, then prefix-sum into offsets
+    std::vector<std::size_t> first_event(num_trials);
+    Neuralyzer::Gather::EventCursor<false> start_cursor(events);
+    Neuralyzer::Gather::EventCursor<true> end_cursor(events);
+    result.trial_offsets[0] = 0;
+    for (std::size_t t = 0; t < num_trials; ++t) {
+        auto const lo = start_cursor.seek(query_intervals[t].start);
+        auto const hi = end_cursor.seek(query_intervals[t].end);
+        first_event[t] = lo;
+        result.trial_offsets[t + 1] = result.trial_offsets[t] + (hi > lo ? hi - lo : 0);
+    }
+
+    std::size_t const total = result.trial_offsets.back();
+    result.relative_times.resize(total);
+    result.entity_ids.resize(total);
+
+    auto const fill = [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t t = lo; t < hi; ++t) {
+            std::size_t const out = result.trial_offsets[t];
+            std::size_t const count = result.trial_offsets[t + 1] - out;
+            std::size_t const in = first_event[t];
+            int64_t const alignment = alignment_times[t];
+            for (std::size_t k = 0; k < count; ++k) {
+                result.relative_times[out + k] =
+                        time_frame->getTimeAtIndex(events[in + k]).getValue() - alignment;
+                result.entity_ids[out + k] = ids[in + k];
+            }
+        }
+    };
+
+    if (options.trials_per_chunk == 0) {
+        fill(0, num_trials);
+    } else {
+        CoreUtilities::parallelForChunks(0, num_trials, options.trials_per_chunk, fill);
+    }
+    return result;
+}
+
+/**
+ * @brief Flatten a GatherResult<DigitalEventSeries> into CSR layout
+ *
+ * Trials follow the visible (possibly reordered) row order of @p gathered,
+ * and relative times use its alignmentTimeAt(). Results with direct-gather
+ * provenance over an absolute-time source with a TimeFrame are re-gathered
+ * from the source in one merge pass without touching the row views; any
+ * other result (fromRows, relative-time or TimeFrame-less sources) is copied
+ * from its views.
+ *
+ * Null rows become empty trials listed in missing_trials, so trial indices
+ * still match the rows of @p gathered while consumers can skip them.
+ */
+[[nodiscard]] inline FlatEventGather gatherFlat(
+        GatherResult<DigitalEventSeries> const & gathered,
+        FlatGatherOptions const & options = {}) {
+    std::size_t const num_trials = gathered.size();
+    std::vector<int64_t> alignment_times(num_trials);
+    for (std::size_t i = 0; i < num_trials; ++i) {
+        alignment_times[i] = gathered.alignmentTimeAt(i).getValue();
+    }
+
+    std::vector<std::size_t> missing_trials;
+    for (std::size_t i = 0; i < num_trials; ++i) {
+        if (!gathered[i]) {
+            missing_trials.push_back(i);
+        }
+    }
+
+    auto const source = gathered.source();
+    if (source && gathered.intervals().size() == num_trials &&
+        source->getTimeFrame() && !source->storesRelativeTimes()) {
+        std::vector<TimeFrameInterval> query_intervals;
+        query_intervals.reserve(num_trials);
+        for (std::size_t i = 0; i < num_trials; ++i) {
+            auto interval = gathered.intervalAtReordered(i);
+            if (!gathered[i]) {
+                // end = start - 1 selects no events
+                interval.end = TimeFrameIndex(interval.start.getValue() - 1);
+            }
+            query_intervals.push_back(interval);
+        }
+        auto result = gatherFlat(*source, query_intervals, alignment_times, options);
+        result.missing_trials = std::move(missing_trials);
+        return result;
+    }
+
+    FlatEventGather result;
+    result.alignment_times = std::move(alignment_times);
+    result.missing_trials = std::move(missing_trials);
+    result.trial_offsets.reserve(num_trials + 1);
+    for (std::size_t i = 0; i < num_trials; ++i) {
+        if (auto const & row = gathered[i]) {
+            for (auto const & event: row->view()) {
+                result.relative_times.push_back(event.time().getValue() - result.alignment_times[i]);
+                result.entity_ids.push_back(event.id());
+            }
+        }
+        result.trial_offsets.push_back(result.relative_times.size());
+    }
+    return result;
+}
+
+#endif// FLAT_EVENT_GATHER_HPP
@@ -461,7 +461,7 @@ public:
     /**
      * @brief Get the source data that views were created from
      */
-    [[nodiscard]] std::shared_ptr<T> source() { return _source; }
+    [[nodiscard]] std::shared_ptr<T> source() const { return _source; }
 
     /**
      * @brief Get the alignment intervals used to create views
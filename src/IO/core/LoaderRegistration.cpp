@@ -5,8 +5,10 @@
 // Format-centric loaders - the unified approach
 // CSVLoader handles: Line, Points, Analog, DigitalEvent, DigitalInterval
 // BinaryFormatLoader handles: Analog, DigitalEvent, DigitalInterval
+// NativeFormatLoader handles: Line, Points, Mask, DigitalEvent, DigitalInterval, Tensor
 #include "formats/Binary/BinaryFormatLoader.hpp"
 #include "formats/CSV/CSVLoader.hpp"
+#include "formats/Native/NativeFormatLoader.hpp"
 
 // Conditional includes based on compile-time options
 #ifdef ENABLE_CAPNPROTO
@@ -60,6 +62,12 @@ void registerInternalLoaders(LoaderRegistry & registry) {
     // - DM_DataType::DigitalEvent: TTL extraction from binary
     // - DM_DataType::DigitalInterval: TTL extraction from binary
     registry.registerLoader(std::make_unique<BinaryFormatLoader>());
+
+    // NativeFormatLoader handles the memory-mapped native session format:
+    // - DM_DataType::Line, Points, Mask: lazy storage decoded from the mapping
+    // - DM_DataType::Tensor: zero-copy MappedTensorStorage
+    // - DM_DataType::DigitalEvent, DigitalInterval: bulk copy of the time columns
+    registry.registerLoader(std::make_unique<NativeFormatLoader>());
 }
 
 void registerExternalLoaders() {
@@ -0,0 +1,185 @@
+#include "Analog_Float_Cache.hpp"
+
+#include "formats/Binary/common/binary_deinterleave.hpp"
+
+#include "IO/core/AtomicWrite.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+constexpr char cache_magic[8] = {'W', 'T', 'F', 'L', 'T', 'C', 'H', '1'};
+constexpr std::uint32_t cache_version = 1;
+
+struct AnalogFloatCacheHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t data_type;
+    std::uint64_t num_channels;
+    std::uint64_t num_samples;
+    std::uint64_t source_size;
+    std::int64_t source_mtime;
+    std::uint64_t source_header_size;
+    float scale_factor;
+    float offset_value;
+};
+static_assert(sizeof(AnalogFloatCacheHeader) == analog_float_cache_header_size,
+              "AnalogFloatCacheHeader must match analog_float_cache_header_size");
+
+struct SourceStat {
+    std::uint64_t size = 0;
+    std::int64_t mtime = 0;
+};
+
+std::optional<SourceStat> statSource(std::filesystem::path const & path) {
+    std::error_code ec;
+    auto const size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    auto const mtime = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+    return SourceStat{.size = static_cast<std::uint64_t>(size),
+                      .mtime = static_cast<std::int64_t>(mtime.time_since_epoch().count())};
+}
+
+AnalogFloatCacheHeader makeHeader(AnalogFloatCacheSource const & source,
+                                  SourceStat const & stat,
+                                  std::size_t num_samples) {
+    AnalogFloatCacheHeader header{};
+    std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+    header.version = cache_version;
+    header.data_type = static_cast<std::uint32_t>(source.data_type);
+    header.num_channels = source.num_channels;
+    header.num_samples = num_samples;
+    header.source_size = stat.size;
+    header.source_mtime = stat.mtime;
+    header.source_header_size = source.header_size;
+    header.scale_factor = source.scale_factor;
+    header.offset_value = source.offset_value;
+    return header;
+}
+
+}// anonymous namespace
+
+std::optional<std::size_t> validAnalogFloatCache(
+        std::filesystem::path const & cache_path,
+        AnalogFloatCacheSource const & source) {
+
+    auto const stat = statSource(source.file_path);
+    if (!stat) {
+        return std::nullopt;
+    }
+
+    std::ifstream in(cache_path, std::ios::binary);
+    if (!in) {
+        return std::nullopt;
+    }
+    AnalogFloatCacheHeader header{};
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+        return std::nullopt;
+    }
+
+    auto const expected = makeHeader(source, *stat, static_cast<std::size_t>(header.num_samples));
+    if (std::memcmp(&header, &expected, sizeof(header)) != 0) {
+        return std::nullopt;
+    }
+
+    std::error_code ec;
+    auto const cache_size = std::filesystem::file_size(cache_path, ec);
+    auto const payload_size = header.num_channels * header.num_samples * sizeof(float);
+    if (ec || cache_size != analog_float_cache_header_size + payload_size) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(header.num_samples);
+}
+
+std::optional<std::size_t> buildAnalogFloatCache(
+        std::filesystem::path const & cache_path,
+        AnalogFloatCacheSource const & source) {
+
+    if (source.num_channels == 0) {
+        std::cerr << "buildAnalogFloatCache: num_channels must be at least 1" << std::endl;
+        return std::nullopt;
+    }
+
+    auto const stat = statSource(source.file_path);
+    if (!stat || stat->size < source.header_size) {
+        std::cerr << "buildAnalogFloatCache: cannot read " << source.file_path << std::endl;
+        return std::nullopt;
+    }
+
+    std::size_t const num_channels = source.num_channels;
+    std::size_t const element_size = Loader::mmapElementSize(source.data_type);
+    std::size_t const frame_bytes = num_channels * element_size;
+    std::size_t const num_samples = static_cast<std::size_t>(stat->size - source.header_size) / frame_bytes;
+
+    std::ifstream in(source.file_path, std::ios::binary);
+    if (!in) {
+        std::cerr << "buildAnalogFloatCache: cannot open " << source.file_path << std::endl;
+        return std::nullopt;
+    }
+    in.seekg(static_cast<std::streamoff>(source.header_size), std::ios::beg);
+
+    auto const header = makeHeader(source, *stat, num_samples);
+    std::size_t const block_frames = std::min(Loader::deinterleaveBlockFrames(num_channels, element_size),
+                                              std::max<std::size_t>(num_samples, 1));
+
+    std::vector<std::byte> raw(block_frames * frame_bytes);
+    std::vector<float> decoded(block_frames * num_channels);
+
+    bool const ok = atomicWriteFile(cache_path, [&](std::ostream & out) {
+        out.write(reinterpret_cast<char const *>(&header), sizeof(header));
+
+        for (std::size_t t0 = 0; t0 < num_samples; t0 += block_frames) {
+            std::size_t const n = std::min(block_frames, num_samples - t0);
+            if (!in.read(reinterpret_cast<char *>(raw.data()), static_cast<std::streamsize>(n * frame_bytes))) {
+                return false;
+            }
+
+            CoreUtilities::parallelForChunks(0, num_channels, 1, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t ch = lo; ch < hi; ++ch) {
+                    Loader::deinterleaveChannelToFloat(source.data_type, raw.data(), n, num_channels, ch,
+                                                       decoded.data() + ch * n,
+                                                       source.scale_factor, source.offset_value);
+                }
+            });
+
+            // Each channel run is contiguous in the cache, so a block lands in
+            // num_channels separate places; seeking past the current end of
+            // the temporary file leaves a hole that a later block fills.
+            for (std::size_t ch = 0; ch < num_channels; ++ch) {
+                auto const pos = analog_float_cache_header_size + (ch * num_samples + t0) * sizeof(float);
+                out.seekp(static_cast<std::streamoff>(pos), std::ios::beg);
+                out.write(reinterpret_cast<char const *>(decoded.data() + ch * n),
+                          static_cast<std::streamsize>(n * sizeof(float)));
+            }
+        }
+        return out.good();
+    });
+
+    if (!ok) {
+        std::cerr << "buildAnalogFloatCache: failed to write " << cache_path << std::endl;
+        return std::nullopt;
+    }
+    return num_samples;
+}
+
+std::optional<std::size_t> ensureAnalogFloatCache(
+        std::filesystem::path const & cache_path,
+        AnalogFloatCacheSource const & source) {
+    if (auto const cached = validAnalogFloatCache(cache_path, source)) {
+        return cached;
+    }
+    return buildAnalogFloatCache(cache_path, source);
+}
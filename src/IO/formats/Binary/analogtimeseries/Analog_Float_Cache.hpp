@@ -0,0 +1,79 @@
+/**
+ * @file Analog_Float_Cache.hpp
+ * @brief Channel-major float32 cache of an interleaved binary recording.
+ *
+ * Strided access into an interleaved int16 file touches one page per few
+ * samples of a channel and converts every sample on each read. The cache
+ * de-interleaves the recording once into a file where each channel is a
+ * contiguous float32 run:
+ *
+ * | Offset                         | Content                               |
+ * |--------------------------------|---------------------------------------|
+ * | 0                              | AnalogFloatCacheHeader (64 bytes)     |
+ * | 64 + ch * num_samples * 4      | channel `ch`, num_samples float32     |
+ *
+ * The header records the source file size and modification time together
+ * with the conversion parameters, so a cache built from a different source or
+ * with a different scale is detected and rebuilt.
+ */
+#ifndef ANALOG_FLOAT_CACHE_HPP
+#define ANALOG_FLOAT_CACHE_HPP
+
+#include "datamanagerio_export.h"
+
+#include "AnalogTimeSeries/storage/MmapAnalogConfig.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+
+/// Bytes preceding the channel data in a float cache file
+inline constexpr std::size_t analog_float_cache_header_size = 64;
+
+/**
+ * @brief Interleaved source a float cache is built from
+ */
+struct AnalogFloatCacheSource {
+    std::filesystem::path file_path;
+    std::size_t header_size = 0;
+    std::size_t num_channels = 1;
+    MmapDataType data_type = MmapDataType::Int16;
+    float scale_factor = 1.0f;
+    float offset_value = 0.0f;
+};
+
+/**
+ * @brief Samples per channel stored in @p cache_path, if it is a valid cache of @p source
+ *
+ * Returns std::nullopt when the cache is missing, truncated, or was built
+ * from a different source file, layout or conversion.
+ */
+DATAMANAGERIO_EXPORT std::optional<std::size_t> validAnalogFloatCache(
+        std::filesystem::path const & cache_path,
+        AnalogFloatCacheSource const & source);
+
+/**
+ * @brief De-interleave @p source into a float cache at @p cache_path
+ *
+ * The source is read sequentially in blocks; each block is converted on the
+ * shared thread pool with one task per channel and written to the channel
+ * runs of the cache. The file is written through atomicWriteFile(), so a
+ * concurrent reader never sees a partial cache.
+ *
+ * @pre `source.num_channels >= 1` (enforcement: runtime_check) [IMPORTANT]
+ *
+ * @return Samples per channel, or std::nullopt if the source cannot be read
+ *         or the cache cannot be written.
+ */
+DATAMANAGERIO_EXPORT std::optional<std::size_t> buildAnalogFloatCache(
+        std::filesystem::path const & cache_path,
+        AnalogFloatCacheSource const & source);
+
+/**
+ * @brief Return a valid cache for @p source, building it first if needed
+ */
+DATAMANAGERIO_EXPORT std::optional<std::size_t> ensureAnalogFloatCache(
+        std::filesystem::path const & cache_path,
+        AnalogFloatCacheSource const & source);
+
+#endif// ANALOG_FLOAT_CACHE_HPP
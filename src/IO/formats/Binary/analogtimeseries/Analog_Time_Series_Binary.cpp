@@ -1,5 +1,7 @@
 #include "Analog_Time_Series_Binary.hpp"
 
+#include "Analog_Float_Cache.hpp"
+#include "formats/Binary/common/binary_deinterleave.hpp"
 #include "formats/Binary/common/binary_loaders.hpp"
 
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
@@ -13,12 +15,17 @@
 #include "Tensors/storage/TensorStorageWrapper.hpp"
 #include "TimeFrame/TimeIndexStorage.hpp"
 
+#include "CoreUtilities/thread_pool.hpp"
+
 #include <armadillo>
 
 #include <algorithm>
 #include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <system_error>
 
 namespace {
 
@@ -41,74 +48,190 @@ MmapDataType stringToMmapDataType(std::string const & type_str) {
 namespace {
 
 /**
- * @brief Read a multi-channel interleaved binary file and convert to float.
+ * @brief Samples per channel in an interleaved binary file
  *
- * Dispatches on the binary_data_type string to call the templated
- * readBinaryFileMultiChannel with the correct element type.
+ * Returns std::nullopt (after logging) if the file cannot be opened or is
+ * smaller than its header.
  */
-std::vector<std::vector<float>> readMultiChannelAsFloat(
+std::optional<std::size_t> interleavedSamplesPerChannel(
         Loader::BinaryAnalogOptions const & loader_opts,
-        std::string const & data_type_str) {
+        std::size_t element_size) {
 
-    auto convert = [](auto const & raw_channels) {
-        std::vector<std::vector<float>> result;
-        result.reserve(raw_channels.size());
-        for (auto const & ch: raw_channels) {
-            std::vector<float> fch(ch.size());
-            for (std::size_t i = 0; i < ch.size(); ++i) {
-                fch[i] = static_cast<float>(ch[i]);
-            }
-            result.push_back(std::move(fch));
-        }
-        return result;
-    };
-
-    if (data_type_str == "float32") {
-        // float32 → float is identity but still goes through the deinterleave path
-        return convert(Loader::readBinaryFileMultiChannel<float>(loader_opts));
+    std::error_code ec;
+    auto const file_size = std::filesystem::file_size(loader_opts.file_path, ec);
+    if (ec) {
+        std::cout << "Cannot open file: " << loader_opts.file_path << std::endl;
+        return std::nullopt;
     }
-    if (data_type_str == "float64") {
-        return convert(Loader::readBinaryFileMultiChannel<double>(loader_opts));
+    if (file_size < loader_opts.header_size_bytes) {
+        std::cout << "File size is smaller than header size" << std::endl;
+        return std::nullopt;
     }
-    if (data_type_str == "int8") {
-        return convert(Loader::readBinaryFileMultiChannel<int8_t>(loader_opts));
+
+    std::size_t const data_size_bytes = static_cast<std::size_t>(file_size) - loader_opts.header_size_bytes;
+    std::size_t const frame_bytes = loader_opts.num_channels * element_size;
+    if (data_size_bytes % frame_bytes != 0) {
+        std::cout << "Warning: The bytes in data is not a multiple of number of channels" << std::endl;
     }
-    if (data_type_str == "uint16") {
-        return convert(Loader::readBinaryFileMultiChannel<uint16_t>(loader_opts));
+    return data_size_bytes / frame_bytes;
+}
+
+/**
+ * @brief Decode an interleaved binary file directly into per-channel float buffers.
+ *
+ * The file is read in blocks of a few megabytes; each block is converted on
+ * the shared thread pool (one task per channel) straight into
+ * @p channel_dst, so no typed copy of the recording is ever held. Peak memory
+ * is the float output plus one raw block.
+ *
+ * @pre `channel_dst.size() == loader_opts.num_channels` and each buffer holds
+ *      @p num_samples floats (enforcement: none) [CRITICAL]
+ */
+bool decodeInterleavedToFloat(
+        Loader::BinaryAnalogOptions const & loader_opts,
+        MmapDataType data_type,
+        std::size_t num_samples,
+        std::vector<float *> const & channel_dst) {
+
+    std::ifstream file(loader_opts.file_path, std::ios::binary);
+    if (!file) {
+        std::cout << "Cannot open file: " << loader_opts.file_path << std::endl;
+        return false;
     }
-    // Default: int16
-    return convert(Loader::readBinaryFileMultiChannel<int16_t>(loader_opts));
+    file.seekg(static_cast<std::streamoff>(loader_opts.header_size_bytes), std::ios::beg);
+
+    std::size_t const num_channels = loader_opts.num_channels;
+    std::size_t const element_size = Loader::mmapElementSize(data_type);
+    std::size_t const frame_bytes = num_channels * element_size;
+    std::size_t const block_frames = std::min(Loader::deinterleaveBlockFrames(num_channels, element_size),
+                                              std::max<std::size_t>(num_samples, 1));
+    std::vector<std::byte> block(block_frames * frame_bytes);
+
+    for (std::size_t t0 = 0; t0 < num_samples; t0 += block_frames) {
+        std::size_t const n = std::min(block_frames, num_samples - t0);
+        if (!file.read(reinterpret_cast<char *>(block.data()), static_cast<std::streamsize>(n * frame_bytes))) {
+            std::cout << "Unexpected end of file: " << loader_opts.file_path << std::endl;
+            return false;
+        }
+        CoreUtilities::parallelForChunks(0, num_channels, 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t ch = lo; ch < hi; ++ch) {
+                Loader::deinterleaveChannelToFloat(data_type, block.data(), n, num_channels, ch,
+                                                   channel_dst[ch] + t0, 1.0f, 0.0f);
+            }
+        });
+    }
+    return true;
 }
 
 /**
- * @brief Read a single-channel binary file and convert to float.
+ * @brief Read an interleaved binary file into per-channel float vectors.
+ *
+ * Returns an empty vector if the file cannot be read.
  */
-std::vector<float> readSingleChannelAsFloat(
+std::vector<std::vector<float>> readInterleavedAsFloat(
         Loader::BinaryAnalogOptions const & loader_opts,
         std::string const & data_type_str) {
 
-    auto convert = [](auto const & raw) {
-        std::vector<float> result(raw.size());
-        for (std::size_t i = 0; i < raw.size(); ++i) {
-            result[i] = static_cast<float>(raw[i]);
-        }
-        return result;
-    };
+    auto const data_type = stringToMmapDataType(data_type_str);
+    auto const num_samples = interleavedSamplesPerChannel(loader_opts, Loader::mmapElementSize(data_type));
+    if (!num_samples) {
+        return {};
+    }
 
-    if (data_type_str == "float32") {
-        return convert(Loader::readBinaryFile<float>(loader_opts));
+    std::vector<std::vector<float>> channels(loader_opts.num_channels);
+    std::vector<float *> dst;
+    dst.reserve(channels.size());
+    for (auto & ch: channels) {
+        ch.resize(*num_samples);
+        dst.push_back(ch.data());
     }
-    if (data_type_str == "float64") {
-        return convert(Loader::readBinaryFile<double>(loader_opts));
+
+    if (!decodeInterleavedToFloat(loader_opts, data_type, *num_samples, dst)) {
+        return {};
     }
-    if (data_type_str == "int8") {
-        return convert(Loader::readBinaryFile<int8_t>(loader_opts));
+    return channels;
+}
+
+/**
+ * @brief Resolve a loader path against parent_dir when it is relative
+ */
+std::filesystem::path resolveAgainstParent(std::string const & path, BinaryAnalogLoaderOptions const & opts) {
+    std::filesystem::path resolved = path;
+    if (!resolved.is_absolute()) {
+        resolved = std::filesystem::path(opts.getParentDir()) / resolved;
     }
-    if (data_type_str == "uint16") {
-        return convert(Loader::readBinaryFile<uint16_t>(loader_opts));
+    return resolved;
+}
+
+/**
+ * @brief Map each channel of a float cache as float32 storage.
+ *
+ * Builds the cache on first use. offset and stride address the interleaved
+ * source in elements; on the channel-major cache an offset of o * num_channels
+ * becomes a start sample of o and stride stays the per-channel step, so both
+ * paths return the same samples.
+ *
+ * Returns an empty vector if the cache cannot be built, or if offset is not a
+ * multiple of num_channels (such an offset shifts samples across channels on
+ * the direct path). The caller then falls back to strided mapping.
+ */
+std::vector<std::shared_ptr<AnalogTimeSeries>> loadFromFloatCache(
+        BinaryAnalogLoaderOptions const & opts,
+        std::filesystem::path const & file_path) {
+
+    auto const num_channels = static_cast<std::size_t>(opts.getNumChannels());
+    auto const cache_path = resolveAgainstParent(opts.getFloatCachePath(), opts);
+
+    if (opts.getOffset() % num_channels != 0) {
+        std::cerr << "Float cache: offset " << opts.getOffset() << " is not a multiple of "
+                  << num_channels << " channels" << std::endl;
+        return {};
+    }
+    std::size_t const start_sample = opts.getOffset() / num_channels;
+    std::size_t const stride = opts.getStride();
+
+    AnalogFloatCacheSource const source{
+            .file_path = file_path,
+            .header_size = static_cast<std::size_t>(opts.getHeaderSize()),
+            .num_channels = num_channels,
+            .data_type = stringToMmapDataType(opts.getBinaryDataType()),
+            .scale_factor = opts.getScaleFactor(),
+            .offset_value = opts.getOffsetValue()};
+
+    auto const cached_samples = ensureAnalogFloatCache(cache_path, source);
+    if (!cached_samples || *cached_samples == 0) {
+        return {};
+    }
+
+    // Cached channels are already scaled; only the sample selection remains
+    if (start_sample >= *cached_samples) {
+        return {};
+    }
+    std::size_t num_samples = (*cached_samples - start_sample + stride - 1) / stride;
+    if (opts.getNumSamples() > 0) {
+        num_samples = std::min(num_samples, opts.getNumSamples());
+    }
+    auto time_storage = TimeIndexStorageFactory::createDenseFromZero(num_samples);
+
+    std::vector<std::shared_ptr<AnalogTimeSeries>> channels;
+    channels.reserve(num_channels);
+    for (std::size_t ch = 0; ch < num_channels; ++ch) {
+        MmapStorageConfig config;
+        config.file_path = cache_path;
+        config.header_size = analog_float_cache_header_size;
+        config.offset = ch * *cached_samples + start_sample;
+        config.stride = stride;
+        config.num_samples = num_samples;
+        config.data_type = MmapDataType::Float32;
+
+        channels.push_back(AnalogTimeSeries::createFromStorage(
+                AnalogDataStorageWrapper(MemoryMappedAnalogDataStorage(std::move(config))),
+                time_storage));
     }
-    // Default: int16
-    return convert(Loader::readBinaryFile<int16_t>(loader_opts));
+
+    std::cout << "Memory-mapped " << channels.size() << " channel(s) from float cache "
+              << cache_path << std::endl;
+    return channels;
 }
 
 }// anonymous namespace
@@ -120,12 +243,20 @@ std::vector<std::shared_ptr<AnalogTimeSeries>> load(BinaryAnalogLoaderOptions co
 
     // Memory-mapped loading path
     if (opts.getUseMemoryMapped()) {
-        std::filesystem::path file_path = opts.filepath;
-        if (!file_path.is_absolute()) {
-            file_path = std::filesystem::path(opts.getParentDir()) / file_path;
+        auto const file_path = resolveAgainstParent(opts.filepath, opts);
+
+        if (!opts.getFloatCachePath().empty()) {
+            analog_time_series = loadFromFloatCache(opts, file_path);
+            if (!analog_time_series.empty()) {
+                return analog_time_series;
+            }
+            std::cerr << "Float cache unavailable, mapping interleaved file directly" << std::endl;
         }
 
-        // Create one memory-mapped series per channel
+        // Map each channel directly over the interleaved file; samples are
+        // converted and scaled on access. All channels have the same length,
+        // so they share one dense time storage.
+        std::shared_ptr<TimeIndexStorage> time_storage;
         for (size_t channel = 0; channel < static_cast<size_t>(opts.getNumChannels()); ++channel) {
             MmapStorageConfig config;
             config.file_path = file_path;
@@ -137,19 +268,13 @@ std::vector<std::shared_ptr<AnalogTimeSeries>> load(BinaryAnalogLoaderOptions co
             config.offset_value = opts.getOffsetValue();
             config.num_samples = opts.getNumSamples();
 
-            // Create time vector for this channel
-            // First, create a temporary mmap storage to get the actual sample count
-            auto temp_storage = MemoryMappedAnalogDataStorage(config);
-            size_t const num_samples = temp_storage.size();
-
-            std::vector<TimeFrameIndex> time_vector;
-            for (size_t i = 0; i < num_samples; ++i) {
-                time_vector.emplace_back(static_cast<int64_t>(i));
+            auto storage = MemoryMappedAnalogDataStorage(std::move(config));
+            if (!time_storage || time_storage->size() != storage.size()) {
+                time_storage = TimeIndexStorageFactory::createDenseFromZero(storage.size());
             }
 
-            // Now create the actual series with the config
-            auto series = AnalogTimeSeries::createMemoryMapped(std::move(config), std::move(time_vector));
-            analog_time_series.push_back(series);
+            analog_time_series.push_back(AnalogTimeSeries::createFromStorage(
+                    AnalogDataStorageWrapper(std::move(storage)), time_storage));
         }
 
         std::cout << "Memory-mapped " << analog_time_series.size() << " channel(s)" << std::endl;
@@ -163,9 +288,9 @@ std::vector<std::shared_ptr<AnalogTimeSeries>> load(BinaryAnalogLoaderOptions co
 
     std::string const data_type_str = opts.getBinaryDataType();
 
-    if (opts.getNumChannels() > 1) {
+    auto data = readInterleavedAsFloat(binary_loader_opts, data_type_str);
 
-        auto data = readMultiChannelAsFloat(binary_loader_opts, data_type_str);
+    if (opts.getNumChannels() > 1) {
 
         std::cout << "Read " << data.size() << " channels" << std::endl;
 
@@ -180,7 +305,7 @@ std::vector<std::shared_ptr<AnalogTimeSeries>> load(BinaryAnalogLoaderOptions co
 
     } else {
 
-        auto data_float = readSingleChannelAsFloat(binary_loader_opts, data_type_str);
+        auto data_float = data.empty() ? std::vector<float>{} : std::move(data.front());
 
         size_t const num_samples = data_float.size();
         analog_time_series.push_back(std::make_shared<AnalogTimeSeries>(std::move(data_float), num_samples));
@@ -204,10 +329,7 @@ BinaryAnalogLoadResult loadTensorBacked(BinaryAnalogLoaderOptions const & opts)
 
     if (opts.getUseMemoryMapped()) {
         // Block-cached mmap path: single shared mmap + decoded float block cache
-        std::filesystem::path file_path = opts.filepath;
-        if (!file_path.is_absolute()) {
-            file_path = std::filesystem::path(opts.getParentDir()) / file_path;
-        }
+        auto const file_path = resolveAgainstParent(opts.filepath, opts);
 
         auto const num_channels = static_cast<std::size_t>(opts.getNumChannels());
 
@@ -269,27 +391,25 @@ BinaryAnalogLoadResult loadTensorBacked(BinaryAnalogLoaderOptions const & opts)
 
     std::string const data_type_str = opts.getBinaryDataType();
 
-    // Read interleaved binary → per-channel float vectors
-    auto channel_data = readMultiChannelAsFloat(binary_loader_opts, data_type_str);
-
-    if (channel_data.empty()) {
+    auto const data_type = stringToMmapDataType(data_type_str);
+    auto const samples = interleavedSamplesPerChannel(binary_loader_opts, Loader::mmapElementSize(data_type));
+    if (!samples) {
         return BinaryAnalogLoadResult{};
     }
 
-    auto const num_channels = channel_data.size();
-    auto const num_samples = channel_data[0].size();
+    auto const num_channels = binary_loader_opts.num_channels;
+    auto const num_samples = *samples;
 
-    // Build an Armadillo matrix (column-major): rows = time, cols = channels
+    // Decode straight into an Armadillo matrix (column-major): rows = time, cols = channels
     arma::fmat matrix(num_samples, num_channels);
+    std::vector<float *> columns;
+    columns.reserve(num_channels);
     for (std::size_t ch = 0; ch < num_channels; ++ch) {
-        float * col = matrix.colptr(ch);
-        auto const & src = channel_data[ch];
-        std::copy(src.begin(), src.end(), col);
+        columns.push_back(matrix.colptr(ch));
+    }
+    if (!decodeInterleavedToFloat(binary_loader_opts, data_type, num_samples, columns)) {
+        return BinaryAnalogLoadResult{};
     }
-
-    // Free the intermediate per-channel vectors
-    channel_data.clear();
-    channel_data.shrink_to_fit();
 
     // Build column names: "0", "1", ...
     std::vector<std::string> col_names;
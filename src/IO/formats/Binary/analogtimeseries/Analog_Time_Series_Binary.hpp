@@ -70,6 +70,9 @@ struct BinaryAnalogLoaderOptions {
 
     std::optional<bool> use_tensor_backed;
 
+    // Channel-major float32 cache for the memory-mapped path (empty = map the interleaved file directly)
+    std::optional<std::string> float_cache_path;
+
     // Helper methods to get values with defaults
     std::string getParentDir() const { return parent_dir.value_or("."); }
     int getHeaderSize() const { return header_size.has_value() ? header_size.value().value() : 0; }
@@ -82,6 +85,7 @@ struct BinaryAnalogLoaderOptions {
     float getOffsetValue() const { return offset_value.value_or(0.0f); }
     size_t getNumSamples() const { return num_samples.value_or(0); }
     bool getUseTensorBacked() const { return use_tensor_backed.value_or(false); }
+    std::string getFloatCachePath() const { return float_cache_path.value_or(""); }
 };
 
 // Compile-time validation that BinaryAnalogLoaderOptions conforms to loader requirements
@@ -156,6 +160,10 @@ struct ParameterUIHints<BinaryAnalogLoaderOptions> {
             f->tooltip =
                     "Store multi-channel data in a shared TensorData matrix with zero-copy per-channel views (in-memory path, num_channels > 1)";
         }
+        if (auto * f = schema.field("float_cache_path")) {
+            f->tooltip =
+                    "Optional file that caches each channel as contiguous scaled float32; built once in parallel, reused while the source is unchanged (memory-mapped path, ignored when use_tensor_backed)";
+        }
     }
 };
 
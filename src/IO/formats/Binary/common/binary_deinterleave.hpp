@@ -0,0 +1,121 @@
+#ifndef BINARY_DEINTERLEAVE_HPP
+#define BINARY_DEINTERLEAVE_HPP
+
+/**
+ * @file binary_deinterleave.hpp
+ * @brief Convert interleaved raw samples straight into per-channel float buffers.
+ *
+ * The kernels read from a raw byte block (as read from disk or mapped) and
+ * write converted floats directly to their destination, so loaders never hold
+ * an intermediate typed copy of the whole recording.
+ */
+
+#include "AnalogTimeSeries/storage/MmapAnalogConfig.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Loader {
+
+/**
+ * @brief Size in bytes of one sample of @p type
+ */
+inline std::size_t mmapElementSize(MmapDataType type) {
+    switch (type) {
+        case MmapDataType::Float32:
+            return sizeof(float);
+        case MmapDataType::Float64:
+            return sizeof(double);
+        case MmapDataType::Int8:
+            return sizeof(int8_t);
+        case MmapDataType::UInt8:
+            return sizeof(uint8_t);
+        case MmapDataType::Int16:
+            return sizeof(int16_t);
+        case MmapDataType::UInt16:
+            return sizeof(uint16_t);
+        case MmapDataType::Int32:
+            return sizeof(int32_t);
+        case MmapDataType::UInt32:
+            return sizeof(uint32_t);
+    }
+    return sizeof(int16_t);
+}
+
+/**
+ * @brief Convert one channel of an interleaved block to float
+ *
+ * Reads `src[frame * num_channels + channel]` for each frame and writes
+ * `value * scale_factor + offset_value` to `dst[frame]`. When the transform is
+ * the identity the plain conversion is stored, so float32 input round-trips
+ * bit-exactly.
+ *
+ * @pre @p src holds at least `num_frames * num_channels` samples of T
+ *      (enforcement: none) [CRITICAL]
+ * @pre `channel < num_channels` (enforcement: none) [CRITICAL]
+ */
+template<typename T>
+void deinterleaveChannelToFloat(std::byte const * src,
+                                std::size_t num_frames,
+                                std::size_t num_channels,
+                                std::size_t channel,
+                                float * dst,
+                                float scale_factor,
+                                float offset_value) {
+    std::size_t const frame_bytes = num_channels * sizeof(T);
+    std::byte const * p = src + channel * sizeof(T);
+    bool const identity = scale_factor == 1.0f && offset_value == 0.0f;
+    for (std::size_t i = 0; i < num_frames; ++i, p += frame_bytes) {
+        T value;
+        std::memcpy(&value, p, sizeof(T));// Source may be unaligned (arbitrary header size)
+        float const f = static_cast<float>(value);
+        dst[i] = identity ? f : f * scale_factor + offset_value;
+    }
+}
+
+/**
+ * @brief Runtime-dispatched deinterleaveChannelToFloat()
+ */
+inline void deinterleaveChannelToFloat(MmapDataType type,
+                                       std::byte const * src,
+                                       std::size_t num_frames,
+                                       std::size_t num_channels,
+                                       std::size_t channel,
+                                       float * dst,
+                                       float scale_factor,
+                                       float offset_value) {
+    switch (type) {
+        case MmapDataType::Float32:
+            return deinterleaveChannelToFloat<float>(src, num_frames, num_channels, channel, dst, scale_factor, offset_value);
+        case MmapDataType::Float64:
+            return deinterleaveChannelToFloat<double>(src, num_frames, num_channels, channel, dst, scale_factor, offset_value);
+        case MmapDataType::Int8:
+            return deinterleaveChannelToFloat<int8_t>(src, num_frames, num_channels, channel, dst, scale_factor, offset_value);
+        case MmapDataType::UInt8:
+            return deinterleaveChannelToFloat<uint8_t>(src, num_frames, num_channels, channel, dst, scale_factor, offset_value);
+        case MmapDataType::Int16:
+            return deinterleaveChannelToFloat<int16_t>(src, num_frames, num_channels, channel, dst, scale_factor, offset_value);
+        case MmapDataType::UInt16:
+            return deinterleaveChannelToFloat<uint16_t>(src, num_frames, num_channels, channel, dst, scale_factor, offset_value);
+        case MmapDataType::Int32:
+            return deinterleaveChannelToFloat<int32_t>(src, num_frames, num_channels, channel, dst, scale_factor, offset_value);
+        case MmapDataType::UInt32:
+            return deinterleaveChannelToFloat<uint32_t>(src, num_frames, num_channels, channel, dst, scale_factor, offset_value);
+    }
+}
+
+/**
+ * @brief Frames per block that keep one raw interleaved block near @p target_bytes
+ */
+inline std::size_t deinterleaveBlockFrames(std::size_t num_channels,
+                                           std::size_t element_size,
+                                           std::size_t target_bytes = std::size_t{8} << 20U) {
+    std::size_t const frame_bytes = num_channels * element_size;
+    std::size_t const frames = frame_bytes == 0 ? 0 : target_bytes / frame_bytes;
+    return frames < 4096 ? 4096 : frames;
+}
+
+}// namespace Loader
+
+#endif// BINARY_DEINTERLEAVE_HPP
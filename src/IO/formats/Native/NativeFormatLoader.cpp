@@ -0,0 +1,511 @@
+#include "NativeFormatLoader.hpp"
+
+#include "common/NativeChunkedFile.hpp"
+#include "common/NativeFormatOptions.hpp"
+
+#include "CoreGeometry/ImageSize.hpp"
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "DigitalTimeSeries/Digital_Interval_Series.hpp"
+#include "IO/core/AtomicWrite.hpp"
+#include "Lines/Line_Data.hpp"
+#include "Masks/Mask_Data.hpp"
+#include "Points/Point_Data.hpp"
+#include "Tensors/RowDescriptor.hpp"
+#include "Tensors/TensorData.hpp"
+#include "Tensors/storage/MappedTensorStorage.hpp"
+#include "TimeFrame/TimeIndexStorage.hpp"
+#include "TimeFrame/interval_data.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+using NativeFormat::NativeChunkedReader;
+using NativeFormat::NativeColumns;
+using NativeFormat::PayloadType;
+using NativeFormat::RecordKind;
+
+namespace {
+
+constexpr char const * kNativeFormat = "native";
+
+// ============================================================================
+// Lazy record decoding
+// ============================================================================
+
+/**
+ * @brief Element handed to LazyRaggedStorage: decodes record `index` on get()
+ *
+ * Holding the reader keeps the mapping alive for as long as the series exists.
+ */
+template<typename TData>
+struct MappedRecord {
+    std::shared_ptr<NativeChunkedReader const> file;
+    std::size_t index;
+
+    [[nodiscard]] TData get() const {
+        if constexpr (std::is_same_v<TData, Point2D<float>>) {
+            auto const xy = file->payload<float>().subspan(index * 2, 2);
+            return {xy[0], xy[1]};
+        } else {
+            using Coord = std::conditional_t<std::is_same_v<TData, Mask2D>, std::uint32_t, float>;
+            auto const extents = file->extents();
+            auto const coords = file->payload<Coord>();
+            auto const first = static_cast<std::size_t>(extents[index]);
+            auto const last = static_cast<std::size_t>(extents[index + 1]);
+            if (last < first || last * 2 > coords.size()) {
+                return TData{};// Corrupt extents: decode as empty rather than read out of bounds
+            }
+            auto const count = last - first;
+            auto const xy = coords.subspan(first * 2, count * 2);
+
+            std::vector<Point2D<Coord>> points;
+            points.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                points.emplace_back(xy[i * 2], xy[i * 2 + 1]);
+            }
+            return TData(std::move(points));
+        }
+    }
+};
+
+template<typename Series, typename TData>
+std::shared_ptr<Series> mapRaggedSeries(std::shared_ptr<NativeChunkedReader const> file) {
+    ImageSize image_size;
+    auto const & meta = file->metadata();
+    image_size.width = meta.value("image_width", -1);
+    image_size.height = meta.value("image_height", -1);
+
+    auto view = std::views::iota(std::size_t{0}, file->numRecords()) |
+                std::views::transform([file](std::size_t i) {
+                    return std::make_tuple(TimeFrameIndex(file->times()[i]), EntityId(0), MappedRecord<TData>{file, i});
+                });
+    return RaggedTimeSeries<TData>::template createFromView<Series>(std::move(view), nullptr, image_size);
+}
+
+/**
+ * @brief Check that the file holds @p kind with the expected payload layout
+ * @return Empty string if it matches, otherwise the reason it does not
+ */
+std::string checkLayout(NativeChunkedReader const & file,
+                        RecordKind kind,
+                        PayloadType payload_type,
+                        bool ragged) {
+    if (file.kind() != kind) {
+        return "file holds record kind " + std::to_string(static_cast<int>(file.kind())) +
+               ", expected " + std::to_string(static_cast<int>(kind));
+    }
+    if (file.payloadType() != payload_type) {
+        return "unexpected payload type";
+    }
+    if (ragged != !file.extents().empty()) {
+        return "unexpected extents column";
+    }
+    if (kind != RecordKind::Tensor && !file.timesSorted()) {
+        return "series records are not sorted by time";
+    }
+    return {};
+}
+
+// ============================================================================
+// Loading
+// ============================================================================
+
+template<typename Series, typename TData>
+LoadResult loadRagged(std::shared_ptr<NativeChunkedReader const> file, RecordKind kind) {
+    bool const ragged = kind != RecordKind::Points;
+    auto const payload_type = kind == RecordKind::Masks ? PayloadType::UInt32 : PayloadType::Float32;
+    if (auto const error = checkLayout(*file, kind, payload_type, ragged); !error.empty()) {
+        return LoadResult("Native load failed: " + error);
+    }
+    if (file->payloadComponents() != 2 ||
+        (!ragged && file->payload<float>().size() != file->numRecords() * 2)) {
+        return LoadResult("Native load failed: payload does not hold one (x, y) pair per point");
+    }
+    return LoadResult(mapRaggedSeries<Series, TData>(std::move(file)));
+}
+
+LoadResult loadDigitalEvent(NativeChunkedReader const & file) {
+    if (auto const error = checkLayout(file, RecordKind::DigitalEvent, PayloadType::None, false); !error.empty()) {
+        return LoadResult("Native load failed: " + error);
+    }
+    auto const times = file.times();
+    std::vector<TimeFrameIndex> events;
+    events.reserve(times.size());
+    for (auto const t: times) {
+        events.emplace_back(t);
+    }
+    return LoadResult(std::make_shared<DigitalEventSeries>(std::move(events)));
+}
+
+LoadResult loadDigitalInterval(NativeChunkedReader const & file) {
+    if (auto const error = checkLayout(file, RecordKind::DigitalInterval, PayloadType::None, false); !error.empty()) {
+        return LoadResult("Native load failed: " + error);
+    }
+    auto const starts = file.times();
+    auto const ends = file.ends();
+    if (ends.size() != starts.size()) {
+        return LoadResult("Native load failed: interval file has no ends column");
+    }
+    std::vector<TimeFrameInterval> intervals;
+    intervals.reserve(starts.size());
+    for (std::size_t i = 0; i < starts.size(); ++i) {
+        intervals.push_back({TimeFrameIndex{starts[i]}, TimeFrameIndex{ends[i]}});
+    }
+    return LoadResult(std::make_shared<DigitalIntervalSeries>(std::move(intervals)));
+}
+
+LoadResult loadTensor(std::shared_ptr<NativeChunkedReader const> file) {
+    if (auto const error = checkLayout(*file, RecordKind::Tensor, PayloadType::Float32, false); !error.empty()) {
+        return LoadResult("Native load failed: " + error);
+    }
+    auto const num_rows = file->numRecords();
+    auto const num_cols = static_cast<std::size_t>(file->payloadComponents());
+    auto const & meta = file->metadata();
+    auto column_names = meta.value("column_names", std::vector<std::string>{});
+    auto const row_type = meta.value("row_type", std::string{"ordinal"});
+
+    auto const values = file->payload<float>();
+    auto const times = file->times();
+    TensorStorageWrapper storage(MappedTensorStorage(file, values, num_rows, num_cols));
+
+    if (row_type == "time") {
+        std::vector<TimeFrameIndex> time_indices;
+        time_indices.reserve(num_rows);
+        for (auto const t: times) {
+            time_indices.emplace_back(t);
+        }
+        auto time_storage = TimeIndexStorageFactory::createFromTimeIndices(std::move(time_indices));
+        return LoadResult(std::make_shared<TensorData>(TensorData::createTimeSeries2DFromStorage(
+                std::move(storage), std::move(time_storage), nullptr, std::move(column_names))));
+    }
+    if (row_type == "interval") {
+        auto const ends = file->ends();
+        if (ends.size() != num_rows) {
+            return LoadResult("Native load failed: interval tensor has no ends column");
+        }
+        std::vector<TimeFrameInterval> intervals;
+        intervals.reserve(num_rows);
+        for (std::size_t i = 0; i < num_rows; ++i) {
+            intervals.push_back({TimeFrameIndex{times[i]}, TimeFrameIndex{ends[i]}});
+        }
+        return LoadResult(std::make_shared<TensorData>(TensorData::createFromIntervalsFromStorage(
+                std::move(storage), std::move(intervals), nullptr, std::move(column_names))));
+    }
+    return LoadResult(std::make_shared<TensorData>(TensorData::createOrdinal2DFromStorage(
+            std::move(storage), nullptr, std::move(column_names))));
+}
+
+// ============================================================================
+// Saving
+// ============================================================================
+
+template<typename T>
+std::span<std::byte const> asBytes(std::vector<T> const & values) {
+    return std::as_bytes(std::span<T const>{values});
+}
+
+/**
+ * @brief Storage order of a ragged series' entries, stably sorted by time
+ */
+template<typename TData>
+std::vector<std::size_t> timeOrder(RaggedTimeSeries<TData> const & series) {
+    auto const elements = series.elementsView();
+    std::vector<std::size_t> order(std::ranges::size(elements));
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::ranges::stable_sort(order, {}, [&elements](std::size_t i) { return elements[i].time().getValue(); });
+    return order;
+}
+
+template<typename TData>
+bool writeRagged(std::ostream & out,
+                 RaggedTimeSeries<TData> const & series,
+                 RecordKind kind,
+                 std::uint64_t chunk_records) {
+    using Coord = std::conditional_t<std::is_same_v<TData, Mask2D>, std::uint32_t, float>;
+    constexpr bool ragged = !std::is_same_v<TData, Point2D<float>>;
+
+    auto const elements = series.elementsView();
+    auto const order = timeOrder(series);
+
+    std::vector<std::int64_t> times;
+    std::vector<std::uint64_t> extents;
+    std::vector<Coord> payload;
+    times.reserve(order.size());
+    if constexpr (ragged) {
+        extents.reserve(order.size() + 1);
+        extents.push_back(0);
+    } else {
+        payload.reserve(order.size() * 2);
+    }
+
+    for (auto const i: order) {
+        auto const element = elements[i];
+        times.push_back(element.time().getValue());
+        if constexpr (ragged) {
+            for (auto const & p: element.data()) {
+                payload.push_back(p.x);
+                payload.push_back(p.y);
+            }
+            extents.push_back(payload.size() / 2);
+        } else {
+            payload.push_back(element.data().x);
+            payload.push_back(element.data().y);
+        }
+    }
+
+    NativeColumns columns;
+    columns.kind = kind;
+    columns.payload_type = std::is_same_v<Coord, float> ? PayloadType::Float32 : PayloadType::UInt32;
+    columns.payload_components = 2;
+    columns.times = times;
+    columns.extents = extents;
+    columns.payload = asBytes(payload);
+    columns.payload_elements = payload.size() / 2;
+    columns.chunk_records = chunk_records;
+    auto const image_size = series.getImageSize();
+    columns.metadata["image_width"] = image_size.width;
+    columns.metadata["image_height"] = image_size.height;
+    return NativeFormat::writeNativeChunked(out, columns);
+}
+
+bool writeDigitalEvent(std::ostream & out, DigitalEventSeries const & series, std::uint64_t chunk_records) {
+    std::vector<std::int64_t> times(series.size());
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        times[i] = series.getStoredEvent(i).getValue();
+    }
+    std::ranges::sort(times);
+
+    NativeColumns columns;
+    columns.kind = RecordKind::DigitalEvent;
+    columns.times = times;
+    columns.chunk_records = chunk_records;
+    return NativeFormat::writeNativeChunked(out, columns);
+}
+
+bool writeDigitalInterval(std::ostream & out, DigitalIntervalSeries const & series, std::uint64_t chunk_records) {
+    std::vector<TimeFrameInterval> intervals;
+    intervals.reserve(series.size());
+    for (std::size_t i = 0; i < series.size(); ++i) {
+        intervals.push_back(series.getStoredInterval(i));
+    }
+    std::ranges::stable_sort(intervals, {}, [](TimeFrameInterval const & iv) { return iv.start.getValue(); });
+
+    std::vector<std::int64_t> starts;
+    std::vector<std::int64_t> ends;
+    starts.reserve(intervals.size());
+    ends.reserve(intervals.size());
+    for (auto const & iv: intervals) {
+        starts.push_back(iv.start.getValue());
+        ends.push_back(iv.end.getValue());
+    }
+
+    NativeColumns columns;
+    columns.kind = RecordKind::DigitalInterval;
+    columns.times = starts;
+    columns.ends = ends;
+    columns.chunk_records = chunk_records;
+    return NativeFormat::writeNativeChunked(out, columns);
+}
+
+bool writeTensor(std::ostream & out, TensorData const & tensor, std::uint64_t chunk_records) {
+    auto const shape = tensor.shape();
+    auto const num_rows = shape[0];
+    auto const num_cols = shape[1];
+    auto const values = tensor.materializeFlat();
+
+    std::vector<std::int64_t> times(num_rows);
+    std::vector<std::int64_t> ends;
+    auto const & rows = tensor.rows();
+    NativeColumns columns;
+
+    switch (rows.type()) {
+        case RowType::Ordinal:
+            std::iota(times.begin(), times.end(), std::int64_t{0});
+            columns.metadata["row_type"] = "ordinal";
+            break;
+        case RowType::TimeFrameIndex: {
+            auto const & storage = rows.timeStorage();
+            for (std::size_t i = 0; i < num_rows; ++i) {
+                times[i] = storage.getTimeFrameIndexAt(i).getValue();
+            }
+            columns.metadata["row_type"] = "time";
+            break;
+        }
+        case RowType::Interval: {
+            auto const intervals = rows.intervals();
+            ends.resize(num_rows);
+            for (std::size_t i = 0; i < num_rows; ++i) {
+                times[i] = intervals[i].start.getValue();
+                ends[i] = intervals[i].end.getValue();
+            }
+            columns.metadata["row_type"] = "interval";
+            break;
+        }
+    }
+    if (tensor.hasNamedColumns()) {
+        columns.metadata["column_names"] = tensor.columnNames();
+    }
+
+    columns.kind = RecordKind::Tensor;
+    columns.payload_type = PayloadType::Float32;
+    columns.payload_components = static_cast<std::uint32_t>(num_cols);
+    columns.times = times;
+    columns.ends = ends;
+    columns.payload = asBytes(values);
+    columns.payload_elements = num_rows;
+    columns.chunk_records = chunk_records;
+    return NativeFormat::writeNativeChunked(out, columns);
+}
+
+}// namespace
+
+// ============================================================================
+// IFormatLoader
+// ============================================================================
+
+LoadResult NativeFormatLoader::load(std::string const & filepath,
+                                    DM_DataType dataType,
+                                    nlohmann::json const & /*config*/) const {
+    try {
+        auto file = NativeChunkedReader::open(filepath);
+
+        switch (dataType) {
+            case DM_DataType::Points:
+                return loadRagged<PointData, Point2D<float>>(std::move(file), RecordKind::Points);
+            case DM_DataType::Line:
+                return loadRagged<LineData, Line2D>(std::move(file), RecordKind::Lines);
+            case DM_DataType::Mask:
+                return loadRagged<MaskData, Mask2D>(std::move(file), RecordKind::Masks);
+            case DM_DataType::DigitalEvent:
+                return loadDigitalEvent(*file);
+            case DM_DataType::DigitalInterval:
+                return loadDigitalInterval(*file);
+            case DM_DataType::Tensor:
+                return loadTensor(std::move(file));
+            default:
+                return LoadResult("NativeFormatLoader does not support data type: " +
+                                  std::to_string(static_cast<int>(dataType)));
+        }
+    } catch (std::exception const & e) {
+        return LoadResult("Native load failed: " + std::string(e.what()));
+    }
+}
+
+LoadResult NativeFormatLoader::save(std::string const & filepath,
+                                    DM_DataType dataType,
+                                    nlohmann::json const & config,
+                                    void const * data) const {
+    if (!data) {
+        return LoadResult("Data pointer is null");
+    }
+
+    try {
+        std::filesystem::path target_path(filepath);
+        if (config.contains("parent_dir") || config.contains("filename")) {
+            target_path = std::filesystem::path(config.value("parent_dir", target_path.parent_path().string())) /
+                          config.value("filename", target_path.filename().string());
+        }
+        auto const chunk_records = static_cast<std::uint64_t>(
+                std::max(config.value("chunk_records", static_cast<int>(NativeFormat::default_chunk_records)), 1));
+
+        std::function<bool(std::ostream &)> writer;
+        switch (dataType) {
+            case DM_DataType::Points:
+                writer = [&](std::ostream & out) {
+                    return writeRagged(out, *static_cast<PointData const *>(data), RecordKind::Points, chunk_records);
+                };
+                break;
+            case DM_DataType::Line:
+                writer = [&](std::ostream & out) {
+                    return writeRagged(out, *static_cast<LineData const *>(data), RecordKind::Lines, chunk_records);
+                };
+                break;
+            case DM_DataType::Mask:
+                writer = [&](std::ostream & out) {
+                    return writeRagged(out, *static_cast<MaskData const *>(data), RecordKind::Masks, chunk_records);
+                };
+                break;
+            case DM_DataType::DigitalEvent: {
+                auto const * series = static_cast<DigitalEventSeries const *>(data);
+                if (series->storesRelativeTimes()) {
+                    return LoadResult("Native save failed: relative-time event series are not supported");
+                }
+                writer = [&](std::ostream & out) { return writeDigitalEvent(out, *series, chunk_records); };
+                break;
+            }
+            case DM_DataType::DigitalInterval:
+                writer = [&](std::ostream & out) {
+                    return writeDigitalInterval(out, *static_cast<DigitalIntervalSeries const *>(data), chunk_records);
+                };
+                break;
+            case DM_DataType::Tensor: {
+                auto const * tensor = static_cast<TensorData const *>(data);
+                if (tensor->ndim() != 2) {
+                    return LoadResult("Native save failed: only 2D tensors are supported");
+                }
+                writer = [&](std::ostream & out) { return writeTensor(out, *tensor, chunk_records); };
+                break;
+            }
+            default:
+                return LoadResult("NativeFormatLoader does not support saving data type: " +
+                                  std::to_string(static_cast<int>(dataType)));
+        }
+
+        if (!atomicWriteFile(target_path, writer)) {
+            return LoadResult("Native save failed: I/O error writing " + target_path.string());
+        }
+
+        LoadResult result;
+        result.success = true;
+        return result;
+
+    } catch (std::exception const & e) {
+        return LoadResult("Native save failed: " + std::string(e.what()));
+    }
+}
+
+bool NativeFormatLoader::supportsFormat(std::string const & format, DM_DataType dataType) const {
+    if (format != kNativeFormat) {
+        return false;
+    }
+    return dataType == DM_DataType::Points ||
+           dataType == DM_DataType::Line ||
+           dataType == DM_DataType::Mask ||
+           dataType == DM_DataType::DigitalEvent ||
+           dataType == DM_DataType::DigitalInterval ||
+           dataType == DM_DataType::Tensor;
+}
+
+std::string NativeFormatLoader::getLoaderName() const {
+    return "NativeFormatLoader (Points/Line/Mask/DigitalEvent/DigitalInterval/Tensor)";
+}
+
+std::vector<SaverInfo> NativeFormatLoader::getSaverInfo() const {
+    auto const schema = extractParameterSchema<NativeSaverOptions>();
+    return {
+            {kNativeFormat, DM_DataType::Points, "Native chunked point data (memory-mapped on load)", schema},
+            {kNativeFormat, DM_DataType::Line, "Native chunked line data (memory-mapped on load)", schema},
+            {kNativeFormat, DM_DataType::Mask, "Native chunked mask data (memory-mapped on load)", schema},
+            {kNativeFormat, DM_DataType::DigitalEvent, "Native chunked digital events", schema},
+            {kNativeFormat, DM_DataType::DigitalInterval, "Native chunked digital intervals", schema},
+            {kNativeFormat, DM_DataType::Tensor, "Native chunked 2D tensor (memory-mapped on load)", schema},
+    };
+}
+
+std::vector<LoaderInfo> NativeFormatLoader::getLoaderInfo() const {
+    auto const schema = extractParameterSchema<NativeLoaderOptions>();
+    return {
+            {kNativeFormat, DM_DataType::Points, "Native chunked point data", false, schema},
+            {kNativeFormat, DM_DataType::Line, "Native chunked line data", false, schema},
+            {kNativeFormat, DM_DataType::Mask, "Native chunked mask data", false, schema},
+            {kNativeFormat, DM_DataType::DigitalEvent, "Native chunked digital events", false, schema},
+            {kNativeFormat, DM_DataType::DigitalInterval, "Native chunked digital intervals", false, schema},
+            {kNativeFormat, DM_DataType::Tensor, "Native chunked 2D tensor", false, schema},
+    };
+}
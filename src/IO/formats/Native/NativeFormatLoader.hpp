@@ -0,0 +1,59 @@
+#ifndef NATIVE_FORMAT_LOADER_HPP
+#define NATIVE_FORMAT_LOADER_HPP
+
+#include "datamanagerio_export.h"
+
+#include "../../core/IFormatLoader.hpp"
+
+/**
+ * @brief Loader and saver for the native chunked session format ("native")
+ *
+ * Each data object is stored in its own file as time-sorted columns with a
+ * per-chunk time index (see NativeChunkedFile.hpp). Loading memory-maps the
+ * file instead of parsing it:
+ *
+ * - DM_DataType::Points, Line, Mask: lazy storage that decodes a record from
+ *   the mapping when it is accessed
+ * - DM_DataType::Tensor: MappedTensorStorage viewing the mapped float rows
+ * - DM_DataType::DigitalEvent, DigitalInterval: one bulk copy of the mapped
+ *   time columns (these series need owning storage for their range queries)
+ *
+ * Saving writes through atomicWriteFile().
+ */
+class DATAMANAGERIO_EXPORT NativeFormatLoader : public IFormatLoader {
+public:
+    NativeFormatLoader() = default;
+    ~NativeFormatLoader() override = default;
+
+    /**
+     * @brief Map a native file and wrap it as the requested data type
+     */
+    LoadResult load(std::string const & filepath,
+                    DM_DataType dataType,
+                    nlohmann::json const & config) const override;
+
+    /**
+     * @brief Save a data object to a native file
+     *
+     * Honors "parent_dir", "filename" and "chunk_records" in @p config;
+     * otherwise @p filepath is used as-is.
+     */
+    LoadResult save(std::string const & filepath,
+                    DM_DataType dataType,
+                    nlohmann::json const & config,
+                    void const * data) const override;
+
+    /**
+     * @brief Supports format "native" for Points, Line, Mask, DigitalEvent,
+     *        DigitalInterval and Tensor
+     */
+    bool supportsFormat(std::string const & format, DM_DataType dataType) const override;
+
+    std::string getLoaderName() const override;
+
+    std::vector<SaverInfo> getSaverInfo() const override;
+
+    std::vector<LoaderInfo> getLoaderInfo() const override;
+};
+
+#endif// NATIVE_FORMAT_LOADER_HPP
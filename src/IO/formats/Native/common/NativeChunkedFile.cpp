@@ -0,0 +1,370 @@
+/**
+ * @file NativeChunkedFile.cpp
+ * @brief Writer and memory-mapped reader for the native chunked container.
+ */
+
+#include "NativeChunkedFile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(std::endian::native == std::endian::little,
+              "Native chunked files are little-endian and read in place");
+
+namespace NativeFormat {
+
+namespace {
+
+constexpr std::uint64_t section_alignment = 8;
+
+[[nodiscard]] constexpr std::uint64_t alignUp(std::uint64_t value) {
+    return (value + section_alignment - 1) / section_alignment * section_alignment;
+}
+
+[[nodiscard]] constexpr std::uint64_t scalarSize(PayloadType type) {
+    switch (type) {
+        case PayloadType::Float32:
+            return sizeof(float);
+        case PayloadType::UInt32:
+            return sizeof(std::uint32_t);
+        case PayloadType::None:
+            break;
+    }
+    return 0;
+}
+
+/**
+ * @brief Byte offsets of every section, derived from the header alone
+ */
+struct SectionLayout {
+    std::uint64_t metadata = 0;
+    std::uint64_t chunks = 0;
+    std::uint64_t times = 0;
+    std::uint64_t ends = 0;
+    std::uint64_t extents = 0;
+    std::uint64_t payload = 0;
+    std::uint64_t file_size = 0;
+};
+
+[[nodiscard]] SectionLayout layoutFor(NativeHeader const & header) {
+    SectionLayout layout;
+    std::uint64_t offset = sizeof(NativeHeader);
+    layout.metadata = offset;
+    offset = alignUp(offset + header.metadata_size);
+    layout.chunks = offset;
+    offset += header.num_chunks * sizeof(NativeChunkEntry);
+    layout.times = offset;
+    offset += header.num_records * sizeof(std::int64_t);
+    layout.ends = offset;
+    if ((header.flags & HasEnds) != 0U) {
+        offset += header.num_records * sizeof(std::int64_t);
+    }
+    layout.extents = offset;
+    if ((header.flags & HasExtents) != 0U) {
+        offset += (header.num_records + 1) * sizeof(std::uint64_t);
+    }
+    layout.payload = offset;
+    offset += alignUp(header.payload_elements * header.payload_components *
+                      scalarSize(static_cast<PayloadType>(header.payload_type)));
+    layout.file_size = offset;
+    return layout;
+}
+
+template<typename T>
+void writeRaw(std::ostream & out, std::span<T const> values) {
+    if (!values.empty()) {
+        out.write(reinterpret_cast<char const *>(values.data()),// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                  static_cast<std::streamsize>(values.size_bytes()));
+    }
+}
+
+void writePadding(std::ostream & out, std::uint64_t written) {
+    static constexpr std::array<char, section_alignment> zeros{};
+    auto const padding = alignUp(written) - written;
+    out.write(zeros.data(), static_cast<std::streamsize>(padding));
+}
+
+}// namespace
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+bool writeNativeChunked(std::ostream & out, NativeColumns const & columns) {
+    auto const num_records = static_cast<std::uint64_t>(columns.times.size());
+
+    if (!columns.ends.empty() && columns.ends.size() != columns.times.size()) {
+        return false;
+    }
+    if (!columns.extents.empty()) {
+        if (columns.extents.size() != num_records + 1 ||
+            columns.extents.front() != 0 ||
+            columns.extents.back() != columns.payload_elements ||
+            !std::ranges::is_sorted(columns.extents)) {
+            return false;
+        }
+    }
+    auto const expected_payload_bytes =
+            columns.payload_elements * columns.payload_components * scalarSize(columns.payload_type);
+    if (columns.payload.size() != expected_payload_bytes) {
+        return false;
+    }
+
+    std::uint64_t const chunk_records = std::max<std::uint64_t>(columns.chunk_records, 1);
+    std::vector<NativeChunkEntry> chunk_table;
+    chunk_table.reserve(static_cast<std::size_t>((num_records + chunk_records - 1) / chunk_records));
+    for (std::uint64_t first = 0; first < num_records; first += chunk_records) {
+        auto const count = std::min(chunk_records, num_records - first);
+        auto const [min_it, max_it] = std::ranges::minmax_element(columns.times.subspan(first, count));
+        chunk_table.push_back({*min_it, *max_it, first, count});
+    }
+
+    std::string const metadata = columns.metadata.dump();
+
+    NativeHeader header{};
+    std::memcpy(header.magic, native_magic, sizeof(native_magic));
+    header.version = native_version;
+    header.kind = static_cast<std::uint32_t>(columns.kind);
+    header.flags = (columns.ends.empty() ? 0U : HasEnds) |
+                   (columns.extents.empty() ? 0U : HasExtents) |
+                   (std::ranges::is_sorted(columns.times) ? TimesSorted : 0U);
+    header.payload_type = static_cast<std::uint32_t>(columns.payload_type);
+    header.payload_components = columns.payload_components;
+    header.num_records = num_records;
+    header.num_chunks = chunk_table.size();
+    header.payload_elements = columns.payload_elements;
+    header.metadata_size = metadata.size();
+
+    out.write(reinterpret_cast<char const *>(&header), sizeof(header));// NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    out.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+    writePadding(out, sizeof(header) + metadata.size());
+    writeRaw(out, std::span<NativeChunkEntry const>{chunk_table});
+    writeRaw(out, columns.times);
+    writeRaw(out, columns.ends);
+    writeRaw(out, columns.extents);
+    writeRaw(out, columns.payload);
+    writePadding(out, columns.payload.size());
+
+    return static_cast<bool>(out);
+}
+
+// ============================================================================
+// Memory mapping (platform-specific)
+// ============================================================================
+
+#ifdef _WIN32
+struct NativeChunkedReader::Mapping {
+    HANDLE file_handle = INVALID_HANDLE_VALUE;
+    HANDLE map_handle = NULL;
+    void * mapped_data = nullptr;
+    std::size_t mapped_size = 0;
+
+    explicit Mapping(std::filesystem::path const & path) {
+        file_handle = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                  NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file_handle == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("NativeChunkedReader: failed to open file: " + path.string());
+        }
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file_handle, &size) || size.QuadPart <= 0) {
+            CloseHandle(file_handle);
+            throw std::runtime_error("NativeChunkedReader: failed to stat file: " + path.string());
+        }
+        mapped_size = static_cast<std::size_t>(size.QuadPart);
+        map_handle = CreateFileMappingW(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (map_handle == NULL) {
+            CloseHandle(file_handle);
+            throw std::runtime_error("NativeChunkedReader: failed to create file mapping: " + path.string());
+        }
+        mapped_data = MapViewOfFile(map_handle, FILE_MAP_READ, 0, 0, 0);
+        if (mapped_data == nullptr) {
+            CloseHandle(map_handle);
+            CloseHandle(file_handle);
+            throw std::runtime_error("NativeChunkedReader: failed to map view: " + path.string());
+        }
+    }
+
+    ~Mapping() {
+        UnmapViewOfFile(mapped_data);
+        CloseHandle(map_handle);
+        CloseHandle(file_handle);
+    }
+
+    Mapping(Mapping const &) = delete;
+    Mapping & operator=(Mapping const &) = delete;
+};
+#else
+struct NativeChunkedReader::Mapping {
+    int file_descriptor = -1;
+    void * mapped_data = nullptr;
+    std::size_t mapped_size = 0;
+
+    explicit Mapping(std::filesystem::path const & path) {
+        file_descriptor = ::open(path.c_str(), O_RDONLY);
+        if (file_descriptor == -1) {
+            throw std::runtime_error("NativeChunkedReader: failed to open file: " + path.string());
+        }
+        struct stat sb {};
+        if (fstat(file_descriptor, &sb) == -1 || sb.st_size <= 0) {
+            close(file_descriptor);
+            throw std::runtime_error("NativeChunkedReader: failed to stat file: " + path.string());
+        }
+        mapped_size = static_cast<std::size_t>(sb.st_size);
+        mapped_data = mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        if (mapped_data == MAP_FAILED) {
+            close(file_descriptor);
+            throw std::runtime_error("NativeChunkedReader: failed to mmap file: " + path.string());
+        }
+    }
+
+    ~Mapping() {
+        munmap(mapped_data, mapped_size);
+        close(file_descriptor);
+    }
+
+    Mapping(Mapping const &) = delete;
+    Mapping & operator=(Mapping const &) = delete;
+};
+#endif
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+NativeChunkedReader::~NativeChunkedReader() = default;
+
+std::shared_ptr<NativeChunkedReader const> NativeChunkedReader::open(std::filesystem::path const & path) {
+    std::shared_ptr<NativeChunkedReader> reader(new NativeChunkedReader());
+    reader->_parse(path);
+    return reader;
+}
+
+void NativeChunkedReader::_parse(std::filesystem::path const & path) {
+    _mapping = std::make_unique<Mapping>(path);
+    auto const * base = static_cast<std::byte const *>(_mapping->mapped_data);
+    auto const file_size = static_cast<std::uint64_t>(_mapping->mapped_size);
+
+    auto fail = [&path](std::string const & reason) {
+        throw std::runtime_error("NativeChunkedReader: " + reason + ": " + path.string());
+    };
+
+    if (file_size < sizeof(NativeHeader)) {
+        fail("file too small for header");
+    }
+    std::memcpy(&_header, base, sizeof(NativeHeader));
+    if (std::memcmp(_header.magic, native_magic, sizeof(native_magic)) != 0) {
+        fail("not a native file");
+    }
+    if (_header.version != native_version) {
+        fail("unsupported version " + std::to_string(_header.version));
+    }
+    if (_header.payload_type > static_cast<std::uint32_t>(PayloadType::UInt32)) {
+        fail("unknown payload type");
+    }
+
+    // Bound every count before multiplying so a corrupt header cannot overflow the layout
+    auto const max_count = file_size / sizeof(std::uint32_t);
+    if (_header.num_records > max_count || _header.num_chunks > max_count ||
+        _header.payload_elements > max_count || _header.metadata_size > file_size ||
+        (_header.payload_components != 0 && _header.payload_elements > max_count / _header.payload_components)) {
+        fail("corrupt header");
+    }
+    auto const layout = layoutFor(_header);
+    if (layout.file_size > file_size) {
+        fail("truncated file");
+    }
+
+    // Element pointers into the mapping; every section is 8-byte aligned by construction
+    auto const at = [base](std::uint64_t offset) { return static_cast<void const *>(base + offset); };
+
+    _metadata = nlohmann::json::parse(static_cast<char const *>(at(layout.metadata)),
+                                      static_cast<char const *>(at(layout.metadata)) + _header.metadata_size,
+                                      nullptr, false);
+    if (_metadata.is_discarded()) {
+        fail("invalid metadata");
+    }
+
+    auto const num_records = static_cast<std::size_t>(_header.num_records);
+    _chunks = {static_cast<NativeChunkEntry const *>(at(layout.chunks)), static_cast<std::size_t>(_header.num_chunks)};
+    _times = {static_cast<std::int64_t const *>(at(layout.times)), num_records};
+    if ((_header.flags & HasEnds) != 0U) {
+        _ends = {static_cast<std::int64_t const *>(at(layout.ends)), num_records};
+    }
+    if ((_header.flags & HasExtents) != 0U) {
+        _extents = {static_cast<std::uint64_t const *>(at(layout.extents)), num_records + 1};
+    }
+    _payload = at(layout.payload);
+    _payload_scalars = static_cast<std::size_t>(_header.payload_elements * _header.payload_components);
+
+    // Validate every chunk and extent, not just the ends, so recordRange() and
+    // payload reads stay inside the mapping even for a corrupt middle entry
+    std::uint64_t expected_first = 0;
+    for (auto const & chunk: _chunks) {
+        if (chunk.first_record != expected_first || chunk.record_count == 0 ||
+            chunk.record_count > _header.num_records - expected_first || chunk.min_time > chunk.max_time) {
+            fail("corrupt chunk table");
+        }
+        // recordRange() searches chunks by their bounds, so they must match the sorted times
+        if (timesSorted() && (chunk.min_time != _times[chunk.first_record] ||
+                              chunk.max_time != _times[chunk.first_record + chunk.record_count - 1])) {
+            fail("chunk bounds do not match times");
+        }
+        expected_first += chunk.record_count;
+    }
+    if (expected_first != _header.num_records) {
+        fail("chunk table does not cover all records");
+    }
+    if (!_extents.empty()) {
+        if (_extents.front() != 0 || _extents.back() != _header.payload_elements ||
+            !std::ranges::is_sorted(_extents)) {
+            fail("corrupt extents");
+        }
+    }
+}
+
+std::pair<std::size_t, std::size_t> NativeChunkedReader::recordRange(std::int64_t start, std::int64_t end) const {
+    if (start > end || _chunks.empty() || !timesSorted()) {
+        return {0, 0};
+    }
+    auto const first_chunk = std::ranges::partition_point(
+            _chunks, [start](NativeChunkEntry const & c) { return c.max_time < start; });
+    auto const last_chunk = std::ranges::partition_point(
+            _chunks, [end](NativeChunkEntry const & c) { return c.min_time <= end; });
+    if (first_chunk >= last_chunk) {
+        return {0, 0};
+    }
+
+    auto const lo_begin = _times.begin() + static_cast<std::ptrdiff_t>(first_chunk->first_record);
+    auto const lo_end = lo_begin + static_cast<std::ptrdiff_t>(first_chunk->record_count);
+    auto const lo = std::lower_bound(lo_begin, lo_end, start);
+
+    auto const & back = *(last_chunk - 1);
+    auto const hi_begin = _times.begin() + static_cast<std::ptrdiff_t>(back.first_record);
+    auto const hi_end = hi_begin + static_cast<std::ptrdiff_t>(back.record_count);
+    auto const hi = std::upper_bound(hi_begin, hi_end, end);
+
+    return {static_cast<std::size_t>(lo - _times.begin()), static_cast<std::size_t>(hi - _times.begin())};
+}
+
+}// namespace NativeFormat
@@ -0,0 +1,233 @@
+/**
+ * @file NativeChunkedFile.hpp
+ * @brief Chunked, columnar, memory-mappable container used by the native session format.
+ *
+ * A native file stores one data object as fixed-width columns that can be read
+ * in place from a read-only memory mapping:
+ *
+ * | Section      | Type                        | Present when                   |
+ * |--------------|-----------------------------|--------------------------------|
+ * | header       | 64 bytes                    | always                         |
+ * | metadata     | UTF-8 JSON, padded to 8     | always (may be `{}`)           |
+ * | chunk table  | NativeChunkEntry[num_chunks]| always                         |
+ * | times        | int64[num_records]          | always                         |
+ * | ends         | int64[num_records]          | `NativeFlags::HasEnds`         |
+ * | extents      | uint64[num_records + 1]     | `NativeFlags::HasExtents`      |
+ * | payload      | scalar[payload_elements * components] | `payload_type != None` |
+ *
+ * Every section starts on an 8-byte boundary, so the columns can be viewed as
+ * typed spans directly over the mapping. The chunk table holds the time bounds
+ * of each run of `chunk_records` records. When the times column is sorted
+ * (`NativeFlags::TimesSorted`, always the case for series) a time range can be
+ * located without touching the times column of unrelated chunks.
+ *
+ * Ragged records (lines, masks) use the extents column: record `i` owns payload
+ * elements `[extents[i], extents[i + 1])`.
+ *
+ * All integers are little-endian.
+ */
+#ifndef NATIVE_CHUNKED_FILE_HPP
+#define NATIVE_CHUNKED_FILE_HPP
+
+#include "datamanagerio_export.h"
+
+#include "nlohmann/json.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace NativeFormat {
+
+/// File magic, first 8 bytes of every native file
+inline constexpr char native_magic[8] = {'W', 'T', 'N', 'A', 'T', 'I', 'V', '1'};
+
+/// Current layout version
+inline constexpr std::uint32_t native_version = 1;
+
+/// Records per chunk used when the caller does not choose one
+inline constexpr std::uint64_t default_chunk_records = 65536;
+
+/**
+ * @brief Which data object a native file holds
+ */
+enum class RecordKind : std::uint32_t {
+    Points = 1,         ///< One Point2D<float> per record
+    Lines = 2,          ///< Ragged Point2D<float> per record
+    Masks = 3,          ///< Ragged Point2D<uint32_t> per record
+    DigitalEvent = 4,   ///< Times only
+    DigitalInterval = 5,///< Times are interval starts, ends column holds interval ends
+    Tensor = 6,         ///< One row of `components` floats per record
+};
+
+/**
+ * @brief Scalar type of the payload column
+ */
+enum class PayloadType : std::uint32_t {
+    None = 0,
+    Float32 = 1,
+    UInt32 = 2,
+};
+
+/**
+ * @brief Optional-column bit flags stored in the header
+ */
+enum NativeFlags : std::uint32_t {
+    HasEnds = 1U << 0U,
+    HasExtents = 1U << 1U,
+    TimesSorted = 1U << 2U,
+};
+
+/**
+ * @brief On-disk header (64 bytes)
+ */
+struct NativeHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t kind;
+    std::uint32_t flags;
+    std::uint32_t payload_type;
+    std::uint32_t payload_components;
+    std::uint32_t reserved;
+    std::uint64_t num_records;
+    std::uint64_t num_chunks;
+    std::uint64_t payload_elements;
+    std::uint64_t metadata_size;
+};
+static_assert(sizeof(NativeHeader) == 64, "NativeHeader must be 64 bytes");
+
+/**
+ * @brief On-disk chunk table entry (32 bytes): time bounds of a run of records
+ */
+struct NativeChunkEntry {
+    std::int64_t min_time;
+    std::int64_t max_time;
+    std::uint64_t first_record;
+    std::uint64_t record_count;
+};
+static_assert(sizeof(NativeChunkEntry) == 32, "NativeChunkEntry must be 32 bytes");
+
+/**
+ * @brief Column data handed to writeNativeChunked()
+ *
+ * Spans are borrowed; they must stay valid for the duration of the call.
+ */
+struct NativeColumns {
+    RecordKind kind = RecordKind::Points;
+    PayloadType payload_type = PayloadType::None;
+    std::uint32_t payload_components = 0;
+
+    std::span<std::int64_t const> times;   ///< One per record
+    std::span<std::int64_t const> ends;    ///< Empty, or one per record
+    std::span<std::uint64_t const> extents;///< Empty, or num_records + 1 prefix offsets
+
+    /// Raw payload bytes (payload_elements * payload_components scalars)
+    std::span<std::byte const> payload;
+    std::uint64_t payload_elements = 0;
+
+    nlohmann::json metadata = nlohmann::json::object();
+
+    std::uint64_t chunk_records = default_chunk_records;
+};
+
+/**
+ * @brief Serialize columns into the native layout.
+ *
+ * @pre `columns.ends` is empty or `ends.size() == times.size()` (enforcement: runtime_check) [IMPORTANT]
+ * @pre `columns.extents` is empty or has `times.size() + 1` non-decreasing entries starting at 0
+ *      and ending at `payload_elements` (enforcement: runtime_check) [IMPORTANT]
+ * @pre `columns.payload.size() == payload_elements * payload_components * scalar size`
+ *      (enforcement: runtime_check) [IMPORTANT]
+ *
+ * @return false if a precondition fails or the stream goes bad.
+ */
+DATAMANAGERIO_EXPORT bool writeNativeChunked(std::ostream & out, NativeColumns const & columns);
+
+/**
+ * @brief Read-only view of a native file mapped into memory.
+ *
+ * Opening validates the header and section bounds but does not touch the
+ * column data, so the cost of opening is independent of file size; pages are
+ * read from disk when a column is first accessed. The mapping lives as long
+ * as the last shared_ptr to the reader, which is what lets lazily-evaluated
+ * data objects reference columns without copying them.
+ */
+class DATAMANAGERIO_EXPORT NativeChunkedReader {
+public:
+    /**
+     * @brief Map and validate a native file.
+     *
+     * @throws std::runtime_error if the file cannot be mapped or is not a valid native file.
+     */
+    [[nodiscard]] static std::shared_ptr<NativeChunkedReader const> open(std::filesystem::path const & path);
+
+    ~NativeChunkedReader();
+
+    NativeChunkedReader(NativeChunkedReader const &) = delete;
+    NativeChunkedReader & operator=(NativeChunkedReader const &) = delete;
+    NativeChunkedReader(NativeChunkedReader &&) = delete;
+    NativeChunkedReader & operator=(NativeChunkedReader &&) = delete;
+
+    [[nodiscard]] RecordKind kind() const noexcept { return static_cast<RecordKind>(_header.kind); }
+    [[nodiscard]] PayloadType payloadType() const noexcept { return static_cast<PayloadType>(_header.payload_type); }
+    [[nodiscard]] std::uint32_t payloadComponents() const noexcept { return _header.payload_components; }
+    [[nodiscard]] std::size_t numRecords() const noexcept { return static_cast<std::size_t>(_header.num_records); }
+    [[nodiscard]] nlohmann::json const & metadata() const noexcept { return _metadata; }
+    [[nodiscard]] bool timesSorted() const noexcept { return (_header.flags & TimesSorted) != 0U; }
+
+    [[nodiscard]] std::span<NativeChunkEntry const> chunks() const noexcept { return _chunks; }
+    [[nodiscard]] std::span<std::int64_t const> times() const noexcept { return _times; }
+
+    /// Empty unless the file has `NativeFlags::HasEnds`
+    [[nodiscard]] std::span<std::int64_t const> ends() const noexcept { return _ends; }
+
+    /// Empty unless the file has `NativeFlags::HasExtents`
+    [[nodiscard]] std::span<std::uint64_t const> extents() const noexcept { return _extents; }
+
+    /**
+     * @brief Payload column viewed as scalars of type T.
+     *
+     * @pre `T` matches payloadType() (float for Float32, uint32_t for UInt32)
+     *      (enforcement: none) [CRITICAL]
+     */
+    template<typename T>
+    [[nodiscard]] std::span<T const> payload() const noexcept {
+        return {static_cast<T const *>(_payload), _payload_scalars};
+    }
+
+    /**
+     * @brief Half-open record range whose times fall in [start, end].
+     *
+     * Uses the chunk table to skip chunks outside the range, then binary
+     * searches the times column inside the boundary chunks.
+     *
+     * An empty range (first == second) means no record matches.
+     *
+     * @pre timesSorted() (enforcement: runtime_check — returns {0, 0} otherwise) [IMPORTANT]
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t> recordRange(std::int64_t start, std::int64_t end) const;
+
+private:
+    struct Mapping;
+
+    NativeChunkedReader() = default;
+    void _parse(std::filesystem::path const & path);
+
+    std::unique_ptr<Mapping> _mapping;
+    NativeHeader _header{};
+    nlohmann::json _metadata;
+    std::span<NativeChunkEntry const> _chunks;
+    std::span<std::int64_t const> _times;
+    std::span<std::int64_t const> _ends;
+    std::span<std::uint64_t const> _extents;
+    void const * _payload{nullptr};
+    std::size_t _payload_scalars{0};
+};
+
+}// namespace NativeFormat
+
+#endif// NATIVE_CHUNKED_FILE_HPP
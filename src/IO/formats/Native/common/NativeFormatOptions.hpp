@@ -0,0 +1,64 @@
+/**
+ * @file NativeFormatOptions.hpp
+ * @brief Loader and saver options for the native chunked session format
+ */
+#ifndef NATIVE_FORMAT_OPTIONS_HPP
+#define NATIVE_FORMAT_OPTIONS_HPP
+
+#include "IO/core/LoaderOptionsConcepts.hpp"
+#include "ParameterSchema/ParameterSchema.hpp"
+
+#include <string>
+
+/**
+ * @brief Options for loading any data object from a native (.wtn) file
+ *
+ * The file header records which data type it holds; loading it as a
+ * different type fails.
+ */
+struct NativeLoaderOptions {
+    std::string filepath;
+};
+
+static_assert(Neuralyzer::ValidLoaderOptions<NativeLoaderOptions>,
+              "NativeLoaderOptions must satisfy ValidLoaderOptions");
+
+/**
+ * @brief Options for saving a data object to a native (.wtn) file
+ *
+ * The file is written through a temporary and renamed into place, so a
+ * session that still maps the previous version keeps reading consistent data.
+ */
+struct NativeSaverOptions {
+    std::string filename;
+    std::string parent_dir = ".";
+    int chunk_records = 65536;
+};
+
+template<>
+struct ParameterUIHints<NativeLoaderOptions> {
+    /// @brief Annotate schema fields for AutoParamWidget (import UI).
+    static void annotate(ParameterSchema & schema) {
+        if (auto * f = schema.field("filepath")) {
+            f->tooltip = "Path to a native (.wtn) file";
+        }
+    }
+};
+
+template<>
+struct ParameterUIHints<NativeSaverOptions> {
+    /// @brief Annotate schema fields for AutoParamWidget (export UI).
+    static void annotate(ParameterSchema & schema) {
+        if (auto * f = schema.field("filename")) {
+            f->tooltip = "Output .wtn filename (combined with parent_dir)";
+        }
+        if (auto * f = schema.field("parent_dir")) {
+            f->tooltip = "Directory in which to create the output file";
+        }
+        if (auto * f = schema.field("chunk_records")) {
+            f->tooltip = "Records per chunk in the time index; smaller chunks make range lookups touch fewer pages";
+        }
+    }
+};
+
+#endif// NATIVE_FORMAT_OPTIONS_HPP
@@ -5,6 +5,7 @@
 
 #include "LabelAssembler.hpp"
 
+#include "DataManager/utils/TimeJoin.hpp"
 #include "DigitalTimeSeries/Digital_Event_Series.hpp"
 #include "DigitalTimeSeries/Digital_Interval_Series.hpp"
 #include "Entity/EntityGroupManager.hpp"
@@ -12,10 +13,11 @@
 #include "Entity/EntityTypes.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
+#include <algorithm>
 #include <optional>
 #include <ranges>
 #include <stdexcept>
-#include <unordered_map>
+#include <utility>
 
 namespace MLCore {
 
@@ -43,29 +45,40 @@ std::vector<std::string> buildClassNames(
 }
 
 /**
- * @brief Build a mapping from time_value (int64_t) → class label (size_t)
+ * @brief Time values and their class labels, sorted by time
+ *
+ * Sorted parallel arrays rather than a hash map so that rows can be
+ * labelled with a single merge-join (see TimeJoin.hpp).
+ */
+struct TimeLabelTable {
+    std::vector<std::int64_t> times;
+    std::vector<std::size_t> labels;
+};
+
+/**
+ * @brief Build a sorted time_value (int64_t) → class label (size_t) table
  *
  * Iterates all entities in each class group, looks up their descriptors,
  * and maps time_value → label index. Only entities matching the given
  * data_key are included. An optional kind filter can further restrict matches.
  *
  * If an entity's time_value appears in multiple groups, the first group wins
- * (lower class index takes priority via try_emplace).
+ * (lower class index takes priority; the stable sort keeps group order).
  *
  * @param groups Entity group manager
  * @param registry Entity registry for descriptor lookup
  * @param class_groups Ordered vector of group IDs (index = class label)
  * @param match_key Key to match against EntityDescriptor::data_key
  * @param require_kind If set, only entities of this kind are included
- * @return Map from time_value → class label
+ * @return Table of unique time_values → class label, ascending by time
  */
-std::unordered_map<std::int64_t, std::size_t> buildTimeLabelMap(
+TimeLabelTable buildTimeLabelTable(
         EntityGroupManager const & groups,
         EntityRegistry const & registry,
         std::vector<GroupId> const & class_groups,
         std::string const & match_key,
         std::optional<EntityKind> require_kind) {
-    std::unordered_map<std::int64_t, std::size_t> time_to_label;
+    std::vector<std::pair<std::int64_t, std::size_t>> entries;
 
     for (std::size_t label = 0; label < class_groups.size(); ++label) {
         auto entity_ids = groups.getEntitiesInGroup(class_groups[label]);
@@ -75,21 +88,32 @@ std::unordered_map<std::int64_t, std::size_t> buildTimeLabelMap(
             if (desc->data_key != match_key) continue;
             if (require_kind.has_value() && desc->kind != *require_kind) continue;
 
-            // First assignment wins — lower class index has priority
-            time_to_label.try_emplace(desc->time_value, label);
+            entries.emplace_back(desc->time_value, label);
         }
     }
 
-    return time_to_label;
+    std::ranges::stable_sort(entries, {}, &std::pair<std::int64_t, std::size_t>::first);
+
+    TimeLabelTable table;
+    table.times.reserve(entries.size());
+    table.labels.reserve(entries.size());
+    for (auto const & [time, label]: entries) {
+        // First assignment wins — lower class index has priority
+        if (!table.times.empty() && table.times.back() == time) continue;
+        table.times.push_back(time);
+        table.labels.push_back(label);
+    }
+
+    return table;
 }
 
 /**
- * @brief Produce labels from a prebuilt time→label map
+ * @brief Produce labels from a prebuilt time→label table
  *
- * Assigns label num_classes (sentinel) to rows not found in the map.
+ * Assigns label num_classes (sentinel) to rows not found in the table.
  */
-AssembledLabels labelsFromTimeLabelMap(
-        std::unordered_map<std::int64_t, std::size_t> const & time_to_label,
+AssembledLabels labelsFromTimeLabelTable(
+        TimeLabelTable const & table,
         std::vector<std::string> class_names,
         std::size_t num_classes,
         std::span<TimeFrameIndex const> row_times) {
@@ -97,17 +121,18 @@ AssembledLabels labelsFromTimeLabelMap(
     result.num_classes = num_classes;
     result.class_names = std::move(class_names);
     result.labels.set_size(row_times.size());
-    result.unlabeled_count = 0;
+    result.labels.fill(num_classes);// sentinel for unlabeled
 
+    std::vector<std::int64_t> row_keys(row_times.size());
     for (std::size_t i = 0; i < row_times.size(); ++i) {
-        auto it = time_to_label.find(row_times[i].getValue());
-        if (it != time_to_label.end()) {
-            result.labels(i) = it->second;
-        } else {
-            result.labels(i) = num_classes;// sentinel for unlabeled
-            ++result.unlabeled_count;
-        }
+        row_keys[i] = row_times[i].getValue();
+    }
+
+    auto const matches = joinKeys(row_keys, table.times);
+    for (std::size_t k = 0; k < matches.size(); ++k) {
+        result.labels(matches.left_positions[k]) = table.labels[matches.right_positions[k]];
     }
+    result.unlabeled_count = row_times.size() - matches.size();
 
     return result;
 }
@@ -162,13 +187,13 @@ AssembledLabels assembleLabelsFromTimeEntityGroups(
 
     auto class_names = buildClassNames(groups, config.class_groups);
 
-    auto time_to_label = buildTimeLabelMap(
+    auto label_table = buildTimeLabelTable(
             groups, registry, config.class_groups,
             config.time_key,
             EntityKind::TimeEntity);
 
-    return labelsFromTimeLabelMap(
-            time_to_label, std::move(class_names),
+    return labelsFromTimeLabelTable(
+            label_table, std::move(class_names),
             config.class_groups.size(), row_times);
 }
 
@@ -193,13 +218,13 @@ AssembledLabels assembleLabelsFromDataEntityGroups(
     auto class_names = buildClassNames(groups, config.class_groups);
 
     // For data entity groups, match on data_key with any entity kind
-    auto time_to_label = buildTimeLabelMap(
+    auto label_table = buildTimeLabelTable(
             groups, registry, config.class_groups,
             config.data_key,
             std::nullopt);// no kind filter
 
-    return labelsFromTimeLabelMap(
-            time_to_label, std::move(class_names),
+    return labelsFromTimeLabelTable(
+            label_table, std::move(class_names),
             config.class_groups.size(), row_times);
 }
 
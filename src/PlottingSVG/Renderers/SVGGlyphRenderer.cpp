@@ -9,20 +9,228 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <numbers>
 #include <sstream>
+#include <unordered_set>
+#include <utility>
 
 namespace PlottingSVG {
 
+namespace {
+
+using GlyphType = CorePlotting::RenderableGlyphBatch::GlyphType;
+
+/// Glyphs sharing one `<path>`; keeps each `d` attribute a manageable size for vector editors
+constexpr std::size_t kMaxGlyphsPerPath = 4096;
+
+/**
+ * @brief One glyph in canvas pixels: segments `a→b` and `c→d` (Cross uses both), or the square's
+ *        opposite corners `a` and `b`. Circles only use `center`.
+ */
+struct PixelGlyph {
+    glm::vec2 center{};
+    glm::vec2 a{};
+    glm::vec2 b{};
+    glm::vec2 c{};
+    glm::vec2 d{};
+    glm::vec4 color{1.0f, 1.0f, 1.0f, 1.0f};
+};
+
+PixelGlyph toPixelGlyph(CorePlotting::RenderableGlyphBatch const & batch,
+                        std::size_t i,
+                        glm::mat4 const & mvp,
+                        int canvas_width,
+                        int canvas_height) {
+    glm::vec2 const & pos = batch.positions[i];
+    float const half_size = batch.size / 2.0f;
+    auto const to_svg = [&](float x, float y) {
+        return transformVertexToSVG(glm::vec4(x, y, 0.0f, 1.0f), mvp, canvas_width, canvas_height);
+    };
+
+    PixelGlyph glyph;
+    if (!batch.colors.empty() && i < batch.colors.size()) {
+        glyph.color = batch.colors[i];
+    }
+    glyph.center = to_svg(pos.x, pos.y);
+
+    switch (batch.glyph_type) {
+        case GlyphType::Tick:
+            glyph.a = to_svg(pos.x, pos.y - half_size);
+            glyph.b = to_svg(pos.x, pos.y + half_size);
+            break;
+        case GlyphType::TopLine:
+            glyph.a = to_svg(pos.x - half_size, pos.y);
+            glyph.b = to_svg(pos.x + half_size, pos.y);
+            break;
+        case GlyphType::Square:
+            glyph.a = to_svg(pos.x - half_size, pos.y + half_size);
+            glyph.b = to_svg(pos.x + half_size, pos.y - half_size);
+            break;
+        case GlyphType::Cross:
+            glyph.a = to_svg(pos.x - half_size, pos.y);
+            glyph.b = to_svg(pos.x + half_size, pos.y);
+            glyph.c = to_svg(pos.x, pos.y - half_size);
+            glyph.d = to_svg(pos.x, pos.y + half_size);
+            break;
+        case GlyphType::Circle:
+            break;
+    }
+    return glyph;
+}
+
+bool isStroked(GlyphType type) {
+    return type == GlyphType::Tick || type == GlyphType::TopLine || type == GlyphType::Cross;
+}
+
+/// Painted area in canvas pixels, counting one-pixel strokes and at least one pixel per glyph
+double pixelArea(GlyphType type, PixelGlyph const & glyph, float radius) {
+    auto const segment = [](glm::vec2 p, glm::vec2 q) {
+        return std::max(static_cast<double>(glm::length(q - p)), 1.0);
+    };
+    switch (type) {
+        case GlyphType::Tick:
+        case GlyphType::TopLine:
+            return segment(glyph.a, glyph.b);
+        case GlyphType::Cross:
+            return segment(glyph.a, glyph.b) + segment(glyph.c, glyph.d);
+        case GlyphType::Square:
+            return std::max(static_cast<double>(std::abs(glyph.b.x - glyph.a.x)), 1.0) *
+                   std::max(static_cast<double>(std::abs(glyph.b.y - glyph.a.y)), 1.0);
+        case GlyphType::Circle:
+            return std::max(std::numbers::pi * static_cast<double>(radius) * static_cast<double>(radius), 1.0);
+    }
+    return 1.0;
+}
+
+std::uint32_t packRGBA(glm::vec4 const & color) {
+    auto const channel = [](float v) {
+        return static_cast<std::uint32_t>(std::lround(std::clamp(v, 0.0f, 1.0f) * 255.0f));
+    };
+    return (channel(color.r) << 24U) | (channel(color.g) << 16U) | (channel(color.b) << 8U) | channel(color.a);
+}
+
+/// Device-pixel cell of a glyph center plus its color; equal keys render identically
+struct CellKey {
+    std::int64_t x{0};
+    std::int64_t y{0};
+    std::uint32_t rgba{0};
+
+    bool operator==(CellKey const &) const = default;
+};
+
+struct CellKeyHash {
+    std::size_t operator()(CellKey const & key) const {
+        auto h = static_cast<std::uint64_t>(key.x) * 0x9E3779B97F4A7C15ULL;
+        h ^= static_cast<std::uint64_t>(key.y) + 0x7F4A7C159E3779B9ULL + (h << 6U) + (h >> 2U);
+        h ^= static_cast<std::uint64_t>(key.rgba) + 0x9E3779B97F4A7C15ULL + (h << 6U) + (h >> 2U);
+        return static_cast<std::size_t>(h);
+    }
+};
+
+std::int64_t cellIndex(float coordinate, float cell) {
+    // Clamped so off-canvas and non-finite centers still map to a valid integer
+    constexpr double kLimit = 1e15;
+    double const index = std::floor(static_cast<double>(coordinate) / static_cast<double>(cell));
+    return static_cast<std::int64_t>(std::isnan(index) ? 0.0 : std::clamp(index, -kLimit, kLimit));
+}
+
+void appendSubpath(std::ostringstream & d, GlyphType type, PixelGlyph const & glyph, float radius) {
+    switch (type) {
+        case GlyphType::Tick:
+        case GlyphType::TopLine:
+            d << 'M' << glyph.a.x << ' ' << glyph.a.y << 'L' << glyph.b.x << ' ' << glyph.b.y;
+            break;
+        case GlyphType::Cross:
+            d << 'M' << glyph.a.x << ' ' << glyph.a.y << 'L' << glyph.b.x << ' ' << glyph.b.y;
+            d << 'M' << glyph.c.x << ' ' << glyph.c.y << 'L' << glyph.d.x << ' ' << glyph.d.y;
+            break;
+        case GlyphType::Square: {
+            float const min_x = std::min(glyph.a.x, glyph.b.x);
+            float const min_y = std::min(glyph.a.y, glyph.b.y);
+            float const w = std::abs(glyph.b.x - glyph.a.x);
+            float const h = std::abs(glyph.b.y - glyph.a.y);
+            d << 'M' << min_x << ' ' << min_y << 'h' << w << 'v' << h << 'h' << -w << 'z';
+            break;
+        }
+        case GlyphType::Circle:
+            d << 'M' << glyph.center.x - radius << ' ' << glyph.center.y
+              << 'a' << radius << ' ' << radius << " 0 1 0 " << 2.0f * radius << " 0"
+              << 'a' << radius << ' ' << radius << " 0 1 0 " << -2.0f * radius << " 0z";
+            break;
+    }
+}
+
+/// One-pixel-wide span along the dominant axis of segment `p→q`
+void rasterSegment(RasterLayer & layer, glm::vec2 p, glm::vec2 q, glm::vec4 const & color) {
+    if (std::abs(q.x - p.x) <= std::abs(q.y - p.y)) {
+        float const x = (p.x + q.x) * 0.5f;
+        layer.fillRect(x - 0.5f, p.y, x + 0.5f, q.y, color);
+    } else {
+        float const y = (p.y + q.y) * 0.5f;
+        layer.fillRect(p.x, y - 0.5f, q.x, y + 0.5f, color);
+    }
+}
+
+void rasterGlyph(RasterLayer & layer, GlyphType type, PixelGlyph const & glyph, float radius) {
+    switch (type) {
+        case GlyphType::Tick:
+        case GlyphType::TopLine:
+            rasterSegment(layer, glyph.a, glyph.b, glyph.color);
+            break;
+        case GlyphType::Cross:
+            rasterSegment(layer, glyph.a, glyph.b, glyph.color);
+            rasterSegment(layer, glyph.c, glyph.d, glyph.color);
+            break;
+        case GlyphType::Square:
+            layer.fillRect(glyph.a.x, glyph.a.y, glyph.b.x, glyph.b.y, glyph.color);
+            break;
+        case GlyphType::Circle:
+            layer.fillCircle(glyph.center.x, glyph.center.y, radius, glyph.color);
+            break;
+    }
+}
+
+/// Run a sink-based render and gather its elements
+std::vector<std::string> collect(auto && render_to_sink) {
+    std::vector<std::string> elements;
+    render_to_sink([&elements](std::string_view element) { elements.emplace_back(element); });
+    return elements;
+}
+
+}// namespace
+
 std::vector<std::string>
 SVGGlyphRenderer::render(CorePlotting::RenderableGlyphBatch const & batch,
                          glm::mat4 const & view,
                          glm::mat4 const & projection,
                          int canvas_width,
                          int canvas_height) {
-    std::vector<std::string> elements;
+    return collect([&](SVGElementSink const & sink) {
+        render(batch, view, projection, canvas_width, canvas_height, sink);
+    });
+}
+
+std::vector<std::string>
+SVGGlyphRenderer::renderSimplified(CorePlotting::RenderableGlyphBatch const & batch,
+                                   glm::mat4 const & view,
+                                   glm::mat4 const & projection,
+                                   int canvas_width,
+                                   int canvas_height,
+                                   SVGSimplificationOptions const & options) {
+    return collect([&](SVGElementSink const & sink) {
+        renderSimplified(batch, view, projection, canvas_width, canvas_height, options, sink);
+    });
+}
 
+void SVGGlyphRenderer::render(CorePlotting::RenderableGlyphBatch const & batch,
+                              glm::mat4 const & view,
+                              glm::mat4 const & projection,
+                              int canvas_width,
+                              int canvas_height,
+                              SVGElementSink const & sink) {
     if (batch.positions.empty()) {
-        return elements;
+        return;
     }
 
     glm::mat4 const mvp = projection * view * batch.model_matrix;
@@ -122,22 +330,110 @@ SVGGlyphRenderer::render(CorePlotting::RenderableGlyphBatch const & batch,
                         << R"(" x2=")" << svg_right.x << R"(" y2=")" << svg_right.y
                         << R"(" stroke=")" << color_hex
                         << R"(" stroke-width="1" stroke-opacity=")" << alpha << R"("/>)";
-                elements.push_back(element.str());
+                sink(element.str());
 
                 std::ostringstream element2;
                 element2 << R"(<line x1=")" << svg_bot.x << R"(" y1=")" << svg_bot.y
                          << R"(" x2=")" << svg_top.x << R"(" y2=")" << svg_top.y
                          << R"(" stroke=")" << color_hex
                          << R"(" stroke-width="1" stroke-opacity=")" << alpha << R"("/>)";
-                elements.push_back(element2.str());
+                sink(element2.str());
                 continue;
             }
         }
 
-        elements.push_back(element.str());
+        sink(element.str());
     }
+}
 
-    return elements;
+void SVGGlyphRenderer::renderSimplified(CorePlotting::RenderableGlyphBatch const & batch,
+                                        glm::mat4 const & view,
+                                        glm::mat4 const & projection,
+                                        int canvas_width,
+                                        int canvas_height,
+                                        SVGSimplificationOptions const & options,
+                                        SVGElementSink const & sink) {
+    if (batch.positions.empty()) {
+        return;
+    }
+
+    glm::mat4 const mvp = projection * view * batch.model_matrix;
+    GlyphType const type = batch.glyph_type;
+    float const radius = batch.size / 2.0f;
+    float const cell = devicePixelWidth(options);
+
+    std::vector<PixelGlyph> glyphs;
+    glyphs.reserve(batch.positions.size());
+    std::unordered_set<CellKey, CellKeyHash> occupied;
+    double total_area = 0.0;
+    for (std::size_t i = 0; i < batch.positions.size(); ++i) {
+        PixelGlyph const glyph = toPixelGlyph(batch, i, mvp, canvas_width, canvas_height);
+        if (options.merge_glyphs) {
+            CellKey const key{cellIndex(glyph.center.x, cell), cellIndex(glyph.center.y, cell), packRGBA(glyph.color)};
+            if (!occupied.insert(key).second) {
+                continue;
+            }
+        }
+        total_area += pixelArea(type, glyph, radius);
+        glyphs.push_back(glyph);
+    }
+
+    double const canvas_area = static_cast<double>(canvas_width) * static_cast<double>(canvas_height);
+    bool const too_many = options.raster_glyph_threshold > 0 && glyphs.size() > options.raster_glyph_threshold;
+    bool const overdrawn = options.raster_overdraw_ratio > 0.0f &&
+                           total_area > static_cast<double>(options.raster_overdraw_ratio) * canvas_area;
+    if (too_many || overdrawn) {
+        RasterLayer layer(canvas_width, canvas_height, rasterScale(options, canvas_width, canvas_height));
+        for (PixelGlyph const & glyph: glyphs) {
+            rasterGlyph(layer, type, glyph, radius);
+        }
+        std::string const image = layer.toSVGImageElement();
+        if (!image.empty()) {
+            sink(image);
+        }
+        return;
+    }
+
+    if (!options.merge_glyphs) {
+        render(batch, view, projection, canvas_width, canvas_height, sink);
+        return;
+    }
+
+    std::ostringstream d;
+    std::size_t run_length = 0;
+    glm::vec4 run_color{};
+    std::uint32_t run_rgba = 0;
+    auto const flush = [&]() {
+        if (run_length == 0) {
+            return;
+        }
+        std::ostringstream element;
+        element << R"(<path d=")" << d.str();
+        if (isStroked(type)) {
+            element << R"(" fill="none" stroke=")" << colorToSVGHex(run_color)
+                    << R"(" stroke-width="1" stroke-opacity=")" << run_color.a << R"("/>)";
+        } else {
+            element << R"(" fill=")" << colorToSVGHex(run_color)
+                    << R"(" fill-opacity=")" << run_color.a << R"("/>)";
+        }
+        sink(element.str());
+        d.str({});
+        run_length = 0;
+    };
+
+    for (PixelGlyph const & glyph: glyphs) {
+        std::uint32_t const rgba = packRGBA(glyph.color);
+        if (run_length > 0 && (rgba != run_rgba || run_length == kMaxGlyphsPerPath)) {
+            flush();
+        }
+        if (run_length == 0) {
+            run_color = glyph.color;
+            run_rgba = rgba;
+        }
+        appendSubpath(d, type, glyph, radius);
+        ++run_length;
+    }
+    flush();
 }
 
 }// namespace PlottingSVG
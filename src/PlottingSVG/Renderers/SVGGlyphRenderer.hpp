@@ -7,6 +7,8 @@
  */
 
 #include "CorePlotting/SceneGraph/RenderablePrimitives.hpp"
+#include "PlottingSVG/SVGSimplification.hpp"
+#include "PlottingSVG/SVGUtils.hpp"
 
 #include <glm/mat4x4.hpp>
 
@@ -64,6 +66,69 @@ public:
            glm::mat4 const & projection,
            int canvas_width,
            int canvas_height);
+
+    /**
+     * @brief Convert one glyph batch with export-resolution simplification.
+     *
+     * Glyph geometry is the same as `render()`. Then, in order:
+     * 1. With `options.merge_glyphs`, a glyph whose center falls in the same device-pixel cell
+     *    (`devicePixelWidth(options)`) as an earlier glyph of identical RGBA is dropped.
+     * 2. If the remaining glyph count exceeds `options.raster_glyph_threshold`, or their summed pixel
+     *    area exceeds `options.raster_overdraw_ratio` canvas areas, the batch is composited into a
+     *    `RasterLayer` at `rasterScale(options, ...)` and returned as a single `<image>` element.
+     * 3. Otherwise, with `options.merge_glyphs`, consecutive glyphs of the same color are emitted as
+     *    shared `<path>` runs (strokes for Tick / TopLine / Cross, fills for Square / Circle);
+     *    without it the output equals `render()`.
+     *
+     * Dropping stacked duplicates and painting a run as one path means translucent glyphs no longer
+     * darken where they overlap; opaque output is unchanged at the export resolution. The raster
+     * fallback draws strokes as axis-aligned one-pixel spans, which matches the plot transforms used
+     * by the widgets (no rotation).
+     *
+     * @pre Same as `render()` (enforcement: none) [IMPORTANT]
+     *
+     * @post Returns an empty vector when `batch.positions` is empty.
+     * @post Does not throw under normal `std::string`/`ostringstream` behavior.
+     */
+    [[nodiscard]] static std::vector<std::string>
+    renderSimplified(CorePlotting::RenderableGlyphBatch const & batch,
+                     glm::mat4 const & view,
+                     glm::mat4 const & projection,
+                     int canvas_width,
+                     int canvas_height,
+                     SVGSimplificationOptions const & options);
+
+    /**
+     * @brief Like `render()`, but passes each element to `sink` as soon as it is formatted.
+     *
+     * @pre Same as `render()` (enforcement: none) [IMPORTANT]
+     *
+     * @post `sink` receives exactly the strings `render()` returns, in the same order.
+     */
+    static void render(CorePlotting::RenderableGlyphBatch const & batch,
+                       glm::mat4 const & view,
+                       glm::mat4 const & projection,
+                       int canvas_width,
+                       int canvas_height,
+                       SVGElementSink const & sink);
+
+    /**
+     * @brief Like `renderSimplified()`, but passes each element to `sink` as soon as it is formatted.
+     *
+     * The per-glyph pixel geometry is still gathered first, because the raster decision needs the whole
+     * batch; only element strings are streamed.
+     *
+     * @pre Same as `render()` (enforcement: none) [IMPORTANT]
+     *
+     * @post `sink` receives exactly the strings `renderSimplified()` returns, in the same order.
+     */
+    static void renderSimplified(CorePlotting::RenderableGlyphBatch const & batch,
+                                 glm::mat4 const & view,
+                                 glm::mat4 const & projection,
+                                 int canvas_width,
+                                 int canvas_height,
+                                 SVGSimplificationOptions const & options,
+                                 SVGElementSink const & sink);
 };
 
 }// namespace PlottingSVG
@@ -5,26 +5,34 @@
 
 #include "PlottingSVG/Renderers/SVGPolyLineRenderer.hpp"
 
+#include "PlottingSVG/SVGSimplification.hpp"
 #include "PlottingSVG/SVGUtils.hpp"
 
 #include <sstream>
 
 namespace PlottingSVG {
 
-std::vector<std::string>
-SVGPolyLineRenderer::render(CorePlotting::RenderablePolyLineBatch const & batch,
-                            glm::mat4 const & view,
-                            glm::mat4 const & projection,
-                            int canvas_width,
-                            int canvas_height) {
-    std::vector<std::string> elements;
+namespace {
 
+/**
+ * @brief Shared walk over a batch: transforms each line to canvas pixels, lets `reduce` thin the
+ *        point list, and passes the formatted `<polyline>` element to `sink`.
+ */
+template<typename Reduce>
+void renderLines(CorePlotting::RenderablePolyLineBatch const & batch,
+                 glm::mat4 const & view,
+                 glm::mat4 const & projection,
+                 int canvas_width,
+                 int canvas_height,
+                 Reduce && reduce,
+                 SVGElementSink const & sink) {
     if (batch.vertices.empty() || batch.line_start_indices.empty()) {
-        return elements;
+        return;
     }
 
     glm::mat4 const mvp = projection * view * batch.model_matrix;
 
+    std::vector<glm::vec2> svg_points;
     for (size_t line_idx = 0; line_idx < batch.line_start_indices.size(); ++line_idx) {
         int const start_index = batch.line_start_indices[line_idx];
         int const vertex_count = batch.line_vertex_counts[line_idx];
@@ -39,7 +47,7 @@ SVGPolyLineRenderer::render(CorePlotting::RenderablePolyLineBatch const & batch,
         }
         std::string const color_hex = colorToSVGHex(color);
 
-        std::ostringstream points;
+        svg_points.clear();
         for (int i = 0; i < vertex_count; ++i) {
             int const vert_idx = (start_index + i) * 2;
             if (vert_idx + 1 >= static_cast<int>(batch.vertices.size())) {
@@ -50,12 +58,16 @@ SVGPolyLineRenderer::render(CorePlotting::RenderablePolyLineBatch const & batch,
             float const y = batch.vertices[static_cast<size_t>(vert_idx) + 1U];
 
             glm::vec4 const vertex(x, y, 0.0f, 1.0f);
-            glm::vec2 const svg_pos =
-                    transformVertexToSVG(vertex, mvp, canvas_width, canvas_height);
+            svg_points.push_back(transformVertexToSVG(vertex, mvp, canvas_width, canvas_height));
+        }
 
-            if (i > 0) {
+        std::ostringstream points;
+        bool first = true;
+        for (glm::vec2 const & svg_pos: reduce(svg_points)) {
+            if (!first) {
                 points << ' ';
             }
+            first = false;
             points << svg_pos.x << ',' << svg_pos.y;
         }
 
@@ -63,10 +75,68 @@ SVGPolyLineRenderer::render(CorePlotting::RenderablePolyLineBatch const & batch,
         element << R"(<polyline points=")" << points.str() << R"(" fill="none" stroke=")" << color_hex
                 << R"(" stroke-width=")" << batch.thickness
                 << R"(" stroke-linejoin="round" stroke-linecap="round"/>)";
-        elements.push_back(element.str());
+        sink(element.str());
     }
+}
+
+/// Reduce step of `render()`: keep every point
+std::vector<glm::vec2> const & allPoints(std::vector<glm::vec2> const & points) {
+    return points;
+}
 
+/// Run a sink-based render and gather its elements
+std::vector<std::string> collect(auto && render_to_sink) {
+    std::vector<std::string> elements;
+    render_to_sink([&elements](std::string_view element) { elements.emplace_back(element); });
     return elements;
 }
 
+}// namespace
+
+std::vector<std::string>
+SVGPolyLineRenderer::render(CorePlotting::RenderablePolyLineBatch const & batch,
+                            glm::mat4 const & view,
+                            glm::mat4 const & projection,
+                            int canvas_width,
+                            int canvas_height) {
+    return collect([&](SVGElementSink const & sink) {
+        render(batch, view, projection, canvas_width, canvas_height, sink);
+    });
+}
+
+std::vector<std::string>
+SVGPolyLineRenderer::renderDecimated(CorePlotting::RenderablePolyLineBatch const & batch,
+                                     glm::mat4 const & view,
+                                     glm::mat4 const & projection,
+                                     int canvas_width,
+                                     int canvas_height,
+                                     float bucket_width) {
+    return collect([&](SVGElementSink const & sink) {
+        renderDecimated(batch, view, projection, canvas_width, canvas_height, bucket_width, sink);
+    });
+}
+
+void SVGPolyLineRenderer::render(CorePlotting::RenderablePolyLineBatch const & batch,
+                                 glm::mat4 const & view,
+                                 glm::mat4 const & projection,
+                                 int canvas_width,
+                                 int canvas_height,
+                                 SVGElementSink const & sink) {
+    renderLines(batch, view, projection, canvas_width, canvas_height, allPoints, sink);
+}
+
+void SVGPolyLineRenderer::renderDecimated(CorePlotting::RenderablePolyLineBatch const & batch,
+                                          glm::mat4 const & view,
+                                          glm::mat4 const & projection,
+                                          int canvas_width,
+                                          int canvas_height,
+                                          float bucket_width,
+                                          SVGElementSink const & sink) {
+    renderLines(batch, view, projection, canvas_width, canvas_height,
+                [bucket_width](std::vector<glm::vec2> const & points) {
+                    return decimateMinMax(points, bucket_width);
+                },
+                sink);
+}
+
 }// namespace PlottingSVG
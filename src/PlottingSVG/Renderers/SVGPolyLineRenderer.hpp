@@ -7,6 +7,7 @@
  */
 
 #include "CorePlotting/SceneGraph/RenderablePrimitives.hpp"
+#include "PlottingSVG/SVGUtils.hpp"
 
 #include <glm/mat4x4.hpp>
 
@@ -59,6 +60,54 @@ public:
            glm::mat4 const & projection,
            int canvas_width,
            int canvas_height);
+
+    /**
+     * @brief Like `render()`, but each line is min/max decimated in canvas pixels before formatting.
+     *
+     * @param bucket_width    Column width in canvas pixels (see `decimateMinMax`), usually
+     *                        `devicePixelWidth(options)`. Non-positive values disable decimation.
+     *
+     * @pre Same as `render()` (enforcement: none) [CRITICAL]
+     *
+     * @post Same elements as `render()` (one per drawable line, same stroke attributes); each `points`
+     *       list is the `decimateMinMax` subsequence of the full line.
+     */
+    [[nodiscard]] static std::vector<std::string>
+    renderDecimated(CorePlotting::RenderablePolyLineBatch const & batch,
+                    glm::mat4 const & view,
+                    glm::mat4 const & projection,
+                    int canvas_width,
+                    int canvas_height,
+                    float bucket_width);
+
+    /**
+     * @brief Like `render()`, but passes each `<polyline>` to `sink` as soon as it is formatted.
+     *
+     * @pre Same as `render()` (enforcement: none) [CRITICAL]
+     *
+     * @post `sink` receives exactly the strings `render()` returns, in the same order.
+     */
+    static void render(CorePlotting::RenderablePolyLineBatch const & batch,
+                       glm::mat4 const & view,
+                       glm::mat4 const & projection,
+                       int canvas_width,
+                       int canvas_height,
+                       SVGElementSink const & sink);
+
+    /**
+     * @brief Like `renderDecimated()`, but passes each `<polyline>` to `sink` as soon as it is formatted.
+     *
+     * @pre Same as `render()` (enforcement: none) [CRITICAL]
+     *
+     * @post `sink` receives exactly the strings `renderDecimated()` returns, in the same order.
+     */
+    static void renderDecimated(CorePlotting::RenderablePolyLineBatch const & batch,
+                                glm::mat4 const & view,
+                                glm::mat4 const & projection,
+                                int canvas_width,
+                                int canvas_height,
+                                float bucket_width,
+                                SVGElementSink const & sink);
 };
 
 } // namespace PlottingSVG
@@ -20,9 +20,20 @@ SVGRectangleRenderer::render(CorePlotting::RenderableRectangleBatch const & batc
                              int canvas_width,
                              int canvas_height) {
     std::vector<std::string> elements;
+    elements.reserve(batch.bounds.size());
+    render(batch, view, projection, canvas_width, canvas_height,
+           [&elements](std::string_view element) { elements.emplace_back(element); });
+    return elements;
+}
 
+void SVGRectangleRenderer::render(CorePlotting::RenderableRectangleBatch const & batch,
+                                  glm::mat4 const & view,
+                                  glm::mat4 const & projection,
+                                  int canvas_width,
+                                  int canvas_height,
+                                  SVGElementSink const & sink) {
     if (batch.bounds.empty()) {
-        return elements;
+        return;
     }
 
     glm::mat4 const mvp = projection * view * batch.model_matrix;
@@ -58,10 +69,8 @@ SVGRectangleRenderer::render(CorePlotting::RenderableRectangleBatch const & batc
         element << R"(<rect x=")" << svg_x << R"(" y=")" << svg_y << R"(" width=")" << svg_width
                 << R"(" height=")" << svg_height << R"(" fill=")" << color_hex
                 << R"(" fill-opacity=")" << alpha << R"(" stroke="none"/>)";
-        elements.push_back(element.str());
+        sink(element.str());
     }
-
-    return elements;
 }
 
 }// namespace PlottingSVG
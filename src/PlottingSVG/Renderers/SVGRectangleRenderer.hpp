@@ -7,6 +7,7 @@
  */
 
 #include "CorePlotting/SceneGraph/RenderablePrimitives.hpp"
+#include "PlottingSVG/SVGUtils.hpp"
 
 #include <glm/mat4x4.hpp>
 
@@ -56,6 +57,20 @@ public:
            glm::mat4 const & projection,
            int canvas_width,
            int canvas_height);
+
+    /**
+     * @brief Like `render()`, but passes each `<rect>` to `sink` as soon as it is formatted.
+     *
+     * @pre Same as `render()` [LOW]
+     *
+     * @post `sink` receives exactly the strings `render()` returns, in the same order.
+     */
+    static void render(CorePlotting::RenderableRectangleBatch const & batch,
+                       glm::mat4 const & view,
+                       glm::mat4 const & projection,
+                       int canvas_width,
+                       int canvas_height,
+                       SVGElementSink const & sink);
 };
 
 }// namespace PlottingSVG
@@ -9,8 +9,12 @@
 #include "PlottingSVG/Renderers/SVGPolyLineRenderer.hpp"
 #include "PlottingSVG/Renderers/SVGRectangleRenderer.hpp"
 #include "PlottingSVG/SVGDocument.hpp"
+#include "PlottingSVG/SVGStreamWriter.hpp"
+#include "PlottingSVG/SVGUtils.hpp"
 
 #include <fstream>
+#include <ostream>
+#include <string_view>
 #include <utility>
 
 namespace PlottingSVG {
@@ -81,14 +85,92 @@ std::string SVGSceneRenderer::render() const {
     return document.build();
 }
 
+bool SVGSceneRenderer::renderToStream(std::ostream & out) const {
+    return _stream(out, nullptr);
+}
+
+bool SVGSceneRenderer::renderToStream(std::ostream & out, SVGSimplificationOptions const & options) const {
+    return _stream(out, &options);
+}
+
 bool SVGSceneRenderer::renderToFile(std::filesystem::path const & path) const {
-    std::string const svg = render();
     std::ofstream out(path, std::ios::binary);
     if (!out) {
         return false;
     }
-    out << svg;
-    return static_cast<bool>(out);
+    return renderToStream(out);
+}
+
+bool SVGSceneRenderer::renderToFile(std::filesystem::path const & path,
+                                    SVGSimplificationOptions const & options) const {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        return false;
+    }
+    return renderToStream(out, options);
+}
+
+bool SVGSceneRenderer::_stream(std::ostream & out, SVGSimplificationOptions const * options) const {
+    SVGStreamWriter writer(out, _canvas_width, _canvas_height);
+    // Same description as the SVGDocument default so streamed and in-memory output are identical
+    writer.writeHeader(_background_hex, "Neuralyzer Export");
+
+    // Batch renderers hand over each element as soon as it is formatted
+    SVGElementSink const sink = [&writer](std::string_view element) {
+        writer.writeElement(element);
+    };
+
+    if (_scene != nullptr) {
+        glm::mat4 const view = _scene->view_matrix;
+        glm::mat4 const projection = _scene->projection_matrix;
+
+        if (!_scene->rectangle_batches.empty()) {
+            writer.beginLayer("rectangles");
+            for (CorePlotting::RenderableRectangleBatch const & batch: _scene->rectangle_batches) {
+                SVGRectangleRenderer::render(batch, view, projection, _canvas_width, _canvas_height, sink);
+            }
+        }
+        if (!_scene->poly_line_batches.empty()) {
+            writer.beginLayer("polylines");
+            for (CorePlotting::RenderablePolyLineBatch const & batch: _scene->poly_line_batches) {
+                if (options != nullptr && options->decimate_polylines) {
+                    SVGPolyLineRenderer::renderDecimated(batch, view, projection, _canvas_width, _canvas_height,
+                                                         devicePixelWidth(*options), sink);
+                } else {
+                    SVGPolyLineRenderer::render(batch, view, projection, _canvas_width, _canvas_height, sink);
+                }
+            }
+        }
+        if (!_scene->glyph_batches.empty()) {
+            writer.beginLayer("glyphs");
+            for (CorePlotting::RenderableGlyphBatch const & batch: _scene->glyph_batches) {
+                if (options != nullptr) {
+                    SVGGlyphRenderer::renderSimplified(batch, view, projection, _canvas_width, _canvas_height,
+                                                       *options, sink);
+                } else {
+                    SVGGlyphRenderer::render(batch, view, projection, _canvas_width, _canvas_height, sink);
+                }
+            }
+        }
+        writer.endLayer();
+
+        // Decorations only get a layer when they produce output, as in render(). Their interface
+        // returns a (small) element list per decoration, which is written as it comes back.
+        bool decorations_open = false;
+        for (std::unique_ptr<SVGDecoration> const & decoration: _decorations) {
+            std::vector<std::string> const part = decoration->render(_canvas_width, _canvas_height);
+            if (!part.empty() && !decorations_open) {
+                writer.beginLayer("decorations");
+                decorations_open = true;
+            }
+            for (std::string const & element: part) {
+                writer.writeElement(element);
+            }
+        }
+    }
+
+    writer.finish();
+    return writer.good();
 }
 
 }// namespace PlottingSVG
@@ -7,10 +7,12 @@
  */
 
 #include "PlottingSVG/Decorations/SVGDecoration.hpp"
+#include "PlottingSVG/SVGSimplification.hpp"
 
 #include "CorePlotting/SceneGraph/RenderablePrimitives.hpp"
 
 #include <filesystem>
+#include <iosfwd>
 #include <memory>
 #include <string>
 #include <vector>
@@ -96,17 +98,57 @@ public:
     [[nodiscard]] std::string render() const;
 
     /**
-     * @brief Write `render()` to `path` as UTF-8 bytes (`std::ios::binary`).
+     * @brief Write the same document as `render()` to `out`, one element at a time.
+     *
+     * Scene batches pass each element to the stream as soon as it is formatted (the renderers'
+     * `SVGElementSink` overloads), so no element list is built. Decorations return their few elements
+     * as a list per decoration, which is written right away.
+     *
+     * @pre Same as `render()` [LOW]
+     *
+     * @post Bytes written equal `render()`.
+     * @post Returns `true` if `out` is still good after the closing `</svg>`.
+     */
+    [[nodiscard]] bool renderToStream(std::ostream & out) const;
+
+    /**
+     * @brief Stream the document with export-resolution simplification applied to scene batches.
+     *
+     * Rectangles and decorations are written unchanged. Polylines are min/max decimated per device
+     * pixel when `options.decimate_polylines` is set (`SVGPolyLineRenderer::renderDecimated`); glyph
+     * batches go through `SVGGlyphRenderer::renderSimplified` (merged `<path>` runs or a raster
+     * `<image>` fallback). Layer ids and order are the same as `render()`.
+     *
+     * @pre Same as `render()` [LOW]
+     *
+     * @post Returns `true` if `out` is still good after the closing `</svg>`.
+     */
+    [[nodiscard]] bool renderToStream(std::ostream & out, SVGSimplificationOptions const & options) const;
+
+    /**
+     * @brief Write `render()` to `path` as UTF-8 bytes (`std::ios::binary`), streaming via `renderToStream`.
      *
      * @pre `path` must be openable for output by this process (parent directory exists, permissions, etc.)
      *      (enforcement: runtime_check — returns `false` on failure) [IMPORTANT]
      *
-     * @post Returns `true` if the stream was good after writing the full `render()` result; otherwise
+     * @post Returns `true` if the stream was good after writing the full document; otherwise
      *       `false` (including when the file could not be opened).
      */
     [[nodiscard]] bool renderToFile(std::filesystem::path const & path) const;
 
+    /**
+     * @brief Stream a simplified document (see `renderToStream(std::ostream &, SVGSimplificationOptions const &)`)
+     *        to `path`.
+     *
+     * @pre `path` must be openable for output by this process (enforcement: runtime_check — returns
+     *      `false` on failure) [IMPORTANT]
+     */
+    [[nodiscard]] bool renderToFile(std::filesystem::path const & path,
+                                    SVGSimplificationOptions const & options) const;
+
 private:
+    [[nodiscard]] bool _stream(std::ostream & out, SVGSimplificationOptions const * options) const;
+
     CorePlotting::RenderableScene const * _scene{nullptr};
     int _canvas_width{1920};
     int _canvas_height{1080};
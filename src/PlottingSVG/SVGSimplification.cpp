@@ -0,0 +1,295 @@
+/**
+ * @file SVGSimplification.cpp
+ * @brief Polyline min/max decimation and the PNG raster fallback layer.
+ */
+
+#include "PlottingSVG/SVGSimplification.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string_view>
+#include <utility>
+
+namespace PlottingSVG {
+
+namespace {
+
+constexpr float kCSSPixelsPerInch = 96.0f;
+
+void appendU32BE(std::string & out, std::uint32_t v) {
+    out.push_back(static_cast<char>((v >> 24U) & 0xFFU));
+    out.push_back(static_cast<char>((v >> 16U) & 0xFFU));
+    out.push_back(static_cast<char>((v >> 8U) & 0xFFU));
+    out.push_back(static_cast<char>(v & 0xFFU));
+}
+
+void appendChunk(std::string & png, char const (&type)[5], std::string_view data) {
+    appendU32BE(png, static_cast<std::uint32_t>(data.size()));
+    std::string body(type, 4);
+    body.append(data);
+    png.append(body);
+    appendU32BE(png, static_cast<std::uint32_t>(
+                             ::crc32(0L, reinterpret_cast<Bytef const *>(body.data()), static_cast<uInt>(body.size()))));
+}
+
+std::string base64(std::string_view bytes) {
+    static constexpr char kAlphabet[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string out;
+    out.reserve((bytes.size() + 2) / 3 * 4);
+    std::size_t i = 0;
+    for (; i + 2 < bytes.size(); i += 3) {
+        std::uint32_t const v = (static_cast<std::uint32_t>(static_cast<std::uint8_t>(bytes[i])) << 16U) |
+                                (static_cast<std::uint32_t>(static_cast<std::uint8_t>(bytes[i + 1])) << 8U) |
+                                static_cast<std::uint32_t>(static_cast<std::uint8_t>(bytes[i + 2]));
+        out.push_back(kAlphabet[(v >> 18U) & 0x3FU]);
+        out.push_back(kAlphabet[(v >> 12U) & 0x3FU]);
+        out.push_back(kAlphabet[(v >> 6U) & 0x3FU]);
+        out.push_back(kAlphabet[v & 0x3FU]);
+    }
+    std::size_t const rest = bytes.size() - i;
+    if (rest > 0) {
+        std::uint32_t v = static_cast<std::uint32_t>(static_cast<std::uint8_t>(bytes[i])) << 16U;
+        if (rest == 2) {
+            v |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(bytes[i + 1])) << 8U;
+        }
+        out.push_back(kAlphabet[(v >> 18U) & 0x3FU]);
+        out.push_back(kAlphabet[(v >> 12U) & 0x3FU]);
+        out.push_back(rest == 2 ? kAlphabet[(v >> 6U) & 0x3FU] : '=');
+        out.push_back('=');
+    }
+    return out;
+}
+
+std::uint8_t toByte(float channel) {
+    return static_cast<std::uint8_t>(std::lround(std::clamp(channel, 0.0f, 1.0f) * 255.0f));
+}
+
+}// namespace
+
+float devicePixelWidth(SVGSimplificationOptions const & options) {
+    if (!(options.export_dpi > 0.0f)) {
+        return 1.0f;
+    }
+    return kCSSPixelsPerInch / options.export_dpi;
+}
+
+float rasterScale(SVGSimplificationOptions const & options, int canvas_width, int canvas_height) {
+    float scale = 1.0f / devicePixelWidth(options);
+    int const longest = std::max(canvas_width, canvas_height);
+    if (options.raster_max_dimension > 0 && longest > 0 &&
+        static_cast<float>(longest) * scale > static_cast<float>(options.raster_max_dimension)) {
+        scale = static_cast<float>(options.raster_max_dimension) / static_cast<float>(longest);
+    }
+    return scale;
+}
+
+std::vector<glm::vec2> decimateMinMax(std::span<glm::vec2 const> points, float bucket_width) {
+    if (!(bucket_width > 0.0f) || points.size() <= 2) {
+        return {points.begin(), points.end()};
+    }
+
+    std::vector<glm::vec2> out;
+    std::size_t i = 0;
+    while (i < points.size()) {
+        float const bucket = std::floor(points[i].x / bucket_width);
+        std::size_t last = i;
+        std::size_t lowest = i;
+        std::size_t highest = i;
+        while (last + 1 < points.size() && std::floor(points[last + 1].x / bucket_width) == bucket) {
+            ++last;
+            if (points[last].y < points[lowest].y) {
+                lowest = last;
+            }
+            if (points[last].y > points[highest].y) {
+                highest = last;
+            }
+        }
+
+        std::array<std::size_t, 4> keep{i, lowest, highest, last};
+        std::sort(keep.begin(), keep.end());
+        auto const keep_end = std::unique(keep.begin(), keep.end());
+        for (auto it = keep.begin(); it != keep_end; ++it) {
+            out.push_back(points[*it]);
+        }
+        i = last + 1;
+    }
+    return out;
+}
+
+RasterLayer::RasterLayer(int width,// NOLINT(bugprone-easily-swappable-parameters)
+                         int height,
+                         float scale) {
+    if (width > 0 && height > 0 && std::isfinite(scale) && scale > 0.0f) {
+        _scale = scale;
+        _width = std::max(1, static_cast<int>(std::ceil(static_cast<float>(width) * scale)));
+        _height = std::max(1, static_cast<int>(std::ceil(static_cast<float>(height) * scale)));
+        _rgba.assign(static_cast<std::size_t>(_width) * static_cast<std::size_t>(_height) * 4U, 0);
+    }
+}
+
+void RasterLayer::_blend(int x, int y, glm::vec4 const & color) {
+    std::size_t const offset =
+            (static_cast<std::size_t>(y) * static_cast<std::size_t>(_width) + static_cast<std::size_t>(x)) * 4U;
+    std::uint8_t * px = _rgba.data() + offset;
+
+    float const src_a = std::clamp(color.a, 0.0f, 1.0f);
+    float const dst_a = static_cast<float>(px[3]) / 255.0f;
+    float const out_a = src_a + dst_a * (1.0f - src_a);
+    if (out_a <= 0.0f) {
+        return;
+    }
+    for (int c = 0; c < 3; ++c) {
+        float const src = std::clamp(color[c], 0.0f, 1.0f);
+        float const dst = static_cast<float>(px[c]) / 255.0f;
+        px[c] = toByte((src * src_a + dst * dst_a * (1.0f - src_a)) / out_a);
+    }
+    px[3] = toByte(out_a);
+
+    if (empty()) {
+        _dirty_min_x = _dirty_max_x = x;
+        _dirty_min_y = _dirty_max_y = y;
+    } else {
+        _dirty_min_x = std::min(_dirty_min_x, x);
+        _dirty_max_x = std::max(_dirty_max_x, x);
+        _dirty_min_y = std::min(_dirty_min_y, y);
+        _dirty_max_y = std::max(_dirty_max_y, y);
+    }
+}
+
+void RasterLayer::fillRect(float x0, float y0, float x1, float y1, glm::vec4 const & color) {
+    if (_rgba.empty()) {
+        return;
+    }
+    if (!std::isfinite(x0) || !std::isfinite(y0) || !std::isfinite(x1) || !std::isfinite(y1)) {
+        return;
+    }
+    x0 *= _scale;
+    y0 *= _scale;
+    x1 *= _scale;
+    y1 *= _scale;
+    auto const span = [](float a, float b, int limit) {
+        // Clamp first so far off-canvas coordinates cannot overflow the integer conversion
+        float const bound = static_cast<float>(limit) + 1.0f;
+        float const lo = std::clamp(std::min(a, b), -1.0f, bound);
+        float const hi = std::clamp(std::max(a, b), -1.0f, bound);
+        // Pixels whose centers fall in [lo, hi); a sub-pixel span still covers its nearest pixel
+        long first = std::lround(std::ceil(lo - 0.5f));
+        long last = std::lround(std::ceil(hi - 0.5f)) - 1;
+        if (last < first) {
+            first = last = std::lround(std::floor((lo + hi) * 0.5f));
+        }
+        return std::pair<long, long>{std::max(first, 0L), std::min(last, static_cast<long>(limit) - 1)};
+    };
+    auto const [xa, xb] = span(x0, x1, _width);
+    auto const [ya, yb] = span(y0, y1, _height);
+    for (long y = ya; y <= yb; ++y) {
+        for (long x = xa; x <= xb; ++x) {
+            _blend(static_cast<int>(x), static_cast<int>(y), color);
+        }
+    }
+}
+
+void RasterLayer::fillCircle(float cx, float cy, float radius, glm::vec4 const & color) {
+    if (_rgba.empty() || !std::isfinite(cx) || !std::isfinite(cy) || !std::isfinite(radius)) {
+        return;
+    }
+    if (radius * _scale < 0.5f) {
+        fillRect(cx - radius, cy - radius, cx + radius, cy + radius, color);
+        return;
+    }
+    cx *= _scale;
+    cy *= _scale;
+    radius *= _scale;
+    if (cx + radius < 0.0f || cy + radius < 0.0f ||
+        cx - radius > static_cast<float>(_width) || cy - radius > static_cast<float>(_height)) {
+        return;
+    }
+    long const ya = std::max(std::lround(std::floor(cy - radius)), 0L);
+    long const yb = std::min(std::lround(std::ceil(cy + radius)), static_cast<long>(_height) - 1);
+    long const xa = std::max(std::lround(std::floor(cx - radius)), 0L);
+    long const xb = std::min(std::lround(std::ceil(cx + radius)), static_cast<long>(_width) - 1);
+    float const r2 = radius * radius;
+    for (long y = ya; y <= yb; ++y) {
+        float const dy = static_cast<float>(y) + 0.5f - cy;
+        for (long x = xa; x <= xb; ++x) {
+            float const dx = static_cast<float>(x) + 0.5f - cx;
+            if (dx * dx + dy * dy <= r2) {
+                _blend(static_cast<int>(x), static_cast<int>(y), color);
+            }
+        }
+    }
+}
+
+std::array<std::uint8_t, 4> RasterLayer::pixel(int x, int y) const {
+    std::size_t const offset =
+            (static_cast<std::size_t>(y) * static_cast<std::size_t>(_width) + static_cast<std::size_t>(x)) * 4U;
+    return {_rgba[offset], _rgba[offset + 1], _rgba[offset + 2], _rgba[offset + 3]};
+}
+
+std::string RasterLayer::toPNG() const {
+    return _encodePNG(0, 0, _width, _height);
+}
+
+std::string RasterLayer::_encodePNG(int x0, int y0, int width, int height) const {
+    std::string png("\x89PNG\r\n\x1a\n", 8);
+
+    std::string ihdr;
+    appendU32BE(ihdr, static_cast<std::uint32_t>(width));
+    appendU32BE(ihdr, static_cast<std::uint32_t>(height));
+    ihdr.push_back(8);// bit depth
+    ihdr.push_back(6);// color type RGBA
+    ihdr.push_back(0);// compression
+    ihdr.push_back(0);// filter
+    ihdr.push_back(0);// interlace
+    appendChunk(png, "IHDR", ihdr);
+
+    // Scanlines, each prefixed by filter type 0
+    std::size_t const stride = static_cast<std::size_t>(_width) * 4U;
+    std::size_t const row_bytes = static_cast<std::size_t>(width) * 4U;
+    std::string raw;
+    raw.reserve((row_bytes + 1) * static_cast<std::size_t>(height));
+    for (int y = y0; y < y0 + height; ++y) {
+        raw.push_back(0);
+        raw.append(reinterpret_cast<char const *>(_rgba.data()) + static_cast<std::size_t>(y) * stride +
+                           static_cast<std::size_t>(x0) * 4U,
+                   row_bytes);
+    }
+
+    // Default-level deflate; flat glyph fills compress to a small fraction of the raw scanlines
+    uLongf idat_size = compressBound(static_cast<uLong>(raw.size()));
+    std::string idat(idat_size, '\0');
+    if (compress2(reinterpret_cast<Bytef *>(idat.data()), &idat_size,
+                  reinterpret_cast<Bytef const *>(raw.data()), static_cast<uLong>(raw.size()),
+                  Z_DEFAULT_COMPRESSION) != Z_OK) {
+        return {};
+    }
+    idat.resize(idat_size);
+    appendChunk(png, "IDAT", idat);
+    appendChunk(png, "IEND", {});
+    return png;
+}
+
+std::string RasterLayer::toSVGImageElement() const {
+    if (empty()) {
+        return {};
+    }
+    int const w = _dirty_max_x - _dirty_min_x + 1;
+    int const h = _dirty_max_y - _dirty_min_y + 1;
+    std::string const png = _encodePNG(_dirty_min_x, _dirty_min_y, w, h);
+    if (png.empty()) {
+        return {};
+    }
+    // Raster pixels back to canvas units, so the image lands where the glyphs were drawn
+    auto const canvas = [this](int pixels) { return static_cast<float>(pixels) / _scale; };
+    std::ostringstream element;
+    element << R"(<image x=")" << canvas(_dirty_min_x) << R"(" y=")" << canvas(_dirty_min_y)
+            << R"(" width=")" << canvas(w) << R"(" height=")" << canvas(h)
+            << R"(" preserveAspectRatio="none" href="data:image/png;base64,)" << base64(png) << R"("/>)";
+    return element.str();
+}
+
+}// namespace PlottingSVG
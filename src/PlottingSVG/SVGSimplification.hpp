@@ -0,0 +1,156 @@
+#ifndef PLOTTINGSVG_SVGSIMPLIFICATION_HPP
+#define PLOTTINGSVG_SVGSIMPLIFICATION_HPP
+
+/**
+ * @file SVGSimplification.hpp
+ * @brief Export-resolution-aware geometry reduction for streamed SVG output.
+ */
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace PlottingSVG {
+
+/**
+ * @brief Controls how much geometry `SVGSceneRenderer::renderToStream` may drop or flatten.
+ *
+ * Canvas pixels are CSS pixels (1/96 inch). At `export_dpi` one output device pixel spans
+ * `96 / export_dpi` canvas pixels; detail finer than that cannot be seen in the exported figure.
+ */
+struct SVGSimplificationOptions {
+    /// Target output resolution; sets the decimation bucket and glyph merge grid
+    float export_dpi{300.0f};
+
+    /// Reduce each polyline to first / min / max / last per device-pixel column
+    bool decimate_polylines{true};
+
+    /// Drop glyphs that land on an already-emitted glyph of the same color and emit runs as `<path>`
+    bool merge_glyphs{true};
+
+    /// Rasterize a glyph batch with more glyphs than this after merging (0 disables the count test)
+    std::size_t raster_glyph_threshold{250000};
+
+    /// Rasterize a glyph batch whose summed glyph area exceeds this multiple of the canvas area
+    /// (0 disables the overdraw test)
+    float raster_overdraw_ratio{8.0f};
+
+    /// Longest side in device pixels of a raster fallback layer; lower resolution past it
+    /// (0 disables the cap)
+    int raster_max_dimension{8192};
+};
+
+/**
+ * @brief Width in canvas pixels of one device pixel at `options.export_dpi`.
+ *
+ * @post Returns `96 / export_dpi`, or 1 when `export_dpi` is not positive.
+ */
+[[nodiscard]] float devicePixelWidth(SVGSimplificationOptions const & options);
+
+/**
+ * @brief Device pixels per canvas pixel for a raster fallback layer over the given canvas.
+ *
+ * @post Returns `export_dpi / 96` (1 when `export_dpi` is not positive), reduced so the longer
+ *       canvas side spans at most `options.raster_max_dimension` device pixels.
+ */
+[[nodiscard]] float rasterScale(SVGSimplificationOptions const & options, int canvas_width, int canvas_height);
+
+/**
+ * @brief Min/max decimation of a polyline in canvas pixel space.
+ *
+ * Consecutive points whose `x` falls in the same `bucket_width` column are reduced to the first,
+ * lowest-`y`, highest-`y`, and last point of the run, in their original order. The rendered stroke
+ * covers the same pixels as the full line at that resolution (the classic oscilloscope envelope).
+ *
+ * @pre `bucket_width > 0`; otherwise the input is returned unchanged (enforcement: runtime_check) [LOW]
+ *
+ * @post Output is a subsequence of `points` containing the first and last point.
+ * @post At most four points per run of same-column input points.
+ */
+[[nodiscard]] std::vector<glm::vec2> decimateMinMax(std::span<glm::vec2 const> points, float bucket_width);
+
+/**
+ * @brief RGBA8 canvas that glyph batches can be flattened into and embedded as a PNG `<image>`.
+ *
+ * Draw calls take canvas pixels; the layer stores `scale` device pixels per canvas pixel so the
+ * raster matches the export resolution. Compositing is source-over with straight
+ * (non-premultiplied) alpha onto a transparent canvas. The PNG is zlib-deflated, so mostly
+ * empty or flat-colored layers stay small; the payload is bounded by the raster size rather
+ * than the glyph count.
+ */
+class RasterLayer {
+public:
+    /**
+     * @param width  Canvas width in canvas pixels
+     * @param height Canvas height in canvas pixels
+     * @param scale  Device pixels per canvas pixel (see rasterScale())
+     *
+     * @pre `width > 0`, `height > 0` and `scale > 0` (enforcement: runtime_check — otherwise the
+     *      layer is empty and ignores draws) [LOW]
+     */
+    RasterLayer(int width, int height, float scale = 1.0f);
+
+    /// Raster size in device pixels
+    [[nodiscard]] int width() const { return _width; }
+    [[nodiscard]] int height() const { return _height; }
+    [[nodiscard]] float scale() const { return _scale; }
+
+    /**
+     * @brief Composite an axis-aligned rectangle in canvas pixels; covers device pixels whose
+     *        centers lie inside it, and at least one per axis so hairlines stay visible.
+     */
+    void fillRect(float x0, float y0, float x1, float y1, glm::vec4 const & color);
+
+    /**
+     * @brief Composite a disc of radius `radius` canvas pixels centered at (`cx`, `cy`).
+     */
+    void fillCircle(float cx, float cy, float radius, glm::vec4 const & color);
+
+    /**
+     * @brief RGBA bytes of device pixel (`x`, `y`).
+     *
+     * @pre `0 <= x < width()` and `0 <= y < height()` (enforcement: none) [CRITICAL]
+     */
+    [[nodiscard]] std::array<std::uint8_t, 4> pixel(int x, int y) const;
+
+    /**
+     * @brief Whether any pixel has been drawn.
+     */
+    [[nodiscard]] bool empty() const { return _dirty_max_x < _dirty_min_x; }
+
+    /**
+     * @brief Encode the whole layer as a PNG byte string.
+     */
+    [[nodiscard]] std::string toPNG() const;
+
+    /**
+     * @brief `<image>` element with the drawn region inlined as a base64 PNG data URI.
+     *
+     * Only the bounding box of drawn pixels is encoded and placed at its canvas offset.
+     *
+     * @post Returns an empty string when nothing was drawn or encoding failed.
+     */
+    [[nodiscard]] std::string toSVGImageElement() const;
+
+private:
+    void _blend(int x, int y, glm::vec4 const & color);
+    [[nodiscard]] std::string _encodePNG(int x0, int y0, int width, int height) const;
+
+    int _width{0};
+    int _height{0};
+    float _scale{1.0f};
+    std::vector<std::uint8_t> _rgba;
+    int _dirty_min_x{0};
+    int _dirty_min_y{0};
+    int _dirty_max_x{-1};
+    int _dirty_max_y{-1};
+};
+
+}// namespace PlottingSVG
+
+#endif// PLOTTINGSVG_SVGSIMPLIFICATION_HPP
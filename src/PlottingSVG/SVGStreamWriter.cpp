@@ -0,0 +1,62 @@
+/**
+ * @file SVGStreamWriter.cpp
+ * @brief Streaming SVG XML output for PlottingSVG exports.
+ */
+
+#include "PlottingSVG/SVGStreamWriter.hpp"
+
+#include <ostream>
+
+namespace PlottingSVG {
+
+SVGStreamWriter::SVGStreamWriter(std::ostream & out,
+                                 int width,// NOLINT(bugprone-easily-swappable-parameters)
+                                 int height)
+    : _out(out),
+      _width(width),
+      _height(height) {
+}
+
+void SVGStreamWriter::writeHeader(std::string const & background_hex, std::string const & description) {
+    _out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+    _out << "<svg xmlns=\"http://www.w3.org/2000/svg\" ";
+    _out << "width=\"" << _width << "\" height=\"" << _height << "\" ";
+    _out << "viewBox=\"0 0 " << _width << " " << _height << "\">\n";
+    if (!description.empty()) {
+        _out << "  <desc>" << description << "</desc>\n";
+    }
+    _out << R"(  <rect width="100%" height="100%" fill=")" << background_hex << R"("/>)" << '\n';
+}
+
+void SVGStreamWriter::beginLayer(std::string const & layer_name) {
+    endLayer();
+    _out << "  <g id=\"" << layer_name << "\">\n";
+    _layer_open = true;
+}
+
+void SVGStreamWriter::writeElement(std::string_view element) {
+    _out << "    " << element << '\n';
+}
+
+void SVGStreamWriter::endLayer() {
+    if (_layer_open) {
+        _out << "  </g>\n";
+        _layer_open = false;
+    }
+}
+
+void SVGStreamWriter::finish() {
+    if (_finished) {
+        return;
+    }
+    endLayer();
+    _out << "</svg>\n";
+    _out.flush();
+    _finished = true;
+}
+
+bool SVGStreamWriter::good() const {
+    return static_cast<bool>(_out);
+}
+
+}// namespace PlottingSVG
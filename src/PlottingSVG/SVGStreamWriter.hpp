@@ -0,0 +1,82 @@
+#ifndef PLOTTINGSVG_SVGSTREAMWRITER_HPP
+#define PLOTTINGSVG_SVGSTREAMWRITER_HPP
+
+/**
+ * @file SVGStreamWriter.hpp
+ * @brief Writes an SVG document to an output stream one element at a time.
+ */
+
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace PlottingSVG {
+
+/**
+ * @brief Streaming counterpart of `SVGDocument`: same document layout, nothing held in memory.
+ *
+ * Output matches `SVGDocument::build()` for the same header, layers, and elements: XML declaration,
+ * root `<svg>`, optional `<desc>`, full-canvas background `<rect>`, then one `<g id="…">` per layer.
+ * Layers are written in the order they are opened and cannot be reopened later. Like `SVGDocument`,
+ * nothing is escaped or validated.
+ */
+class SVGStreamWriter {
+public:
+    /**
+     * @brief Bind the writer to `out`; nothing is written until `writeHeader()`.
+     *
+     * @pre `out` must outlive the writer (enforcement: none) [CRITICAL]
+     * @pre `width > 0` and `height > 0` for a conventional pixel canvas (enforcement: none) [IMPORTANT]
+     */
+    SVGStreamWriter(std::ostream & out, int width, int height);
+
+    /**
+     * @brief Write the XML declaration, root `<svg>`, optional `<desc>`, and background `<rect>`.
+     *
+     * @pre Called once, before any layer (enforcement: none) [IMPORTANT]
+     * @pre `background_hex` and `description` follow the `SVGDocument::setBackground` /
+     *      `setDescription` rules (enforcement: none) [IMPORTANT]
+     */
+    void writeHeader(std::string const & background_hex, std::string const & description);
+
+    /**
+     * @brief Open `<g id="layer_name">`, closing the previous layer if one is open.
+     *
+     * @pre `layer_name` must be safe inside a double-quoted `id="…"` attribute (enforcement: none)
+     *      [IMPORTANT]
+     */
+    void beginLayer(std::string const & layer_name);
+
+    /**
+     * @brief Write one element (indented, newline-terminated) into the open layer.
+     *
+     * @pre A layer is open (enforcement: none) [LOW]
+     */
+    void writeElement(std::string_view element);
+
+    /**
+     * @brief Close the open layer, if any.
+     */
+    void endLayer();
+
+    /**
+     * @brief Close any open layer and write `</svg>`. Further calls are no-ops.
+     */
+    void finish();
+
+    /**
+     * @brief Whether the underlying stream is still good.
+     */
+    [[nodiscard]] bool good() const;
+
+private:
+    std::ostream & _out;
+    int _width{};
+    int _height{};
+    bool _layer_open{false};
+    bool _finished{false};
+};
+
+}// namespace PlottingSVG
+
+#endif// PLOTTINGSVG_SVGSTREAMWRITER_HPP
@@ -8,10 +8,20 @@
 
 #include <glm/glm.hpp>
 
+#include <functional>
 #include <string>
+#include <string_view>
 
 namespace PlottingSVG {
 
+/**
+ * @brief Receives SVG element strings one at a time, in document order.
+ *
+ * Used by the batch renderers to hand each element to a stream as soon as it is formatted. The view is
+ * only valid for the duration of the call.
+ */
+using SVGElementSink = std::function<void(std::string_view)>;
+
 /**
  * @brief Apply `mvp` to a homogeneous world-space vertex and map the result to SVG pixel coordinates.
  *
@@ -0,0 +1,439 @@
+#ifndef BATCH_KALMAN_FILTER_HPP
+#define BATCH_KALMAN_FILTER_HPP
+
+#include "Common.hpp"
+#include "Filter/Kalman/KalmanKernels.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+
+#include <Eigen/Dense>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace StateEstimation {
+
+/**
+ * @brief Kalman filter over many independent tracks that share one model.
+ *
+ * Tracks are stored structure-of-arrays: the mean is an N x StateDim array and
+ * the covariance an N x StateDim^2 array, so every matrix element of every
+ * track sits in one contiguous column. Predict and update are written as
+ * column-wise arithmetic over blocks of tracks, which Eigen vectorizes across
+ * tracks instead of across the (tiny) state dimension. Blocks run on the
+ * shared thread pool.
+ *
+ * The update factors each innovation covariance with an in-place Cholesky
+ * decomposition and solves for the gain; no inverse is formed. Results match
+ * KalmanFilterT to rounding for positive-definite innovation covariances.
+ *
+ * Dimensions are fixed at compile time; dynamic-size models use KalmanFilter.
+ *
+ * @tparam StateDim Number of state variables (> 0)
+ * @tparam MeasDim Number of measured variables (> 0)
+ */
+template<int StateDim, int MeasDim>
+class BatchKalmanFilter {
+    static_assert(StateDim > 0 && MeasDim > 0, "BatchKalmanFilter requires fixed dimensions");
+
+public:
+    using StateVec = Eigen::Matrix<double, StateDim, 1>;
+    using StateMat = Eigen::Matrix<double, StateDim, StateDim>;
+    using MeasMat = Eigen::Matrix<double, MeasDim, StateDim>;
+    using MeasCov = Eigen::Matrix<double, MeasDim, MeasDim>;
+    /// One measurement per row, one row per track
+    using MeasurementBlock = Eigen::Matrix<double, Eigen::Dynamic, MeasDim>;
+
+    /// Tracks per parallel work item; small enough that a block's temporaries stay in cache
+    static constexpr std::size_t default_chunk_tracks = 256;
+
+    BatchKalmanFilter(StateMat const & F,
+                      MeasMat const & H,
+                      StateMat const & Q,
+                      MeasCov const & R)
+        : _F(F),
+          _H(H),
+          _Q(Q),
+          _R(R) {}
+
+    /**
+     * @brief Grow or shrink the batch; new tracks start at zero mean and identity covariance
+     */
+    void resize(std::size_t num_tracks) {
+        auto const old_size = numTracks();
+        _x.conservativeResize(static_cast<Eigen::Index>(num_tracks), Eigen::NoChange);
+        _P.conservativeResize(static_cast<Eigen::Index>(num_tracks), Eigen::NoChange);
+        for (std::size_t t = old_size; t < num_tracks; ++t) {
+            setState(t, StateVec::Zero(), StateMat::Identity());
+        }
+    }
+
+    [[nodiscard]] std::size_t numTracks() const { return static_cast<std::size_t>(_x.rows()); }
+
+    /**
+     * @brief Set the tracks processed per parallel work item
+     */
+    void setChunkTracks(std::size_t chunk_tracks) { _chunk_tracks = chunk_tracks; }
+
+    /**
+     * @brief Set the mean and covariance of one track
+     *
+     * @pre `track < numTracks()` (enforcement: runtime_check) [CRITICAL]
+     * @pre `state` has StateDim mean and StateDim x StateDim covariance (enforcement: runtime_check) [CRITICAL]
+     */
+    void setState(std::size_t track, FilterState const & state) {
+        if (state.state_mean.size() != StateDim ||
+            state.state_covariance.rows() != StateDim ||
+            state.state_covariance.cols() != StateDim) {
+            throw std::invalid_argument("BatchKalmanFilter::setState: state dimension mismatch");
+        }
+        setState(track, StateVec(state.state_mean), StateMat(state.state_covariance));
+    }
+
+    /**
+     * @brief Mean and covariance of one track
+     *
+     * @pre `track < numTracks()` (enforcement: runtime_check) [CRITICAL]
+     */
+    [[nodiscard]] FilterState getState(std::size_t track) const {
+        checkTrack(track);
+        auto const row = static_cast<Eigen::Index>(track);
+        FilterState state;
+        state.state_mean = _x.row(row).transpose().matrix();
+        state.state_covariance.resize(StateDim, StateDim);
+        for (int j = 0; j < StateDim; ++j) {
+            for (int i = 0; i < StateDim; ++i) {
+                state.state_covariance(i, j) = _P(row, cov(i, j));
+            }
+        }
+        return state;
+    }
+
+    /**
+     * @brief Advance every track by one step of the motion model
+     */
+    void predict() {
+        CoreUtilities::parallelForChunks(0, numTracks(), _chunk_tracks, [this](std::size_t lo, std::size_t hi) {
+            predictBlock(static_cast<Eigen::Index>(lo), static_cast<Eigen::Index>(hi - lo));
+        });
+    }
+
+    /**
+     * @brief Correct tracks with one measurement each
+     *
+     * @param measurements Row t is the measurement of track t
+     * @param noise_scale Per-track factor applied to R; empty means 1 for every track
+     * @param observed Per-track flag; tracks with a zero flag keep their predicted
+     *        state, and their measurement and noise_scale entries are ignored (they
+     *        may be NaN). Empty means every track is observed.
+     *
+     * @pre `measurements.rows() == numTracks()` (enforcement: runtime_check) [CRITICAL]
+     * @pre `noise_scale` and `observed` are empty or have numTracks() entries (enforcement: runtime_check) [CRITICAL]
+     */
+    void update(MeasurementBlock const & measurements,
+                std::span<double const> noise_scale = {},
+                std::span<std::uint8_t const> observed = {}) {
+        auto const n = numTracks();
+        if (static_cast<std::size_t>(measurements.rows()) != n ||
+            (!noise_scale.empty() && noise_scale.size() != n) ||
+            (!observed.empty() && observed.size() != n)) {
+            throw std::invalid_argument("BatchKalmanFilter::update: per-track inputs must match numTracks()");
+        }
+        CoreUtilities::parallelForChunks(0, n, _chunk_tracks, [&](std::size_t lo, std::size_t hi) {
+            updateBlock(static_cast<Eigen::Index>(lo), static_cast<Eigen::Index>(hi - lo),
+                        measurements, noise_scale, observed);
+        });
+    }
+
+    /**
+     * @brief RTS-smooth independent tracklets in parallel
+     *
+     * Each tracklet is a forward pass of per-frame filter states; tracklets
+     * may differ in length.
+     *
+     * @pre Every state has StateDim dimensions (enforcement: runtime_check) [CRITICAL]
+     */
+    [[nodiscard]] std::vector<std::vector<FilterState>>
+    smooth(std::vector<std::vector<FilterState>> const & tracklets) const {
+        for (auto const & tracklet: tracklets) {
+            for (auto const & state: tracklet) {
+                if (state.state_mean.size() != StateDim ||
+                    state.state_covariance.rows() != StateDim ||
+                    state.state_covariance.cols() != StateDim) {
+                    throw std::invalid_argument("BatchKalmanFilter::smooth: state dimension mismatch");
+                }
+            }
+        }
+        std::vector<std::vector<FilterState>> smoothed(tracklets.size());
+        CoreUtilities::parallelForChunks(0, tracklets.size(), 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t i = lo; i < hi; ++i) {
+                smoothed[i] = KalmanKernels::rtsSmooth<StateVec>(tracklets[i], _F, _Q);
+            }
+        });
+        return smoothed;
+    }
+
+private:
+    static constexpr int CovCols = StateDim * StateDim;
+    static constexpr int GainCols = StateDim * MeasDim;
+    static constexpr int InnovCols = MeasDim * MeasDim;
+
+    using Column = Eigen::Array<double, Eigen::Dynamic, 1>;
+    using StateBlock = Eigen::Array<double, Eigen::Dynamic, StateDim>;
+    using CovBlock = Eigen::Array<double, Eigen::Dynamic, CovCols>;
+    using GainBlock = Eigen::Array<double, Eigen::Dynamic, GainCols>;
+    using MeasBlock = Eigen::Array<double, Eigen::Dynamic, MeasDim>;
+    using InnovBlock = Eigen::Array<double, Eigen::Dynamic, InnovCols>;
+
+    /// Column of element (i, j) of a StateDim x StateDim matrix
+    static constexpr Eigen::Index cov(int i, int j) { return i + j * StateDim; }
+    /// Column of element (i, a) of a StateDim x MeasDim matrix
+    static constexpr Eigen::Index gain(int i, int a) { return i + a * StateDim; }
+    /// Column of element (a, b) of a MeasDim x MeasDim matrix
+    static constexpr Eigen::Index innov(int a, int b) { return a + b * MeasDim; }
+
+    StateMat _F;
+    MeasMat _H;
+    StateMat _Q;
+    MeasCov _R;
+    StateBlock _x = StateBlock(0, StateDim);
+    CovBlock _P = CovBlock(0, CovCols);
+    std::size_t _chunk_tracks = default_chunk_tracks;
+
+    void checkTrack(std::size_t track) const {
+        if (track >= numTracks()) {
+            throw std::out_of_range("BatchKalmanFilter: track " + std::to_string(track) + " out of range");
+        }
+    }
+
+    void setState(std::size_t track, StateVec const & mean, StateMat const & covariance) {
+        checkTrack(track);
+        auto const row = static_cast<Eigen::Index>(track);
+        _x.row(row) = mean.transpose().array();
+        for (int j = 0; j < StateDim; ++j) {
+            for (int i = 0; i < StateDim; ++i) {
+                _P(row, cov(i, j)) = covariance(i, j);
+            }
+        }
+    }
+
+    /// Write the upper triangle of `src` into `dst`, mirrored
+    static void storeSymmetric(auto && dst, CovBlock const & src) {
+        for (int j = 0; j < StateDim; ++j) {
+            for (int i = 0; i <= j; ++i) {
+                dst.col(cov(i, j)) = src.col(cov(i, j));
+                dst.col(cov(j, i)) = src.col(cov(i, j));
+            }
+        }
+    }
+
+    void predictBlock(Eigen::Index lo, Eigen::Index len) {
+        auto X = _x.middleRows(lo, len);
+        auto P = _P.middleRows(lo, len);
+
+        // x <- F x; motion models are sparse, so zero entries are skipped
+        StateBlock x_new = StateBlock::Zero(len, StateDim);
+        for (int i = 0; i < StateDim; ++i) {
+            for (int j = 0; j < StateDim; ++j) {
+                if (_F(i, j) != 0.0) {
+                    x_new.col(i) += _F(i, j) * X.col(j);
+                }
+            }
+        }
+        X = x_new;
+
+        // FP = F P
+        CovBlock FP = CovBlock::Zero(len, CovCols);
+        for (int i = 0; i < StateDim; ++i) {
+            for (int k = 0; k < StateDim; ++k) {
+                if (_F(i, k) == 0.0) {
+                    continue;
+                }
+                for (int j = 0; j < StateDim; ++j) {
+                    FP.col(cov(i, j)) += _F(i, k) * P.col(cov(k, j));
+                }
+            }
+        }
+
+        // P <- FP F^T + Q, upper triangle then mirrored
+        CovBlock P_new(len, CovCols);
+        for (int j = 0; j < StateDim; ++j) {
+            for (int i = 0; i <= j; ++i) {
+                auto col = P_new.col(cov(i, j));
+                col.setConstant(kSymmetrizeHalf * (_Q(i, j) + _Q(j, i)));
+                for (int k = 0; k < StateDim; ++k) {
+                    if (_F(j, k) != 0.0) {
+                        col += _F(j, k) * FP.col(cov(i, k));
+                    }
+                }
+            }
+        }
+        storeSymmetric(P, P_new);
+    }
+
+    void updateBlock(Eigen::Index lo,
+                     Eigen::Index len,
+                     MeasurementBlock const & measurements,
+                     std::span<double const> noise_scale,
+                     std::span<std::uint8_t const> observed) {
+        auto X = _x.middleRows(lo, len);
+        auto P = _P.middleRows(lo, len);
+
+        Column scale = Column::Ones(len);
+        if (!noise_scale.empty()) {
+            scale = Eigen::Map<Column const>(noise_scale.data() + lo, len);
+        }
+        Column mask = Column::Ones(len);
+        if (!observed.empty()) {
+            for (Eigen::Index t = 0; t < len; ++t) {
+                mask(t) = observed[static_cast<std::size_t>(lo + t)] != 0 ? 1.0 : 0.0;
+            }
+            scale = (mask > 0.0).select(scale, 1.0);
+        }
+
+        // Innovation y = z - H x
+        MeasBlock y = measurements.middleRows(lo, len).array();
+        for (int a = 0; a < MeasDim; ++a) {
+            for (int j = 0; j < StateDim; ++j) {
+                if (_H(a, j) != 0.0) {
+                    y.col(a) -= _H(a, j) * X.col(j);
+                }
+            }
+            // Unobserved rows may hold placeholders such as NaN; 0 * NaN would still poison x
+            y.col(a) = (mask > 0.0).select(y.col(a), 0.0);
+        }
+
+        // PHt = P H^T
+        GainBlock PHt = GainBlock::Zero(len, GainCols);
+        for (int a = 0; a < MeasDim; ++a) {
+            for (int j = 0; j < StateDim; ++j) {
+                if (_H(a, j) == 0.0) {
+                    continue;
+                }
+                for (int i = 0; i < StateDim; ++i) {
+                    PHt.col(gain(i, a)) += _H(a, j) * P.col(cov(i, j));
+                }
+            }
+        }
+
+        // Lower triangle of S = H P H^T + s R, factored in place into L L^T
+        InnovBlock L(len, InnovCols);
+        for (int b = 0; b < MeasDim; ++b) {
+            for (int a = b; a < MeasDim; ++a) {
+                auto col = L.col(innov(a, b));
+                col = scale * (kSymmetrizeHalf * (_R(a, b) + _R(b, a)));
+                for (int i = 0; i < StateDim; ++i) {
+                    if (_H(a, i) != 0.0) {
+                        col += _H(a, i) * PHt.col(gain(i, b));
+                    }
+                }
+            }
+        }
+        MeasBlock inv_diag(len, MeasDim);
+        for (int j = 0; j < MeasDim; ++j) {
+            Column d = L.col(innov(j, j));
+            for (int k = 0; k < j; ++k) {
+                d -= L.col(innov(j, k)).square();
+            }
+            // A singular S has no Cholesky factor; clamping keeps the block finite
+            d = d.max(std::numeric_limits<double>::min()).sqrt();
+            L.col(innov(j, j)) = d;
+            inv_diag.col(j) = d.inverse();
+            for (int i = j + 1; i < MeasDim; ++i) {
+                Column v = L.col(innov(i, j));
+                for (int k = 0; k < j; ++k) {
+                    v -= L.col(innov(i, k)) * L.col(innov(j, k));
+                }
+                L.col(innov(i, j)) = v * inv_diag.col(j);
+            }
+        }
+
+        // K = PHt S^-1: each state row solves L L^T k = PHt(i, :)
+        GainBlock K(len, GainCols);
+        MeasBlock w(len, MeasDim);
+        for (int i = 0; i < StateDim; ++i) {
+            for (int a = 0; a < MeasDim; ++a) {
+                Column v = PHt.col(gain(i, a));
+                for (int c = 0; c < a; ++c) {
+                    v -= L.col(innov(a, c)) * w.col(c);
+                }
+                w.col(a) = v * inv_diag.col(a);
+            }
+            for (int a = MeasDim - 1; a >= 0; --a) {
+                Column v = w.col(a);
+                for (int c = a + 1; c < MeasDim; ++c) {
+                    v -= L.col(innov(c, a)) * K.col(gain(i, c));
+                }
+                K.col(gain(i, a)) = v * inv_diag.col(a);
+            }
+            // Unobserved tracks get a zero gain, which leaves x and P unchanged
+            for (int a = 0; a < MeasDim; ++a) {
+                K.col(gain(i, a)) = (mask > 0.0).select(K.col(gain(i, a)), 0.0);
+            }
+        }
+
+        // x <- x + K y
+        for (int i = 0; i < StateDim; ++i) {
+            for (int a = 0; a < MeasDim; ++a) {
+                X.col(i) += K.col(gain(i, a)) * y.col(a);
+            }
+        }
+
+        // Joseph form: P <- A P A^T + s K R K^T with A = I - K H
+        CovBlock A(len, CovCols);
+        for (int j = 0; j < StateDim; ++j) {
+            for (int i = 0; i < StateDim; ++i) {
+                auto col = A.col(cov(i, j));
+                col.setConstant(i == j ? 1.0 : 0.0);
+                for (int a = 0; a < MeasDim; ++a) {
+                    if (_H(a, j) != 0.0) {
+                        col -= _H(a, j) * K.col(gain(i, a));
+                    }
+                }
+            }
+        }
+        CovBlock AP = CovBlock::Zero(len, CovCols);
+        for (int j = 0; j < StateDim; ++j) {
+            for (int i = 0; i < StateDim; ++i) {
+                for (int k = 0; k < StateDim; ++k) {
+                    AP.col(cov(i, j)) += A.col(cov(i, k)) * P.col(cov(k, j));
+                }
+            }
+        }
+        GainBlock KR = GainBlock::Zero(len, GainCols);
+        for (int b = 0; b < MeasDim; ++b) {
+            for (int a = 0; a < MeasDim; ++a) {
+                if (_R(a, b) != 0.0) {
+                    for (int i = 0; i < StateDim; ++i) {
+                        KR.col(gain(i, b)) += _R(a, b) * K.col(gain(i, a));
+                    }
+                }
+            }
+        }
+        CovBlock P_new(len, CovCols);
+        for (int j = 0; j < StateDim; ++j) {
+            for (int i = 0; i <= j; ++i) {
+                auto col = P_new.col(cov(i, j));
+                col.setZero();
+                for (int k = 0; k < StateDim; ++k) {
+                    col += AP.col(cov(i, k)) * A.col(cov(j, k));
+                }
+                Column noise = Column::Zero(len);
+                for (int b = 0; b < MeasDim; ++b) {
+                    noise += KR.col(gain(i, b)) * K.col(gain(j, b));
+                }
+                col += scale * noise;
+            }
+        }
+        storeSymmetric(P, P_new);
+    }
+};
+
+}// namespace StateEstimation
+
+#endif// BATCH_KALMAN_FILTER_HPP
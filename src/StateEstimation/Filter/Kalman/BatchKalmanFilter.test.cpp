@@ -0,0 +1,182 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Filter/Kalman/BatchKalmanFilter.hpp"
+#include "Filter/Kalman/KalmanFilterT.hpp"
+
+#include <Eigen/Dense>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace StateEstimation;
+
+namespace {
+
+using Batch = BatchKalmanFilter<4, 2>;
+using Single = KalmanFilterT<4, 2>;
+
+/// Constant-velocity model in 2D with position measurements
+struct ConstantVelocityModel {
+    Eigen::Matrix4d F;
+    Eigen::Matrix<double, 2, 4> H;
+    Eigen::Matrix4d Q;
+    Eigen::Matrix2d R;
+
+    ConstantVelocityModel() {
+        double const dt = 1.0;
+        F << 1, 0, dt, 0,
+                0, 1, 0, dt,
+                0, 0, 1, 0,
+                0, 0, 0, 1;
+        H << 1, 0, 0, 0,
+                0, 1, 0, 0;
+        Q = Eigen::Matrix4d::Identity() * 0.1;
+        Q(0, 2) = Q(2, 0) = 0.02;
+        R << 4.0, 0.5,
+                0.5, 2.0;
+    }
+};
+
+FilterState randomState(std::mt19937 & rng) {
+    std::uniform_real_distribution<double> dist(-10.0, 10.0);
+    Eigen::Matrix4d A;
+    for (int i = 0; i < 16; ++i) {
+        A(i) = dist(rng) * 0.1;
+    }
+    FilterState state;
+    state.state_mean = Eigen::Vector4d(dist(rng), dist(rng), dist(rng) * 0.1, dist(rng) * 0.1);
+    state.state_covariance = A * A.transpose() + Eigen::Matrix4d::Identity();
+    return state;
+}
+
+void requireClose(FilterState const & a, FilterState const & b, double tol = 1e-9) {
+    REQUIRE(a.state_mean.size() == b.state_mean.size());
+    REQUIRE((a.state_mean - b.state_mean).cwiseAbs().maxCoeff() < tol);
+    REQUIRE((a.state_covariance - b.state_covariance).cwiseAbs().maxCoeff() < tol);
+}
+
+}// namespace
+
+TEST_CASE("BatchKalmanFilter - predict and update match single-track filter", "[BatchKalmanFilter]") {
+    ConstantVelocityModel const model;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> noise(-1.0, 1.0);
+
+    std::size_t const num_tracks = 1000;
+    Batch batch(model.F, model.H, model.Q, model.R);
+    batch.setChunkTracks(64);
+    batch.resize(num_tracks);
+
+    std::vector<Single> singles;
+    for (std::size_t t = 0; t < num_tracks; ++t) {
+        auto const initial = randomState(rng);
+        batch.setState(t, initial);
+        singles.emplace_back(model.F, model.H, model.Q, model.R);
+        singles.back().initialize(initial);
+    }
+
+    std::vector<double> scales(num_tracks);
+    std::vector<std::uint8_t> observed(num_tracks);
+    for (int step = 0; step < 5; ++step) {
+        batch.predict();
+        Batch::MeasurementBlock z(num_tracks, 2);
+        for (std::size_t t = 0; t < num_tracks; ++t) {
+            auto const pred = singles[t].predict();
+            z(static_cast<Eigen::Index>(t), 0) = pred.state_mean(0) + noise(rng);
+            z(static_cast<Eigen::Index>(t), 1) = pred.state_mean(1) + noise(rng);
+            scales[t] = 1.0 + static_cast<double>(t % 3);
+            observed[t] = (t + static_cast<std::size_t>(step)) % 5 != 0;
+            if (observed[t]) {
+                Measurement m;
+                m.feature_vector = z.row(static_cast<Eigen::Index>(t)).transpose();
+                singles[t].update(pred, m, scales[t]);
+            }
+        }
+        batch.update(z, scales, observed);
+    }
+
+    for (std::size_t t = 0; t < num_tracks; t += 37) {
+        requireClose(batch.getState(t), singles[t].getState());
+    }
+}
+
+TEST_CASE("BatchKalmanFilter - smoothing matches single-track filter", "[BatchKalmanFilter]") {
+    ConstantVelocityModel const model;
+    std::mt19937 rng(7);
+
+    std::vector<std::vector<FilterState>> tracklets;
+    for (std::size_t len: {0, 1, 2, 25, 60}) {
+        Single filter(model.F, model.H, model.Q, model.R);
+        filter.initialize(randomState(rng));
+        std::vector<FilterState> forward;
+        for (std::size_t k = 0; k < len; ++k) {
+            auto const pred = filter.predict();
+            Measurement m;
+            m.feature_vector = pred.state_mean.head(2) + Eigen::Vector2d(0.3, -0.2);
+            forward.push_back(filter.update(pred, m));
+        }
+        tracklets.push_back(std::move(forward));
+    }
+
+    Batch const batch(model.F, model.H, model.Q, model.R);
+    auto const smoothed = batch.smooth(tracklets);
+
+    REQUIRE(smoothed.size() == tracklets.size());
+    for (std::size_t i = 0; i < tracklets.size(); ++i) {
+        Single single(model.F, model.H, model.Q, model.R);
+        auto const expected = single.smooth(tracklets[i]);
+        REQUIRE(smoothed[i].size() == expected.size());
+        for (std::size_t k = 0; k < expected.size(); ++k) {
+            requireClose(smoothed[i][k], expected[k]);
+        }
+    }
+}
+
+TEST_CASE("BatchKalmanFilter - input validation", "[BatchKalmanFilter]") {
+    ConstantVelocityModel const model;
+    Batch batch(model.F, model.H, model.Q, model.R);
+    batch.resize(3);
+
+    FilterState const initial = batch.getState(2);
+    REQUIRE(initial.state_mean.isZero());
+    REQUIRE(initial.state_covariance.isIdentity());
+
+    FilterState wrong;
+    wrong.state_mean = Eigen::VectorXd::Zero(3);
+    wrong.state_covariance = Eigen::MatrixXd::Identity(3, 3);
+    REQUIRE_THROWS_AS(batch.setState(0, wrong), std::invalid_argument);
+    REQUIRE_THROWS_AS(batch.getState(3), std::out_of_range);
+    REQUIRE_THROWS_AS(batch.update(Batch::MeasurementBlock::Zero(2, 2)), std::invalid_argument);
+}
+
+TEST_CASE("BatchKalmanFilter - unobserved NaN rows keep the predicted state", "[BatchKalmanFilter]") {
+    ConstantVelocityModel const model;
+    std::mt19937 rng(7);
+
+    Batch batch(model.F, model.H, model.Q, model.R);
+    batch.resize(3);
+    for (std::size_t t = 0; t < 3; ++t) {
+        batch.setState(t, randomState(rng));
+    }
+    batch.predict();
+    auto const predicted = batch.getState(1);
+
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    Batch::MeasurementBlock z(3, 2);
+    z << 1.0, 2.0,
+            nan, nan,
+            3.0, 4.0;
+    std::vector<double> const scales{1.0, nan, 1.0};
+    std::vector<std::uint8_t> const observed{1, 0, 1};
+    batch.update(z, scales, observed);
+
+    requireClose(batch.getState(1), predicted, 1e-12);
+    for (std::size_t t: {std::size_t{0}, std::size_t{2}}) {
+        auto const state = batch.getState(t);
+        REQUIRE(state.state_mean.allFinite());
+        REQUIRE(state.state_covariance.allFinite());
+    }
+}
@@ -2,6 +2,7 @@
 #define KALMAN_FILTER_T_HPP
 
 #include "Filter/IFilter.hpp"
+#include "Filter/Kalman/KalmanKernels.hpp"
 
 #include <Eigen/Dense>
 #include <cstddef>
@@ -22,8 +23,6 @@ struct KalmanDiagnostics {
     std::size_t dimensionMismatches = 0;
 };
 
-constexpr double kSymmetrizeHalf = 0.5;
-
 /**
  * @brief Fixed-size Kalman filter for tests and high-assurance contexts.
  *
@@ -83,10 +82,7 @@ public:
     }
 
     FilterState predict() override {
-        x_ = F_ * x_;
-        P_ = F_ * P_ * F_.transpose() + Q_;
-        // Symmetrize to counteract numerical asymmetry
-        P_ = (P_ + P_.transpose()) * kSymmetrizeHalf;
+        KalmanKernels::predict(x_, P_, F_, Q_);
         return toFilterState();
     }
 
@@ -101,48 +97,19 @@ public:
             return toFilterState();
         }
 
-        StateVec x_pred = predicted_state.state_mean;
-        StateMat P_pred = predicted_state.state_covariance;
-        MeasVec z = measurement.feature_vector;
-
+        x_ = predicted_state.state_mean;
+        P_ = predicted_state.state_covariance;
+        MeasVec const z = measurement.feature_vector;
         MeasCov const R_scaled = static_cast<double>(noise_scale_factor) * R_;
-        MeasVec const y = z - H_ * x_pred;
-        MeasCov S = H_ * P_pred * H_.transpose() + R_scaled;
-        Eigen::Matrix<double, StateDim, MeasDim> K = P_pred * H_.transpose() * S.inverse();
-
-        x_ = x_pred + K * y;
-        StateMat I;
-        if constexpr (StateDim == Eigen::Dynamic) {
-            I.resize(F_.rows(), F_.rows());
-        }
-        I.setIdentity();
-        StateMat A = I - K * H_;
-        P_ = A * P_pred * A.transpose() + K * R_scaled * K.transpose();
-        P_ = (P_ + P_.transpose()) * kSymmetrizeHalf;
+        KalmanKernels::update(x_, P_, z, H_, R_scaled);
         return toFilterState();
     }
 
     std::vector<FilterState> smooth(std::vector<FilterState> const & forward_states) override {
-        if (forward_states.empty()) return {};
-        std::vector<FilterState> smoothed = forward_states;
-        for (std::size_t k = forward_states.size() - 1; k-- > 0; ) {
-            FilterState const & fwd_k = forward_states[k];
-            FilterState const & sm_k1 = smoothed[k + 1];
-            enforceDims(fwd_k);
-            enforceDims(sm_k1);
-            StateVec xk = fwd_k.state_mean;
-            StateMat Pk = fwd_k.state_covariance;
-            StateVec x_pred = F_ * xk;
-            StateMat P_pred = F_ * Pk * F_.transpose() + Q_;
-            P_pred = (P_pred + P_pred.transpose()) * kSymmetrizeHalf;
-            Eigen::Matrix<double, StateDim, StateDim> Ck = Pk * F_.transpose() * P_pred.inverse();
-            StateVec x_sm = xk + Ck * (sm_k1.state_mean - x_pred);
-            StateMat P_sm = Pk + Ck * (sm_k1.state_covariance - P_pred) * Ck.transpose();
-            P_sm = (P_sm + P_sm.transpose()) * kSymmetrizeHalf;
-            smoothed[k].state_mean = x_sm;
-            smoothed[k].state_covariance = P_sm;
+        for (auto const & state: forward_states) {
+            enforceDims(state);
         }
-        return smoothed;
+        return KalmanKernels::rtsSmooth<StateVec>(forward_states, F_, Q_);
     }
 
     [[nodiscard]] FilterState getState() const override { return toFilterState(); }
@@ -0,0 +1,106 @@
+#ifndef KALMAN_KERNELS_HPP
+#define KALMAN_KERNELS_HPP
+
+#include <Eigen/Dense>
+
+#include <cstddef>
+#include <vector>
+
+namespace StateEstimation {
+
+/// Weight used when symmetrizing covariances: P <- (P + P^T) * 0.5
+constexpr double kSymmetrizeHalf = 0.5;
+
+namespace KalmanKernels {
+
+/**
+ * @brief Single-track Kalman steps shared by KalmanFilterT and BatchKalmanFilter.
+ *
+ * All solves use an LDLT factorization of the (symmetric) innovation or
+ * predicted covariance rather than an explicit inverse. The templates accept
+ * fixed-size and dynamic Eigen types alike.
+ */
+
+/**
+ * @brief x <- F x, P <- F P F^T + Q (symmetrized)
+ */
+template<typename StateVec, typename StateMat>
+void predict(StateVec & x, StateMat & P, StateMat const & F, StateMat const & Q) {
+    x = F * x;
+    P = F * P * F.transpose() + Q;
+    P = (P + P.transpose()) * kSymmetrizeHalf;
+}
+
+/**
+ * @brief Measurement update with Joseph-form covariance
+ *
+ * The gain solves `S K^T = H P` (S = H P H^T + R) instead of forming S^-1.
+ *
+ * @pre x, P are the predicted mean and covariance (enforcement: none) [IMPORTANT]
+ */
+template<typename StateVec, typename StateMat, typename MeasVec, typename MeasMat, typename MeasCov>
+void update(StateVec & x,
+            StateMat & P,
+            MeasVec const & z,
+            MeasMat const & H,
+            MeasCov const & R_scaled) {
+    using MeasCovEval = typename MeasCov::PlainObject;
+    using GainT = Eigen::Matrix<double,
+                                StateVec::RowsAtCompileTime,
+                                MeasVec::RowsAtCompileTime>;
+
+    auto const y = (z - H * x).eval();
+    auto const HP = (H * P).eval();
+    MeasCovEval const S = HP * H.transpose() + R_scaled;
+
+    GainT const K = Eigen::LDLT<MeasCovEval>(S).solve(HP).transpose();
+
+    x = x + K * y;
+    StateMat A = -K * H;
+    A.diagonal().array() += 1.0;
+    P = A * P * A.transpose() + K * R_scaled * K.transpose();
+    P = (P + P.transpose()) * kSymmetrizeHalf;
+}
+
+/**
+ * @brief Rauch-Tung-Striebel backward pass over one tracklet.
+ *
+ * The smoother gain solves `P_pred C^T = F P_k` instead of inverting P_pred.
+ *
+ * @tparam StateVec, StateMat Eigen types used for the arithmetic
+ * @tparam State Element type with `state_mean` / `state_covariance` members
+ */
+template<typename StateVec, typename StateMat, typename State>
+std::vector<State> rtsSmooth(std::vector<State> const & forward_states,
+                             StateMat const & F,
+                             StateMat const & Q) {
+    if (forward_states.empty()) {
+        return {};
+    }
+    std::vector<State> smoothed = forward_states;
+    for (std::size_t k = forward_states.size() - 1; k-- > 0;) {
+        StateVec const xk = forward_states[k].state_mean;
+        StateMat const Pk = forward_states[k].state_covariance;
+        StateVec const x_next = smoothed[k + 1].state_mean;
+        StateMat const P_next = smoothed[k + 1].state_covariance;
+
+        StateVec const x_pred = F * xk;
+        StateMat P_pred = F * Pk * F.transpose() + Q;
+        P_pred = (P_pred + P_pred.transpose()) * kSymmetrizeHalf;
+
+        StateMat const Ck = Eigen::LDLT<StateMat>(P_pred).solve(F * Pk).transpose();
+
+        StateVec const x_sm = xk + Ck * (x_next - x_pred);
+        StateMat P_sm = Pk + Ck * (P_next - P_pred) * Ck.transpose();
+        P_sm = (P_sm + P_sm.transpose()) * kSymmetrizeHalf;
+        smoothed[k].state_mean = x_sm;
+        smoothed[k].state_covariance = P_sm;
+    }
+    return smoothed;
+}
+
+}// namespace KalmanKernels
+
+}// namespace StateEstimation
+
+#endif// KALMAN_KERNELS_HPP
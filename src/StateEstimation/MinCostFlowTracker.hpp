@@ -14,20 +14,26 @@
 #include "TimeFrame/TimeFrame.hpp"
 #include "Tracking/AnchorUtils.hpp"
 #include "Tracking/Tracklet.hpp"
+#include "Tracking/TrackletEndpointIndex.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
 
 #include "spdlog/sinks/basic_file_sink.h"
 #include "spdlog/spdlog.h"
 #include <Eigen/Dense>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -218,6 +224,32 @@ public:
     void setAmbiguityThreshold(double threshold) { _ambiguity_threshold = threshold; }
     void setAmbiguityMargin(double margin) { _ambiguity_margin = margin; }
 
+    /**
+     * @brief Gate meta-node transitions in time and space.
+     *
+     * A transition is only added to the flow graph when the next tracklet
+     * starts at most @p max_frame_gap frames after the previous one ends and,
+     * if @p max_distance_per_frame is finite, its first observation lies within
+     * `max_distance_per_frame * gap` of the previous tracklet's last
+     * observation. Distances use the first two filter features (the position
+     * for the built-in extractors).
+     *
+     * @pre max_frame_gap >= 1 (enforcement: none) [IMPORTANT]
+     * @post Defaults (50 frames, no spatial gate) reproduce the ungated graph
+     */
+    void setTransitionGating(int max_frame_gap,
+                             double max_distance_per_frame = std::numeric_limits<double>::infinity()) {
+        _max_transition_gap = max_frame_gap;
+        _transition_gate_per_frame = max_distance_per_frame;
+    }
+
+    /**
+     * @brief Split the range at frames where every group is anchored and solve the windows in parallel.
+     *
+     * Bounds memory by the largest window instead of the whole session. Off by default.
+     */
+    void setWindowedSolving(bool enabled) { _windowed_solving = enabled; }
+
     /**
      * @brief Process a range of frames using min-cost flow optimization.
      *
@@ -337,13 +369,15 @@ private:
      * @param frame_lookup Frame data lookup for cost evaluation
      * @param group_id Group identifier (for logging/diagnostics)
      * @param segment Ground truth segment describing anchors
+     * @param diagnostics Counters updated on solver failure
      * @return Expanded path (sequence of NodeInfo) for the segment; empty on failure
      */
     Path solve_single_segment_flow_over_meta(
             std::vector<MetaNode> const & meta_nodes_trimmed,
             std::map<TimeFrameIndex, FrameBucket<DataType>> const & frame_lookup,
             GroupId group_id,
-            GroundTruthSegment const & segment) {
+            GroundTruthSegment const & segment,
+            TrackerDiagnostics & diagnostics) const {
 
         if (_logger) {
             _logger->debug("Solving single segment flow over meta: group={} start=({}, {}) end=({}, {})",
@@ -384,66 +418,16 @@ private:
         int const sink_node = num_meta + 1;
 
         std::vector<ArcSpec> arcs;
-        arcs.reserve(static_cast<size_t>(num_meta * num_meta / 4 + 4));
         arcs.push_back({source_node, start_meta_index, 1, 0});
         arcs.push_back({end_meta_index, sink_node, 1, 0});
 
         // Build transition arcs (forward in time only)
-        int num_transition_arcs = 0;
-        constexpr int64_t kMaxHorizon = 50;
-        for (int i = 0; i < num_meta; ++i) {
-            MetaNode const & from = meta_nodes_trimmed[static_cast<size_t>(i)];
-            for (int j = 0; j < num_meta; ++j) {
-                MetaNode const & to = meta_nodes_trimmed[static_cast<size_t>(j)];
-                if (to.start_frame <= from.end_frame) continue;
-                int const steps = (to.start_frame - from.end_frame).getValue();
-                if (steps <= 0 || steps > kMaxHorizon) continue;
-
-                FilterState predicted_state;
-                if (_filter_prototype) {
-                    auto temp_filter = _filter_prototype->clone();
-                    // Coerce end_state if needed
-                    FilterState init_state = from.end_state;
-                    int const target_dim = static_cast<int>(temp_filter->getState().state_mean.size());
-                    if (static_cast<int>(init_state.state_mean.size()) != target_dim ||
-                        init_state.state_covariance.rows() != target_dim ||
-                        init_state.state_covariance.cols() != target_dim) {
-                        FilterState coerced;
-                        coerced.state_mean = Eigen::VectorXd::Zero(target_dim);
-                        int const copy_dim = std::min<int>(target_dim, static_cast<int>(init_state.state_mean.size()));
-                        if (copy_dim > 0) coerced.state_mean.head(copy_dim) = init_state.state_mean.head(copy_dim);
-                        coerced.state_covariance = Eigen::MatrixXd::Zero(target_dim, target_dim);
-                        int const cr = std::min<int>(target_dim, init_state.state_covariance.rows());
-                        int const cc = std::min<int>(target_dim, init_state.state_covariance.cols());
-                        if (cr > 0 && cc > 0) {
-                            int const b = std::min(cr, cc);
-                            coerced.state_covariance.topLeftCorner(b, b) = init_state.state_covariance.topLeftCorner(b, b);
-                        }
-                        constexpr double kPadVar = 1e6;
-                        for (int d = 0; d < target_dim; ++d) {
-                            if (coerced.state_covariance(d, d) <= 0.0) coerced.state_covariance(d, d) = kPadVar;
-                        }
-                        init_state = std::move(coerced);
-                    }
-                    temp_filter->initialize(init_state);
-                    for (int s = 0; s < steps; ++s) {
-                        predicted_state = temp_filter->predict();
-                    }
-                }
-
-                DataType const * to_start_data = findEntity(frame_lookup.at(to.start_frame), to.start_entity);
-                if (!to_start_data) continue;
-                Eigen::VectorXd obs = _feature_extractor->getFilterFeatures(*to_start_data);
-                double const dist = _transition_cost_function(predicted_state, obs, steps);
-                int64_t const arc_cost = static_cast<int64_t>(dist * _cost_scale_factor);
-                arcs.push_back({i, j, 1, arc_cost});
-                num_transition_arcs++;
-            }
-        }
+        auto const transition_arcs = build_transition_arcs(meta_nodes_trimmed, frame_lookup);
+        arcs.insert(arcs.end(), transition_arcs.begin(), transition_arcs.end());
 
         auto const seq_opt = solveMinCostSingleUnitPath(num_meta + 2, source_node, sink_node, arcs);
         if (!seq_opt.has_value()) {
-            _diagnostics.noOptimalPathCount += 1;
+            diagnostics.noOptimalPathCount += 1;
             if (_logger) {
                 _logger->error("Min-cost flow failed for segment: group={} metaNodes={} arcs={} — falling back to anchors only",
                                static_cast<unsigned long long>(group_id), num_meta, arcs.size());
@@ -499,6 +483,7 @@ private:
      *
      * For each consecutive labeled segment per group, slice meta-nodes to the segment,
      * run a per-segment min-cost path, and append the nodes to the group's output path.
+     * Groups are independent given the meta-nodes and are solved in parallel.
      *
      * Deduplicates a single overlapping anchor node at segment boundaries.
      */
@@ -507,62 +492,231 @@ private:
             std::map<TimeFrameIndex, FrameBucket<DataType>> const & frame_lookup,
             GroundTruthMap const & ground_truth,
             TimeFrameIndex start_frame,
-            TimeFrameIndex end_frame) {
+            TimeFrameIndex end_frame,
+            TrackerDiagnostics & diagnostics) const {
 
         std::map<GroupId, Path> solved_paths;
         auto const segments = extractGroundTruthSegments(ground_truth);
 
-        // Process segments in chronological order per group
+        // Process segments in chronological order per group. Segments that leave
+        // the requested range cannot find their anchors among the meta-nodes.
         std::map<GroupId, std::vector<GroundTruthSegment>> by_group;
         for (auto const & seg: segments) {
-            // Optionally filter to the requested range
-            if (seg.end_frame < start_frame || seg.start_frame > end_frame) continue;
+            if (seg.start_frame < start_frame || seg.end_frame > end_frame) continue;
             by_group[seg.group_id].push_back(seg);
         }
+        std::vector<std::pair<GroupId, std::vector<GroundTruthSegment> *>> groups;
         for (auto & [gid, segs]: by_group) {
             std::sort(segs.begin(), segs.end(), [](auto const & a, auto const & b) {
                 return a.start_frame < b.start_frame;
             });
-            Path out_path;
-            for (auto const & seg: segs) {
-                auto trimmed = sliceMetaNodesToSegment(meta_nodes, seg);
-                if (trimmed.empty()) {
-                    if (_logger) {
-                        _logger->warn("No trimmed meta-nodes for segment: group={} start=({}, {}) end=({}, {})",
-                                      static_cast<unsigned long long>(gid),
-                                      seg.start_frame.getValue(), seg.start_entity.id,
-                                      seg.end_frame.getValue(), seg.end_entity.id);
-                    }
-                    continue;
-                }
+            groups.emplace_back(gid, &segs);
+        }
 
+        std::vector<Path> group_paths(groups.size());
+        std::vector<TrackerDiagnostics> group_diagnostics(groups.size());
+        CoreUtilities::parallelForChunks(0, groups.size(), 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t g = lo; g < hi; ++g) {
+                group_paths[g] = solve_group_segments(meta_nodes, frame_lookup, groups[g].first,
+                                                      *groups[g].second, group_diagnostics[g]);
+            }
+        });
+
+        for (std::size_t g = 0; g < groups.size(); ++g) {
+            diagnostics.noOptimalPathCount += group_diagnostics[g].noOptimalPathCount;
+            if (!group_paths[g].empty()) {
+                solved_paths.emplace(groups[g].first, std::move(group_paths[g]));
+            }
+        }
+
+        return solved_paths;
+    }
+
+    /**
+     * @brief Solve and concatenate the chronologically sorted segments of one group
+     */
+    Path solve_group_segments(
+            std::vector<MetaNode> const & meta_nodes,
+            std::map<TimeFrameIndex, FrameBucket<DataType>> const & frame_lookup,
+            GroupId gid,
+            std::vector<GroundTruthSegment> const & segs,
+            TrackerDiagnostics & diagnostics) const {
+        Path out_path;
+        for (auto const & seg: segs) {
+            auto trimmed = sliceMetaNodesToSegment(meta_nodes, seg);
+            if (trimmed.empty()) {
                 if (_logger) {
-                    _logger->debug("Solving segment: group={} start=({}, {}) end=({}, {})",
-                                   static_cast<unsigned long long>(gid),
-                                   seg.start_frame.getValue(), seg.start_entity.id,
-                                   seg.end_frame.getValue(), seg.end_entity.id);
+                    _logger->warn("No trimmed meta-nodes for segment: group={} start=({}, {}) end=({}, {})",
+                                  static_cast<unsigned long long>(gid),
+                                  seg.start_frame.getValue(), seg.start_entity.id,
+                                  seg.end_frame.getValue(), seg.end_entity.id);
                 }
+                continue;
+            }
+
+            if (_logger) {
+                _logger->debug("Solving segment: group={} start=({}, {}) end=({}, {})",
+                               static_cast<unsigned long long>(gid),
+                               seg.start_frame.getValue(), seg.start_entity.id,
+                               seg.end_frame.getValue(), seg.end_entity.id);
+            }
+
+            Path segment_path = solve_single_segment_flow_over_meta(trimmed, frame_lookup, gid, seg, diagnostics);
+            appendPath(out_path, std::move(segment_path));
+        }
+        return out_path;
+    }
 
-                Path segment_path = solve_single_segment_flow_over_meta(trimmed, frame_lookup, gid, seg);
-                if (segment_path.empty()) continue;
+    /// Append @p next to @p out, dropping a leading node that repeats the last node of @p out
+    static void appendPath(Path & out, Path next) {
+        if (next.empty()) return;
+        if (!out.empty()) {
+            auto const & last = out.back();
+            auto const & first = next.front();
+            if (last.frame == first.frame && last.entity_id == first.entity_id) {
+                next.erase(next.begin());
+            }
+        }
+        out.insert(out.end(), next.begin(), next.end());
+    }
+
+    /**
+     * @brief Pad or truncate @p state to @p target_dim so it can initialize the prototype filter
+     */
+    static FilterState coerceStateDimension(FilterState const & state, int target_dim) {
+        if (static_cast<int>(state.state_mean.size()) == target_dim &&
+            state.state_covariance.rows() == target_dim &&
+            state.state_covariance.cols() == target_dim) {
+            return state;
+        }
+        FilterState coerced;
+        coerced.state_mean = Eigen::VectorXd::Zero(target_dim);
+        int const copy_dim = std::min<int>(target_dim, static_cast<int>(state.state_mean.size()));
+        if (copy_dim > 0) coerced.state_mean.head(copy_dim) = state.state_mean.head(copy_dim);
+        coerced.state_covariance = Eigen::MatrixXd::Zero(target_dim, target_dim);
+        int const cr = std::min<int>(target_dim, state.state_covariance.rows());
+        int const cc = std::min<int>(target_dim, state.state_covariance.cols());
+        if (cr > 0 && cc > 0) {
+            int const b = std::min(cr, cc);
+            coerced.state_covariance.topLeftCorner(b, b) = state.state_covariance.topLeftCorner(b, b);
+        }
+        constexpr double kPadVar = 1e6;
+        for (int d = 0; d < target_dim; ++d) {
+            if (coerced.state_covariance(d, d) <= 0.0) coerced.state_covariance(d, d) = kPadVar;
+        }
+        return coerced;
+    }
+
+    /// Position used for spatial gating: the first two filter features of an observation
+    static std::pair<double, double> gatingPosition(Eigen::VectorXd const & obs) {
+        double const x = obs.size() > 0 ? obs(0) : 0.0;
+        double const y = obs.size() > 1 ? obs(1) : 0.0;
+        return {x, y};
+    }
 
-                // Deduplicate overlapping anchor between consecutive segments
-                if (!out_path.empty() && !segment_path.empty()) {
-                    auto const & last = out_path.back();
-                    auto const & first = segment_path.front();
-                    if (last.frame == first.frame && last.entity_id == first.entity_id) {
-                        segment_path.erase(segment_path.begin());
+    /**
+     * @brief Build gated transition arcs between meta-nodes.
+     *
+     * A transition i -> j is considered when j starts 1..`_max_transition_gap`
+     * frames after i ends and, with spatial gating enabled, j's first
+     * observation lies within `_transition_gate_per_frame * gap` of i's last
+     * observation. Candidates come from a TrackletEndpointIndex, so the work
+     * scales with the number of admissible arcs rather than num_meta^2.
+     *
+     * Each source node clones the prototype filter once and advances it
+     * through increasing gaps, reusing the multi-step prediction across all of
+     * its successors. Sources are processed in parallel; arcs are returned in
+     * (tail, head) order.
+     */
+    std::vector<ArcSpec> build_transition_arcs(
+            std::vector<MetaNode> const & meta_nodes,
+            std::map<TimeFrameIndex, FrameBucket<DataType>> const & frame_lookup) const {
+        int const num_meta = static_cast<int>(meta_nodes.size());
+        bool const spatial_gate = std::isfinite(_transition_gate_per_frame);
+        double const max_radius = spatial_gate ? _transition_gate_per_frame * _max_transition_gap
+                                               : std::numeric_limits<double>::infinity();
+
+        // First observation of every meta-node, extracted once
+        std::vector<std::optional<Eigen::VectorXd>> start_obs(static_cast<size_t>(num_meta));
+        std::vector<TrackletEndpointIndex::Entry> entries;
+        entries.reserve(static_cast<size_t>(num_meta));
+        for (int j = 0; j < num_meta; ++j) {
+            MetaNode const & to = meta_nodes[static_cast<size_t>(j)];
+            DataType const * to_start_data = findEntity(frame_lookup.at(to.start_frame), to.start_entity);
+            if (!to_start_data) continue;
+            auto & obs = start_obs[static_cast<size_t>(j)];
+            obs = _feature_extractor->getFilterFeatures(*to_start_data);
+            auto const [x, y] = gatingPosition(*obs);
+            entries.push_back({j, to.start_frame.getValue(), x, y});
+        }
+        TrackletEndpointIndex const index(entries, max_radius);
+
+        std::vector<std::vector<ArcSpec>> arcs_by_source(static_cast<size_t>(num_meta));
+        CoreUtilities::parallelForChunks(0, static_cast<size_t>(num_meta), 16, [&](std::size_t lo, std::size_t hi) {
+            std::vector<std::pair<int, int>> candidates;// (steps, head)
+            for (std::size_t i = lo; i < hi; ++i) {
+                MetaNode const & from = meta_nodes[i];
+
+                double cx = 0.0;
+                double cy = 0.0;
+                bool use_spatial = spatial_gate;
+                if (use_spatial) {
+                    DataType const * from_end_data = findEntity(frame_lookup.at(from.end_frame), from.end_entity);
+                    if (from_end_data) {
+                        std::tie(cx, cy) = gatingPosition(_feature_extractor->getFilterFeatures(*from_end_data));
+                    } else {
+                        use_spatial = false;
                     }
                 }
-                // Append
-                out_path.insert(out_path.end(), segment_path.begin(), segment_path.end());
-            }
-            if (!out_path.empty()) {
-                solved_paths.emplace(gid, std::move(out_path));
+
+                candidates.clear();
+                int64_t const end = from.end_frame.getValue();
+                index.query(end + 1, end + _max_transition_gap, cx, cy,
+                            use_spatial ? max_radius : std::numeric_limits<double>::infinity(),
+                            [&](TrackletEndpointIndex::Entry const & e) {
+                                int const steps = static_cast<int>(e.frame - end);
+                                if (use_spatial) {
+                                    double const r = _transition_gate_per_frame * steps;
+                                    double const dx = e.x - cx;
+                                    double const dy = e.y - cy;
+                                    if (dx * dx + dy * dy > r * r) return;
+                                }
+                                candidates.emplace_back(steps, e.node);
+                            });
+                if (candidates.empty()) continue;
+                std::sort(candidates.begin(), candidates.end());
+
+                std::unique_ptr<IFilter> temp_filter;
+                if (_filter_prototype) {
+                    temp_filter = _filter_prototype->clone();
+                    int const target_dim = static_cast<int>(temp_filter->getState().state_mean.size());
+                    temp_filter->initialize(coerceStateDimension(from.end_state, target_dim));
+                }
+                FilterState predicted_state;
+                int predicted_steps = 0;
+
+                auto & out = arcs_by_source[i];
+                for (auto const & [steps, j]: candidates) {
+                    if (temp_filter) {
+                        for (; predicted_steps < steps; ++predicted_steps) {
+                            predicted_state = temp_filter->predict();
+                        }
+                    }
+                    double const dist = _transition_cost_function(predicted_state, *start_obs[static_cast<size_t>(j)], steps);
+                    int64_t const arc_cost = static_cast<int64_t>(dist * _cost_scale_factor);
+                    out.push_back({static_cast<int>(i), j, 1, arc_cost});
+                }
+                std::sort(out.begin(), out.end(), [](ArcSpec const & a, ArcSpec const & b) {
+                    return a.head < b.head;
+                });
             }
-        }
+        });
 
-        return solved_paths;
+        std::vector<ArcSpec> arcs;
+        for (auto & source_arcs: arcs_by_source) {
+            arcs.insert(arcs.end(), source_arcs.begin(), source_arcs.end());
+        }
+        return arcs;
     }
 
     // --- Main Graph Building and Solving Logic ---
@@ -585,6 +739,10 @@ private:
         auto start_anchors = start_anchors_it->second;
         auto end_anchors = end_anchors_it->second;
 
+        if (_windowed_solving) {
+            return solve_flow_in_windows(frame_lookup, ground_truth, start_frame, end_frame, progress);
+        }
+
         // 1) Build greedy meta-nodes (cheap consecutive links) independent of groups
         auto meta_nodes = build_meta_nodes(frame_lookup, start_frame, end_frame, progress);
 
@@ -593,11 +751,79 @@ private:
                                                          frame_lookup,
                                                          ground_truth,
                                                          start_frame,
-                                                         end_frame);
+                                                         end_frame,
+                                                         _diagnostics);
 
         return all_solved_paths;
     }
 
+    /**
+     * @brief Decompose the range at fully anchored frames and solve the windows in parallel.
+     *
+     * A frame where every group present in the range has a ground-truth label
+     * closes every group's segment, so no segment crosses it. Windows between
+     * consecutive such frames (inclusive at both ends) are independent: each
+     * builds its own meta-nodes and solves its segments on the shared thread
+     * pool. Per-group paths are then concatenated in window order, dropping
+     * the shared anchor node at each boundary.
+     *
+     * Meta-node chains do not extend across window boundaries; since every
+     * group is anchored there, this only affects unlabeled clutter.
+     */
+    std::map<GroupId, Path> solve_flow_in_windows(
+            std::map<TimeFrameIndex, FrameBucket<DataType>> const & frame_lookup,
+            GroundTruthMap const & ground_truth,
+            TimeFrameIndex start_frame,
+            TimeFrameIndex end_frame,
+            ProgressCallback const & progress) {
+
+        auto const first = ground_truth.lower_bound(start_frame);
+        auto const last = ground_truth.upper_bound(end_frame);
+        std::set<GroupId> all_groups;
+        for (auto it = first; it != last; ++it) {
+            for (auto const & [gid, entity]: it->second) {
+                all_groups.insert(gid);
+            }
+        }
+        std::vector<TimeFrameIndex> cuts{start_frame};
+        for (auto it = first; it != last; ++it) {
+            if (it->first > start_frame && it->first < end_frame && it->second.size() == all_groups.size()) {
+                cuts.push_back(it->first);
+            }
+        }
+        cuts.push_back(end_frame);
+        std::size_t const num_windows = cuts.size() - 1;
+
+        if (_logger) {
+            _logger->debug("MCF windowed solve: {} windows over {} groups", num_windows, all_groups.size());
+        }
+
+        progress(0);
+        std::vector<std::map<GroupId, Path>> window_paths(num_windows);
+        std::vector<TrackerDiagnostics> window_diagnostics(num_windows);
+        std::atomic<std::size_t> windows_done{0};
+        std::mutex progress_mutex;
+        CoreUtilities::parallelForChunks(0, num_windows, 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t w = lo; w < hi; ++w) {
+                auto meta_nodes = build_meta_nodes(frame_lookup, cuts[w], cuts[w + 1], [](int) {});
+                window_paths[w] = solve_flow_over_segments(meta_nodes, frame_lookup, ground_truth,
+                                                           cuts[w], cuts[w + 1], window_diagnostics[w]);
+                auto const done = ++windows_done;
+                std::lock_guard<std::mutex> const lock(progress_mutex);
+                progress(static_cast<int>(done * 100 / num_windows));
+            }
+        });
+
+        std::map<GroupId, Path> solved_paths;
+        for (std::size_t w = 0; w < num_windows; ++w) {
+            _diagnostics.noOptimalPathCount += window_diagnostics[w].noOptimalPathCount;
+            for (auto & [gid, path]: window_paths[w]) {
+                appendPath(solved_paths[gid], std::move(path));
+            }
+        }
+        return solved_paths;
+    }
+
     /**
      * @brief Build meta-nodes using Hungarian algorithm for optimal chain extension.
      * 
@@ -779,8 +1005,6 @@ private:
                         // Step 1: Run N-scan for each ambiguous chain independently
                         std::map<size_t, std::vector<std::pair<std::vector<NodeInfo>, double>>> all_paths;// chain_idx -> [(path, cost), ...]
 
-                        int const saved_depth = _n_scan_depth;
-                        _n_scan_depth = allowable_depth;// temporary override for lookahead
                         for (size_t chain_idx: ambiguous_chain_indices) {
                             auto & chain = active_chains[chain_idx];
 
@@ -807,7 +1031,7 @@ private:
                             // Each chain gets its own copy of 'used' to explore independently
                             std::set<std::pair<long long, EntityId>> chain_used = used;
                             auto [n_scan_path, path_cost] = run_n_scan_lookahead(chain, viable_candidates, f, end_frame,
-                                                                                 frame_lookup, chain_used);
+                                                                                 frame_lookup, chain_used, allowable_depth);
 
                             if (!n_scan_path.empty()) {
                                 n_scan_results[chain_idx] = {n_scan_path, path_cost};
@@ -831,7 +1055,6 @@ private:
                                 }
                             }
                         }
-                        _n_scan_depth = saved_depth;// restore
 
                         // Step 2: Detect conflicts - check if multiple chains want the same observations
                         if (_logger && !n_scan_results.empty()) {
@@ -940,13 +1163,10 @@ private:
                             }
 
                             if (!viable_candidates_alt.empty()) {
-                                int const saved_depth2 = _n_scan_depth;
-                                _n_scan_depth = allowable_depth;// use same allowable depth
                                 // Use the updated 'used' set so we avoid previous conflicts
                                 auto alt_used = used;// COPY used set
                                 auto [alt_path, alt_cost] = run_n_scan_lookahead(chain, viable_candidates_alt, f, end_frame,
-                                                                                 frame_lookup, alt_used);
-                                _n_scan_depth = saved_depth2;
+                                                                                 frame_lookup, alt_used, allowable_depth);
                                 if (!alt_path.empty()) {
                                     // Accept alternate but commit only current frame
                                     std::vector<NodeInfo> single{alt_path.front()};
@@ -1429,6 +1649,7 @@ private:
      * @param start_scan_frame The frame where N-scan starts
      * @param frame_lookup All frame data
      * @param used Set of already-used (frame, entity) pairs (will be updated)
+     * @param depth_limit Number of frames to explore, including start_scan_frame
      * @return Pair of (path, total_cost), or ({}, 0.0) if chain should terminate
      */
     std::pair<std::vector<NodeInfo>, double> run_n_scan_lookahead(
@@ -1437,8 +1658,8 @@ private:
             TimeFrameIndex start_scan_frame,
             TimeFrameIndex end_frame,
             std::map<TimeFrameIndex, FrameBucket<DataType>> const & frame_lookup,
-            std::set<std::pair<long long, EntityId>> used// pass by value to make sure we don't modify the original set
-    ) {
+            std::set<std::pair<long long, EntityId>> used,// pass by value to make sure we don't modify the original set
+            int depth_limit) {
 
         // Early return if we can't scan ahead (at or near end frame)
         if (start_scan_frame + TimeFrameIndex(1) > end_frame) {
@@ -1494,7 +1715,7 @@ private:
         }
 
         // Expand hypotheses over N frames
-        for (int depth = 1; depth < _n_scan_depth; ++depth) {
+        for (int depth = 1; depth < depth_limit; ++depth) {
             TimeFrameIndex scan_frame = start_scan_frame + TimeFrameIndex(depth);
             if (scan_frame > end_frame || !frame_lookup.count(scan_frame)) {
                 break;// Reached end of available frames
@@ -1535,7 +1756,7 @@ private:
         }
 
         // Select best hypothesis
-        bool reached_n = (hypotheses.empty() ? false : (hypotheses[0].path.size() >= static_cast<size_t>(_n_scan_depth)));
+        bool reached_n = (hypotheses.empty() ? false : (hypotheses[0].path.size() >= static_cast<size_t>(depth_limit)));
         auto best_hyp_opt = select_best_hypothesis(hypotheses, reached_n);
 
         if (!best_hyp_opt.has_value()) {
@@ -1560,6 +1781,48 @@ private:
         return {best_path, best_cost};
     }
 
+    /// Forward filter pass along one solved path followed by RTS smoothing
+    std::vector<FilterState> smoothPath(Path const & path,
+                                        std::map<TimeFrameIndex, FrameBucket<DataType>> const & frame_lookup) const {
+        auto filter = _filter_prototype->clone();
+        std::vector<FilterState> forward_states;
+
+        // Forward pass using the solved path
+        for (size_t i = 0; i < path.size(); ++i) {
+            auto const & node = path[i];
+            auto const * data = findEntity(frame_lookup.at(node.frame), node.entity_id);
+            if (!data) continue;
+
+            if (i == 0) {
+                filter->initialize(_feature_extractor->getInitialState(*data));
+            } else {
+                TimeFrameIndex prev_frame = path[i - 1].frame;
+                int num_steps = (node.frame - prev_frame).getValue();
+
+                if (num_steps <= 0) {
+                    if (_logger) _logger->error("Invalid num_steps in smoothing: {}", num_steps);
+                    continue;// Skip invalid steps
+                }
+
+                // Multi-step prediction: call predict() for each frame step
+                // The last predict() call will set the filter's internal state to the predicted state
+                FilterState pred = filter->getState();// Initialize with current state
+                for (int step = 0; step < num_steps; ++step) {
+                    pred = filter->predict();
+                }
+                // Now filter's internal state is at 'pred', and we update it with the measurement
+                filter->update(pred, {_feature_extractor->getFilterFeatures(*data)});
+            }
+            forward_states.push_back(filter->getState());
+        }
+
+        // Backward smoothing pass
+        if (forward_states.size() > 1) {
+            return filter->smooth(forward_states);
+        }
+        return forward_states;
+    }
+
     // --- Final Smoothing Step ---
     SmoothedResults generate_smoothed_results(
             std::map<GroupId, Path> const & solved_paths,
@@ -1574,47 +1837,22 @@ private:
             return final_results;
         }
 
+        std::vector<std::pair<GroupId, Path const *>> groups;
         for (auto const & [group_id, path]: solved_paths) {
-            if (path.empty()) continue;
-
-            auto filter = _filter_prototype->clone();
-            std::vector<FilterState> forward_states;
-
-            // Forward pass using the solved path
-            for (size_t i = 0; i < path.size(); ++i) {
-                auto const & node = path[i];
-                auto const * data = findEntity(frame_lookup.at(node.frame), node.entity_id);
-                if (!data) continue;
-
-                if (i == 0) {
-                    filter->initialize(_feature_extractor->getInitialState(*data));
-                } else {
-                    TimeFrameIndex prev_frame = path[i - 1].frame;
-                    int num_steps = (node.frame - prev_frame).getValue();
-
-                    if (num_steps <= 0) {
-                        if (_logger) _logger->error("Invalid num_steps in smoothing: {}", num_steps);
-                        continue;// Skip invalid steps
-                    }
-
-                    // Multi-step prediction: call predict() for each frame step
-                    // The last predict() call will set the filter's internal state to the predicted state
-                    FilterState pred = filter->getState();// Initialize with current state
-                    for (int step = 0; step < num_steps; ++step) {
-                        pred = filter->predict();
-                    }
-                    // Now filter's internal state is at 'pred', and we update it with the measurement
-                    filter->update(pred, {_feature_extractor->getFilterFeatures(*data)});
-                }
-                forward_states.push_back(filter->getState());
+            if (!path.empty()) {
+                groups.emplace_back(group_id, &path);
             }
+        }
 
-            // Backward smoothing pass
-            if (forward_states.size() > 1) {
-                final_results[group_id] = filter->smooth(forward_states);
-            } else {
-                final_results[group_id] = forward_states;
+        // Paths are independent; each worker runs its own filter clone
+        std::vector<std::vector<FilterState>> smoothed(groups.size());
+        CoreUtilities::parallelForChunks(0, groups.size(), 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t g = lo; g < hi; ++g) {
+                smoothed[g] = smoothPath(*groups[g].second, frame_lookup);
             }
+        });
+        for (std::size_t g = 0; g < groups.size(); ++g) {
+            final_results[groups[g].first] = std::move(smoothed[g]);
         }
         return final_results;
     }
@@ -1636,6 +1874,9 @@ private:
     double _lookahead_threshold = std::numeric_limits<double>::infinity();
     double _ambiguity_threshold = 1.0;// default: stricter than cheap assignment
     double _ambiguity_margin = 0.0;   // default off
+    int _max_transition_gap = 50;     // frames between meta-nodes considered for a transition arc
+    double _transition_gate_per_frame = std::numeric_limits<double>::infinity();// spatial gate, off by default
+    bool _windowed_solving = false;
 };
 
 }// namespace StateEstimation
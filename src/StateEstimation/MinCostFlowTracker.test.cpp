@@ -3,12 +3,71 @@
 #include "Tracking/Tracklet.hpp"
 #include "Tracking/AnchorUtils.hpp"
 #include "TimeFrame/TimeFrame.hpp"
+#include "Entity/EntityGroupManager.hpp"
 #include "Entity/EntityTypes.hpp"
+#include "Features/IFeatureExtractor.hpp"
+#include "Filter/Kalman/KalmanFilterT.hpp"
+#include "MinCostFlowTracker.hpp"
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 using namespace StateEstimation;
 
 namespace {
 
+// Two-point line whose centroid is the tracked position
+struct GateLine {
+    EntityId id;
+    Eigen::Vector2d p1;
+    Eigen::Vector2d p2;
+
+    Eigen::Vector2d centroid() const {
+        return (p1 + p2) / 2.0;
+    }
+};
+
+class GateLineCentroidExtractor : public IFeatureExtractor<GateLine> {
+public:
+    Eigen::VectorXd getFilterFeatures(GateLine const & data) const override {
+        Eigen::Vector2d const c = data.centroid();
+        Eigen::VectorXd features(2);
+        features << c.x(), c.y();
+        return features;
+    }
+
+    FeatureCache getAllFeatures(GateLine const & data) const override {
+        FeatureCache cache;
+        cache[getFilterFeatureName()] = getFilterFeatures(data);
+        return cache;
+    }
+
+    std::string getFilterFeatureName() const override {
+        return "kalman_features";
+    }
+
+    FilterState getInitialState(GateLine const & data) const override {
+        Eigen::VectorXd initial_state(4);
+        Eigen::Vector2d const c = data.centroid();
+        initial_state << c.x(), c.y(), 0, 0;
+        Eigen::MatrixXd p = Eigen::MatrixXd::Identity(4, 4) * 100.0;
+        return {initial_state, p};
+    }
+
+    std::unique_ptr<IFeatureExtractor<GateLine>> clone() const override {
+        return std::make_unique<GateLineCentroidExtractor>(*this);
+    }
+
+    FeatureMetadata getMetadata() const override {
+        return FeatureMetadata::create("kalman_features", 2, FeatureTemporalType::KINEMATIC_2D);
+    }
+};
+
 MetaNode makeMetaNode(std::vector<std::pair<long long, EntityId>> const & frame_entity_pairs) {
     MetaNode mn;
     mn.members.reserve(frame_entity_pairs.size());
@@ -461,3 +520,70 @@ TEST_CASE("StateEstimation - MinCostFlowTracker - overlapping long tracklets wit
     REQUIRE(find_entity(180).value() == EntityId(20180));
     REQUIRE(find_entity(200).value() == EntityId(20200));
 }
+
+TEST_CASE("StateEstimation - MinCostFlowTracker - gated transitions with windowed solving", "[MinCostFlowTracker][Windowed]") {
+    // Two parallel tracks with blackouts that force meta-node transitions,
+    // anchored for both groups at frames 0, 30 and 60 (two windows)
+    int const num_frames = 60;
+    auto const in_blackout = [](int f) { return (f >= 20 && f < 24) || (f >= 45 && f < 48); };
+
+    auto make_tracker = [] {
+        Eigen::Matrix<double, 4, 4> F;
+        F << 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1;
+        Eigen::Matrix<double, 2, 4> H;
+        H << 1, 0, 0, 0, 0, 1, 0, 0;
+        Eigen::Matrix<double, 4, 4> Q = Eigen::Matrix<double, 4, 4>::Identity() * 0.1;
+        Eigen::Matrix<double, 2, 2> R = Eigen::Matrix<double, 2, 2>::Identity() * 5.0;
+        return MinCostFlowTracker<GateLine>(std::make_unique<KalmanFilterT<4, 2>>(F, H, Q, R),
+                                              std::make_unique<GateLineCentroidExtractor>(), H, R);
+    };
+
+    std::vector<std::tuple<GateLine, EntityId, TimeFrameIndex>> data_source;
+    for (int f = 0; f <= num_frames; ++f) {
+        if (in_blackout(f)) continue;
+        double const x = 10.0 + f;
+        data_source.emplace_back(GateLine{EntityId(1000 + f), {x, 10.0}, {x, 10.0}}, EntityId(1000 + f), TimeFrameIndex(f));
+        data_source.emplace_back(GateLine{EntityId(2000 + f), {x, 80.0}, {x, 80.0}}, EntityId(2000 + f), TimeFrameIndex(f));
+    }
+
+    auto run = [&](bool windowed, bool gated) {
+        EntityGroupManager group_manager;
+        GroupId const g1 = group_manager.createGroup("Group 1");
+        GroupId const g2 = group_manager.createGroup("Group 2");
+        GroundTruthMap ground_truth;
+        for (int f: {0, 30, num_frames}) {
+            ground_truth[TimeFrameIndex(f)] = {{g1, EntityId(1000 + f)}, {g2, EntityId(2000 + f)}};
+            group_manager.addEntityToGroup(g1, EntityId(1000 + f));
+            group_manager.addEntityToGroup(g2, EntityId(2000 + f));
+        }
+
+        auto tracker = make_tracker();
+        tracker.setWindowedSolving(windowed);
+        if (gated) {
+            tracker.setTransitionGating(10, 5.0);
+        }
+        auto const smoothed = tracker.process(data_source, group_manager, ground_truth,
+                                              TimeFrameIndex(0), TimeFrameIndex(num_frames), [](int) {});
+        REQUIRE(smoothed.size() == 2);
+
+        auto got_g1 = group_manager.getEntitiesInGroup(g1);
+        auto got_g2 = group_manager.getEntitiesInGroup(g2);
+        std::sort(got_g1.begin(), got_g1.end());
+        std::sort(got_g2.begin(), got_g2.end());
+        return std::make_pair(got_g1, got_g2);
+    };
+
+    std::vector<EntityId> expected_g1;
+    std::vector<EntityId> expected_g2;
+    for (int f = 0; f <= num_frames; ++f) {
+        if (in_blackout(f)) continue;
+        expected_g1.push_back(EntityId(1000 + f));
+        expected_g2.push_back(EntityId(2000 + f));
+    }
+
+    for (auto const [windowed, gated]: {std::pair{false, false}, std::pair{false, true}, std::pair{true, true}}) {
+        auto const [got_g1, got_g2] = run(windowed, gated);
+        REQUIRE(got_g1 == expected_g1);
+        REQUIRE(got_g2 == expected_g2);
+    }
+}
@@ -8,6 +8,8 @@
 #include "Filter/IFilter.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
+#include "CoreUtilities/thread_pool.hpp"
+
 #include "spdlog/sinks/basic_file_sink.h"
 #include "spdlog/sinks/rotating_file_sink.h"
 #include "spdlog/spdlog.h"
@@ -639,14 +641,22 @@ private:
     [[nodiscard]] std::map<GroupId, IntervalHistory>
     runRtsSmoothing(std::map<GroupId, IntervalHistory> const & forward_histories) const {
         std::map<GroupId, IntervalHistory> smoothed = forward_histories;
+        std::vector<std::pair<GroupId, IntervalHistory *>> pending;
         for (auto & [group_id, hist]: smoothed) {
-            if (hist.forward_states.size() <= 1) continue;
-            // Use prototype filter to access smoother implementation over the forward states
-            auto tmp = _filter_prototype->clone();
-            auto smooth_states = tmp->smooth(hist.forward_states);
-            hist.forward_states = smooth_states;
-            if (_logger) {
-                _logger->debug("smoothing: group={} states={}", static_cast<unsigned long long>(group_id), static_cast<unsigned long long>(hist.forward_states.size()));
+            if (hist.forward_states.size() > 1) {
+                pending.emplace_back(group_id, &hist);
+            }
+        }
+        // Groups are independent; each worker smooths with its own clone of the prototype
+        CoreUtilities::parallelForChunks(0, pending.size(), 1, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t i = lo; i < hi; ++i) {
+                auto tmp = _filter_prototype->clone();
+                pending[i].second->forward_states = tmp->smooth(pending[i].second->forward_states);
+            }
+        });
+        if (_logger) {
+            for (auto const & [group_id, hist]: pending) {
+                _logger->debug("smoothing: group={} states={}", static_cast<unsigned long long>(group_id), static_cast<unsigned long long>(hist->forward_states.size()));
             }
         }
         return smoothed;
@@ -0,0 +1,108 @@
+#ifndef STATEESTIMATION_TRACKLET_ENDPOINT_INDEX_HPP
+#define STATEESTIMATION_TRACKLET_ENDPOINT_INDEX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace StateEstimation {
+
+/**
+ * @brief Spatio-temporal index over tracklet start points.
+ *
+ * Used to enumerate candidate successors of a tracklet without visiting every
+ * other tracklet. Start points are bucketed into a uniform grid of
+ * `cell_size` cells; each cell keeps its entries sorted by frame so a query
+ * only touches the cells overlapping the search radius and, within them, the
+ * entries inside the frame window.
+ *
+ * A non-finite or non-positive `cell_size` puts every entry into one cell,
+ * which reduces the index to a frame-sorted list (temporal gating only).
+ */
+class TrackletEndpointIndex {
+public:
+    struct Entry {
+        int node = 0;       ///< Caller's index of the tracklet
+        int64_t frame = 0;  ///< Frame of the tracklet's first observation
+        double x = 0.0;     ///< Position of the first observation
+        double y = 0.0;
+    };
+
+    TrackletEndpointIndex(std::vector<Entry> const & entries, double cell_size)
+        : _cell_size(std::isfinite(cell_size) && cell_size > 0.0 ? cell_size : 0.0) {
+        for (auto const & e: entries) {
+            _cells[key(cell(e.x), cell(e.y))].push_back(e);
+        }
+        for (auto & [k, cell_entries]: _cells) {
+            std::sort(cell_entries.begin(), cell_entries.end(), [](Entry const & a, Entry const & b) {
+                return a.frame < b.frame || (a.frame == b.frame && a.node < b.node);
+            });
+        }
+    }
+
+    /**
+     * @brief Visit entries with `min_frame <= frame <= max_frame` near (x, y)
+     *
+     * Entries whose cell overlaps the square of half-width @p radius around
+     * (x, y) are visited; callers apply the exact distance test. A non-finite
+     * radius visits every entry in the frame window.
+     */
+    template<typename Visit>
+    void query(int64_t min_frame, int64_t max_frame, double x, double y, double radius, Visit && visit) const {
+        if (_cell_size == 0.0 || !std::isfinite(radius)) {
+            for (auto const & [k, cell_entries]: _cells) {
+                visitWindow(cell_entries, min_frame, max_frame, visit);
+            }
+            return;
+        }
+        int64_t const cx0 = cell(x - radius);
+        int64_t const cx1 = cell(x + radius);
+        int64_t const cy0 = cell(y - radius);
+        int64_t const cy1 = cell(y + radius);
+        if ((cx1 - cx0 + 1) * (cy1 - cy0 + 1) > static_cast<int64_t>(_cells.size())) {
+            for (auto const & [k, cell_entries]: _cells) {
+                visitWindow(cell_entries, min_frame, max_frame, visit);
+            }
+            return;
+        }
+        for (int64_t cx = cx0; cx <= cx1; ++cx) {
+            for (int64_t cy = cy0; cy <= cy1; ++cy) {
+                auto const it = _cells.find(key(cx, cy));
+                if (it != _cells.end()) {
+                    visitWindow(it->second, min_frame, max_frame, visit);
+                }
+            }
+        }
+    }
+
+private:
+    double _cell_size;
+    std::unordered_map<uint64_t, std::vector<Entry>> _cells;
+
+    [[nodiscard]] int64_t cell(double v) const {
+        if (_cell_size == 0.0 || !std::isfinite(v)) {
+            return 0;
+        }
+        return static_cast<int64_t>(std::floor(v / _cell_size));
+    }
+
+    static uint64_t key(int64_t cx, int64_t cy) {
+        return (static_cast<uint64_t>(cx) << 32) ^ (static_cast<uint64_t>(cy) & 0xffffffffULL);
+    }
+
+    template<typename Visit>
+    static void visitWindow(std::vector<Entry> const & cell_entries, int64_t min_frame, int64_t max_frame, Visit & visit) {
+        auto it = std::lower_bound(cell_entries.begin(), cell_entries.end(), min_frame,
+                                   [](Entry const & e, int64_t f) { return e.frame < f; });
+        for (; it != cell_entries.end() && it->frame <= max_frame; ++it) {
+            visit(*it);
+        }
+    }
+};
+
+}// namespace StateEstimation
+
+#endif// STATEESTIMATION_TRACKLET_ENDPOINT_INDEX_HPP
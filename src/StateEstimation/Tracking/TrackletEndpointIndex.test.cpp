@@ -0,0 +1,77 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "Tracking/TrackletEndpointIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace StateEstimation;
+
+namespace {
+
+std::vector<int> queryNodes(TrackletEndpointIndex const & index,
+                            int64_t min_frame, int64_t max_frame,
+                            double x, double y, double radius) {
+    std::vector<int> nodes;
+    index.query(min_frame, max_frame, x, y, radius, [&](TrackletEndpointIndex::Entry const & e) {
+        if (std::isfinite(radius) && std::hypot(e.x - x, e.y - y) > radius) return;
+        nodes.push_back(e.node);
+    });
+    std::sort(nodes.begin(), nodes.end());
+    return nodes;
+}
+
+}// namespace
+
+TEST_CASE("TrackletEndpointIndex - frame window and radius", "[TrackletEndpointIndex]") {
+    std::vector<TrackletEndpointIndex::Entry> entries;
+    // Grid of start points: node = frame * 10 + column, x = column * 10
+    for (int frame = 0; frame < 20; ++frame) {
+        for (int col = 0; col < 10; ++col) {
+            entries.push_back({frame * 10 + col, frame, col * 10.0, 0.0});
+        }
+    }
+
+    TrackletEndpointIndex const index(entries, 15.0);
+
+    SECTION("Only entries inside the frame window are visited") {
+        auto const nodes = queryNodes(index, 5, 6, 0.0, 0.0, std::numeric_limits<double>::infinity());
+        REQUIRE(nodes.size() == 20);
+        REQUIRE(nodes.front() == 50);
+        REQUIRE(nodes.back() == 69);
+    }
+
+    SECTION("Radius query matches a linear scan") {
+        auto const nodes = queryNodes(index, 3, 8, 42.0, 1.0, 15.0);
+        std::vector<int> expected;
+        for (auto const & e: entries) {
+            if (e.frame >= 3 && e.frame <= 8 && std::hypot(e.x - 42.0, e.y - 1.0) <= 15.0) {
+                expected.push_back(e.node);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(nodes == expected);
+        REQUIRE_FALSE(nodes.empty());
+    }
+
+    SECTION("Empty window") {
+        REQUIRE(queryNodes(index, 25, 30, 0.0, 0.0, 100.0).empty());
+    }
+}
+
+TEST_CASE("TrackletEndpointIndex - unbounded cell size is temporal only", "[TrackletEndpointIndex]") {
+    std::vector<TrackletEndpointIndex::Entry> entries = {
+            {0, 4, -1e6, 3.0},
+            {1, 2, 5.0, 5.0},
+            {2, 3, 1e6, -2.0},
+    };
+    TrackletEndpointIndex const index(entries, std::numeric_limits<double>::infinity());
+
+    std::vector<int> visited;
+    index.query(2, 3, 0.0, 0.0, 1.0, [&](TrackletEndpointIndex::Entry const & e) {
+        visited.push_back(e.node);
+    });
+    REQUIRE(visited == std::vector<int>{1, 2});
+}
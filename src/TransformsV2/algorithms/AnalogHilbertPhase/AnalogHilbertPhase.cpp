@@ -23,6 +23,11 @@ std::shared_ptr<AnalogTimeSeries> analogHilbertPhase(
     v1Params.maxChunkSize = params.max_chunk_size;
     v1Params.overlapFraction = params.overlap_fraction.value();
     v1Params.useWindowing = params.use_windowing;
+    v1Params.method = params.method == AnalogHilbertPhaseParams::Method::overlap_save
+                              ? HilbertPhaseParams::Method::OverlapSave
+                              : HilbertPhaseParams::Method::FFT;
+    v1Params.hilbertKernelHalfWidth = params.hilbert_kernel_half_width.value();
+    v1Params.fftBlockSize = params.fft_block_size;
     v1Params.applyBandpassFilter = params.apply_bandpass_filter;
     v1Params.filterLowFreq = params.filter_low_freq.value();
     v1Params.filterHighFreq = params.filter_high_freq.value();
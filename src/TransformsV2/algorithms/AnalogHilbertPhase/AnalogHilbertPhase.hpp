@@ -27,6 +27,9 @@ namespace Neuralyzer::Transforms::V2::Examples {
  *   "max_chunk_size": 100000,
  *   "overlap_fraction": 0.25,
  *   "use_windowing": true,
+ *   "method": "fft",
+ *   "hilbert_kernel_half_width": 1024,
+ *   "fft_block_size": 8192,
  *   "apply_bandpass_filter": false,
  *   "filter_low_freq": 5.0,
  *   "filter_high_freq": 15.0,
@@ -55,6 +58,19 @@ struct AnalogHilbertPhaseParams {
     /// Apply Hann window to reduce edge artifacts
     bool use_windowing = true;
 
+    enum class Method {
+        fft,         ///< Whole-chunk FFT (split into windowed sub-chunks above max_chunk_size)
+        overlap_save ///< Streaming FIR Hilbert with fixed-size FFT blocks processed in parallel
+    };
+
+    Method method = Method::fft;
+
+    /// FIR Hilbert taps on each side of the center (overlap_save only)
+    rfl::Validator<size_t, rfl::Minimum<1>> hilbert_kernel_half_width = 1024;
+
+    /// FFT length per block, rounded up to a power of two (overlap_save only)
+    size_t fft_block_size = 8192;
+
     /// Whether to apply bandpass filtering before Hilbert transform
     bool apply_bandpass_filter = false;
 
@@ -88,6 +104,9 @@ struct AnalogHilbertPhaseParams {
  *    c. Create analytic signal by zeroing negative frequencies
  *    d. Compute inverse FFT
  *    e. Extract phase (atan2) or amplitude (magnitude)
+ *    With method = overlap_save, b-d are replaced by a windowed FIR Hilbert
+ *    kernel applied block by block with fixed power-of-two FFTs (bounded
+ *    memory, blocks processed in parallel).
  * 3. Stitch chunks back together
  * 4. Report progress and check for cancellation
  *
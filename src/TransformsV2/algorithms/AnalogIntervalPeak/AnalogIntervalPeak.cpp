@@ -95,35 +95,18 @@ std::shared_ptr<DigitalEventSeries> analogIntervalPeak(
         TimeFrameIndex const start_index(range_start);
         TimeFrameIndex const end_index(range_end);
 
-        // Get data and corresponding time indices in this range
+        // Summarize the range from the analog series' cached range index.
         // If interval_timeframe is set, pass it for automatic conversion
-        auto time_value_pair = interval_timeframe
-                                       ? analog.getTimeValueSpanInTimeFrameIndexRange(start_index, end_index, interval_timeframe.get())
-                                       : analog.getTimeValueSpanInTimeFrameIndexRange(start_index, end_index);
-
-        auto const & data_span = time_value_pair.values;
-        if (data_span.empty()) {
+        auto const summary = analog.summarizeRange(start_index, end_index, interval_timeframe.get());
+        if (summary.empty()) {
             // No data in this range, skip it
             continue;
         }
 
-        // Find the peak value and its index within the span
-        size_t peak_idx_in_span = 0;
-
-        if (params.peak_type == AnalogIntervalPeakParams::PeakType::maximum) {
-            auto max_it = std::ranges::max_element(data_span);
-            peak_idx_in_span = static_cast<size_t>(std::distance(data_span.begin(), max_it));
-        } else {
-            auto min_it = std::ranges::min_element(data_span);
-            peak_idx_in_span = static_cast<size_t>(std::distance(data_span.begin(), min_it));
-        }
-
-        // Get the actual TimeFrameIndex for the peak from the time_indices iterator
-        auto time_iter = time_value_pair.time_indices.begin();
-        for (size_t i = 0; i < peak_idx_in_span; ++i) {
-            ++(*time_iter);
-        }
-        TimeFrameIndex const peak_time_index = **time_iter;
+        // First position of the extreme value, as std::ranges::max_element/min_element
+        auto const peak_position =
+                params.peak_type == AnalogIntervalPeakParams::PeakType::maximum ? summary.argmax : summary.argmin;
+        TimeFrameIndex const peak_time_index = analog.getTimeStorage()->getTimeFrameIndexAt(peak_position);
 
         // Peak indices are stored in the analog series coordinate system.
         peak_events.push_back(peak_time_index);
@@ -1,9 +1,9 @@
 #include "IntervalReduction.hpp"
 
+#include "algorithms/RangeReductions/FusedValueReductions.hpp"
 #include "core/ComputeContext.hpp"
 #include "core/RangeReductionRegistry.hpp"
 #include "extension/RangeReductionTypes.hpp"
-#include "extension/gatherResult/GatherResultRowContext.hpp"
 
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
 #include "DigitalTimeSeries/Digital_Event_Series.hpp"
@@ -13,8 +13,11 @@
 #include "TimeFrame/TimeFrame.hpp"
 #include "TimeFrame/interval_data.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <memory>
+#include <optional>
 #include <span>
 #include <utility>
 #include <vector>
@@ -28,18 +31,21 @@ namespace {
 // ============================================================================
 
 /**
- * @brief Ensure params is a valid std::any for the reduction registry.
- *
- * If the JSON is empty or "{}", returns NoReductionParams{}.
+ * @brief All reductions requested by @p params, primary first
  */
-std::any ensureReductionParams(std::string const & json) {
-    if (json.empty() || json == "{}") {
-        return std::any{NoReductionParams{}};
-    }
-    // For now, only stateless reductions are supported via this path.
-    // Parameterized reductions would require looking up the reduction's
-    // parameter type and deserializing accordingly.
-    return std::any{NoReductionParams{}};
+std::vector<std::string> requestedReductions(IntervalReductionParams const & params) {
+    std::vector<std::string> names{params.reduction_name};
+    names.insert(names.end(), params.additional_reductions.begin(), params.additional_reductions.end());
+    return names;
+}
+
+/**
+ * @brief Output column names: params.column_name, then each additional reduction name
+ */
+std::vector<std::string> outputColumnNames(IntervalReductionParams const & params) {
+    std::vector<std::string> names{params.column_name};
+    names.insert(names.end(), params.additional_reductions.begin(), params.additional_reductions.end());
+    return names;
 }
 
 /**
@@ -130,6 +136,94 @@ std::shared_ptr<DigitalIntervalSeries const> borrowIntervalsAsShared(
             &intervals};
 }
 
+/**
+ * @brief Reduce every gathered row with each named reduction, row-major
+ *
+ * Each row is materialized once and all reductions run over the same span
+ * through RangeReductionRegistry::executeManyErased(), which fuses the ones
+ * that have a one-pass executor.
+ *
+ * Only stateless reductions are supported via this path; reduction_params_json
+ * is not yet deserialized against the reduction's parameter type.
+ */
+template<typename T>
+std::vector<float> reduceRowsWithRegistry(GatherResult<T> const & gather,
+                                          std::vector<std::string> const & names) {
+    using Element = typename GatherResult<T>::element_type;
+    auto const & registry = RangeReductionRegistry::instance();
+
+    std::vector<float> values;
+    values.reserve(gather.size() * names.size());
+
+    std::vector<Element> elements;
+    for (std::size_t i = 0; i < gather.size(); ++i) {
+        elements.clear();
+        std::ranges::copy(gather[i]->view(), std::back_inserter(elements));
+        std::any const input_any{std::span<Element const>{elements}};
+        for (auto const & result: registry.executeManyErased(names, typeid(Element), input_any)) {
+            values.push_back(castReductionResult(result));
+        }
+    }
+    return values;
+}
+
+/**
+ * @brief Fused statistics for @p names, or nullopt unless there are several and all are fusable
+ */
+std::optional<std::vector<RangeReductions::ValueStatistic>> fusedAnalogStatistics(
+        std::vector<std::string> const & names) {
+    if (names.size() < 2) {
+        return std::nullopt;
+    }
+    std::vector<RangeReductions::ValueStatistic> stats;
+    stats.reserve(names.size());
+    for (auto const & name: names) {
+        auto const stat = RangeReductions::fusedValueStatistic(name);
+        if (!stat) {
+            return std::nullopt;
+        }
+        stats.push_back(*stat);
+    }
+    return stats;
+}
+
+/**
+ * @brief Compute all statistics of every gathered analog row in one pass per row
+ *
+ * Reads each row's contiguous float samples directly (no TimeValuePoint
+ * copies) and looks up times only for the argmax / argmin positions.
+ * Rows backed by non-contiguous storage are copied out once.
+ *
+ * @return Row-major values, stats.size() per row
+ */
+std::vector<float> reduceAnalogRowsFused(GatherResult<AnalogTimeSeries> const & gather,
+                                         std::span<RangeReductions::ValueStatistic const> stats) {
+    auto const stat_set = RangeReductions::makeValueStatisticSet(stats);
+
+    std::vector<float> values;
+    values.reserve(gather.size() * stats.size());
+
+    std::vector<float> copied;
+    for (std::size_t i = 0; i < gather.size(); ++i) {
+        auto const & row = gather[i];
+        auto samples = row->getAnalogTimeSeries();
+        if (samples.size() != row->getNumSamples()) {
+            copied.clear();
+            std::ranges::copy(row->viewValues(), std::back_inserter(copied));
+            samples = copied;
+        }
+
+        auto const summary = RangeReductions::summarizeValues(samples, stat_set);
+        auto const time_at = [&row](std::size_t pos) {
+            return static_cast<float>(row->getTimeStorage()->getTimeFrameIndexAt(pos).getValue());
+        };
+        for (auto const stat: stats) {
+            values.push_back(RangeReductions::valueStatistic(summary, stat, time_at));
+        }
+    }
+    return values;
+}
+
 }// anonymous namespace
 
 // ============================================================================
@@ -159,12 +253,7 @@ std::shared_ptr<TensorData> analogIntervalReduction(
 
     ctx.reportProgress(5);
 
-    // Resolve range reduction
-    auto & registry = RangeReductionRegistry::instance();
-    std::string const reduction_name = params.reduction_name;
-    std::any reduction_params = ensureReductionParams(params.reduction_params_json);
-
-    using TimeValuePoint = AnalogTimeSeries::TimeValuePoint;
+    auto const reduction_names = requestedReductions(params);
 
     // GatherResult converts interval bounds to the source TimeFrame at query time.
     auto analog_ptr = borrowSourceAsShared(analog);
@@ -174,37 +263,25 @@ std::shared_ptr<TensorData> analogIntervalReduction(
 
     ctx.reportProgress(15);
 
-    // Build reducer factory
-    Neuralyzer::Gather::ReducerFactoryV2<TimeValuePoint, float> const factory =
-            [&reduction_name, &reduction_params](
-                    PipelineValueStore const &) -> Neuralyzer::Gather::ReducerFn<TimeValuePoint, float> {
-        return [&reduction_name, &reduction_params](
-                       std::span<TimeValuePoint const> input) -> float {
-            auto & reg = RangeReductionRegistry::instance();
-            std::any const input_any{input};
-            std::any const result = reg.executeErased(
-                    reduction_name, typeid(TimeValuePoint), input_any, reduction_params);
-            return castReductionResult(result);
-        };
-    };
-
-    // Reduce all gathered views
-    auto values = Neuralyzer::Gather::reduceGatherRows(gather, factory);
+    // Several value statistics share one pass over each row's samples
+    auto const fused_stats = fusedAnalogStatistics(reduction_names);
+    auto values = fused_stats ? reduceAnalogRowsFused(gather, *fused_stats)
+                              : reduceRowsWithRegistry(gather, reduction_names);
 
     ctx.reportProgress(85);
 
     // Build output TensorData
-    auto const num_rows = values.size();
+    auto const num_rows = gather.size();
     auto time_frame = getOrCreateTimeFrame(intervals);
 
     auto result = std::make_shared<TensorData>(
             TensorData::createFromIntervals(
                     values,
                     num_rows,
-                    1,
+                    reduction_names.size(),
                     std::move(tf_intervals),
                     time_frame,
-                    {params.column_name}));
+                    outputColumnNames(params)));
 
     ctx.reportProgress(100);
     return result;
@@ -237,12 +314,7 @@ std::shared_ptr<TensorData> eventIntervalReduction(
 
     ctx.reportProgress(5);
 
-    // Resolve range reduction
-    auto & registry = RangeReductionRegistry::instance();
-    std::string const reduction_name = params.reduction_name;
-    std::any reduction_params = ensureReductionParams(params.reduction_params_json);
-
-    using EventElement = Neuralyzer::Gather::element_type_of_t<DigitalEventSeries>;
+    auto const reduction_names = requestedReductions(params);
 
     // GatherResult converts interval bounds to the source TimeFrame at query time.
     auto events_ptr = borrowSourceAsShared(events);
@@ -252,37 +324,23 @@ std::shared_ptr<TensorData> eventIntervalReduction(
 
     ctx.reportProgress(15);
 
-    // Build reducer factory
-    Neuralyzer::Gather::ReducerFactoryV2<EventElement, float> const factory =
-            [&reduction_name, &reduction_params](
-                    PipelineValueStore const &) -> Neuralyzer::Gather::ReducerFn<EventElement, float> {
-        return [&reduction_name, &reduction_params](
-                       std::span<EventElement const> input) -> float {
-            auto & reg = RangeReductionRegistry::instance();
-            std::any const input_any{input};
-            std::any const result = reg.executeErased(
-                    reduction_name, typeid(EventElement), input_any, reduction_params);
-            return castReductionResult(result);
-        };
-    };
-
     // Reduce all gathered views
-    auto values = Neuralyzer::Gather::reduceGatherRows(gather, factory);
+    auto values = reduceRowsWithRegistry(gather, reduction_names);
 
     ctx.reportProgress(85);
 
     // Build output TensorData
-    auto const num_rows = values.size();
+    auto const num_rows = gather.size();
     auto time_frame = getOrCreateTimeFrame(intervals);
 
     auto result = std::make_shared<TensorData>(
             TensorData::createFromIntervals(
                     values,
                     num_rows,
-                    1,
+                    reduction_names.size(),
                     std::move(tf_intervals),
                     time_frame,
-                    {params.column_name}));
+                    outputColumnNames(params)));
 
     ctx.reportProgress(100);
     return result;
@@ -318,12 +376,7 @@ std::shared_ptr<TensorData> intervalOverlapReduction(
 
     ctx.reportProgress(5);
 
-    // Resolve range reduction
-    auto & registry = RangeReductionRegistry::instance();
-    std::string const reduction_name = params.reduction_name;
-    std::any reduction_params = ensureReductionParams(params.reduction_params_json);
-
-    using IntervalElement = Neuralyzer::Gather::element_type_of_t<DigitalIntervalSeries>;
+    auto const reduction_names = requestedReductions(params);
 
     // GatherResult converts interval bounds to the source TimeFrame at query time.
     auto source_ptr = borrowSourceAsShared(source);
@@ -333,37 +386,23 @@ std::shared_ptr<TensorData> intervalOverlapReduction(
 
     ctx.reportProgress(15);
 
-    // Build reducer factory
-    Neuralyzer::Gather::ReducerFactoryV2<IntervalElement, float> const factory =
-            [&reduction_name, &reduction_params](
-                    PipelineValueStore const &) -> Neuralyzer::Gather::ReducerFn<IntervalElement, float> {
-        return [&reduction_name, &reduction_params](
-                       std::span<IntervalElement const> input) -> float {
-            auto & reg = RangeReductionRegistry::instance();
-            std::any const input_any{input};
-            std::any const result = reg.executeErased(
-                    reduction_name, typeid(IntervalElement), input_any, reduction_params);
-            return castReductionResult(result);
-        };
-    };
-
     // Reduce all gathered views
-    auto values = Neuralyzer::Gather::reduceGatherRows(gather, factory);
+    auto values = reduceRowsWithRegistry(gather, reduction_names);
 
     ctx.reportProgress(85);
 
     // Build output TensorData
-    auto const num_rows = values.size();
+    auto const num_rows = gather.size();
     auto time_frame = getOrCreateTimeFrame(intervals);
 
     auto result = std::make_shared<TensorData>(
             TensorData::createFromIntervals(
                     values,
                     num_rows,
-                    1,
+                    reduction_names.size(),
                     std::move(tf_intervals),
                     time_frame,
-                    {params.column_name}));
+                    outputColumnNames(params)));
 
     ctx.reportProgress(100);
     return result;
@@ -6,8 +6,8 @@
  * @brief Binary container transforms that produce TensorData from interval + source pairs
  *
  * These transforms take a DigitalIntervalSeries (defining rows) and a source data
- * container, gather the source data within each interval, apply a named range reduction,
- * and produce a TensorData with interval-based RowDescriptor and a single column.
+ * container, gather the source data within each interval, apply named range reductions,
+ * and produce a TensorData with interval-based RowDescriptor and one column per reduction.
  *
  * Three variants are provided for different source types:
  * - AnalogIntervalReduction: (DigitalIntervalSeries, AnalogTimeSeries) → TensorData
@@ -36,6 +36,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 class AnalogTimeSeries;
 class DigitalEventSeries;
@@ -84,6 +85,16 @@ struct IntervalReductionParams {
      * @brief Name of the output column in the produced TensorData
      */
     std::string column_name = "value";
+
+    /**
+     * @brief Further reductions of the same intervals, one extra column each
+     *
+     * Each extra column is named after its reduction. For AnalogTimeSeries,
+     * when every requested reduction is a fusable value statistic (MaxValue,
+     * MinValue, MeanValue, StdValue, SumValue, ValueRange, TimeOfMax,
+     * TimeOfMin), all columns are computed in one pass over each interval.
+     */
+    std::vector<std::string> additional_reductions;
 };
 
 // ============================================================================
@@ -106,14 +117,14 @@ struct IntervalReductionParams {
  *
  * The output TensorData has:
  * - Interval-based RowDescriptor (one row per interval)
- * - A single column named by params.column_name
+ * - A column named by params.column_name, then one column per additional reduction
  * - TimeFrame inherited from the interval series
  *
  * @param intervals DigitalIntervalSeries defining the row structure
  * @param analog AnalogTimeSeries to gather and reduce
  * @param params Parameters controlling the reduction
  * @param ctx Compute context for progress reporting and cancellation
- * @return TensorData with one column of reduced values
+ * @return TensorData with one column of reduced values per requested reduction
  */
 std::shared_ptr<TensorData> analogIntervalReduction(
         DigitalIntervalSeries const & intervals,
@@ -131,7 +142,7 @@ std::shared_ptr<TensorData> analogIntervalReduction(
  * @param events DigitalEventSeries to gather and reduce
  * @param params Parameters controlling the reduction
  * @param ctx Compute context for progress reporting and cancellation
- * @return TensorData with one column of reduced values
+ * @return TensorData with one column of reduced values per requested reduction
  */
 std::shared_ptr<TensorData> eventIntervalReduction(
         DigitalIntervalSeries const & intervals,
@@ -149,7 +160,7 @@ std::shared_ptr<TensorData> eventIntervalReduction(
  * @param source DigitalIntervalSeries to gather and reduce (e.g., stimulus intervals)
  * @param params Parameters controlling the reduction
  * @param ctx Compute context for progress reporting and cancellation
- * @return TensorData with one column of reduced values
+ * @return TensorData with one column of reduced values per requested reduction
  */
 std::shared_ptr<TensorData> intervalOverlapReduction(
         DigitalIntervalSeries const & intervals,
@@ -183,6 +183,74 @@ TEST_CASE("V2 Binary Container Transform: AnalogIntervalReduction - MeanValue",
     }
 }
 
+TEST_CASE("V2 Binary Container Transform: AnalogIntervalReduction - additional reductions",
+          "[transforms][v2][binary_container][interval_reduction]") {
+
+    auto & registry = ElementRegistry::instance();
+    ComputeContext const ctx;
+
+    // Signal: values [0, 1, 2, ..., 9] at times [0, 1, ..., 9]
+    auto ats = AnalogTimeSeriesBuilder()
+                       .withRamp(0, 9, 0.0f, 9.0f)
+                       .build();
+
+    auto dis = DigitalIntervalSeriesBuilder()
+                       .withInterval(0, 4)
+                       .withInterval(5, 9)
+                       .build();
+
+    auto const run = [&](IntervalReductionParams const & params) {
+        return registry.executeBinaryContainerTransform<
+                DigitalIntervalSeries,
+                AnalogTimeSeries,
+                TensorData,
+                IntervalReductionParams>(
+                "AnalogIntervalReduction",
+                *dis, *ats, params, ctx);
+    };
+
+    SECTION("Fusable value statistics share one pass") {
+        IntervalReductionParams params;
+        params.reduction_name = "MeanValue";
+        params.column_name = "mean";
+        params.additional_reductions = {"MaxValue", "StdValue", "TimeOfMin", "ValueRange"};
+
+        auto result = run(params);
+
+        REQUIRE(result != nullptr);
+        REQUIRE(result->numRows() == 2);
+        REQUIRE(result->numColumns() == 5);
+        REQUIRE(result->columnNames() ==
+                std::vector<std::string>{"mean", "MaxValue", "StdValue", "TimeOfMin", "ValueRange"});
+
+        REQUIRE_THAT(tensorAt(*result, 0, 0), Catch::Matchers::WithinAbs(2.0, 1e-5));
+        REQUIRE_THAT(tensorAt(*result, 1, 1), Catch::Matchers::WithinAbs(9.0, 1e-5));
+        // Population std of five consecutive integers = sqrt(2)
+        REQUIRE_THAT(tensorAt(*result, 0, 2), Catch::Matchers::WithinAbs(1.41421, 1e-4));
+        REQUIRE_THAT(tensorAt(*result, 1, 3), Catch::Matchers::WithinAbs(5.0, 1e-5));
+        REQUIRE_THAT(tensorAt(*result, 1, 4), Catch::Matchers::WithinAbs(4.0, 1e-5));
+    }
+
+    SECTION("Matches one transform per reduction, including non-fusable ones") {
+        IntervalReductionParams params;
+        params.reduction_name = "AreaUnderCurve";
+        params.additional_reductions = {"TimeOfMax", "SumValue"};
+
+        auto combined = run(params);
+        REQUIRE(combined->numColumns() == 3);
+
+        for (std::size_t col = 0; col < 3; ++col) {
+            IntervalReductionParams single;
+            single.reduction_name = col == 0 ? params.reduction_name : params.additional_reductions[col - 1];
+            auto expected = run(single);
+            for (std::size_t row = 0; row < 2; ++row) {
+                REQUIRE_THAT(tensorAt(*combined, row, col),
+                             Catch::Matchers::WithinAbs(tensorAt(*expected, row, 0), 1e-5));
+            }
+        }
+    }
+}
+
 // ============================================================================
 // EventIntervalReduction Tests
 // ============================================================================
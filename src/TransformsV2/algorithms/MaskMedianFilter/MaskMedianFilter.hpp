@@ -49,11 +49,12 @@ struct MaskMedianFilterParams {
  *
  * Element-level transform: Mask2D → Mask2D
  *
- * Rasterizes the mask to a binary image, applies median filtering to remove
- * salt-and-pepper noise and smooth jagged boundaries, then converts back to mask points.
+ * Run-length encodes the mask and applies a binary median (majority) filter over
+ * the mask bounding box grown by half a window, removing salt-and-pepper noise and
+ * smoothing jagged boundaries without rasterizing the full frame.
  *
- * When canvas dimensions are omitted, the raster is sized to the mask bounding box
- * plus background border padding derived from `window_size`.
+ * When canvas dimensions are given, points outside the canvas are dropped and the
+ * canvas edges use reflection padding; otherwise everything outside the mask is background.
  *
  * When applied to containers:
  * - MaskData → MaskData (one filtered mask per input mask)
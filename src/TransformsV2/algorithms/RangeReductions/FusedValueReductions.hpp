@@ -0,0 +1,435 @@
+#ifndef NEURALYZER_V2_FUSED_VALUE_REDUCTIONS_HPP
+#define NEURALYZER_V2_FUSED_VALUE_REDUCTIONS_HPP
+
+/**
+ * @file FusedValueReductions.hpp
+ * @brief One-pass evaluation of several value range reductions
+ *
+ * Each reduction in ValueRangeReductions.hpp is its own scalar loop, so
+ * asking for max, min, mean, std and time-of-max reads the range five times.
+ * FusedValueAccumulator computes any subset of these statistics in a single
+ * pass over a contiguous float span:
+ *
+ * - The span is processed in blocks of `kFusedValueLanes` independent lanes
+ *   with branch-free selects, which compilers turn into SIMD code.
+ * - The kernel is specialized on which groups are needed (moments, extremes,
+ *   extreme positions), so positions are only carried when TimeOfMax or
+ *   TimeOfMin is requested.
+ * - Element spans (TimeValuePoint) are copied out in small stack chunks, and
+ *   times are only looked up for the final extreme positions.
+ *
+ * Results follow the single-statistic kernels exactly for empty ranges,
+ * NaN samples (skipped by min/max, propagated by mean/std/sum) and ties
+ * (the earliest extreme wins). Mean, std and sum may differ in the last
+ * bits because the sums are accumulated in a different order.
+ *
+ * ## Usage
+ *
+ * ```cpp
+ * std::array const stats{ValueStatistic::Max, ValueStatistic::Mean, ValueStatistic::TimeOfMax};
+ * auto const results = fusedValueReductions(std::span<TimeValuePoint const>{points}, stats);
+ * ```
+ *
+ * @see ValueRangeReductions.hpp for the single-statistic kernels
+ * @see RangeReductionRegistry::executeManyErased for type-erased routing
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Neuralyzer::Transforms::V2::RangeReductions {
+
+/// Number of independent accumulator lanes per block
+inline constexpr std::size_t kFusedValueLanes = 8;
+
+/**
+ * @brief Statistics the fused engine can compute
+ */
+enum class ValueStatistic : std::uint8_t {
+    Max,
+    Min,
+    Mean,
+    Std,///< Population standard deviation
+    Sum,
+    Range,
+    TimeOfMax,
+    TimeOfMin
+};
+
+/**
+ * @brief Small bit set of ValueStatistic
+ */
+class ValueStatisticSet {
+public:
+    constexpr ValueStatisticSet() = default;
+
+    constexpr void insert(ValueStatistic stat) noexcept {
+        _bits |= bit(stat);
+    }
+
+    [[nodiscard]] constexpr bool contains(ValueStatistic stat) const noexcept {
+        return (_bits & bit(stat)) != 0;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return _bits == 0; }
+
+    /// Mean, Std or Sum requested
+    [[nodiscard]] constexpr bool needsMoments() const noexcept {
+        return (_bits & (bit(ValueStatistic::Mean) | bit(ValueStatistic::Std) | bit(ValueStatistic::Sum))) != 0;
+    }
+
+    /// Any min/max based statistic requested
+    [[nodiscard]] constexpr bool needsExtremes() const noexcept {
+        return (_bits & (bit(ValueStatistic::Max) | bit(ValueStatistic::Min) | bit(ValueStatistic::Range))) != 0 ||
+               needsPositions();
+    }
+
+    /// TimeOfMax or TimeOfMin requested
+    [[nodiscard]] constexpr bool needsPositions() const noexcept {
+        return (_bits & (bit(ValueStatistic::TimeOfMax) | bit(ValueStatistic::TimeOfMin))) != 0;
+    }
+
+private:
+    static constexpr std::uint32_t bit(ValueStatistic stat) noexcept {
+        return std::uint32_t{1} << static_cast<std::uint32_t>(stat);
+    }
+
+    std::uint32_t _bits = 0;
+};
+
+/**
+ * @brief Statistic computed by a registered value-element reduction
+ *
+ * @param reduction_name Registered name, e.g. "MaxValue" or "TimeOfMax"
+ * @return The statistic, or nullopt if the reduction is not fusable
+ */
+[[nodiscard]] inline std::optional<ValueStatistic> fusedValueStatistic(std::string_view reduction_name) {
+    if (reduction_name == "MaxValue") return ValueStatistic::Max;
+    if (reduction_name == "MinValue") return ValueStatistic::Min;
+    if (reduction_name == "MeanValue") return ValueStatistic::Mean;
+    if (reduction_name == "StdValue") return ValueStatistic::Std;
+    if (reduction_name == "SumValue") return ValueStatistic::Sum;
+    if (reduction_name == "ValueRange") return ValueStatistic::Range;
+    if (reduction_name == "TimeOfMax") return ValueStatistic::TimeOfMax;
+    if (reduction_name == "TimeOfMin") return ValueStatistic::TimeOfMin;
+    return std::nullopt;
+}
+
+/**
+ * @brief Statistic computed by a registered raw float reduction
+ *
+ * @param reduction_name Registered name, e.g. "MeanValueRaw"
+ * @return The statistic, or nullopt if the reduction is not fusable
+ */
+[[nodiscard]] inline std::optional<ValueStatistic> fusedRawValueStatistic(std::string_view reduction_name) {
+    if (reduction_name == "MaxValueRaw") return ValueStatistic::Max;
+    if (reduction_name == "MinValueRaw") return ValueStatistic::Min;
+    if (reduction_name == "MeanValueRaw") return ValueStatistic::Mean;
+    if (reduction_name == "StdValueRaw") return ValueStatistic::Std;
+    return std::nullopt;
+}
+
+/**
+ * @brief Result of one fused pass
+ *
+ * Positions are offsets into the reduced range, or `npos` when no sample
+ * compared greater (less) than the initial -inf (+inf), e.g. all NaN.
+ */
+struct FusedValueSummary {
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    std::size_t count = 0;
+    double sum = 0.0;
+    double mean = std::numeric_limits<double>::quiet_NaN();
+    double m2 = 0.0;///< Sum of squared deviations from the mean
+    float max = -std::numeric_limits<float>::infinity();
+    float min = std::numeric_limits<float>::infinity();
+    std::size_t argmax = npos;
+    std::size_t argmin = npos;
+};
+
+/**
+ * @brief Lane-parallel accumulator for a fixed set of statistics
+ *
+ * Feed the range with one or more add() calls in order, then call finish().
+ * Only the groups needed by the requested statistics are accumulated.
+ */
+class FusedValueAccumulator {
+public:
+    explicit FusedValueAccumulator(ValueStatisticSet stats) noexcept
+        : _moments(stats.needsMoments()),
+          _extremes(stats.needsExtremes()),
+          _positions(stats.needsPositions()) {
+        _max.fill(-std::numeric_limits<float>::infinity());
+        _min.fill(std::numeric_limits<float>::infinity());
+        _argmax.fill(FusedValueSummary::npos);
+        _argmin.fill(FusedValueSummary::npos);
+    }
+
+    /**
+     * @brief Accumulate the next contiguous chunk of the range
+     */
+    void add(std::span<float const> values) noexcept {
+        if (values.empty()) {
+            return;
+        }
+        if (_count == 0) {
+            // Shifting by a sample keeps the squared sums well conditioned
+            _shift = std::isfinite(values.front()) ? static_cast<double>(values.front()) : 0.0;
+        }
+
+        if (_moments) {
+            if (_positions) {
+                accumulate<true, true, true>(values);
+            } else if (_extremes) {
+                accumulate<true, true, false>(values);
+            } else {
+                accumulate<true, false, false>(values);
+            }
+        } else if (_positions) {
+            accumulate<false, true, true>(values);
+        } else if (_extremes) {
+            accumulate<false, true, false>(values);
+        }
+        _count += values.size();
+    }
+
+    /**
+     * @brief Combine the lanes into the summary of everything added so far
+     */
+    [[nodiscard]] FusedValueSummary finish() const noexcept {
+        FusedValueSummary summary;
+        summary.count = _count;
+        if (_count == 0) {
+            return summary;
+        }
+
+        if (_moments) {
+            double s1 = 0.0;
+            double s2 = 0.0;
+            for (std::size_t l = 0; l < kFusedValueLanes; ++l) {
+                s1 += _s1[l];
+                s2 += _s2[l];
+            }
+            auto const n = static_cast<double>(_count);
+            summary.sum = s1 + _shift * n;
+            summary.mean = _shift + s1 / n;
+            // Clamp rounding below zero; NaN from non-finite samples propagates
+            double const m2 = s2 - s1 * s1 / n;
+            summary.m2 = m2 < 0.0 ? 0.0 : m2;
+        }
+
+        if (_extremes) {
+            for (std::size_t l = 0; l < kFusedValueLanes; ++l) {
+                // Equal values go to the earliest position, as in a sequential scan
+                if (_max[l] > summary.max || (_max[l] == summary.max && _argmax[l] < summary.argmax)) {
+                    summary.max = _max[l];
+                    summary.argmax = _argmax[l];
+                }
+                if (_min[l] < summary.min || (_min[l] == summary.min && _argmin[l] < summary.argmin)) {
+                    summary.min = _min[l];
+                    summary.argmin = _argmin[l];
+                }
+            }
+            if (!_positions) {
+                summary.argmax = FusedValueSummary::npos;
+                summary.argmin = FusedValueSummary::npos;
+            }
+        }
+        return summary;
+    }
+
+private:
+    template<bool Moments, bool Extremes, bool Positions>
+    void accumulate(std::span<float const> values) noexcept {
+        std::size_t const n = values.size();
+        float const * data = values.data();
+        double const shift = _shift;
+
+        // Branch-free lane step; the compiler vectorizes the fixed-width inner loop
+        auto const step = [&](std::size_t lane, std::size_t i) {
+            float const v = data[i];
+            if constexpr (Moments) {
+                double const d = static_cast<double>(v) - shift;
+                _s1[lane] += d;
+                _s2[lane] += d * d;
+            }
+            if constexpr (Extremes) {
+                bool const greater = v > _max[lane];
+                bool const less = v < _min[lane];
+                _max[lane] = greater ? v : _max[lane];
+                _min[lane] = less ? v : _min[lane];
+                if constexpr (Positions) {
+                    _argmax[lane] = greater ? _count + i : _argmax[lane];
+                    _argmin[lane] = less ? _count + i : _argmin[lane];
+                }
+            }
+        };
+
+        std::size_t i = 0;
+        for (; i + kFusedValueLanes <= n; i += kFusedValueLanes) {
+            for (std::size_t l = 0; l < kFusedValueLanes; ++l) {
+                step(l, i + l);
+            }
+        }
+        for (std::size_t l = 0; i < n; ++i, ++l) {
+            step(l, i);
+        }
+    }
+
+    bool _moments;
+    bool _extremes;
+    bool _positions;
+
+    std::size_t _count = 0;
+    double _shift = 0.0;
+
+    std::array<double, kFusedValueLanes> _s1{};
+    std::array<double, kFusedValueLanes> _s2{};
+    std::array<float, kFusedValueLanes> _max{};
+    std::array<float, kFusedValueLanes> _min{};
+    std::array<std::size_t, kFusedValueLanes> _argmax{};
+    std::array<std::size_t, kFusedValueLanes> _argmin{};
+};
+
+/**
+ * @brief Build the statistic set of @p stats
+ */
+[[nodiscard]] inline ValueStatisticSet makeValueStatisticSet(std::span<ValueStatistic const> stats) noexcept {
+    ValueStatisticSet set;
+    for (auto const stat: stats) {
+        set.insert(stat);
+    }
+    return set;
+}
+
+/**
+ * @brief Summarize a contiguous float span in one pass
+ */
+[[nodiscard]] inline FusedValueSummary summarizeValues(std::span<float const> values,
+                                                       ValueStatisticSet stats) noexcept {
+    FusedValueAccumulator accumulator(stats);
+    accumulator.add(values);
+    return accumulator.finish();
+}
+
+/**
+ * @brief Summarize a span of value elements in one pass
+ *
+ * Values are copied out in stack chunks so the lane kernel reads
+ * contiguous floats; times are not touched.
+ *
+ * @tparam Element Value element type (must have value() accessor)
+ */
+template<typename Element>
+[[nodiscard]] FusedValueSummary summarizeValues(std::span<Element const> points,
+                                                ValueStatisticSet stats) noexcept {
+    constexpr std::size_t kChunk = 256;
+    std::array<float, kChunk> buffer{};
+
+    FusedValueAccumulator accumulator(stats);
+    for (std::size_t begin = 0; begin < points.size(); begin += kChunk) {
+        std::size_t const count = std::min(kChunk, points.size() - begin);
+        for (std::size_t i = 0; i < count; ++i) {
+            buffer[i] = static_cast<float>(points[begin + i].value());
+        }
+        accumulator.add(std::span<float const>{buffer.data(), count});
+    }
+    return accumulator.finish();
+}
+
+/**
+ * @brief Value of one statistic, with the semantics of its single-statistic kernel
+ *
+ * @param summary Result of a pass that included @p stat
+ * @param stat Statistic to extract
+ * @param time_at Callable mapping a position in the range to its time as float
+ *
+ * @pre summary was accumulated with a set containing @p stat (enforcement: none) [IMPORTANT]
+ */
+template<typename TimeAt>
+[[nodiscard]] float valueStatistic(FusedValueSummary const & summary,
+                                   ValueStatistic stat,
+                                   TimeAt && time_at) {
+    constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    bool const empty = summary.count == 0;
+
+    switch (stat) {
+        case ValueStatistic::Max:
+            return summary.max;
+        case ValueStatistic::Min:
+            return summary.min;
+        case ValueStatistic::Mean:
+            return empty ? nan : static_cast<float>(summary.mean);
+        case ValueStatistic::Std:
+            if (empty) {
+                return nan;
+            }
+            if (summary.count == 1) {
+                return 0.0f;
+            }
+            return static_cast<float>(std::sqrt(summary.m2 / static_cast<double>(summary.count)));
+        case ValueStatistic::Sum:
+            return static_cast<float>(summary.sum);
+        case ValueStatistic::Range:
+            return empty ? nan : summary.max - summary.min;
+        case ValueStatistic::TimeOfMax:
+            return summary.argmax == FusedValueSummary::npos ? nan : time_at(summary.argmax);
+        case ValueStatistic::TimeOfMin:
+            return summary.argmin == FusedValueSummary::npos ? nan : time_at(summary.argmin);
+    }
+    return nan;
+}
+
+/**
+ * @brief Compute several statistics of a float span in one pass
+ *
+ * @pre @p stats contains no TimeOfMax / TimeOfMin (enforcement: none) [IMPORTANT]
+ * @post Result has one value per entry of @p stats, in order
+ */
+[[nodiscard]] inline std::vector<float> fusedValueReductions(std::span<float const> values,
+                                                             std::span<ValueStatistic const> stats) {
+    auto const summary = summarizeValues(values, makeValueStatisticSet(stats));
+    auto const no_time = [](std::size_t) { return std::numeric_limits<float>::quiet_NaN(); };
+
+    std::vector<float> results;
+    results.reserve(stats.size());
+    for (auto const stat: stats) {
+        results.push_back(valueStatistic(summary, stat, no_time));
+    }
+    return results;
+}
+
+/**
+ * @brief Compute several statistics of a value element span in one pass
+ *
+ * @tparam Element Value element type (must have time() and value() accessors)
+ * @post Result has one value per entry of @p stats, in order
+ */
+template<typename Element>
+[[nodiscard]] std::vector<float> fusedValueReductions(std::span<Element const> points,
+                                                      std::span<ValueStatistic const> stats) {
+    auto const summary = summarizeValues(points, makeValueStatisticSet(stats));
+    auto const time_at = [points](std::size_t pos) {
+        return static_cast<float>(points[pos].time().getValue());
+    };
+
+    std::vector<float> results;
+    results.reserve(stats.size());
+    for (auto const stat: stats) {
+        results.push_back(valueStatistic(summary, stat, time_at));
+    }
+    return results;
+}
+
+}// namespace Neuralyzer::Transforms::V2::RangeReductions
+
+#endif// NEURALYZER_V2_FUSED_VALUE_REDUCTIONS_HPP
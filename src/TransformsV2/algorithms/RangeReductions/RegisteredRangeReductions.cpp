@@ -1,6 +1,7 @@
 #include "RegisteredRangeReductions.hpp"
 
 #include "algorithms/RangeReductions/EventRangeReductions.hpp"
+#include "algorithms/RangeReductions/FusedValueReductions.hpp"
 #include "algorithms/RangeReductions/IntervalRangeReductions.hpp"
 #include "algorithms/RangeReductions/ValueRangeReductions.hpp"
 #include "core/RangeReductionRegistry.hpp"
@@ -307,6 +308,41 @@ void registerValueRangeReductions() {
                     .category = "Value Statistics (Raw)",
                     .requires_time_series_element = false,
                     .requires_value_element = false});
+
+    // ========================================================================
+    // Fused executors (several value statistics of one range in one pass)
+    // ========================================================================
+
+    registry.registerFusedReduction<TimeValuePoint>(FusedRangeReduction{
+            .supports = [](std::string const & name) {
+                return fusedValueStatistic(name).has_value();
+            },
+            .execute = [](std::span<std::string const> names, std::any const & input) {
+                std::vector<ValueStatistic> stats;
+                stats.reserve(names.size());
+                for (auto const & name: names) {
+                    stats.push_back(*fusedValueStatistic(name));
+                }
+                auto const points = std::any_cast<std::span<TimeValuePoint const>>(input);
+                auto const values = fusedValueReductions(points, std::span<ValueStatistic const>{stats});
+                return std::vector<std::any>(values.begin(), values.end());
+            }});
+
+    registry.registerFusedReduction<float>(FusedRangeReduction{
+            .supports = [](std::string const & name) {
+                return fusedRawValueStatistic(name).has_value();
+            },
+            .execute = [](std::span<std::string const> names, std::any const & input) {
+                std::vector<ValueStatistic> stats;
+                stats.reserve(names.size());
+                for (auto const & name: names) {
+                    stats.push_back(*fusedRawValueStatistic(name));
+                }
+                auto const values = fusedValueReductions(
+                        std::any_cast<std::span<float const>>(input),
+                        std::span<ValueStatistic const>{stats});
+                return std::vector<std::any>(values.begin(), values.end());
+            }});
 }
 
 // ============================================================================
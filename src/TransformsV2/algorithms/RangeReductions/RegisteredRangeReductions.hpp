@@ -71,6 +71,12 @@ void registerEventRangeReductions();
  * - AreaUnderCurve: Trapezoidal integration
  * - CountAboveThreshold: Samples above threshold
  * - FractionAboveThreshold: Fraction above threshold
+ *
+ * Also registers fused executors so that several of MaxValue, MinValue,
+ * MeanValue, StdValue, SumValue, ValueRange, TimeOfMax and TimeOfMin (or of
+ * the *Raw float variants) over one range are computed in a single pass.
+ *
+ * @see FusedValueReductions.hpp
  */
 void registerValueRangeReductions();
 
@@ -77,7 +77,12 @@ struct SincInterpolationParams {
  *
  * Where K = kernel_half_width and sinc(t) = sin(pi*t) / (pi*t), sinc(0) = 1.
  *
+ * The taps are taken from a polyphase table with one normalized row per
+ * output phase (see SincResampler), and output blocks are computed in
+ * parallel on the shared thread pool.
+ *
  * @pre params.upsampling_factor >= 1
+ * @pre params.kernel_half_width >= 1
  *
  * @param input Input analog time series with N samples
  * @param params Interpolation parameters
@@ -0,0 +1,311 @@
+/**
+ * @file SincResampler.cpp
+ * @brief Polyphase / lookup-table windowed-sinc resampling implementation.
+ */
+
+#include "SincResampler.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+
+namespace Neuralyzer::Transforms::V2::Examples {
+
+namespace {
+
+/// Output samples per parallel work item
+constexpr std::size_t output_grain = 8192;
+
+/**
+ * @brief Normalized sinc function
+ * 
+ * sinc(t) = sin(pi*t) / (pi*t), sinc(0) = 1.
+ */
+double sinc(double t) {
+    if (std::abs(t) < 1e-12) {
+        return 1.0;
+    }
+    double const pi_t = std::numbers::pi * t;
+    return std::sin(pi_t) / pi_t;
+}
+
+/**
+ * @brief Lanczos window
+ * 
+ * sinc(t / a) for |t| <= a, 0 otherwise.
+ */
+double lanczosWindow(double t, int a) {
+    if (std::abs(t) >= static_cast<double>(a)) {
+        return 0.0;
+    }
+    return sinc(t / static_cast<double>(a));
+}
+
+/**
+ * @brief Hann window
+ * 
+ * 0.5 * (1 + cos(pi*t/a)) for |t| <= a, 0 otherwise.
+ */
+double hannWindow(double t, int a) {
+    if (std::abs(t) >= static_cast<double>(a)) {
+        return 0.0;
+    }
+    return 0.5 * (1.0 + std::cos(std::numbers::pi * t / static_cast<double>(a)));
+}
+
+/**
+ * @brief Blackman window
+ * 
+ * 0.42 + 0.5 * cos(pi*t/a) + 0.08 * cos(2*pi*t/a) for |t| <= a, 0 otherwise.
+ */
+double blackmanWindow(double t, int a) {
+    if (std::abs(t) >= static_cast<double>(a)) {
+        return 0.0;
+    }
+    double const x = std::numbers::pi * t / static_cast<double>(a);
+    return 0.42 + 0.5 * std::cos(x) + 0.08 * std::cos(2.0 * x);
+}
+
+/**
+ * @brief Apply the selected window function.
+ */
+double applyWindow(double t, int a, SincWindowType window) {
+    switch (window) {
+        case SincWindowType::Hann:
+            return hannWindow(t, a);
+        case SincWindowType::Blackman:
+            return blackmanWindow(t, a);
+        case SincWindowType::Lanczos:
+        default:
+            return lanczosWindow(t, a);
+    }
+}
+
+/// @brief Fetch an input sample with boundary handling.
+/// @param data Input sample data
+/// @param index Integer sample index (may be out of bounds)
+/// @param n Total number of input samples
+/// @param mode Boundary handling mode
+float fetchSample(std::span<float const> data, int64_t index, int64_t n, BoundaryMode mode) {
+    if (index >= 0 && index < n) {
+        return data[static_cast<size_t>(index)];
+    }
+    if (mode == BoundaryMode::ZeroPad) {
+        return 0.0f;
+    }
+    // SymmetricExtension: reflect at boundaries
+    if (index < 0) {
+        // Reflect: -1 → 1, -2 → 2, etc.
+        int64_t const reflected = -index;
+        if (reflected < n) {
+            return data[static_cast<size_t>(reflected)];
+        }
+        return data[static_cast<size_t>(n - 1)];// clamp for very large overshoot
+    }
+    // index >= n: reflect from end
+    int64_t const reflected = 2 * (n - 1) - index;
+    if (reflected >= 0) {
+        return data[static_cast<size_t>(reflected)];
+    }
+    return data[0];// clamp for very large overshoot
+}
+
+/**
+ * @brief Dot product of contiguous samples and taps.
+ *
+ * Four independent partial sums let the compiler vectorize the loop without
+ * -ffast-math.
+ */
+double dotProduct(float const * samples, double const * taps, int count) {
+    double s0 = 0.0;
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    int j = 0;
+    for (; j + 4 <= count; j += 4) {
+        s0 += taps[j] * static_cast<double>(samples[j]);
+        s1 += taps[j + 1] * static_cast<double>(samples[j + 1]);
+        s2 += taps[j + 2] * static_cast<double>(samples[j + 2]);
+        s3 += taps[j + 3] * static_cast<double>(samples[j + 3]);
+    }
+    for (; j < count; ++j) {
+        s0 += taps[j] * static_cast<double>(samples[j]);
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+}// anonymous namespace
+
+SincResampler::SincResampler(int64_t num, int64_t den, int half_width, SincWindowType window, BoundaryMode boundary)
+    : _half_width(half_width),
+      _boundary(boundary),
+      _window(window) {
+    if (num < 1 || den < 1 || half_width < 1) {
+        throw std::invalid_argument("SincResampler: ratio terms and kernel half-width must be >= 1");
+    }
+    auto const g = std::gcd(num, den);
+    _num = num / g;
+    _den = den / g;
+    _ratio = static_cast<double>(_num) / static_cast<double>(_den);
+    _polyphase = _num <= max_polyphase_phases;
+    if (_polyphase) {
+        _buildRows(_num, 1.0 / static_cast<double>(_num));
+    } else {
+        _buildRows(lookup_resolution + 1, 1.0 / lookup_resolution);
+    }
+}
+
+SincResampler::SincResampler(double ratio, int half_width, SincWindowType window, BoundaryMode boundary)
+    : _half_width(half_width),
+      _boundary(boundary),
+      _window(window),
+      _ratio(ratio) {
+    if (!(ratio > 0.0) || !std::isfinite(ratio) || half_width < 1) {
+        throw std::invalid_argument("SincResampler: ratio must be positive and kernel half-width >= 1");
+    }
+
+    // Continued-fraction convergents p/q of the ratio; stop once one is exact enough
+    int64_t p_prev = 1;
+    int64_t q_prev = 0;
+    int64_t p = static_cast<int64_t>(std::floor(ratio));
+    int64_t q = 1;
+    double remainder = ratio - std::floor(ratio);
+    _polyphase = false;
+    while (p <= max_polyphase_phases) {
+        if (p >= 1 && std::abs(static_cast<double>(p) / static_cast<double>(q) - ratio) <= 1e-12 * ratio) {
+            _polyphase = true;
+            break;
+        }
+        if (remainder < 1e-15) {
+            break;
+        }
+        double const inv = 1.0 / remainder;
+        auto const a = static_cast<int64_t>(std::floor(inv));
+        remainder = inv - std::floor(inv);
+        int64_t const p_next = a * p + p_prev;
+        int64_t const q_next = a * q + q_prev;
+        p_prev = p;
+        q_prev = q;
+        p = p_next;
+        q = q_next;
+    }
+
+    if (_polyphase) {
+        _num = p;
+        _den = q;
+        _ratio = static_cast<double>(p) / static_cast<double>(q);
+        _buildRows(_num, 1.0 / static_cast<double>(_num));
+    } else {
+        _buildRows(lookup_resolution + 1, 1.0 / lookup_resolution);
+    }
+}
+
+void SincResampler::_buildRows(int64_t rows, double row_step) {
+    int const taps = 2 * _half_width;
+    _num_rows = rows;
+    _taps.assign(static_cast<size_t>(rows) * static_cast<size_t>(taps), 0.0);
+
+    // Row r holds the taps for input position center + r * row_step, i.e. for
+    // samples center - K + 1 ... center + K at offsets t = frac + (K - 1 - j).
+    for (int64_t r = 0; r < rows; ++r) {
+        double const frac = static_cast<double>(r) * row_step;
+        double * row = _taps.data() + r * taps;
+        double weight_sum = 0.0;
+        for (int j = 0; j < taps; ++j) {
+            double const t = frac + static_cast<double>(_half_width - 1 - j);
+            row[j] = sinc(t) * applyWindow(t, _half_width, _window);
+            weight_sum += row[j];
+        }
+        // Normalize to ensure DC preservation
+        if (std::abs(weight_sum) > 1e-15) {
+            for (int j = 0; j < taps; ++j) {
+                row[j] /= weight_sum;
+            }
+        }
+    }
+}
+
+int64_t SincResampler::outputSize(int64_t n_input) const {
+    if (n_input <= 0) {
+        return 0;
+    }
+    if (_polyphase) {
+        return (n_input - 1) * _num / _den + 1;
+    }
+    auto m_max = static_cast<int64_t>(std::floor(static_cast<double>(n_input - 1) * _ratio));
+    while (m_max > 0 && static_cast<double>(m_max) / _ratio > static_cast<double>(n_input - 1)) {
+        --m_max;
+    }
+    return m_max + 1;
+}
+
+float SincResampler::_dot(std::span<float const> input, int64_t center, double const * taps) const {
+    auto const n = static_cast<int64_t>(input.size());
+    int const count = 2 * _half_width;
+    int64_t const lo = center - _half_width + 1;
+    int64_t const hi = center + _half_width;
+
+    if (lo >= 0 && hi < n) {
+        return static_cast<float>(dotProduct(input.data() + lo, taps, count));
+    }
+
+    double accumulator = 0.0;
+    for (int j = 0; j < count; ++j) {
+        accumulator += taps[j] * static_cast<double>(fetchSample(input, lo + j, n, _boundary));
+    }
+    return static_cast<float>(accumulator);
+}
+
+void SincResampler::process(std::span<float const> input,
+                            int64_t m_begin,
+                            int64_t m_end,
+                            std::span<float> output) const {
+    if (m_end <= m_begin || input.empty()) {
+        return;
+    }
+    int const taps = 2 * _half_width;
+
+    CoreUtilities::parallelForChunks(
+            static_cast<std::size_t>(m_begin),
+            static_cast<std::size_t>(m_end),
+            output_grain,
+            [&](std::size_t chunk_begin, std::size_t chunk_end) {
+                std::vector<double> blended(_polyphase ? 0 : static_cast<size_t>(taps));
+                for (auto m = static_cast<int64_t>(chunk_begin); m < static_cast<int64_t>(chunk_end); ++m) {
+                    float & out = output[static_cast<size_t>(m - m_begin)];
+
+                    if (_polyphase) {
+                        int64_t const position = m * _den;
+                        int64_t const center = position / _num;
+                        int64_t const phase = position % _num;
+                        // Exact input sample — use it directly (avoids rounding artifacts)
+                        out = phase == 0 ? input[static_cast<size_t>(center)]
+                                         : _dot(input, center, _taps.data() + phase * taps);
+                        continue;
+                    }
+
+                    double const x = static_cast<double>(m) / _ratio;
+                    auto const center = static_cast<int64_t>(std::floor(x));
+                    double const frac = x - static_cast<double>(center);
+                    if (frac == 0.0) {
+                        out = input[static_cast<size_t>(center)];
+                        continue;
+                    }
+                    double const scaled = frac * lookup_resolution;
+                    auto const row = std::min(static_cast<int64_t>(scaled), int64_t{lookup_resolution - 1});
+                    double const a = scaled - static_cast<double>(row);
+                    double const * lower = _taps.data() + row * taps;
+                    double const * upper = lower + taps;
+                    for (int j = 0; j < taps; ++j) {
+                        blended[static_cast<size_t>(j)] = lower[j] + a * (upper[j] - lower[j]);
+                    }
+                    out = _dot(input, center, blended.data());
+                }
+            });
+}
+
+}// namespace Neuralyzer::Transforms::V2::Examples
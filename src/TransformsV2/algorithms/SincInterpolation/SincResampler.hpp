@@ -0,0 +1,95 @@
+/**
+ * @file SincResampler.hpp
+ * @brief Table-driven windowed-sinc resampling engine used by SincInterpolation.
+ *
+ * Output sample m sits at input position x_m = m / ratio. The windowed-sinc
+ * taps for every fractional offset that can occur are computed once:
+ *
+ * - Rational ratio num/den (with a small enough num): polyphase bank with one
+ *   normalized row of 2K taps per phase p/num. Every output sample is then a
+ *   single dot product, with no transcendental calls.
+ * - Any other ratio: a fine table of rows at offsets i/resolution; the taps
+ *   for an arbitrary offset are linearly interpolated between adjacent rows.
+ *
+ * Outputs are computed in independent chunks on the shared thread pool.
+ */
+
+#ifndef NEURALYZER_V2_SINC_RESAMPLER_HPP
+#define NEURALYZER_V2_SINC_RESAMPLER_HPP
+
+#include "SincInterpolation.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Neuralyzer::Transforms::V2::Examples {
+
+class SincResampler {
+public:
+    /// Largest number of polyphase rows before falling back to the lookup table
+    static constexpr int64_t max_polyphase_phases = 4096;
+
+    /// Rows per input sample in the lookup table used for non-rational ratios
+    static constexpr int lookup_resolution = 1024;
+
+    /**
+     * @brief Resampler for the rational ratio @p num / @p den (output samples per input sample).
+     *
+     * The ratio is reduced; if the reduced numerator exceeds max_polyphase_phases
+     * the lookup table is used instead.
+     *
+     * @pre num >= 1, den >= 1, half_width >= 1
+     */
+    SincResampler(int64_t num, int64_t den, int half_width, SincWindowType window, BoundaryMode boundary);
+
+    /**
+     * @brief Resampler for an arbitrary positive @p ratio (output samples per input sample).
+     *
+     * Ratios within 1e-12 (relative) of a fraction with a numerator of at most
+     * max_polyphase_phases use the polyphase bank; all others use the lookup table.
+     *
+     * @pre ratio > 0, half_width >= 1
+     */
+    SincResampler(double ratio, int half_width, SincWindowType window, BoundaryMode boundary);
+
+    /// @brief True if outputs come from the exact polyphase bank.
+    [[nodiscard]] bool isPolyphase() const { return _polyphase; }
+
+    /// @brief Number of coefficient rows (phases, or lookup rows).
+    [[nodiscard]] int64_t numRows() const { return _num_rows; }
+
+    /// @brief Number of output samples covering `[0, n_input - 1]`.
+    [[nodiscard]] int64_t outputSize(int64_t n_input) const;
+
+    /**
+     * @brief Compute outputs `[m_begin, m_end)` into `output[0, m_end - m_begin)`.
+     *
+     * Output positions that fall exactly on an input sample copy that sample.
+     * Results do not depend on how the range is split across calls or threads.
+     *
+     * @pre output.size() >= m_end - m_begin
+     */
+    void process(std::span<float const> input,
+                 int64_t m_begin,
+                 int64_t m_end,
+                 std::span<float> output) const;
+
+private:
+    void _buildRows(int64_t rows, double row_step);
+    [[nodiscard]] float _dot(std::span<float const> input, int64_t center, double const * taps) const;
+
+    int _half_width;
+    BoundaryMode _boundary;
+    SincWindowType _window;
+    bool _polyphase{true};
+    int64_t _num{1};
+    int64_t _den{1};
+    double _ratio{1.0};
+    int64_t _num_rows{1};
+    std::vector<double> _taps;///< `_num_rows` rows of 2K normalized taps (lookup table has one extra row)
+};
+
+}// namespace Neuralyzer::Transforms::V2::Examples
+
+#endif// NEURALYZER_V2_SINC_RESAMPLER_HPP
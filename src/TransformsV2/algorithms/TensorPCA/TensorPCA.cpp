@@ -50,7 +50,8 @@ auto tensorPCA(
 
     // Convert TensorData (row-major: rows=observations, cols=features)
     // to observations × features double matrix for NaN filtering
-    arma::fmat const & fmat = input.asArmadilloMatrix();
+    auto const arma_data = input.toArmadillo();
+    arma::fmat const & fmat = arma_data.asArmadilloMatrix();
 
     // NaN handling: check and filter based on policy
     auto const nan_policy = params.nan_policy;
@@ -49,7 +49,8 @@ auto tensorRobustPCA(
     ctx.reportProgress(0);
 
     // Convert TensorData to observations × features double matrix
-    arma::fmat const & fmat = input.asArmadilloMatrix();
+    auto const arma_data = input.toArmadillo();
+    arma::fmat const & fmat = arma_data.asArmadilloMatrix();
 
     // NaN handling: check and filter based on policy
     auto const nan_policy = params.nan_policy;
@@ -10,10 +10,11 @@
 #include "ParameterSchema/ParameterSchema.hpp"
 #include "Tensors/RowDescriptor.hpp"
 #include "Tensors/TensorData.hpp"
+#include "Tensors/storage/LaggedTensorStorage.hpp"
+#include "Tensors/storage/TensorStorageWrapper.hpp"
 #include "TimeFrame/TimeIndexStorage.hpp"
 
 #include <algorithm>
-#include <cassert>
 #include <cmath>
 #include <limits>
 #include <string>
@@ -120,41 +121,29 @@ auto tensorTemporalNeighbors(
     ctx.reportProgress(0);
 
     // --- Determine surviving rows (Drop mode) ---
-    std::vector<std::size_t> surviving_rows;
+    // Rows with every offset in range form one contiguous block:
+    // [max_lag, num_rows - max_lead)
+    int const max_lag = std::max(0, -*std::min_element(offsets.begin(), offsets.end()));
+    int const max_lead = std::max(0, *std::max_element(offsets.begin(), offsets.end()));
+
+    std::size_t row_begin = 0;
+    std::size_t out_rows = num_rows;
     if (params.boundary_policy == BoundaryPolicy::Drop) {
-        for (std::size_t r = 0; r < num_rows; ++r) {
-            bool all_valid = true;
-            for (int const offset: offsets) {
-                auto const neighbor = static_cast<std::ptrdiff_t>(r) + offset;
-                if (neighbor < 0 || neighbor >= static_cast<std::ptrdiff_t>(num_rows)) {
-                    all_valid = false;
-                    break;
-                }
-            }
-            if (all_valid) {
-                surviving_rows.push_back(r);
-            }
-        }
-        if (surviving_rows.empty()) {
+        auto const span = static_cast<std::size_t>(max_lag) + static_cast<std::size_t>(max_lead);
+        if (span >= num_rows) {
             ctx.logMessage("TensorTemporalNeighbors: Drop policy eliminated all rows");
             return nullptr;
         }
+        row_begin = static_cast<std::size_t>(max_lag);
+        out_rows = num_rows - span;
     }
 
     if (ctx.shouldCancel()) return nullptr;
     ctx.reportProgress(10);
 
-    // --- Compute output dimensions ---
-    std::size_t const num_offsets = offsets.size();
-    std::size_t const original_cols_in_output = params.include_original ? num_cols : 0;
-    std::size_t const total_out_cols =
-            original_cols_in_output + num_cols * num_offsets;
-    std::size_t const out_rows =
-            (params.boundary_policy == BoundaryPolicy::Drop) ? surviving_rows.size() : num_rows;
-
     // --- Build column names ---
     std::vector<std::string> out_col_names;
-    out_col_names.reserve(total_out_cols);
+    out_col_names.reserve(num_cols * (offsets.size() + 1));
 
     if (params.include_original) {
         auto const & src_names = input.columnNames();
@@ -169,51 +158,26 @@ auto tensorTemporalNeighbors(
         out_col_names.insert(out_col_names.end(), names.begin(), names.end());
     }
 
-    // --- Build flat output data (row-major) ---
-    auto const src_flat = input.materializeFlat();
-    std::vector<float> out_data(out_rows * total_out_cols);
-    float const fill = fillValue(params.boundary_policy);
-
-    for (std::size_t out_r = 0; out_r < out_rows; ++out_r) {
-        std::size_t const src_r =
-                (params.boundary_policy == BoundaryPolicy::Drop) ? surviving_rows[out_r] : out_r;
-
-        std::size_t out_col = 0;
-
-        // Original columns
-        if (params.include_original) {
-            for (std::size_t c = 0; c < num_cols; ++c) {
-                out_data[out_r * total_out_cols + out_col] = src_flat[src_r * num_cols + c];
-                ++out_col;
-            }
-        }
+    // --- Build a lagged view over the input (no per-offset copies) ---
+    // Offset 0 stands for the original columns.
+    std::vector<int> group_offsets;
+    group_offsets.reserve(offsets.size() + 1);
+    if (params.include_original) {
+        group_offsets.push_back(0);
+    }
+    group_offsets.insert(group_offsets.end(), offsets.begin(), offsets.end());
 
-        // Shifted columns for each offset (all columns)
-        for (int const offset: offsets) {
-            auto const neighbor = static_cast<std::ptrdiff_t>(src_r) + offset;
-            bool const in_bounds =
-                    (neighbor >= 0) && (neighbor < static_cast<std::ptrdiff_t>(num_rows));
-
-            std::size_t source_row = 0;
-            if (in_bounds) {
-                source_row = static_cast<std::size_t>(neighbor);
-            } else if (params.boundary_policy == BoundaryPolicy::Clamp) {
-                source_row = (neighbor < 0) ? 0 : (num_rows - 1);
-            }
-
-            for (std::size_t ci = 0; ci < num_cols; ++ci) {
-                if (in_bounds || params.boundary_policy == BoundaryPolicy::Clamp) {
-                    out_data[out_r * total_out_cols + out_col] =
-                            src_flat[source_row * num_cols + ci];
-                } else {
-                    out_data[out_r * total_out_cols + out_col] = fill;
-                }
-                ++out_col;
-            }
-        }
+    auto const out_of_range = (params.boundary_policy == BoundaryPolicy::Clamp)
+                                      ? LaggedOutOfRange::Clamp
+                                      : LaggedOutOfRange::Fill;
 
-        if (ctx.shouldCancel()) return nullptr;
-    }
+    TensorStorageWrapper storage{LaggedTensorStorage{
+            input.storage(),
+            std::move(group_offsets),
+            row_begin,
+            out_rows,
+            out_of_range,
+            fillValue(params.boundary_policy)}};
 
     ctx.reportProgress(80);
 
@@ -225,8 +189,8 @@ auto tensorTemporalNeighbors(
         // Build new SparseTimeIndexStorage from surviving row indices
         auto const & orig_storage = row_desc.timeStorage();
         std::vector<TimeFrameIndex> surviving_times;
-        surviving_times.reserve(surviving_rows.size());
-        for (auto r: surviving_rows) {
+        surviving_times.reserve(out_rows);
+        for (std::size_t r = row_begin; r < row_begin + out_rows; ++r) {
             surviving_times.push_back(orig_storage.getTimeFrameIndexAt(r));
         }
         out_time_storage = std::make_shared<SparseTimeIndexStorage>(std::move(surviving_times));
@@ -237,10 +201,8 @@ auto tensorTemporalNeighbors(
     ctx.reportProgress(100);
 
     return std::make_shared<TensorData>(
-            TensorData::createTimeSeries2D(
-                    out_data,
-                    out_rows,
-                    total_out_cols,
+            TensorData::createTimeSeries2DFromStorage(
+                    std::move(storage),
                     out_time_storage,
                     row_desc.timeFrame(),
                     out_col_names));
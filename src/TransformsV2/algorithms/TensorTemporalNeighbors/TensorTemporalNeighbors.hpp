@@ -77,6 +77,10 @@ struct TensorTemporalNeighborParams {
  * Output column layout: [original cols (if include_original)] [offset_1 cols] [offset_2 cols] ...
  * Shifted columns are named "{original_col}_lag{offset}" (e.g. "feat1_lag-1").
  *
+ * The output is a LaggedTensorStorage view that shares the input buffer; no
+ * per-offset copy is made. Consumers that need contiguous data materialize it
+ * on demand (toArmadillo(), materializeFlat(), getColumn()).
+ *
  * @pre input.ndim() == 2
  * @pre input.rowType() == RowType::TimeFrameIndex
  *
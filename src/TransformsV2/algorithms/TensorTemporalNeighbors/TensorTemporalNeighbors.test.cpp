@@ -518,6 +518,45 @@ TEST_CASE("TensorTemporalNeighbors exclude original columns", "[TensorTemporalNe
     CHECK(flat[2 * 4 + 3] == 41.0f);
 }
 
+// ============================================================================
+// Lagged view output
+// ============================================================================
+
+TEST_CASE("TensorTemporalNeighbors output is a lagged view", "[TensorTemporalNeighbors]") {
+    auto tensor = makeSimpleTensor();
+    TensorTemporalNeighborParams params;
+    params.lag_range = 2;
+    params.lead_range = 1;
+    params.boundary_policy = BoundaryPolicy::NaN;
+
+    auto result = tensorTemporalNeighbors(tensor, params, makeCtx());
+    REQUIRE(result != nullptr);
+    CHECK(result->storage().getStorageType() == TensorStorageType::Lagged);
+    CHECK_FALSE(result->isContiguous());
+
+    // Materializing to Armadillo yields the same values as the row-major copy
+    auto const flat = result->materializeFlat();
+    auto const arma_result = result->toArmadillo();
+    auto const & mat = arma_result.asArmadilloMatrix();
+    REQUIRE(mat.n_rows == 5);
+    REQUIRE(mat.n_cols == 8);
+    for (std::size_t r = 0; r < 5; ++r) {
+        for (std::size_t c = 0; c < 8; ++c) {
+            float const expected = flat[r * 8 + c];
+            if (std::isnan(expected)) {
+                CHECK(std::isnan(mat(r, c)));
+            } else {
+                CHECK(mat(r, c) == expected);
+            }
+        }
+    }
+
+    // Row 2: original=[30,31], lag-2=[10,11], lag-1=[20,21], lag+1=[40,41]
+    CHECK(mat(2, 2) == 10.0f);
+    CHECK(mat(2, 5) == 21.0f);
+    CHECK(mat(2, 6) == 40.0f);
+}
+
 // ============================================================================
 // Registry Integration
 // ============================================================================
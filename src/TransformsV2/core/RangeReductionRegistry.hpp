@@ -229,6 +229,30 @@ private:
     Params params_;
 };
 
+// ============================================================================
+// Fused Multi-Reduction Executor
+// ============================================================================
+
+/**
+ * @brief One-pass executor for several stateless reductions of one input type
+ *
+ * Registered next to the individual reductions it can replace. The registry
+ * only routes names for which `supports` returns true, so an executor may
+ * cover any subset of the reductions registered for its input type.
+ */
+struct FusedRangeReduction {
+    /// True if the named reduction can be computed by `execute`
+    std::function<bool(std::string const &)> supports;
+
+    /**
+     * @brief Compute every named reduction over one input range
+     *
+     * Receives the same std::any span as IRangeReduction::executeErased and
+     * returns one result per name, in order, typed like the individual reduction.
+     */
+    std::function<std::vector<std::any>(std::span<std::string const>, std::any const &)> execute;
+};
+
 // ============================================================================
 // Range Reduction Registry
 // ============================================================================
@@ -321,6 +345,19 @@ public:
         registerReduction<Element, Scalar, NoReductionParams>(name, std::move(wrapped), metadata);
     }
 
+    /**
+     * @brief Register a fused executor for reductions over @p Element spans
+     *
+     * Replaces any executor previously registered for the same element type.
+     *
+     * @pre Every name accepted by `fused.supports` is registered for @p Element
+     *      without parameters, and `execute` matches its result (enforcement: none) [IMPORTANT]
+     */
+    template<typename Element>
+    void registerFusedReduction(FusedRangeReduction fused) {
+        fused_reductions_[std::type_index(typeid(Element))] = std::move(fused);
+    }
+
     // ========================================================================
     // Typed Lookup
     // ========================================================================
@@ -550,6 +587,56 @@ public:
         return it->second->executeErased(input_range, params);
     }
 
+    /**
+     * @brief Execute several stateless reductions over the same input range
+     *
+     * Names covered by a fused executor for @p input_type are computed
+     * together in one pass when there are at least two of them; every other
+     * name runs through executeErased() with NoReductionParams.
+     *
+     * @param names Reduction names; duplicates are allowed
+     * @param input_type Type of input elements
+     * @param input_range std::any containing std::span<Element const>
+     * @return One std::any result per name, in order
+     * @throws std::runtime_error if a reduction is not found
+     */
+    std::vector<std::any> executeManyErased(std::span<std::string const> names,
+                                            std::type_index input_type,
+                                            std::any const & input_range) const {
+        std::vector<std::any> results(names.size());
+
+        std::vector<std::string> fused_names;
+        std::vector<std::size_t> fused_slots;
+        auto const fused_it = fused_reductions_.find(input_type);
+        if (fused_it != fused_reductions_.end()) {
+            for (std::size_t i = 0; i < names.size(); ++i) {
+                if (fused_it->second.supports(names[i])) {
+                    fused_names.push_back(names[i]);
+                    fused_slots.push_back(i);
+                }
+            }
+        }
+
+        if (fused_names.size() >= 2) {
+            auto fused_results = fused_it->second.execute(fused_names, input_range);
+            for (std::size_t j = 0; j < fused_slots.size(); ++j) {
+                results[fused_slots[j]] = std::move(fused_results[j]);
+            }
+        } else {
+            fused_slots.clear();
+        }
+
+        std::any const no_params{NoReductionParams{}};
+        for (std::size_t i = 0, next_fused = 0; i < names.size(); ++i) {
+            if (next_fused < fused_slots.size() && fused_slots[next_fused] == i) {
+                ++next_fused;
+                continue;
+            }
+            results[i] = executeErased(names[i], input_type, input_range, no_params);
+        }
+        return results;
+    }
+
 private:
     // ========================================================================
     // Parameter Handling Registration
@@ -615,6 +702,9 @@ private:
     std::unordered_map<std::type_index, std::function<std::any(std::string const &)>>
             param_deserializers_;
 
+    // Fused executors (input element type -> executor)
+    std::unordered_map<std::type_index, FusedRangeReduction> fused_reductions_;
+
     // Type triple to name mapping
     std::unordered_map<ReductionTypeTriple, std::string, ReductionTypeTripleHash> type_to_name_;
 };
@@ -934,6 +934,10 @@ private:
      * stores the results in the provided PipelineValueStore. The store can
      * then be used to apply bindings to transform step parameters.
      *
+     * Stateless reductions are executed together through
+     * RangeReductionRegistry::executeManyErased(), so statistics with a fused
+     * executor (e.g. MeanValueRaw + StdValueRaw) share one pass over the data.
+     *
      * @tparam InputElement The element type of the input data
      * @param input_span Span of input elements to reduce
      * @param store Value store to populate with reduction results
@@ -947,21 +951,52 @@ private:
 
         auto & registry = RangeReductionRegistry::instance();
 
-        for (auto const & reduction: pre_reductions_) {
-            // Wrap the input span in std::any for type-erased execution
-            std::any input_any{input_span};
-
-            // For stateless reductions, provide NoReductionParams if params is empty
-            std::any params_to_use = reduction.params.has_value()
-                                             ? reduction.params
-                                             : std::any{NoReductionParams{}};
-
-            // Execute the reduction using the registry's type-erased interface
-            std::any result_any = registry.executeErased(
-                    reduction.reduction_name,
-                    reduction.input_type,
-                    input_any,
-                    params_to_use);
+        // Wrap the input span in std::any for type-erased execution
+        std::any const input_any{input_span};
+
+        // Stateless reductions of this input type are batched into one call
+        std::vector<std::any> results(pre_reductions_.size());
+        std::vector<std::string> batch_names;
+        std::vector<std::size_t> batch_slots;
+        for (std::size_t i = 0; i < pre_reductions_.size(); ++i) {
+            auto const & reduction = pre_reductions_[i];
+            bool const stateless = !reduction.params.has_value() ||
+                                   reduction.params.type() == typeid(NoReductionParams);
+            if (stateless && reduction.input_type == std::type_index(typeid(InputElement))) {
+                batch_names.push_back(reduction.reduction_name);
+                batch_slots.push_back(i);
+            }
+        }
+        if (batch_names.size() >= 2) {
+            auto batch_results = registry.executeManyErased(
+                    batch_names, std::type_index(typeid(InputElement)), input_any);
+            for (std::size_t j = 0; j < batch_slots.size(); ++j) {
+                results[batch_slots[j]] = std::move(batch_results[j]);
+            }
+        } else {
+            batch_slots.clear();
+        }
+
+        for (std::size_t i = 0, next_batched = 0; i < pre_reductions_.size(); ++i) {
+            auto const & reduction = pre_reductions_[i];
+
+            if (next_batched < batch_slots.size() && batch_slots[next_batched] == i) {
+                ++next_batched;
+            } else {
+                // For stateless reductions, provide NoReductionParams if params is empty
+                std::any params_to_use = reduction.params.has_value()
+                                                 ? reduction.params
+                                                 : std::any{NoReductionParams{}};
+
+                // Execute the reduction using the registry's type-erased interface
+                results[i] = registry.executeErased(
+                        reduction.reduction_name,
+                        reduction.input_type,
+                        input_any,
+                        params_to_use);
+            }
+
+            auto const & result_any = results[i];
 
             // Store the result based on output type
             // Try common scalar types and store in the value store
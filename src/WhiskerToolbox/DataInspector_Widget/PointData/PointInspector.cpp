@@ -120,11 +120,8 @@ PointInspector::PointInspector(
                                     return;
                                 }
 
-                                int frames_exported = 0;
-                                for (size_t const frame_id: frame_ids_to_export) {
-                                    save_image(media_ptr.get(), static_cast<int>(frame_id), media_opts);
-                                    frames_exported++;
-                                }
+                                std::vector<int> const frame_ids(frame_ids_to_export.begin(), frame_ids_to_export.end());
+                                int const frames_exported = save_images(media_ptr.get(), frame_ids, media_opts);
 
                                 QMessageBox::information(this, "Media Export",
                                                          QString("Exported %1 media frames to: %2/%3")
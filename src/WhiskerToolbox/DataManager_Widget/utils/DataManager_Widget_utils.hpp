@@ -197,12 +197,8 @@ inline bool export_media_frames(DataManager * data_manager,
 
     media_export_opts.image_save_dir = primary_saved_parent_dir;
 
-    int success_count = 0;
-    for (size_t frame_id_sz: frame_ids_to_export) {
-        int frame_id = static_cast<int>(frame_id_sz);
-        save_image(media_data.get(), frame_id, media_export_opts);
-        success_count++;
-    }
+    std::vector<int> const frame_ids(frame_ids_to_export.begin(), frame_ids_to_export.end());
+    int const success_count = save_images(media_data.get(), frame_ids, media_export_opts);
     QMessageBox::information(parent_ptr, "Media Export Complete", QString("Successfully exported %1 of %2 frames.").arg(success_count).arg(frame_ids_to_export.size()));
     return true;
 }
@@ -86,6 +86,18 @@ void DeepLearningState::setBatchSize(int size) {
     }
 }
 
+std::string DeepLearningState::embeddingCacheDirectory() const {
+    return _data.embedding_cache_directory.value_or(std::string{});
+}
+
+void DeepLearningState::setEmbeddingCacheDirectory(std::string const & directory) {
+    if (embeddingCacheDirectory() != directory) {
+        _data.embedding_cache_directory = directory;
+        markDirty();
+        emit embeddingCacheDirectoryChanged();
+    }
+}
+
 int DeepLearningState::currentFrame() const {
     return _data.current_frame;
 }
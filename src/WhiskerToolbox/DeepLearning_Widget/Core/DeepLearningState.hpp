@@ -21,6 +21,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,9 @@ struct DeepLearningStateData {
     dl::PostEncoderStepDescriptor post_encoder_params;
     /// Per-model configuration JSON blobs keyed by model_id.
     std::map<std::string, std::string> model_configurations;
+    /// Directory of persistent embedding caches; absent or empty disables
+    /// caching. Optional so workspaces saved before it existed still load.
+    std::optional<std::string> embedding_cache_directory;
 };
 
 /**
@@ -71,6 +75,10 @@ public:
     [[nodiscard]] int batchSize() const;
     void setBatchSize(int size);
 
+    // ── Embedding Cache ──
+    [[nodiscard]] std::string embeddingCacheDirectory() const;
+    void setEmbeddingCacheDirectory(std::string const & directory);
+
     // ── Current Frame ──
     [[nodiscard]] int currentFrame() const;
     void setCurrentFrame(int frame);
@@ -116,6 +124,7 @@ signals:
     void modelChanged();
     void weightsPathChanged();
     void batchSizeChanged(int size);
+    void embeddingCacheDirectoryChanged();
     void currentFrameChanged(int frame);
     void inputBindingsChanged();
     void outputBindingsChanged();
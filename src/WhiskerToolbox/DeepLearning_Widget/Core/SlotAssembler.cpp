@@ -22,12 +22,14 @@
 #include "DeepLearning/registry/ModelRegistry.hpp"
 #include "DeepLearning/storage/DataBank.hpp"
 #include "DeepLearning/storage/DataBankEncode.hpp"
+#include "DeepLearning/storage/EmbeddingCache.hpp"
 #include "Lines/Line_Data.hpp"
 #include "Masks/Mask_Data.hpp"
 #include "Media/Media_Data.hpp"
 #include "Points/Point_Data.hpp"
 #include "Tensors/TensorData.hpp"
 
+#include <rfl/json.hpp>
 #include <spdlog/spdlog.h>
 
 #include <ATen/core/Tensor.h>             // at::Tensor
@@ -37,6 +39,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <iostream>
 #include <limits>
@@ -62,6 +65,47 @@ struct SlotAssembler::Impl {
 
     /// Named library of geometry sources and channel-encoded tensors.
     std::unique_ptr<dl::DataBank> data_bank;
+
+    /// Directory of persistent embedding caches; empty disables caching.
+    std::filesystem::path embedding_cache_dir;
+    /// Weights file applied by loadWeights(); its digest is computed lazily.
+    std::filesystem::path weights_path;
+    std::string weights_digest;
+    /// Parameters that change model outputs and therefore the cache key.
+    std::string model_configuration_json;
+    std::string post_encoder_json;
+
+    /// Precision / threading applied to every model this assembler creates.
+    dl::InferenceOptions inference_options;
+
+    /// Forget the identity of the loaded weights and model parameters.
+    void clearEmbeddingKeyState() {
+        weights_path.clear();
+        weights_digest.clear();
+        model_configuration_json.clear();
+        post_encoder_json.clear();
+    }
+
+    /// Cache key fields describing the model. weights_digest stays empty
+    /// when no weights file is known, which disables caching.
+    [[nodiscard]] dl::EmbeddingCacheKey modelCacheKey() {
+        if (weights_digest.empty() && !weights_path.empty()) {
+            try {
+                weights_digest = dl::fileContentDigest(weights_path);
+            } catch (std::exception const & e) {
+                spdlog::warn("SlotAssembler: cannot digest weights: {}", e.what());
+            }
+        }
+        dl::EmbeddingCacheKey key;
+        key.model_id = model_id;
+        key.weights_digest = weights_digest;
+        key.parameters = model_configuration_json + '\n' + post_encoder_json;
+        if (model && model->inferenceOptions().precision != dl::InferencePrecision::Native) {
+            key.parameters += "\nprecision=" +
+                              dl::precisionToString(model->inferenceOptions().precision);
+        }
+        return key;
+    }
 };
 
 // ════════════════════════════════════════════════════════════════════════════
@@ -699,6 +743,37 @@ assembleInputs(
     return decoded;
 }
 
+/**
+ * @brief Decode the first @p batch_size elements of one output binding at once.
+ *
+ * @returns One geometry per element, or nullopt when skipped due to rank mismatch.
+ */
+[[nodiscard]] std::optional<std::vector<dl::DecodedGeometryVariant>> decodeBindingGeometryBatch(
+        OutputBindingData const & binding,
+        at::Tensor const & tensor,
+        dl::DecoderContext const & ctx,
+        int batch_size,
+        char const * log_prefix) {
+    std::optional<std::vector<dl::DecodedGeometryVariant>> decoded;
+
+    binding.decoder.visit([&](auto const & params) {
+        using ParamsT = std::decay_t<decltype(params)>;
+        if constexpr (dl::isSpatialDecoderParams<ParamsT>()) {
+            if (tensor.dim() < 4) {
+                std::cerr << log_prefix << ": spatial decoder '"
+                          << dl::decoderFactoryName<ParamsT>()
+                          << "' requires 4D tensor [B,C,H,W], got dim="
+                          << tensor.dim()
+                          << " (post-encoder reduces rank). Skipping.\n";
+                return;
+            }
+        }
+        decoded = dl::decodeBatchToGeometry(tensor, ctx, params, batch_size);
+    });
+
+    return decoded;
+}
+
 /// @brief Verify the output data key is configured and already present in DataManager.
 void assertOutputDataKeyReady(
         DataManager & dm,
@@ -827,30 +902,73 @@ void decodeOutputs(
     }
 }
 
+/// Decode a whole batch of model outputs and write frame
+/// `first_frame + b` for every batch element b < batch_size.
+///
+/// Each output binding is decoded once for the batch (one CPU copy of the
+/// channel, elements decoded in parallel); writes happen in the same
+/// frame-major order as calling decodeOutputs() per element.
+///
+/// @pre first_frame >= 0 (enforcement: none) [IMPORTANT]
+/// @pre Every decoded output tensor holds at least batch_size elements
+///      (enforcement: exception) [CRITICAL]
+void decodeBatchOutputs(
+        DataManager & dm,
+        std::unordered_map<std::string, at::Tensor> const & outputs,
+        std::vector<OutputBindingData> const & output_bindings,
+        std::vector<dl::TensorSlotDescriptor> const & output_slots,
+        int first_frame,
+        int batch_size,
+        ImageSize source_image_size) {
+
+    std::vector<std::pair<OutputBindingData const *, std::vector<dl::DecodedGeometryVariant>>> decoded;
+
+    for (auto const & binding: output_bindings) {
+        if (binding.data_key.empty()) continue;
+        auto it = outputs.find(binding.slot_name);
+        if (it == outputs.end()) continue;
+
+        auto const * slot = findSlot(output_slots, binding.slot_name);
+        if (!slot) continue;
+
+        auto const ctx = makeDecoderContext(*slot, source_image_size, 0);
+        auto batch = decodeBindingGeometryBatch(
+                binding, it->second, ctx, batch_size, "SlotAssembler");
+        if (!batch) continue;
+
+        decoded.emplace_back(&binding, std::move(*batch));
+    }
+
+    for (int b = 0; b < batch_size; ++b) {
+        TimeFrameIndex const frame_idx(first_frame + b);
+        for (auto & [binding, geometries]: decoded) {
+            writeDecodedGeometryToDataManager(
+                    dm, binding->data_key, frame_idx, std::move(geometries[b]));
+        }
+    }
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // Offline (worker-thread) helpers
 // ────────────────────────────────────────────────────────────────────────────
 
-/// Decode model outputs into FrameResult entries instead of writing to
-/// DataManager. Returns a vector of decoded results for the given frame.
+/// Decode a whole batch of model outputs into FrameResult entries instead of
+/// writing to DataManager. Every output binding is decoded once for the batch;
+/// entry b holds the results for frame `first_frame + b`.
 ///
-/// @pre current_frame >= 0; a negative value is stored directly in
-///      FrameResult.frame, silently mislabeling the result frame;
-///      the sole caller derives current_frame from chunk_start >= 0
-///      (enforcement: none) [IMPORTANT]
-/// @pre batch_index >= 0; it is passed to decoder internals as a tensor
-///      batch-dimension index, causing out-of-bounds tensor access if negative;
-///      the sole caller passes loop variable b >= 0
-///      (enforcement: none) [CRITICAL]
-std::vector<FrameResult> decodeOutputsToBuffer(
+/// @pre first_frame >= 0 (enforcement: none) [IMPORTANT]
+/// @pre Every decoded output tensor holds at least batch_size elements
+///      (enforcement: exception) [CRITICAL]
+std::vector<std::vector<FrameResult>> decodeBatchOutputsToBuffer(
         std::unordered_map<std::string, at::Tensor> const & outputs,
         std::vector<OutputBindingData> const & output_bindings,
         std::vector<dl::TensorSlotDescriptor> const & output_slots,
-        int current_frame,
-        ImageSize source_image_size,
-        int batch_index = 0) {
+        int first_frame,
+        int batch_size,
+        ImageSize source_image_size) {
 
-    std::vector<FrameResult> frame_results;
+    std::vector<std::vector<FrameResult>> frame_results(
+            static_cast<std::size_t>(std::max(batch_size, 0)));
 
     for (auto const & binding: output_bindings) {
         if (binding.data_key.empty()) continue;
@@ -860,21 +978,175 @@ std::vector<FrameResult> decodeOutputsToBuffer(
         auto const * slot = findSlot(output_slots, binding.slot_name);
         if (!slot) continue;
 
-        auto const ctx =
-                makeDecoderContext(*slot, source_image_size, batch_index);
-        auto decoded = decodeBindingGeometry(
-                binding, it->second, ctx, "SlotAssembler(offline)");
+        auto const ctx = makeDecoderContext(*slot, source_image_size, 0);
+        auto decoded = decodeBindingGeometryBatch(
+                binding, it->second, ctx, batch_size, "SlotAssembler(offline)");
         if (!decoded) continue;
 
-        if (auto frame_result =
-                    toFrameResult(current_frame, binding.data_key, std::move(*decoded))) {
-            frame_results.push_back(std::move(*frame_result));
+        for (int b = 0; b < batch_size; ++b) {
+            if (auto frame_result = toFrameResult(
+                        first_frame + b, binding.data_key, std::move((*decoded)[b]))) {
+                frame_results[b].push_back(std::move(*frame_result));
+            }
         }
     }
 
     return frame_results;
 }
 
+// ── Persistent embedding cache ──
+
+/// Output slot paired with the persistent cache of its per-frame rows.
+struct SlotEmbeddingCache {
+    dl::TensorSlotDescriptor slot;
+    std::shared_ptr<dl::EmbeddingCache> cache;
+};
+
+/// Number of values per batch element of @p slot, or 0 for dynamic shapes.
+std::size_t slotFeatureDim(dl::TensorSlotDescriptor const & slot) {
+    std::size_t dim = 1;
+    for (auto const extent: slot.shape) {
+        if (extent <= 0) return 0;
+        dim *= static_cast<std::size_t>(extent);
+    }
+    return dim;
+}
+
+/// Complete @p model_key with the media identity of the run, and return the
+/// number of frames the cache must cover.
+///
+/// Returns 0 when the outputs may depend on anything besides the media
+/// frames and the model parameters (non-media inputs, memory frames), or
+/// when a media source has no backing file to identify it by.
+std::size_t completeEmbeddingCacheKey(
+        dl::EmbeddingCacheKey & model_key,
+        DataManager & dm,
+        MediaOverrides const * media_overrides,
+        std::vector<SlotBindingData> const & input_bindings,
+        std::vector<dl::MemoryFrameBinding> const & memory_frames) {
+    if (model_key.weights_digest.empty() || input_bindings.empty() ||
+        !memory_frames.empty()) {
+        return 0;
+    }
+
+    std::size_t num_frames = std::numeric_limits<std::size_t>::max();
+    for (auto const & binding: input_bindings) {
+        if (!dl::isImageEncoder(binding.encoder)) return 0;
+
+        std::shared_ptr<MediaData> media;
+        if (media_overrides) {
+            auto ov_it = media_overrides->find(binding.data_key);
+            if (ov_it != media_overrides->end()) media = ov_it->second;
+        }
+        if (!media) media = dm.getData<MediaData>(binding.data_key);
+        if (!media || media->getTotalFrameCount() <= 0) return 0;
+
+        auto const frame_count = static_cast<std::size_t>(media->getTotalFrameCount());
+        auto const identity = dl::mediaFileIdentity(media->getFilename(), frame_count);
+        if (identity.empty()) return 0;
+
+        num_frames = std::min(num_frames, frame_count);
+        model_key.media_identity += binding.slot_name + '=' + identity + '@' +
+                                    std::to_string(binding.time_offset) + '\n';
+        model_key.parameters += '\n' + binding.slot_name + '=' +
+                                rfl::json::write(binding.encoder);
+    }
+    return num_frames;
+}
+
+/// Open one cache per bound output slot. Returns an empty vector (caching
+/// disabled) if any bound slot cannot be cached.
+std::vector<SlotEmbeddingCache> openEmbeddingCaches(
+        std::filesystem::path const & directory,
+        dl::EmbeddingCacheKey key,
+        std::size_t num_frames,
+        std::vector<OutputBindingData> const & output_bindings,
+        std::vector<dl::TensorSlotDescriptor> const & output_slots) {
+    std::vector<SlotEmbeddingCache> caches;
+    if (num_frames == 0) return caches;
+
+    try {
+        for (auto const & binding: output_bindings) {
+            if (binding.data_key.empty()) continue;
+            auto const * slot = findSlot(output_slots, binding.slot_name);
+            if (!slot) continue;
+            if (std::ranges::any_of(caches, [&](SlotEmbeddingCache const & c) {
+                    return c.slot.name == slot->name;
+                })) {
+                continue;
+            }
+            auto const dim = slotFeatureDim(*slot);
+            if (dim == 0) return {};
+
+            key.output_slot = slot->name;
+            caches.push_back({*slot, dl::EmbeddingCache::open(directory, key, num_frames, dim)});
+        }
+    } catch (std::exception const & e) {
+        spdlog::warn("SlotAssembler: embedding cache disabled: {}", e.what());
+        return {};
+    }
+    return caches;
+}
+
+/// Whether every cache holds @p frame.
+bool isFrameCached(std::vector<SlotEmbeddingCache> const & caches, int frame) {
+    if (caches.empty() || frame < 0) return false;
+    return std::ranges::all_of(caches, [frame](SlotEmbeddingCache const & c) {
+        return c.cache->contains(static_cast<std::size_t>(frame));
+    });
+}
+
+/// Rebuild batched output tensors for frames [first_frame, first_frame + count).
+///
+/// @pre isFrameCached(caches, f) for every frame in the range
+///      (enforcement: exception from EmbeddingCache::row) [IMPORTANT]
+std::unordered_map<std::string, at::Tensor> restoreCachedOutputs(
+        std::vector<SlotEmbeddingCache> const & caches,
+        int first_frame,
+        int count) {
+    std::unordered_map<std::string, at::Tensor> outputs;
+    for (auto const & entry: caches) {
+        std::vector<int64_t> shape = {count};
+        shape.insert(shape.end(), entry.slot.shape.begin(), entry.slot.shape.end());
+        auto tensor = at::empty(shape, at::kFloat);
+        auto const dim = entry.cache->featureDim();
+        float * dst = tensor.data_ptr<float>();
+        for (int b = 0; b < count; ++b) {
+            auto const row = entry.cache->row(static_cast<std::size_t>(first_frame + b));
+            std::memcpy(dst + static_cast<std::size_t>(b) * dim, row.data(), row.size_bytes());
+        }
+        outputs[entry.slot.name] = tensor.to(dl::toTorchDType(entry.slot.dtype));
+    }
+    return outputs;
+}
+
+/// Write the rows of a freshly computed batch into the caches.
+void storeCachedOutputs(
+        std::vector<SlotEmbeddingCache> const & caches,
+        std::unordered_map<std::string, at::Tensor> const & outputs,
+        int first_frame,
+        int count) {
+    for (auto const & entry: caches) {
+        auto it = outputs.find(entry.slot.name);
+        if (it == outputs.end()) continue;
+
+        auto const dim = entry.cache->featureDim();
+        auto const rows = it->second.detach().to(at::kCPU, at::kFloat).contiguous();
+        if (static_cast<std::size_t>(rows.numel()) != dim * static_cast<std::size_t>(count)) {
+            spdlog::warn("SlotAssembler: output '{}' does not match its slot shape; not cached",
+                         entry.slot.name);
+            continue;
+        }
+        float const * src = rows.data_ptr<float>();
+        for (int b = 0; b < count; ++b) {
+            auto const frame = first_frame + b;
+            if (frame < 0 || static_cast<std::size_t>(frame) >= entry.cache->numFrames()) continue;
+            entry.cache->store(static_cast<std::size_t>(frame),
+                               {src + static_cast<std::size_t>(b) * dim, dim});
+        }
+    }
+}
+
 }// anonymous namespace
 
 // ════════════════════════════════════════════════════════════════════════════
@@ -899,12 +1171,16 @@ bool SlotAssembler::loadModel(std::string const & model_id) {
     _impl->model.reset();
     _impl->model_id.clear();
     _impl->post_encoder_module.reset();
+    _impl->clearEmbeddingKeyState();
 
     if (model_id.empty()) return false;
 
     auto model = dl::ModelRegistry::instance().create(model_id);
     if (!model) return false;
 
+    if (_impl->inference_options != dl::InferenceOptions{}) {
+        model->setInferenceOptions(_impl->inference_options);
+    }
     _impl->model = std::move(model);
     _impl->model_id = model_id;
     return true;
@@ -919,6 +1195,8 @@ bool SlotAssembler::loadWeights(std::string const & weights_path) {
 
     try {
         _impl->model->loadWeights(p);
+        _impl->weights_path = p;
+        _impl->weights_digest.clear();
         return true;
     } catch (std::exception const & e) {
         std::cerr << "SlotAssembler::loadWeights: " << e.what() << '\n';
@@ -984,6 +1262,7 @@ void SlotAssembler::resetModel() {
     _impl->model.reset();
     _impl->model_id.clear();
     _impl->post_encoder_module.reset();
+    _impl->clearEmbeddingKeyState();
     _impl->recurrent_cache.clear();
 }
 
@@ -1217,13 +1496,9 @@ void SlotAssembler::runBatchRange(
                 _impl->post_encoder_module.get(),
                 inputs);
 
-        // Decode each batch element individually
-        for (int b = 0; b < chunk_size; ++b) {
-            int const frame = chunk_start + b;
-            decodeOutputs(
-                    dm, outputs, output_bindings,
-                    effective_slots, frame, source_image_size, b);
-        }
+        decodeBatchOutputs(
+                dm, outputs, output_bindings,
+                effective_slots, chunk_start, chunk_size, source_image_size);
 
         frames_processed += chunk_size;
     }
@@ -1282,14 +1557,35 @@ BatchInferenceResult SlotAssembler::runBatchRangeOffline(
     int const total_frames = end_frame - start_frame + 1;
     int frames_processed = 0;
 
-    for (int chunk_start = start_frame; chunk_start <= end_frame;
-         chunk_start += batch_size) {
+    // Spatial-point extraction depends on per-frame DataManager points, so
+    // its outputs are not a function of the media alone.
+    std::vector<SlotEmbeddingCache> caches;
+    if (!_impl->embedding_cache_dir.empty() &&
+        !requiresSingleFrameBatch(_impl->post_encoder_module.get())) {
+        auto key = _impl->modelCacheKey();
+        auto const num_frames = completeEmbeddingCacheKey(
+                key, dm, &media_overrides, input_bindings, memory_frames);
+        caches = openEmbeddingCaches(
+                _impl->embedding_cache_dir, std::move(key), num_frames,
+                output_bindings, effective_slots);
+    }
+
+    // Chunks are runs of up to batch_size frames that are either all cached
+    // (restored without a forward pass) or all uncached.
+    int chunk_start = start_frame;
+    while (chunk_start <= end_frame) {
 
         if (cancel_requested.load(std::memory_order_relaxed)) {
             break;
         }
 
-        int const chunk_end = std::min(chunk_start + batch_size - 1, end_frame);
+        bool const cached = isFrameCached(caches, chunk_start);
+        int chunk_end = chunk_start;
+        while (chunk_end < end_frame &&
+               chunk_end - chunk_start + 1 < batch_size &&
+               isFrameCached(caches, chunk_end + 1) == cached) {
+            ++chunk_end;
+        }
         int const chunk_size = chunk_end - chunk_start + 1;
 
         if (progress) {
@@ -1297,27 +1593,31 @@ BatchInferenceResult SlotAssembler::runBatchRangeOffline(
         }
 
         try {
-            _updateSpatialPoint(dm, chunk_start);
-
-            auto inputs = assembleInputs(
-                    dm, *_impl->model,
-                    input_bindings, memory_frames,
-                    *_impl->data_bank,
-                    chunk_start, /*batch_size=*/chunk_size,
-                    &media_overrides);
-
-            auto outputs = runModelAndPostEncoder(
-                    *_impl->model,
-                    _impl->post_encoder_module.get(),
-                    inputs);
-
-            // Decode each batch element individually
-            for (int b = 0; b < chunk_size; ++b) {
-                int const frame = chunk_start + b;
-                auto frame_results = decodeOutputsToBuffer(
-                        outputs, output_bindings,
-                        effective_slots, frame, source_image_size, b);
+            std::unordered_map<std::string, at::Tensor> outputs;
+            if (cached) {
+                outputs = restoreCachedOutputs(caches, chunk_start, chunk_size);
+            } else {
+                _updateSpatialPoint(dm, chunk_start);
+
+                auto inputs = assembleInputs(
+                        dm, *_impl->model,
+                        input_bindings, memory_frames,
+                        *_impl->data_bank,
+                        chunk_start, /*batch_size=*/chunk_size,
+                        &media_overrides);
+
+                outputs = runModelAndPostEncoder(
+                        *_impl->model,
+                        _impl->post_encoder_module.get(),
+                        inputs);
 
+                storeCachedOutputs(caches, outputs, chunk_start, chunk_size);
+            }
+
+            auto batch_results = decodeBatchOutputsToBuffer(
+                    outputs, output_bindings,
+                    effective_slots, chunk_start, chunk_size, source_image_size);
+            for (auto & frame_results: batch_results) {
                 if (result_callback) {
                     result_callback(std::move(frame_results));
                 } else {
@@ -1334,6 +1634,7 @@ BatchInferenceResult SlotAssembler::runBatchRangeOffline(
         }
 
         frames_processed += chunk_size;
+        chunk_start = chunk_end + 1;
     }
 
     if (progress) {
@@ -1343,6 +1644,110 @@ BatchInferenceResult SlotAssembler::runBatchRangeOffline(
     return batch_result;
 }
 
+// ════════════════════════════════════════════════════════════════════════════
+// Instance: inference precision and threading
+// ════════════════════════════════════════════════════════════════════════════
+
+bool SlotAssembler::setInferenceOptions(dl::InferenceOptions const & options) {
+    _impl->inference_options = options;
+    if (!_impl->model) {
+        return true;
+    }
+    return _impl->model->setInferenceOptions(options);
+}
+
+dl::InferenceOptions SlotAssembler::inferenceOptions() const {
+    return _impl->inference_options;
+}
+
+std::vector<dl::InferenceModeResult> SlotAssembler::compareInferenceModes(
+        DataManager & dm,
+        std::vector<SlotBindingData> const & input_bindings,
+        std::vector<dl::MemoryFrameBinding> const & memory_frames,
+        int start_frame,
+        int end_frame,
+        int batch_size,
+        std::vector<dl::InferenceOptions> const & modes) {
+    if (!isModelReady()) {
+        throw std::invalid_argument(
+                "SlotAssembler::compareInferenceModes: model not loaded or weights missing");
+    }
+    if (end_frame < start_frame) {
+        throw std::invalid_argument(
+                "SlotAssembler::compareInferenceModes: end_frame must be >= start_frame");
+    }
+    batch_size = std::max(batch_size, 1);
+
+    torch::NoGradGuard const no_grad;
+
+    std::vector<std::unordered_map<std::string, at::Tensor>> batches;
+    for (int frame = start_frame; frame <= end_frame; frame += batch_size) {
+        int const chunk_size = std::min(batch_size, end_frame - frame + 1);
+        _updateSpatialPoint(dm, frame);
+        batches.push_back(assembleInputs(
+                dm, *_impl->model,
+                input_bindings, memory_frames,
+                *_impl->data_bank,
+                frame, chunk_size));
+    }
+
+    return dl::compareInferenceModes(*_impl->model, batches, modes);
+}
+
+// ════════════════════════════════════════════════════════════════════════════
+// Instance: persistent embedding cache
+// ════════════════════════════════════════════════════════════════════════════
+
+void SlotAssembler::setEmbeddingCacheDirectory(std::string const & directory) {
+    _impl->embedding_cache_dir = directory;
+}
+
+std::string SlotAssembler::embeddingCacheDirectory() const {
+    return _impl->embedding_cache_dir.string();
+}
+
+std::shared_ptr<TensorData> SlotAssembler::cachedEmbeddings(
+        DataManager & dm,
+        std::vector<SlotBindingData> const & input_bindings,
+        std::string const & output_slot,
+        int start_frame,
+        int end_frame) {
+    if (!_impl->model || _impl->embedding_cache_dir.empty() ||
+        start_frame < 0 || end_frame < start_frame) {
+        return nullptr;
+    }
+
+    auto const effective_slots = effectiveOutputSlotsFor(
+            _impl->model.get(),
+            _impl->post_encoder_module.get());
+    auto const * slot = findSlot(effective_slots, output_slot);
+    if (!slot || slotFeatureDim(*slot) == 0) {
+        return nullptr;
+    }
+
+    auto key = _impl->modelCacheKey();
+    auto const num_frames = completeEmbeddingCacheKey(
+            key, dm, nullptr, input_bindings, {});
+    if (num_frames == 0) {
+        return nullptr;
+    }
+    key.output_slot = output_slot;
+    if (!std::filesystem::exists(
+                dl::EmbeddingCache::pathFor(_impl->embedding_cache_dir, key))) {
+        return nullptr;
+    }
+
+    try {
+        auto const cache = dl::EmbeddingCache::open(
+                _impl->embedding_cache_dir, key, num_frames, slotFeatureDim(*slot));
+        return cache->toTensorData(static_cast<std::size_t>(start_frame),
+                                   static_cast<std::size_t>(end_frame));
+    } catch (std::exception const & e) {
+        spdlog::warn("SlotAssembler::cachedEmbeddings: {}", e.what());
+        return nullptr;
+    }
+}
+
 // ════════════════════════════════════════════════════════════════════════════
 // Instance: recurrent tensor cache
 // ════════════════════════════════════════════════════════════════════════════
@@ -1678,6 +2083,7 @@ void SlotAssembler::configurePostEncoderModule(
             params.module_key,
             params.parameters_json,
             source_image_size);
+    _impl->post_encoder_json = params.module_key + params.parameters_json;
 }
 
 void SlotAssembler::_updateSpatialPoint(DataManager & dm, int frame) {
@@ -1714,4 +2120,5 @@ void SlotAssembler::applyModelConfiguration(std::string const & configuration_js
             _impl->model_id,
             *_impl->model,
             configuration_json);
+    _impl->model_configuration_json = configuration_json;
 }
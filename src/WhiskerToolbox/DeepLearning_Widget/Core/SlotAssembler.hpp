@@ -20,8 +20,10 @@
 #include "DeepLearning_Widget/Core/MediaOverrides.hpp"           // MediaOverrides
 #include "DeepLearning_Widget/Inference/BatchInferenceResult.hpp"// BatchInferenceResult
 
-#include "DeepLearning/bindings/DeepLearningBindingData.hpp"// dl::MemoryFrameBinding
-#include "DeepLearning/models_v2/ModelInfo.hpp"             // dl::ModelInfo
+#include "DeepLearning/bindings/DeepLearningBindingData.hpp"   // dl::MemoryFrameBinding
+#include "DeepLearning/models_v2/InferenceModeComparison.hpp"  // dl::InferenceModeResult
+#include "DeepLearning/models_v2/ModelInfo.hpp"                // dl::ModelInfo
+#include "DeepLearning/models_v2/backends/InferenceOptions.hpp"// dl::InferenceOptions
 
 #include <atomic>
 #include <functional>
@@ -37,6 +39,7 @@ struct ImageSize;
 
 class DataManager;
 class MediaData;
+class TensorData;
 
 namespace dl {
 class DataBank;
@@ -168,6 +171,8 @@ public:
      *  - Returns decoded results in a BatchInferenceResult instead of
      *    calling addAtTime() on DataManager.
      *  - Checks @p cancel_requested before each frame for early exit.
+     *  - Reads and fills the persistent embedding cache when one is set
+     *    (see setEmbeddingCacheDirectory()).
      * 
      * @param dm DataManager for non-media input encoding (masks, points, lines)
      * @param media_overrides Cloned MediaData instances keyed by data_key
@@ -234,6 +239,88 @@ public:
             ImageSize source_image_size,
             ProgressCallback const & progress = nullptr);
 
+    // ── Instance: persistent embedding cache ──────────────────────────────
+
+    /**
+     * @brief Persist model outputs across runs in @p directory.
+     *
+     * When set, runBatchRangeOffline() writes each bound output slot's
+     * per-frame tensor into a dl::EmbeddingCache keyed by the media file,
+     * model ID, weights file contents and encoder / model / post-encoder
+     * parameters, and skips the forward pass for frames already cached.
+     * Runs with non-media inputs, memory frames or a spatial-point
+     * post-encoder bypass the cache. An empty path disables caching.
+     */
+    void setEmbeddingCacheDirectory(std::string const & directory);
+
+    /**
+     * @brief Current embedding cache directory, or empty if disabled.
+     */
+    [[nodiscard]] std::string embeddingCacheDirectory() const;
+
+    /**
+     * @brief Cached outputs of @p output_slot as a zero-copy TensorData.
+     *
+     * Rows are the flattened slot tensors for frames [start_frame, end_frame],
+     * time-indexed from start_frame and backed directly by the cache file
+     * mapping.
+     *
+     * @param dm DataManager used to resolve the media bindings
+     * @param input_bindings Dynamic input slot bindings of the cached run
+     * @param output_slot Model (or post-encoder) output slot name
+     * @param start_frame First frame (inclusive)
+     * @param end_frame Last frame (inclusive)
+     * @return nullptr if caching is disabled, the bindings are not cacheable,
+     *         or any frame in the range has not been cached yet.
+     */
+    [[nodiscard]] std::shared_ptr<TensorData> cachedEmbeddings(
+            DataManager & dm,
+            std::vector<SlotBindingData> const & input_bindings,
+            std::string const & output_slot,
+            int start_frame,
+            int end_frame);
+
+    // ── Instance: inference precision and threading ───────────────────────
+
+    /**
+     * @brief Precision and thread counts for the current and future models.
+     *
+     * Re-applied whenever a model is created by loadModel(). A non-native
+     * precision is part of the embedding cache key, so features computed in
+     * different precisions never mix.
+     *
+     * @return false if the loaded model does not support the precision; it
+     *         then runs natively.
+     */
+    bool setInferenceOptions(dl::InferenceOptions const & options);
+
+    /**
+     * @brief Options requested by setInferenceOptions().
+     */
+    [[nodiscard]] dl::InferenceOptions inferenceOptions() const;
+
+    /**
+     * @brief Accuracy-vs-throughput comparison of @p modes on real frames.
+     *
+     * Assembles model inputs for frames [start_frame, end_frame] in batches
+     * of @p batch_size, then runs the model in each mode with
+     * dl::compareInferenceModes(). Raw model outputs are compared (the
+     * post-encoder is not applied). The requested options are restored
+     * afterwards.
+     *
+     * @pre isModelReady() (enforcement: exception) [CRITICAL]
+     * @pre end_frame >= start_frame (enforcement: exception) [IMPORTANT]
+     * @throws std::invalid_argument on violation
+     */
+    [[nodiscard]] std::vector<dl::InferenceModeResult> compareInferenceModes(
+            DataManager & dm,
+            std::vector<SlotBindingData> const & input_bindings,
+            std::vector<dl::MemoryFrameBinding> const & memory_frames,
+            int start_frame,
+            int end_frame,
+            int batch_size,
+            std::vector<dl::InferenceOptions> const & modes);
+
     // ── Instance: device context ─────────────────────────────────────────
 
     /**
@@ -917,6 +917,15 @@ void DeepLearningPropertiesWidget::_onRunBatch() {
 
     form->addRow(tr("Interval series:"), interval_combo);
 
+    // Persistent embedding cache: frames already encoded with the same
+    // media, weights and parameters are read back instead of re-encoded.
+    auto * cache_edit = new QLineEdit(
+            QString::fromStdString(_state->embeddingCacheDirectory()), &dialog);
+    cache_edit->setPlaceholderText(tr("(disabled)"));
+    cache_edit->setToolTip(
+            tr("Directory for cached encoder outputs. Leave empty to disable."));
+    form->addRow(tr("Embedding cache:"), cache_edit);
+
     // Toggle enable state based on radio selection
     auto const update_mode = [=](bool manual_checked) {
         start_spin->setEnabled(manual_checked);
@@ -937,6 +946,9 @@ void DeepLearningPropertiesWidget::_onRunBatch() {
 
     _syncBindingsFromUi();
 
+    _state->setEmbeddingCacheDirectory(cache_edit->text().trimmed().toStdString());
+    _assembler->setEmbeddingCacheDirectory(_state->embeddingCacheDirectory());
+
     if (manual_radio->isChecked()) {
         int const start_frame = start_spin->value();
         int const end_frame = end_spin->value();
@@ -14,6 +14,8 @@
 #include "EditorState/EditorRegistry.hpp"
 #include "Media_Widget/Core/MediaWidgetState.hpp"
 
+#include "CoreUtilities/thread_pool.hpp"
+
 #include "ffmpeg_wrapper/videoencoder.h"
 #include "opencv2/opencv.hpp"
 #include <QCoreApplication>
@@ -24,12 +26,18 @@
 #include <QTableWidget>
 #include <QTableWidgetItem>
 
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <numbers>
 #include <regex>
 
+struct Export_Video_Widget::PendingFrames {
+    std::deque<std::future<cv::Mat>> frames;
+};
+
 Export_Video_Widget::Export_Video_Widget(
         std::shared_ptr<DataManager> data_manager,
         EditorRegistry * editor_registry,
@@ -77,6 +85,7 @@ Export_Video_Widget::Export_Video_Widget(
     ui->end_frame_spinbox->setMaximum(_data_manager->getTime()->getTotalFrameCount());
 
     _video_writer = std::make_unique<cv::VideoWriter>();
+    _pending_frames = std::make_unique<PendingFrames>();
 
     // Initialize media widget selection
     _updateMediaWidgetComboBox();
@@ -166,10 +175,10 @@ void Export_Video_Widget::_exportVideo() {
             if (sequence.has_title) {
                 std::cout << "Generating " << sequence.title_frames << " title frames for sequence " << (seq_idx + 1) << std::endl;
 
+                QImage const title_frame = _generateTitleFrame(output_width, output_height,
+                                                               sequence.title_text, sequence.title_font_size);
                 for (int i = 0; i < sequence.title_frames; i++) {
-                    QImage const title_frame = _generateTitleFrame(output_width, output_height,
-                                                             sequence.title_text, sequence.title_font_size);
-                    _writeFrameToVideo(title_frame);
+                    _writeFrameToVideo(title_frame, output_width, output_height);
                 }
             }
 
@@ -197,6 +206,7 @@ void Export_Video_Widget::_exportVideo() {
         if (start_num >= end_num) {
             std::cout << "Start frame must be less than end frame" << std::endl;
             disconnect(connection);
+            _flushPendingFrames();
             _video_writer->release();
             return;
         }
@@ -211,9 +221,9 @@ void Export_Video_Widget::_exportVideo() {
 
             std::cout << "Generating " << title_frame_count << " title frames" << std::endl;
 
+            QImage const title_frame = _generateTitleFrame(output_width, output_height, title_text, font_size);
             for (int i = 0; i < title_frame_count; i++) {
-                QImage const title_frame = _generateTitleFrame(output_width, output_height, title_text, font_size);
-                _writeFrameToVideo(title_frame);
+                _writeFrameToVideo(title_frame, output_width, output_height);
             }
         }
 
@@ -231,6 +241,7 @@ void Export_Video_Widget::_exportVideo() {
     }
 
     disconnect(connection);
+    _flushPendingFrames();
     _video_writer->release();
 
     // Generate audio track if enabled
@@ -341,14 +352,8 @@ void Export_Video_Widget::_handleCanvasUpdated(QImage const & canvasImage) {
     _last_written_frame = current_time;
 
 
-    // Resize canvas image to output dimensions
-    int const output_width = ui->output_width_spinbox->value();
-    int const output_height = ui->output_height_spinbox->value();
-
-    QImage const resized_image = canvasImage.scaled(output_width, output_height, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-
-    // Use the same conversion process as title frames
-    _writeFrameToVideo(resized_image);
+    // Resized to the output dimensions with the same conversion as title frames
+    _writeFrameToVideo(canvasImage, ui->output_width_spinbox->value(), ui->output_height_spinbox->value());
 }
 
 void Export_Video_Widget::_updateTitlePreview() {
@@ -371,20 +376,40 @@ void Export_Video_Widget::_updateTitlePreview() {
     ui->title_preview->setStyleSheet("background-color: black; border: 1px solid gray;");
 }
 
-void Export_Video_Widget::_writeFrameToVideo(QImage const & frame) {
-    // Ensure consistent format conversion for all frames
-    QImage convertedImage = frame.convertToFormat(QImage::Format_RGB888);
-
-    // Create cv::Mat with explicit stride to ensure consistency
-    cv::Mat const mat(convertedImage.height(), convertedImage.width(), CV_8UC3,
-                      const_cast<uchar *>(convertedImage.bits()), convertedImage.bytesPerLine());
-
-    // Convert RGB to BGR for OpenCV
-    cv::Mat matBGR;
-    cv::cvtColor(mat, matBGR, cv::COLOR_RGB2BGR);
+void Export_Video_Widget::_writeFrameToVideo(QImage frame, int const output_width, int const output_height) {
+    auto & pool = CoreUtilities::ThreadPool::shared();
+    // Enough queued frames to keep every worker busy, few enough to bound memory
+    std::size_t const max_in_flight = 2 * (pool.size() + 1);
+
+    // The canvas has to be rendered on the GUI thread, but QImage and cv::Mat
+    // are reentrant, so scaling and colour conversion run on the pool
+    _pending_frames->frames.push_back(pool.submit([frame = std::move(frame), output_width, output_height]() {
+        // Ensure consistent size and format conversion for all frames
+        QImage const convertedImage = frame.scaled(output_width, output_height, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)
+                                              .convertToFormat(QImage::Format_RGB888);
+
+        // Create cv::Mat with explicit stride to ensure consistency
+        cv::Mat const mat(convertedImage.height(), convertedImage.width(), CV_8UC3,
+                          const_cast<uchar *>(convertedImage.constBits()), convertedImage.bytesPerLine());
+
+        // Convert RGB to BGR for OpenCV; the result owns its pixels
+        cv::Mat matBGR;
+        cv::cvtColor(mat, matBGR, cv::COLOR_RGB2BGR);
+        return matBGR;
+    }));
+
+    // The writer is the single consumer and takes frames in submission order
+    while (_pending_frames->frames.size() >= max_in_flight) {
+        _video_writer->write(_pending_frames->frames.front().get());
+        _pending_frames->frames.pop_front();
+    }
+}
 
-    // Write the frame to the video
-    _video_writer->write(matBGR);
+void Export_Video_Widget::_flushPendingFrames() {
+    while (!_pending_frames->frames.empty()) {
+        _video_writer->write(_pending_frames->frames.front().get());
+        _pending_frames->frames.pop_front();
+    }
 }
 
 void Export_Video_Widget::_addSequence() {
@@ -110,6 +110,10 @@ private:
     // Frame tracking to prevent duplicate writes
     int64_t _last_written_frame{-1};
 
+    // Frames being scaled and converted on the thread pool, written in order
+    struct PendingFrames;
+    std::unique_ptr<PendingFrames> _pending_frames;
+
 private slots:
     void _exportVideo();
     void _handleCanvasUpdated(QImage const & canvasImage);
@@ -125,7 +129,8 @@ private slots:
 
 private:
     static QImage _generateTitleFrame(int width, int height, QString const & text, int font_size);
-    void _writeFrameToVideo(QImage const & frame);
+    void _writeFrameToVideo(QImage frame, int output_width, int output_height);
+    void _flushPendingFrames();
     std::pair<int, int> _getMediaDimensions() const;
     std::shared_ptr<MediaWidgetState> _getSelectedState() const;
     void _updateMediaWidgetComboBox();
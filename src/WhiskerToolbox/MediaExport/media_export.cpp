@@ -1,148 +1,272 @@
 #include "media_export.hpp"
 
+#include "media_export_kernels.hpp"
+
 #include "Media/Media_Data.hpp"
 #include "CoreUtilities/string_manip.hpp"
+#include "CoreUtilities/thread_pool.hpp"
 
 #include <QImage>
 
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <iostream>
+#include <optional>
+#include <variant>
+#include <vector>
 
+namespace {
 
-std::string get_image_save_name(MediaData const * media, int const frame_id, MediaExportOptions const & opts) {
-    
-    if (media == nullptr) {
-        std::cerr << "MediaData is nullptr" << std::endl;
-        return "";
-    }
-    
-    if (opts.save_by_frame_name) {
-        auto saveName = media->GetFrameID(frame_id);
-        return saveName;
-    } else {
+/**
+ * @brief Copy of one frame's pixels, detached from the MediaData frame cache
+ */
+struct FramePixels {
+    int width = 0;
+    int height = 0;
+    std::variant<std::vector<uint8_t>, std::vector<float>> data;
+};
 
-        std::string saveName = opts.image_name_prefix + pad_frame_id(frame_id, opts.frame_id_padding) + ".png";
-        return saveName;
-    }
-}
+/**
+ * @brief Outcome of encoding one frame, reported by the ordered consumer
+ */
+struct FrameWriteResult {
+    bool ok = false;
+    std::string message;
+};
 
-void save_image(MediaData * media, int const frame_id, MediaExportOptions const & opts)
-{
+/**
+ * @brief Create the output folder if needed and return it
+ */
+std::filesystem::path ensure_save_dir(MediaExportOptions const & opts) {
     std::filesystem::path save_dir = opts.image_save_dir;
     save_dir.append(opts.image_folder);
-    //std::filesystem::path save_dir = opts.image_save_dir + opts.image_folder;
     if (!std::filesystem::exists(save_dir)) {
         std::filesystem::create_directory(save_dir);
         std::cout << "Created directory " << save_dir << std::endl;
     }
+    return save_dir;
+}
+
+/**
+ * @brief Resolve the output path of a frame, or nullopt if it must be skipped
+ */
+std::optional<std::filesystem::path> resolve_save_path(MediaData const * media,
+                                                       int const frame_id,
+                                                       std::filesystem::path const & save_dir,
+                                                       MediaExportOptions const & opts) {
+    auto full_save_path = save_dir / get_image_save_name(media, frame_id, opts);
 
-    auto saveName = get_image_save_name(media, frame_id, opts);
-    auto full_save_path = save_dir / saveName;
-    
     // Check if file exists and handle according to overwrite setting
-    if (std::filesystem::exists(full_save_path) && !opts.overwrite_existing) {
-        std::cout << "Skipping existing file: " << full_save_path.string() << std::endl;
-        return;
-    }
-    
-    // Log if we're overwriting an existing file
-    if (std::filesystem::exists(full_save_path) && opts.overwrite_existing) {
+    if (std::filesystem::exists(full_save_path)) {
+        if (!opts.overwrite_existing) {
+            std::cout << "Skipping existing file: " << full_save_path.string() << std::endl;
+            return std::nullopt;
+        }
         std::cout << "Overwriting existing file: " << full_save_path.string() << std::endl;
     }
-    
-    auto width = media->getWidth();
-    auto height = media->getHeight();
+    return full_save_path;
+}
+
+/**
+ * @brief Copy a frame out of MediaData
+ *
+ * MediaData keeps a single decoded frame, so this must run on one thread;
+ * the returned copy can be converted and encoded anywhere.
+ */
+std::optional<FramePixels> fetch_frame(MediaData * media, int const frame_id) {
+    auto const width = media->getWidth();
+    auto const height = media->getHeight();
     if (width <= 0 || height <= 0) {
         std::cerr << "save_image: invalid image size " << width << "x" << height << std::endl;
-        return;
+        return std::nullopt;
     }
-    QImage labeled_image;
+    std::size_t const expected = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
 
-    // Handle different bit depths appropriately
     if (media->is8Bit()) {
-        // 8-bit data: use Grayscale8 format
-        auto image_8bit = media->getRawData8(frame_id);
-        std::size_t const expected = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        auto const & image_8bit = media->getRawData8(frame_id);
         if (image_8bit.size() < expected) {
             std::cerr << "save_image: 8-bit buffer too small (" << image_8bit.size() << ") expected " << expected << std::endl;
-            return;
-        }
-        QImage image(width, height, QImage::Format_Grayscale8);
-        if (image.isNull()) {
-            std::cerr << "save_image: failed to allocate 8-bit QImage" << std::endl;
-            return;
-        }
-        int const src_bpl = width; // 1 byte per pixel
-        for (int y = 0; y < height; ++y) {
-            unsigned char * dst = static_cast<unsigned char*>(image.scanLine(y));
-            std::size_t const src_start = static_cast<std::size_t>(y) * static_cast<std::size_t>(src_bpl);
-            std::copy_n(image_8bit.data() + src_start, static_cast<std::size_t>(src_bpl), dst);
+            return std::nullopt;
         }
-        labeled_image = std::move(image);
-    } else if (media->is32Bit()) {
-        // 32-bit float data: convert to 16-bit for higher precision saving
-        auto image_32bit = media->getRawData32(frame_id);
-        std::size_t const expected = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+        return FramePixels{width, height, std::vector<uint8_t>(image_8bit.begin(), image_8bit.begin() + static_cast<std::ptrdiff_t>(expected))};
+    }
+    if (media->is32Bit()) {
+        auto const & image_32bit = media->getRawData32(frame_id);
         if (image_32bit.size() < expected) {
             std::cerr << "save_image: 32-bit buffer too small (" << image_32bit.size() << ") expected " << expected << std::endl;
-            return;
+            return std::nullopt;
         }
+        return FramePixels{width, height, std::vector<float>(image_32bit.begin(), image_32bit.begin() + static_cast<std::ptrdiff_t>(expected))};
+    }
 
-        // Convert float data (assumed 0-255) to 16-bit (0-65535)
-        std::vector<uint16_t> image_16bit_converted;
-        image_16bit_converted.reserve(image_32bit.size());
+    std::cerr << "save_image: Unsupported media bit depth (not 8 or 32 bit)." << std::endl;
+    return std::nullopt;
+}
 
-        constexpr float kU8ToU16Scale = 257.0f; // 65535/255
-        for (float const pixel_value : image_32bit) {
-            float const clamped = std::clamp(pixel_value, 0.0f, 255.0f);
-            auto const value_16bit = static_cast<uint16_t>(clamped * kU8ToU16Scale);
-            image_16bit_converted.push_back(value_16bit);
-        }
+/**
+ * @brief Convert a frame to a QImage: 8-bit stays Grayscale8, float (0-255) becomes Grayscale16
+ */
+QImage to_qimage(FramePixels const & frame) {
+    auto const width = static_cast<std::size_t>(frame.width);
 
-        QImage image(width, height, QImage::Format_Grayscale16);
+    if (auto const * pixels = std::get_if<std::vector<uint8_t>>(&frame.data)) {
+        QImage image(frame.width, frame.height, QImage::Format_Grayscale8);
         if (image.isNull()) {
-            std::cerr << "save_image: failed to allocate 16-bit QImage" << std::endl;
-            return;
+            return image;
         }
-        std::size_t const src_bpl = static_cast<std::size_t>(width) * sizeof(uint16_t);
-        for (int y = 0; y < height; ++y) {
-            uint16_t * dst = static_cast<uint16_t*>(static_cast<void*>(image.scanLine(y)));
-            std::size_t const src_start = static_cast<std::size_t>(y) * static_cast<std::size_t>(width);
-            std::copy_n(image_16bit_converted.data() + src_start, static_cast<std::size_t>(width), dst);
+        for (int y = 0; y < frame.height; ++y) {
+            std::copy_n(pixels->data() + static_cast<std::size_t>(y) * width, width, image.scanLine(y));
         }
-        labeled_image = std::move(image);
-    } else {
-        std::cerr << "save_image: Unsupported media bit depth (not 8 or 32 bit)." << std::endl;
-        return;
+        return image;
     }
 
+    // 32-bit float data: convert to 16-bit for higher precision saving
+    auto const & pixels = std::get<std::vector<float>>(frame.data);
+    QImage image(frame.width, frame.height, QImage::Format_Grayscale16);
+    if (image.isNull()) {
+        return image;
+    }
+    for (int y = 0; y < frame.height; ++y) {
+        auto * dst = static_cast<uint16_t *>(static_cast<void *>(image.scanLine(y)));
+        convert_float_to_gray16({pixels.data() + static_cast<std::size_t>(y) * width, width}, {dst, width});
+    }
+    return image;
+}
+
+/**
+ * @brief Convert and encode one frame; safe to run on a worker thread
+ */
+FrameWriteResult write_frame(FramePixels const & frame, std::filesystem::path const & full_save_path) {
+    QImage labeled_image = to_qimage(frame);
     if (labeled_image.isNull()) {
-        std::cerr << "save_image: Constructed QImage is null; aborting save." << std::endl;
-        return;
+        return {false, "save_image: failed to allocate QImage for " + full_save_path.string()};
     }
 
-    bool ok = labeled_image.save(QString::fromStdString(full_save_path.string()));
+    auto const save_path = QString::fromStdString(full_save_path.string());
+    bool ok = labeled_image.save(save_path);
     if (!ok && labeled_image.format() == QImage::Format_Grayscale16) {
         // Fallback: down-convert to 8-bit and try again
-        QImage fallback8(width, height, QImage::Format_Grayscale8);
+        QImage fallback8(frame.width, frame.height, QImage::Format_Grayscale8);
         if (!fallback8.isNull()) {
-            for (int y = 0; y < height; ++y) {
-                unsigned char * dst = static_cast<unsigned char*>(fallback8.scanLine(y));
-                uint16_t const * src = reinterpret_cast<const uint16_t*>(labeled_image.constScanLine(y));
-                for (int x = 0; x < width; ++x) {
-                    dst[x] = static_cast<unsigned char>(src[x] / 257u);
-                }
+            auto const width = static_cast<std::size_t>(frame.width);
+            for (int y = 0; y < frame.height; ++y) {
+                auto const * src = static_cast<uint16_t const *>(static_cast<void const *>(labeled_image.constScanLine(y)));
+                convert_gray16_to_gray8({src, width}, {fallback8.scanLine(y), width});
             }
-            ok = fallback8.save(QString::fromStdString(full_save_path.string()));
-            labeled_image = std::move(fallback8);
+            ok = fallback8.save(save_path);
         }
     }
     if (ok) {
-        std::cout << "Saved image to " << full_save_path.string() << std::endl;
+        return {true, "Saved image to " + full_save_path.string()};
+    }
+    return {false, "Failed to save image to " + full_save_path.string()};
+}
+
+void report(FrameWriteResult const & result) {
+    if (result.message.empty()) {
+        return;
+    }
+    if (result.ok) {
+        std::cout << result.message << std::endl;
+    } else {
+        std::cerr << result.message << std::endl;
+    }
+}
+
+} // namespace
+
+
+std::string get_image_save_name(MediaData const * media, int const frame_id, MediaExportOptions const & opts) {
+
+    if (media == nullptr) {
+        std::cerr << "MediaData is nullptr" << std::endl;
+        return "";
+    }
+
+    if (opts.save_by_frame_name) {
+        auto saveName = media->GetFrameID(frame_id);
+        return saveName;
     } else {
-        std::cerr << "Failed to save image to " << full_save_path.string() << std::endl;
+
+        std::string saveName = opts.image_name_prefix + pad_frame_id(frame_id, opts.frame_id_padding) + ".png";
+        return saveName;
+    }
+}
+
+void save_image(MediaData * media, int const frame_id, MediaExportOptions const & opts)
+{
+    auto const save_dir = ensure_save_dir(opts);
+    auto const full_save_path = resolve_save_path(media, frame_id, save_dir, opts);
+    if (!full_save_path) {
+        return;
+    }
+
+    auto const frame = fetch_frame(media, frame_id);
+    if (!frame) {
+        return;
+    }
+    report(write_frame(*frame, *full_save_path));
+}
+
+int save_images(MediaData * media,
+                std::vector<int> const & frame_ids,
+                MediaExportOptions const & opts,
+                std::function<void(int, int)> const & progress_callback)
+{
+    if (media == nullptr) {
+        std::cerr << "MediaData is nullptr" << std::endl;
+        return 0;
     }
+
+    auto & pool = CoreUtilities::ThreadPool::shared();
+    // Enough queued frames to keep every worker busy, few enough to bound memory
+    std::size_t const max_in_flight = 2 * (pool.size() + 1);
+
+    auto const save_dir = ensure_save_dir(opts);
+    auto const total = static_cast<int>(frame_ids.size());
+    int frames_done = 0;
+    int frames_written = 0;
+
+    // Encoded frames are consumed in submission order, so logs and progress
+    // follow the frame order even though encoding finishes out of order
+    std::deque<std::future<FrameWriteResult>> in_flight;
+    auto consume_front = [&]() {
+        auto const result = in_flight.front().get();
+        in_flight.pop_front();
+        report(result);
+        frames_written += result.ok ? 1 : 0;
+        ++frames_done;
+        if (progress_callback) {
+            progress_callback(frames_done, total);
+        }
+    };
+
+    for (int const frame_id: frame_ids) {
+        auto full_save_path = resolve_save_path(media, frame_id, save_dir, opts);
+        auto frame = full_save_path ? fetch_frame(media, frame_id) : std::nullopt;
+        if (!frame) {
+            // Skipped or unreadable frames were already logged; keep their slot in the order
+            std::promise<FrameWriteResult> skipped;
+            skipped.set_value({});
+            in_flight.push_back(skipped.get_future());
+        } else {
+            in_flight.push_back(pool.submit(
+                    [frame = std::move(*frame), path = std::move(*full_save_path)]() {
+                        return write_frame(frame, path);
+                    }));
+        }
+
+        while (in_flight.size() >= max_in_flight) {
+            consume_front();
+        }
+    }
+    while (!in_flight.empty()) {
+        consume_front();
+    }
+
+    return frames_written;
 }
@@ -1,7 +1,9 @@
 #ifndef MEDIA_EXPORT_HPP
 #define MEDIA_EXPORT_HPP
 
+#include <functional>
 #include <string>
+#include <vector>
 
 class MediaData;
 
@@ -18,4 +20,20 @@ std::string get_image_save_name(MediaData const * media, int frame_id, MediaExpo
 
 void save_image(MediaData * media, int frame_id, MediaExportOptions const & opts);
 
+/**
+ * @brief Save many frames, converting and encoding them on the shared thread pool
+ *
+ * Frames are read from @p media on the calling thread (MediaData is not
+ * thread-safe), then pixel conversion and image encoding run on worker
+ * threads. Results are consumed in @p frame_ids order, with a bounded number
+ * of frames in flight. Needs no GUI: only QImage is used.
+ *
+ * @param progress_callback Optional; called as (frames_done, total) in frame order
+ * @return Number of frames written (skipped existing files are not counted)
+ */
+int save_images(MediaData * media,
+                std::vector<int> const & frame_ids,
+                MediaExportOptions const & opts,
+                std::function<void(int, int)> const & progress_callback = nullptr);
+
 #endif // MEDIA_EXPORT_HPP
@@ -0,0 +1,34 @@
+#include "media_export_kernels.hpp"
+
+#include <cstddef>
+
+namespace {
+
+/// Clamp to [0, 255] with comparisons that send NaN to 0 and vectorize to min/max
+inline float clamp_u8_range(float const value) {
+    float const lower = value > 0.0f ? value : 0.0f;
+    return lower < 255.0f ? lower : 255.0f;
+}
+
+} // namespace
+
+void convert_float_to_gray16(std::span<float const> src, std::span<uint16_t> dst) {
+    constexpr float kU8ToU16Scale = 257.0f; // 65535/255
+    float const * in = src.data();
+    uint16_t * out = dst.data();
+    std::size_t const n = src.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        // Through int32 so the float -> integer conversion has a packed instruction
+        out[i] = static_cast<uint16_t>(static_cast<int32_t>(clamp_u8_range(in[i]) * kU8ToU16Scale));
+    }
+}
+
+void convert_gray16_to_gray8(std::span<uint16_t const> src, std::span<uint8_t> dst) {
+    uint16_t const * in = src.data();
+    uint8_t * out = dst.data();
+    std::size_t const n = src.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        // x / 257 == (x * 0xFF01) >> 24 for every 16-bit x, avoiding a vector divide
+        out[i] = static_cast<uint8_t>((static_cast<uint32_t>(in[i]) * 0xFF01u) >> 24);
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef MEDIA_EXPORT_KERNELS_HPP
+#define MEDIA_EXPORT_KERNELS_HPP
+
+/**
+ * @file media_export_kernels.hpp
+ * @brief Pixel format conversions used when writing media frames to disk
+ *
+ * The kernels are branch-free loops over contiguous buffers so the compiler
+ * can vectorize them. They have no Qt dependency and are safe to call from
+ * worker threads.
+ */
+
+#include <cstdint>
+#include <span>
+
+/**
+ * @brief Convert float pixels in [0, 255] to 16-bit grayscale (x * 257)
+ *
+ * Values are clamped to [0, 255] first; NaN maps to 0.
+ *
+ * @pre dst.size() >= src.size()
+ */
+void convert_float_to_gray16(std::span<float const> src, std::span<uint16_t> dst);
+
+/**
+ * @brief Convert 16-bit grayscale to 8-bit grayscale (x / 257)
+ *
+ * @pre dst.size() >= src.size()
+ */
+void convert_gray16_to_gray8(std::span<uint16_t const> src, std::span<uint8_t> dst);
+
+#endif // MEDIA_EXPORT_KERNELS_HPP
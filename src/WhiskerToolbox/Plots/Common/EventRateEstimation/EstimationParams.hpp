@@ -38,9 +38,14 @@ struct BinningParams {
     [[nodiscard]] bool operator==(BinningParams const &) const = default;
 };
 
-// Future methods — stubs for the variant, not yet implemented:
-
-/// @brief Parameters for Gaussian kernel smoothing (stub — not yet implemented)
+/**
+ * @brief Parameters for Gaussian kernel smoothing
+ *
+ * Events are binned at `eval_step` and the histogram is convolved with a
+ * normalized Gaussian of standard deviation `sigma`. Values are expected
+ * counts per `eval_step` summed across trials, so `applyScaling()` treats them
+ * like binned counts with `sample_spacing = eval_step`.
+ */
 struct GaussianKernelParams {
     double sigma = 20.0;       ///< Kernel bandwidth (same units as window)
     double eval_step = 1.0;    ///< Spacing of evaluation points
@@ -48,7 +53,13 @@ struct GaussianKernelParams {
     [[nodiscard]] bool operator==(GaussianKernelParams const &) const = default;
 };
 
-/// @brief Parameters for causal exponential filter (stub — not yet implemented)
+/**
+ * @brief Parameters for a causal exponential filter
+ *
+ * Events are binned at `eval_step` and passed through a one-pole filter with
+ * time constant `tau`, so each event only raises the rate after it occurs.
+ * Values are counts per `eval_step` summed across trials, as for the Gaussian kernel.
+ */
 struct CausalExponentialParams {
     double tau = 50.0;         ///< Decay time constant
     double eval_step = 1.0;    ///< Spacing of evaluation points
@@ -71,9 +82,6 @@ struct CausalExponentialParams {
  *  1. Define a new `*Params` struct above
  *  2. Append it to this alias
  *  3. Add the implementation in `EventRateEstimation.cpp`
- *
- * @note GaussianKernelParams and CausalExponentialParams are included in the
- * variant but their implementations return empty RateEstimate (stub).
  */
 using EstimationParams = std::variant<BinningParams, GaussianKernelParams, CausalExponentialParams>;
 
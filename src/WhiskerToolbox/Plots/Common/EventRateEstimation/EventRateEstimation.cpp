@@ -1,11 +1,22 @@
 #include "EventRateEstimation.hpp"
 
+#include "RateKernels.hpp"
+
+#include "CoreUtilities/thread_pool.hpp"
+#include "GatherResult/FlatEventGather.hpp"
 #include "GatherResult/GatherResult.hpp"
 #include "Plots/Common/PlotAlignmentWindowPreparation.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace Neuralyzer::Plots {
@@ -89,6 +100,9 @@ std::vector<UnitGatherContext> createUnitGatherContexts(
 
 namespace {
 
+/// Trials smoothed per parallel chunk
+constexpr size_t kTrialsPerChunk = 16;
+
 /**
  * @brief Build the bin-center time vector for a binned histogram
  *
@@ -110,55 +124,50 @@ namespace {
 }
 
 /**
- * @brief Histogram binning implementation (aggregate across trials)
- *
- * Iterates over every valid trial in `gathered`, converts each event's
- * `TimeFrameIndex` to an absolute time via `time_frame` (or falls back to the
- * raw index value when `time_frame` is null), subtracts the per-trial alignment
- * time to get a relative time, and increments the corresponding bin.
+ * @brief Event-count histograms on a uniform grid over the analysis window
+ */
+struct TrialHistograms {
+    std::vector<double> aggregate;               ///< Counts summed over trials
+    std::vector<std::vector<double>> per_trial;  ///< Per-trial counts (only if requested)
+    size_t num_trials = 0;
+};
+
+/**
+ * @brief Count events of every present trial into `aggregate` (and `per_trial` if non-null)
  *
- * Events outside `[-half_window, +half_window)` are silently discarded.
+ * Reads the relative times of each trial straight from the CSR block and
+ * increments the corresponding bin. Events outside
+ * `[-half_window, +half_window)` are silently discarded. Trials whose
+ * gathered row was null (`FlatEventGather::missing_trials`) are skipped and
+ * get no `per_trial` row. Both outputs are resized and zeroed here, so their
+ * capacity is reused across calls.
  *
- * Returns a `RateEstimate` with bin centers in `times[]` and raw counts in
- * `values[]`.
+ * @pre num_bins > 0 and bin_size > 0
  */
-[[nodiscard]] RateEstimate binningEstimate(
-        GatherResult<DigitalEventSeries> const & gathered,
-        TimeFrame const * time_frame,
+void countEvents(
+        FlatEventGather const & flat,
         double window_size,
-        BinningParams const & params) {
+        double bin_size,
+        int num_bins,
+        std::vector<double> & aggregate,
+        std::vector<std::vector<double>> * per_trial) {
     double const half_window = window_size / 2.0;
-    double const bin_size = params.bin_size;
-
-    if (bin_size <= 0.0 || window_size <= 0.0) {
-        return RateEstimate{};
-    }
+    auto const n_bins = static_cast<size_t>(num_bins);
 
-    int const num_bins = static_cast<int>(std::ceil(window_size / bin_size));
-    if (num_bins <= 0) {
-        return RateEstimate{};
+    aggregate.assign(n_bins, 0.0);
+    if (per_trial) {
+        per_trial->assign(flat.presentTrialCount(), std::vector<double>(n_bins, 0.0));
     }
 
-    std::vector<double> histogram(static_cast<size_t>(num_bins), 0.0);
-    size_t num_trials = 0;
-
-    for (size_t trial_idx = 0; trial_idx < gathered.size(); ++trial_idx) {
-        auto const & trial_view = gathered[trial_idx];
-        if (!trial_view) {
+    auto missing = flat.missing_trials.begin();
+    size_t row = 0;
+    for (size_t trial_idx = 0; trial_idx < flat.trialCount(); ++trial_idx) {
+        if (missing != flat.missing_trials.end() && *missing == trial_idx) {
+            ++missing;
             continue;
         }
-
-        // t=0 reference for this trial (absolute time)
-        auto const alignment_time =
-                static_cast<double>(gathered.alignmentTimeAt(trial_idx).getValue());
-
-        if (!time_frame) {
-            std::throw_with_nested(std::runtime_error("binningEstimate: no TimeFrame"));
-        }
-        for (auto const & event: trial_view->view()) {
-            double const event_abs = static_cast<double>(event.time().getValue());
-
-            double const relative_time = event_abs - alignment_time;
+        for (auto const relative_ticks: flat.trialTimes(trial_idx)) {
+            auto const relative_time = static_cast<double>(relative_ticks);
 
             // Discard events outside the analysis window.
             if (relative_time < -half_window || relative_time >= half_window) {
@@ -170,92 +179,174 @@ namespace {
                     std::floor((relative_time + half_window) / bin_size));
             bin_index = std::clamp(bin_index, 0, num_bins - 1);
 
-            histogram[static_cast<size_t>(bin_index)] += 1.0;
+            aggregate[static_cast<size_t>(bin_index)] += 1.0;
+            if (per_trial) {
+                (*per_trial)[row][static_cast<size_t>(bin_index)] += 1.0;
+            }
         }
-
-        ++num_trials;
+        ++row;
     }
-
-    RateEstimate result;
-    result.times = buildBinCenters(num_bins, half_window, bin_size);
-    result.values = std::move(histogram);
-    result.num_trials = num_trials;
-    result.metadata.sample_spacing = bin_size;
-    return result;
 }
 
 /**
- * @brief Histogram binning with per-trial breakdown
+ * @brief Flatten `gathered` for histogramming
  *
- * Same as `binningEstimate()` but also stores each trial's individual histogram.
+ * @param trials_per_chunk Parallel partition size passed to `gatherFlat()`; 0 flattens serially
+ * @throws std::runtime_error if there are trials but no TimeFrame
  */
-[[nodiscard]] RateEstimateWithTrials binningEstimateWithTrials(
+[[nodiscard]] FlatEventGather flattenForEstimate(
         GatherResult<DigitalEventSeries> const & gathered,
         TimeFrame const * time_frame,
-        double window_size,
-        BinningParams const & params) {
-    double const half_window = window_size / 2.0;
-    double const bin_size = params.bin_size;
-
-    if (bin_size <= 0.0 || window_size <= 0.0) {
-        return RateEstimateWithTrials{};
+        size_t trials_per_chunk = kTrialsPerChunk) {
+    if (!gathered.empty() && !time_frame) {
+        std::throw_with_nested(std::runtime_error("estimateRate: no TimeFrame"));
     }
+    return gatherFlat(gathered, {.trials_per_chunk = trials_per_chunk});
+}
 
-    int const num_bins = static_cast<int>(std::ceil(window_size / bin_size));
-    if (num_bins <= 0) {
-        return RateEstimateWithTrials{};
+/**
+ * @brief Number of `step`-wide samples covering the window, or 0 if invalid
+ */
+[[nodiscard]] int gridSize(double window_size, double step) {
+    if (step <= 0.0 || window_size <= 0.0) {
+        return 0;
     }
+    return std::max(0, static_cast<int>(std::ceil(window_size / step)));
+}
 
-    auto const n_bins = static_cast<size_t>(num_bins);
-    std::vector<double> aggregate(n_bins, 0.0);
-    std::vector<std::vector<double>> per_trial;
-    size_t num_trials = 0;
-
-    for (size_t trial_idx = 0; trial_idx < gathered.size(); ++trial_idx) {
-        auto const & trial_view = gathered[trial_idx];
-        if (!trial_view) {
-            continue;
-        }
-
-        std::vector<double> trial_hist(n_bins, 0.0);
-
-        auto const alignment_time =
-                static_cast<double>(gathered.alignmentTimeAt(trial_idx).getValue());
+/**
+ * @brief Evaluation grid and smoothing of one estimation method
+ *
+ * Depends only on `window_size` and the parameters, so it is built once and
+ * shared by every unit (and thread) of a multi-unit estimate. Smoothing is
+ * linear, so the aggregate can be smoothed once rather than summing the
+ * smoothed trials.
+ */
+struct GridEstimator {
+    double step = 0.0;
+    int num_points = 0;                          ///< 0 if the parameters are invalid
+    std::vector<double> times;                   ///< Bin centers, size num_points
+    std::function<void(std::span<double>)> smooth;///< In-place smoothing; safe to call concurrently
 
-        if (!time_frame) {
-            std::throw_with_nested(std::runtime_error("binningEstimateWithTrials: no TimeFrame"));
-        }
+    [[nodiscard]] bool valid() const { return num_points > 0; }
+};
 
-        for (auto const & event: trial_view->view()) {
-            double const event_abs = static_cast<double>(event.time().getValue());
+/**
+ * @brief Build the grid and smoother for `params`
+ *
+ * - Binning: raw counts per `bin_size` bin, no smoothing.
+ * - Gaussian kernel: counts per `eval_step` convolved with N(0, sigma²), so
+ *   values scale like binned counts.
+ * - Causal exponential: counts per `eval_step` through a one-pole IIR; each
+ *   event contributes only to later evaluation points, decaying with `tau`.
+ */
+[[nodiscard]] GridEstimator makeGridEstimator(
+        double window_size,
+        EstimationParams const & params) {
+    GridEstimator grid;
+    std::visit(
+            [&](auto const & p) {
+                using T = std::decay_t<decltype(p)>;
+                if constexpr (std::is_same_v<T, BinningParams>) {
+                    grid.step = p.bin_size;
+                    grid.num_points = gridSize(window_size, grid.step);
+                    grid.smooth = [](std::span<double>) {};
+                } else if constexpr (std::is_same_v<T, GaussianKernelParams>) {
+                    grid.step = p.eval_step;
+                    grid.num_points = p.sigma < 0.0 ? 0 : gridSize(window_size, grid.step);
+                    if (grid.valid()) {
+                        auto smoother = std::make_shared<GaussianSmoother const>(
+                                static_cast<size_t>(grid.num_points), p.sigma / p.eval_step);
+                        grid.smooth = [smoother](std::span<double> values) { smoother->apply(values); };
+                    }
+                } else {
+                    static_assert(std::is_same_v<T, CausalExponentialParams>);
+                    grid.step = p.eval_step;
+                    grid.num_points = p.tau < 0.0 ? 0 : gridSize(window_size, grid.step);
+                    double const tau_samples = p.tau / p.eval_step;
+                    grid.smooth = [tau_samples](std::span<double> values) {
+                        causalExponentialSmooth(values, tau_samples);
+                    };
+                }
+            },
+            params);
 
-            double const relative_time = event_abs - alignment_time;
+    if (grid.valid()) {
+        grid.times = buildBinCenters(grid.num_points, window_size / 2.0, grid.step);
+    }
+    return grid;
+}
 
-            if (relative_time < -half_window || relative_time >= half_window) {
-                continue;
-            }
+/**
+ * @brief Per-trial and aggregate estimate of one unit on `grid`
+ *
+ * Per-trial curves are smoothed in parallel.
+ */
+[[nodiscard]] RateEstimateWithTrials gridEstimateWithTrials(
+        FlatEventGather const & flat,
+        double window_size,
+        GridEstimator const & grid,
+        bool keep_per_trial) {
+    if (!grid.valid()) {
+        return RateEstimateWithTrials{};
+    }
 
-            int bin_index = static_cast<int>(
-                    std::floor((relative_time + half_window) / bin_size));
-            bin_index = std::clamp(bin_index, 0, num_bins - 1);
+    TrialHistograms hist;
+    hist.num_trials = flat.presentTrialCount();
+    countEvents(flat, window_size, grid.step, grid.num_points, hist.aggregate,
+                keep_per_trial ? &hist.per_trial : nullptr);
 
-            trial_hist[static_cast<size_t>(bin_index)] += 1.0;
-            aggregate[static_cast<size_t>(bin_index)] += 1.0;
+    grid.smooth(std::span<double>(hist.aggregate));
+    CoreUtilities::parallelForChunks(0, hist.per_trial.size(), kTrialsPerChunk,
+                                     [&](size_t lo, size_t hi) {
+        for (size_t t = lo; t < hi; ++t) {
+            grid.smooth(std::span<double>(hist.per_trial[t]));
         }
+    });
 
-        per_trial.push_back(std::move(trial_hist));
-        ++num_trials;
+    RateEstimateWithTrials result;
+    result.estimate.times = grid.times;
+    result.estimate.values = std::move(hist.aggregate);
+    result.estimate.num_trials = hist.num_trials;
+    result.estimate.metadata.sample_spacing = grid.step;
+    result.trials.per_trial_values = std::move(hist.per_trial);
+    return result;
+}
+
+/**
+ * @brief Aggregate estimate of one unit on `grid`, counting into `bins`
+ *
+ * `bins` is scratch owned by the calling thread; only the final curve is
+ * allocated per unit.
+ */
+[[nodiscard]] RateEstimate gridEstimate(
+        FlatEventGather const & flat,
+        double window_size,
+        GridEstimator const & grid,
+        std::vector<double> & bins) {
+    if (!grid.valid()) {
+        return RateEstimate{};
     }
 
-    RateEstimateWithTrials result;
-    result.estimate.times = buildBinCenters(num_bins, half_window, bin_size);
-    result.estimate.values = std::move(aggregate);
-    result.estimate.num_trials = num_trials;
-    result.estimate.metadata.sample_spacing = bin_size;
-    result.trials.per_trial_values = std::move(per_trial);
+    countEvents(flat, window_size, grid.step, grid.num_points, bins, nullptr);
+    grid.smooth(std::span<double>(bins));
+
+    RateEstimate result;
+    result.times = grid.times;
+    result.values.assign(bins.begin(), bins.end());
+    result.num_trials = flat.presentTrialCount();
+    result.metadata.sample_spacing = grid.step;
     return result;
 }
 
+/**
+ * @brief Histogram bins reused by every unit estimated on this thread
+ */
+[[nodiscard]] std::vector<double> & threadHistogramBuffer() {
+    thread_local std::vector<double> bins;
+    return bins;
+}
+
 }// anonymous namespace
 
 // =============================================================================
@@ -267,16 +358,7 @@ RateEstimate estimateRate(
         TimeFrame const * time_frame,
         double window_size,
         EstimationParams const & params) {
-    return std::visit(
-            [&](auto const & p) -> RateEstimate {
-                using T = std::decay_t<decltype(p)>;
-                if constexpr (std::is_same_v<T, BinningParams>) {
-                    return binningEstimate(gathered, time_frame, window_size, p);
-                }
-                // Stub for unimplemented methods
-                return RateEstimate{};
-            },
-            params);
+    return estimateRate(flattenForEstimate(gathered, time_frame), window_size, params);
 }
 
 RateEstimateWithTrials estimateRateWithTrials(
@@ -284,30 +366,50 @@ RateEstimateWithTrials estimateRateWithTrials(
         TimeFrame const * time_frame,
         double window_size,
         EstimationParams const & params) {
-    return std::visit(
-            [&](auto const & p) -> RateEstimateWithTrials {
-                using T = std::decay_t<decltype(p)>;
-                if constexpr (std::is_same_v<T, BinningParams>) {
-                    return binningEstimateWithTrials(
-                            gathered, time_frame, window_size, p);
-                }
-                // Stub for unimplemented methods
-                return RateEstimateWithTrials{};
-            },
-            params);
+    return estimateRateWithTrials(flattenForEstimate(gathered, time_frame), window_size, params);
 }
 
-std::vector<RateEstimate> estimateRates(
-        std::vector<UnitGatherContext> const & units,
+RateEstimate estimateRate(
+        FlatEventGather const & flat,
         double window_size,
         EstimationParams const & params) {
-    std::vector<RateEstimate> results;
-    results.reserve(units.size());
+    return gridEstimate(flat, window_size, makeGridEstimator(window_size, params),
+                        threadHistogramBuffer());
+}
 
-    for (auto const & unit: units) {
-        results.push_back(estimateRate(
-                unit.gathered, unit.time_frame.get(), window_size, params));
-    }
+RateEstimateWithTrials estimateRateWithTrials(
+        FlatEventGather const & flat,
+        double window_size,
+        EstimationParams const & params) {
+    return gridEstimateWithTrials(flat, window_size, makeGridEstimator(window_size, params), true);
+}
+
+std::vector<RateEstimate> estimateRates(
+        std::vector<UnitGatherContext> const & units,
+        double window_size,
+        EstimationParams const & params,
+        RateEstimateCallback const & on_estimate,
+        std::atomic<bool> const * cancelled) {
+    std::vector<RateEstimate> results(units.size());
+    auto const grid = makeGridEstimator(window_size, params);
+    std::mutex callback_mutex;
+
+    // One unit per chunk: trial counts vary a lot between units. Each unit is
+    // flattened serially, since the units already occupy the pool.
+    CoreUtilities::parallelForChunks(0, units.size(), 1, [&](size_t lo, size_t hi) {
+        auto & bins = threadHistogramBuffer();
+        for (size_t i = lo; i < hi; ++i) {
+            if (cancelled && cancelled->load(std::memory_order_relaxed)) {
+                return;
+            }
+            auto const flat = flattenForEstimate(units[i].gathered, units[i].time_frame.get(), 0);
+            results[i] = gridEstimate(flat, window_size, grid, bins);
+            if (on_estimate) {
+                std::lock_guard<std::mutex> const lock(callback_mutex);
+                on_estimate(i, results[i]);
+            }
+        }
+    });
 
     return results;
 }
@@ -25,9 +25,11 @@
  *
  * Converts aligned trial data into `RateEstimate` objects — paired `(times, values)`
  * vectors suitable for direct plotting. The estimation method is a variation point
- * expressed via `EstimationParams`, a `std::variant` of per-method parameter structs.
- * Currently only `BinningParams` (histogram binning) is implemented; additional
- * methods are added by:
+ * expressed via `EstimationParams`, a `std::variant` of per-method parameter structs:
+ * `BinningParams` (histogram binning), `GaussianKernelParams` and
+ * `CausalExponentialParams`. The kernel methods bin events at `eval_step` and
+ * smooth the histogram (FFT/FIR Gaussian, one-pole IIR; see RateKernels.hpp), so
+ * their cost does not grow with the number of events. Additional methods are added by:
  *  - Defining a new `*Params` struct below
  *  - Adding it to the `EstimationParams` alias
  *  - Adding a visitor branch in `EventRateEstimation.cpp`
@@ -72,11 +74,14 @@
 #include "EstimationParams.hpp"
 
 #include "DataManager/DataManager.hpp"
+#include "GatherResult/FlatEventGather.hpp"
 #include "GatherResult/GatherResult.hpp"
 #include "DigitalTimeSeries/Digital_Event_Series.hpp"
 #include "Plots/Common/PlotAlignmentWidget/Core/PlotAlignmentData.hpp"
 
+#include <atomic>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -166,8 +171,9 @@ struct UnitGatherContext {
  * Returns a `RateEstimate` with paired `times[]` (bin centers for binning)
  * and `values[]` (raw event counts summed across all trials).
  *
- * Uses `time_frame` to convert each event's `TimeFrameIndex` to an absolute
- * time before computing the relative time with respect to the per-trial
+ * The trials are first flattened into one CSR block (`gatherFlat()`), which
+ * re-reads the source events in a single merge pass instead of walking each
+ * trial view; relative times are taken with respect to the per-trial
  * alignment time from `gathered`.
  *
  * If `time_frame` is null, `TimeFrameIndex::getValue()` is used directly as
@@ -208,10 +214,45 @@ struct UnitGatherContext {
         double window_size,
         EstimationParams const & params = BinningParams{});
 
+/**
+ * @brief Estimate the rate for a single unit from CSR trial data
+ *
+ * Same as the `GatherResult` overload, which flattens its input with
+ * `gatherFlat()` and forwards here. Use this directly when the trials are
+ * already flattened (e.g. shared with a raster).
+ *
+ * @param flat        Trial-aligned events with times relative to each trial's alignment
+ * @param window_size Total window span in time units (bins cover ±window_size/2)
+ * @param params      Estimation method and parameters (default: `BinningParams{}`)
+ */
+[[nodiscard]] RateEstimate estimateRate(
+        FlatEventGather const & flat,
+        double window_size,
+        EstimationParams const & params = BinningParams{});
+
+/**
+ * @brief Estimate rate with per-trial breakdown from CSR trial data
+ *
+ * @see estimateRateWithTrials(GatherResult<DigitalEventSeries> const &, TimeFrame const *, double, EstimationParams const &)
+ */
+[[nodiscard]] RateEstimateWithTrials estimateRateWithTrials(
+        FlatEventGather const & flat,
+        double window_size,
+        EstimationParams const & params = BinningParams{});
+
 // =============================================================================
 // Multi-unit estimation (heatmap use case)
 // =============================================================================
 
+/**
+ * @brief Called once per unit by `estimateRates()` as soon as its estimate is ready
+ *
+ * `unit_index` is the unit's position in the input. The callback may adjust
+ * the estimate in place (e.g. apply scaling); the adjusted value is what
+ * `estimateRates()` returns.
+ */
+using RateEstimateCallback = std::function<void(std::size_t unit_index, RateEstimate & estimate)>;
+
 /**
  * @brief Estimate rates for multiple units
  *
@@ -219,18 +260,32 @@ struct UnitGatherContext {
  * All units share the same `window_size` and `params`. The output vector is
  * in the same order as the input and has the same length.
  *
+ * Units are estimated concurrently on the shared `CoreUtilities::ThreadPool`
+ * (the calling thread takes part). The evaluation grid and smoothing kernel
+ * are built once per call, and each thread counts events into its own
+ * reusable histogram buffer. Results do not depend on the thread count.
+ *
  * This is the primary entry point for `HeatmapWidget`, which needs a
  * `units × time_bins` rate matrix.
  *
  * @param units       Per-unit gather contexts (from `createUnitGatherContexts`)
  * @param window_size Total window span in time units
  * @param params      Estimation method and parameters (default: `BinningParams{}`)
+ * @param on_estimate Optional per-unit callback, invoked in completion order
+ *                    (not input order) from worker threads; calls are serialized
+ * @param cancelled   Optional flag polled before each unit; once set, the
+ *                    remaining units are skipped and left empty
  * @return One `RateEstimate` per unit, in input order
+ *
+ * @throws std::runtime_error if a unit with trials has no TimeFrame; the other
+ *         units may already have been reported through `on_estimate`
  */
 [[nodiscard]] std::vector<RateEstimate> estimateRates(
         std::vector<UnitGatherContext> const & units,
         double window_size,
-        EstimationParams const & params = BinningParams{});
+        EstimationParams const & params = BinningParams{},
+        RateEstimateCallback const & on_estimate = {},
+        std::atomic<bool> const * cancelled = nullptr);
 
 } // namespace Neuralyzer::Plots
 
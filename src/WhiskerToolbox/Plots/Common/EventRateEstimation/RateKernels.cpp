@@ -0,0 +1,123 @@
+#include "RateKernels.hpp"
+
+#include "CoreMath/fft_plan.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace Neuralyzer::Plots {
+
+namespace {
+
+/// Kernel support in σ on each side
+constexpr double kSupportSigmas = 4.0;
+
+/// Widest kernel radius (in samples) applied directly instead of by FFT
+constexpr std::size_t kMaxDirectRadius = 32;
+
+} // anonymous namespace
+
+GaussianSmoother::GaussianSmoother(std::size_t length, double sigma_samples)
+    : _length(length) {
+    if (length == 0 || !(sigma_samples > 0.0)) {
+        return;
+    }
+
+    auto const full_radius = static_cast<std::size_t>(std::ceil(kSupportSigmas * sigma_samples));
+    // Taps further than length - 1 never overlap the signal, but still count
+    // towards the normalization so the gain stays exactly one
+    std::size_t const radius = std::min(full_radius, length - 1);
+
+    double norm = 0.0;
+    for (std::size_t k = 0; k <= full_radius; ++k) {
+        double const w = std::exp(-0.5 * static_cast<double>(k * k) / (sigma_samples * sigma_samples));
+        norm += k == 0 ? w : 2.0 * w;
+    }
+
+    std::vector<double> taps(radius + 1);
+    for (std::size_t k = 0; k <= radius; ++k) {
+        taps[k] = std::exp(-0.5 * static_cast<double>(k * k) / (sigma_samples * sigma_samples)) / norm;
+    }
+
+    if (radius <= kMaxDirectRadius) {
+        _kernel = std::move(taps);
+        return;
+    }
+
+    // Circular convolution of size >= length + radius has no wrap-around
+    // inside [0, length)
+    _plan = std::make_unique<FftPlan>(nextPowerOfTwo(length + radius));
+    _kernel_spectrum.assign(_plan->size(), {0.0, 0.0});
+    for (std::size_t k = 0; k <= radius; ++k) {
+        _kernel_spectrum[k] = taps[k];
+        if (k > 0) {
+            _kernel_spectrum[_plan->size() - k] = taps[k];
+        }
+    }
+    _plan->forward(_kernel_spectrum);
+}
+
+GaussianSmoother::~GaussianSmoother() = default;
+GaussianSmoother::GaussianSmoother(GaussianSmoother &&) noexcept = default;
+GaussianSmoother & GaussianSmoother::operator=(GaussianSmoother &&) noexcept = default;
+
+void GaussianSmoother::apply(std::span<double> values) const {
+    if (values.size() != _length) {
+        throw std::invalid_argument(
+                "GaussianSmoother::apply: expected " + std::to_string(_length) +
+                " samples, got " + std::to_string(values.size()));
+    }
+
+    if (_plan) {
+        std::vector<std::complex<double>> buffer(_plan->size(), {0.0, 0.0});
+        std::copy(values.begin(), values.end(), buffer.begin());
+        _plan->forward(buffer);
+        for (std::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] *= _kernel_spectrum[i];
+        }
+        _plan->inverse(buffer);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = buffer[i].real();
+        }
+        return;
+    }
+
+    if (_kernel.empty()) {
+        return;
+    }
+
+    std::vector<double> const input(values.begin(), values.end());
+    auto const n = static_cast<std::ptrdiff_t>(input.size());
+    auto const radius = static_cast<std::ptrdiff_t>(_kernel.size()) - 1;
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+        std::ptrdiff_t const lo = std::max<std::ptrdiff_t>(-radius, -i);
+        std::ptrdiff_t const hi = std::min<std::ptrdiff_t>(radius, n - 1 - i);
+        double acc = 0.0;
+        for (std::ptrdiff_t k = lo; k <= hi; ++k) {
+            acc += _kernel[static_cast<std::size_t>(k < 0 ? -k : k)] *
+                   input[static_cast<std::size_t>(i + k)];
+        }
+        values[static_cast<std::size_t>(i)] = acc;
+    }
+}
+
+void gaussianSmooth(std::span<double> values, double sigma_samples) {
+    GaussianSmoother(values.size(), sigma_samples).apply(values);
+}
+
+void causalExponentialSmooth(std::span<double> values, double tau_samples) {
+    if (values.empty() || !(tau_samples > 0.0)) {
+        return;
+    }
+    double const a = std::exp(-1.0 / tau_samples);
+    double const b = 1.0 - a;
+    double y = 0.0;
+    for (auto & x: values) {
+        y = a * y + b * x;
+        x = y;
+    }
+}
+
+} // namespace Neuralyzer::Plots
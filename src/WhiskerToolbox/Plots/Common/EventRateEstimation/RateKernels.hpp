@@ -0,0 +1,86 @@
+#ifndef RATE_KERNELS_HPP
+#define RATE_KERNELS_HPP
+
+/**
+ * @file RateKernels.hpp
+ * @brief In-place smoothing filters for fine event-count histograms
+ *
+ * Kernel rate estimators first bin events at the evaluation step and then
+ * smooth the histogram, so their cost depends on the number of bins rather
+ * than on the number of events. Both filters have unit DC gain: the smoothed
+ * histogram keeps the total event count, so the result is still "counts per
+ * evaluation step" and `applyScaling()` converts it to Hz like a binned PSTH.
+ *
+ * Samples before the first bin are treated as zero (no events outside the
+ * gathered window).
+ *
+ * @see EventRateEstimation.cpp for the estimators built on these filters
+ */
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+class FftPlan;
+
+namespace Neuralyzer::Plots {
+
+/**
+ * @brief Gaussian smoothing for signals of one fixed length
+ *
+ * Narrow kernels (radius 4σ <= 32 samples) are applied as a truncated,
+ * normalized FIR; wider ones by zero-padded FFT convolution with a kernel
+ * spectrum computed once at construction. Samples beyond both ends are zero.
+ *
+ * apply() is const and allocates its own work buffer, so one smoother can be
+ * shared by threads smoothing different trials.
+ */
+class GaussianSmoother {
+public:
+    /**
+     * @param length        Number of samples in every signal passed to apply()
+     * @param sigma_samples Kernel standard deviation in samples; <= 0 makes apply() a no-op
+     */
+    GaussianSmoother(std::size_t length, double sigma_samples);
+    ~GaussianSmoother();
+
+    GaussianSmoother(GaussianSmoother &&) noexcept;
+    GaussianSmoother & operator=(GaussianSmoother &&) noexcept;
+
+    /**
+     * @brief Smooth @p values in place
+     *
+     * @pre values.size() == length (enforcement: runtime_check, throws std::invalid_argument)
+     */
+    void apply(std::span<double> values) const;
+
+private:
+    std::size_t _length = 0;
+    std::vector<double> _kernel;                     ///< FIR taps (narrow kernels)
+    std::unique_ptr<FftPlan> _plan;                  ///< FFT plan (wide kernels)
+    std::vector<std::complex<double>> _kernel_spectrum;
+};
+
+/**
+ * @brief Gaussian smoothing of a uniformly sampled signal (one-off GaussianSmoother)
+ *
+ * @param values        Signal to smooth (modified in place)
+ * @param sigma_samples Kernel standard deviation in samples; <= 0 is a no-op
+ */
+void gaussianSmooth(std::span<double> values, double sigma_samples);
+
+/**
+ * @brief Causal exponential smoothing: y[n] = a·y[n-1] + (1-a)·x[n], a = exp(-1/tau)
+ *
+ * Discrete equivalent of convolving with (1/τ)·exp(-t/τ) for t >= 0.
+ *
+ * @param values      Signal to smooth (modified in place)
+ * @param tau_samples Decay time constant in samples; <= 0 is a no-op
+ */
+void causalExponentialSmooth(std::span<double> values, double tau_samples);
+
+} // namespace Neuralyzer::Plots
+
+#endif // RATE_KERNELS_HPP
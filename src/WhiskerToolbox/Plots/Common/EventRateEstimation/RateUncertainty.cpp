@@ -1,31 +1,184 @@
 #include "RateUncertainty.hpp"
 
+#include "CoreUtilities/thread_pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 namespace Neuralyzer::Plots {
 
+namespace {
+
+/// Bootstrap resamples drawn per parallel chunk (one RNG stream per chunk)
+constexpr size_t kResamplesPerChunk = 32;
+
+/// Time points reduced per parallel chunk when extracting percentiles
+constexpr size_t kTimePointsPerChunk = 64;
+
+/**
+ * @brief Number of trials, or 0 when the per-trial rows do not match the estimate
+ */
+[[nodiscard]] size_t validTrialCount(RateEstimateWithTrials const & data) {
+    auto const & rows = data.trials.per_trial_values;
+    size_t const num_points = data.estimate.values.size();
+    if (rows.empty() || num_points == 0) {
+        return 0;
+    }
+    for (auto const & row: rows) {
+        if (row.size() != num_points) {
+            return 0;
+        }
+    }
+    return rows.size();
+}
+
+/**
+ * @brief Linearly interpolated percentile of sorted values, `pct` in [0, 100]
+ */
+[[nodiscard]] double sortedPercentile(std::vector<double> const & sorted, double pct) {
+    double const pos = std::clamp(pct, 0.0, 100.0) / 100.0 *
+                       static_cast<double>(sorted.size() - 1);
+    auto const lo = static_cast<size_t>(std::floor(pos));
+    size_t const hi = std::min(lo + 1, sorted.size() - 1);
+    double const frac = pos - static_cast<double>(lo);
+    return sorted[lo] + frac * (sorted[hi] - sorted[lo]);
+}
+
+} // anonymous namespace
+
 ConfidenceBand computeSEM(
-        RateEstimateWithTrials const & /*data*/,
-        double /*k*/)
+        RateEstimateWithTrials const & data,
+        double k)
 {
-    // Stub — will be implemented in PSTH Phase 3
-    return {};
+    size_t const num_trials = validTrialCount(data);
+    if (num_trials == 0) {
+        return {};
+    }
+
+    auto const & rows = data.trials.per_trial_values;
+    size_t const num_points = data.estimate.values.size();
+    auto const n = static_cast<double>(num_trials);
+
+    ConfidenceBand band;
+    band.lower.resize(num_points);
+    band.upper.resize(num_points);
+    for (size_t t = 0; t < num_points; ++t) {
+        double sum = 0.0;
+        for (auto const & row: rows) {
+            sum += row[t];
+        }
+        double const mean = sum / n;
+
+        double sq = 0.0;
+        for (auto const & row: rows) {
+            sq += (row[t] - mean) * (row[t] - mean);
+        }
+        double const sem = num_trials > 1 ? std::sqrt(sq / (n - 1.0)) / std::sqrt(n) : 0.0;
+
+        band.lower[t] = n * (mean - k * sem);
+        band.upper[t] = n * (mean + k * sem);
+    }
+    return band;
 }
 
 ConfidenceBand computePercentileCI(
-        RateEstimateWithTrials const & /*data*/,
-        double /*lower_pct*/,
-        double /*upper_pct*/)
+        RateEstimateWithTrials const & data,
+        double lower_pct,
+        double upper_pct)
 {
-    // Stub — will be implemented in PSTH Phase 3
-    return {};
+    size_t const num_trials = validTrialCount(data);
+    if (num_trials == 0) {
+        return {};
+    }
+
+    auto const & rows = data.trials.per_trial_values;
+    size_t const num_points = data.estimate.values.size();
+    auto const n = static_cast<double>(num_trials);
+
+    ConfidenceBand band;
+    band.lower.resize(num_points);
+    band.upper.resize(num_points);
+    std::vector<double> column(num_trials);
+    for (size_t t = 0; t < num_points; ++t) {
+        for (size_t i = 0; i < num_trials; ++i) {
+            column[i] = rows[i][t];
+        }
+        std::sort(column.begin(), column.end());
+        band.lower[t] = n * sortedPercentile(column, lower_pct);
+        band.upper[t] = n * sortedPercentile(column, upper_pct);
+    }
+    return band;
 }
 
 ConfidenceBand bootstrapCI(
-        RateEstimateWithTrials const & /*data*/,
-        size_t /*n_resamples*/,
-        double /*ci_level*/)
+        RateEstimateWithTrials const & data,
+        size_t n_resamples,
+        double ci_level,
+        std::uint64_t seed)
 {
-    // Stub — will be implemented in PSTH Phase 3
-    return {};
+    size_t const num_trials = validTrialCount(data);
+    if (num_trials == 0 || n_resamples == 0 || !(ci_level > 0.0 && ci_level < 1.0)) {
+        return {};
+    }
+
+    auto const & rows = data.trials.per_trial_values;
+    size_t const num_points = data.estimate.values.size();
+
+    // resampled[t * n_resamples + r]: trial-summed curve of resample r at time t
+    std::vector<double> resampled(num_points * n_resamples, 0.0);
+
+    CoreUtilities::parallelForChunks(0, n_resamples, kResamplesPerChunk, [&](size_t lo, size_t hi) {
+        // One stream per chunk: results depend only on the seed, not on scheduling
+        std::seed_seq seq{static_cast<std::uint32_t>(seed),
+                          static_cast<std::uint32_t>(seed >> 32),
+                          static_cast<std::uint32_t>(lo / kResamplesPerChunk)};
+        std::mt19937_64 rng(seq);
+        std::uniform_int_distribution<size_t> pick(0, num_trials - 1);
+
+        std::vector<unsigned> multiplicity(num_trials);
+        std::vector<double> curve(num_points);
+        for (size_t r = lo; r < hi; ++r) {
+            std::fill(multiplicity.begin(), multiplicity.end(), 0u);
+            for (size_t i = 0; i < num_trials; ++i) {
+                ++multiplicity[pick(rng)];
+            }
+
+            // Weighted sum of the existing per-trial curves
+            std::fill(curve.begin(), curve.end(), 0.0);
+            for (size_t i = 0; i < num_trials; ++i) {
+                if (multiplicity[i] == 0) {
+                    continue;
+                }
+                double const w = static_cast<double>(multiplicity[i]);
+                auto const & row = rows[i];
+                for (size_t t = 0; t < num_points; ++t) {
+                    curve[t] += w * row[t];
+                }
+            }
+            for (size_t t = 0; t < num_points; ++t) {
+                resampled[t * n_resamples + r] = curve[t];
+            }
+        }
+    });
+
+    double const lower_pct = 50.0 * (1.0 - ci_level);
+    double const upper_pct = 100.0 - lower_pct;
+
+    ConfidenceBand band;
+    band.lower.resize(num_points);
+    band.upper.resize(num_points);
+    CoreUtilities::parallelForChunks(0, num_points, kTimePointsPerChunk, [&](size_t lo, size_t hi) {
+        std::vector<double> column(n_resamples);
+        for (size_t t = lo; t < hi; ++t) {
+            auto const first = resampled.begin() + static_cast<std::ptrdiff_t>(t * n_resamples);
+            std::copy_n(first, n_resamples, column.begin());
+            std::sort(column.begin(), column.end());
+            band.lower[t] = sortedPercentile(column, lower_pct);
+            band.upper[t] = sortedPercentile(column, upper_pct);
+        }
+    });
+    return band;
 }
 
 } // namespace Neuralyzer::Plots
@@ -6,8 +6,12 @@
  * @brief Confidence band computation from per-trial rate estimates
  *
  * Provides functions to compute confidence bands from `RateEstimateWithTrials`.
- * These are stubs — the implementations will be filled in when the PSTH widget
- * gains variability display (PSTH roadmap Phase 3).
+ * Bands are on the scale of `estimate.values` (summed over trials): each
+ * per-trial statistic is multiplied by the number of trials, so a band overlays
+ * the aggregate curve and goes through the same linear scaling.
+ *
+ * All functions return empty bands when there are no per-trial rows or a row's
+ * length differs from `estimate.values`.
  *
  * @see RateEstimate.hpp for PerTrialData and RateEstimateWithTrials
  * @see RateNormalization.hpp for applying scaling before CI computation
@@ -16,6 +20,7 @@
 #include "RateEstimate.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace Neuralyzer::Plots {
@@ -33,23 +38,19 @@ struct ConfidenceBand {
  *
  * @param data  RateEstimateWithTrials (must have per-trial data)
  * @param k     Multiplier for SEM (1.0 for ±1 SEM, 1.96 for 95% CI)
- * @return ConfidenceBand with lower and upper bounds
- *
- * @note Stub — returns empty bands. Implementation deferred to PSTH Phase 3.
+ * @return ConfidenceBand with lower and upper bounds (sample SD; zero width for one trial)
  */
 [[nodiscard]] ConfidenceBand computeSEM(
         RateEstimateWithTrials const & data,
         double k = 1.0);
 
 /**
- * @brief Compute percentile-based confidence band
+ * @brief Compute percentile-based band of the per-trial values (linear interpolation)
  *
  * @param data       RateEstimateWithTrials (must have per-trial data)
  * @param lower_pct  Lower percentile (e.g. 2.5 for 95% CI)
  * @param upper_pct  Upper percentile (e.g. 97.5 for 95% CI)
  * @return ConfidenceBand with lower and upper bounds
- *
- * @note Stub — returns empty bands. Implementation deferred to PSTH Phase 3.
  */
 [[nodiscard]] ConfidenceBand computePercentileCI(
         RateEstimateWithTrials const & data,
@@ -59,17 +60,22 @@ struct ConfidenceBand {
 /**
  * @brief Bootstrap confidence band (resamples trials)
  *
+ * Each resample draws as many trials as there are, with replacement, and sums
+ * the existing per-trial curves weighted by how often each trial was drawn.
+ * Resamples run on the shared thread pool in fixed chunks with one RNG stream
+ * per chunk, so the band depends only on @p seed, not on the thread count.
+ *
  * @param data         RateEstimateWithTrials (must have per-trial data)
  * @param n_resamples  Number of bootstrap resamples
- * @param ci_level     Confidence level (e.g. 0.95 for 95% CI)
- * @return ConfidenceBand with lower and upper bounds
- *
- * @note Stub — returns empty bands. Implementation deferred to PSTH Phase 3.
+ * @param ci_level     Confidence level in (0, 1) (e.g. 0.95 for 95% CI)
+ * @param seed         Seed for the resampling streams
+ * @return ConfidenceBand with lower and upper bounds (empty for invalid arguments)
  */
 [[nodiscard]] ConfidenceBand bootstrapCI(
         RateEstimateWithTrials const & data,
         size_t n_resamples = 1000,
-        double ci_level = 0.95);
+        double ci_level = 0.95,
+        std::uint64_t seed = 0);
 
 } // namespace Neuralyzer::Plots
 
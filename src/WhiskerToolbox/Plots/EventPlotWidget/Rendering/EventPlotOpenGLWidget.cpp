@@ -9,6 +9,7 @@
 #include "CorePlotting/SceneGraph/SceneBuilder.hpp"
 #include "CoreUtilities/color.hpp"
 #include "DataManager/DataManager.hpp"
+#include "GatherResult/FlatEventGather.hpp"
 #include "GatherResult/GatherResult.hpp"
 #include "Plots/Common/PlotAlignmentGather.hpp"
 #include "Plots/Common/PlotInteractionHelpers.hpp"
@@ -27,9 +28,13 @@
 #include <limits>
 #include <numeric>
 #include <utility>
+#include <vector>
 
 namespace {
 
+/// Trials flattened per parallel chunk when building the raster scene
+constexpr size_t kFlatGatherTrialsPerChunk = 256;
+
 /// Parsed result from a series_trial_key like "spikes_trial_42"
 struct SeriesTrialKey {
     std::string event_name;///< The event name prefix (e.g. "spikes")
@@ -632,6 +637,11 @@ void EventPlotOpenGLWidget::rebuildScene() {
 
     _layout_response = _layout_strategy.compute(layout_request);
 
+    std::vector<CorePlotting::SeriesLayout const *> trial_layouts(num_trials);
+    for (size_t i = 0; i < num_trials; ++i) {
+        trial_layouts[i] = _layout_response.findLayout("trial_" + std::to_string(i));
+    }
+
     // -------------------------------------------------------------------------
     // Step 4: Build scene — separate draw call per series with own glyph style
     // -------------------------------------------------------------------------
@@ -672,30 +682,16 @@ void EventPlotOpenGLWidget::rebuildScene() {
 
         // Accumulate ALL trials' elements into a single batch per series.
         // This reduces draw calls from O(num_trials * num_series) to O(num_series).
-        std::vector<CorePlotting::MappedElement> all_elements;
-
-        for (size_t trial = 0; trial < num_trials; ++trial) {
-            auto const & trial_view = sd.gathered[trial];
-            if (!trial_view) continue;
-
-            std::string const layout_key = "trial_" + std::to_string(trial);
-            auto const * trial_layout = _layout_response.findLayout(layout_key);
-            if (!trial_layout) continue;
-
-            auto ref_abs_time = static_cast<int>(sd.gathered.alignmentTimeAt(trial).getValue());
-
-            auto mapped = CorePlotting::RasterMapper::mapEventsInWindow(
-                    *trial_view,
-                    *trial_layout,
-                    *sd.time_frame,
-                    ref_abs_time,
-                    static_cast<int>(-_cached_view_state.x_min),
-                    static_cast<int>(_cached_view_state.x_max));
-
-            for (auto const & elem: mapped) {
-                all_elements.push_back(elem);
-            }
-        }
+        // The trials are flattened into one CSR block (in sorted row order)
+        // instead of walking each per-trial view.
+        auto const flat = gatherFlat(sd.gathered, {.trials_per_chunk = kFlatGatherTrialsPerChunk});
+        auto all_elements = CorePlotting::RasterMapper::mapFlatTrialsInWindow(
+                flat.trial_offsets,
+                flat.relative_times,
+                flat.entity_ids,
+                trial_layouts,
+                static_cast<int>(-_cached_view_state.x_min),
+                static_cast<int>(_cached_view_state.x_max));
 
         // One batch per series — series_key is just the event name.
         // Trial index is derived from Y coordinate in hit testing.
@@ -8,6 +8,7 @@
 #include "Plots/Common/EventRateEstimation/EventRateEstimation.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <numeric>
 #include <utility>
@@ -18,7 +19,8 @@ HeatmapPipelineResult runHeatmapPipeline(
         std::shared_ptr<DataManager> const & data_manager,
         std::vector<std::string> const & unit_keys,
         PlotAlignmentData const & alignment_data,
-        HeatmapPipelineConfig const & config) {
+        HeatmapPipelineConfig const & config,
+        HeatmapRowCallback const & on_row) {
     HeatmapPipelineResult result;
 
     if (!data_manager || unit_keys.empty()) {
@@ -30,38 +32,51 @@ HeatmapPipelineResult runHeatmapPipeline(
     }
 
     // 1. Gather trial-aligned DigitalEventSeries data for all unit keys
-    auto contexts = createUnitGatherContexts(
+    auto const contexts = createUnitGatherContexts(
             data_manager, unit_keys, alignment_data);
 
-    if (contexts.empty()) {
-        return result;
-    }
+    return runHeatmapPipeline(contexts, config, on_row);
+}
 
-    // 2. Estimate firing rates for each unit
-    auto rate_estimates = estimateRates(
-            contexts, config.window_size, config.estimation_params);
+HeatmapPipelineResult runHeatmapPipeline(
+        std::vector<UnitGatherContext> const & contexts,
+        HeatmapPipelineConfig const & config,
+        HeatmapRowCallback const & on_row,
+        std::atomic<bool> const * cancelled) {
+    HeatmapPipelineResult result;
 
-    if (rate_estimates.empty()) {
+    if (contexts.empty() || config.window_size <= 0.0) {
         return result;
     }
 
-    // 3. Apply scaling
-    for (auto & est: rate_estimates) {
-        applyScaling(est, config.scaling, config.time_units_per_second);
+    // 2-4. Estimate, scale and convert each unit as it finishes
+    result.rows.resize(contexts.size());
+    auto rate_estimates = estimateRates(
+            contexts, config.window_size, config.estimation_params,
+            [&](std::size_t i, RateEstimate & est) {
+                applyScaling(est, config.scaling, config.time_units_per_second);
+
+                double const spacing = est.metadata.sample_spacing;
+                double const left_edge = est.times.empty()
+                                                 ? 0.0
+                                                 : est.times.front() - spacing / 2.0;
+                result.rows[i] = CorePlotting::HeatmapRowData{
+                        .values = est.values,// copy, don't move — keep estimates intact
+                        .bin_start = left_edge,
+                        .bin_width = spacing,
+                };
+                if (on_row && !(cancelled && cancelled->load(std::memory_order_relaxed))) {
+                    on_row(i, contexts[i].key, result.rows[i]);
+                }
+            },
+            cancelled);
+
+    if (cancelled && cancelled->load(std::memory_order_relaxed)) {
+        return HeatmapPipelineResult{};
     }
-
-    // 4. Convert RateEstimate to HeatmapRowData
-    result.rows.reserve(rate_estimates.size());
-    for (auto & est: rate_estimates) {
-        double const spacing = est.metadata.sample_spacing;
-        double const left_edge = est.times.empty()
-                                         ? 0.0
-                                         : est.times.front() - spacing / 2.0;
-        result.rows.push_back(CorePlotting::HeatmapRowData{
-                .values = est.values,// copy, don't move — keep estimates intact
-                .bin_start = left_edge,
-                .bin_width = spacing,
-        });
+    if (rate_estimates.empty()) {
+        result.rows.clear();
+        return result;
     }
 
     result.rate_estimates = std::move(rate_estimates);
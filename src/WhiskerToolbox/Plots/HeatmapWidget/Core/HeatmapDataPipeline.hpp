@@ -21,7 +21,9 @@
 #include "Plots/Common/PlotAlignmentWidget/Core/PlotAlignmentData.hpp"
 #include "Plots/HeatmapWidget/Core/HeatmapState.hpp"
 
+#include <atomic>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,6 +32,8 @@ class DataManager;
 
 namespace Neuralyzer::Plots {
 
+struct UnitGatherContext;
+
 /**
  * @brief Configuration for the heatmap data pipeline
  */
@@ -52,6 +56,18 @@ struct HeatmapPipelineResult {
     bool success = false;
 };
 
+/**
+ * @brief Receives each heatmap row as soon as its unit has been estimated
+ *
+ * @param row_index Position of the row in `HeatmapPipelineResult::rows`
+ *                  (gather order, before any sorting)
+ * @param unit_key  DataManager key of the unit
+ * @param row       Scaled row, identical to the one in the final result
+ */
+using HeatmapRowCallback = std::function<void(std::size_t row_index,
+                                              std::string const & unit_key,
+                                              CorePlotting::HeatmapRowData const & row)>;
+
 /**
  * @brief Execute the heatmap data pipeline without an OpenGL context
  *
@@ -59,14 +75,20 @@ struct HeatmapPipelineResult {
  * as a testable free function:
  *
  *  1. Gather trial-aligned DigitalEventSeries data for all unit keys
- *  2. Estimate firing rates for each unit
+ *  2. Estimate firing rates for each unit (concurrently, see estimateRates())
  *  3. Apply scaling (Hz, z-score, etc.)
  *  4. Convert RateEstimate to CorePlotting::HeatmapRowData
  *
+ * Steps 2-4 are per unit, so a row is final as soon as its unit finishes and
+ * is passed to `on_row` right away. Sorting needs every row and is left to
+ * the caller (computeSortOrder() / applySortOrder()) once this returns.
+ *
  * @param data_manager   DataManager with loaded event and alignment data
  * @param unit_keys      DigitalEventSeries keys (one per row)
  * @param alignment_data Alignment configuration (event key, window size, etc.)
  * @param config         Pipeline configuration (scaling, estimation params, etc.)
+ * @param on_row         Optional streaming callback, invoked in completion order from
+ *                       worker threads; calls are serialized and all happen before return
  * @return Pipeline result with rows and intermediate data; success is false when
  *         the pipeline produces no output (e.g. empty gather, no alignment).
  */
@@ -74,7 +96,26 @@ struct HeatmapPipelineResult {
         std::shared_ptr<DataManager> const & data_manager,
         std::vector<std::string> const & unit_keys,
         PlotAlignmentData const & alignment_data,
-        HeatmapPipelineConfig const & config);
+        HeatmapPipelineConfig const & config,
+        HeatmapRowCallback const & on_row = {});
+
+/**
+ * @brief Run steps 2-4 of the pipeline on already gathered units
+ *
+ * Lets a caller gather on the thread that owns the DataManager and run the
+ * estimation elsewhere; the contexts hold their own views of the source data.
+ *
+ * @param contexts   Gathered units (from `createUnitGatherContexts`), one row each
+ * @param config     Pipeline configuration (scaling, estimation params, etc.)
+ * @param on_row     Optional streaming callback, as in the overload above
+ * @param cancelled  Optional flag polled between units; once set, no further
+ *                   rows are reported and the result has success == false
+ */
+[[nodiscard]] HeatmapPipelineResult runHeatmapPipeline(
+        std::vector<UnitGatherContext> const & contexts,
+        HeatmapPipelineConfig const & config,
+        HeatmapRowCallback const & on_row = {},
+        std::atomic<bool> const * cancelled = nullptr);
 
 // =============================================================================
 // Sorting
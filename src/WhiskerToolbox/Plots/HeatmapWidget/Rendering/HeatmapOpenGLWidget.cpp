@@ -4,6 +4,7 @@
 #include "CorePlotting/Mappers/HeatmapMapper.hpp"
 #include "DataManager/DataManager.hpp"
 #include "EditorState/SelectionContext.hpp"
+#include "Plots/Common/EventRateEstimation/EventRateEstimation.hpp"
 #include "Plots/Common/PlotInteractionHelpers.hpp"
 #include "Plots/HeatmapWidget/Core/HeatmapDataPipeline.hpp"
 #include "PlottingSVG/SVGSceneRenderer.hpp"
@@ -15,7 +16,10 @@
 #include <QWheelEvent>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <exception>
+#include <memory>
 #include <utility>
 
 HeatmapOpenGLWidget::HeatmapOpenGLWidget(QWidget * parent)
@@ -34,6 +38,13 @@ HeatmapOpenGLWidget::HeatmapOpenGLWidget(QWidget * parent)
 }
 
 HeatmapOpenGLWidget::~HeatmapOpenGLWidget() {
+    // Rows are posted with queued calls, so the worker never waits on us
+    if (_pipeline_cancel) {
+        _pipeline_cancel->store(true, std::memory_order_relaxed);
+    }
+    if (_pipeline_thread.joinable()) {
+        _pipeline_thread.join();
+    }
     makeCurrent();
     _scene_renderer.cleanup();
     doneCurrent();
@@ -124,6 +135,12 @@ HeatmapOpenGLWidget::HeatmapExportBundle HeatmapOpenGLWidget::collectHeatmapExpo
         return bundle;
     }
 
+    if (_display_rows_complete && !_scene_dirty) {
+        bundle.unit_keys = _display_unit_keys;
+        bundle.rows = _display_rows;
+        return bundle;
+    }
+
     auto const & unit_keys = _state->unitKeys();
     if (unit_keys.empty()) {
         return bundle;
@@ -211,6 +228,10 @@ void HeatmapOpenGLWidget::paintGL() {
         // scheduled and the next paintGL will handle it.
         _scene_dirty = false;
     }
+    if (_display_rows_dirty) {
+        uploadDisplayRows();
+        _display_rows_dirty = false;
+    }
     _scene_renderer.render(_view_matrix, _projection_matrix);
 }
 
@@ -383,6 +404,13 @@ void HeatmapOpenGLWidget::rebuildScene() {
     _tooltip_mgr->hide();
 
     auto const clearCachedScene = [this]() {
+        ++_pipeline_generation;// drop rows of a run still in flight
+        if (_pipeline_cancel) {
+            _pipeline_cancel->store(true, std::memory_order_relaxed);
+        }
+        _display_rows.clear();
+        _display_rows_dirty = false;
+        _display_rows_complete = false;
         _scene = CorePlotting::RenderableScene{};
         _scene_renderer.clearScene();
     };
@@ -412,6 +440,18 @@ void HeatmapOpenGLWidget::rebuildScene() {
         return;
     }
 
+    // One run at a time; the busy worker restarts the rebuild when it finishes
+    _display_rows_complete = false;
+    if (_pipeline_running) {
+        ++_pipeline_generation;
+        _pipeline_cancel->store(true, std::memory_order_relaxed);
+        _rebuild_pending = true;
+        return;
+    }
+    if (_pipeline_thread.joinable()) {
+        _pipeline_thread.join();// already finished
+    }
+
     // Run the pure-data pipeline (gather → estimate → scale → convert)
     Neuralyzer::Plots::HeatmapPipelineConfig config;
     config.window_size = window_size;
@@ -420,28 +460,125 @@ void HeatmapOpenGLWidget::rebuildScene() {
     // TODO: make time_units_per_second configurable if data uses non-ms units
     config.time_units_per_second = 1000.0;
 
-    auto pipeline_result = Neuralyzer::Plots::runHeatmapPipeline(
-            _data_manager, unit_keys, alignment_state->data(), config);
+    // Gather here: the DataManager is only touched on the GUI thread, and the
+    // gathered views keep their source data alive for the worker
+    auto contexts = Neuralyzer::Plots::createUnitGatherContexts(
+            _data_manager, unit_keys, alignment_state->data());
+
+    // The previous heatmap stays on screen until the first new row arrives
+    auto const generation = ++_pipeline_generation;
+    _display_rows.assign(contexts.size(), CorePlotting::HeatmapRowData{});
+    _display_unit_keys.assign(contexts.size(), std::string{});
+    _pipeline_cancel = std::make_shared<std::atomic<bool>>(false);
+    _pipeline_running = true;
+
+    _pipeline_thread = std::thread(
+            [this, generation, contexts = std::move(contexts), config,
+             cancel = _pipeline_cancel]() {
+                Neuralyzer::Plots::HeatmapPipelineResult result;
+                try {
+                    result = Neuralyzer::Plots::runHeatmapPipeline(
+                            contexts, config,
+                            [this, generation, &cancel](std::size_t row_index,
+                                                        std::string const & unit_key,
+                                                        CorePlotting::HeatmapRowData const & row) {
+                                if (cancel->load(std::memory_order_relaxed)) {
+                                    return;
+                                }
+                                QMetaObject::invokeMethod(
+                                        this,
+                                        [this, generation, row_index, unit_key, row]() {
+                                            onPipelineRow(generation, row_index, unit_key, row);
+                                        },
+                                        Qt::QueuedConnection);
+                            },
+                            cancel.get());
+                } catch (std::exception const & e) {
+                    qWarning() << "HeatmapOpenGLWidget: heatmap pipeline failed:" << e.what();
+                    result = Neuralyzer::Plots::HeatmapPipelineResult{};
+                }
 
-    if (!pipeline_result.success || pipeline_result.rows.empty()) {
-        clearCachedScene();
+                auto shared_result = std::make_shared<Neuralyzer::Plots::HeatmapPipelineResult>(
+                        std::move(result));
+                QMetaObject::invokeMethod(
+                        this,
+                        [this, generation, shared_result]() {
+                            onPipelineFinished(generation, *shared_result);
+                        },
+                        Qt::QueuedConnection);
+            });
+}
+
+void HeatmapOpenGLWidget::onPipelineRow(std::uint64_t generation, std::size_t row_index,
+                                        std::string const & unit_key,
+                                        CorePlotting::HeatmapRowData const & row) {
+    if (generation != _pipeline_generation || row_index >= _display_rows.size()) {
+        return;
+    }
+    _display_rows[row_index] = row;
+    _display_unit_keys[row_index] = unit_key;
+    _display_rows_dirty = true;
+    update();
+}
+
+void HeatmapOpenGLWidget::onPipelineFinished(std::uint64_t generation,
+                                             Neuralyzer::Plots::HeatmapPipelineResult & result) {
+    _pipeline_running = false;
+
+    if (_rebuild_pending) {
+        _rebuild_pending = false;
+        _scene_dirty = true;
+        update();
+        return;
+    }
+
+    if (generation != _pipeline_generation || !_state) {
+        return;
+    }
+
+    if (!result.success || result.rows.empty()) {
+        _display_rows.clear();
         _display_unit_keys.clear();
+        _display_rows_dirty = true;
+        update();
         emit unitCountChanged(0);
         return;
     }
 
+    // Keys in gather order, as reported with each row
+    auto sorted_keys = std::move(_display_unit_keys);
+    sorted_keys.resize(result.rows.size());
+
     // Apply row sorting if a non-Manual sort mode is selected
-    auto sorted_keys = std::vector<std::string>(unit_keys);
     auto const sort_mode = _state->sortMode();
     if (sort_mode != HeatmapSortMode::Manual) {
         auto sort_indices = Neuralyzer::Plots::computeSortOrder(
-                pipeline_result, sorted_keys, sort_mode, _state->sortAscending());
+                result, sorted_keys, sort_mode, _state->sortAscending());
         Neuralyzer::Plots::applySortOrder(
-                pipeline_result, sorted_keys, sort_indices);
+                result, sorted_keys, sort_indices);
     }
 
-    // Cache the display-order keys for tooltip lookup
-    _display_unit_keys = sorted_keys;
+    // Cache the display-order rows and keys for drawing, tooltips and export
+    _display_rows = std::move(result.rows);
+    _display_unit_keys = std::move(sorted_keys);
+    _display_rows_dirty = true;
+    _display_rows_complete = true;
+    update();
+
+    // Update Y-axis to reflect unit count
+    auto const num_units = _display_rows.size();
+    if (num_units != _unit_count) {
+        _unit_count = num_units;
+        emit unitCountChanged(_unit_count);
+    }
+}
+
+void HeatmapOpenGLWidget::uploadDisplayRows() {
+    if (_display_rows.empty() || !_state) {
+        _scene = CorePlotting::RenderableScene{};
+        _scene_renderer.clearScene();
+        return;
+    }
 
     // Build the colored rectangle scene with appropriate colormap and range
     auto const & color_range_config = _state->colorRange();
@@ -467,16 +604,9 @@ void HeatmapOpenGLWidget::rebuildScene() {
     }
 
     _scene = CorePlotting::HeatmapMapper::buildScene(
-            pipeline_result.rows, colormap, mapper_range);
+            _display_rows, colormap, mapper_range);
 
     _scene_renderer.uploadScene(_scene);
-
-    // Update Y-axis to reflect unit count
-    auto const num_units = pipeline_result.rows.size();
-    if (num_units != _unit_count) {
-        _unit_count = num_units;
-        emit unitCountChanged(_unit_count);
-    }
 }
 
 void HeatmapOpenGLWidget::updateMatrices() {
@@ -561,5 +691,9 @@ int HeatmapOpenGLWidget::worldToUnitIndex(QPointF const & world_pos) const {
     if (index < 0 || static_cast<size_t>(index) >= _display_unit_keys.size()) {
         return -1;
     }
+    // Rows still being estimated have no key yet
+    if (_display_unit_keys[static_cast<size_t>(index)].empty()) {
+        return -1;
+    }
     return index;
 }
@@ -7,6 +7,9 @@
  *
  * Uses CorePlotting::ViewStateData for view state and Neuralyzer::Plots
  * helpers for projection and interaction.
+ *
+ * The heatmap data pipeline runs on a worker thread. Rows are drawn as they
+ * arrive (in gather order) and re-sorted once the pipeline finishes.
  */
 
 #include "Core/HeatmapState.hpp"
@@ -23,8 +26,12 @@
 #include <QString>
 
 #include <glm/glm.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 class DataManager;
@@ -35,6 +42,10 @@ class QMouseEvent;
 class QWheelEvent;
 class SelectionContext;
 
+namespace Neuralyzer::Plots {
+struct HeatmapPipelineResult;
+}// namespace Neuralyzer::Plots
+
 class HeatmapOpenGLWidget : public QOpenGLWidget, protected QOpenGLFunctions {
     Q_OBJECT
 
@@ -66,10 +77,11 @@ public:
     [[nodiscard]] QString exportToSVG();
 
     /**
-     * @brief Collect aggregate heatmap export data by re-running the pipeline.
+     * @brief Collect aggregate heatmap export data.
      *
-     * Re-executes the heatmap data pipeline with the current state settings and
-     * returns the sorted rows and unit keys ready for `exportHeatmapToCSV()`.
+     * Returns the sorted rows and unit keys ready for `exportHeatmapToCSV()`.
+     * Reuses the rows on screen when the last pipeline run is complete for the
+     * current settings; otherwise re-executes the pipeline synchronously.
      */
     struct HeatmapExportBundle {
         std::vector<std::string> unit_keys;
@@ -124,6 +136,22 @@ private:
 
     /// Cached display-order unit keys (reflects current sort order)
     std::vector<std::string> _display_unit_keys;
+    /// Rows currently drawn, parallel to _display_unit_keys
+    std::vector<CorePlotting::HeatmapRowData> _display_rows;
+    /// _display_rows changed since the last upload (uploaded in paintGL)
+    bool _display_rows_dirty{false};
+    /// _display_rows hold the finished, sorted result for the current settings
+    bool _display_rows_complete{false};
+
+    /// Worker running runHeatmapPipeline(); joined before the next run starts
+    std::thread _pipeline_thread;
+    bool _pipeline_running{false};
+    /// Set to stop the running worker early; a fresh flag is made per run
+    std::shared_ptr<std::atomic<bool>> _pipeline_cancel;
+    /// A rebuild was requested while the worker was busy
+    bool _rebuild_pending{false};
+    /// Bumped per run; rows and results from older runs are dropped
+    std::uint64_t _pipeline_generation{0};
 
     std::unique_ptr<Neuralyzer::Plots::PlotTooltipManager> _tooltip_mgr;
 
@@ -135,6 +163,12 @@ private:
     int _widget_height{1};
 
     void rebuildScene();
+    void uploadDisplayRows();
+    void onPipelineRow(std::uint64_t generation, std::size_t row_index,
+                       std::string const & unit_key,
+                       CorePlotting::HeatmapRowData const & row);
+    void onPipelineFinished(std::uint64_t generation,
+                            Neuralyzer::Plots::HeatmapPipelineResult & result);
     void setupTooltip();
     [[nodiscard]] int worldToUnitIndex(QPointF const & world_pos) const;
     void updateMatrices();
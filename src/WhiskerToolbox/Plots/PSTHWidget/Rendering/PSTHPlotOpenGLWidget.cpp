@@ -4,6 +4,7 @@
 #include "CoreUtilities/color.hpp"
 #include "DataManager/DataManager.hpp"
 #include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "GatherResult/FlatEventGather.hpp"
 #include "GatherResult/GatherResult.hpp"
 #include "Plots/Common/EventRateEstimation/EstimationParams.hpp"
 #include "Plots/Common/EventRateEstimation/RateEstimate.hpp"
@@ -187,30 +188,20 @@ PSTHPlotOpenGLWidget::HistogramExportBundle PSTHPlotOpenGLWidget::collectHistogr
         std::vector<double> histogram(num_bins, 0.0);
         size_t total_trials = 0;
 
-        for (size_t trial_idx = 0; trial_idx < gathered.size(); ++trial_idx) {
-            auto const & trial_view = gathered[trial_idx];
-            if (!trial_view) {
-                continue;
-            }
-
-            ClockTicks const alignment_time = gathered.alignmentTimeAt(trial_idx);
-
-            for (auto const & event_with_id: trial_view->view()) {
-                ClockTicks const event_time_abs = event_with_id.event_time;
-                auto const relative_time = static_cast<double>((event_time_abs - alignment_time.getValue()).getValue());
+        auto const flat = gatherFlat(gathered);
+        for (auto const relative_ticks: flat.relative_times) {
+            auto const relative_time = static_cast<double>(relative_ticks);
 
-                if (relative_time < -half_window || relative_time >= half_window) {
-                    continue;
-                }
-
-                double const bin_position = (relative_time + half_window) / bin_size;
-                int bin_index = static_cast<int>(std::floor(bin_position));
-                bin_index = std::max(0, std::min(bin_index, num_bins - 1));
-                histogram[bin_index] += 1.0;
+            if (relative_time < -half_window || relative_time >= half_window) {
+                continue;
             }
 
-            total_trials++;
+            double const bin_position = (relative_time + half_window) / bin_size;
+            int bin_index = static_cast<int>(std::floor(bin_position));
+            bin_index = std::max(0, std::min(bin_index, num_bins - 1));
+            histogram[bin_index] += 1.0;
         }
+        total_trials += flat.presentTrialCount();
 
         // Apply scaling via RateEstimate
         Neuralyzer::Plots::RateEstimate rate_estimate;
@@ -486,45 +477,31 @@ void PSTHPlotOpenGLWidget::rebuildScene() {
             continue;
         }
 
-        // Process each trial in the gather result
-        for (size_t trial_idx = 0; trial_idx < gathered.size(); ++trial_idx) {
-            auto const & trial_view = gathered[trial_idx];
-            if (!trial_view) {
+        // Flatten all trials into one CSR block; relative times are already
+        // measured from each trial's alignment point (t=0)
+        auto const flat = gatherFlat(gathered);
+        for (auto const relative_ticks: flat.relative_times) {
+            auto const relative_time = static_cast<double>(relative_ticks);
+
+            // Only include events within the window
+            if (relative_time < -half_window || relative_time >= half_window) {
                 continue;
             }
 
-            // Get the alignment time for this trial (center point)
-            // alignmentTimeAt() returns absolute time directly
-            ClockTicks const alignment_time = gathered.alignmentTimeAt(trial_idx);
+            // Calculate which bin this event belongs to
+            // Bin 0 corresponds to -half_window, bin (num_bins-1) corresponds to +half_window
+            double const bin_position = (relative_time + half_window) / bin_size;
+            int bin_index = static_cast<int>(std::floor(bin_position));
 
-            // Iterate over events in this trial view
-            for (auto const & event_with_id: trial_view->view()) {
-                ClockTicks const event_time_abs = event_with_id.event_time;
+            // Clamp bin index to valid range
+            bin_index = std::max(0, std::min(bin_index, num_bins - 1));
 
-                // Calculate relative time (normalized by alignment event)
-                // This gives us the time relative to the alignment point (t=0)
-                auto const relative_time = static_cast<double>((event_time_abs - alignment_time.getValue()).getValue());
-
-                // Only include events within the window
-                if (relative_time < -half_window || relative_time >= half_window) {
-                    continue;
-                }
-
-                // Calculate which bin this event belongs to
-                // Bin 0 corresponds to -half_window, bin (num_bins-1) corresponds to +half_window
-                double const bin_position = (relative_time + half_window) / bin_size;
-                int bin_index = static_cast<int>(std::floor(bin_position));
-
-                // Clamp bin index to valid range
-                bin_index = std::max(0, std::min(bin_index, num_bins - 1));
-
-                // Increment the count for this bin
-                histogram[bin_index] += 1.0;
-            }
-
-            // Track total number of trials processed
-            total_trials++;
+            // Increment the count for this bin
+            histogram[bin_index] += 1.0;
         }
+
+        // Track total number of trials processed
+        total_trials += flat.presentTrialCount();
     }
 
     // Print histogram construction
@@ -2,6 +2,7 @@
 
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
 #include "DataManager/DataManager.hpp"
+#include "DataManager/utils/TimeJoin.hpp"
 #include "ScatterAxisSource.hpp"
 #include "SourceCompatibility.hpp"
 #include "Tensors/RowDescriptor.hpp"
@@ -11,7 +12,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
-#include <unordered_map>
+#include <span>
 
 namespace {
 
@@ -34,77 +35,82 @@ std::vector<float> extractTensorColumn(
 }
 
 /**
- * @brief Get values from an AnalogTimeSeries as a simple span
+ * @brief Pair two time-indexed value columns by TimeFrameIndex
  *
- * Returns a parallel pair of (time_indices, values) for the full series.
- */
-struct AnalogData {
-    std::vector<TimeFrameIndex> time_indices;
-    std::span<float const> values;
-    std::shared_ptr<TimeIndexStorage> time_storage;
-};
-
-AnalogData getAnalogData(AnalogTimeSeries const & ats) {
-    AnalogData result;
-    result.time_storage = ats.getTimeStorage();
-    result.time_indices = result.time_storage->getAllTimeIndices();
-    result.values = ats.getAnalogTimeSeries();
-    return result;
-}
-
-/**
- * @brief Build scatter points from two AnalogTimeSeries sources
+ * Every X time index t is a candidate point; it is kept when X has a sample
+ * at t + x_offset and Y has a sample at t + y_offset. Both lookups are
+ * sorted merge-joins over the time storages (see TimeJoin.hpp), so no hash
+ * tables are built. When the two sources live on different TimeFrames, Y is
+ * matched on absolute clock ticks rather than raw indices.
  *
- * Iterates over the intersection of valid TimeFrameIndex values.
- * Temporal offsets shift the lookup index.
+ * Repeated time indices resolve as the former hash-map lookups did: X reads
+ * the first sample at t + x_offset and Y the last sample at t + y_offset.
  */
-ScatterPointData buildFromAnalogAnalog(
-        AnalogTimeSeries const & x_ats,
-        AnalogTimeSeries const & y_ats,
+ScatterPointData joinOnTime(
+        TimeIndexStorage const & x_storage,
+        TimeFrame const * x_frame,
+        std::span<float const> x_values,
+        TimeIndexStorage const & y_storage,
+        TimeFrame const * y_frame,
+        std::span<float const> y_values,
         int x_offset,
         int y_offset) {
     ScatterPointData result;
 
-    auto x_data = getAnalogData(x_ats);
-    auto y_data = getAnalogData(y_ats);
-
-    if (x_data.values.empty() || y_data.values.empty()) {
+    if (x_values.empty() || y_values.empty()) {
         return result;
     }
 
-    // Build a lookup from TimeFrameIndex -> array position for Y
-    std::unordered_map<int64_t, std::size_t> y_index_map;
-    y_index_map.reserve(y_data.time_indices.size());
-    for (std::size_t i = 0; i < y_data.time_indices.size(); ++i) {
-        y_index_map[y_data.time_indices[i].getValue()] = i;
-    }
-
-    // Iterate over X time indices, looking up corresponding Y values
-    for (std::size_t xi = 0; xi < x_data.time_indices.size(); ++xi) {
-        auto const base_tfi = x_data.time_indices[xi];
-        auto const x_lookup = TimeFrameIndex(base_tfi.getValue() + x_offset);
-        auto const y_lookup = TimeFrameIndex(base_tfi.getValue() + y_offset);
-
-        // Check X is within bounds after offset
-        auto x_pos = x_data.time_storage->findArrayPositionForTimeIndex(x_lookup);
-        if (!x_pos.has_value()) {
-            continue;
+    // Base X position -> last Y position at t + y_offset
+    TimeJoinOptions y_options;
+    y_options.last_duplicate = true;
+    auto const y_join = joinTimeSeries({&x_storage, x_frame, 0},
+                                       {&y_storage, y_frame, -y_offset},
+                                       y_options);
+
+    // Base X position -> first X position at t + x_offset
+    auto const x_join = joinTimeSeries({&x_storage, nullptr, 0},
+                                       {&x_storage, nullptr, -x_offset});
+
+    result.x_values.reserve(y_join.size());
+    result.y_values.reserve(y_join.size());
+    result.time_indices.reserve(y_join.size());
+
+    // Both joins are ordered by base position; intersect them in one pass
+    std::size_t xi = 0;
+    for (std::size_t k = 0; k < y_join.size(); ++k) {
+        auto const base = y_join.left_positions[k];
+        while (xi < x_join.size() && x_join.left_positions[xi] < base) {
+            ++xi;
         }
-
-        // Check Y exists at the offset index
-        auto it = y_index_map.find(y_lookup.getValue());
-        if (it == y_index_map.end()) {
+        if (xi == x_join.size() || x_join.left_positions[xi] != base) {
             continue;
         }
 
-        result.x_values.push_back(x_data.values[*x_pos]);
-        result.y_values.push_back(y_data.values[it->second]);
-        result.time_indices.push_back(base_tfi);
+        result.x_values.push_back(x_values[x_join.right_positions[xi]]);
+        result.y_values.push_back(y_values[y_join.right_positions[k]]);
+        result.time_indices.push_back(x_storage.getTimeFrameIndexAt(base));
     }
 
     return result;
 }
 
+/**
+ * @brief Build scatter points from two AnalogTimeSeries sources
+ *
+ * Iterates over the intersection of valid TimeFrameIndex values.
+ * Temporal offsets shift the lookup index.
+ */
+ScatterPointData buildFromAnalogAnalog(
+        AnalogTimeSeries const & x_ats,
+        AnalogTimeSeries const & y_ats,
+        int x_offset,
+        int y_offset) {
+    return joinOnTime(*x_ats.getTimeStorage(), x_ats.getTimeFrame().get(), x_ats.getAnalogTimeSeries(),
+                      *y_ats.getTimeStorage(), y_ats.getTimeFrame().get(), y_ats.getAnalogTimeSeries(),
+                      x_offset, y_offset);
+}
+
 /**
  * @brief Build scatter points from AnalogTimeSeries (X) and TensorData with TFI rows (Y)
  */
@@ -114,45 +120,10 @@ ScatterPointData buildFromAnalogTensorTFI(
         ScatterAxisSource const & y_source,
         int x_offset,
         int y_offset) {
-    ScatterPointData result;
-
-    auto x_data = getAnalogData(x_ats);
-    auto y_col = extractTensorColumn(y_tensor, y_source);
-    auto const & y_time_storage = y_tensor.rows().timeStorage();
-    auto y_time_indices = y_time_storage.getAllTimeIndices();
-
-    if (x_data.values.empty() || y_col.empty()) {
-        return result;
-    }
-
-    // Build lookup for Y tensor time indices
-    std::unordered_map<int64_t, std::size_t> y_index_map;
-    y_index_map.reserve(y_time_indices.size());
-    for (std::size_t i = 0; i < y_time_indices.size(); ++i) {
-        y_index_map[y_time_indices[i].getValue()] = i;
-    }
-
-    for (std::size_t xi = 0; xi < x_data.time_indices.size(); ++xi) {
-        auto const base_tfi = x_data.time_indices[xi];
-        auto const x_lookup = TimeFrameIndex(base_tfi.getValue() + x_offset);
-        auto const y_lookup = TimeFrameIndex(base_tfi.getValue() + y_offset);
-
-        auto x_pos = x_data.time_storage->findArrayPositionForTimeIndex(x_lookup);
-        if (!x_pos.has_value()) {
-            continue;
-        }
-
-        auto it = y_index_map.find(y_lookup.getValue());
-        if (it == y_index_map.end()) {
-            continue;
-        }
-
-        result.x_values.push_back(x_data.values[*x_pos]);
-        result.y_values.push_back(y_col[it->second]);
-        result.time_indices.push_back(base_tfi);
-    }
-
-    return result;
+    auto const y_col = extractTensorColumn(y_tensor, y_source);
+    return joinOnTime(*x_ats.getTimeStorage(), x_ats.getTimeFrame().get(), x_ats.getAnalogTimeSeries(),
+                      y_tensor.rows().timeStorage(), y_tensor.getTimeFrame().get(), y_col,
+                      x_offset, y_offset);
 }
 
 /**
@@ -164,44 +135,10 @@ ScatterPointData buildFromTensorTFIAnalog(
         AnalogTimeSeries const & y_ats,
         int x_offset,
         int y_offset) {
-    ScatterPointData result;
-
-    auto x_col = extractTensorColumn(x_tensor, x_source);
-    auto const & x_time_storage = x_tensor.rows().timeStorage();
-    auto x_time_indices = x_time_storage.getAllTimeIndices();
-    auto y_data = getAnalogData(y_ats);
-
-    if (x_col.empty() || y_data.values.empty()) {
-        return result;
-    }
-
-    // Build lookup for Y analog time indices
-    std::unordered_map<int64_t, std::size_t> y_index_map;
-    y_index_map.reserve(y_data.time_indices.size());
-    for (std::size_t i = 0; i < y_data.time_indices.size(); ++i) {
-        y_index_map[y_data.time_indices[i].getValue()] = i;
-    }
-
-    for (auto base_tfi: x_time_indices) {
-        auto const x_lookup = TimeFrameIndex(base_tfi.getValue() + x_offset);
-        auto const y_lookup = TimeFrameIndex(base_tfi.getValue() + y_offset);
-
-        auto x_pos = x_time_storage.findArrayPositionForTimeIndex(x_lookup);
-        if (!x_pos.has_value()) {
-            continue;
-        }
-
-        auto it = y_index_map.find(y_lookup.getValue());
-        if (it == y_index_map.end()) {
-            continue;
-        }
-
-        result.x_values.push_back(x_col[*x_pos]);
-        result.y_values.push_back(y_data.values[it->second]);
-        result.time_indices.push_back(base_tfi);
-    }
-
-    return result;
+    auto const x_col = extractTensorColumn(x_tensor, x_source);
+    return joinOnTime(x_tensor.rows().timeStorage(), x_tensor.getTimeFrame().get(), x_col,
+                      *y_ats.getTimeStorage(), y_ats.getTimeFrame().get(), y_ats.getAnalogTimeSeries(),
+                      x_offset, y_offset);
 }
 
 /**
@@ -214,46 +151,11 @@ ScatterPointData buildFromTensorTFITensorTFI(
         ScatterAxisSource const & y_source,
         int x_offset,
         int y_offset) {
-    ScatterPointData result;
-
-    auto x_col = extractTensorColumn(x_tensor, x_source);
-    auto y_col = extractTensorColumn(y_tensor, y_source);
-    auto const & x_time_storage = x_tensor.rows().timeStorage();
-    auto x_time_indices = x_time_storage.getAllTimeIndices();
-    auto const & y_time_storage = y_tensor.rows().timeStorage();
-    auto y_time_indices = y_time_storage.getAllTimeIndices();
-
-    if (x_col.empty() || y_col.empty()) {
-        return result;
-    }
-
-    // Build lookup for Y
-    std::unordered_map<int64_t, std::size_t> y_index_map;
-    y_index_map.reserve(y_time_indices.size());
-    for (std::size_t i = 0; i < y_time_indices.size(); ++i) {
-        y_index_map[y_time_indices[i].getValue()] = i;
-    }
-
-    for (auto base_tfi: x_time_indices) {
-        auto const x_lookup = TimeFrameIndex(base_tfi.getValue() + x_offset);
-        auto const y_lookup = TimeFrameIndex(base_tfi.getValue() + y_offset);
-
-        auto x_pos = x_time_storage.findArrayPositionForTimeIndex(x_lookup);
-        if (!x_pos.has_value()) {
-            continue;
-        }
-
-        auto it = y_index_map.find(y_lookup.getValue());
-        if (it == y_index_map.end()) {
-            continue;
-        }
-
-        result.x_values.push_back(x_col[*x_pos]);
-        result.y_values.push_back(y_col[it->second]);
-        result.time_indices.push_back(base_tfi);
-    }
-
-    return result;
+    auto const x_col = extractTensorColumn(x_tensor, x_source);
+    auto const y_col = extractTensorColumn(y_tensor, y_source);
+    return joinOnTime(x_tensor.rows().timeStorage(), x_tensor.getTimeFrame().get(), x_col,
+                      y_tensor.rows().timeStorage(), y_tensor.getTimeFrame().get(), y_col,
+                      x_offset, y_offset);
 }
 
 /**
@@ -12,10 +12,47 @@
 #include <QJsonParseError>
 #include <QTemporaryFile>
 
+#include <cstdlib>
 #include <stdexcept>
+#include <string_view>
 
 namespace {
 
+[[nodiscard]] bool envFlagEnabled(char const * value) {
+    if (value == nullptr || value[0] == '\0') {
+        return false;
+    }
+    return std::string_view{value} == "1" || std::string_view{value} == "true";
+}
+
+/**
+ * @brief Whether JSON configs are loaded with load_data_from_json_config_parallel()
+ *
+ * On by default; setting NEURALYZER_SEQUENTIAL_JSON_LOAD=1 falls back to the
+ * sequential loader.
+ */
+[[nodiscard]] bool parallelJsonLoadEnabled() {
+    static bool const k_enabled = !envFlagEnabled(std::getenv("NEURALYZER_SEQUENTIAL_JSON_LOAD"));
+    return k_enabled;
+}
+
+std::vector<DataInfo> loadJsonConfigFile(
+    DataManager * dataManager,
+    std::string const & jsonFilePath,
+    LoadProgressCallback const & progressCallback) {
+
+    if (!parallelJsonLoadEnabled()) {
+        if (progressCallback) {
+            return load_data_from_json_config(dataManager, jsonFilePath, progressCallback);
+        }
+        return load_data_from_json_config(dataManager, jsonFilePath);
+    }
+
+    JsonParallelLoadOptions options;
+    options.progress_callback = progressCallback;
+    return load_data_from_json_config_parallel(dataManager, jsonFilePath, options).data_info;
+}
+
 /**
  * @brief Convert DataInfo vector to DataDisplayConfig vector
  * 
@@ -43,15 +80,9 @@ std::vector<DataInfo> loadDataAndBroadcastConfig(
         throw std::runtime_error("DataManager is null");
     }
 
-    std::vector<DataInfo> dataInfo;
-
     // Phase 1: Load data into DataManager
     // This triggers DataManager's internal observers (untyped _notifyObservers)
-    if (progressCallback) {
-        dataInfo = load_data_from_json_config(dataManager, jsonFilePath, progressCallback);
-    } else {
-        dataInfo = load_data_from_json_config(dataManager, jsonFilePath);
-    }
+    auto dataInfo = loadJsonConfigFile(dataManager, jsonFilePath, progressCallback);
 
     // Phase 2: Broadcast UI configuration via EditorRegistry signal
     // Widgets connect to this to apply colors, styles, etc.
@@ -143,13 +174,8 @@ std::vector<DataInfo> loadDataFromJsonContentAndBroadcast(
     // Load using the standard function
     std::vector<DataInfo> dataInfo;
     try {
-        if (progressCallback) {
-            dataInfo = load_data_from_json_config(
-                dataManager, tempFile.fileName().toStdString(), progressCallback);
-        } else {
-            dataInfo = load_data_from_json_config(
-                dataManager, tempFile.fileName().toStdString());
-        }
+        dataInfo = loadJsonConfigFile(
+            dataManager, tempFile.fileName().toStdString(), progressCallback);
     } catch (...) {
         // Clean up temp file before re-throwing
         QFile::remove(tempFile.fileName());
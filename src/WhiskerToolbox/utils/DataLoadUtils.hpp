@@ -11,6 +11,11 @@
  * 
  * This centralizes the load logic so that both MainWindow's JSON loader and
  * BatchProcessing_Widget can share the same code path.
+ *
+ * Configs are loaded with load_data_from_json_config_parallel(), which reads
+ * independent files concurrently and registers them in dependency order. Set
+ * the environment variable NEURALYZER_SEQUENTIAL_JSON_LOAD=1 to use the
+ * sequential load_data_from_json_config() instead.
  */
 
 #include "DataManager/DataManagerTypes.hpp"
@@ -37,7 +42,7 @@ using LoadProgressCallback = std::function<bool(int current, int total, std::str
  * @brief Load data from a JSON configuration file and broadcast UI config
  * 
  * This function:
- * 1. Calls DataManager's load_data_from_json_config (triggers DataManager observers)
+ * 1. Loads the config into the DataManager (triggers DataManager observers)
  * 2. Emits EditorRegistry::applyDataDisplayConfig with the resulting DataInfo
  * 
  * @param dataManager The DataManager to load data into
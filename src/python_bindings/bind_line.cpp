@@ -1,4 +1,6 @@
 #include "bind_module.hpp"
+#include "numpy_utils.hpp"
+#include "ragged_numpy.hpp"
 
 #include <pybind11/stl.h>
 
@@ -6,6 +8,8 @@
 #include "Lines/Line_Data.hpp"
 #include "Observer/Observer_Data.hpp"
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -89,6 +93,48 @@ void init_line(py::module_ & m) {
             py::arg("entity_id"),
             "Get the line associated with an entity ID (None if not found)")
 
+        // --- Bulk columnar NumPy I/O (requires NumPy at runtime) ---
+        .def("toColumnar",
+            [](std::shared_ptr<LineData> const & self) {
+                return wt::python::ragged_geometry_to_columns<Line2D, float>(*self, py::cast(self));
+            },
+            "Export all lines as a dict of NumPy arrays: times (int64), entity_ids (uint64), "
+            "offsets (int64, len = entries + 1) and flat x/y (float32). "
+            "times/entity_ids are zero-copy read-only views while the data is unmodified")
+
+        .def("addColumnar",
+            [](std::shared_ptr<LineData> const & self,
+               py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & times,
+               py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & offsets,
+               py::array_t<float, py::array::c_style | py::array::forcecast> const & x,
+               py::array_t<float, py::array::c_style | py::array::forcecast> const & y) {
+                wt::python::columns_to_ragged_geometry<Line2D, float>(
+                    *self,
+                    wt::python::numpy_as_span(times),
+                    wt::python::numpy_as_span(offsets),
+                    wt::python::numpy_as_span(x),
+                    wt::python::numpy_as_span(y));
+            },
+            py::arg("times"), py::arg("offsets"), py::arg("x"), py::arg("y"),
+            "Append lines from columnar arrays in one call (entry i uses x/y[offsets[i]:offsets[i+1]])")
+
+        .def_static("fromColumnar",
+            [](py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & times,
+               py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & offsets,
+               py::array_t<float, py::array::c_style | py::array::forcecast> const & x,
+               py::array_t<float, py::array::c_style | py::array::forcecast> const & y) {
+                auto result = std::make_shared<LineData>();
+                wt::python::columns_to_ragged_geometry<Line2D, float>(
+                    *result,
+                    wt::python::numpy_as_span(times),
+                    wt::python::numpy_as_span(offsets),
+                    wt::python::numpy_as_span(x),
+                    wt::python::numpy_as_span(y));
+                return result;
+            },
+            py::arg("times"), py::arg("offsets"), py::arg("x"), py::arg("y"),
+            "Build a new LineData from columnar arrays (inverse of toColumnar)")
+
         // --- Image size ---
         .def("getImageSize", &LineData::getImageSize)
         .def("setImageSize",
@@ -1,4 +1,6 @@
 #include "bind_module.hpp"
+#include "numpy_utils.hpp"
+#include "ragged_numpy.hpp"
 
 #include <pybind11/stl.h>
 
@@ -6,6 +8,8 @@
 #include "Masks/Mask_Data.hpp"
 #include "Observer/Observer_Data.hpp"
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -86,6 +90,48 @@ void init_mask(py::module_ & m) {
             },
             py::arg("entity_id"))
 
+        // --- Bulk columnar NumPy I/O (requires NumPy at runtime) ---
+        .def("toColumnar",
+            [](std::shared_ptr<MaskData> const & self) {
+                return wt::python::ragged_geometry_to_columns<Mask2D, uint32_t>(*self, py::cast(self));
+            },
+            "Export all masks as a dict of NumPy arrays: times (int64), entity_ids (uint64), "
+            "offsets (int64, len = entries + 1) and flat x/y (uint32). "
+            "times/entity_ids are zero-copy read-only views while the data is unmodified")
+
+        .def("addColumnar",
+            [](std::shared_ptr<MaskData> const & self,
+               py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & times,
+               py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & offsets,
+               py::array_t<uint32_t, py::array::c_style | py::array::forcecast> const & x,
+               py::array_t<uint32_t, py::array::c_style | py::array::forcecast> const & y) {
+                wt::python::columns_to_ragged_geometry<Mask2D, uint32_t>(
+                    *self,
+                    wt::python::numpy_as_span(times),
+                    wt::python::numpy_as_span(offsets),
+                    wt::python::numpy_as_span(x),
+                    wt::python::numpy_as_span(y));
+            },
+            py::arg("times"), py::arg("offsets"), py::arg("x"), py::arg("y"),
+            "Append masks from columnar arrays in one call (entry i uses x/y[offsets[i]:offsets[i+1]])")
+
+        .def_static("fromColumnar",
+            [](py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & times,
+               py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & offsets,
+               py::array_t<uint32_t, py::array::c_style | py::array::forcecast> const & x,
+               py::array_t<uint32_t, py::array::c_style | py::array::forcecast> const & y) {
+                auto result = std::make_shared<MaskData>();
+                wt::python::columns_to_ragged_geometry<Mask2D, uint32_t>(
+                    *result,
+                    wt::python::numpy_as_span(times),
+                    wt::python::numpy_as_span(offsets),
+                    wt::python::numpy_as_span(x),
+                    wt::python::numpy_as_span(y));
+                return result;
+            },
+            py::arg("times"), py::arg("offsets"), py::arg("x"), py::arg("y"),
+            "Build a new MaskData from columnar arrays (inverse of toColumnar)")
+
         // --- Image size ---
         .def("getImageSize", &MaskData::getImageSize)
         .def("setImageSize",
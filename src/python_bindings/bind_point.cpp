@@ -1,10 +1,14 @@
 #include "bind_module.hpp"
+#include "numpy_utils.hpp"
+#include "ragged_numpy.hpp"
 
 #include <pybind11/stl.h>
 
 #include "Points/Point_Data.hpp"
 #include "Observer/Observer_Data.hpp"
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -66,6 +70,43 @@ void init_point(py::module_ & m) {
             },
             py::arg("entity_id"))
 
+        // --- Bulk columnar NumPy I/O (requires NumPy at runtime) ---
+        .def("toColumnar",
+            [](std::shared_ptr<PointData> const & self) {
+                return wt::python::point_series_to_columns(*self, py::cast(self));
+            },
+            "Export all points as a dict of NumPy arrays: times (int64), entity_ids (uint64), x/y (float32). "
+            "Arrays are zero-copy read-only views while the data is unmodified")
+
+        .def("addColumnar",
+            [](std::shared_ptr<PointData> const & self,
+               py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & times,
+               py::array_t<float, py::array::c_style | py::array::forcecast> const & x,
+               py::array_t<float, py::array::c_style | py::array::forcecast> const & y) {
+                wt::python::columns_to_point_series(
+                    *self,
+                    wt::python::numpy_as_span(times),
+                    wt::python::numpy_as_span(x),
+                    wt::python::numpy_as_span(y));
+            },
+            py::arg("times"), py::arg("x"), py::arg("y"),
+            "Append one point per (time, x, y) row in one call")
+
+        .def_static("fromColumnar",
+            [](py::array_t<int64_t, py::array::c_style | py::array::forcecast> const & times,
+               py::array_t<float, py::array::c_style | py::array::forcecast> const & x,
+               py::array_t<float, py::array::c_style | py::array::forcecast> const & y) {
+                auto result = std::make_shared<PointData>();
+                wt::python::columns_to_point_series(
+                    *result,
+                    wt::python::numpy_as_span(times),
+                    wt::python::numpy_as_span(x),
+                    wt::python::numpy_as_span(y));
+                return result;
+            },
+            py::arg("times"), py::arg("x"), py::arg("y"),
+            "Build a new PointData from columnar arrays (inverse of toColumnar)")
+
         // --- Image size ---
         .def("getImageSize", &PointData::getImageSize)
         .def("setImageSize",
@@ -8,8 +8,31 @@
 #include "TimeFrame/TimeFrameIndex.hpp"
 #include "TimeFrame/TimeIndexStorage.hpp"
 
+#include <memory>
 #include <optional>
 #include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Row-major flat data of @p self as a read-only NumPy array.
+ *
+ * Views the storage buffer directly when it is contiguous and row-major.
+ * Column-major (Armadillo) and non-contiguous (lagged, lazy, memory-mapped)
+ * storage has no such buffer, so the data is materialized into a new array.
+ */
+py::array_t<float> flatValuesArray(std::shared_ptr<TensorData> const & self) {
+    auto const & storage = self->storage();
+    if (storage.isContiguous() && storage.getStorageType() != TensorStorageType::Armadillo) {
+        return wt::python::span_to_numpy_readonly(self->flatData(), py::cast(self));
+    }
+    auto arr = wt::python::vector_to_numpy(self->materializeFlat());
+    py::detail::array_proxy(arr.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+    return arr;
+}
+
+}// namespace
 
 void init_tensor(py::module_ & m) {
 
@@ -48,16 +71,15 @@ void init_tensor(py::module_ & m) {
 
             // --- Zero-copy read (requires NumPy at runtime) ---
             .def_property_readonly("values", [](std::shared_ptr<TensorData> const & self) {
-                auto span = self->flatData();
-                auto arr = wt::python::span_to_numpy_readonly(span, py::cast(self));
+                auto arr = flatValuesArray(self);
                 // Reshape to the tensor's shape
                 auto shape_vec = self->shape();
                 std::vector<py::ssize_t> const shape(shape_vec.begin(), shape_vec.end());
-                return arr.reshape(shape); }, "Read-only NumPy view of the tensor data, reshaped to shape() (zero-copy)")
+                return arr.reshape(shape); }, "Read-only NumPy array of the tensor data, reshaped to shape() "
+                                              "(zero-copy for row-major contiguous storage, otherwise a copy)")
 
-            .def("flatValues", [](std::shared_ptr<TensorData> const & self) {
-                auto span = self->flatData();
-                return wt::python::span_to_numpy_readonly(span, py::cast(self)); }, "Read-only 1-D NumPy view of the flat data (zero-copy)")
+            .def("flatValues", [](std::shared_ptr<TensorData> const & self) { return flatValuesArray(self); }, "Read-only 1-D NumPy array of the flat data in row-major order "
+                                                                                                              "(zero-copy for row-major contiguous storage, otherwise a copy)")
 
             // --- Copy-based access (always works, no NumPy) ---
             .def("toList", &TensorData::materializeFlat, "Copy flat data to a Python list (row-major order)")
@@ -13,9 +13,16 @@
 #include "PythonResult.hpp"
 #include "bind_module.hpp"
 
+#include "Tensors/TensorData.hpp"
+#include "Tensors/storage/LaggedTensorStorage.hpp"
+#include "TimeFrame/TimeIndexStorage.hpp"
+
 #include <catch2/catch_test_macros.hpp>
+#include <pybind11/pybind11.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 // ── shared engine ──────────────────────────────────────────────────────────
 
@@ -337,6 +344,116 @@ td = wt.TensorData.createOrdinal2D(
     REQUIRE(r.stdout_text.find("col_a") != std::string::npos);
 }
 
+// ── Columnar NumPy I/O ─────────────────────────────────────────────────────
+
+// Columnar methods return NumPy arrays, so skip when NumPy is not installed
+// in the embedded interpreter.
+static void requireNumpyOrSkip() {
+    auto r = engine().execute("import numpy as np");
+    if (!r.success) {
+        SKIP("NumPy not available in embedded interpreter");
+    }
+}
+
+TEST_CASE("MaskData columnar round-trip", "[bindings][mask][numpy]") {
+    Fixture f;
+    requireNumpyOrSkip();
+    run("import whiskertoolbox_python as wt");
+
+    run(R"(
+md = wt.MaskData.fromColumnar(
+    np.array([0, 0, 3], dtype=np.int64),
+    np.array([0, 2, 3, 6], dtype=np.int64),
+    np.array([1, 2, 5, 7, 8, 9], dtype=np.uint32),
+    np.array([1, 1, 5, 0, 0, 0], dtype=np.uint32))
+cols = md.toColumnar()
+)");
+    auto r = run("print(md.getTimeCount(), md.getTotalEntryCount())");
+    REQUIRE(r.stdout_text == "2 3\n");
+    r = run("print(cols['times'].tolist(), cols['offsets'].tolist())");
+    REQUIRE(r.stdout_text == "[0, 0, 3] [0, 2, 3, 6]\n");
+    r = run("print(cols['x'].tolist(), cols['x'].dtype)");
+    REQUIRE(r.stdout_text == "[1, 2, 5, 7, 8, 9] uint32\n");
+}
+
+TEST_CASE("LineData columnar append and export", "[bindings][line][numpy]") {
+    Fixture f;
+    requireNumpyOrSkip();
+    run("import whiskertoolbox_python as wt");
+
+    run(R"(
+ld = wt.LineData()
+ld.addAtTime(wt.TimeFrameIndex(0), wt.Line2D([wt.Point2D(0,0), wt.Point2D(1,1)]))
+ld.addColumnar(np.array([4]), np.array([0, 3]),
+               np.array([1.0, 2.0, 3.0]), np.array([4.0, 5.0, 6.0]))
+cols = ld.toColumnar()
+)");
+    auto r = run("print(cols['offsets'].tolist())");
+    REQUIRE(r.stdout_text == "[0, 2, 5]\n");
+    r = run("print(cols['y'][2:].tolist())");
+    REQUIRE(r.stdout_text == "[4.0, 5.0, 6.0]\n");
+}
+
+TEST_CASE("LineData addColumnar rejects inconsistent offsets", "[bindings][line][numpy]") {
+    Fixture f;
+    requireNumpyOrSkip();
+    run("import whiskertoolbox_python as wt");
+
+    auto r = engine().execute(R"(
+ld = wt.LineData()
+ld.addColumnar(np.array([0]), np.array([0, 5]), np.array([1.0]), np.array([1.0]))
+)");
+    REQUIRE_FALSE(r.success);
+}
+
+TEST_CASE("PointData columnar views are zero-copy", "[bindings][point][numpy]") {
+    Fixture f;
+    requireNumpyOrSkip();
+    run("import whiskertoolbox_python as wt");
+
+    run(R"(
+pd = wt.PointData.fromColumnar(np.arange(4), np.array([1, 2, 3, 4], dtype=np.float32),
+                               np.array([5, 6, 7, 8], dtype=np.float32))
+cols = pd.toColumnar()
+)");
+    auto r = run("print(cols['x'].tolist(), cols['y'].tolist())");
+    REQUIRE(r.stdout_text == "[1.0, 2.0, 3.0, 4.0] [5.0, 6.0, 7.0, 8.0]\n");
+    r = run("print(cols['x'].flags.writeable, cols['x'].strides[0])");
+    REQUIRE(r.stdout_text == "False 8\n");
+}
+
+TEST_CASE("TensorData values of ordinal and lagged tensors", "[bindings][tensor][numpy]") {
+    Fixture f;
+    requireNumpyOrSkip();
+    run("import whiskertoolbox_python as wt");
+
+    SECTION("ordinal tensor is row-major") {
+        run("td = wt.TensorData.createOrdinal2D([1.0, 2.0, 3.0, 4.0, 5.0, 6.0], 2, 3)");
+        auto r = run("print(td.values.tolist(), td.flatValues().tolist())");
+        REQUIRE(r.stdout_text == "[[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]] [1.0, 2.0, 3.0, 4.0, 5.0, 6.0]\n");
+    }
+
+    SECTION("lagged tensor is materialized") {
+        // 3 rows x 2 cols, lag groups {0, -1} with clamped boundaries
+        auto source = TensorData::createTimeSeries2D(
+                std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f}, 3, 2,
+                TimeIndexStorageFactory::createDenseFromZero(3), nullptr);
+        TensorStorageWrapper lagged{LaggedTensorStorage{source.storage(), {0, -1}, 0, 3,
+                                                        LaggedOutOfRange::Clamp, 0.0f}};
+        auto tensor = std::make_shared<TensorData>(TensorData::createTimeSeries2DFromStorage(
+                std::move(lagged), TimeIndexStorageFactory::createDenseFromZero(3), nullptr));
+        REQUIRE_FALSE(tensor->isContiguous());
+        engine().inject("lagged", pybind11::cast(tensor));
+
+        auto r = run("print(lagged.values.shape, lagged.values[2].tolist())");
+        REQUIRE(r.stdout_text == "(3, 4) [5.0, 6.0, 3.0, 4.0]\n");
+        r = run("print(lagged.flatValues().tolist() == lagged.toList())");
+        REQUIRE(r.stdout_text == "True\n");
+        r = run("print(lagged.flatValues().flags.writeable)");
+        REQUIRE(r.stdout_text == "False\n");
+    }
+}
+
 // ── DataManager ────────────────────────────────────────────────────────────
 
 TEST_CASE("DataManager basic operations", "[bindings][datamanager]") {
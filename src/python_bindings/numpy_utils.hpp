@@ -11,7 +11,11 @@
 
 #include <pybind11/numpy.h>
 
+#include <cstddef>
 #include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace py = pybind11;
@@ -44,6 +48,69 @@ py::array_t<T> span_to_numpy_readonly(std::span<T const> data, py::handle owner)
     return result;
 }
 
+/**
+ * @brief Create a **read-only** NumPy array over strided C++ memory (zero-copy).
+ *
+ * Used to expose one field of an array-of-structs (e.g. the `x` member of a
+ * contiguous `Point2D<float>` buffer) without de-interleaving.
+ *
+ * @param first        Pointer to the first element.
+ * @param count        Number of elements.
+ * @param stride_bytes Distance in bytes between consecutive elements.
+ * @param owner        Python handle keeping the C++ memory alive.
+ */
+template<typename T>
+py::array_t<T> strided_to_numpy_readonly(T const * first,
+                                         std::size_t count,
+                                         std::size_t stride_bytes,
+                                         py::handle owner) {
+    if (count == 0) {
+        return py::array_t<T>(0);
+    }
+    auto result = py::array_t<T>(
+        {static_cast<py::ssize_t>(count)},
+        {static_cast<py::ssize_t>(stride_bytes)},
+        first,
+        owner);
+    py::detail::array_proxy(result.ptr())->flags
+        &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+    return result;
+}
+
+/**
+ * @brief Hand a std::vector over to NumPy without copying its contents.
+ *
+ * The vector is moved into a heap allocation owned by a capsule, so the
+ * returned (writeable) array keeps the buffer alive on its own.
+ */
+template<typename T>
+py::array_t<T> vector_to_numpy(std::vector<T> && vec) {
+    auto * heap = new std::vector<T>(std::move(vec));
+    py::capsule const free_when_done(heap, [](void * p) {
+        delete static_cast<std::vector<T> *>(p);
+    });
+    return py::array_t<T>(
+        {static_cast<py::ssize_t>(heap->size())},
+        {static_cast<py::ssize_t>(sizeof(T))},
+        heap->data(),
+        free_when_done);
+}
+
+/**
+ * @brief Read-only span over a 1-D C-contiguous NumPy array (no copy).
+ *
+ * The span is only valid while @p arr is alive.
+ */
+template<typename T>
+std::span<T const> numpy_as_span(
+    py::array_t<T, py::array::c_style | py::array::forcecast> const & arr) {
+    if (arr.ndim() != 1) {
+        throw std::invalid_argument(
+            "expected a 1-D array, got " + std::to_string(arr.ndim()) + "-D");
+    }
+    return {arr.data(), static_cast<std::size_t>(arr.size())};
+}
+
 /**
  * @brief Copy a NumPy array into a std::vector.
  */
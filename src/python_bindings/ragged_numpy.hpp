@@ -0,0 +1,255 @@
+#pragma once
+
+/**
+ * @file ragged_numpy.hpp
+ * @brief Bulk columnar NumPy import/export for RaggedTimeSeries containers.
+ *
+ * MaskData, LineData and PointData are exposed to Python as a handful of
+ * flat arrays instead of one Python object per element:
+ *
+ * | key          | dtype   | length            | meaning                          |
+ * |--------------|---------|-------------------|----------------------------------|
+ * | `times`      | int64   | n_entries         | TimeFrameIndex of each entry      |
+ * | `entity_ids` | uint64  | n_entries         | EntityId of each entry            |
+ * | `offsets`    | int64   | n_entries + 1     | entry *i* owns `x[offsets[i]:offsets[i+1]]` |
+ * | `x`, `y`     | float32 / uint32 | n_points | flattened coordinates             |
+ *
+ * PointData has exactly one point per entry, so it omits `offsets`.
+ *
+ * Export is zero-copy wherever the owning storage is already contiguous
+ * (times, entity ids, and the x/y fields of PointData); ragged geometry
+ * (masks, lines) is flattened with a single bulk copy. Zero-copy arrays are
+ * read-only views that stay valid only until the container is modified.
+ *
+ * Import builds the whole container in one C++ call and notifies observers
+ * once at the end.
+ */
+
+#include "numpy_utils.hpp"
+
+#include "CoreGeometry/points.hpp"
+#include "Entity/EntityId.hpp"
+#include "Observer/Observer_Data.hpp"
+#include "RaggedTimeSeries/RaggedTimeSeries.hpp"
+#include "TimeFrame/TimeFrameIndex.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace wt::python {
+
+// Zero-copy views reinterpret the SoA arrays of the owning storage.
+static_assert(sizeof(TimeFrameIndex) == sizeof(int64_t) && std::is_standard_layout_v<TimeFrameIndex>,
+              "TimeFrameIndex must be layout-compatible with int64_t for zero-copy export");
+static_assert(sizeof(EntityId) == sizeof(uint64_t) && std::is_standard_layout_v<EntityId>,
+              "EntityId must be layout-compatible with uint64_t for zero-copy export");
+static_assert(sizeof(Point2D<float>) == 2 * sizeof(float),
+              "Point2D<float> must be tightly packed for strided zero-copy export");
+
+namespace detail {
+
+/**
+ * @brief Fill the `times` and `entity_ids` entries of a columnar dict.
+ *
+ * Views the owning storage directly when contiguous; otherwise copies once.
+ */
+template<typename TData>
+void add_time_and_id_columns(py::dict & out,
+                             RaggedTimeSeries<TData> const & self,
+                             py::handle owner) {
+    auto const & cache = self.getStorageCache();
+    if (cache.isValid()) {
+        auto const n = cache.cache_size;
+        out["times"] = span_to_numpy_readonly(
+                std::span<int64_t const>(reinterpret_cast<int64_t const *>(cache.times_ptr), n), owner);
+        out["entity_ids"] = span_to_numpy_readonly(
+                std::span<uint64_t const>(reinterpret_cast<uint64_t const *>(cache.entity_ids_ptr), n), owner);
+        return;
+    }
+
+    auto const n = self.getTotalEntryCount();
+    std::vector<int64_t> times;
+    std::vector<uint64_t> ids;
+    times.reserve(n);
+    ids.reserve(n);
+    for (auto const elem: self.elementsView()) {
+        times.push_back(elem.time().getValue());
+        ids.push_back(elem.id().id);
+    }
+    out["times"] = vector_to_numpy(std::move(times));
+    out["entity_ids"] = vector_to_numpy(std::move(ids));
+}
+
+/**
+ * @brief Validate that all columnar input arrays agree in length.
+ */
+inline void check_columnar_sizes(std::size_t n_times,
+                                 std::span<int64_t const> offsets,
+                                 std::size_t n_x,
+                                 std::size_t n_y) {
+    if (n_x != n_y) {
+        throw std::invalid_argument("x and y must have the same length (got " +
+                                    std::to_string(n_x) + " and " + std::to_string(n_y) + ")");
+    }
+    if (offsets.size() != n_times + 1) {
+        throw std::invalid_argument("offsets must have length len(times) + 1 (got " +
+                                    std::to_string(offsets.size()) + ", expected " +
+                                    std::to_string(n_times + 1) + ")");
+    }
+    if (offsets.front() != 0 || static_cast<std::size_t>(offsets.back()) != n_x) {
+        throw std::invalid_argument("offsets must start at 0 and end at len(x)");
+    }
+    for (std::size_t i = 1; i < offsets.size(); ++i) {
+        if (offsets[i] < offsets[i - 1]) {
+            throw std::invalid_argument("offsets must be non-decreasing");
+        }
+    }
+}
+
+/**
+ * @brief Append entries to @p target one time-run at a time.
+ *
+ * Consecutive entries sharing a time are grouped into a single
+ * `addAtTime(time, std::vector&&)` call; @p make_entry builds entry *i*.
+ * Observers are notified once after everything has been added.
+ */
+template<typename TData, typename MakeEntry>
+void append_time_runs(RaggedTimeSeries<TData> & target,
+                      std::span<int64_t const> times,
+                      MakeEntry && make_entry) {
+    std::vector<TData> batch;
+    std::size_t i = 0;
+    while (i < times.size()) {
+        auto const t = times[i];
+        batch.clear();
+        for (; i < times.size() && times[i] == t; ++i) {
+            batch.push_back(make_entry(i));
+        }
+        target.addAtTime(TimeFrameIndex(t), std::move(batch), NotifyObservers::No);
+    }
+    if (!times.empty()) {
+        target.notifyObservers();
+    }
+}
+
+}// namespace detail
+
+/**
+ * @brief Export a Mask/Line-style ragged series as columnar NumPy arrays.
+ *
+ * @tparam TData  Geometry type iterable over `Point2D<Coord>` (Mask2D, Line2D).
+ * @tparam Coord  Coordinate type of the flattened x/y arrays.
+ */
+template<typename TData, typename Coord>
+py::dict ragged_geometry_to_columns(RaggedTimeSeries<TData> const & self,
+                                    py::handle owner) {
+    py::dict out;
+    detail::add_time_and_id_columns(out, self, owner);
+
+    auto const n = self.getTotalEntryCount();
+    std::vector<int64_t> offsets;
+    offsets.reserve(n + 1);
+    offsets.push_back(0);
+    for (auto const elem: self.elementsView()) {
+        offsets.push_back(offsets.back() + static_cast<int64_t>(elem.data().size()));
+    }
+
+    auto const n_points = static_cast<std::size_t>(offsets.back());
+    std::vector<Coord> xs(n_points);
+    std::vector<Coord> ys(n_points);
+    std::size_t k = 0;
+    for (auto const elem: self.elementsView()) {
+        for (auto const & p: elem.data()) {
+            xs[k] = p.x;
+            ys[k] = p.y;
+            ++k;
+        }
+    }
+
+    out["offsets"] = vector_to_numpy(std::move(offsets));
+    out["x"] = vector_to_numpy(std::move(xs));
+    out["y"] = vector_to_numpy(std::move(ys));
+    return out;
+}
+
+/**
+ * @brief Append columnar arrays to a Mask/Line-style ragged series.
+ *
+ * Entry *i* is built from `x[offsets[i]:offsets[i+1]]`, `y[...]` and added
+ * at `times[i]`. Entity ids are assigned by the container as usual.
+ */
+template<typename TData, typename Coord>
+void columns_to_ragged_geometry(RaggedTimeSeries<TData> & target,
+                                std::span<int64_t const> times,
+                                std::span<int64_t const> offsets,
+                                std::span<Coord const> xs,
+                                std::span<Coord const> ys) {
+    detail::check_columnar_sizes(times.size(), offsets, xs.size(), ys.size());
+
+    detail::append_time_runs(target, times, [&](std::size_t i) {
+        auto const begin = static_cast<std::size_t>(offsets[i]);
+        auto const end = static_cast<std::size_t>(offsets[i + 1]);
+        std::vector<Point2D<Coord>> pts;
+        pts.reserve(end - begin);
+        for (std::size_t j = begin; j < end; ++j) {
+            pts.emplace_back(xs[j], ys[j]);
+        }
+        return TData(std::move(pts));
+    });
+}
+
+/**
+ * @brief Export a PointData-style series (one point per entry) as columns.
+ *
+ * When the storage is contiguous, `x` and `y` are strided read-only views
+ * into the interleaved `Point2D<float>` buffer.
+ */
+inline py::dict point_series_to_columns(RaggedTimeSeries<Point2D<float>> const & self,
+                                        py::handle owner) {
+    py::dict out;
+    detail::add_time_and_id_columns(out, self, owner);
+
+    auto const & cache = self.getStorageCache();
+    if (cache.isValid()) {
+        auto const n = cache.cache_size;
+        auto const * first = cache.data_ptr;
+        out["x"] = strided_to_numpy_readonly(n ? &first->x : nullptr, n, sizeof(Point2D<float>), owner);
+        out["y"] = strided_to_numpy_readonly(n ? &first->y : nullptr, n, sizeof(Point2D<float>), owner);
+        return out;
+    }
+
+    std::vector<float> xs;
+    std::vector<float> ys;
+    xs.reserve(self.getTotalEntryCount());
+    ys.reserve(self.getTotalEntryCount());
+    for (auto const elem: self.elementsView()) {
+        xs.push_back(elem.data().x);
+        ys.push_back(elem.data().y);
+    }
+    out["x"] = vector_to_numpy(std::move(xs));
+    out["y"] = vector_to_numpy(std::move(ys));
+    return out;
+}
+
+/**
+ * @brief Append one point per entry from columnar arrays.
+ */
+inline void columns_to_point_series(RaggedTimeSeries<Point2D<float>> & target,
+                                    std::span<int64_t const> times,
+                                    std::span<float const> xs,
+                                    std::span<float const> ys) {
+    if (xs.size() != times.size() || ys.size() != times.size()) {
+        throw std::invalid_argument("times, x and y must have the same length");
+    }
+    detail::append_time_runs(target, times, [&](std::size_t i) {
+        return Point2D<float>(xs[i], ys[i]);
+    });
+}
+
+}// namespace wt::python
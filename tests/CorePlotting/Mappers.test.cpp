@@ -440,6 +440,41 @@ TEST_CASE("RasterMapper::mapEventsInWindow", "[Mappers][RasterMapper]") {
     }
 }
 
+TEST_CASE("RasterMapper::mapFlatTrialsInWindow", "[Mappers][RasterMapper]") {
+    // Two trials in CSR layout, times already relative to each trial's reference
+    std::vector<std::size_t> const offsets{0, 4, 6};
+    std::vector<int64_t> const relative_times{-40, -10, 0, 35, -5, 20};
+    std::vector<EntityId> const ids{EntityId(1), EntityId(2), EntityId(3),
+                                    EntityId(4), EntityId(5), EntityId(6)};
+
+    auto const row0 = createLayout(0.5f, 0.1f);
+    auto const row1 = createLayout(-0.5f, 0.1f);
+
+    SECTION("Keeps events inside [-before, after] per trial") {
+        std::vector<SeriesLayout const *> const layouts{&row0, &row1};
+        auto const mapped = RasterMapper::mapFlatTrialsInWindow(
+                offsets, relative_times, ids, layouts, 30, 20);
+
+        REQUIRE(mapped.size() == 4);
+        REQUIRE(mapped[0].x == -10.0f);
+        REQUIRE(mapped[0].y == 0.5f);
+        REQUIRE(mapped[0].entity_id == EntityId(2));
+        REQUIRE(mapped[1].x == 0.0f);
+        REQUIRE(mapped[2].x == -5.0f);
+        REQUIRE(mapped[2].y == -0.5f);
+        REQUIRE(mapped[3].x == 20.0f);// window end is inclusive
+    }
+
+    SECTION("Skips trials without a layout") {
+        std::vector<SeriesLayout const *> const layouts{nullptr, &row1};
+        auto const mapped = RasterMapper::mapFlatTrialsInWindow(
+                offsets, relative_times, ids, layouts, 100, 100);
+
+        REQUIRE(mapped.size() == 2);
+        REQUIRE(mapped[0].entity_id == EntityId(5));
+    }
+}
+
 TEST_CASE("RasterMapper::computeRowYCenter", "[Mappers][RasterMapper]") {
     SECTION("Single row") {
         float const y = RasterMapper::computeRowYCenter(0, 1, -1.0f, 1.0f);
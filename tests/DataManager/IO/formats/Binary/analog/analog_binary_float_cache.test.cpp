@@ -0,0 +1,280 @@
+/**
+ * @file analog_binary_float_cache.test.cpp
+ * @brief Tests for direct float decoding and the channel-major float cache
+ *
+ * Tests the following:
+ * 1. In-memory multi-channel int16/uint16 decoding matches the raw samples
+ * 2. Memory-mapped channels share one time storage
+ * 3. float_cache_path produces the same (scaled) values as strided mapping
+ * 4. A valid cache is reused; a changed source invalidates it
+ * 5. offset/stride select the same samples with and without the cache
+ * 6. Deinterleave kernel converts unaligned, scaled samples
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "IO/formats/Binary/analogtimeseries/Analog_Float_Cache.hpp"
+#include "IO/formats/Binary/analogtimeseries/Analog_Time_Series_Binary.hpp"
+#include "IO/formats/Binary/common/binary_deinterleave.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class TempFloatCacheTestDirectory {
+public:
+    TempFloatCacheTestDirectory() {
+        temp_path = std::filesystem::temp_directory_path() /
+                    ("whiskertoolbox_float_cache_test_" + std::to_string(std::time(nullptr)));
+        std::filesystem::create_directories(temp_path);
+    }
+
+    ~TempFloatCacheTestDirectory() {
+        if (std::filesystem::exists(temp_path)) {
+            std::filesystem::remove_all(temp_path);
+        }
+    }
+
+    [[nodiscard]] std::filesystem::path getFilePath(std::string const & filename) const {
+        return temp_path / filename;
+    }
+
+private:
+    std::filesystem::path temp_path;
+};
+
+namespace {
+
+/// Interleaved recording where channel c, sample i holds `c * 1000 + i - 500`
+template<typename T>
+std::vector<T> makeInterleaved(std::size_t num_channels, std::size_t num_samples) {
+    std::vector<T> data(num_channels * num_samples);
+    for (std::size_t i = 0; i < num_samples; ++i) {
+        for (std::size_t c = 0; c < num_channels; ++c) {
+            auto const v = static_cast<int64_t>(c * 1000 + i) - (std::is_signed_v<T> ? 500 : 0);
+            data[i * num_channels + c] = static_cast<T>(v);
+        }
+    }
+    return data;
+}
+
+template<typename T>
+void writeRaw(std::filesystem::path const & path, std::vector<T> const & data, std::size_t header_bytes = 0) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    std::vector<char> const header(header_bytes, '\0');
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    out.write(reinterpret_cast<char const *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(T)));
+}
+
+std::vector<float> channelValues(AnalogTimeSeries const & series) {
+    std::vector<float> values;
+    for (auto const & sample: series.getAllSamples()) {
+        values.push_back(sample.value());
+    }
+    return values;
+}
+
+}// namespace
+
+TEST_CASE("Binary analog - in-memory multi-channel decodes without typed copy",
+          "[analog][binary][float_cache]") {
+
+    TempFloatCacheTestDirectory const temp_dir;
+    std::size_t const num_channels = 3;
+    std::size_t const num_samples = 5000;
+
+    SECTION("int16 with header") {
+        auto const raw = makeInterleaved<int16_t>(num_channels, num_samples);
+        auto const path = temp_dir.getFilePath("int16.bin");
+        writeRaw(path, raw, 7);
+
+        BinaryAnalogLoaderOptions opts;
+        opts.filepath = path.string();
+        opts.num_channels = static_cast<int>(num_channels);
+        opts.header_size = 7;
+        opts.binary_data_type = "int16";
+
+        auto series = load(opts);
+        REQUIRE(series.size() == num_channels);
+        for (std::size_t c = 0; c < num_channels; ++c) {
+            auto const values = channelValues(*series[c]);
+            REQUIRE(values.size() == num_samples);
+            for (std::size_t i = 0; i < num_samples; i += 97) {
+                REQUIRE(values[i] == static_cast<float>(raw[i * num_channels + c]));
+            }
+        }
+    }
+
+    SECTION("uint16 tensor-backed") {
+        auto const raw = makeInterleaved<uint16_t>(num_channels, num_samples);
+        auto const path = temp_dir.getFilePath("uint16.bin");
+        writeRaw(path, raw);
+
+        BinaryAnalogLoaderOptions opts;
+        opts.filepath = path.string();
+        opts.num_channels = static_cast<int>(num_channels);
+        opts.binary_data_type = "uint16";
+        opts.use_tensor_backed = true;
+
+        auto result = loadTensorBacked(opts);
+        REQUIRE(result.tensor != nullptr);
+        REQUIRE(result.channels.size() == num_channels);
+        auto const last = channelValues(*result.channels[num_channels - 1]);
+        REQUIRE(last.size() == num_samples);
+        REQUIRE(last.back() == static_cast<float>(raw.back()));
+    }
+}
+
+TEST_CASE("Binary analog - memory-mapped channels share time storage",
+          "[analog][binary][float_cache][mmap]") {
+
+    TempFloatCacheTestDirectory const temp_dir;
+    auto const path = temp_dir.getFilePath("shared_time.bin");
+    writeRaw(path, makeInterleaved<int16_t>(4, 1000));
+
+    BinaryAnalogLoaderOptions opts;
+    opts.filepath = path.string();
+    opts.num_channels = 4;
+    opts.use_memory_mapped = true;
+
+    auto series = load(opts);
+    REQUIRE(series.size() == 4);
+    for (auto const & s: series) {
+        REQUIRE(s->getNumSamples() == 1000);
+        REQUIRE(s->getTimeStorage() == series[0]->getTimeStorage());
+    }
+}
+
+TEST_CASE("Binary analog - float cache matches strided mapping",
+          "[analog][binary][float_cache][mmap]") {
+
+    TempFloatCacheTestDirectory const temp_dir;
+    std::size_t const num_channels = 5;
+    std::size_t const num_samples = 3001;
+    auto const path = temp_dir.getFilePath("cached.bin");
+    auto const cache_path = temp_dir.getFilePath("cached.f32cache");
+    writeRaw(path, makeInterleaved<int16_t>(num_channels, num_samples), 16);
+
+    BinaryAnalogLoaderOptions opts;
+    opts.filepath = path.string();
+    opts.num_channels = static_cast<int>(num_channels);
+    opts.header_size = 16;
+    opts.use_memory_mapped = true;
+    opts.scale_factor = 0.195f;
+    opts.offset_value = -3.0f;
+
+    auto strided = load(opts);
+
+    opts.float_cache_path = cache_path.string();
+    auto cached = load(opts);
+
+    REQUIRE(std::filesystem::exists(cache_path));
+    REQUIRE(cached.size() == num_channels);
+    for (std::size_t c = 0; c < num_channels; ++c) {
+        REQUIRE(channelValues(*cached[c]) == channelValues(*strided[c]));
+    }
+
+    SECTION("Cache is reused while the source is unchanged") {
+        AnalogFloatCacheSource const source{.file_path = path,
+                                            .header_size = 16,
+                                            .num_channels = num_channels,
+                                            .data_type = MmapDataType::Int16,
+                                            .scale_factor = 0.195f,
+                                            .offset_value = -3.0f};
+        REQUIRE(validAnalogFloatCache(cache_path, source) == num_samples);
+
+        auto const before = std::filesystem::last_write_time(cache_path);
+        auto again = load(opts);
+        REQUIRE(again.size() == num_channels);
+        REQUIRE(std::filesystem::last_write_time(cache_path) == before);
+
+        auto rescaled = source;
+        rescaled.scale_factor = 1.0f;
+        REQUIRE_FALSE(validAnalogFloatCache(cache_path, rescaled).has_value());
+    }
+
+    SECTION("Changed source rebuilds the cache") {
+        // Release the mappings so the files can be replaced on every platform
+        strided.clear();
+        cached.clear();
+
+        auto const shorter = makeInterleaved<int16_t>(num_channels, 100);
+        writeRaw(path, shorter, 16);
+
+        auto rebuilt = load(opts);
+        REQUIRE(rebuilt.size() == num_channels);
+        auto const values = channelValues(*rebuilt[2]);
+        REQUIRE(values.size() == 100);
+        REQUIRE(values[10] == static_cast<float>(shorter[10 * num_channels + 2]) * 0.195f - 3.0f);
+    }
+}
+
+TEST_CASE("Binary analog - float cache honours offset and stride",
+          "[analog][binary][float_cache][mmap]") {
+
+    TempFloatCacheTestDirectory const temp_dir;
+    std::size_t const num_channels = 4;
+    std::size_t const num_samples = 1000;
+    auto const path = temp_dir.getFilePath("offset_stride.bin");
+    auto const cache_path = temp_dir.getFilePath("offset_stride.f32cache");
+    auto const raw = makeInterleaved<int16_t>(num_channels, num_samples);
+    writeRaw(path, raw);
+
+    BinaryAnalogLoaderOptions opts;
+    opts.filepath = path.string();
+    opts.num_channels = static_cast<int>(num_channels);
+    opts.use_memory_mapped = true;
+    opts.stride = static_cast<std::size_t>(3);
+
+    SECTION("Offset on a sample boundary maps onto the cache") {
+        opts.offset = static_cast<std::size_t>(7 * num_channels);
+
+        auto strided = load(opts);
+        opts.float_cache_path = cache_path.string();
+        auto cached = load(opts);
+
+        REQUIRE(std::filesystem::exists(cache_path));
+        REQUIRE(cached.size() == num_channels);
+        for (std::size_t c = 0; c < num_channels; ++c) {
+            auto const values = channelValues(*cached[c]);
+            REQUIRE(values == channelValues(*strided[c]));
+            REQUIRE(values.size() == (num_samples - 7 + 2) / 3);
+            REQUIRE(values[1] == static_cast<float>(raw[(7 + 3) * num_channels + c]));
+        }
+    }
+
+    SECTION("Offset inside a sample falls back to strided mapping") {
+        opts.offset = static_cast<std::size_t>(7 * num_channels + 1);
+
+        auto strided = load(opts);
+        opts.float_cache_path = cache_path.string();
+        auto cached = load(opts);
+
+        REQUIRE(cached.size() == num_channels);
+        for (std::size_t c = 0; c < num_channels; ++c) {
+            REQUIRE(channelValues(*cached[c]) == channelValues(*strided[c]));
+        }
+    }
+}
+
+TEST_CASE("Binary analog - deinterleave kernel", "[analog][binary][float_cache][unit]") {
+
+    // Three int16 channels behind a 1-byte offset, so every sample is unaligned
+    std::vector<int16_t> const samples = {1, -2, 3, 4, -5, 6};
+    std::vector<std::byte> buffer(1 + samples.size() * sizeof(int16_t));
+    std::memcpy(buffer.data() + 1, samples.data(), samples.size() * sizeof(int16_t));
+
+    std::vector<float> out(2);
+    Loader::deinterleaveChannelToFloat(MmapDataType::Int16, buffer.data() + 1, 2, 3, 1, out.data(), 2.0f, 1.0f);
+    REQUIRE(out[0] == -3.0f);
+    REQUIRE(out[1] == -9.0f);
+
+    Loader::deinterleaveChannelToFloat(MmapDataType::Int16, buffer.data() + 1, 2, 3, 2, out.data(), 1.0f, 0.0f);
+    REQUIRE(out[0] == 3.0f);
+    REQUIRE(out[1] == 6.0f);
+}
@@ -0,0 +1,400 @@
+/**
+ * @file native_roundtrip.test.cpp
+ * @brief Round-trip tests for the memory-mapped native chunked format
+ *
+ * Each data type is saved through NativeFormatLoader, loaded back, and
+ * compared. Ragged series and tensors must come back backed by the file
+ * mapping (lazy / MemoryMapped storage) rather than copied into memory.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "IO/formats/Native/NativeFormatLoader.hpp"
+#include "IO/formats/Native/common/NativeChunkedFile.hpp"
+
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "DigitalTimeSeries/Digital_Interval_Series.hpp"
+#include "Entity/EntityRegistry.hpp"
+#include "Lines/Line_Data.hpp"
+#include "Masks/Mask_Data.hpp"
+#include "Points/Point_Data.hpp"
+#include "Tensors/TensorData.hpp"
+#include "Tensors/storage/MmapTensorStorage.hpp"
+#include "TimeFrame/TimeIndexStorage.hpp"
+#include "TimeFrame/interval_data.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+class NativeFormatTestFixture {
+public:
+    NativeFormatTestFixture() {
+        test_dir = std::filesystem::current_path() / "test_native_format_output";
+        std::filesystem::create_directories(test_dir);
+    }
+
+    ~NativeFormatTestFixture() {
+        try {
+            if (std::filesystem::exists(test_dir)) {
+                std::filesystem::remove_all(test_dir);
+            }
+        } catch (...) {}
+    }
+
+protected:
+    std::filesystem::path test_dir;
+    NativeFormatLoader loader;
+
+    template<typename T>
+    std::shared_ptr<T> roundTrip(std::string const & name, DM_DataType type, T const & data,
+                                 nlohmann::json config = nlohmann::json::object()) {
+        auto const path = (test_dir / name).string();
+        auto const saved = loader.save(path, type, config, &data);
+        REQUIRE(saved.success);
+        auto loaded = loader.load(path, type, nlohmann::json::object());
+        REQUIRE(loaded.success);
+        return std::get<std::shared_ptr<T>>(loaded.data);
+    }
+};
+
+template<std::ranges::input_range R>
+auto collect(R && range) {
+    std::vector<std::ranges::range_value_t<R>> out;
+    for (auto const & value: range) {
+        out.push_back(value);
+    }
+    return out;
+}
+
+}// anonymous namespace
+
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native format round-trips points as lazy mapped storage",
+                 "[native][points][roundtrip]") {
+    PointData original;
+    original.setImageSize(ImageSize{640, 480});
+    original.addAtTime(TimeFrameIndex(20), Point2D<float>{5.0f, 6.0f}, NotifyObservers::No);
+    original.addAtTime(TimeFrameIndex(10), Point2D<float>{1.0f, 2.0f}, NotifyObservers::No);
+    original.addAtTime(TimeFrameIndex(10), Point2D<float>{3.0f, 4.0f}, NotifyObservers::No);
+
+    auto loaded = roundTrip("points.wtn", DM_DataType::Points, original);
+
+    CHECK(loaded->isLazy());
+    CHECK(loaded->getImageSize() == ImageSize{640, 480});
+    REQUIRE(loaded->getTotalEntryCount() == 3);
+
+    auto at_10 = collect(loaded->getAtTime(TimeFrameIndex(10)));
+    REQUIRE(at_10.size() == 2);
+    CHECK(at_10[0].x == 1.0f);
+    CHECK(at_10[0].y == 2.0f);
+    CHECK(at_10[1].x == 3.0f);
+    CHECK(at_10[1].y == 4.0f);
+
+    auto at_20 = collect(loaded->getAtTime(TimeFrameIndex(20)));
+    REQUIRE(at_20.size() == 1);
+    CHECK(at_20[0].x == 5.0f);
+}
+
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native format round-trips ragged lines and masks",
+                 "[native][lines][masks][roundtrip]") {
+    SECTION("lines") {
+        LineData original;
+        original.addAtTime(TimeFrameIndex(3), Line2D({Point2D<float>{0.5f, 1.5f}, Point2D<float>{2.5f, 3.5f}}),
+                           NotifyObservers::No);
+        original.addAtTime(TimeFrameIndex(7), Line2D(), NotifyObservers::No);
+        original.addAtTime(TimeFrameIndex(7), Line2D({Point2D<float>{9.0f, 8.0f}}), NotifyObservers::No);
+
+        auto loaded = roundTrip("lines.wtn", DM_DataType::Line, original);
+        CHECK(loaded->isLazy());
+
+        auto at_3 = collect(loaded->getAtTime(TimeFrameIndex(3)));
+        REQUIRE(at_3.size() == 1);
+        REQUIRE(at_3[0].size() == 2);
+        CHECK(at_3[0][1].x == 2.5f);
+        CHECK(at_3[0][1].y == 3.5f);
+
+        auto at_7 = collect(loaded->getAtTime(TimeFrameIndex(7)));
+        REQUIRE(at_7.size() == 2);
+        CHECK(at_7[0].size() == 0);
+        REQUIRE(at_7[1].size() == 1);
+        CHECK(at_7[1][0].x == 9.0f);
+    }
+
+    SECTION("masks") {
+        MaskData original;
+        original.setImageSize(ImageSize{32, 16});
+        original.addAtTime(TimeFrameIndex(1),
+                           Mask2D({Point2D<uint32_t>{1, 2}, Point2D<uint32_t>{3, 4}, Point2D<uint32_t>{5, 6}}),
+                           NotifyObservers::No);
+
+        auto loaded = roundTrip("masks.wtn", DM_DataType::Mask, original);
+        CHECK(loaded->isLazy());
+        CHECK(loaded->getImageSize() == ImageSize{32, 16});
+
+        auto at_1 = collect(loaded->getAtTime(TimeFrameIndex(1)));
+        REQUIRE(at_1.size() == 1);
+        REQUIRE(at_1[0].size() == 3);
+        CHECK(at_1[0][2].x == 5);
+        CHECK(at_1[0][2].y == 6);
+    }
+}
+
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native ragged series keep lazy storage when EntityIds are rebuilt",
+                 "[native][points][entity]") {
+    PointData original;
+    original.addAtTime(TimeFrameIndex(0), Point2D<float>{1.0f, 1.0f}, NotifyObservers::No);
+    original.addAtTime(TimeFrameIndex(0), Point2D<float>{2.0f, 2.0f}, NotifyObservers::No);
+    original.addAtTime(TimeFrameIndex(4), Point2D<float>{3.0f, 3.0f}, NotifyObservers::No);
+
+    auto loaded = roundTrip("points_ids.wtn", DM_DataType::Points, original);
+
+    EntityRegistry registry;
+    loaded->setIdentityContext("points", &registry);
+    loaded->rebuildAllEntityIds();
+
+    CHECK(loaded->isLazy());
+    auto ids = collect(loaded->getEntityIdsAtTime(TimeFrameIndex(0)));
+    REQUIRE(ids.size() == 2);
+    CHECK(ids[0] != ids[1]);
+    CHECK(ids[0] == registry.ensureId("points", EntityKind::PointEntity, TimeFrameIndex(0), 0));
+
+    auto point = loaded->getDataByEntityId(ids[1]);
+    REQUIRE(point.has_value());
+    CHECK(point->get().x == 2.0f);
+
+    SECTION("rebuilding again replaces the ids") {
+        EntityRegistry other;
+        other.ensureId("unrelated", EntityKind::PointEntity, TimeFrameIndex(0), 0);
+        loaded->setIdentityContext("points", &other);
+        loaded->rebuildAllEntityIds();
+
+        CHECK(loaded->isLazy());
+        auto rebuilt = collect(loaded->getEntityIdsAtTime(TimeFrameIndex(4)));
+        REQUIRE(rebuilt.size() == 1);
+        CHECK(rebuilt[0] == other.ensureId("points", EntityKind::PointEntity, TimeFrameIndex(4), 0));
+
+        auto moved = loaded->getDataByEntityId(rebuilt[0]);
+        REQUIRE(moved.has_value());
+        CHECK(moved->get().x == 3.0f);
+    }
+}
+
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native format round-trips digital events and intervals",
+                 "[native][digital][roundtrip]") {
+    SECTION("events") {
+        DigitalEventSeries original(std::vector<TimeFrameIndex>{TimeFrameIndex(30), TimeFrameIndex(2), TimeFrameIndex(11)});
+
+        auto loaded = roundTrip("events.wtn", DM_DataType::DigitalEvent, original);
+        REQUIRE(loaded->size() == 3);
+        CHECK(loaded->getStoredEvent(0) == TimeFrameIndex(2));
+        CHECK(loaded->getStoredEvent(1) == TimeFrameIndex(11));
+        CHECK(loaded->getStoredEvent(2) == TimeFrameIndex(30));
+    }
+
+    SECTION("intervals") {
+        DigitalIntervalSeries original(std::vector<TimeFrameInterval>{
+                {TimeFrameIndex(10), TimeFrameIndex(15)},
+                {TimeFrameIndex(0), TimeFrameIndex(4)}});
+
+        auto loaded = roundTrip("intervals.wtn", DM_DataType::DigitalInterval, original);
+        REQUIRE(loaded->size() == 2);
+        CHECK(loaded->getStoredInterval(0).start == TimeFrameIndex(0));
+        CHECK(loaded->getStoredInterval(0).end == TimeFrameIndex(4));
+        CHECK(loaded->getStoredInterval(1).start == TimeFrameIndex(10));
+        CHECK(loaded->getStoredInterval(1).end == TimeFrameIndex(15));
+    }
+}
+
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native format maps tensors without copying",
+                 "[native][tensor][roundtrip]") {
+    std::vector<float> const data = {1.0f, 2.0f, 3.0f,
+                                     4.0f, 5.0f, 6.0f};
+
+    SECTION("ordinal rows keep column names") {
+        auto original = TensorData::createOrdinal2D(data, 2, 3, {"a", "b", "c"});
+        auto loaded = roundTrip("tensor_ordinal.wtn", DM_DataType::Tensor, original);
+
+        CHECK(loaded->storage().getStorageType() == TensorStorageType::Mapped);
+        // Must not be mistaken for the block-cached interleaved storage
+        CHECK(loaded->storage().getAsChecked<MmapTensorStorage>(TensorStorageType::MemoryMapped) == nullptr);
+        CHECK(loaded->isContiguous());
+        REQUIRE(loaded->numRows() == 2);
+        REQUIRE(loaded->numColumns() == 3);
+        CHECK(loaded->row(1) == std::vector<float>{4.0f, 5.0f, 6.0f});
+        CHECK(loaded->columnNames() == std::vector<std::string>{"a", "b", "c"});
+        auto const flat = loaded->flatData();
+        CHECK(std::vector<float>(flat.begin(), flat.end()) == data);
+    }
+
+    SECTION("time rows keep their order") {
+        auto time_storage = TimeIndexStorageFactory::createFromTimeIndices(
+                std::vector<TimeFrameIndex>{TimeFrameIndex(50), TimeFrameIndex(20)});
+        auto original = TensorData::createTimeSeries2D(data, 2, 3, std::move(time_storage), nullptr, {});
+        auto loaded = roundTrip("tensor_time.wtn", DM_DataType::Tensor, original);
+
+        REQUIRE(loaded->rows().type() == RowType::TimeFrameIndex);
+        CHECK(loaded->rows().timeStorage().getTimeFrameIndexAt(0) == TimeFrameIndex(50));
+        CHECK(loaded->rows().timeStorage().getTimeFrameIndexAt(1) == TimeFrameIndex(20));
+        CHECK(loaded->row(0) == std::vector<float>{1.0f, 2.0f, 3.0f});
+    }
+
+    SECTION("interval rows") {
+        auto original = TensorData::createFromIntervals(
+                data, 2, 3,
+                {{TimeFrameIndex(0), TimeFrameIndex(9)}, {TimeFrameIndex(10), TimeFrameIndex(19)}},
+                nullptr, {});
+        auto loaded = roundTrip("tensor_interval.wtn", DM_DataType::Tensor, original);
+
+        REQUIRE(loaded->rows().type() == RowType::Interval);
+        auto const intervals = loaded->rows().intervals();
+        REQUIRE(intervals.size() == 2);
+        CHECK(intervals[1].start == TimeFrameIndex(10));
+        CHECK(intervals[1].end == TimeFrameIndex(19));
+    }
+}
+
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native chunk table locates time ranges",
+                 "[native][chunks]") {
+    DigitalEventSeries original(std::vector<TimeFrameIndex>{
+            TimeFrameIndex(0), TimeFrameIndex(5), TimeFrameIndex(10), TimeFrameIndex(15),
+            TimeFrameIndex(20), TimeFrameIndex(25), TimeFrameIndex(30)});
+    auto const path = test_dir / "chunked_events.wtn";
+    REQUIRE(loader.save(path.string(), DM_DataType::DigitalEvent, {{"chunk_records", 2}}, &original).success);
+
+    auto const file = NativeFormat::NativeChunkedReader::open(path);
+    REQUIRE(file->timesSorted());
+    REQUIRE(file->chunks().size() == 4);
+    CHECK(file->chunks()[1].min_time == 10);
+    CHECK(file->chunks()[1].max_time == 15);
+    CHECK(file->chunks()[3].record_count == 1);
+
+    CHECK(file->recordRange(5, 20) == std::pair<std::size_t, std::size_t>{1, 5});
+    auto const gap = file->recordRange(6, 9);
+    CHECK(gap.first == gap.second);
+    auto const past_end = file->recordRange(31, 40);
+    CHECK(past_end.first == past_end.second);
+}
+
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native loader rejects mismatched and corrupt files",
+                 "[native][error]") {
+    DigitalEventSeries events(std::vector<TimeFrameIndex>{TimeFrameIndex(1)});
+    auto const path = test_dir / "events_only.wtn";
+    REQUIRE(loader.save(path.string(), DM_DataType::DigitalEvent, {}, &events).success);
+
+    SECTION("wrong data type") {
+        auto result = loader.load(path.string(), DM_DataType::Points, {});
+        CHECK_FALSE(result.success);
+    }
+
+    SECTION("not a native file") {
+        auto const bogus = test_dir / "bogus.wtn";
+        std::ofstream(bogus) << "frame,x,y\n1,2,3\n";
+        auto result = loader.load(bogus.string(), DM_DataType::DigitalEvent, {});
+        CHECK_FALSE(result.success);
+    }
+
+    SECTION("truncated file") {
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+        auto result = loader.load(path.string(), DM_DataType::DigitalEvent, {});
+        CHECK_FALSE(result.success);
+    }
+}
+
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native reader validates every chunk and extent",
+                 "[native][error]") {
+    std::vector<std::int64_t> const times{10, 11, 12};
+    std::vector<std::uint64_t> const extents{0, 2, 4, 6};
+    std::vector<float> const payload(12, 1.0f);
+
+    NativeFormat::NativeColumns columns;
+    columns.kind = NativeFormat::RecordKind::Lines;
+    columns.payload_type = NativeFormat::PayloadType::Float32;
+    columns.payload_components = 2;
+    columns.times = times;
+    columns.extents = extents;
+    columns.payload = std::as_bytes(std::span(payload));
+    columns.payload_elements = 6;
+    columns.chunk_records = 1;
+
+    std::ostringstream out;
+    REQUIRE(NativeFormat::writeNativeChunked(out, columns));
+    std::string const bytes = out.str();
+
+    auto const path = test_dir / "corrupt_middle.wtn";
+    auto const write_with = [&](auto const & original, auto const & patched) {
+        std::string data = bytes;
+        std::string_view const needle(reinterpret_cast<char const *>(&original), sizeof(original));
+        auto const pos = data.find(needle);
+        REQUIRE(pos != std::string::npos);
+        std::memcpy(data.data() + pos, &patched, sizeof(patched));
+        std::ofstream(path, std::ios::binary) << data;
+    };
+
+    SECTION("intact file opens") {
+        std::ofstream(path, std::ios::binary) << bytes;
+        CHECK(NativeFormat::NativeChunkedReader::open(path)->chunks().size() == 3);
+    }
+
+    SECTION("middle extent past the payload") {
+        std::array<std::uint64_t, 4> const original{0, 2, 4, 6};
+        std::array<std::uint64_t, 4> const patched{0, 2, 1000, 6};
+        write_with(original, patched);
+        CHECK_THROWS_AS(NativeFormat::NativeChunkedReader::open(path), std::runtime_error);
+    }
+
+    SECTION("middle chunk past the record count") {
+        NativeFormat::NativeChunkEntry const original{11, 11, 1, 1};
+        NativeFormat::NativeChunkEntry const patched{11, 11, 1, 5};
+        write_with(original, patched);
+        CHECK_THROWS_AS(NativeFormat::NativeChunkedReader::open(path), std::runtime_error);
+    }
+
+    SECTION("middle chunk bounds that disagree with the times") {
+        NativeFormat::NativeChunkEntry const original{11, 11, 1, 1};
+        NativeFormat::NativeChunkEntry const patched{17, 17, 1, 1};
+        write_with(original, patched);
+        CHECK_THROWS_AS(NativeFormat::NativeChunkedReader::open(path), std::runtime_error);
+    }
+}
+
+// POSIX only: Windows refuses to rename over a file that has an open mapping
+#ifndef _WIN32
+TEST_CASE_METHOD(NativeFormatTestFixture,
+                 "Native save replaces a file that is still mapped",
+                 "[native][atomic]") {
+    PointData first;
+    first.addAtTime(TimeFrameIndex(0), Point2D<float>{1.0f, 1.0f}, NotifyObservers::No);
+    auto loaded = roundTrip("replace.wtn", DM_DataType::Points, first);
+
+    PointData second;
+    second.addAtTime(TimeFrameIndex(0), Point2D<float>{7.0f, 7.0f}, NotifyObservers::No);
+    second.addAtTime(TimeFrameIndex(1), Point2D<float>{8.0f, 8.0f}, NotifyObservers::No);
+    auto reloaded = roundTrip("replace.wtn", DM_DataType::Points, second);
+
+    // The earlier series still reads the mapping it was created from
+    auto old_points = collect(loaded->getAtTime(TimeFrameIndex(0)));
+    REQUIRE(old_points.size() == 1);
+    CHECK(old_points[0].x == 1.0f);
+    CHECK(reloaded->getTotalEntryCount() == 2);
+}
+#endif
@@ -0,0 +1,175 @@
+/**
+ * @file json_load_graph.test.cpp
+ * @brief Tests for JSON data-load dependency ordering and the parallel loader.
+ */
+
+#include "DataManager.hpp"
+#include "TimeFrame/StrongTimeTypes.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+#include "utils/JsonLoadGraph.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+
+class TempLoadDirectory {
+public:
+    TempLoadDirectory() {
+        path = std::filesystem::temp_directory_path() /
+               ("whiskertoolbox_json_load_graph_" + std::to_string(std::time(nullptr)));
+        std::filesystem::create_directories(path);
+    }
+
+    ~TempLoadDirectory() {
+        std::filesystem::remove_all(path);
+    }
+
+    TempLoadDirectory(TempLoadDirectory const &) = delete;
+    TempLoadDirectory & operator=(TempLoadDirectory const &) = delete;
+
+    /// Write @p count uint16 samples so a `uint16_length` time entry yields @p count frames.
+    void writeUint16File(std::string const & filename, std::size_t count) const {
+        std::vector<uint16_t> const samples(count, 0);
+        std::ofstream file(path / filename, std::ios::binary);
+        file.write(reinterpret_cast<char const *>(samples.data()),
+                   static_cast<std::streamsize>(samples.size() * sizeof(uint16_t)));
+    }
+
+    std::filesystem::path path;
+};
+
+json uint16LengthTimeEntry(std::string const & name, std::string const & filename) {
+    return {{"data_type", "time"}, {"name", name}, {"filepath", filename}, {"format", "uint16_length"}};
+}
+
+}// namespace
+
+TEST_CASE("classifyJsonLoadEntry distinguishes entry kinds",
+          "[DataManager][JsonLoadGraph]") {
+    CHECK(classifyJsonLoadEntry({{"transformations", json::object()}}) == JsonLoadEntryKind::Transformations);
+    CHECK(classifyJsonLoadEntry({{"data_type", "time"}, {"format", "derived"}}) == JsonLoadEntryKind::DerivedTimeFrame);
+    CHECK(classifyJsonLoadEntry({{"data_type", "time"}, {"format", "max_value"}}) == JsonLoadEntryKind::DerivedTimeFrame);
+    CHECK(classifyJsonLoadEntry({{"data_type", "time"}, {"format", "uint16"}}) == JsonLoadEntryKind::TimeFrame);
+    CHECK(classifyJsonLoadEntry({{"data_type", "line"}, {"format", "csv"}}) == JsonLoadEntryKind::Data);
+}
+
+TEST_CASE("buildJsonLoadGraph keeps array order when already dependency-ordered",
+          "[DataManager][JsonLoadGraph]") {
+    json const data = json::array({
+            {{"name", "cam"}, {"data_type", "time"}, {"filepath", "cam.bin"}},
+            {{"name", "whiskers"}, {"data_type", "line"}, {"filepath", "w.csv"}, {"clock", "cam"}},
+            {{"transformations", json::object()}},
+            {{"name", "mask"}, {"data_type", "mask"}, {"filepath", "m.h5"}},
+    });
+
+    auto const graph = buildJsonLoadGraph(data);
+    REQUIRE(graph.nodes.size() == 4);
+    CHECK_FALSE(graph.has_cycle);
+    CHECK(graph.commit_order == std::vector<std::size_t>{0, 1, 3});
+    CHECK(graph.nodes[1].dependencies == std::vector<std::size_t>{0});
+    CHECK(graph.nodes[3].dependencies.empty());
+}
+
+TEST_CASE("buildJsonLoadGraph moves derived TimeFrames after their sources",
+          "[DataManager][JsonLoadGraph]") {
+    json const data = json::array({
+            {{"name", "trial_starts"}, {"data_type", "time"}, {"format", "derived"},
+             {"source_timeframe", "cam"}, {"interval_series", "trials_1"}},
+            {{"name", "trials"}, {"data_type", "digital_interval"}, {"filepath", "t.csv"}, {"clock", "cam"}},
+            {{"name", "cam"}, {"data_type", "time"}, {"filepath", "cam.bin"}},
+    });
+
+    auto const graph = buildJsonLoadGraph(data);
+    CHECK_FALSE(graph.has_cycle);
+    // "trials_1" is a per-channel key produced by the "trials" entry
+    CHECK(graph.nodes[0].dependencies == std::vector<std::size_t>{1, 2});
+    CHECK(graph.commit_order == std::vector<std::size_t>{2, 1, 0});
+}
+
+TEST_CASE("buildJsonLoadGraph reports cycles and still orders every entry",
+          "[DataManager][JsonLoadGraph]") {
+    json const data = json::array({
+            {{"name", "a"}, {"data_type", "time"}, {"format", "max_value"}, {"source_data", "b"}},
+            {{"name", "b"}, {"data_type", "analog"}, {"filepath", "b.bin"}, {"clock", "a"}},
+            {{"name", "c"}, {"data_type", "analog"}, {"filepath", "c.bin"}},
+    });
+
+    auto const graph = buildJsonLoadGraph(data);
+    CHECK(graph.has_cycle);
+    CHECK(graph.commit_order == std::vector<std::size_t>{2, 0, 1});
+}
+
+TEST_CASE("buildJsonLoadGraph orders entries that reuse a name",
+          "[DataManager][JsonLoadGraph]") {
+    json const data = json::array({
+            {{"name", "x"}, {"data_type", "line"}, {"filepath", "first.csv"}},
+            {{"name", "x"}, {"data_type", "line"}, {"filepath", "second.csv"}},
+    });
+
+    auto const graph = buildJsonLoadGraph(data);
+    CHECK(graph.nodes[1].dependencies == std::vector<std::size_t>{0});
+    CHECK(graph.commit_order == std::vector<std::size_t>{0, 1});
+}
+
+TEST_CASE("load_data_from_json_config_parallel matches the sequential loader",
+          "[DataManager][JsonLoadGraph][parallel]") {
+    TempLoadDirectory const dir;
+    json config = json::array();
+    for (int i = 0; i < 6; ++i) {
+        auto const filename = "clock_" + std::to_string(i) + ".bin";
+        dir.writeUint16File(filename, static_cast<std::size_t>(10 + i));
+        config.push_back(uint16LengthTimeEntry("clock_" + std::to_string(i), filename));
+    }
+    config.push_back(uint16LengthTimeEntry("missing", "does_not_exist.bin"));
+
+    DataManager sequential;
+    load_data_from_json_config(&sequential, config, dir.path.string());
+
+    DataManager parallel;
+    JsonParallelLoadOptions options;
+    options.max_threads = 3;
+    auto const report = load_data_from_json_config_parallel(&parallel, config, dir.path.string(), options);
+
+    REQUIRE(report.timings.size() == config.size());
+    for (int i = 0; i < 6; ++i) {
+        TimeKey const key("clock_" + std::to_string(i));
+        REQUIRE(parallel.getTime(key) != nullptr);
+        REQUIRE(sequential.getTime(key) != nullptr);
+        CHECK(parallel.getTime(key)->getTotalFrameCount() == sequential.getTime(key)->getTotalFrameCount());
+        CHECK(report.timings[static_cast<std::size_t>(i)].index == static_cast<std::size_t>(i));
+        CHECK(report.timings[static_cast<std::size_t>(i)].success);
+    }
+    CHECK_FALSE(report.timings.back().success);
+    CHECK(parallel.getTime(TimeKey("missing")) == nullptr);
+}
+
+TEST_CASE("load_data_from_json_config_parallel stops committing when cancelled",
+          "[DataManager][JsonLoadGraph][parallel]") {
+    TempLoadDirectory const dir;
+    json config = json::array();
+    for (int i = 0; i < 4; ++i) {
+        auto const filename = "clock_" + std::to_string(i) + ".bin";
+        dir.writeUint16File(filename, 8);
+        config.push_back(uint16LengthTimeEntry("clock_" + std::to_string(i), filename));
+    }
+
+    DataManager dm;
+    JsonParallelLoadOptions options;
+    options.progress_callback = [](int current, int, std::string const &) { return current < 2; };
+    auto const report = load_data_from_json_config_parallel(&dm, config, dir.path.string(), options);
+
+    CHECK(report.timings.size() == 2);
+    CHECK(dm.getTime(TimeKey("clock_1")) != nullptr);
+    CHECK(dm.getTime(TimeKey("clock_2")) == nullptr);
+}
@@ -0,0 +1,223 @@
+/**
+ * @file json_parallel_load.test.cpp
+ * @brief Tests for load_data_from_json_config_parallel().
+ */
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "AnalogTimeSeries/Analog_Time_Series.hpp"
+#include "DataManager.hpp"
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "TimeFrame/StrongTimeTypes.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+
+class TempJsonLoadDirectory {
+public:
+    TempJsonLoadDirectory() {
+        path = std::filesystem::temp_directory_path() /
+               ("whiskertoolbox_json_parallel_load_test_" + std::to_string(std::time(nullptr)));
+        std::filesystem::create_directories(path);
+    }
+
+    ~TempJsonLoadDirectory() {
+        std::filesystem::remove_all(path);
+    }
+
+    TempJsonLoadDirectory(TempJsonLoadDirectory const &) = delete;
+    TempJsonLoadDirectory & operator=(TempJsonLoadDirectory const &) = delete;
+
+    std::filesystem::path path;
+};
+
+template<typename T>
+void writeBinary(std::filesystem::path const & file, std::vector<T> const & values) {
+    std::ofstream out(file, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<char const *>(values.data()),
+              static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+std::vector<int16_t> rampSamples(std::size_t count, int16_t offset) {
+    std::vector<int16_t> samples(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        samples[i] = static_cast<int16_t>(static_cast<int>(i % 1000) + offset);
+    }
+    return samples;
+}
+
+json analogEntry(std::string const & name, std::string const & filename) {
+    return {{"data_type", "analog"},
+            {"name", name},
+            {"filepath", filename},
+            {"format", "binary"},
+            {"num_channels", 1},
+            {"header_size", 0}};
+}
+
+std::vector<std::string> sortedTimeKeys(DataManager & dm) {
+    std::vector<std::string> keys;
+    for (auto const & key: dm.getTimeFrameKeys()) {
+        keys.push_back(key.str());
+    }
+    std::ranges::sort(keys);
+    return keys;
+}
+
+/// Same keys, clocks, TimeFrames and values in both DataManagers
+void requireSameState(DataManager & expected, DataManager & actual) {
+    auto expected_keys = expected.getAllKeys();
+    auto actual_keys = actual.getAllKeys();
+    std::ranges::sort(expected_keys);
+    std::ranges::sort(actual_keys);
+    REQUIRE(actual_keys == expected_keys);
+
+    for (auto const & key: expected_keys) {
+        CHECK(actual.getTimeKey(key) == expected.getTimeKey(key));
+    }
+
+    auto const time_keys = sortedTimeKeys(expected);
+    REQUIRE(sortedTimeKeys(actual) == time_keys);
+    for (auto const & key: time_keys) {
+        auto const expected_frame = expected.getTime(TimeKey(key));
+        auto const actual_frame = actual.getTime(TimeKey(key));
+        REQUIRE(actual_frame->getTotalFrameCount() == expected_frame->getTotalFrameCount());
+        for (int i = 0; i < expected_frame->getTotalFrameCount(); ++i) {
+            CHECK(actual_frame->getTimeAtIndex(TimeFrameIndex(i)) ==
+                  expected_frame->getTimeAtIndex(TimeFrameIndex(i)));
+        }
+    }
+
+    for (auto const & key: expected.getKeys<AnalogTimeSeries>()) {
+        auto const expected_series = expected.getData<AnalogTimeSeries>(key);
+        auto const actual_series = actual.getData<AnalogTimeSeries>(key);
+        REQUIRE(actual_series != nullptr);
+        REQUIRE(actual_series->getNumSamples() == expected_series->getNumSamples());
+        auto const expected_values = expected_series->viewValues();
+        auto const actual_values = actual_series->viewValues();
+        CHECK(std::ranges::equal(actual_values, expected_values));
+    }
+
+    for (auto const & key: expected.getKeys<DigitalEventSeries>()) {
+        auto const expected_series = expected.getData<DigitalEventSeries>(key);
+        auto const actual_series = actual.getData<DigitalEventSeries>(key);
+        REQUIRE(actual_series != nullptr);
+        REQUIRE(actual_series->size() == expected_series->size());
+        for (std::size_t i = 0; i < expected_series->size(); ++i) {
+            CHECK(actual_series->getStoredEvent(i) == expected_series->getStoredEvent(i));
+        }
+    }
+}
+
+}// namespace
+
+TEST_CASE("load_data_from_json_config_parallel - matches the sequential loader on a mixed config",
+          "[DataManager][json][parallel]") {
+    TempJsonLoadDirectory const dir;
+
+    // Camera clock: one tick per uint16 sample
+    writeBinary(dir.path / "cam.bin", std::vector<uint16_t>(400, 0));
+    writeBinary(dir.path / "lfp.bin", rampSamples(400, 3));
+    writeBinary(dir.path / "emg.bin", rampSamples(5, -7));// one sample per lick
+    {
+        std::ofstream events(dir.path / "licks.csv");
+        events << "Event\n12\n57\n58\n190\n333\n";
+    }
+
+    json const config = json::array({
+            {{"data_type", "time"}, {"name", "cam"}, {"filepath", "cam.bin"}, {"format", "uint16_length"}},
+            [] {
+                auto entry = analogEntry("lfp", "lfp.bin");
+                entry["clock"] = "cam";
+                return entry;
+            }(),
+            {{"data_type", "digital_event"},
+             {"name", "licks"},
+             {"filepath", "licks.csv"},
+             {"format", "csv"},
+             {"delimiter", ","},
+             {"has_header", true},
+             {"clock", "cam"}},
+            {{"data_type", "time"},
+             {"name", "lick_clock"},
+             {"format", "derived"},
+             {"source_timeframe", "cam"},
+             {"source_series", "licks"},
+             {"source_type", "event"}},
+            [] {
+                auto entry = analogEntry("emg", "emg.bin");
+                entry["clock"] = "lick_clock";
+                return entry;
+            }(),
+    });
+
+    DataManager sequential;
+    auto const sequential_info = load_data_from_json_config(&sequential, config, dir.path.string());
+
+    JsonParallelLoadOptions options;
+    options.max_threads = 4;
+    DataManager parallel;
+    auto const report = load_data_from_json_config_parallel(&parallel, config, dir.path.string(), options);
+
+    REQUIRE(sequential.getData<AnalogTimeSeries>("lfp") != nullptr);
+    REQUIRE(sequential.getTime(TimeKey("lick_clock")) != nullptr);
+    CHECK(sequential.getTime(TimeKey("lick_clock"))->getTotalFrameCount() == 5);
+    CHECK(report.data_info.size() == sequential_info.size());
+    CHECK(std::ranges::all_of(report.timings, [](auto const & timing) { return timing.success; }));
+    requireSameState(sequential, parallel);
+}
+
+TEST_CASE("load_data_from_json_config_parallel - a throwing progress callback waits for staged reads",
+          "[DataManager][json][parallel]") {
+    TempJsonLoadDirectory const dir;
+
+    // Variables make the loader resolve the data array into a local copy that
+    // the staged reads reference; leaving early must not outlive them.
+    json config = {{"variables", {{"prefix", "lfp"}}}, {"data", json::array()}};
+    for (int i = 0; i < 8; ++i) {
+        std::string const file = "analog_" + std::to_string(i) + ".bin";
+        writeBinary(dir.path / file, rampSamples(20000, static_cast<int16_t>(i)));
+        config["data"].push_back(analogEntry("${prefix}_" + std::to_string(i), file));
+    }
+
+    JsonParallelLoadOptions options;
+    options.max_threads = 4;
+    options.progress_callback = [](int current, int, std::string const &) {
+        if (current > 0) {
+            throw std::runtime_error("progress sink failed");
+        }
+        return true;
+    };
+
+    DataManager dm;
+    REQUIRE_THROWS_AS(load_data_from_json_config_parallel(&dm, config, dir.path.string(), options),
+                      std::runtime_error);
+    CHECK(dm.getData<AnalogTimeSeries>("lfp_0") != nullptr);
+
+    // Nothing from the abandoned run is still touching the loader's state
+    DataManager fresh;
+    options.progress_callback = {};
+    auto const report = load_data_from_json_config_parallel(&fresh, config, dir.path.string(), options);
+    CHECK(report.timings.size() == 8);
+    CHECK(fresh.getKeys<AnalogTimeSeries>().size() == 8);
+}
+
+TEST_CASE("load_data_from_json_config_parallel - HDF5 and Python formats stay on the calling thread by default",
+          "[DataManager][json][parallel]") {
+    JsonParallelLoadOptions const options;
+    CHECK(options.main_thread_formats.contains("hdf5"));
+    CHECK(options.main_thread_formats.contains("spike2"));
+}
@@ -11,8 +11,11 @@
 #include "CoreGeometry/points.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
+#include <atomic>
 #include <ranges>
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 TEST_CASE("OwningRaggedStorage basic operations", "[RaggedStorage]") {
     OwningRaggedStorage<Point2D<float>> storage;
@@ -699,6 +702,49 @@ TEST_CASE("LazyRaggedStorage with complex transform", "[RaggedStorage][lazy]") {
         CHECK(lazy_storage.getData(2).points()[1].y == 82);
     }
 }
+
+TEST_CASE("LazyRaggedStorage concurrent reads", "[RaggedStorage][lazy]") {
+    std::vector<std::tuple<TimeFrameIndex, EntityId, Mask2D>> source_masks;
+    for (int i = 0; i < 64; ++i) {
+        Mask2D mask;
+        for (int k = 0; k <= i; ++k) {
+            mask.push_back({static_cast<uint32_t>(i), static_cast<uint32_t>(k)});
+        }
+        source_masks.emplace_back(TimeFrameIndex{i}, EntityId{static_cast<uint64_t>(i)}, std::move(mask));
+    }
+    auto transform_view = source_masks | std::views::transform([](auto const & tuple) {
+                              auto [time, eid, mask] = tuple;
+                              return std::make_tuple(time, eid, mask);
+                          });
+    using ViewType = decltype(transform_view);
+    LazyRaggedStorage<Mask2D, ViewType> lazy_storage(transform_view, source_masks.size());
+
+    // Each reader checks the value behind its own reference; a shared cache would
+    // be overwritten by the other readers between the copy and the check
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&lazy_storage, &mismatches, r] {
+            for (int pass = 0; pass < 200; ++pass) {
+                for (size_t i = static_cast<size_t>(r); i < lazy_storage.size(); i += 4) {
+                    Mask2D const & mask = lazy_storage.getData(i);
+                    size_t count = 0;
+                    for (auto const & point: mask.points()) {
+                        count += point.x == i ? 1 : 0;
+                    }
+                    if (count != i + 1) {
+                        ++mismatches;
+                    }
+                }
+            }
+        });
+    }
+    for (auto & reader: readers) {
+        reader.join();
+    }
+    CHECK(mismatches.load() == 0);
+}
+
 // =============================================================================
 // RaggedTimeSeries createFromView and materialize Tests
 // =============================================================================
@@ -17,13 +17,88 @@
 #include "utils/TableView/computers/StandardizeComputer.h"
 #include "utils/TableView/core/TableView.h"
 #include "utils/TableView/core/TableViewBuilder.h"
+#include "utils/TableView/interfaces/IMultiColumnComputer.h"
 #include "utils/TableView/interfaces/IRowSelector.h"
 
+#include <atomic>
 #include <iostream>// Added for debug output
 #include <memory>
 #include <random>
+#include <stdexcept>
 #include <vector>
 
+namespace {
+
+/**
+ * @brief Column computer that records the plan it was given and returns row indices
+ */
+class PlanRecordingComputer : public IColumnComputer<double> {
+public:
+    PlanRecordingComputer(std::string source,
+                          std::vector<std::string> dependencies,
+                          std::shared_ptr<std::vector<ExecutionPlan const *>> seen_plans,
+                          size_t slot)
+        : m_source(std::move(source)),
+          m_dependencies(std::move(dependencies)),
+          m_seen_plans(std::move(seen_plans)),
+          m_slot(slot) {}
+
+    [[nodiscard]] std::pair<std::vector<double>, ColumnEntityIds> compute(ExecutionPlan const & plan) const override {
+        (*m_seen_plans)[m_slot] = &plan;
+        std::vector<double> values(plan.getIntervals().size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = static_cast<double>(i + m_slot);
+        }
+        return {std::move(values), std::monostate{}};
+    }
+
+    [[nodiscard]] std::vector<std::string> getDependencies() const override { return m_dependencies; }
+    [[nodiscard]] std::string getSourceDependency() const override { return m_source; }
+
+private:
+    std::string m_source;
+    std::vector<std::string> m_dependencies;
+    std::shared_ptr<std::vector<ExecutionPlan const *>> m_seen_plans;
+    size_t m_slot;
+};
+
+/**
+ * @brief Multi-column computer that counts how often its batch is computed
+ */
+class CountingMultiComputer : public IMultiColumnComputer<double> {
+public:
+    CountingMultiComputer(std::string source, size_t num_outputs, std::shared_ptr<std::atomic<int>> batch_count)
+        : m_source(std::move(source)),
+          m_num_outputs(num_outputs),
+          m_batch_count(std::move(batch_count)) {}
+
+    [[nodiscard]] std::pair<std::vector<std::vector<double>>, ColumnEntityIds> computeBatch(ExecutionPlan const & plan) const override {
+        m_batch_count->fetch_add(1);
+        std::vector<std::vector<double>> outputs(m_num_outputs);
+        for (size_t k = 0; k < m_num_outputs; ++k) {
+            outputs[k].assign(plan.getIntervals().size(), static_cast<double>(k));
+        }
+        return {std::move(outputs), std::monostate{}};
+    }
+
+    [[nodiscard]] std::vector<std::string> getOutputNames() const override {
+        std::vector<std::string> names;
+        for (size_t k = 0; k < m_num_outputs; ++k) {
+            names.push_back("_" + std::to_string(k));
+        }
+        return names;
+    }
+
+    [[nodiscard]] std::string getSourceDependency() const override { return m_source; }
+
+private:
+    std::string m_source;
+    size_t m_num_outputs;
+    std::shared_ptr<std::atomic<int>> m_batch_count;
+};
+
+}// namespace
+
 TEST_CASE("TableView AnalogSliceGathererComputer Test", "[TableView][AnalogSliceGathererComputer]") {
 
     // NOTE: Tests for analog slice gathering from point data have been removed.
@@ -428,3 +503,92 @@ TEST_CASE("TableView Different TimeFrames Test", "[TableView][TimeFrame]") {
         }
     }
 }
+
+TEST_CASE("TableView materializeAll schedules columns by dependency", "[TableView][materializeAll]") {
+    DataManager dataManager;
+
+    std::vector<int> timeValues(100);
+    for (int i = 0; i < 100; ++i) {
+        timeValues[static_cast<size_t>(i)] = i;
+    }
+    auto timeFrame = std::make_shared<TimeFrame>(timeValues);
+    dataManager.setTime(TimeKey("test_time"), timeFrame);
+
+    std::map<int, float> analog_vals;
+    for (int i = 0; i < 100; ++i) {
+        analog_vals[i] = static_cast<float>(i);
+    }
+    dataManager.setData<AnalogTimeSeries>("TestAnalog", std::make_shared<AnalogTimeSeries>(analog_vals), TimeKey("test_time"));
+
+    auto dataManagerExtension = std::make_shared<DataManagerExtension>(dataManager);
+
+    std::vector<TimeFrameInterval> intervals;
+    for (int i = 0; i < 10; ++i) {
+        intervals.emplace_back(TimeFrameIndex(i * 10), TimeFrameIndex(i * 10 + 5));
+    }
+
+    TableViewBuilder builder(dataManagerExtension);
+    builder.setRowSelector(std::make_unique<IntervalSelector>(intervals, timeFrame));
+
+    SECTION("Independent columns share one plan and dependents run in later stages") {
+        constexpr size_t num_independent = 120;
+        auto seen_plans = std::make_shared<std::vector<ExecutionPlan const *>>(num_independent + 2, nullptr);
+
+        for (size_t i = 0; i < num_independent; ++i) {
+            builder.addColumn<double>("Col_" + std::to_string(i),
+                                      std::make_unique<PlanRecordingComputer>("TestAnalog", std::vector<std::string>{}, seen_plans, i));
+        }
+        // Declared out of order: Dep_B needs Dep_A, which needs Col_0
+        builder.addColumn<double>("Dep_B",
+                                  std::make_unique<PlanRecordingComputer>("TestAnalog", std::vector<std::string>{"Dep_A"}, seen_plans, num_independent));
+        builder.addColumn<double>("Dep_A",
+                                  std::make_unique<PlanRecordingComputer>("TestAnalog", std::vector<std::string>{"Col_0"}, seen_plans, num_independent + 1));
+
+        TableView table = builder.build();
+        auto const timings = table.materializeAll();
+
+        REQUIRE(timings.size() == num_independent + 2);
+        for (size_t i = 0; i < num_independent; ++i) {
+            REQUIRE(timings[i].column_name == "Col_" + std::to_string(i));
+            REQUIRE(timings[i].stage == 0);
+            REQUIRE(timings[i].compute_time_ms >= 0.0);
+        }
+        REQUIRE(timings[num_independent].column_name == "Dep_A");
+        REQUIRE(timings[num_independent].stage == 1);
+        REQUIRE(timings[num_independent + 1].column_name == "Dep_B");
+        REQUIRE(timings[num_independent + 1].stage == 2);
+
+        // Every column saw the same cached plan
+        for (auto const * plan: *seen_plans) {
+            REQUIRE(plan == seen_plans->front());
+        }
+
+        auto const & values = table.getColumnValues<double>("Col_7");
+        REQUIRE(values.size() == intervals.size());
+        REQUIRE(values[3] == 10.0);
+
+        // Nothing left to compute on a second call
+        REQUIRE(table.materializeAll().empty());
+    }
+
+    SECTION("Multi-column outputs computed concurrently share one batch") {
+        auto batch_count = std::make_shared<std::atomic<int>>(0);
+        builder.addColumns<double>("Multi", std::make_unique<CountingMultiComputer>("TestAnalog", 16, batch_count));
+
+        TableView table = builder.build();
+        auto const timings = table.materializeAll();
+
+        REQUIRE(timings.size() == 16);
+        REQUIRE(batch_count->load() == 1);
+        REQUIRE(table.getColumnValues<double>("Multi_5")[0] == 5.0);
+    }
+
+    SECTION("Circular dependencies are rejected") {
+        auto seen_plans = std::make_shared<std::vector<ExecutionPlan const *>>(2, nullptr);
+        builder.addColumn<double>("A", std::make_unique<PlanRecordingComputer>("TestAnalog", std::vector<std::string>{"B"}, seen_plans, 0));
+        builder.addColumn<double>("B", std::make_unique<PlanRecordingComputer>("TestAnalog", std::vector<std::string>{"A"}, seen_plans, 1));
+
+        TableView table = builder.build();
+        REQUIRE_THROWS_AS(table.materializeAll(), std::runtime_error);
+    }
+}
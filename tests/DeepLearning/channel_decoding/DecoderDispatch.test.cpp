@@ -9,6 +9,10 @@
 
 #include <ATen/Functions.h>
 
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
 TEST_CASE("DecoderDispatch maps params to factory names",
           "[channel_decoding][decoder_dispatch]") {
     CHECK(dl::decoderFactoryName<dl::MaskDecoderParams>() == "TensorToMask2D");
@@ -64,3 +68,37 @@ TEST_CASE("DecoderDispatch decodes mask tensor via variant",
     REQUIRE(std::holds_alternative<Mask2D>(decoded));
     CHECK(std::get<Mask2D>(decoded).size() == 1);
 }
+
+TEST_CASE("DecoderDispatch decodes a whole batch via variant",
+          "[channel_decoding][decoder_dispatch]") {
+    auto tensor = at::zeros({3, 1, 4, 4});
+    tensor[0][0][1][2] = 0.9f;
+    tensor[2][0][3][3] = 0.9f;
+    tensor[2][0][0][0] = 0.9f;
+
+    dl::DecoderContext ctx;
+    ctx.height = 4;
+    ctx.width = 4;
+
+    dl::DecoderVariant const params{dl::MaskDecoderParams{.threshold = 0.5f}};
+
+    // Only the first two elements are requested
+    auto const decoded = dl::decodeBatchToGeometry(tensor, ctx, params, 2);
+    REQUIRE(decoded.size() == 2);
+    REQUIRE(std::holds_alternative<Mask2D>(decoded[0]));
+    CHECK(std::get<Mask2D>(decoded[0]).size() == 1);
+    CHECK(std::get<Mask2D>(decoded[1]).empty());
+
+    CHECK_THROWS_AS(dl::decodeBatchToGeometry(tensor, ctx, params, 4), std::out_of_range);
+}
+
+TEST_CASE("DecoderDispatch decodes a batch of feature vectors",
+          "[channel_decoding][decoder_dispatch]") {
+    auto tensor = at::arange(6, at::kFloat).reshape({2, 3});
+
+    dl::DecoderContext ctx;
+    auto const decoded = dl::decodeBatchToGeometry(
+            tensor, ctx, dl::DecoderVariant{dl::FeatureVectorDecoderParams{}}, 2);
+    REQUIRE(decoded.size() == 2);
+    CHECK(std::get<std::vector<float>>(decoded[1]) == std::vector<float>{3.0f, 4.0f, 5.0f});
+}
@@ -284,3 +284,37 @@ TEST_CASE("TensorToLine2D - single pixel", "[channel_decoding][TensorToLine2D]")
     // A single pixel produces a line with 1 point
     CHECK(line.size() == 1);
 }
+
+TEST_CASE("TensorToLine2D - batch decode matches per-element decode",
+          "[channel_decoding][TensorToLine2D]") {
+    dl::TensorToLine2D decoder;
+
+    auto tensor = at::zeros({3, 1, 10, 10});
+    for (int x = 2; x <= 7; ++x) {
+        tensor[0][0][5][x] = 1.0f;// horizontal
+    }
+    for (int y = 1; y <= 8; ++y) {
+        tensor[2][0][y][4] = 1.0f;// vertical; element 1 stays empty
+    }
+
+    dl::DecoderContext ctx;
+    ctx.source_channel = 0;
+    ctx.height = 10;
+    ctx.width = 10;
+    dl::LineDecoderParams params;
+    params.threshold = 0.5f;
+
+    auto const lines = decoder.decodeBatch(tensor, ctx, params);
+    REQUIRE(lines.size() == 3);
+    CHECK(lines[1].empty());
+
+    for (int b = 0; b < 3; ++b) {
+        ctx.batch_index = b;
+        auto const single = decoder.decode(tensor, ctx, params);
+        REQUIRE(lines[b].size() == single.size());
+        for (size_t i = 0; i < single.size(); ++i) {
+            CHECK(lines[b][i].x == single[i].x);
+            CHECK(lines[b][i].y == single[i].y);
+        }
+    }
+}
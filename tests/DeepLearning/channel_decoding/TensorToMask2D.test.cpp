@@ -249,3 +249,102 @@ TEST_CASE("TensorToMask2D - channel selection", "[channel_decoding][TensorToMask
     CHECK(mask1[0].x == 7);
     CHECK(mask1[0].y == 6);
 }
+
+TEST_CASE("TensorToMask2D - batch decode matches per-element decode",
+          "[channel_decoding][TensorToMask2D]") {
+    dl::TensorToMask2D decoder;
+
+    auto tensor = at::rand({5, 2, 12, 70});// width spans two 64-bit threshold words
+
+    dl::DecoderContext ctx;
+    ctx.source_channel = 1;
+    ctx.height = 12;
+    ctx.width = 70;
+    dl::MaskDecoderParams params;
+    params.threshold = 0.6f;
+
+    for (auto const target: {ImageSize{0, 0}, ImageSize{200, 30}, ImageSize{35, 6}}) {
+        ctx.target_image_size = target;
+
+        auto const runs = decoder.decodeBatchRuns(tensor, ctx, params);
+        auto const masks = decoder.decodeBatch(tensor, ctx, params);
+        REQUIRE(runs.batchSize() == 5);
+        REQUIRE(masks.size() == 5);
+
+        for (int b = 0; b < 5; ++b) {
+            ctx.batch_index = b;
+            auto const single = decoder.decode(tensor, ctx, params);
+            CHECK(masks[b].points() == single.points());
+            CHECK(runs.pixelCount(b) == single.size());
+        }
+    }
+}
+
+TEST_CASE("TensorToMask2D - batch runs are compact", "[channel_decoding][TensorToMask2D]") {
+    dl::TensorToMask2D decoder;
+
+    auto tensor = at::zeros({2, 1, 4, 8});
+    for (int x = 2; x < 6; ++x) {
+        tensor[1][0][3][x] = 1.0f;
+    }
+
+    dl::DecoderContext ctx;
+    ctx.height = 4;
+    ctx.width = 8;
+    dl::MaskDecoderParams params;
+
+    auto const runs = decoder.decodeBatchRuns(tensor, ctx, params);
+    REQUIRE(runs.batchSize() == 2);
+    CHECK(runs.runsFor(0).empty());
+    REQUIRE(runs.runsFor(1).size() == 1);
+    CHECK(runs.runsFor(1)[0] == dl::MaskPixelRun{3, 2, 6});
+
+    // Nearest-neighbour upsampling by 2 widens the run to [4, 12) on rows 6 and 7
+    ctx.target_image_size = ImageSize{16, 8};
+    auto const scaled = decoder.decodeBatchRuns(tensor, ctx, params);
+    REQUIRE(scaled.runsFor(1).size() == 2);
+    CHECK(scaled.runsFor(1)[0] == dl::MaskPixelRun{6, 4, 12});
+    CHECK(scaled.runsFor(1)[1] == dl::MaskPixelRun{7, 4, 12});
+}
+
+TEST_CASE("TensorToMask2D - bilinear resampling", "[channel_decoding][TensorToMask2D]") {
+    dl::TensorToMask2D decoder;
+
+    // Left half 0, right half 1: bilinear upsampling places the 0.5 crossing
+    // between the two source pixel centres, nearest places it on the pixel edge
+    auto tensor = at::zeros({1, 1, 2, 2});
+    tensor[0][0][0][1] = 1.0f;
+    tensor[0][0][1][1] = 1.0f;
+
+    dl::DecoderContext ctx;
+    ctx.height = 2;
+    ctx.width = 2;
+    ctx.target_image_size = ImageSize{8, 8};
+    dl::MaskDecoderParams params;
+    params.threshold = 0.5f;
+    params.resampling = dl::MaskResampling::Bilinear;
+
+    auto const mask = decoder.decode(tensor, ctx, params);
+
+    // Destination column 4 samples source x = 0.625 (value 0.625); column 3 samples 0.375
+    REQUIRE(mask.size() == 4 * 8);
+    for (auto const & p: mask) {
+        CHECK(p.x >= 4);
+    }
+
+    auto const batch = decoder.decodeBatch(tensor, ctx, params);
+    REQUIRE(batch.size() == 1);
+    CHECK(batch[0].points() == mask.points());
+}
+
+TEST_CASE("TensorToMask2D - batch decode of empty batch", "[channel_decoding][TensorToMask2D]") {
+    dl::TensorToMask2D decoder;
+
+    auto tensor = at::zeros({0, 1, 4, 4});
+    dl::DecoderContext ctx;
+    ctx.height = 4;
+    ctx.width = 4;
+
+    CHECK(decoder.decodeBatchRuns(tensor, ctx, {}).batchSize() == 0);
+    CHECK(decoder.decodeBatch(tensor, ctx, {}).empty());
+}
@@ -262,3 +262,31 @@ TEST_CASE("TensorToPoint2D - decodeMultiple empty for zeros", "[channel_decoding
     auto const points = decoder.decodeMultiple(tensor, ctx, params);
     CHECK(points.empty());
 }
+
+TEST_CASE("TensorToPoint2D - batch decode matches per-element decode",
+          "[channel_decoding][TensorToPoint2D]") {
+    dl::TensorToPoint2D decoder;
+
+    auto tensor = at::rand({6, 1, 16, 20});
+    tensor[2].zero_();// non-positive element decodes to the origin
+
+    dl::DecoderContext ctx;
+    ctx.source_channel = 0;
+    ctx.height = 16;
+    ctx.width = 20;
+    ctx.target_image_size = ImageSize{40, 32};
+    dl::PointDecoderParams params;
+    params.subpixel = true;
+
+    auto const points = decoder.decodeBatch(tensor, ctx, params);
+    REQUIRE(points.size() == 6);
+
+    for (int b = 0; b < 6; ++b) {
+        ctx.batch_index = b;
+        auto const single = decoder.decode(tensor, ctx, params);
+        CHECK_THAT(points[b].x, WithinAbs(single.x, 1e-6f));
+        CHECK_THAT(points[b].y, WithinAbs(single.y, 1e-6f));
+    }
+    CHECK_THAT(points[2].x, WithinAbs(0.0f, 1e-6f));
+    CHECK_THAT(points[2].y, WithinAbs(0.0f, 1e-6f));
+}
@@ -0,0 +1,116 @@
+/**
+ * @file InferenceModeComparison.test.cpp
+ * @brief Unit tests for the inference mode accuracy/throughput harness.
+ */
+
+#include "models_v2/InferenceModeComparison.hpp"
+#include "models_v2/ModelBase.hpp"
+
+#include <ATen/Functions.h>   // at::randn
+#include <ATen/core/Tensor.h> // at::Tensor
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/// Linear model that emulates bf16 by rounding its output through bfloat16.
+class RoundingModel : public dl::ModelBase {
+public:
+    std::string modelId() const override { return "rounding"; }
+    std::string displayName() const override { return "Rounding"; }
+    std::string description() const override { return "Test model with a bf16 mode"; }
+
+    std::vector<dl::TensorSlotDescriptor> inputSlots() const override {
+        return {{.name = "x", .shape = {16}}};
+    }
+    std::vector<dl::TensorSlotDescriptor> outputSlots() const override {
+        return {{.name = "y", .shape = {16}}};
+    }
+
+    void loadWeights(std::filesystem::path const & /*path*/) override {}
+    bool isReady() const override { return true; }
+
+    bool setInferenceOptions(dl::InferenceOptions const & options) override {
+        if (options.precision == dl::InferencePrecision::DynamicInt8) {
+            _options = {};
+            return false;
+        }
+        _options = options;
+        return true;
+    }
+    dl::InferenceOptions inferenceOptions() const override { return _options; }
+
+    std::unordered_map<std::string, at::Tensor>
+    forward(std::unordered_map<std::string, at::Tensor> const & inputs) override {
+        auto y = inputs.at("x") * 3.0 + 1.0;
+        if (_options.precision == dl::InferencePrecision::BFloat16) {
+            y = y.to(at::kBFloat16).to(at::kFloat);
+        }
+        return {{"y", y}};
+    }
+
+private:
+    dl::InferenceOptions _options;
+};
+
+std::vector<std::unordered_map<std::string, at::Tensor>> makeBatches(int count, int batch_size) {
+    std::vector<std::unordered_map<std::string, at::Tensor>> batches;
+    for (int i = 0; i < count; ++i) {
+        batches.push_back({{"x", at::randn({batch_size, 16})}});
+    }
+    return batches;
+}
+
+}// anonymous namespace
+
+TEST_CASE("InferenceModeComparison - deltas against the native reference", "[InferenceModeComparison]") {
+    RoundingModel model;
+    dl::InferenceOptions const native{};
+    dl::InferenceOptions const bf16{dl::InferencePrecision::BFloat16, 0, 0};
+    dl::InferenceOptions const int8{dl::InferencePrecision::DynamicInt8, 0, 0};
+
+    auto const results = dl::compareInferenceModes(
+            model, makeBatches(3, 4), {native, bf16, int8, native});
+    REQUIRE(results.size() == 4);
+
+    CHECK(results[0].supported);
+    CHECK(results[0].reference);
+    CHECK(results[0].frames == 12);
+    CHECK(results[0].batches == 3);
+
+    // bf16 keeps 8 mantissa bits: small but non-zero error
+    CHECK(results[1].supported);
+    CHECK_FALSE(results[1].reference);
+    CHECK(results[1].max_abs_delta > 0.0);
+    CHECK(results[1].max_abs_delta < 0.1);
+    CHECK(results[1].mean_abs_delta <= results[1].max_abs_delta);
+
+    CHECK_FALSE(results[2].supported);
+    CHECK(results[2].applied.precision == dl::InferencePrecision::Native);
+
+    CHECK(results[3].max_abs_delta == 0.0);
+
+    // Original options are restored
+    CHECK(model.inferenceOptions() == native);
+}
+
+TEST_CASE("InferenceModeComparison - report lists every mode", "[InferenceModeComparison]") {
+    RoundingModel model;
+    auto const results = dl::compareInferenceModes(
+            model, makeBatches(1, 2),
+            {{}, {dl::InferencePrecision::BFloat16, 2, 0}, {dl::InferencePrecision::DynamicInt8, 0, 0}});
+
+    auto const report = dl::formatInferenceModeReport(results);
+    using Catch::Matchers::ContainsSubstring;
+    CHECK_THAT(report, ContainsSubstring("native"));
+    CHECK_THAT(report, ContainsSubstring("reference"));
+    CHECK_THAT(report, ContainsSubstring("bf16, 2 threads"));
+    CHECK_THAT(report, ContainsSubstring("int8_dynamic"));
+    CHECK_THAT(report, ContainsSubstring("unsupported"));
+}
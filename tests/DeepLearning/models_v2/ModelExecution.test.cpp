@@ -3,8 +3,11 @@
 #include "models_v2/ModelExecution.hpp"
 #include "models_v2/backends/InferenceBackend.hpp"
 
+#include <ATen/Config.h> // AT_PARALLEL_OPENMP
 #include <ATen/core/Tensor.h> // at::Tensor
 #include <ATen/Functions.h> // at::randn
+#include <ATen/Parallel.h> // at::get_num_threads
+#include <ATen/autocast_mode.h> // at::autocast
 
 #include <filesystem>
 #include <fstream>
@@ -201,6 +204,70 @@ TEST_CASE("ModelExecution - .pte without ENABLE_EXECUTORCH fails gracefully", "[
 }
 #endif
 
+// ============================================================================
+// Inference options
+// ============================================================================
+
+TEST_CASE("InferenceOptions - precision string round-trip", "[InferenceOptions]")
+{
+    for (auto p: {dl::InferencePrecision::Native,
+                  dl::InferencePrecision::BFloat16,
+                  dl::InferencePrecision::DynamicInt8}) {
+        CHECK(dl::precisionFromString(dl::precisionToString(p)) == p);
+    }
+    CHECK(dl::precisionFromString("BF16") == dl::InferencePrecision::BFloat16);
+    CHECK(dl::precisionFromString("int8") == dl::InferencePrecision::DynamicInt8);
+    CHECK(dl::precisionFromString("fp32") == dl::InferencePrecision::Native);
+    CHECK_FALSE(dl::precisionFromString("fp8").has_value());
+}
+
+TEST_CASE("InferenceOptions - scoped options restore autocast", "[InferenceOptions]")
+{
+    int const threads_before = at::get_num_threads();
+    bool const autocast_before = at::autocast::is_autocast_enabled(at::kCPU);
+    int const scoped_threads = threads_before > 1 ? threads_before - 1 : 2;
+
+    {
+        dl::ScopedInferenceOptions const scope(
+                {dl::InferencePrecision::BFloat16, scoped_threads, 0});
+#if AT_PARALLEL_OPENMP
+        CHECK(at::get_num_threads() == scoped_threads);
+#else
+        // The native pool is sized at load; a forward pass never resizes it
+        CHECK(at::get_num_threads() == threads_before);
+#endif
+        CHECK(at::autocast::is_autocast_enabled(at::kCPU));
+        CHECK(at::autocast::get_autocast_dtype(at::kCPU) == at::kBFloat16);
+    }
+
+    CHECK(at::get_num_threads() == threads_before);
+    CHECK(at::autocast::is_autocast_enabled(at::kCPU) == autocast_before);
+}
+
+TEST_CASE("InferenceOptions - intra-op threads are applied once", "[InferenceOptions]")
+{
+    CHECK_FALSE(dl::applyIntraOpThreads(0));
+    // Requesting the current count is a no-op that always succeeds
+    CHECK(dl::applyIntraOpThreads(at::get_num_threads()));
+}
+
+TEST_CASE("ModelExecution - compiled backend rejects reduced precision", "[ModelExecution][InferenceOptions]")
+{
+    dl::ModelExecution exec(dl::BackendType::AOTInductor);
+    CHECK_FALSE(exec.setOptions({dl::InferencePrecision::DynamicInt8, 0, 0}));
+    CHECK(exec.setOptions({dl::InferencePrecision::Native, 2, 0}));
+    CHECK(exec.options().intra_op_threads == 2);
+}
+
+TEST_CASE("ModelExecution - options survive a failed load", "[ModelExecution][InferenceOptions]")
+{
+    dl::ModelExecution exec(dl::BackendType::TorchScript);
+    dl::InferenceOptions const options{dl::InferencePrecision::Native, 3, 0};
+    REQUIRE(exec.setOptions(options));
+    CHECK_FALSE(exec.load("/nonexistent/path/model.pt"));
+    CHECK(exec.options() == options);
+}
+
 // Integration tests that require real model files are tagged [integration]
 // and skipped in CI unless ENABLE_INTEGRATION_TESTS is ON.
 // TEST_CASE("ModelExecution - load and run real .pt model", "[ModelExecution][integration]")
@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "models_v2/ModelExecution.hpp"
+#include "models_v2/backends/TorchScriptBackend.hpp"
+
+#include <ATen/Context.h> // at::globalContext
+#include <ATen/Functions.h> // at::randn
+#include <torch/script.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Scripted two-layer MLP whose forward() lowers to aten::linear.
+ */
+torch::jit::Module makeLinearModule() {
+    torch::jit::Module module("LinearMlp");
+    module.register_parameter("w1", at::randn({32, 16}), false);
+    module.register_parameter("b1", at::randn({32}), false);
+    module.register_parameter("w2", at::randn({8, 32}), false);
+    module.register_parameter("b2", at::randn({8}), false);
+    module.define(R"(
+        def forward(self, x):
+            h = torch.relu(torch.linear(x, self.w1, self.b1))
+            return torch.linear(h, self.w2, self.b2)
+    )");
+    module.eval();
+    return module;
+}
+
+/**
+ * @brief Scripted module with no linear layer to quantize.
+ */
+torch::jit::Module makeElementwiseModule() {
+    torch::jit::Module module("Elementwise");
+    module.register_parameter("scale", at::randn({16}), false);
+    module.define(R"(
+        def forward(self, x):
+            return x * self.scale
+    )");
+    module.eval();
+    return module;
+}
+
+/**
+ * @brief Save @p module to a unique file in the temp directory.
+ */
+std::filesystem::path saveModule(torch::jit::Module const & module, std::string const & name) {
+    auto path = std::filesystem::temp_directory_path() / ("wt_torchscript_backend_" + name + ".pt");
+    module.save(path.string());
+    return path;
+}
+
+/// int8 needs a CPU device and a quantized engine (fbgemm / qnnpack)
+bool canRunInt8() {
+    return dl::TorchScriptBackend{}.supportsPrecision(dl::InferencePrecision::DynamicInt8) &&
+           !at::globalContext().supportedQEngines().empty();
+}
+
+}// anonymous namespace
+
+// ============================================================================
+// Dynamic int8 quantization
+// ============================================================================
+
+TEST_CASE("TorchScriptBackend - int8 rewrites linear layers of a scripted module",
+          "[TorchScriptBackend][InferenceOptions]")
+{
+    if (!canRunInt8()) {
+        SKIP("int8 inference needs a CPU device and a quantized engine");
+    }
+
+    auto const path = saveModule(makeLinearModule(), "linear");
+    auto const input = at::randn({4, 16});
+
+    dl::TorchScriptBackend native;
+    REQUIRE(native.load(path));
+    auto const reference = native.execute({input});
+    REQUIRE(reference.size() == 1);
+
+    dl::TorchScriptBackend quantized;
+    REQUIRE(quantized.setPrecision(dl::InferencePrecision::DynamicInt8));
+    REQUIRE(quantized.load(path));
+    CHECK(quantized.quantizedLayerCount() == 2);
+
+    auto const outputs = quantized.execute({input});
+    REQUIRE(outputs.size() == 1);
+    REQUIRE(outputs[0].sizes() == reference[0].sizes());
+
+    // Per-channel int8 weights with reduced range: small relative error
+    auto const scale = reference[0].abs().max().item<float>();
+    auto const max_error = (outputs[0] - reference[0]).abs().max().item<float>();
+    CHECK(max_error <= 0.05f * scale + 1e-3f);
+
+    SECTION("switching back to native restores the float module") {
+        REQUIRE(quantized.setPrecision(dl::InferencePrecision::Native));
+        CHECK(quantized.quantizedLayerCount() == 0);
+        CHECK(at::allclose(quantized.execute({input})[0], reference[0]));
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("TorchScriptBackend - int8 falls back to native without linear layers",
+          "[TorchScriptBackend][InferenceOptions]")
+{
+    if (!canRunInt8()) {
+        SKIP("int8 inference needs a CPU device and a quantized engine");
+    }
+    auto const path = saveModule(makeElementwiseModule(), "elementwise");
+
+    SECTION("precision requested before load") {
+        dl::TorchScriptBackend backend;
+        REQUIRE(backend.setPrecision(dl::InferencePrecision::DynamicInt8));
+        REQUIRE(backend.load(path));
+        CHECK(backend.quantizedLayerCount() == 0);
+        // load() reverted to Native, so asking for int8 again must fail
+        CHECK_FALSE(backend.setPrecision(dl::InferencePrecision::DynamicInt8));
+    }
+
+    SECTION("precision requested after load") {
+        dl::TorchScriptBackend backend;
+        REQUIRE(backend.load(path));
+        CHECK_FALSE(backend.setPrecision(dl::InferencePrecision::DynamicInt8));
+        CHECK(backend.quantizedLayerCount() == 0);
+        CHECK(backend.isLoaded());
+    }
+
+    SECTION("ModelExecution reports native precision") {
+        dl::ModelExecution exec(dl::BackendType::TorchScript);
+        CHECK(exec.setOptions({dl::InferencePrecision::DynamicInt8, 0, 0}));
+        REQUIRE(exec.load(path));
+        CHECK(exec.options().precision == dl::InferencePrecision::Native);
+    }
+
+    std::filesystem::remove(path);
+}
@@ -215,6 +215,34 @@ TEST_CASE("RuntimeModelSpec - parse JSON missing required field", "[runtime]") {
     CHECK_FALSE(static_cast<bool>(result));
 }
 
+TEST_CASE("RuntimeModelSpec - parse inference options", "[runtime]") {
+    std::string const json = R"({
+        "model_id": "quantized",
+        "display_name": "Quantized",
+        "inputs": [{ "name": "x", "shape": [4] }],
+        "outputs": [{ "name": "y", "shape": [2] }],
+        "inference": { "precision": "int8_dynamic", "intra_op_threads": 4 }
+    })";
+    auto result = RuntimeModelSpec::fromJson(json);
+    REQUIRE(static_cast<bool>(result));
+
+    auto const & spec = result.value();
+    REQUIRE(spec.inference.has_value());
+    auto const options = spec.inference->toOptions();
+    CHECK(options.precision == InferencePrecision::DynamicInt8);
+    CHECK(options.intra_op_threads == 4);
+    CHECK(options.inter_op_threads == 0);
+    CHECK(spec.validate().empty());
+
+    auto bad = spec;
+    bad.inference->precision = "fp8";
+    bad.inference->inter_op_threads = -1;
+    auto const errors = bad.validate();
+    REQUIRE(errors.size() == 2);
+    CHECK_THAT(errors[0], ContainsSubstring("inference.precision"));
+    CHECK_THAT(errors[1], ContainsSubstring("inter_op_threads"));
+}
+
 // ═══════════════════════════════════════════════════════════════
 // RuntimeModelSpec - round-trip
 // ═══════════════════════════════════════════════════════════════
@@ -0,0 +1,161 @@
+/**
+ * @file EmbeddingCache.test.cpp
+ * @brief Unit tests for dl::EmbeddingCache persistent feature storage.
+ */
+
+#include "storage/EmbeddingCache.hpp"
+
+#include "Tensors/TensorData.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+class TempCacheDir {
+public:
+    TempCacheDir() {
+        std::random_device rd;
+        _path = std::filesystem::temp_directory_path() /
+                ("whiskertoolbox_embedding_cache_" + std::to_string(rd()));
+        std::filesystem::create_directories(_path);
+    }
+    ~TempCacheDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(_path, ec);
+    }
+    TempCacheDir(TempCacheDir const &) = delete;
+    TempCacheDir & operator=(TempCacheDir const &) = delete;
+
+    [[nodiscard]] std::filesystem::path const & path() const { return _path; }
+
+private:
+    std::filesystem::path _path;
+};
+
+dl::EmbeddingCacheKey makeKey() {
+    dl::EmbeddingCacheKey key;
+    key.media_identity = "/data/video.mp4|1024|42|100";
+    key.model_id = "general_encoder";
+    key.weights_digest = "0123456789abcdef";
+    key.parameters = R"({"input_resolution":224})";
+    key.output_slot = "features";
+    return key;
+}
+
+std::vector<float> rowFor(std::size_t frame, std::size_t dim) {
+    std::vector<float> values(dim);
+    for (std::size_t i = 0; i < dim; ++i) {
+        values[i] = static_cast<float>(frame) * 10.0f + static_cast<float>(i);
+    }
+    return values;
+}
+
+}// namespace
+
+TEST_CASE("EmbeddingCache - key digest distinguishes every field",
+          "[EmbeddingCache]") {
+    auto const base = makeKey();
+    REQUIRE(base.digest() == makeKey().digest());
+
+    auto other = base;
+    other.weights_digest = "fedcba9876543210";
+    REQUIRE(other.digest() != base.digest());
+
+    // Field boundaries are part of the canonical form
+    dl::EmbeddingCacheKey a;
+    a.model_id = "ab";
+    a.parameters = "c";
+    dl::EmbeddingCacheKey b;
+    b.model_id = "a";
+    b.parameters = "bc";
+    REQUIRE(a.canonical() != b.canonical());
+}
+
+TEST_CASE("EmbeddingCache - rows persist across reopen", "[EmbeddingCache]") {
+    TempCacheDir const dir;
+    auto const key = makeKey();
+    std::size_t const num_frames = 100;
+    std::size_t const dim = 8;
+
+    {
+        auto cache = dl::EmbeddingCache::open(dir.path(), key, num_frames, dim);
+        REQUIRE(cache->cachedCount() == 0);
+        REQUIRE(cache->missingFrames(0, num_frames - 1).size() == num_frames);
+
+        for (std::size_t f = 10; f < 20; ++f) {
+            cache->store(f, rowFor(f, dim));
+        }
+        REQUIRE(cache->contains(15));
+        REQUIRE_FALSE(cache->contains(20));
+        REQUIRE_FALSE(cache->contains(num_frames));
+        cache->flush();
+    }
+
+    auto cache = dl::EmbeddingCache::open(dir.path(), key, num_frames, dim);
+    REQUIRE(cache->path() == dl::EmbeddingCache::pathFor(dir.path(), key));
+    REQUIRE(cache->cachedCount() == 10);
+
+    auto const row = cache->row(12);
+    auto const expected = rowFor(12, dim);
+    REQUIRE(std::vector<float>(row.begin(), row.end()) == expected);
+
+    auto const missing = cache->missingFrames(8, 21);
+    REQUIRE(missing == std::vector<std::size_t>{8, 9, 20, 21});
+}
+
+TEST_CASE("EmbeddingCache - mismatched shape starts a fresh cache", "[EmbeddingCache]") {
+    TempCacheDir const dir;
+    auto const key = makeKey();
+
+    {
+        auto cache = dl::EmbeddingCache::open(dir.path(), key, 50, 4);
+        cache->store(3, rowFor(3, 4));
+    }
+
+    auto cache = dl::EmbeddingCache::open(dir.path(), key, 50, 16);
+    REQUIRE(cache->featureDim() == 16);
+    REQUIRE(cache->cachedCount() == 0);
+}
+
+TEST_CASE("EmbeddingCache - input validation", "[EmbeddingCache]") {
+    TempCacheDir const dir;
+    auto const key = makeKey();
+
+    REQUIRE_THROWS_AS(dl::EmbeddingCache::open(dir.path(), key, 0, 4), std::invalid_argument);
+
+    auto cache = dl::EmbeddingCache::open(dir.path(), key, 10, 4);
+    REQUIRE_THROWS_AS(cache->store(10, rowFor(10, 4)), std::out_of_range);
+    REQUIRE_THROWS_AS(cache->store(0, rowFor(0, 3)), std::invalid_argument);
+    REQUIRE_THROWS_AS(cache->row(0), std::out_of_range);
+}
+
+TEST_CASE("EmbeddingCache - zero-copy TensorData over cached frames", "[EmbeddingCache]") {
+    TempCacheDir const dir;
+    std::size_t const dim = 6;
+    auto cache = dl::EmbeddingCache::open(dir.path(), makeKey(), 40, dim);
+    for (std::size_t f = 5; f <= 14; ++f) {
+        cache->store(f, rowFor(f, dim));
+    }
+
+    REQUIRE(cache->toTensorData(4, 10) == nullptr);
+    REQUIRE(cache->toTensorData(10, 5) == nullptr);
+
+    auto tensor = cache->toTensorData(5, 14);
+    REQUIRE(tensor != nullptr);
+    REQUIRE(tensor->shape() == std::vector<std::size_t>{10, dim});
+    REQUIRE(tensor->storage().isContiguous());
+
+    // The tensor views the mapping directly and keeps it alive
+    auto const flat = tensor->storage().flatData();
+    REQUIRE(flat.data() == cache->row(5).data());
+    cache.reset();
+    REQUIRE(flat[3 * dim + 2] == rowFor(8, dim)[2]);
+}
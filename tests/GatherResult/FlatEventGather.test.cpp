@@ -0,0 +1,172 @@
+/**
+ * @file FlatEventGather.test.cpp
+ * @brief Tests for the CSR flat gather of trial-aligned events
+ */
+
+#include "GatherResult/FlatEventGather.hpp"
+#include "GatherResult/GatherResult.hpp"
+
+#include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "DigitalTimeSeries/Digital_Interval_Series.hpp"
+#include "TimeFrame/TimeFrame.hpp"
+
+#include "fixtures/GatherAlignmentFixtures.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using Neuralyzer::Test::GatherFixtures::createEventSeries;
+using Neuralyzer::Test::GatherFixtures::createIntervalSeries;
+using Neuralyzer::Test::GatherFixtures::createWindowsAroundEvents;
+
+namespace {
+
+/**
+ * @brief Reference CSR built by walking each GatherResult row view
+ */
+FlatEventGather flattenByViews(GatherResult<DigitalEventSeries> const & gathered) {
+    FlatEventGather result;
+    for (std::size_t i = 0; i < gathered.size(); ++i) {
+        auto const alignment = gathered.alignmentTimeAt(i).getValue();
+        result.alignment_times.push_back(alignment);
+        for (auto const & event: gathered[i]->view()) {
+            result.relative_times.push_back(event.time().getValue() - alignment);
+            result.entity_ids.push_back(event.id());
+        }
+        result.trial_offsets.push_back(result.relative_times.size());
+    }
+    return result;
+}
+
+void requireSameGather(FlatEventGather const & actual, FlatEventGather const & expected) {
+    REQUIRE(actual.trial_offsets == expected.trial_offsets);
+    REQUIRE(actual.relative_times == expected.relative_times);
+    REQUIRE(actual.entity_ids == expected.entity_ids);
+    REQUIRE(actual.alignment_times == expected.alignment_times);
+}
+
+std::vector<int64_t> randomSortedTimes(std::size_t count, int64_t range, std::mt19937 & rng) {
+    std::uniform_int_distribution<int64_t> dist(0, range);
+    std::vector<int64_t> times(count);
+    for (auto & t: times) {
+        t = dist(rng);
+    }
+    std::ranges::sort(times);
+    return times;
+}
+
+}// anonymous namespace
+
+TEST_CASE("FlatEventGather - matches per-trial views", "[FlatEventGather]") {
+    auto spikes = createEventSeries({5, 10, 12, 20, 31, 40, 41, 55, 70});
+    auto trials = createIntervalSeries({{0, 15}, {18, 35}, {38, 41}, {60, 65}});
+
+    auto const gathered = gather(spikes, trials);
+    auto const flat = gatherFlat(gathered);
+
+    REQUIRE(flat.trialCount() == 4);
+    REQUIRE(flat.eventCount() == 7);
+    REQUIRE(flat.trialSize(3) == 0);
+
+    // Without alignment points, times are relative to each window start
+    auto const trial1 = flat.trialTimes(1);
+    REQUIRE(std::vector<int64_t>(trial1.begin(), trial1.end()) == std::vector<int64_t>{2, 13});
+    requireSameGather(flat, flattenByViews(gathered));
+}
+
+TEST_CASE("FlatEventGather - randomized overlapping windows", "[FlatEventGather]") {
+    std::mt19937 rng(7);
+    auto spikes = createEventSeries(randomSortedTimes(5000, 100'000, rng));
+    auto alignment_times = randomSortedTimes(300, 98'000, rng);
+    for (auto & t: alignment_times) {
+        t += 1'000;
+    }
+    auto alignment = createEventSeries(alignment_times);
+    auto windows = createWindowsAroundEvents(alignment, 700, 400);
+
+    auto const gathered = gather(spikes, windows, alignment);
+    auto const expected = flattenByViews(gathered);
+
+    SECTION("Serial") {
+        requireSameGather(gatherFlat(gathered), expected);
+    }
+
+    SECTION("Parallel partitions by trial range") {
+        requireSameGather(gatherFlat(gathered, {.trials_per_chunk = 7}), expected);
+    }
+
+    SECTION("Reordered rows follow the visible order") {
+        std::vector<std::size_t> order(gathered.size());
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            order[i] = order.size() - 1 - i;
+        }
+        auto const reordered = gathered.reorder(order);
+        requireSameGather(gatherFlat(reordered), flattenByViews(reordered));
+        requireSameGather(gatherFlat(gathered).reorder(order), flattenByViews(reordered));
+    }
+}
+
+TEST_CASE("FlatEventGather - unsorted windows and view sources", "[FlatEventGather]") {
+    auto spikes = createEventSeries({1, 4, 9, 16, 25, 36, 49});
+
+    // Windows out of order and nested: cursors must restart correctly
+    std::vector<TimeFrameInterval> const windows{
+            {TimeFrameIndex(20), TimeFrameIndex(50)},
+            {TimeFrameIndex(0), TimeFrameIndex(10)},
+            {TimeFrameIndex(3), TimeFrameIndex(5)},
+            {TimeFrameIndex(30), TimeFrameIndex(20)}};
+    std::vector<int64_t> const alignment{20, 0, 3, 30};
+
+    SECTION("Owning source") {
+        auto const flat = gatherFlat(*spikes, windows, alignment);
+        REQUIRE(flat.trial_offsets == std::vector<std::size_t>{0, 3, 6, 7, 7});
+        REQUIRE(flat.relative_times == std::vector<int64_t>{5, 16, 29, 1, 4, 9, 1});
+    }
+
+    SECTION("View source is copied out once") {
+        auto const view = DigitalEventSeries::createView(spikes, TimeFrameIndex(4), TimeFrameIndex(36));
+        auto const flat = gatherFlat(*view, windows, alignment);
+        REQUIRE(flat.trial_offsets == std::vector<std::size_t>{0, 2, 4, 5, 5});
+        REQUIRE(flat.relative_times == std::vector<int64_t>{5, 16, 4, 9, 1});
+    }
+
+    SECTION("Mismatched alignment count throws") {
+        std::vector<int64_t> const too_few{0};
+        REQUIRE_THROWS_AS(gatherFlat(*spikes, windows, too_few), std::invalid_argument);
+    }
+}
+
+TEST_CASE("FlatEventGather - row-synthesized results fall back to views", "[FlatEventGather]") {
+    auto spikes = createEventSeries({2, 8, 15});
+    auto windows = createIntervalSeries({{0, 10}, {12, 20}});
+    auto alignment = createEventSeries({0, 12});
+    auto const direct = gather(spikes, windows, alignment);
+
+    auto const rows = GatherResult<DigitalEventSeries>::fromRows(
+            {direct[0], direct[1]}, direct.windows(), direct.alignmentPoints());
+    REQUIRE(rows.source() == nullptr);
+
+    requireSameGather(gatherFlat(rows), flattenByViews(rows));
+}
+
+TEST_CASE("FlatEventGather - reorder keeps missing trials", "[FlatEventGather]") {
+    FlatEventGather flat;
+    flat.trial_offsets = {0, 2, 2, 3};
+    flat.relative_times = {-1, 4, 7};
+    flat.entity_ids = {EntityId{1}, EntityId{2}, EntityId{3}};
+    flat.alignment_times = {10, 20, 30};
+    flat.missing_trials = {1};
+    REQUIRE(flat.presentTrialCount() == 2);
+
+    auto const reordered = flat.reorder({1, 2, 0});
+    CHECK(reordered.missing_trials == std::vector<std::size_t>{0});
+    CHECK(reordered.presentTrialCount() == 2);
+    CHECK(reordered.isTrialMissing(0));
+    CHECK_FALSE(reordered.isTrialMissing(1));
+    CHECK(reordered.trialSize(0) == 0);
+}
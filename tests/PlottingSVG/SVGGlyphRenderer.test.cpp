@@ -10,6 +10,10 @@
 
 #include <glm/glm.hpp>
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 using Catch::Matchers::ContainsSubstring;
 using GlyphType = CorePlotting::RenderableGlyphBatch::GlyphType;
 
@@ -215,3 +219,96 @@ TEST_CASE("SVGGlyphRenderer Circle position at origin with identity MVP",
     REQUIRE_THAT(elements[0], ContainsSubstring("cx=\"100\""));
     REQUIRE_THAT(elements[0], ContainsSubstring("cy=\"100\""));
 }
+
+TEST_CASE("SVGGlyphRenderer renderSimplified merges co-located glyphs into path runs",
+          "[PlottingSVG][SVGGlyphRenderer]") {
+    CorePlotting::RenderableGlyphBatch batch;
+    batch.glyph_type = GlyphType::Tick;
+    batch.size = 0.1f;
+    batch.model_matrix = glm::mat4{1.0f};
+    // Three ticks in the same device pixel plus one elsewhere, all red; then one blue tick
+    batch.positions = {glm::vec2{0.0f, 0.0f}, glm::vec2{0.001f, 0.0f}, glm::vec2{0.002f, 0.0f},
+                       glm::vec2{0.5f, 0.0f}, glm::vec2{-0.5f, 0.0f}};
+    glm::vec4 const red{1.0f, 0.0f, 0.0f, 1.0f};
+    batch.colors = {red, red, red, red, glm::vec4{0.0f, 0.0f, 1.0f, 1.0f}};
+    glm::mat4 const I{1.0f};
+
+    PlottingSVG::SVGSimplificationOptions options;
+    options.export_dpi = 96.0f;
+
+    auto const elements = PlottingSVG::SVGGlyphRenderer::renderSimplified(batch, I, I, 200, 200, options);
+    REQUIRE(elements.size() == 2);
+    REQUIRE_THAT(elements[0], ContainsSubstring("<path d=\"M"));
+    REQUIRE_THAT(elements[0], ContainsSubstring(R"(stroke="#FF0000")"));
+    REQUIRE_THAT(elements[1], ContainsSubstring(R"(stroke="#0000FF")"));
+
+    // Two red subpaths survive the merge
+    std::size_t moves = 0;
+    for (char const c: elements[0]) {
+        moves += c == 'M' ? 1U : 0U;
+    }
+    REQUIRE(moves == 2);
+}
+
+TEST_CASE("SVGGlyphRenderer renderSimplified without merging matches render",
+          "[PlottingSVG][SVGGlyphRenderer]") {
+    auto batch = makeSingleGlyphBatch(GlyphType::Cross);
+    batch.size = 0.1f;
+    glm::mat4 const I{1.0f};
+
+    PlottingSVG::SVGSimplificationOptions options;
+    options.merge_glyphs = false;
+
+    REQUIRE(PlottingSVG::SVGGlyphRenderer::renderSimplified(batch, I, I, 100, 100, options) ==
+            PlottingSVG::SVGGlyphRenderer::render(batch, I, I, 100, 100));
+}
+
+TEST_CASE("SVGGlyphRenderer renderSimplified rasterizes overdrawn batches",
+          "[PlottingSVG][SVGGlyphRenderer]") {
+    CorePlotting::RenderableGlyphBatch batch;
+    batch.glyph_type = GlyphType::Circle;
+    batch.size = 20.0f;// pixels
+    batch.model_matrix = glm::mat4{1.0f};
+    for (int i = 0; i < 400; ++i) {
+        batch.positions.emplace_back(static_cast<float>(i % 20) * 0.1f - 1.0f,
+                                     static_cast<float>(i / 20) * 0.1f - 1.0f);
+    }
+    glm::mat4 const I{1.0f};
+
+    PlottingSVG::SVGSimplificationOptions options;
+    options.raster_overdraw_ratio = 1.0f;
+
+    auto const elements = PlottingSVG::SVGGlyphRenderer::renderSimplified(batch, I, I, 100, 100, options);
+    REQUIRE(elements.size() == 1);
+    REQUIRE_THAT(elements[0], ContainsSubstring("<image"));
+    REQUIRE_THAT(elements[0], ContainsSubstring("data:image/png;base64,"));
+
+    SECTION("count threshold also triggers rasterization") {
+        options.raster_overdraw_ratio = 0.0f;
+        options.raster_glyph_threshold = 100;
+        auto const by_count = PlottingSVG::SVGGlyphRenderer::renderSimplified(batch, I, I, 100, 100, options);
+        REQUIRE(by_count.size() == 1);
+        REQUIRE_THAT(by_count[0], ContainsSubstring("<image"));
+    }
+}
+
+TEST_CASE("SVGGlyphRenderer sink overloads deliver the same elements in order",
+          "[PlottingSVG][SVGGlyphRenderer]") {
+    auto batch = makeSingleGlyphBatch(GlyphType::Cross);
+    batch.size = 0.1f;
+    batch.positions.emplace_back(0.5f, 0.5f);
+    batch.colors.emplace_back(0.0f, 0.0f, 1.0f, 1.0f);
+    glm::mat4 const I{1.0f};
+
+    std::vector<std::string> streamed;
+    auto const sink = [&streamed](std::string_view element) { streamed.emplace_back(element); };
+
+    PlottingSVG::SVGGlyphRenderer::render(batch, I, I, 100, 100, sink);
+    REQUIRE(streamed.size() == 4);
+    REQUIRE(streamed == PlottingSVG::SVGGlyphRenderer::render(batch, I, I, 100, 100));
+
+    streamed.clear();
+    PlottingSVG::SVGSimplificationOptions const options;
+    PlottingSVG::SVGGlyphRenderer::renderSimplified(batch, I, I, 100, 100, options, sink);
+    REQUIRE(streamed == PlottingSVG::SVGGlyphRenderer::renderSimplified(batch, I, I, 100, 100, options));
+}
@@ -136,3 +136,34 @@ TEST_CASE("SVGPolyLineRenderer applies MVP transform to vertices",
     REQUIRE_THAT(elements[0], ContainsSubstring("0,100"));
     REQUIRE_THAT(elements[0], ContainsSubstring("200,100"));
 }
+
+TEST_CASE("SVGPolyLineRenderer renderDecimated reduces dense lines to a per-pixel envelope",
+          "[PlottingSVG][SVGPolyLineRenderer]") {
+    CorePlotting::RenderablePolyLineBatch batch;
+    // 2000 samples across a 100 px canvas: 20 samples per pixel column
+    int const n = 2000;
+    for (int i = 0; i < n; ++i) {
+        float const x = -1.0f + 2.0f * static_cast<float>(i) / static_cast<float>(n);
+        float const y = (i % 2 == 0) ? 0.5f : -0.5f;
+        batch.vertices.push_back(x);
+        batch.vertices.push_back(y);
+    }
+    batch.line_start_indices = {0};
+    batch.line_vertex_counts = {n};
+    batch.thickness = 1.0f;
+    batch.model_matrix = glm::mat4{1.0f};
+    glm::mat4 const I{1.0f};
+
+    auto const full = PlottingSVG::SVGPolyLineRenderer::render(batch, I, I, 100, 100);
+    auto const decimated = PlottingSVG::SVGPolyLineRenderer::renderDecimated(batch, I, I, 100, 100, 1.0f);
+    REQUIRE(decimated.size() == 1);
+    REQUIRE(decimated[0].size() * 4 < full[0].size());
+    REQUIRE_THAT(decimated[0], ContainsSubstring(R"(stroke-linejoin="round")"));
+    // Envelope extremes are preserved
+    REQUIRE_THAT(decimated[0], ContainsSubstring(",25"));
+    REQUIRE_THAT(decimated[0], ContainsSubstring(",75"));
+
+    SECTION("non-positive bucket matches render") {
+        REQUIRE(PlottingSVG::SVGPolyLineRenderer::renderDecimated(batch, I, I, 100, 100, 0.0f) == full);
+    }
+}
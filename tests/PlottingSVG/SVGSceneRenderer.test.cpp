@@ -13,6 +13,8 @@
 
 #include <filesystem>
 #include <fstream>
+#include <memory>
+#include <sstream>
 
 using Catch::Matchers::ContainsSubstring;
 using Catch::Matchers::StartsWith;
@@ -271,3 +273,83 @@ TEST_CASE("SVGSceneRenderer render is deterministic",
     std::string const svg2 = renderer.render();
     REQUIRE(svg1 == svg2);
 }
+
+TEST_CASE("SVGSceneRenderer renderToStream matches render",
+          "[PlottingSVG][SVGSceneRenderer]") {
+    CorePlotting::RenderableScene scene;
+    scene.view_matrix = glm::mat4{1.0f};
+    scene.projection_matrix = glm::mat4{1.0f};
+
+    CorePlotting::RenderableGlyphBatch glyphs;
+    glyphs.positions = {glm::vec2{0.0f, 0.0f}, glm::vec2{0.5f, 0.5f}};
+    glyphs.glyph_type = CorePlotting::RenderableGlyphBatch::GlyphType::Circle;
+    glyphs.size = 5.0f;
+    glyphs.model_matrix = glm::mat4{1.0f};
+    scene.glyph_batches.push_back(glyphs);
+
+    CorePlotting::RenderablePolyLineBatch lines;
+    lines.vertices = {-0.5f, 0.0f, 0.5f, 0.0f};
+    lines.line_start_indices = {0};
+    lines.line_vertex_counts = {2};
+    lines.model_matrix = glm::mat4{1.0f};
+    scene.poly_line_batches.push_back(lines);
+
+    PlottingSVG::SVGSceneRenderer renderer;
+    renderer.setScene(scene);
+    renderer.setCanvasSize(100, 100);
+    renderer.addDecoration(std::make_unique<PlottingSVG::SVGScalebar>(10, 0.0f, 100.0f));
+
+    std::ostringstream out;
+    REQUIRE(renderer.renderToStream(out));
+    REQUIRE(out.str() == renderer.render());
+}
+
+TEST_CASE("SVGSceneRenderer simplified stream keeps layers and shrinks dense geometry",
+          "[PlottingSVG][SVGSceneRenderer]") {
+    CorePlotting::RenderableScene scene;
+    scene.view_matrix = glm::mat4{1.0f};
+    scene.projection_matrix = glm::mat4{1.0f};
+
+    CorePlotting::RenderableGlyphBatch glyphs;
+    glyphs.glyph_type = CorePlotting::RenderableGlyphBatch::GlyphType::Tick;
+    glyphs.size = 0.05f;
+    glyphs.model_matrix = glm::mat4{1.0f};
+    for (int i = 0; i < 5000; ++i) {
+        glyphs.positions.emplace_back(static_cast<float>(i % 50) * 0.001f, 0.0f);
+    }
+    scene.glyph_batches.push_back(glyphs);
+
+    CorePlotting::RenderablePolyLineBatch lines;
+    for (int i = 0; i < 5000; ++i) {
+        lines.vertices.push_back(-1.0f + 2.0f * static_cast<float>(i) / 5000.0f);
+        lines.vertices.push_back((i % 3 == 0) ? 0.25f : -0.25f);
+    }
+    lines.line_start_indices = {0};
+    lines.line_vertex_counts = {5000};
+    lines.model_matrix = glm::mat4{1.0f};
+    scene.poly_line_batches.push_back(lines);
+
+    PlottingSVG::SVGSceneRenderer renderer;
+    renderer.setScene(scene);
+    renderer.setCanvasSize(100, 100);
+
+    PlottingSVG::SVGSimplificationOptions options;
+    options.export_dpi = 96.0f;
+
+    std::ostringstream out;
+    REQUIRE(renderer.renderToStream(out, options));
+    std::string const svg = out.str();
+
+    REQUIRE_THAT(svg, StartsWith("<?xml"));
+    REQUIRE_THAT(svg, ContainsSubstring(R"(<g id="polylines">)"));
+    REQUIRE_THAT(svg, ContainsSubstring(R"(<g id="glyphs">)"));
+    REQUIRE_THAT(svg, ContainsSubstring("<path d="));
+    REQUIRE(svg.find("<line") == std::string::npos);
+    REQUIRE(svg.size() * 10 < renderer.render().size());
+
+    std::filesystem::path const temp_path =
+            std::filesystem::temp_directory_path() / "plottingsvg_test_simplified.svg";
+    REQUIRE(renderer.renderToFile(temp_path, options));
+    REQUIRE(std::filesystem::file_size(temp_path) == svg.size());
+    std::filesystem::remove(temp_path);
+}
@@ -0,0 +1,141 @@
+/**
+ * @file SVGSimplification.test.cpp
+ * @brief Tests for polyline min/max decimation and the PNG raster layer.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "PlottingSVG/SVGSimplification.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using Catch::Matchers::StartsWith;
+
+TEST_CASE("devicePixelWidth scales with export DPI",
+          "[PlottingSVG][SVGSimplification]") {
+    PlottingSVG::SVGSimplificationOptions options;
+    options.export_dpi = 96.0f;
+    REQUIRE(PlottingSVG::devicePixelWidth(options) == 1.0f);
+    options.export_dpi = 192.0f;
+    REQUIRE(PlottingSVG::devicePixelWidth(options) == 0.5f);
+    options.export_dpi = 0.0f;
+    REQUIRE(PlottingSVG::devicePixelWidth(options) == 1.0f);
+}
+
+TEST_CASE("rasterScale follows export DPI up to the size cap",
+          "[PlottingSVG][SVGSimplification]") {
+    PlottingSVG::SVGSimplificationOptions options;
+    options.export_dpi = 192.0f;
+    REQUIRE(PlottingSVG::rasterScale(options, 800, 600) == 2.0f);
+
+    options.raster_max_dimension = 1000;
+    REQUIRE(PlottingSVG::rasterScale(options, 800, 600) == 1.25f);
+
+    options.raster_max_dimension = 0;
+    options.export_dpi = 0.0f;
+    REQUIRE(PlottingSVG::rasterScale(options, 800, 600) == 1.0f);
+}
+
+TEST_CASE("decimateMinMax keeps first, extremes, and last per column",
+          "[PlottingSVG][SVGSimplification]") {
+    SECTION("dense column reduces to envelope in original order") {
+        std::vector<glm::vec2> const points{
+                {0.1f, 5.0f}, {0.2f, 9.0f}, {0.3f, 1.0f}, {0.4f, 4.0f}, {0.5f, 3.0f}, {1.5f, 2.0f}};
+        auto const out = PlottingSVG::decimateMinMax(points, 1.0f);
+
+        std::vector<glm::vec2> const expected{
+                {0.1f, 5.0f}, {0.2f, 9.0f}, {0.3f, 1.0f}, {0.5f, 3.0f}, {1.5f, 2.0f}};
+        REQUIRE(out == expected);
+    }
+
+    SECTION("sparse line is unchanged") {
+        std::vector<glm::vec2> const points{{0.0f, 0.0f}, {2.0f, 1.0f}, {4.0f, 0.0f}, {6.0f, 3.0f}};
+        REQUIRE(PlottingSVG::decimateMinMax(points, 1.0f) == points);
+    }
+
+    SECTION("long dense trace is bounded by four points per column") {
+        std::vector<glm::vec2> points;
+        for (int i = 0; i < 10000; ++i) {
+            float const x = static_cast<float>(i) * 0.01f;
+            points.emplace_back(x, (i % 7 == 0) ? 10.0f : static_cast<float>(i % 5));
+        }
+        auto const out = PlottingSVG::decimateMinMax(points, 1.0f);
+        REQUIRE(out.size() <= 4U * 101U);
+        REQUIRE(out.front() == points.front());
+        REQUIRE(out.back() == points.back());
+    }
+
+    SECTION("non-positive bucket returns input") {
+        std::vector<glm::vec2> const points{{0.1f, 1.0f}, {0.2f, 2.0f}, {0.3f, 3.0f}};
+        REQUIRE(PlottingSVG::decimateMinMax(points, 0.0f) == points);
+    }
+}
+
+TEST_CASE("RasterLayer composites glyph shapes",
+          "[PlottingSVG][SVGSimplification]") {
+    PlottingSVG::RasterLayer layer(8, 8);
+    REQUIRE(layer.empty());
+    REQUIRE(layer.toSVGImageElement().empty());
+
+    layer.fillRect(1.0f, 1.0f, 3.0f, 2.0f, glm::vec4{1.0f, 0.0f, 0.0f, 1.0f});
+    REQUIRE_FALSE(layer.empty());
+    REQUIRE(layer.pixel(1, 1) == std::array<std::uint8_t, 4>{255, 0, 0, 255});
+    REQUIRE(layer.pixel(2, 1) == std::array<std::uint8_t, 4>{255, 0, 0, 255});
+    REQUIRE(layer.pixel(3, 1)[3] == 0);
+    REQUIRE(layer.pixel(1, 2)[3] == 0);
+
+    // Half-transparent blue over opaque red stays opaque and mixes evenly
+    layer.fillRect(1.0f, 1.0f, 2.0f, 2.0f, glm::vec4{0.0f, 0.0f, 1.0f, 0.5f});
+    auto const mixed = layer.pixel(1, 1);
+    REQUIRE(mixed[3] == 255);
+    REQUIRE(mixed[0] >= 127);
+    REQUIRE(mixed[0] <= 128);
+    REQUIRE(mixed[2] >= 127);
+    REQUIRE(mixed[2] <= 128);
+
+    // Hairline narrower than a pixel still covers one pixel
+    layer.fillRect(5.2f, 0.0f, 5.4f, 8.0f, glm::vec4{1.0f});
+    REQUIRE(layer.pixel(5, 4)[3] == 255);
+
+    layer.fillCircle(4.0f, 4.0f, 1.0f, glm::vec4{0.0f, 1.0f, 0.0f, 1.0f});
+    REQUIRE(layer.pixel(3, 3)[1] == 255);
+    REQUIRE(layer.pixel(0, 7)[3] == 0);
+}
+
+TEST_CASE("RasterLayer encodes a PNG image element",
+          "[PlottingSVG][SVGSimplification]") {
+    PlottingSVG::RasterLayer layer(300, 300);
+    layer.fillRect(10.0f, 20.0f, 290.0f, 280.0f, glm::vec4{0.5f, 0.5f, 0.5f, 1.0f});
+
+    std::string const png = layer.toPNG();
+    REQUIRE_THAT(png, StartsWith(std::string("\x89PNG\r\n\x1a\n", 8)));
+    REQUIRE(png.find("IHDR") == 12U);
+    REQUIRE(png.find("IEND") == png.size() - 8U);
+    // Deflated: a flat fill is a small fraction of the raw filter byte plus RGBA per pixel
+    REQUIRE(png.size() < 300U * (300U * 4U + 1U) / 20U);
+
+    std::string const element = layer.toSVGImageElement();
+    REQUIRE_THAT(element, StartsWith(R"(<image x="10" y="20" width="280" height="260")"));
+    REQUIRE(element.find("data:image/png;base64,iVBORw0KGgo") != std::string::npos);
+}
+
+TEST_CASE("RasterLayer draws at its device scale",
+          "[PlottingSVG][SVGSimplification]") {
+    PlottingSVG::RasterLayer layer(10, 10, 2.0f);
+    REQUIRE(layer.width() == 20);
+    REQUIRE(layer.height() == 20);
+
+    // Canvas rect [2, 4) x [3, 5) covers device pixels [4, 8) x [6, 10)
+    layer.fillRect(2.0f, 3.0f, 4.0f, 5.0f, glm::vec4{1.0f, 0.0f, 0.0f, 1.0f});
+    REQUIRE(layer.pixel(4, 6)[3] == 255);
+    REQUIRE(layer.pixel(7, 9)[3] == 255);
+    REQUIRE(layer.pixel(8, 9)[3] == 0);
+    REQUIRE(layer.pixel(3, 6)[3] == 0);
+
+    // The image is placed back in canvas units
+    REQUIRE_THAT(layer.toSVGImageElement(), StartsWith(R"(<image x="2" y="3" width="2" height="2")"));
+}
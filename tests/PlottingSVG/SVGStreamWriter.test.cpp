@@ -0,0 +1,53 @@
+/**
+ * @file SVGStreamWriter.test.cpp
+ * @brief Tests for PlottingSVG::SVGStreamWriter streaming output.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "PlottingSVG/SVGDocument.hpp"
+#include "PlottingSVG/SVGStreamWriter.hpp"
+
+#include <sstream>
+
+using Catch::Matchers::ContainsSubstring;
+using Catch::Matchers::EndsWith;
+
+TEST_CASE("SVGStreamWriter matches SVGDocument build output",
+          "[PlottingSVG][SVGStreamWriter]") {
+    PlottingSVG::SVGDocument document(320, 240);
+    document.setBackground("#101010");
+    document.setDescription("Stream test");
+    document.addElements("a", {"<circle r=\"1\"/>", "<circle r=\"2\"/>"});
+    document.addElements("b", {"<line/>"});
+
+    std::ostringstream out;
+    PlottingSVG::SVGStreamWriter writer(out, 320, 240);
+    writer.writeHeader("#101010", "Stream test");
+    writer.beginLayer("a");
+    writer.writeElement("<circle r=\"1\"/>");
+    writer.writeElement("<circle r=\"2\"/>");
+    writer.beginLayer("b");
+    writer.writeElement("<line/>");
+    writer.finish();
+
+    REQUIRE(writer.good());
+    REQUIRE(out.str() == document.build());
+}
+
+TEST_CASE("SVGStreamWriter omits empty description and closes once",
+          "[PlottingSVG][SVGStreamWriter]") {
+    std::ostringstream out;
+    PlottingSVG::SVGStreamWriter writer(out, 10, 10);
+    writer.writeHeader("#FFFFFF", "");
+    writer.beginLayer("only");
+    writer.endLayer();
+    writer.finish();
+    writer.finish();
+
+    std::string const svg = out.str();
+    REQUIRE(svg.find("<desc>") == std::string::npos);
+    REQUIRE_THAT(svg, ContainsSubstring("  <g id=\"only\">\n  </g>\n"));
+    REQUIRE_THAT(svg, EndsWith("</g>\n</svg>\n"));
+}
@@ -12,6 +12,7 @@
 #include "AnalogTimeSeries/Analog_Time_Series.hpp"
 #include "DigitalTimeSeries/EventWithId.hpp"
 #include "TransformsV2/algorithms/RangeReductions/EventRangeReductions.hpp"
+#include "TransformsV2/algorithms/RangeReductions/FusedValueReductions.hpp"
 #include "TransformsV2/algorithms/RangeReductions/RegisteredRangeReductions.hpp"
 #include "TransformsV2/algorithms/RangeReductions/ValueRangeReductions.hpp"
 #include "TransformsV2/core/RangeReductionRegistry.hpp"
@@ -19,8 +20,11 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <array>
 #include <cmath>
 #include <limits>
+#include <random>
+#include <string>
 #include <vector>
 
 using namespace Neuralyzer::Transforms::V2::RangeReductions;
@@ -55,6 +59,19 @@ inline std::vector<AnalogTimeSeries::TimeValuePoint> makePoints(
     return points;
 }
 
+/**
+ * @brief Fused results must equal the kernel, up to summation order for moments
+ */
+inline void checkSameStatistic(float fused, float expected, bool exact) {
+    if (std::isnan(expected)) {
+        CHECK(std::isnan(fused));
+    } else if (exact || std::isinf(expected)) {
+        CHECK(fused == expected);
+    } else {
+        CHECK_THAT(fused, Catch::Matchers::WithinRel(expected, 1e-5f) || Catch::Matchers::WithinAbs(expected, 1e-4f));
+    }
+}
+
 // ============================================================================
 // Event Range Reduction Tests
 // ============================================================================
@@ -574,3 +591,116 @@ TEST_CASE("Registry - Type-safe execution works", "[RangeReductions][Registry]")
         CHECK(result == 3);// 0, 25, 50 are in [0, 100)
     }
 }
+
+// ============================================================================
+// Fused Value Reduction Tests
+// ============================================================================
+
+TEST_CASE("FusedValueReductions - matches single-statistic kernels", "[RangeReductions][Value][Fused]") {
+    using TimeValuePoint = AnalogTimeSeries::TimeValuePoint;
+
+    std::array const stats{
+            ValueStatistic::Max, ValueStatistic::Min, ValueStatistic::Mean, ValueStatistic::Std,
+            ValueStatistic::Sum, ValueStatistic::Range, ValueStatistic::TimeOfMax, ValueStatistic::TimeOfMin};
+
+    auto const checkAll = [&](std::vector<TimeValuePoint> const & points) {
+        auto const span = std::span<TimeValuePoint const>{points};
+        auto const fused = fusedValueReductions(span, std::span<ValueStatistic const>{stats});
+        REQUIRE(fused.size() == stats.size());
+        checkSameStatistic(fused[0], maxValue(span), true);
+        checkSameStatistic(fused[1], minValue(span), true);
+        checkSameStatistic(fused[2], meanValue(span), false);
+        checkSameStatistic(fused[3], stdValue(span), false);
+        checkSameStatistic(fused[4], sumValue(span), false);
+        checkSameStatistic(fused[5], valueRange(span), true);
+        checkSameStatistic(fused[6], timeOfMax(span), true);
+        checkSameStatistic(fused[7], timeOfMin(span), true);
+    };
+
+    SECTION("Random lengths around the lane width and chunk size") {
+        std::mt19937 rng(3);
+        std::normal_distribution<float> noise(500.0f, 3.0f);
+        for (std::size_t const n: {1u, 7u, 8u, 9u, 255u, 256u, 257u, 1001u}) {
+            std::vector<TimeValuePoint> points;
+            for (std::size_t i = 0; i < n; ++i) {
+                points.emplace_back(TimeFrameIndex{static_cast<int64_t>(10 * i)}, noise(rng));
+            }
+            checkAll(points);
+        }
+    }
+
+    SECTION("Ties keep the earliest extreme across lanes") {
+        std::vector<TimeValuePoint> points;
+        for (int i = 0; i < 40; ++i) {
+            float const v = (i == 13 || i == 29) ? 9.0f : ((i == 6 || i == 31) ? -9.0f : 0.0f);
+            points.emplace_back(TimeFrameIndex{i}, v);
+        }
+        checkAll(points);
+        auto const fused = fusedValueReductions(std::span<TimeValuePoint const>{points},
+                                                std::span<ValueStatistic const>{stats});
+        CHECK(fused[6] == 13.0f);
+        CHECK(fused[7] == 6.0f);
+    }
+
+    SECTION("NaN and infinite samples") {
+        float const nan = std::numeric_limits<float>::quiet_NaN();
+        float const inf = std::numeric_limits<float>::infinity();
+        checkAll(makePoints({{0, nan}, {1, 2.0f}, {2, 5.0f}, {3, nan}, {4, -1.0f}}));
+        checkAll(makePoints({{0, nan}, {1, nan}}));
+        checkAll(makePoints({{0, -inf}, {1, -inf}}));
+        checkAll(makePoints({{0, 1.0f}, {1, inf}, {2, 3.0f}}));
+    }
+
+    SECTION("Empty and single-sample ranges") {
+        checkAll({});
+        checkAll(makePoints({{5, 4.0f}}));
+    }
+
+    SECTION("Raw float span") {
+        std::vector<float> const values{3.0f, -1.0f, 4.0f, 1.0f, 5.0f, 9.0f, 2.0f, 6.0f, 5.0f, 3.0f};
+        std::array const raw_stats{ValueStatistic::Mean, ValueStatistic::Std, ValueStatistic::Max, ValueStatistic::Min};
+        auto const fused = fusedValueReductions(std::span<float const>{values},
+                                                std::span<ValueStatistic const>{raw_stats});
+        checkSameStatistic(fused[0], meanValueRaw(values), false);
+        checkSameStatistic(fused[1], stdValueRaw(values), false);
+        checkSameStatistic(fused[2], maxValueRaw(values), true);
+        checkSameStatistic(fused[3], minValueRaw(values), true);
+    }
+}
+
+TEST_CASE("Registry - executeManyErased matches individual reductions", "[RangeReductions][Registry][Fused]") {
+    using TimeValuePoint = AnalogTimeSeries::TimeValuePoint;
+    auto & registry = RangeReductionRegistry::instance();
+
+    SECTION("Value elements, mixed with a non-fusable reduction") {
+        auto points = makePoints({{0, 1.0f}, {10, 5.0f}, {20, 3.0f}, {30, 5.0f}, {40, -2.0f}});
+        std::any const input{std::span<TimeValuePoint const>{points}};
+        std::vector<std::string> const names{"MaxValue", "AreaUnderCurve", "TimeOfMax", "StdValue", "MaxValue"};
+
+        auto const results = registry.executeManyErased(names, typeid(TimeValuePoint), input);
+        REQUIRE(results.size() == names.size());
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            auto const expected = std::any_cast<float>(
+                    registry.executeErased(names[i], typeid(TimeValuePoint), input, NoReductionParams{}));
+            checkSameStatistic(std::any_cast<float>(results[i]), expected, names[i] != "StdValue");
+        }
+        CHECK(std::any_cast<float>(results[2]) == 10.0f);
+    }
+
+    SECTION("Raw float spans") {
+        std::vector<float> const values{2.0f, 4.0f, 4.0f, 4.0f, 5.0f, 5.0f, 7.0f, 9.0f};
+        std::any const input{std::span<float const>{values}};
+        std::vector<std::string> const names{"MeanValueRaw", "StdValueRaw"};
+
+        auto const results = registry.executeManyErased(names, typeid(float), input);
+        CHECK_THAT(std::any_cast<float>(results[0]), Catch::Matchers::WithinRel(5.0f, 1e-6f));
+        CHECK_THAT(std::any_cast<float>(results[1]), Catch::Matchers::WithinRel(2.0f, 1e-6f));
+    }
+
+    SECTION("Unknown reduction throws") {
+        std::vector<float> const values{1.0f};
+        std::any const input{std::span<float const>{values}};
+        std::vector<std::string> const names{"MeanValueRaw", "NoSuchReduction"};
+        CHECK_THROWS_AS(registry.executeManyErased(names, typeid(float), input), std::runtime_error);
+    }
+}
@@ -121,3 +121,21 @@ TEST_CASE("DeepLearningState round-trips output_bindings with nested decoder",
         }
     });
 }
+
+TEST_CASE("DeepLearningState round-trips embedding_cache_directory",
+          "[dl_widget][deep_learning_state]") {
+    DeepLearningState state;
+    CHECK(state.embeddingCacheDirectory().empty());
+
+    state.setEmbeddingCacheDirectory("/tmp/embeddings");
+    auto const json = state.toJson();
+
+    DeepLearningState restored;
+    REQUIRE(restored.fromJson(json));
+    CHECK(restored.embeddingCacheDirectory() == "/tmp/embeddings");
+
+    // Workspaces saved before the field existed still load
+    DeepLearningState legacy;
+    REQUIRE(legacy.fromJson(DeepLearningState{}.toJson()));
+    CHECK(legacy.embeddingCacheDirectory().empty());
+}
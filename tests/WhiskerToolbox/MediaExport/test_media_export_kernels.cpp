@@ -0,0 +1,47 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "MediaExport/media_export_kernels.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+TEST_CASE("convert_float_to_gray16 scales and clamps", "[MediaExport][kernels]") {
+    std::vector<float> const src = {0.0f, 1.0f, 127.5f, 255.0f, -3.0f, 300.0f,
+                                    std::numeric_limits<float>::quiet_NaN()};
+    std::vector<uint16_t> dst(src.size(), 1);
+
+    convert_float_to_gray16(src, dst);
+
+    std::vector<uint16_t> const expected = {0, 257, 32767, 65535, 0, 65535, 0};
+    REQUIRE(dst == expected);
+}
+
+TEST_CASE("convert_float_to_gray16 matches the scalar reference", "[MediaExport][kernels]") {
+    // Long enough to exercise the vector body and the scalar tail
+    std::vector<float> src(1027);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<float>(i) * 0.2731f - 10.0f;
+    }
+    std::vector<uint16_t> dst(src.size());
+    convert_float_to_gray16(src, dst);
+
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        float const clamped = std::fmin(std::fmax(src[i], 0.0f), 255.0f);
+        REQUIRE(dst[i] == static_cast<uint16_t>(clamped * 257.0f));
+    }
+}
+
+TEST_CASE("convert_gray16_to_gray8 divides by 257", "[MediaExport][kernels]") {
+    std::vector<uint16_t> src(65536);
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<uint8_t> dst(src.size());
+    convert_gray16_to_gray8(src, dst);
+
+    for (std::size_t i = 0; i < src.size(); ++i) {
+        REQUIRE(dst[i] == static_cast<uint8_t>(src[i] / 257u));
+    }
+}
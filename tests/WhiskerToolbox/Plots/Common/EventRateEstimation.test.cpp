@@ -7,6 +7,8 @@
  * - Normalization primitives (toFiringRateHz, toCountPerTrial, etc.)
  * - Helper functions (scalingLabel, allScalingModes)
  * - RateEstimate metadata preservation
+ * - Gaussian / causal exponential kernels and estimators
+ * - SEM, percentile and bootstrap confidence bands
  *
  * Most tests operate on synthetic RateEstimate data; gather-context tests use
  * a small DataManager fixture.
@@ -14,16 +16,23 @@
 
 #include "Plots/Common/EventRateEstimation/EventRateEstimation.hpp"
 #include "Plots/Common/EventRateEstimation/RateEstimate.hpp"
+#include "Plots/Common/EventRateEstimation/RateKernels.hpp"
 #include "Plots/Common/EventRateEstimation/RateNormalization.hpp"
+#include "Plots/Common/EventRateEstimation/RateUncertainty.hpp"
 #include "fixtures/GatherAlignmentFixtures.hpp"
 
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <memory>
+#include <numbers>
 #include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 using namespace Neuralyzer::Plots;
 using Catch::Approx;
@@ -467,3 +476,228 @@ TEST_CASE("RateEstimate times are bin centers",
     CHECK(est.times[3] == Approx(-15.0));
     CHECK(est.times[4] == Approx(-5.0));
 }
+
+// =============================================================================
+// Kernel estimators
+// =============================================================================
+
+TEST_CASE("gaussianSmooth matches a sampled Gaussian for narrow and wide kernels",
+          "[EventRateEstimation][Kernel]") {
+    for (double const sigma: {1.5, 40.0}) {
+        std::vector<double> values(1000, 0.0);
+        values[400] = 3.0;
+        gaussianSmooth(values, sigma);
+
+        double const norm = 3.0 / (sigma * std::sqrt(2.0 * std::numbers::pi));
+        for (size_t i = 300; i < 500; i += 7) {
+            double const d = static_cast<double>(i) - 400.0;
+            CHECK(values[i] == Approx(norm * std::exp(-0.5 * d * d / (sigma * sigma)))
+                                       .margin(1e-3 * norm));
+        }
+        CHECK(std::accumulate(values.begin(), values.end(), 0.0) == Approx(3.0).epsilon(1e-6));
+    }
+}
+
+TEST_CASE("GaussianSmoother rejects signals of the wrong length",
+          "[EventRateEstimation][Kernel]") {
+    GaussianSmoother const smoother(100, 50.0);
+    std::vector<double> values(99, 0.0);
+    CHECK_THROWS_AS(smoother.apply(values), std::invalid_argument);
+}
+
+TEST_CASE("causalExponentialSmooth is causal and preserves counts",
+          "[EventRateEstimation][Kernel]") {
+    std::vector<double> values(200, 0.0);
+    values[20] = 1.0;
+    causalExponentialSmooth(values, 10.0);
+
+    for (size_t i = 0; i < 20; ++i) {
+        CHECK(values[i] == 0.0);
+    }
+    double const a = std::exp(-0.1);
+    CHECK(values[20] == Approx(1.0 - a));
+    CHECK(values[30] == Approx((1.0 - a) * std::pow(a, 10.0)));
+    CHECK(std::accumulate(values.begin(), values.end(), 0.0) == Approx(1.0).epsilon(1e-6));
+}
+
+TEST_CASE("kernel estimators smooth the binned counts",
+          "[EventRateEstimation][Kernel]") {
+    auto dm = makeGatherDataManager();
+    PlotAlignmentData alignment;
+    alignment.alignment_event_key = "stimuli";
+    alignment.window_size = 100.0;
+
+    auto ctx = createUnitGatherContext(dm, "spikes", alignment);
+    REQUIRE(ctx.has_value());
+
+    auto const binned = estimateRate(ctx->gathered, ctx->time_frame.get(), 100.0,
+                                     BinningParams{.bin_size = 1.0});
+    double const total = std::accumulate(binned.values.begin(), binned.values.end(), 0.0);
+    REQUIRE(total > 0.0);
+
+    auto const gaussian = estimateRateWithTrials(ctx->gathered, ctx->time_frame.get(), 100.0,
+                                                 GaussianKernelParams{.sigma = 2.0, .eval_step = 1.0});
+    REQUIRE(gaussian.estimate.values.size() == binned.values.size());
+    CHECK(gaussian.estimate.times == binned.times);
+    CHECK(gaussian.estimate.num_trials == binned.num_trials);
+    CHECK(gaussian.trials.per_trial_values.size() == binned.num_trials);
+
+    // Each event sits at the alignment time (bin 50): the kernel peaks there
+    auto const peak = std::max_element(gaussian.estimate.values.begin(), gaussian.estimate.values.end());
+    CHECK(std::distance(gaussian.estimate.values.begin(), peak) ==
+          std::distance(binned.values.begin(), std::max_element(binned.values.begin(), binned.values.end())));
+
+    // Aggregate equals the sum of the smoothed trials
+    for (size_t i = 0; i < gaussian.estimate.values.size(); ++i) {
+        double sum = 0.0;
+        for (auto const & trial: gaussian.trials.per_trial_values) {
+            sum += trial[i];
+        }
+        CHECK(gaussian.estimate.values[i] == Approx(sum).margin(1e-9));
+    }
+
+    auto const causal = estimateRate(ctx->gathered, ctx->time_frame.get(), 100.0,
+                                     CausalExponentialParams{.tau = 5.0, .eval_step = 1.0});
+    REQUIRE(causal.values.size() == binned.values.size());
+    for (size_t i = 0; i < causal.values.size(); ++i) {
+        if (binned.values[i] > 0.0) {
+            break;
+        }
+        CHECK(causal.values[i] == 0.0);
+    }
+}
+
+TEST_CASE("estimateRates matches per-unit estimates and streams each unit once",
+          "[EventRateEstimation][Parallel]") {
+    auto dm = makeGatherDataManager();
+    TimeKey const time_key("test_time");
+    std::vector<std::string> keys;
+    for (int u = 0; u < 24; ++u) {
+        std::vector<int64_t> times;
+        for (int64_t t = u % 7; t < 400; t += 3 + u % 5) {
+            times.push_back(t);
+        }
+        keys.push_back("unit_" + std::to_string(u));
+        dm->setData<DigitalEventSeries>(keys.back(), createEventSeries(times), time_key);
+    }
+
+    PlotAlignmentData alignment;
+    alignment.alignment_event_key = "stimuli";
+    alignment.window_size = 100.0;
+    auto const units = createUnitGatherContexts(dm, keys, alignment);
+    REQUIRE(units.size() == keys.size());
+
+    EstimationParams const params = GaussianKernelParams{.sigma = 3.0, .eval_step = 1.0};
+    std::vector<int> seen(units.size(), 0);
+    auto const estimates = estimateRates(units, 100.0, params,
+                                         [&](size_t i, RateEstimate & est) {
+                                             ++seen.at(i);
+                                             for (auto & v: est.values) {
+                                                 v *= 2.0;
+                                             }
+                                         });
+
+    REQUIRE(estimates.size() == units.size());
+    CHECK(std::ranges::all_of(seen, [](int n) { return n == 1; }));
+    for (size_t i = 0; i < units.size(); ++i) {
+        auto const expected = estimateRate(units[i].gathered, units[i].time_frame.get(), 100.0, params);
+        REQUIRE(estimates[i].values.size() == expected.values.size());
+        CHECK(estimates[i].times == expected.times);
+        CHECK(estimates[i].num_trials == expected.num_trials);
+        // Edits made by the callback are kept
+        for (size_t k = 0; k < expected.values.size(); ++k) {
+            CHECK(estimates[i].values[k] == 2.0 * expected.values[k]);
+        }
+    }
+}
+
+// =============================================================================
+// Confidence bands
+// =============================================================================
+
+static RateEstimateWithTrials makeTrials(std::vector<std::vector<double>> rows) {
+    RateEstimateWithTrials data;
+    data.estimate = makeEstimate(std::vector<double>(rows.front().size(), 0.0),
+                                 -50.0, 10.0, rows.size());
+    for (auto const & row: rows) {
+        for (size_t t = 0; t < row.size(); ++t) {
+            data.estimate.values[t] += row[t];
+        }
+    }
+    data.trials.per_trial_values = std::move(rows);
+    return data;
+}
+
+TEST_CASE("computeSEM band is centered on the trial sum",
+          "[EventRateEstimation][Uncertainty]") {
+    auto const data = makeTrials({{1.0, 0.0}, {3.0, 0.0}, {5.0, 0.0}, {7.0, 0.0}});
+    auto const band = computeSEM(data, 1.0);
+    REQUIRE(band.lower.size() == 2);
+
+    // mean 4, sample sd sqrt(20/3), SEM = sd / 2, scaled by 4 trials
+    double const sem = std::sqrt(20.0 / 3.0) / 2.0;
+    CHECK(band.lower[0] == Approx(4.0 * (4.0 - sem)));
+    CHECK(band.upper[0] == Approx(4.0 * (4.0 + sem)));
+    CHECK(band.lower[1] == Approx(0.0));
+    CHECK(band.upper[1] == Approx(0.0));
+}
+
+TEST_CASE("computePercentileCI interpolates per-trial percentiles",
+          "[EventRateEstimation][Uncertainty]") {
+    auto const data = makeTrials({{0.0}, {10.0}, {20.0}, {30.0}, {40.0}});
+    auto const band = computePercentileCI(data, 25.0, 90.0);
+    REQUIRE(band.lower.size() == 1);
+    CHECK(band.lower[0] == Approx(5.0 * 10.0));
+    CHECK(band.upper[0] == Approx(5.0 * 36.0));
+}
+
+TEST_CASE("bootstrapCI brackets the estimate and is reproducible",
+          "[EventRateEstimation][Uncertainty]") {
+    std::vector<std::vector<double>> rows;
+    for (int i = 0; i < 60; ++i) {
+        rows.push_back({static_cast<double>(i % 5), 2.0, static_cast<double>(i % 3)});
+    }
+    auto const data = makeTrials(std::move(rows));
+
+    auto const band = bootstrapCI(data, 500, 0.9, 7);
+    REQUIRE(band.lower.size() == 3);
+    for (size_t t = 0; t < 3; ++t) {
+        CHECK(band.lower[t] <= data.estimate.values[t]);
+        CHECK(band.upper[t] >= data.estimate.values[t]);
+    }
+    // Constant column has no spread
+    CHECK(band.lower[1] == Approx(120.0));
+    CHECK(band.upper[1] == Approx(120.0));
+
+    auto const again = bootstrapCI(data, 500, 0.9, 7);
+    CHECK(again.lower == band.lower);
+    CHECK(again.upper == band.upper);
+
+    CHECK(bootstrapCI(data, 0, 0.9).lower.empty());
+    CHECK(bootstrapCI(data, 100, 1.0).lower.empty());
+    CHECK(bootstrapCI(RateEstimateWithTrials{}, 100, 0.9).lower.empty());
+}
+
+TEST_CASE("flat estimates skip missing trials",
+          "[EventRateEstimation][FlatEventGather]") {
+    // Three trials; trial 1 had a null row and is kept as an empty placeholder
+    FlatEventGather flat;
+    flat.trial_offsets = {0, 1, 1, 3};
+    flat.relative_times = {0, -2, 2};
+    flat.entity_ids = {EntityId{1}, EntityId{2}, EntityId{3}};
+    flat.alignment_times = {100, 200, 300};
+    flat.missing_trials = {1};
+
+    auto const result = estimateRateWithTrials(flat, 10.0, BinningParams{.bin_size = 1.0});
+    CHECK(result.estimate.num_trials == 2);
+    REQUIRE(result.trials.per_trial_values.size() == 2);
+
+    double const total = std::accumulate(result.estimate.values.begin(), result.estimate.values.end(), 0.0);
+    CHECK(total == Approx(3.0));
+    CHECK(std::accumulate(result.trials.per_trial_values[0].begin(),
+                          result.trials.per_trial_values[0].end(), 0.0) == Approx(1.0));
+    CHECK(std::accumulate(result.trials.per_trial_values[1].begin(),
+                          result.trials.per_trial_values[1].end(), 0.0) == Approx(2.0));
+
+    CHECK(estimateRate(flat, 10.0, BinningParams{.bin_size = 1.0}).num_trials == 2);
+}
@@ -18,12 +18,15 @@
 #include "CorePlotting/SceneGraph/RenderablePrimitives.hpp"
 #include "DataManager/DataManager.hpp"
 #include "DigitalTimeSeries/Digital_Event_Series.hpp"
+#include "Plots/Common/EventRateEstimation/EventRateEstimation.hpp"
 #include "Plots/HeatmapWidget/Core/HeatmapState.hpp"
 #include "TimeFrame/StrongTimeTypes.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <memory>
@@ -388,6 +391,87 @@ TEST_CASE("runHeatmapPipeline two units produces two rows",
     }
 }
 
+TEST_CASE("runHeatmapPipeline streams each row before returning",
+          "[HeatmapDataPipeline]") {
+    SingleUnitFixture f;
+    f.config.scaling = Neuralyzer::Plots::ScalingMode::ZScore;
+
+    auto tf = f.dm->getTime(TimeKey("time"));
+    std::vector<std::string> unit_keys = {"spikes"};
+    for (int u = 0; u < 16; ++u) {
+        std::vector<int> times;
+        for (int t = 450 + u; t < 550; t += 4 + u % 3) {
+            times.push_back(t);
+        }
+        auto series = createEventSeries(times);
+        series->setTimeFrame(tf);
+        unit_keys.push_back("unit_" + std::to_string(u));
+        f.dm->setData<DigitalEventSeries>(unit_keys.back(), series, TimeKey("time"));
+    }
+
+    // Callbacks run on worker threads: record only, assert afterwards
+    std::vector<std::vector<double>> streamed(unit_keys.size());
+    std::vector<std::string> streamed_keys(unit_keys.size());
+    std::vector<int> calls(unit_keys.size(), 0);
+    auto result = Neuralyzer::Plots::runHeatmapPipeline(
+            f.dm, unit_keys, f.alignment_data, f.config,
+            [&](std::size_t row_index, std::string const & key,
+                CorePlotting::HeatmapRowData const & row) {
+                ++calls.at(row_index);
+                streamed[row_index] = row.values;
+                streamed_keys[row_index] = key;
+            });
+
+    REQUIRE(result.success);
+    REQUIRE(result.rows.size() == unit_keys.size());
+    CHECK(streamed_keys == unit_keys);
+    CHECK(std::ranges::all_of(calls, [](int n) { return n == 1; }));
+    for (std::size_t i = 0; i < result.rows.size(); ++i) {
+        // Streamed rows are already scaled and match the final result
+        CHECK(streamed[i] == result.rows[i].values);
+    }
+}
+
+TEST_CASE("runHeatmapPipeline on gathered contexts matches and can be cancelled",
+          "[HeatmapDataPipeline]") {
+    SingleUnitFixture f;
+    auto tf = f.dm->getTime(TimeKey("time"));
+    auto spikes2 = createEventSeries({505, 515});
+    spikes2->setTimeFrame(tf);
+    f.dm->setData<DigitalEventSeries>("spikes2", spikes2, TimeKey("time"));
+    std::vector<std::string> const unit_keys = {"spikes", "spikes2"};
+
+    auto const expected = Neuralyzer::Plots::runHeatmapPipeline(
+            f.dm, unit_keys, f.alignment_data, f.config);
+    auto const contexts = Neuralyzer::Plots::createUnitGatherContexts(
+            f.dm, unit_keys, f.alignment_data);
+
+    SECTION("gathered contexts give the same rows") {
+        std::atomic<bool> const cancelled{false};
+        auto const result = Neuralyzer::Plots::runHeatmapPipeline(
+                contexts, f.config, {}, &cancelled);
+        REQUIRE(result.success);
+        REQUIRE(result.rows.size() == expected.rows.size());
+        for (std::size_t i = 0; i < result.rows.size(); ++i) {
+            CHECK(result.rows[i].values == expected.rows[i].values);
+        }
+    }
+
+    SECTION("a set flag stops the run and its rows") {
+        std::atomic<bool> const cancelled{true};
+        int calls = 0;
+        auto const result = Neuralyzer::Plots::runHeatmapPipeline(
+                contexts, f.config,
+                [&](std::size_t, std::string const &, CorePlotting::HeatmapRowData const &) {
+                    ++calls;
+                },
+                &cancelled);
+        CHECK_FALSE(result.success);
+        CHECK(result.rows.empty());
+        CHECK(calls == 0);
+    }
+}
+
 // =============================================================================
 // Multi-trial tests (multiple alignment events)
 // =============================================================================
@@ -192,6 +192,47 @@ TEST_CASE("buildScatterPoints: ATS x ATS with temporal offset on Y",
     CHECK(result.y_values[3] == 50.0f);
 }
 
+TEST_CASE("buildScatterPoints: ATS x ATS with repeated time indices",
+          "[ScatterPlot][BuildScatterPoints]")
+{
+    auto dm = makeDataManager();
+    auto tf = dm->getTime(TimeKey("time"));
+
+    std::vector<TimeFrameIndex> const repeated = {
+        TimeFrameIndex(0), TimeFrameIndex(1), TimeFrameIndex(1), TimeFrameIndex(2)};
+
+    SECTION("Y reads the last sample at a repeated index") {
+        addAnalogWithValues(*dm, "x_dense", {1.0f, 2.0f, 3.0f});
+        auto y_ats = std::make_shared<AnalogTimeSeries>(
+            std::vector<float>{10.0f, 20.0f, 21.0f, 30.0f}, repeated);
+        y_ats->setTimeFrame(tf);
+        dm->setData<AnalogTimeSeries>("y_repeated", y_ats, TimeKey("time"));
+
+        auto result = buildScatterPoints(*dm, ScatterAxisSource{.data_key = "x_dense"},
+                                         ScatterAxisSource{.data_key = "y_repeated"});
+
+        REQUIRE(result.size() == 3);
+        CHECK(result.x_values == std::vector<float>{1.0f, 2.0f, 3.0f});
+        CHECK(result.y_values == std::vector<float>{10.0f, 21.0f, 30.0f});
+    }
+
+    SECTION("X keeps every row but reads the first sample at a repeated index") {
+        auto x_ats = std::make_shared<AnalogTimeSeries>(
+            std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f}, repeated);
+        x_ats->setTimeFrame(tf);
+        dm->setData<AnalogTimeSeries>("x_repeated", x_ats, TimeKey("time"));
+        addAnalogWithValues(*dm, "y_dense", {10.0f, 20.0f, 30.0f});
+
+        auto result = buildScatterPoints(*dm, ScatterAxisSource{.data_key = "x_repeated"},
+                                         ScatterAxisSource{.data_key = "y_dense"});
+
+        REQUIRE(result.size() == 4);
+        CHECK(result.x_values == std::vector<float>{1.0f, 2.0f, 2.0f, 4.0f});
+        CHECK(result.y_values == std::vector<float>{10.0f, 20.0f, 20.0f, 30.0f});
+        CHECK(result.time_indices[2] == TimeFrameIndex(1));
+    }
+}
+
 // =============================================================================
 // AnalogTimeSeries × TensorData (TFI)
 // =============================================================================